@@ -9,86 +9,256 @@
 
 /*** CRC-8 ***/
 /* CRC-8 */
-#ifdef CRC_CRC8_LOOP_METHOD
-  #define CRC_CRC8_POLYNOMIAL (0x07)
+#if defined(CRC_CRC8_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_LOOP_METHOD)
+  #define CRC_CRC8_RESIDUE (0x00)
 #endif
 
 /* CRC-8/CDMA2000 */
-#ifdef CRC_CRC8_CDMA2000_LOOP_METHOD
-  #define CRC_CRC8_CDMA2000_POLYNOMIAL (0x9B)
+#if defined(CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_CDMA2000_LOOP_METHOD)
+  #define CRC_CRC8_CDMA2000_RESIDUE (0x00)
 #endif
 
 /* CRC-8/DARC */
-#ifdef CRC_CRC8_DARC_LOOP_METHOD
-  #define CRC_CRC8_DARC_POLYNOMIAL (0x39)
+#if defined(CRC_CRC8_DARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DARC_LOOP_METHOD)
+  #define CRC_CRC8_DARC_RESIDUE (0x00)
+#endif
+#ifdef CRC_CRC8_DARC_LOOKUP_TABLE_METHOD
+  #define CRC_CRC8_DARC_REFLECTED_STATE (true)
+#elif defined(CRC_CRC8_DARC_LOOP_METHOD)
+  #define CRC_CRC8_DARC_REFLECTED_STATE (false)
 #endif
 
 /* CRC-8/DVB-S2 */
-#ifdef CRC_CRC8_DVB_S2_LOOP_METHOD
-  #define CRC_CRC8_DVB_S2_POLYNOMIAL (0xD5)
+#if defined(CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DVB_S2_LOOP_METHOD)
+  #define CRC_CRC8_DVB_S2_RESIDUE (0x00)
 #endif
 
 /* CRC-8/EBU */
-#ifdef CRC_CRC8_EBU_LOOP_METHOD
-  #define CRC_CRC8_EBU_POLYNOMIAL (0x1D)
+#if defined(CRC_CRC8_EBU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_EBU_LOOP_METHOD)
+  #define CRC_CRC8_EBU_RESIDUE (0x00)
+#endif
+#ifdef CRC_CRC8_EBU_LOOKUP_TABLE_METHOD
+  #define CRC_CRC8_EBU_REFLECTED_STATE (true)
+#elif defined(CRC_CRC8_EBU_LOOP_METHOD)
+  #define CRC_CRC8_EBU_REFLECTED_STATE (false)
 #endif
 
 /* CRC-8/I-CODE */
-#ifdef CRC_CRC8_I_CODE_LOOP_METHOD
-  #define CRC_CRC8_I_CODE_POLYNOMIAL (0x1D)
+#if defined(CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_I_CODE_LOOP_METHOD)
+  #define CRC_CRC8_I_CODE_RESIDUE (0x00)
 #endif
 
 /* CRC-8/ITU*/
-#ifdef CRC_CRC8_ITU_LOOP_METHOD
-  #define CRC_CRC8_ITU_POLYNOMIAL (0x07)
-#endif
 #if defined(CRC_CRC8_ITU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ITU_LOOP_METHOD)
-  #define CRC_CRC8_ITU_XOR_OUT (0x55)
+  #define CRC_CRC8_ITU_RESIDUE (0xAC)
 #endif
 
 /* CRC-8/MAXIM */
-#ifdef CRC_CRC8_MAXIM_LOOP_METHOD
-  #define CRC_CRC8_MAXIM_POLYNOMIAL (0x31)
+#if defined(CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_MAXIM_LOOP_METHOD)
+  #define CRC_CRC8_MAXIM_RESIDUE (0x00)
+#endif
+#ifdef CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD
+  #define CRC_CRC8_MAXIM_REFLECTED_STATE (true)
+#elif defined(CRC_CRC8_MAXIM_LOOP_METHOD)
+  #define CRC_CRC8_MAXIM_REFLECTED_STATE (false)
 #endif
 
 /* CRC-8/ROHC */
-#ifdef CRC_CRC8_ROHC_LOOP_METHOD
-  #define CRC_CRC8_ROHC_POLYNOMIAL (0x07)
+#if defined(CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ROHC_LOOP_METHOD)
+  #define CRC_CRC8_ROHC_RESIDUE (0x00)
+#endif
+#ifdef CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD
+  #define CRC_CRC8_ROHC_REFLECTED_STATE (true)
+#elif defined(CRC_CRC8_ROHC_LOOP_METHOD)
+  #define CRC_CRC8_ROHC_REFLECTED_STATE (false)
 #endif
 
 /* CRC-8/WCDMA */
-#ifdef CRC_CRC8_WCDMA_LOOP_METHOD
-  #define CRC_CRC8_WCDMA_POLYNOMIAL (0x9B)
+#if defined(CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_WCDMA_LOOP_METHOD)
+  #define CRC_CRC8_WCDMA_RESIDUE (0x00)
+#endif
+#ifdef CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD
+  #define CRC_CRC8_WCDMA_REFLECTED_STATE (true)
+#elif defined(CRC_CRC8_WCDMA_LOOP_METHOD)
+  #define CRC_CRC8_WCDMA_REFLECTED_STATE (false)
 #endif
 
 /*** CRC-16 ***/
 /* CRC-16/ARC */
-#ifdef CRC_CRC16_ARC_LOOP_METHOD
-  #define CRC_CRC16_ARC_POLYNOMIAL (0x8005)
+#if defined(CRC_CRC16_ARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_ARC_LOOP_METHOD)
+  #define CRC_CRC16_ARC_RESIDUE (0x0000)
+#endif
+#ifdef CRC_CRC16_ARC_LOOKUP_TABLE_METHOD
+  #define CRC_CRC16_ARC_REFLECTED_STATE (true)
+#elif defined(CRC_CRC16_ARC_LOOP_METHOD)
+  #define CRC_CRC16_ARC_REFLECTED_STATE (false)
 #endif
 
 /* CRC-16/CCITT-FALSE */
-#ifdef CRC_CRC16_CCITT_FALSE_LOOP_METHOD
-  #define CRC_CRC16_CCITT_FALSE_POLYNOMIAL (0x1021)
-#endif
-
-/*** Reflect ***/
-/* U8 */
-#if defined(CRC_CRC8_DARC_LOOP_METHOD)  || \
-    defined(CRC_CRC8_EBU_LOOP_METHOD)   || \
-    defined(CRC_CRC8_MAXIM_LOOP_METHOD) || \
-    defined(CRC_CRC8_ROHC_LOOP_METHOD)  || \
-    defined(CRC_CRC8_WCDMA_LOOP_METHOD) || \
-    defined(CRC_CRC16_ARC_LOOP_METHOD)
-  #ifndef CRC_REFLECT_U8
-    #define CRC_REFLECT_U8
+#if defined(CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_CCITT_FALSE_LOOP_METHOD)
+  #define CRC_CRC16_CCITT_FALSE_RESIDUE (0x0000)
+#endif
+
+/*** Generic ***/
+#if defined(CRC_CRC8_LOOKUP_TABLE_METHOD)              || \
+    defined(CRC_CRC8_LOOP_METHOD)                      || \
+    defined(CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD)     || \
+    defined(CRC_CRC8_CDMA2000_LOOP_METHOD)             || \
+    defined(CRC_CRC8_DARC_LOOKUP_TABLE_METHOD)         || \
+    defined(CRC_CRC8_DARC_LOOP_METHOD)                 || \
+    defined(CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD)       || \
+    defined(CRC_CRC8_DVB_S2_LOOP_METHOD)               || \
+    defined(CRC_CRC8_EBU_LOOKUP_TABLE_METHOD)          || \
+    defined(CRC_CRC8_EBU_LOOP_METHOD)                  || \
+    defined(CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD)       || \
+    defined(CRC_CRC8_I_CODE_LOOP_METHOD)               || \
+    defined(CRC_CRC8_ITU_LOOKUP_TABLE_METHOD)          || \
+    defined(CRC_CRC8_ITU_LOOP_METHOD)                  || \
+    defined(CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD)        || \
+    defined(CRC_CRC8_MAXIM_LOOP_METHOD)                || \
+    defined(CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD)         || \
+    defined(CRC_CRC8_ROHC_LOOP_METHOD)                 || \
+    defined(CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD)        || \
+    defined(CRC_CRC8_WCDMA_LOOP_METHOD)                || \
+    defined(CRC_CRC16_ARC_LOOKUP_TABLE_METHOD)         || \
+    defined(CRC_CRC16_ARC_LOOP_METHOD)                 || \
+    defined(CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD) || \
+    defined(CRC_CRC16_CCITT_FALSE_LOOP_METHOD)
+  #ifndef CRC_GENERIC
+    #define CRC_GENERIC
   #endif
+  #define CRC_MULTI_BLOCK_LENGTH (2048) // Bytes Each Variant Runs Over Before The Next (Stays In L1 Cache)
 #endif
 
-/* U16 */
-#if defined(CRC_CRC16_ARC_LOOP_METHOD)
-  #ifndef CRC_REFLECT_U16
-    #define CRC_REFLECT_U16
+/*** Syndrome ***/
+#if defined(CRC_CRC8_LOOKUP_TABLE_METHOD)              || \
+    defined(CRC_CRC8_LOOP_METHOD)                      || \
+    defined(CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD) || \
+    defined(CRC_CRC16_CCITT_FALSE_LOOP_METHOD)
+  #define CRC_SYNDROME
+  #define CRC_SYNDROME_AMBIGUOUS    (0x80000000UL) // More Than One Error Pattern Shares Syndrome
+  #define CRC_SYNDROME_FIRST_MASK   (0x000FFFFFUL) // First Bit Distance + 1
+  #define CRC_SYNDROME_SECOND_MASK  (0x000003FFUL) // Second Bit Distance + 1 (Double Bit Errors)
+  #define CRC_SYNDROME_SECOND_SHIFT (20)
+#endif
+
+/*** Reverse ***/
+#if defined(CRC_REVERSE) && !defined(CRC_GENERIC)
+  #error CRC_REVERSE Requires At Least One CRC Method To Be Defined
+#endif
+
+/*** Metrics ***/
+#ifdef CRC_METRICS
+  #ifndef CRC_METRICS_SAMPLE_PERIOD
+    #define CRC_METRICS_SAMPLE_PERIOD (64) // Calls Per Thread Between Timed Calls
+  #endif
+  #if defined(__x86_64__) || defined(__i386__)
+    #define CRC_METRICS_TSC
+  #endif
+#endif
+
+/*** JIT ***/
+#ifdef CRC_JIT
+  #define CRC_JIT_CACHE_COUNT (16)  // Parameter Sets Kept (Further Sets Build Uncached Tables Per Call)
+  #define CRC_JIT_CODE_LENGTH (256) // Emitted Kernel Buffer Length
+  #define CRC_JIT_SLICE_COUNT (8)   // Bytes Per Kernel Block
+  #if defined(__x86_64__) && defined(__unix__)
+    #define CRC_JIT_NATIVE
+    #ifndef _DEFAULT_SOURCE
+      #define _DEFAULT_SOURCE // MAP_ANONYMOUS Under Strict ISO C
+    #endif
+  #endif
+#endif
+
+/*** Table ***/
+#ifdef CRC_TABLE
+  #ifndef CRC_TABLE_BUDGET
+    #define CRC_TABLE_BUDGET (32768) // Bytes Of Built Tables Kept Before Idle Tables Are Evicted
+  #endif
+  #define CRC_TABLE_BUCKET_COUNT (64)          // Hash Buckets
+  #define CRC_TABLE_LENGTH       (256)         // Entries Per Table
+  #define CRC_TABLE_BLOB_MAGIC   ("CRCTAB1")   // Blob Magic (Including Terminator)
+#endif
+
+/*** Registry ***/
+#if defined(CRC_REGISTRY) && !defined(CRC_GENERIC)
+  #error CRC_REGISTRY Requires At Least One CRC Method To Be Defined
+#endif
+#ifdef CRC_REGISTRY
+  #define CRC_REGISTRY_SLOT_BITS  (6)
+  #define CRC_REGISTRY_SLOT_COUNT (1U << CRC_REGISTRY_SLOT_BITS)
+  #define CRC_REGISTRY_SEED       (0x811C9DDEU) // FNV-1a Basis Giving Every Name Its Own Slot (Search Again When Adding Names)
+  
+  /* Registry Entry Functions (Crc: Registry Suffix, crc: Variant Prefix, type: CRC Type) */
+  #define CRC_REGISTRY_INITIALIZE(Crc, Initial)                                                        \
+      static uint16_t crc_registry##Crc##Initialize(void)                                              \
+      {                                                                                                \
+          return Initial;                                                                              \
+      }
+  #define CRC_REGISTRY_UPDATE(Crc, crc, type)                                                          \
+      static uint16_t crc_registry##Crc##Update(uint16_t state, const uint8_t * const Data, const uint16_t DataLength) \
+      {                                                                                                \
+          type value = (type)state;                                                                    \
+          uint32_t i;                                                                                  \
+                                                                                                       \
+          if(Data == NULL)                                                                             \
+              return state;                                                                            \
+                                                                                                       \
+          for(i = 0; i < DataLength; i++)                                                              \
+              value = crc_##crc##Step(Data[i], value);                                                 \
+                                                                                                       \
+          return value;                                                                                \
+      }
+  #define CRC_REGISTRY_FINALIZE(Crc, crc)                                                              \
+      static uint16_t crc_registry##Crc##Finalize(const uint16_t State)                                \
+      {                                                                                                \
+          return crc_genericCrcFromState(&crc_##crc##Parameters, State);                               \
+      }
+  #define CRC_REGISTRY_COMBINE(Crc, crc)                                                               \
+      static uint16_t crc_registry##Crc##Combine(const uint16_t CrcA, const uint16_t CrcB, const uint32_t LengthB) \
+      {                                                                                                \
+          if(LengthB == 0)                                                                             \
+              return CrcA;                                                                             \
+                                                                                                       \
+          return crc_genericStripPrefix(&crc_##crc##Parameters, CrcB, CrcA, LengthB);                  \
+      }
+#endif
+
+/*** Model ***/
+#if defined(CRC_JIT) || defined(CRC_TABLE)
+  #define CRC_MODEL
+#endif
+
+/*** Atomic ***/
+#if defined(CRC_METRICS) || defined(CRC_JIT)
+  #if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
+    #define CRC_STDATOMIC
+    #define CRC_ATOMIC                             _Atomic
+    #define CRC_ATOMIC_RELAXED                     memory_order_relaxed
+    #define CRC_ATOMIC_ACQUIRE                     memory_order_acquire
+    #define CRC_ATOMIC_RELEASE                     memory_order_release
+    #define CRC_ATOMIC_LOAD(object, order)         atomic_load_explicit(object, order)
+    #define CRC_ATOMIC_STORE(object, value, order) atomic_store_explicit(object, value, order)
+  #elif defined(__GNUC__) || defined(__clang__)
+    #define CRC_ATOMIC
+    #define CRC_ATOMIC_RELAXED                     __ATOMIC_RELAXED
+    #define CRC_ATOMIC_ACQUIRE                     __ATOMIC_ACQUIRE
+    #define CRC_ATOMIC_RELEASE                     __ATOMIC_RELEASE
+    #define CRC_ATOMIC_LOAD(object, order)         __atomic_load_n(object, order)
+    #define CRC_ATOMIC_STORE(object, value, order) __atomic_store_n(object, value, order)
+  #else
+    #error CRC_METRICS And CRC_JIT Require C11 Atomics Or GCC Atomic Builtins
+  #endif
+#endif
+
+/*** Thread Local ***/
+#ifdef CRC_METRICS
+  #if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+    #define CRC_THREAD_LOCAL _Thread_local
+  #elif defined(__GNUC__) || defined(__clang__)
+    #define CRC_THREAD_LOCAL __thread
+  #else
+    #error CRC_METRICS Requires C11 Thread Storage Or GCC __thread
   #endif
 #endif
 
@@ -97,9 +267,134 @@
  ****************************************************************************************************/
 
 #include "crc.h"
+#include "crc_inline.h"
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
+#ifdef CRC_METRICS
+  #include <pthread.h>
+  #include <stdlib.h>
+  #ifdef CRC_METRICS_TSC
+    #include <x86intrin.h>
+  #else
+    #include <time.h>
+  #endif
+#endif
+#ifdef CRC_JIT
+  #include <pthread.h>
+  #ifdef CRC_JIT_NATIVE
+    #include <string.h>
+    #include <sys/mman.h>
+  #endif
+#endif
+#ifdef CRC_TABLE
+  #include <fcntl.h>
+  #include <pthread.h>
+  #include <stdio.h>
+  #include <stdlib.h>
+  #include <string.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+#ifdef CRC_REGISTRY
+  #include <string.h>
+#endif
+#ifdef CRC_STDATOMIC
+  #include <stdatomic.h>
+#endif
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+/*** Generic ***/
+#ifdef CRC_GENERIC
+  typedef struct
+  {
+      uint16_t polynomial; // Polynomial (Normal Form, Implicit x^width Term)
+      uint16_t initial;    // Initial Value
+      uint16_t xorOut;     // Output XOR Value
+      uint8_t width;       // CRC Width (8 Or 16 Bits)
+      bool reflect;        // Reflect Input And Output
+      bool reflectedState; // Partial (Between Bytes) State Is Reflected Register
+      uint8_t reserved;    // Explicit Padding
+  } crc_parameters_t;
+#endif
+
+/*** Metrics ***/
+#ifdef CRC_METRICS
+  typedef struct
+  {
+      CRC_ATOMIC uint64_t calls;                            // Calculate Calls
+      CRC_ATOMIC uint64_t bytes;                            // Bytes Passed To Calculate
+      CRC_ATOMIC uint64_t sampledCycles;                    // Total Duration Of Timed Calls
+      CRC_ATOMIC uint64_t length[CRC_METRICS_BUCKET_COUNT]; // Calls By floor(log2(DataLength))
+      CRC_ATOMIC uint64_t cycles[CRC_METRICS_BUCKET_COUNT]; // Timed Calls By floor(log2(Duration))
+  } crc_metrics_counter_t;
+
+  typedef struct crc_metrics_thread_s
+  {
+      crc_metrics_counter_t counter[CRC_VARIANT_COUNT]; // Counters (Written Only By Owning Thread)
+      struct crc_metrics_thread_s *previous;            // Previous Registered Thread
+      struct crc_metrics_thread_s *next;                // Next Registered Thread
+      uint64_t sample;                                  // Calls Until Next Timed Call
+  } crc_metrics_thread_t;
+#endif
+
+/*** JIT ***/
+#ifdef CRC_JIT
+  typedef uint32_t (*crc_jit_kernel_t)(uint32_t reg, const uint8_t *data, size_t blockCount);
+
+  typedef struct
+  {
+      uint16_t polynomial;                      // Polynomial (Normal Form)
+      uint8_t width;                            // CRC Width (8 Or 16 Bits)
+      bool reflectIn;                           // Register Kept Reflected (Shifts Right)
+      uint32_t reserved;                        // Explicit Padding
+      uint16_t table[CRC_JIT_SLICE_COUNT][256]; // Register After Byte Then table Index Zero Bytes
+      crc_jit_kernel_t kernel;                  // Emitted Block Kernel (NULL: Interpreter)
+  } crc_jit_entry_t;
+#endif
+
+/*** Table ***/
+#ifdef CRC_TABLE
+  struct crc_table_s
+  {
+      struct crc_table_s *bucketNext;   // Next Table In Hash Bucket
+      struct crc_table_s *idlePrevious; // More Recently Released Idle Table
+      struct crc_table_s *idleNext;     // Less Recently Released Idle Table
+      const uint16_t *lookup;           // Table Entries (built Or Mapped Blob Record)
+      uint32_t references;              // Outstanding Handles
+      uint16_t polynomial;              // Polynomial (Normal Form)
+      uint8_t width;                    // CRC Width (8 Or 16 Bits)
+      bool reflectIn;                   // Table For Reflected Register (Shifts Right)
+      uint16_t built[];                 // Built Entries (Absent For Mapped Tables)
+  };
+
+  typedef struct
+  {
+      char magic[8];         // CRC_TABLE_BLOB_MAGIC
+      uint32_t count;        // Number Of Records (Sorted By Key)
+      uint32_t recordLength; // sizeof(crc_table_record_t) (Rejects Blobs Of Other Builds)
+  } crc_table_header_t;
+
+  typedef struct
+  {
+      uint32_t key;                       // Key (See crc_tableKey)
+      uint16_t lookup[CRC_TABLE_LENGTH];  // Table Entries
+  } crc_table_record_t;
+#endif
+
+/*** Registry ***/
+#ifdef CRC_REGISTRY
+  typedef struct
+  {
+      const char *name;      // Canonical Name Or Alias (NULL: Empty Slot)
+      crc_variant_t variant; // Variant Named
+      uint32_t reserved;     // Explicit Padding
+  } crc_registry_slot_t;
+#endif
 
 /****************************************************************************************************
  * Constants and Variables
@@ -108,7 +403,7 @@
 /*** CRC-8 ***/
 /* CRC-8 */
 #ifdef CRC_CRC8_LOOKUP_TABLE_METHOD
-  static const uint8_t crc_crc8LookupTable[256] =
+  const uint8_t crc_inlineCrc8LookupTable[256] =
   {
       0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15, 0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D,
       0x70, 0x77, 0x7E, 0x79, 0x6C, 0x6B, 0x62, 0x65, 0x48, 0x4F, 0x46, 0x41, 0x54, 0x53, 0x5A, 0x5D,
@@ -131,30 +426,30 @@
 
 /* CRC-8/CDMA2000 */
 #ifdef CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD
-  static const uint8_t crc_crc8Cdma2000LookupTable[256] =
+  const uint8_t crc_inlineCrc8Cdma2000LookupTable[256] =
   {
-      0x7B, 0xE0, 0xD6, 0x4D, 0xBA, 0x21, 0x17, 0x8C, 0x62, 0xF9, 0xCF, 0x54, 0xA3, 0x38, 0x0E, 0x95,
-      0x49, 0xD2, 0xE4, 0x7F, 0x88, 0x13, 0x25, 0xBE, 0x50, 0xCB, 0xFD, 0x66, 0x91, 0x0A, 0x3C, 0xA7,
-      0x1F, 0x84, 0xB2, 0x29, 0xDE, 0x45, 0x73, 0xE8, 0x06, 0x9D, 0xAB, 0x30, 0xC7, 0x5C, 0x6A, 0xF1,
-      0x2D, 0xB6, 0x80, 0x1B, 0xEC, 0x77, 0x41, 0xDA, 0x34, 0xAF, 0x99, 0x02, 0xF5, 0x6E, 0x58, 0xC3,
-      0xB3, 0x28, 0x1E, 0x85, 0x72, 0xE9, 0xDF, 0x44, 0xAA, 0x31, 0x07, 0x9C, 0x6B, 0xF0, 0xC6, 0x5D,
-      0x81, 0x1A, 0x2C, 0xB7, 0x40, 0xDB, 0xED, 0x76, 0x98, 0x03, 0x35, 0xAE, 0x59, 0xC2, 0xF4, 0x6F,
-      0xD7, 0x4C, 0x7A, 0xE1, 0x16, 0x8D, 0xBB, 0x20, 0xCE, 0x55, 0x63, 0xF8, 0x0F, 0x94, 0xA2, 0x39,
-      0xE5, 0x7E, 0x48, 0xD3, 0x24, 0xBF, 0x89, 0x12, 0xFC, 0x67, 0x51, 0xCA, 0x3D, 0xA6, 0x90, 0x0B,
-      0x70, 0xEB, 0xDD, 0x46, 0xB1, 0x2A, 0x1C, 0x87, 0x69, 0xF2, 0xC4, 0x5F, 0xA8, 0x33, 0x05, 0x9E,
-      0x42, 0xD9, 0xEF, 0x74, 0x83, 0x18, 0x2E, 0xB5, 0x5B, 0xC0, 0xF6, 0x6D, 0x9A, 0x01, 0x37, 0xAC,
-      0x14, 0x8F, 0xB9, 0x22, 0xD5, 0x4E, 0x78, 0xE3, 0x0D, 0x96, 0xA0, 0x3B, 0xCC, 0x57, 0x61, 0xFA,
-      0x26, 0xBD, 0x8B, 0x10, 0xE7, 0x7C, 0x4A, 0xD1, 0x3F, 0xA4, 0x92, 0x09, 0xFE, 0x65, 0x53, 0xC8,
-      0xB8, 0x23, 0x15, 0x8E, 0x79, 0xE2, 0xD4, 0x4F, 0xA1, 0x3A, 0x0C, 0x97, 0x60, 0xFB, 0xCD, 0x56,
-      0x8A, 0x11, 0x27, 0xBC, 0x4B, 0xD0, 0xE6, 0x7D, 0x93, 0x08, 0x3E, 0xA5, 0x52, 0xC9, 0xFF, 0x64,
-      0xDC, 0x47, 0x71, 0xEA, 0x1D, 0x86, 0xB0, 0x2B, 0xC5, 0x5E, 0x68, 0xF3, 0x04, 0x9F, 0xA9, 0x32,
-      0xEE, 0x75, 0x43, 0xD8, 0x2F, 0xB4, 0x82, 0x19, 0xF7, 0x6C, 0x5A, 0xC1, 0x36, 0xAD, 0x9B, 0x00
+      0x00, 0x9B, 0xAD, 0x36, 0xC1, 0x5A, 0x6C, 0xF7, 0x19, 0x82, 0xB4, 0x2F, 0xD8, 0x43, 0x75, 0xEE,
+      0x32, 0xA9, 0x9F, 0x04, 0xF3, 0x68, 0x5E, 0xC5, 0x2B, 0xB0, 0x86, 0x1D, 0xEA, 0x71, 0x47, 0xDC,
+      0x64, 0xFF, 0xC9, 0x52, 0xA5, 0x3E, 0x08, 0x93, 0x7D, 0xE6, 0xD0, 0x4B, 0xBC, 0x27, 0x11, 0x8A,
+      0x56, 0xCD, 0xFB, 0x60, 0x97, 0x0C, 0x3A, 0xA1, 0x4F, 0xD4, 0xE2, 0x79, 0x8E, 0x15, 0x23, 0xB8,
+      0xC8, 0x53, 0x65, 0xFE, 0x09, 0x92, 0xA4, 0x3F, 0xD1, 0x4A, 0x7C, 0xE7, 0x10, 0x8B, 0xBD, 0x26,
+      0xFA, 0x61, 0x57, 0xCC, 0x3B, 0xA0, 0x96, 0x0D, 0xE3, 0x78, 0x4E, 0xD5, 0x22, 0xB9, 0x8F, 0x14,
+      0xAC, 0x37, 0x01, 0x9A, 0x6D, 0xF6, 0xC0, 0x5B, 0xB5, 0x2E, 0x18, 0x83, 0x74, 0xEF, 0xD9, 0x42,
+      0x9E, 0x05, 0x33, 0xA8, 0x5F, 0xC4, 0xF2, 0x69, 0x87, 0x1C, 0x2A, 0xB1, 0x46, 0xDD, 0xEB, 0x70,
+      0x0B, 0x90, 0xA6, 0x3D, 0xCA, 0x51, 0x67, 0xFC, 0x12, 0x89, 0xBF, 0x24, 0xD3, 0x48, 0x7E, 0xE5,
+      0x39, 0xA2, 0x94, 0x0F, 0xF8, 0x63, 0x55, 0xCE, 0x20, 0xBB, 0x8D, 0x16, 0xE1, 0x7A, 0x4C, 0xD7,
+      0x6F, 0xF4, 0xC2, 0x59, 0xAE, 0x35, 0x03, 0x98, 0x76, 0xED, 0xDB, 0x40, 0xB7, 0x2C, 0x1A, 0x81,
+      0x5D, 0xC6, 0xF0, 0x6B, 0x9C, 0x07, 0x31, 0xAA, 0x44, 0xDF, 0xE9, 0x72, 0x85, 0x1E, 0x28, 0xB3,
+      0xC3, 0x58, 0x6E, 0xF5, 0x02, 0x99, 0xAF, 0x34, 0xDA, 0x41, 0x77, 0xEC, 0x1B, 0x80, 0xB6, 0x2D,
+      0xF1, 0x6A, 0x5C, 0xC7, 0x30, 0xAB, 0x9D, 0x06, 0xE8, 0x73, 0x45, 0xDE, 0x29, 0xB2, 0x84, 0x1F,
+      0xA7, 0x3C, 0x0A, 0x91, 0x66, 0xFD, 0xCB, 0x50, 0xBE, 0x25, 0x13, 0x88, 0x7F, 0xE4, 0xD2, 0x49,
+      0x95, 0x0E, 0x38, 0xA3, 0x54, 0xCF, 0xF9, 0x62, 0x8C, 0x17, 0x21, 0xBA, 0x4D, 0xD6, 0xE0, 0x7B
   };
 #endif
 
 /* CRC-8/DARC */
 #ifdef CRC_CRC8_DARC_LOOKUP_TABLE_METHOD
-  static const uint8_t crc_crc8DarcLookupTable[256] =
+  const uint8_t crc_inlineCrc8DarcLookupTable[256] =
   {
       0x00, 0x72, 0xE4, 0x96, 0xF1, 0x83, 0x15, 0x67, 0xDB, 0xA9, 0x3F, 0x4D, 0x2A, 0x58, 0xCE, 0xBC,
       0x8F, 0xFD, 0x6B, 0x19, 0x7E, 0x0C, 0x9A, 0xE8, 0x54, 0x26, 0xB0, 0xC2, 0xA5, 0xD7, 0x41, 0x33,
@@ -177,7 +472,7 @@
 
 /* CRC-8/DVB-S2 */
 #ifdef CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD
-  static const uint8_t crc_crc8DvbS2LookupTable[256] =
+  const uint8_t crc_inlineCrc8DvbS2LookupTable[256] =
   {
       0x00, 0xD5, 0x7F, 0xAA, 0xFE, 0x2B, 0x81, 0x54, 0x29, 0xFC, 0x56, 0x83, 0xD7, 0x02, 0xA8, 0x7D,
       0x52, 0x87, 0x2D, 0xF8, 0xAC, 0x79, 0xD3, 0x06, 0x7B, 0xAE, 0x04, 0xD1, 0x85, 0x50, 0xFA, 0x2F,
@@ -200,53 +495,53 @@
 
 /* CRC-8/EBU */
 #ifdef CRC_CRC8_EBU_LOOKUP_TABLE_METHOD
-  static const uint8_t crc_crc8EbuLookupTable[256] =
+  const uint8_t crc_inlineCrc8EbuLookupTable[256] =
   {
-      0x23, 0x47, 0xEB, 0x8F, 0xC2, 0xA6, 0x0A, 0x6E, 0x90, 0xF4, 0x58, 0x3C, 0x71, 0x15, 0xB9, 0xDD,
-      0x34, 0x50, 0xFC, 0x98, 0xD5, 0xB1, 0x1D, 0x79, 0x87, 0xE3, 0x4F, 0x2B, 0x66, 0x02, 0xAE, 0xCA,
-      0x0D, 0x69, 0xC5, 0xA1, 0xEC, 0x88, 0x24, 0x40, 0xBE, 0xDA, 0x76, 0x12, 0x5F, 0x3B, 0x97, 0xF3,
-      0x1A, 0x7E, 0xD2, 0xB6, 0xFB, 0x9F, 0x33, 0x57, 0xA9, 0xCD, 0x61, 0x05, 0x48, 0x2C, 0x80, 0xE4,
-      0x7F, 0x1B, 0xB7, 0xD3, 0x9E, 0xFA, 0x56, 0x32, 0xCC, 0xA8, 0x04, 0x60, 0x2D, 0x49, 0xE5, 0x81,
-      0x68, 0x0C, 0xA0, 0xC4, 0x89, 0xED, 0x41, 0x25, 0xDB, 0xBF, 0x13, 0x77, 0x3A, 0x5E, 0xF2, 0x96,
-      0x51, 0x35, 0x99, 0xFD, 0xB0, 0xD4, 0x78, 0x1C, 0xE2, 0x86, 0x2A, 0x4E, 0x03, 0x67, 0xCB, 0xAF,
-      0x46, 0x22, 0x8E, 0xEA, 0xA7, 0xC3, 0x6F, 0x0B, 0xF5, 0x91, 0x3D, 0x59, 0x14, 0x70, 0xDC, 0xB8,
-      0x9B, 0xFF, 0x53, 0x37, 0x7A, 0x1E, 0xB2, 0xD6, 0x28, 0x4C, 0xE0, 0x84, 0xC9, 0xAD, 0x01, 0x65,
-      0x8C, 0xE8, 0x44, 0x20, 0x6D, 0x09, 0xA5, 0xC1, 0x3F, 0x5B, 0xF7, 0x93, 0xDE, 0xBA, 0x16, 0x72,
-      0xB5, 0xD1, 0x7D, 0x19, 0x54, 0x30, 0x9C, 0xF8, 0x06, 0x62, 0xCE, 0xAA, 0xE7, 0x83, 0x2F, 0x4B,
-      0xA2, 0xC6, 0x6A, 0x0E, 0x43, 0x27, 0x8B, 0xEF, 0x11, 0x75, 0xD9, 0xBD, 0xF0, 0x94, 0x38, 0x5C,
-      0xC7, 0xA3, 0x0F, 0x6B, 0x26, 0x42, 0xEE, 0x8A, 0x74, 0x10, 0xBC, 0xD8, 0x95, 0xF1, 0x5D, 0x39,
-      0xD0, 0xB4, 0x18, 0x7C, 0x31, 0x55, 0xF9, 0x9D, 0x63, 0x07, 0xAB, 0xCF, 0x82, 0xE6, 0x4A, 0x2E,
-      0xE9, 0x8D, 0x21, 0x45, 0x08, 0x6C, 0xC0, 0xA4, 0x5A, 0x3E, 0x92, 0xF6, 0xBB, 0xDF, 0x73, 0x17,
-      0xFE, 0x9A, 0x36, 0x52, 0x1F, 0x7B, 0xD7, 0xB3, 0x4D, 0x29, 0x85, 0xE1, 0xAC, 0xC8, 0x64, 0x00
+      0x00, 0x64, 0xC8, 0xAC, 0xE1, 0x85, 0x29, 0x4D, 0xB3, 0xD7, 0x7B, 0x1F, 0x52, 0x36, 0x9A, 0xFE,
+      0x17, 0x73, 0xDF, 0xBB, 0xF6, 0x92, 0x3E, 0x5A, 0xA4, 0xC0, 0x6C, 0x08, 0x45, 0x21, 0x8D, 0xE9,
+      0x2E, 0x4A, 0xE6, 0x82, 0xCF, 0xAB, 0x07, 0x63, 0x9D, 0xF9, 0x55, 0x31, 0x7C, 0x18, 0xB4, 0xD0,
+      0x39, 0x5D, 0xF1, 0x95, 0xD8, 0xBC, 0x10, 0x74, 0x8A, 0xEE, 0x42, 0x26, 0x6B, 0x0F, 0xA3, 0xC7,
+      0x5C, 0x38, 0x94, 0xF0, 0xBD, 0xD9, 0x75, 0x11, 0xEF, 0x8B, 0x27, 0x43, 0x0E, 0x6A, 0xC6, 0xA2,
+      0x4B, 0x2F, 0x83, 0xE7, 0xAA, 0xCE, 0x62, 0x06, 0xF8, 0x9C, 0x30, 0x54, 0x19, 0x7D, 0xD1, 0xB5,
+      0x72, 0x16, 0xBA, 0xDE, 0x93, 0xF7, 0x5B, 0x3F, 0xC1, 0xA5, 0x09, 0x6D, 0x20, 0x44, 0xE8, 0x8C,
+      0x65, 0x01, 0xAD, 0xC9, 0x84, 0xE0, 0x4C, 0x28, 0xD6, 0xB2, 0x1E, 0x7A, 0x37, 0x53, 0xFF, 0x9B,
+      0xB8, 0xDC, 0x70, 0x14, 0x59, 0x3D, 0x91, 0xF5, 0x0B, 0x6F, 0xC3, 0xA7, 0xEA, 0x8E, 0x22, 0x46,
+      0xAF, 0xCB, 0x67, 0x03, 0x4E, 0x2A, 0x86, 0xE2, 0x1C, 0x78, 0xD4, 0xB0, 0xFD, 0x99, 0x35, 0x51,
+      0x96, 0xF2, 0x5E, 0x3A, 0x77, 0x13, 0xBF, 0xDB, 0x25, 0x41, 0xED, 0x89, 0xC4, 0xA0, 0x0C, 0x68,
+      0x81, 0xE5, 0x49, 0x2D, 0x60, 0x04, 0xA8, 0xCC, 0x32, 0x56, 0xFA, 0x9E, 0xD3, 0xB7, 0x1B, 0x7F,
+      0xE4, 0x80, 0x2C, 0x48, 0x05, 0x61, 0xCD, 0xA9, 0x57, 0x33, 0x9F, 0xFB, 0xB6, 0xD2, 0x7E, 0x1A,
+      0xF3, 0x97, 0x3B, 0x5F, 0x12, 0x76, 0xDA, 0xBE, 0x40, 0x24, 0x88, 0xEC, 0xA1, 0xC5, 0x69, 0x0D,
+      0xCA, 0xAE, 0x02, 0x66, 0x2B, 0x4F, 0xE3, 0x87, 0x79, 0x1D, 0xB1, 0xD5, 0x98, 0xFC, 0x50, 0x34,
+      0xDD, 0xB9, 0x15, 0x71, 0x3C, 0x58, 0xF4, 0x90, 0x6E, 0x0A, 0xA6, 0xC2, 0x8F, 0xEB, 0x47, 0x23
   };
 #endif
 
 /* CRC-8/I-CODE */
 #ifdef CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD
-  static const uint8_t crc_crc8ICodeLookupTable[256] =
+  const uint8_t crc_inlineCrc8ICodeLookupTable[256] =
   {
-      0xFE, 0xE3, 0xC4, 0xD9, 0x8A, 0x97, 0xB0, 0xAD, 0x16, 0x0B, 0x2C, 0x31, 0x62, 0x7F, 0x58, 0x45,
-      0x33, 0x2E, 0x09, 0x14, 0x47, 0x5A, 0x7D, 0x60, 0xDB, 0xC6, 0xE1, 0xFC, 0xAF, 0xB2, 0x95, 0x88,
-      0x79, 0x64, 0x43, 0x5E, 0x0D, 0x10, 0x37, 0x2A, 0x91, 0x8C, 0xAB, 0xB6, 0xE5, 0xF8, 0xDF, 0xC2,
-      0xB4, 0xA9, 0x8E, 0x93, 0xC0, 0xDD, 0xFA, 0xE7, 0x5C, 0x41, 0x66, 0x7B, 0x28, 0x35, 0x12, 0x0F,
-      0xED, 0xF0, 0xD7, 0xCA, 0x99, 0x84, 0xA3, 0xBE, 0x05, 0x18, 0x3F, 0x22, 0x71, 0x6C, 0x4B, 0x56,
-      0x20, 0x3D, 0x1A, 0x07, 0x54, 0x49, 0x6E, 0x73, 0xC8, 0xD5, 0xF2, 0xEF, 0xBC, 0xA1, 0x86, 0x9B,
-      0x6A, 0x77, 0x50, 0x4D, 0x1E, 0x03, 0x24, 0x39, 0x82, 0x9F, 0xB8, 0xA5, 0xF6, 0xEB, 0xCC, 0xD1,
-      0xA7, 0xBA, 0x9D, 0x80, 0xD3, 0xCE, 0xE9, 0xF4, 0x4F, 0x52, 0x75, 0x68, 0x3B, 0x26, 0x01, 0x1C,
-      0xD8, 0xC5, 0xE2, 0xFF, 0xAC, 0xB1, 0x96, 0x8B, 0x30, 0x2D, 0x0A, 0x17, 0x44, 0x59, 0x7E, 0x63,
-      0x15, 0x08, 0x2F, 0x32, 0x61, 0x7C, 0x5B, 0x46, 0xFD, 0xE0, 0xC7, 0xDA, 0x89, 0x94, 0xB3, 0xAE,
-      0x5F, 0x42, 0x65, 0x78, 0x2B, 0x36, 0x11, 0x0C, 0xB7, 0xAA, 0x8D, 0x90, 0xC3, 0xDE, 0xF9, 0xE4,
-      0x92, 0x8F, 0xA8, 0xB5, 0xE6, 0xFB, 0xDC, 0xC1, 0x7A, 0x67, 0x40, 0x5D, 0x0E, 0x13, 0x34, 0x29,
-      0xCB, 0xD6, 0xF1, 0xEC, 0xBF, 0xA2, 0x85, 0x98, 0x23, 0x3E, 0x19, 0x04, 0x57, 0x4A, 0x6D, 0x70,
-      0x06, 0x1B, 0x3C, 0x21, 0x72, 0x6F, 0x48, 0x55, 0xEE, 0xF3, 0xD4, 0xC9, 0x9A, 0x87, 0xA0, 0xBD,
-      0x4C, 0x51, 0x76, 0x6B, 0x38, 0x25, 0x02, 0x1F, 0xA4, 0xB9, 0x9E, 0x83, 0xD0, 0xCD, 0xEA, 0xF7,
-      0x81, 0x9C, 0xBB, 0xA6, 0xF5, 0xE8, 0xCF, 0xD2, 0x69, 0x74, 0x53, 0x4E, 0x1D, 0x00, 0x27, 0x3A
+      0x00, 0x1D, 0x3A, 0x27, 0x74, 0x69, 0x4E, 0x53, 0xE8, 0xF5, 0xD2, 0xCF, 0x9C, 0x81, 0xA6, 0xBB,
+      0xCD, 0xD0, 0xF7, 0xEA, 0xB9, 0xA4, 0x83, 0x9E, 0x25, 0x38, 0x1F, 0x02, 0x51, 0x4C, 0x6B, 0x76,
+      0x87, 0x9A, 0xBD, 0xA0, 0xF3, 0xEE, 0xC9, 0xD4, 0x6F, 0x72, 0x55, 0x48, 0x1B, 0x06, 0x21, 0x3C,
+      0x4A, 0x57, 0x70, 0x6D, 0x3E, 0x23, 0x04, 0x19, 0xA2, 0xBF, 0x98, 0x85, 0xD6, 0xCB, 0xEC, 0xF1,
+      0x13, 0x0E, 0x29, 0x34, 0x67, 0x7A, 0x5D, 0x40, 0xFB, 0xE6, 0xC1, 0xDC, 0x8F, 0x92, 0xB5, 0xA8,
+      0xDE, 0xC3, 0xE4, 0xF9, 0xAA, 0xB7, 0x90, 0x8D, 0x36, 0x2B, 0x0C, 0x11, 0x42, 0x5F, 0x78, 0x65,
+      0x94, 0x89, 0xAE, 0xB3, 0xE0, 0xFD, 0xDA, 0xC7, 0x7C, 0x61, 0x46, 0x5B, 0x08, 0x15, 0x32, 0x2F,
+      0x59, 0x44, 0x63, 0x7E, 0x2D, 0x30, 0x17, 0x0A, 0xB1, 0xAC, 0x8B, 0x96, 0xC5, 0xD8, 0xFF, 0xE2,
+      0x26, 0x3B, 0x1C, 0x01, 0x52, 0x4F, 0x68, 0x75, 0xCE, 0xD3, 0xF4, 0xE9, 0xBA, 0xA7, 0x80, 0x9D,
+      0xEB, 0xF6, 0xD1, 0xCC, 0x9F, 0x82, 0xA5, 0xB8, 0x03, 0x1E, 0x39, 0x24, 0x77, 0x6A, 0x4D, 0x50,
+      0xA1, 0xBC, 0x9B, 0x86, 0xD5, 0xC8, 0xEF, 0xF2, 0x49, 0x54, 0x73, 0x6E, 0x3D, 0x20, 0x07, 0x1A,
+      0x6C, 0x71, 0x56, 0x4B, 0x18, 0x05, 0x22, 0x3F, 0x84, 0x99, 0xBE, 0xA3, 0xF0, 0xED, 0xCA, 0xD7,
+      0x35, 0x28, 0x0F, 0x12, 0x41, 0x5C, 0x7B, 0x66, 0xDD, 0xC0, 0xE7, 0xFA, 0xA9, 0xB4, 0x93, 0x8E,
+      0xF8, 0xE5, 0xC2, 0xDF, 0x8C, 0x91, 0xB6, 0xAB, 0x10, 0x0D, 0x2A, 0x37, 0x64, 0x79, 0x5E, 0x43,
+      0xB2, 0xAF, 0x88, 0x95, 0xC6, 0xDB, 0xFC, 0xE1, 0x5A, 0x47, 0x60, 0x7D, 0x2E, 0x33, 0x14, 0x09,
+      0x7F, 0x62, 0x45, 0x58, 0x0B, 0x16, 0x31, 0x2C, 0x97, 0x8A, 0xAD, 0xB0, 0xE3, 0xFE, 0xD9, 0xC4
   };
 #endif
 
 /* CRC-8/ITU */
 #ifdef CRC_CRC8_ITU_LOOKUP_TABLE_METHOD
-  static const uint8_t crc_crc8ItuLookupTable[256] =
+  const uint8_t crc_inlineCrc8ItuLookupTable[256] =
   {
       0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15, 0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D,
       0x70, 0x77, 0x7E, 0x79, 0x6C, 0x6B, 0x62, 0x65, 0x48, 0x4F, 0x46, 0x41, 0x54, 0x53, 0x5A, 0x5D,
@@ -269,7 +564,7 @@
 
 /* CRC-8/MAXIM */
 #ifdef CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD
-  static const uint8_t crc_crc8MaximLookupTable[256] =
+  const uint8_t crc_inlineCrc8MaximLookupTable[256] =
   {
       0x00, 0x5E, 0xBC, 0xE2, 0x61, 0x3F, 0xDD, 0x83, 0xC2, 0x9C, 0x7E, 0x20, 0xA3, 0xFD, 0x1F, 0x41,
       0x9D, 0xC3, 0x21, 0x7F, 0xFC, 0xA2, 0x40, 0x1E, 0x5F, 0x01, 0xE3, 0xBD, 0x3E, 0x60, 0x82, 0xDC,
@@ -292,30 +587,30 @@
 
 /* CRC-8/ROHC */
 #ifdef CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD
-  static const uint8_t crc_crc8RohcLookupTable[256] =
+  const uint8_t crc_inlineCrc8RohcLookupTable[256] =
   {
-      0xCF, 0x5E, 0x2C, 0xBD, 0xC8, 0x59, 0x2B, 0xBA, 0xC1, 0x50, 0x22, 0xB3, 0xC6, 0x57, 0x25, 0xB4,
-      0xD3, 0x42, 0x30, 0xA1, 0xD4, 0x45, 0x37, 0xA6, 0xDD, 0x4C, 0x3E, 0xAF, 0xDA, 0x4B, 0x39, 0xA8,
-      0xF7, 0x66, 0x14, 0x85, 0xF0, 0x61, 0x13, 0x82, 0xF9, 0x68, 0x1A, 0x8B, 0xFE, 0x6F, 0x1D, 0x8C,
-      0xEB, 0x7A, 0x08, 0x99, 0xEC, 0x7D, 0x0F, 0x9E, 0xE5, 0x74, 0x06, 0x97, 0xE2, 0x73, 0x01, 0x90,
-      0xBF, 0x2E, 0x5C, 0xCD, 0xB8, 0x29, 0x5B, 0xCA, 0xB1, 0x20, 0x52, 0xC3, 0xB6, 0x27, 0x55, 0xC4,
-      0xA3, 0x32, 0x40, 0xD1, 0xA4, 0x35, 0x47, 0xD6, 0xAD, 0x3C, 0x4E, 0xDF, 0xAA, 0x3B, 0x49, 0xD8,
-      0x87, 0x16, 0x64, 0xF5, 0x80, 0x11, 0x63, 0xF2, 0x89, 0x18, 0x6A, 0xFB, 0x8E, 0x1F, 0x6D, 0xFC,
-      0x9B, 0x0A, 0x78, 0xE9, 0x9C, 0x0D, 0x7F, 0xEE, 0x95, 0x04, 0x76, 0xE7, 0x92, 0x03, 0x71, 0xE0,
-      0x2F, 0xBE, 0xCC, 0x5D, 0x28, 0xB9, 0xCB, 0x5A, 0x21, 0xB0, 0xC2, 0x53, 0x26, 0xB7, 0xC5, 0x54,
-      0x33, 0xA2, 0xD0, 0x41, 0x34, 0xA5, 0xD7, 0x46, 0x3D, 0xAC, 0xDE, 0x4F, 0x3A, 0xAB, 0xD9, 0x48,
-      0x17, 0x86, 0xF4, 0x65, 0x10, 0x81, 0xF3, 0x62, 0x19, 0x88, 0xFA, 0x6B, 0x1E, 0x8F, 0xFD, 0x6C,
-      0x0B, 0x9A, 0xE8, 0x79, 0x0C, 0x9D, 0xEF, 0x7E, 0x05, 0x94, 0xE6, 0x77, 0x02, 0x93, 0xE1, 0x70,
-      0x5F, 0xCE, 0xBC, 0x2D, 0x58, 0xC9, 0xBB, 0x2A, 0x51, 0xC0, 0xB2, 0x23, 0x56, 0xC7, 0xB5, 0x24,
-      0x43, 0xD2, 0xA0, 0x31, 0x44, 0xD5, 0xA7, 0x36, 0x4D, 0xDC, 0xAE, 0x3F, 0x4A, 0xDB, 0xA9, 0x38,
-      0x67, 0xF6, 0x84, 0x15, 0x60, 0xF1, 0x83, 0x12, 0x69, 0xF8, 0x8A, 0x1B, 0x6E, 0xFF, 0x8D, 0x1C,
-      0x7B, 0xEA, 0x98, 0x09, 0x7C, 0xED, 0x9F, 0x0E, 0x75, 0xE4, 0x96, 0x07, 0x72, 0xE3, 0x91, 0x00
+      0x00, 0x91, 0xE3, 0x72, 0x07, 0x96, 0xE4, 0x75, 0x0E, 0x9F, 0xED, 0x7C, 0x09, 0x98, 0xEA, 0x7B,
+      0x1C, 0x8D, 0xFF, 0x6E, 0x1B, 0x8A, 0xF8, 0x69, 0x12, 0x83, 0xF1, 0x60, 0x15, 0x84, 0xF6, 0x67,
+      0x38, 0xA9, 0xDB, 0x4A, 0x3F, 0xAE, 0xDC, 0x4D, 0x36, 0xA7, 0xD5, 0x44, 0x31, 0xA0, 0xD2, 0x43,
+      0x24, 0xB5, 0xC7, 0x56, 0x23, 0xB2, 0xC0, 0x51, 0x2A, 0xBB, 0xC9, 0x58, 0x2D, 0xBC, 0xCE, 0x5F,
+      0x70, 0xE1, 0x93, 0x02, 0x77, 0xE6, 0x94, 0x05, 0x7E, 0xEF, 0x9D, 0x0C, 0x79, 0xE8, 0x9A, 0x0B,
+      0x6C, 0xFD, 0x8F, 0x1E, 0x6B, 0xFA, 0x88, 0x19, 0x62, 0xF3, 0x81, 0x10, 0x65, 0xF4, 0x86, 0x17,
+      0x48, 0xD9, 0xAB, 0x3A, 0x4F, 0xDE, 0xAC, 0x3D, 0x46, 0xD7, 0xA5, 0x34, 0x41, 0xD0, 0xA2, 0x33,
+      0x54, 0xC5, 0xB7, 0x26, 0x53, 0xC2, 0xB0, 0x21, 0x5A, 0xCB, 0xB9, 0x28, 0x5D, 0xCC, 0xBE, 0x2F,
+      0xE0, 0x71, 0x03, 0x92, 0xE7, 0x76, 0x04, 0x95, 0xEE, 0x7F, 0x0D, 0x9C, 0xE9, 0x78, 0x0A, 0x9B,
+      0xFC, 0x6D, 0x1F, 0x8E, 0xFB, 0x6A, 0x18, 0x89, 0xF2, 0x63, 0x11, 0x80, 0xF5, 0x64, 0x16, 0x87,
+      0xD8, 0x49, 0x3B, 0xAA, 0xDF, 0x4E, 0x3C, 0xAD, 0xD6, 0x47, 0x35, 0xA4, 0xD1, 0x40, 0x32, 0xA3,
+      0xC4, 0x55, 0x27, 0xB6, 0xC3, 0x52, 0x20, 0xB1, 0xCA, 0x5B, 0x29, 0xB8, 0xCD, 0x5C, 0x2E, 0xBF,
+      0x90, 0x01, 0x73, 0xE2, 0x97, 0x06, 0x74, 0xE5, 0x9E, 0x0F, 0x7D, 0xEC, 0x99, 0x08, 0x7A, 0xEB,
+      0x8C, 0x1D, 0x6F, 0xFE, 0x8B, 0x1A, 0x68, 0xF9, 0x82, 0x13, 0x61, 0xF0, 0x85, 0x14, 0x66, 0xF7,
+      0xA8, 0x39, 0x4B, 0xDA, 0xAF, 0x3E, 0x4C, 0xDD, 0xA6, 0x37, 0x45, 0xD4, 0xA1, 0x30, 0x42, 0xD3,
+      0xB4, 0x25, 0x57, 0xC6, 0xB3, 0x22, 0x50, 0xC1, 0xBA, 0x2B, 0x59, 0xC8, 0xBD, 0x2C, 0x5E, 0xCF
   };
 #endif
 
 /* CRC-8/WCDMA */
 #ifdef CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD
-  static const uint8_t crc_crc8WcdmaLookupTable[256] =
+  const uint8_t crc_inlineCrc8WcdmaLookupTable[256] =
   {
       0x00, 0xD0, 0x13, 0xC3, 0x26, 0xF6, 0x35, 0xE5, 0x4C, 0x9C, 0x5F, 0x8F, 0x6A, 0xBA, 0x79, 0xA9,
       0x98, 0x48, 0x8B, 0x5B, 0xBE, 0x6E, 0xAD, 0x7D, 0xD4, 0x04, 0xC7, 0x17, 0xF2, 0x22, 0xE1, 0x31,
@@ -339,7 +634,7 @@
 /*** CRC-16 ***/
 /* CRC-16/ARC */
 #ifdef CRC_CRC16_ARC_LOOKUP_TABLE_METHOD
-  static const uint16_t crc_crc16ArcLookupTable[256] =
+  const uint16_t crc_inlineCrc16ArcLookupTable[256] =
   {
       0x0000, 0xC0C1, 0xC181, 0x0140, 0xC301, 0x03C0, 0x0280, 0xC241, 0xC601, 0x06C0, 0x0780, 0xC741, 0x0500, 0xC5C1, 0xC481, 0x0440,
       0xCC01, 0x0CC0, 0x0D80, 0xCD41, 0x0F00, 0xCFC1, 0xCE81, 0x0E40, 0x0A00, 0xCAC1, 0xCB81, 0x0B40, 0xC901, 0x09C0, 0x0880, 0xC841,
@@ -362,24 +657,277 @@
 
 /* CRC-16/CCITT-FALSE */
 #ifdef CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD
-  static const uint16_t crc_crc16CcittFalseLookupTable[256] =
+  const uint16_t crc_inlineCrc16CcittFalseLookupTable[256] =
+  {
+      0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7, 0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+      0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6, 0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE,
+      0x2462, 0x3443, 0x0420, 0x1401, 0x64E6, 0x74C7, 0x44A4, 0x5485, 0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
+      0x3653, 0x2672, 0x1611, 0x0630, 0x76D7, 0x66F6, 0x5695, 0x46B4, 0xB75B, 0xA77A, 0x9719, 0x8738, 0xF7DF, 0xE7FE, 0xD79D, 0xC7BC,
+      0x48C4, 0x58E5, 0x6886, 0x78A7, 0x0840, 0x1861, 0x2802, 0x3823, 0xC9CC, 0xD9ED, 0xE98E, 0xF9AF, 0x8948, 0x9969, 0xA90A, 0xB92B,
+      0x5AF5, 0x4AD4, 0x7AB7, 0x6A96, 0x1A71, 0x0A50, 0x3A33, 0x2A12, 0xDBFD, 0xCBDC, 0xFBBF, 0xEB9E, 0x9B79, 0x8B58, 0xBB3B, 0xAB1A,
+      0x6CA6, 0x7C87, 0x4CE4, 0x5CC5, 0x2C22, 0x3C03, 0x0C60, 0x1C41, 0xEDAE, 0xFD8F, 0xCDEC, 0xDDCD, 0xAD2A, 0xBD0B, 0x8D68, 0x9D49,
+      0x7E97, 0x6EB6, 0x5ED5, 0x4EF4, 0x3E13, 0x2E32, 0x1E51, 0x0E70, 0xFF9F, 0xEFBE, 0xDFDD, 0xCFFC, 0xBF1B, 0xAF3A, 0x9F59, 0x8F78,
+      0x9188, 0x81A9, 0xB1CA, 0xA1EB, 0xD10C, 0xC12D, 0xF14E, 0xE16F, 0x1080, 0x00A1, 0x30C2, 0x20E3, 0x5004, 0x4025, 0x7046, 0x6067,
+      0x83B9, 0x9398, 0xA3FB, 0xB3DA, 0xC33D, 0xD31C, 0xE37F, 0xF35E, 0x02B1, 0x1290, 0x22F3, 0x32D2, 0x4235, 0x5214, 0x6277, 0x7256,
+      0xB5EA, 0xA5CB, 0x95A8, 0x8589, 0xF56E, 0xE54F, 0xD52C, 0xC50D, 0x34E2, 0x24C3, 0x14A0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+      0xA7DB, 0xB7FA, 0x8799, 0x97B8, 0xE75F, 0xF77E, 0xC71D, 0xD73C, 0x26D3, 0x36F2, 0x0691, 0x16B0, 0x6657, 0x7676, 0x4615, 0x5634,
+      0xD94C, 0xC96D, 0xF90E, 0xE92F, 0x99C8, 0x89E9, 0xB98A, 0xA9AB, 0x5844, 0x4865, 0x7806, 0x6827, 0x18C0, 0x08E1, 0x3882, 0x28A3,
+      0xCB7D, 0xDB5C, 0xEB3F, 0xFB1E, 0x8BF9, 0x9BD8, 0xABBB, 0xBB9A, 0x4A75, 0x5A54, 0x6A37, 0x7A16, 0x0AF1, 0x1AD0, 0x2AB3, 0x3A92,
+      0xFD2E, 0xED0F, 0xDD6C, 0xCD4D, 0xBDAA, 0xAD8B, 0x9DE8, 0x8DC9, 0x7C26, 0x6C07, 0x5C64, 0x4C45, 0x3CA2, 0x2C83, 0x1CE0, 0x0CC1,
+      0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8, 0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0
+  };
+#endif
+
+/*** Parameters ***/
+/* CRC-8 */
+#if defined(CRC_CRC8_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_LOOP_METHOD)
+  static const crc_parameters_t crc_crc8Parameters =
+  {
+      .width = 8,
+      .polynomial = CRC_INLINE_CRC8_POLYNOMIAL,
+      .initial = CRC_CRC8_INITIAL_CRC8,
+      .reflect = false,
+      .xorOut = 0x00,
+      .reflectedState = false
+  };
+#endif
+
+/* CRC-8/CDMA2000 */
+#if defined(CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_CDMA2000_LOOP_METHOD)
+  static const crc_parameters_t crc_crc8Cdma2000Parameters =
+  {
+      .width = 8,
+      .polynomial = CRC_INLINE_CRC8_CDMA2000_POLYNOMIAL,
+      .initial = CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000,
+      .reflect = false,
+      .xorOut = 0x00,
+      .reflectedState = false
+  };
+#endif
+
+/* CRC-8/DARC */
+#if defined(CRC_CRC8_DARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DARC_LOOP_METHOD)
+  static const crc_parameters_t crc_crc8DarcParameters =
+  {
+      .width = 8,
+      .polynomial = CRC_INLINE_CRC8_DARC_POLYNOMIAL,
+      .initial = CRC_CRC8_DARC_INITIAL_CRC8_DARC,
+      .reflect = true,
+      .xorOut = 0x00,
+      .reflectedState = CRC_CRC8_DARC_REFLECTED_STATE
+  };
+#endif
+
+/* CRC-8/DVB-S2 */
+#if defined(CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DVB_S2_LOOP_METHOD)
+  static const crc_parameters_t crc_crc8DvbS2Parameters =
+  {
+      .width = 8,
+      .polynomial = CRC_INLINE_CRC8_DVB_S2_POLYNOMIAL,
+      .initial = CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2,
+      .reflect = false,
+      .xorOut = 0x00,
+      .reflectedState = false
+  };
+#endif
+
+/* CRC-8/EBU */
+#if defined(CRC_CRC8_EBU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_EBU_LOOP_METHOD)
+  static const crc_parameters_t crc_crc8EbuParameters =
+  {
+      .width = 8,
+      .polynomial = CRC_INLINE_CRC8_EBU_POLYNOMIAL,
+      .initial = CRC_CRC8_EBU_INITIAL_CRC8_EBU,
+      .reflect = true,
+      .xorOut = 0x00,
+      .reflectedState = CRC_CRC8_EBU_REFLECTED_STATE
+  };
+#endif
+
+/* CRC-8/I-CODE */
+#if defined(CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_I_CODE_LOOP_METHOD)
+  static const crc_parameters_t crc_crc8ICodeParameters =
+  {
+      .width = 8,
+      .polynomial = CRC_INLINE_CRC8_I_CODE_POLYNOMIAL,
+      .initial = CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE,
+      .reflect = false,
+      .xorOut = 0x00,
+      .reflectedState = false
+  };
+#endif
+
+/* CRC-8/ITU */
+#if defined(CRC_CRC8_ITU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ITU_LOOP_METHOD)
+  static const crc_parameters_t crc_crc8ItuParameters =
+  {
+      .width = 8,
+      .polynomial = CRC_INLINE_CRC8_ITU_POLYNOMIAL,
+      .initial = CRC_CRC8_ITU_INITIAL_CRC8_ITU,
+      .reflect = false,
+      .xorOut = CRC_INLINE_CRC8_ITU_XOR_OUT,
+      .reflectedState = false
+  };
+#endif
+
+/* CRC-8/MAXIM */
+#if defined(CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_MAXIM_LOOP_METHOD)
+  static const crc_parameters_t crc_crc8MaximParameters =
+  {
+      .width = 8,
+      .polynomial = CRC_INLINE_CRC8_MAXIM_POLYNOMIAL,
+      .initial = CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM,
+      .reflect = true,
+      .xorOut = 0x00,
+      .reflectedState = CRC_CRC8_MAXIM_REFLECTED_STATE
+  };
+#endif
+
+/* CRC-8/ROHC */
+#if defined(CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ROHC_LOOP_METHOD)
+  static const crc_parameters_t crc_crc8RohcParameters =
+  {
+      .width = 8,
+      .polynomial = CRC_INLINE_CRC8_ROHC_POLYNOMIAL,
+      .initial = CRC_CRC8_ROHC_INITIAL_CRC8_ROHC,
+      .reflect = true,
+      .xorOut = 0x00,
+      .reflectedState = CRC_CRC8_ROHC_REFLECTED_STATE
+  };
+#endif
+
+/* CRC-8/WCDMA */
+#if defined(CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_WCDMA_LOOP_METHOD)
+  static const crc_parameters_t crc_crc8WcdmaParameters =
+  {
+      .width = 8,
+      .polynomial = CRC_INLINE_CRC8_WCDMA_POLYNOMIAL,
+      .initial = CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA,
+      .reflect = true,
+      .xorOut = 0x00,
+      .reflectedState = CRC_CRC8_WCDMA_REFLECTED_STATE
+  };
+#endif
+
+/* CRC-16/ARC */
+#if defined(CRC_CRC16_ARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_ARC_LOOP_METHOD)
+  static const crc_parameters_t crc_crc16ArcParameters =
+  {
+      .width = 16,
+      .polynomial = CRC_INLINE_CRC16_ARC_POLYNOMIAL,
+      .initial = CRC_CRC16_ARC_INITIAL_CRC16_ARC,
+      .reflect = true,
+      .xorOut = 0x0000,
+      .reflectedState = CRC_CRC16_ARC_REFLECTED_STATE
+  };
+#endif
+
+/* CRC-16/CCITT-FALSE */
+#if defined(CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_CCITT_FALSE_LOOP_METHOD)
+  static const crc_parameters_t crc_crc16CcittFalseParameters =
   {
-      0xE1F0, 0xF1D1, 0xC1B2, 0xD193, 0xA174, 0xB155, 0x8136, 0x9117, 0x60F8, 0x70D9, 0x40BA, 0x509B, 0x207C, 0x305D, 0x003E, 0x101F,
-      0xF3C1, 0xE3E0, 0xD383, 0xC3A2, 0xB345, 0xA364, 0x9307, 0x8326, 0x72C9, 0x62E8, 0x528B, 0x42AA, 0x324D, 0x226C, 0x120F, 0x022E,
-      0xC592, 0xD5B3, 0xE5D0, 0xF5F1, 0x8516, 0x9537, 0xA554, 0xB575, 0x449A, 0x54BB, 0x64D8, 0x74F9, 0x041E, 0x143F, 0x245C, 0x347D,
-      0xD7A3, 0xC782, 0xF7E1, 0xE7C0, 0x9727, 0x8706, 0xB765, 0xA744, 0x56AB, 0x468A, 0x76E9, 0x66C8, 0x162F, 0x060E, 0x366D, 0x264C,
-      0xA934, 0xB915, 0x8976, 0x9957, 0xE9B0, 0xF991, 0xC9F2, 0xD9D3, 0x283C, 0x381D, 0x087E, 0x185F, 0x68B8, 0x7899, 0x48FA, 0x58DB,
-      0xBB05, 0xAB24, 0x9B47, 0x8B66, 0xFB81, 0xEBA0, 0xDBC3, 0xCBE2, 0x3A0D, 0x2A2C, 0x1A4F, 0x0A6E, 0x7A89, 0x6AA8, 0x5ACB, 0x4AEA,
-      0x8D56, 0x9D77, 0xAD14, 0xBD35, 0xCDD2, 0xDDF3, 0xED90, 0xFDB1, 0x0C5E, 0x1C7F, 0x2C1C, 0x3C3D, 0x4CDA, 0x5CFB, 0x6C98, 0x7CB9,
-      0x9F67, 0x8F46, 0xBF25, 0xAF04, 0xDFE3, 0xCFC2, 0xFFA1, 0xEF80, 0x1E6F, 0x0E4E, 0x3E2D, 0x2E0C, 0x5EEB, 0x4ECA, 0x7EA9, 0x6E88,
-      0x7078, 0x6059, 0x503A, 0x401B, 0x30FC, 0x20DD, 0x10BE, 0x009F, 0xF170, 0xE151, 0xD132, 0xC113, 0xB1F4, 0xA1D5, 0x91B6, 0x8197,
-      0x6249, 0x7268, 0x420B, 0x522A, 0x22CD, 0x32EC, 0x028F, 0x12AE, 0xE341, 0xF360, 0xC303, 0xD322, 0xA3C5, 0xB3E4, 0x8387, 0x93A6,
-      0x541A, 0x443B, 0x7458, 0x6479, 0x149E, 0x04BF, 0x34DC, 0x24FD, 0xD512, 0xC533, 0xF550, 0xE571, 0x9596, 0x85B7, 0xB5D4, 0xA5F5,
-      0x462B, 0x560A, 0x6669, 0x7648, 0x06AF, 0x168E, 0x26ED, 0x36CC, 0xC723, 0xD702, 0xE761, 0xF740, 0x87A7, 0x9786, 0xA7E5, 0xB7C4,
-      0x38BC, 0x289D, 0x18FE, 0x08DF, 0x7838, 0x6819, 0x587A, 0x485B, 0xB9B4, 0xA995, 0x99F6, 0x89D7, 0xF930, 0xE911, 0xD972, 0xC953,
-      0x2A8D, 0x3AAC, 0x0ACF, 0x1AEE, 0x6A09, 0x7A28, 0x4A4B, 0x5A6A, 0xAB85, 0xBBA4, 0x8BC7, 0x9BE6, 0xEB01, 0xFB20, 0xCB43, 0xDB62,
-      0x1CDE, 0x0CFF, 0x3C9C, 0x2CBD, 0x5C5A, 0x4C7B, 0x7C18, 0x6C39, 0x9DD6, 0x8DF7, 0xBD94, 0xADB5, 0xDD52, 0xCD73, 0xFD10, 0xED31,
-      0x0EEF, 0x1ECE, 0x2EAD, 0x3E8C, 0x4E6B, 0x5E4A, 0x6E29, 0x7E08, 0x8FE7, 0x9FC6, 0xAFA5, 0xBF84, 0xCF63, 0xDF42, 0xEF21, 0xFF00
+      .width = 16,
+      .polynomial = CRC_INLINE_CRC16_CCITT_FALSE_POLYNOMIAL,
+      .initial = CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE,
+      .reflect = false,
+      .xorOut = 0x0000,
+      .reflectedState = false
+  };
+#endif
+
+/*** Reverse ***/
+#ifdef CRC_REVERSE
+  static const crc_model_t crc_reversePresetModel[CRC_VARIANT_COUNT] =
+  {
+      {CRC_VARIANT_CRC8, 0x07, 0x00, 0x00, 8, false, false, {0}},
+      {CRC_VARIANT_CRC8_CDMA2000, 0x9B, 0xFF, 0x00, 8, false, false, {0}},
+      {CRC_VARIANT_CRC8_DARC, 0x39, 0x00, 0x00, 8, true, true, {0}},
+      {CRC_VARIANT_CRC8_DVB_S2, 0xD5, 0x00, 0x00, 8, false, false, {0}},
+      {CRC_VARIANT_CRC8_EBU, 0x1D, 0xFF, 0x00, 8, true, true, {0}},
+      {CRC_VARIANT_CRC8_I_CODE, 0x1D, 0xFD, 0x00, 8, false, false, {0}},
+      {CRC_VARIANT_CRC8_ITU, 0x07, 0x00, 0x55, 8, false, false, {0}},
+      {CRC_VARIANT_CRC8_MAXIM, 0x31, 0x00, 0x00, 8, true, true, {0}},
+      {CRC_VARIANT_CRC8_ROHC, 0x07, 0xFF, 0x00, 8, true, true, {0}},
+      {CRC_VARIANT_CRC8_WCDMA, 0x9B, 0x00, 0x00, 8, true, true, {0}},
+      {CRC_VARIANT_CRC16_ARC, 0x8005, 0x0000, 0x0000, 16, true, true, {0}},
+      {CRC_VARIANT_CRC16_CCITT_FALSE, 0x1021, 0xFFFF, 0x0000, 16, false, false, {0}}
+  };
+#endif
+
+/*** Variant ***/
+static const char * const crc_variantNameList[CRC_VARIANT_COUNT] =
+{
+    "CRC-8",
+    "CRC-8/CDMA2000",
+    "CRC-8/DARC",
+    "CRC-8/DVB-S2",
+    "CRC-8/EBU",
+    "CRC-8/I-CODE",
+    "CRC-8/ITU",
+    "CRC-8/MAXIM",
+    "CRC-8/ROHC",
+    "CRC-8/WCDMA",
+    "CRC-16/ARC",
+    "CRC-16/CCITT-FALSE"
+};
+
+/*** Metrics ***/
+#ifdef CRC_METRICS
+  static CRC_THREAD_LOCAL crc_metrics_thread_t *crc_metricsThread;       // This Thread's Counters
+  static crc_metrics_thread_t *crc_metricsThreadList;                  // Registered (Live) Threads
+  static crc_metrics_t crc_metricsRetired[CRC_VARIANT_COUNT];          // Totals Of Exited Threads
+  static pthread_mutex_t crc_metricsMutex = PTHREAD_MUTEX_INITIALIZER; // Guards Thread List And Retired Totals
+  static pthread_once_t crc_metricsOnce = PTHREAD_ONCE_INIT;           // Thread Exit Key Creation
+  static pthread_key_t crc_metricsKey;                                 // Thread Exit Key (Retires Counters)
+#endif
+
+/*** JIT ***/
+#ifdef CRC_JIT
+  static crc_jit_entry_t crc_jitCache[CRC_JIT_CACHE_COUNT];        // Built Tables And Kernels
+  static CRC_ATOMIC uint8_t crc_jitCacheCount;                        // Published Entries (Append Only)
+  static pthread_mutex_t crc_jitMutex = PTHREAD_MUTEX_INITIALIZER; // Serializes Building Entries
+#endif
+
+/*** Table ***/
+#ifdef CRC_TABLE
+  static crc_table_t *crc_tableBucket[CRC_TABLE_BUCKET_COUNT];      // Resident Tables By Key Hash
+  static crc_table_t *crc_tableIdleFirst;                           // Most Recently Released Idle Built Table
+  static crc_table_t *crc_tableIdleLast;                            // Least Recently Released Idle Built Table (Evicted First)
+  static crc_table_statistics_t crc_tableStatisticsTotal;           // Counters And Resident Totals
+  static size_t crc_tableBudgetBytes = CRC_TABLE_BUDGET;            // Eviction Budget
+  static const crc_table_record_t *crc_tableBlob;                   // Mapped Blob Records (NULL: None)
+  static uint32_t crc_tableBlobCount;                               // Mapped Blob Record Count
+  static pthread_mutex_t crc_tableMutex = PTHREAD_MUTEX_INITIALIZER; // Guards All Of The Above
+#endif
+
+/*** Registry ***/
+#ifdef CRC_REGISTRY
+  static const crc_registry_slot_t crc_registrySlot[CRC_REGISTRY_SLOT_COUNT] =
+  {
+      [0]  = {"CRC-8/EBU", CRC_VARIANT_CRC8_EBU, 0},
+      [1]  = {"CRC-8/I-432-1", CRC_VARIANT_CRC8_ITU, 0},
+      [6]  = {"CRC-8", CRC_VARIANT_CRC8, 0},
+      [7]  = {"CRC-16/IBM-3740", CRC_VARIANT_CRC16_CCITT_FALSE, 0},
+      [10] = {"CRC-8/TECH-3250", CRC_VARIANT_CRC8_EBU, 0},
+      [11] = {"CRC-8/DVB-S2", CRC_VARIANT_CRC8_DVB_S2, 0},
+      [13] = {"CRC-8/CDMA2000", CRC_VARIANT_CRC8_CDMA2000, 0},
+      [14] = {"CRC-8/ROHC", CRC_VARIANT_CRC8_ROHC, 0},
+      [15] = {"CRC-16/AUTOSAR", CRC_VARIANT_CRC16_CCITT_FALSE, 0},
+      [17] = {"CRC-16/LHA", CRC_VARIANT_CRC16_ARC, 0},
+      [18] = {"CRC-8/SMBUS", CRC_VARIANT_CRC8, 0},
+      [19] = {"CRC-8/DARC", CRC_VARIANT_CRC8_DARC, 0},
+      [20] = {"CRC-IBM", CRC_VARIANT_CRC16_ARC, 0},
+      [21] = {"CRC-8/AES", CRC_VARIANT_CRC8_EBU, 0},
+      [25] = {"CRC-16/ARC", CRC_VARIANT_CRC16_ARC, 0},
+      [26] = {"CRC-8/WCDMA", CRC_VARIANT_CRC8_WCDMA, 0},
+      [37] = {"CRC-8/MAXIM-DOW", CRC_VARIANT_CRC8_MAXIM, 0},
+      [48] = {"CRC-16/CCITT-FALSE", CRC_VARIANT_CRC16_CCITT_FALSE, 0},
+      [50] = {"CRC-8/ITU", CRC_VARIANT_CRC8_ITU, 0},
+      [56] = {"ARC", CRC_VARIANT_CRC16_ARC, 0},
+      [59] = {"CRC-16", CRC_VARIANT_CRC16_ARC, 0},
+      [61] = {"CRC-8/MAXIM", CRC_VARIANT_CRC8_MAXIM, 0},
+      [62] = {"DOW-CRC", CRC_VARIANT_CRC8_MAXIM, 0},
+      [63] = {"CRC-8/I-CODE", CRC_VARIANT_CRC8_I_CODE, 0}
   };
 #endif
 
@@ -387,15 +935,183 @@
  * Function Prototypes
  ****************************************************************************************************/
 
-/*** Reflect ***/
-/* U8 */
-#ifdef CRC_REFLECT_U8
-  static uint8_t crc_reflectU8(const uint8_t Data);
+/*** Generic ***/
+#ifdef CRC_GENERIC
+  static uint16_t crc_genericCrcFromRegister(const crc_parameters_t * const Parameters, const uint16_t Register);
+  static uint16_t crc_genericCrcFromState(const crc_parameters_t * const Parameters, const uint16_t State);
+  static uint16_t crc_genericDelta(const crc_parameters_t * const Parameters, const uint8_t * const Delta, const uint16_t DeltaLength, const uint32_t Distance);
+  static bool crc_genericForge(const crc_parameters_t * const Parameters, const uint16_t Crc, const uint16_t Target, const uint32_t Distance, uint8_t * const patch);
+  static uint16_t crc_genericMultiply(const crc_parameters_t * const Parameters, const uint16_t A, const uint16_t B);
+  static uint16_t crc_genericReflect(const crc_parameters_t * const Parameters, const uint16_t Register);
+  static uint16_t crc_genericRegisterFromCrc(const crc_parameters_t * const Parameters, const uint16_t Crc);
+  static uint16_t crc_genericRegisterFromState(const crc_parameters_t * const Parameters, const uint16_t State);
+  static uint16_t crc_genericReverseUpdate(const crc_parameters_t * const Parameters, uint16_t Register, const uint8_t Data);
+  static void crc_genericRollingInitialize(const crc_parameters_t * const Parameters, crc_rolling_t * const Rolling, const uint16_t WindowLength);
+  static uint16_t crc_genericRollingUpdate(const crc_rolling_t * const Rolling, const uint8_t Out, const uint8_t In, const uint16_t Crc);
+  static uint16_t crc_genericShift(const crc_parameters_t * const Parameters, uint16_t Register, uint32_t ZeroBytes);
+  static uint16_t crc_genericShiftState(const crc_parameters_t * const Parameters, const uint16_t State, const uint32_t ZeroBytes);
+  static uint16_t crc_genericStateFromRegister(const crc_parameters_t * const Parameters, const uint16_t Register);
+  static uint16_t crc_genericStripPrefix(const crc_parameters_t * const Parameters, const uint16_t Crc, const uint16_t PrefixCrc, const uint32_t SuffixLength);
+  static uint16_t crc_genericUnwind(const crc_parameters_t * const Parameters, const uint16_t Crc, const uint8_t * const Data, const uint16_t DataLength);
+  static uint16_t crc_genericUpdate(const crc_parameters_t * const Parameters, uint16_t Register, const uint8_t Data);
+  static uint16_t crc_genericUpdateBits(const crc_parameters_t * const Parameters, const uint16_t State, const uint8_t Data, const uint8_t FirstBit, const uint8_t BitCount);
+#endif
+
+/*** Syndrome ***/
+#ifdef CRC_SYNDROME
+  static crc_correction_t crc_syndromeCorrect(const crc_parameters_t * const Parameters, const uint32_t * const Position, uint8_t * const data, const uint16_t DataLength, const uint16_t Syndrome);
+  static void crc_syndromeFlipBit(const crc_parameters_t * const Parameters, uint8_t * const data, const uint16_t DataLength, const uint32_t Distance);
+  static void crc_syndromeInitialize(const crc_parameters_t * const Parameters, uint32_t * const position, const uint32_t BitLength);
+#endif
+
+/*** Reverse ***/
+#ifdef CRC_REVERSE
+  static uint16_t crc_reverseCalculate(const crc_model_t * const Model, const uint8_t * const Data, const uint16_t DataLength);
+  static crc_variant_t crc_reverseMatchPreset(const crc_model_t * const Model);
+  static bool crc_reverseSolve(const crc_parameters_t * const Parameters, const bool ReflectOut, const crc_sample_t * const Sample, const uint16_t SampleCount, crc_model_t * const model);
+#endif
+
+/*** Metrics ***/
+#ifdef CRC_METRICS
+  static void crc_metricsAdd(CRC_ATOMIC uint64_t * const counter, const uint64_t Value);
+  static uint64_t crc_metricsBegin(const crc_variant_t Variant, const uint32_t DataLength);
+  static uint8_t crc_metricsBucket(uint64_t value);
+  static crc_metrics_thread_t *crc_metricsCount(const crc_variant_t Variant, const uint32_t DataLength);
+  static void crc_metricsEnd(const crc_variant_t Variant, const uint64_t Start);
+  static void crc_metricsFold(crc_metrics_t * const metrics, crc_metrics_counter_t * const counter);
+  static void crc_metricsKeyCreate(void);
+  static void crc_metricsRetire(void *thread);
+  static uint64_t crc_metricsTimestamp(void);
+#endif
+
+/*** JIT ***/
+#ifdef CRC_JIT
+  static void crc_jitBuild(crc_jit_entry_t * const entry, const crc_model_t * const Model);
+  #ifdef CRC_JIT_NATIVE
+    static crc_jit_kernel_t crc_jitEmit(const crc_jit_entry_t * const Entry);
+  #endif
+  static const crc_jit_entry_t *crc_jitFind(const crc_model_t * const Model);
+  static uint16_t crc_jitInterpret(const crc_jit_entry_t * const Entry, uint16_t reg, const uint8_t *data, size_t blockCount);
+  static bool crc_jitMatch(const crc_jit_entry_t * const Entry, const crc_model_t * const Model);
+  #ifdef CRC_JIT_NATIVE
+    static size_t crc_jitPut(uint8_t * const code, size_t length, const uint64_t Value, const uint8_t ByteCount);
+  #endif
+  static uint16_t crc_jitRun(const crc_jit_entry_t * const Entry, uint16_t reg, const uint8_t * const Data, const uint16_t DataLength);
+#endif
+
+/*** Table ***/
+#ifdef CRC_TABLE
+  static uint32_t crc_tableBucketIndex(const uint32_t Key);
+  static int crc_tableCompare(const void *a, const void *b);
+  static void crc_tableEvict(void);
+  static void crc_tableIdleRemove(crc_table_t * const table);
+  static uint32_t crc_tableKey(const uint8_t Width, const uint16_t Polynomial, const bool ReflectIn);
+#endif
+
+/*** Registry ***/
+/* CRC-8 */
+#if defined(CRC_REGISTRY) && (defined(CRC_CRC8_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_LOOP_METHOD))
+  static uint16_t crc_registryCrc8Initialize(void);
+  static uint16_t crc_registryCrc8Update(uint16_t state, const uint8_t * const Data, const uint16_t DataLength);
+  static uint16_t crc_registryCrc8Finalize(const uint16_t State);
+  static uint16_t crc_registryCrc8Combine(const uint16_t CrcA, const uint16_t CrcB, const uint32_t LengthB);
+#endif
+
+/* CRC-8/CDMA2000 */
+#if defined(CRC_REGISTRY) && (defined(CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_CDMA2000_LOOP_METHOD))
+  static uint16_t crc_registryCrc8Cdma2000Initialize(void);
+  static uint16_t crc_registryCrc8Cdma2000Update(uint16_t state, const uint8_t * const Data, const uint16_t DataLength);
+  static uint16_t crc_registryCrc8Cdma2000Finalize(const uint16_t State);
+  static uint16_t crc_registryCrc8Cdma2000Combine(const uint16_t CrcA, const uint16_t CrcB, const uint32_t LengthB);
+#endif
+
+/* CRC-8/DARC */
+#if defined(CRC_REGISTRY) && (defined(CRC_CRC8_DARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DARC_LOOP_METHOD))
+  static uint16_t crc_registryCrc8DarcInitialize(void);
+  static uint16_t crc_registryCrc8DarcUpdate(uint16_t state, const uint8_t * const Data, const uint16_t DataLength);
+  static uint16_t crc_registryCrc8DarcFinalize(const uint16_t State);
+  static uint16_t crc_registryCrc8DarcCombine(const uint16_t CrcA, const uint16_t CrcB, const uint32_t LengthB);
+#endif
+
+/* CRC-8/DVB-S2 */
+#if defined(CRC_REGISTRY) && (defined(CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DVB_S2_LOOP_METHOD))
+  static uint16_t crc_registryCrc8DvbS2Initialize(void);
+  static uint16_t crc_registryCrc8DvbS2Update(uint16_t state, const uint8_t * const Data, const uint16_t DataLength);
+  static uint16_t crc_registryCrc8DvbS2Finalize(const uint16_t State);
+  static uint16_t crc_registryCrc8DvbS2Combine(const uint16_t CrcA, const uint16_t CrcB, const uint32_t LengthB);
+#endif
+
+/* CRC-8/EBU */
+#if defined(CRC_REGISTRY) && (defined(CRC_CRC8_EBU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_EBU_LOOP_METHOD))
+  static uint16_t crc_registryCrc8EbuInitialize(void);
+  static uint16_t crc_registryCrc8EbuUpdate(uint16_t state, const uint8_t * const Data, const uint16_t DataLength);
+  static uint16_t crc_registryCrc8EbuFinalize(const uint16_t State);
+  static uint16_t crc_registryCrc8EbuCombine(const uint16_t CrcA, const uint16_t CrcB, const uint32_t LengthB);
+#endif
+
+/* CRC-8/I-CODE */
+#if defined(CRC_REGISTRY) && (defined(CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_I_CODE_LOOP_METHOD))
+  static uint16_t crc_registryCrc8ICodeInitialize(void);
+  static uint16_t crc_registryCrc8ICodeUpdate(uint16_t state, const uint8_t * const Data, const uint16_t DataLength);
+  static uint16_t crc_registryCrc8ICodeFinalize(const uint16_t State);
+  static uint16_t crc_registryCrc8ICodeCombine(const uint16_t CrcA, const uint16_t CrcB, const uint32_t LengthB);
+#endif
+
+/* CRC-8/ITU */
+#if defined(CRC_REGISTRY) && (defined(CRC_CRC8_ITU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ITU_LOOP_METHOD))
+  static uint16_t crc_registryCrc8ItuInitialize(void);
+  static uint16_t crc_registryCrc8ItuUpdate(uint16_t state, const uint8_t * const Data, const uint16_t DataLength);
+  static uint16_t crc_registryCrc8ItuFinalize(const uint16_t State);
+  static uint16_t crc_registryCrc8ItuCombine(const uint16_t CrcA, const uint16_t CrcB, const uint32_t LengthB);
+#endif
+
+/* CRC-8/MAXIM */
+#if defined(CRC_REGISTRY) && (defined(CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_MAXIM_LOOP_METHOD))
+  static uint16_t crc_registryCrc8MaximInitialize(void);
+  static uint16_t crc_registryCrc8MaximUpdate(uint16_t state, const uint8_t * const Data, const uint16_t DataLength);
+  static uint16_t crc_registryCrc8MaximFinalize(const uint16_t State);
+  static uint16_t crc_registryCrc8MaximCombine(const uint16_t CrcA, const uint16_t CrcB, const uint32_t LengthB);
+#endif
+
+/* CRC-8/ROHC */
+#if defined(CRC_REGISTRY) && (defined(CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ROHC_LOOP_METHOD))
+  static uint16_t crc_registryCrc8RohcInitialize(void);
+  static uint16_t crc_registryCrc8RohcUpdate(uint16_t state, const uint8_t * const Data, const uint16_t DataLength);
+  static uint16_t crc_registryCrc8RohcFinalize(const uint16_t State);
+  static uint16_t crc_registryCrc8RohcCombine(const uint16_t CrcA, const uint16_t CrcB, const uint32_t LengthB);
+#endif
+
+/* CRC-8/WCDMA */
+#if defined(CRC_REGISTRY) && (defined(CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_WCDMA_LOOP_METHOD))
+  static uint16_t crc_registryCrc8WcdmaInitialize(void);
+  static uint16_t crc_registryCrc8WcdmaUpdate(uint16_t state, const uint8_t * const Data, const uint16_t DataLength);
+  static uint16_t crc_registryCrc8WcdmaFinalize(const uint16_t State);
+  static uint16_t crc_registryCrc8WcdmaCombine(const uint16_t CrcA, const uint16_t CrcB, const uint32_t LengthB);
+#endif
+
+/* CRC-16/ARC */
+#if defined(CRC_REGISTRY) && (defined(CRC_CRC16_ARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_ARC_LOOP_METHOD))
+  static uint16_t crc_registryCrc16ArcInitialize(void);
+  static uint16_t crc_registryCrc16ArcUpdate(uint16_t state, const uint8_t * const Data, const uint16_t DataLength);
+  static uint16_t crc_registryCrc16ArcFinalize(const uint16_t State);
+  static uint16_t crc_registryCrc16ArcCombine(const uint16_t CrcA, const uint16_t CrcB, const uint32_t LengthB);
+#endif
+
+/* CRC-16/CCITT-FALSE */
+#if defined(CRC_REGISTRY) && (defined(CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_CCITT_FALSE_LOOP_METHOD))
+  static uint16_t crc_registryCrc16CcittFalseInitialize(void);
+  static uint16_t crc_registryCrc16CcittFalseUpdate(uint16_t state, const uint8_t * const Data, const uint16_t DataLength);
+  static uint16_t crc_registryCrc16CcittFalseFinalize(const uint16_t State);
+  static uint16_t crc_registryCrc16CcittFalseCombine(const uint16_t CrcA, const uint16_t CrcB, const uint32_t LengthB);
 #endif
 
-/* U16 */
-#ifdef CRC_REFLECT_U16
-  static uint16_t crc_reflectU16(const uint16_t Data);
+/*** Model ***/
+#ifdef CRC_MODEL
+  static uint16_t crc_modelFinal(const crc_model_t * const Model, const uint16_t Register);
+  static uint16_t crc_modelInitial(const crc_model_t * const Model);
+  static uint16_t crc_modelReflect(const uint16_t Register, const uint8_t Width);
+  static void crc_modelTable(uint16_t * const table, const uint8_t Width, const uint16_t Polynomial, const bool ReflectIn);
+  static uint16_t crc_modelUpdate(const uint16_t * const Table, const uint8_t Width, const bool ReflectIn, uint16_t reg, const uint8_t * const Data, const uint16_t DataLength);
 #endif
 
 /****************************************************************************************************
@@ -414,14 +1130,23 @@ uint8_t crc_crc8Calculate(const uint8_t * const Data, const uint16_t DataLength)
 {
     uint8_t crc8 = CRC_CRC8_INITIAL_CRC8;
     uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
 
     /*** Error Check ***/
     if((Data == NULL) || (DataLength == 0))
         return CRC_CRC8_INITIAL_CRC8;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8, DataLength);
+#endif
 
     /*** Calculate Full CRC-8 ***/
     for(i = 0; i < DataLength; i++)
-        crc8 = crc_crc8CalculatePartial(Data[i], crc8);
+        crc8 = crc_crc8Step(Data[i], crc8);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8, metricsStart);
+#endif
 
     return crc8;
 }
@@ -437,50 +1162,473 @@ uint8_t crc_crc8Calculate(const uint8_t * const Data, const uint16_t DataLength)
  ****************************************************************************************************/
 uint8_t crc_crc8CalculatePartial(const uint8_t Data, uint8_t crc8)
 {
-#if defined(CRC_CRC8_LOOKUP_TABLE_METHOD) && defined(CRC_CRC8_LOOP_METHOD)
-  #error CRC_CRC8_LOOKUP_TABLE_METHOD And CRC_CRC8_LOOP_METHOD Cannot Both Be Defined
-#elif defined(CRC_CRC8_LOOKUP_TABLE_METHOD) 
     /*** Calculate Partial CRC-8 ***/
-    crc8 = crc_crc8LookupTable[Data ^ crc8];
+    crc8 = crc_crc8Step(Data, crc8);
+    
     return crc8;
-#elif defined(CRC_CRC8_LOOP_METHOD)
-    uint8_t bit;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8Modify
+ * BRIEF:   Update CRC-8 After In-Place Modification Of Data
+ * RETURN:  uint8_t: CRC-8 Of Modified Data
+ * ARG:     crc8: CRC-8 Of Original Data
+ * ARG:     Delta: XOR Of Original And Modified Bytes
+ * ARG:     DeltaLength: Length Of Delta (Number Of Modified Bytes)
+ * ARG:     Distance: Number Of Bytes From End Of Modified Range To End Of Data
+ * NOTE:    Runs In O(DeltaLength + log Distance) Regardless Of Data Length
+ ****************************************************************************************************/
+uint8_t crc_crc8Modify(uint8_t crc8, const uint8_t * const Delta, const uint16_t DeltaLength, const uint32_t Distance)
+{
+    /*** Error Check ***/
+    if((Delta == NULL) || (DeltaLength == 0))
+        return crc8;
     
-    /*** Calculate Partial CRC-8 ***/
-    crc8 ^= Data;
-    for(bit = 0; bit < 8; bit++)
-    {
-        if((crc8 & 0x80) == 0x80)
-            crc8 = (uint8_t)((crc8 << 1) ^ CRC_CRC8_POLYNOMIAL);
-        else
-            crc8 <<= 1;
-    }
+    /*** Update CRC-8 ***/
+    crc8 ^= (uint8_t)crc_genericDelta(&crc_crc8Parameters, Delta, DeltaLength, Distance);
     
     return crc8;
-#endif
 }
-#endif
 
-#if defined(CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_CDMA2000_LOOP_METHOD)
 /****************************************************************************************************
- * FUNCT:   crc_crc8Cdma2000Calculate
- * BRIEF:   Calculate Full CRC-8/CDMA2000
- * RETURN:  uint8_t: CRC-8/CDMA2000
- * ARG:     Data: Data Buffer To Calculate CRC-8/CDMA2000 For
- * ARG:     DataLength: Length Of Data Buffer
+ * FUNCT:   crc_crc8ModifyBatch
+ * BRIEF:   Update CRC-8 After In-Place Modification Of Data (Multiple Patches)
+ * RETURN:  uint8_t: CRC-8 Of Modified Data
+ * ARG:     crc8: CRC-8 Of Original Data
+ * ARG:     Patch: Patch List (Patches May Be In Any Order)
+ * ARG:     PatchCount: Number Of Patches In Patch List
+ * ARG:     DataLength: Length Of Data
+ * NOTE:    Patches Extending Beyond DataLength Are Ignored
  ****************************************************************************************************/
-uint8_t crc_crc8Cdma2000Calculate(const uint8_t * const Data, const uint16_t DataLength)
+uint8_t crc_crc8ModifyBatch(uint8_t crc8, const crc_patch_t * const Patch, const uint16_t PatchCount, const uint32_t DataLength)
 {
-    uint8_t crc8Cdma2000 = CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000;
-    uint32_t i;
-
+    uint16_t i;
+    
     /*** Error Check ***/
-    if((Data == NULL) || (DataLength == 0))
-        return CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000;
-
+    if(Patch == NULL)
+        return crc8;
+    
+    /*** Update CRC-8 For Each Patch ***/
+    for(i = 0; i < PatchCount; i++)
+    {
+        if((Patch[i].delta == NULL) || (Patch[i].offset > DataLength) || (Patch[i].length > (DataLength - Patch[i].offset)))
+            continue;
+        crc8 = crc_crc8Modify(crc8, Patch[i].delta, Patch[i].length, DataLength - Patch[i].offset - Patch[i].length);
+    }
+    
+    return crc8;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8RollingInitialize
+ * BRIEF:   Initialize Rolling (Sliding Window) CRC-8
+ * RETURN:  bool: Success Or Failure Status
+ * ARG:     Rolling: Rolling Context To Initialize
+ * ARG:     WindowLength: Length Of Sliding Window
+ * NOTE:    Precomputes Tables For WindowLength; Context Can Then Be Shared By Any Number Of Streams
+ ****************************************************************************************************/
+bool crc_crc8RollingInitialize(crc_rolling_t * const Rolling, const uint16_t WindowLength)
+{
+    /*** Error Check ***/
+    if((Rolling == NULL) || (WindowLength == 0))
+        return false;
+    
+    /*** Initialize Rolling CRC-8 ***/
+    crc_genericRollingInitialize(&crc_crc8Parameters, Rolling, WindowLength);
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8RollingUpdate
+ * BRIEF:   Slide Rolling CRC-8 Window Forward One Byte
+ * RETURN:  uint8_t: CRC-8 Of New Window
+ * ARG:     Rolling: Rolling Context (Initialized By crc_crc8RollingInitialize)
+ * ARG:     Out: Data Leaving Window (Oldest Byte)
+ * ARG:     In: Data Entering Window
+ * ARG:     crc8: CRC-8 Of Current Window
+ * NOTE:    Seed With crc_crc8Calculate Of First Window; Runs In O(1) Regardless Of Window Length
+ ****************************************************************************************************/
+uint8_t crc_crc8RollingUpdate(const crc_rolling_t * const Rolling, const uint8_t Out, const uint8_t In, const uint8_t crc8)
+{
+    /*** Error Check ***/
+    if(Rolling == NULL)
+        return crc8;
+    
+    /*** Slide Window ***/
+    return (uint8_t)crc_genericRollingUpdate(Rolling, Out, In, crc8);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8StripPrefix
+ * BRIEF:   Remove Known Prefix From CRC-8
+ * RETURN:  uint8_t: CRC-8 Of Data Following Prefix
+ * ARG:     crc8: CRC-8 Of Prefix Followed By Suffix
+ * ARG:     Prefix: Prefix Data Buffer
+ * ARG:     PrefixLength: Length Of Prefix Data Buffer
+ * ARG:     SuffixLength: Length Of Data Following Prefix
+ * NOTE:    Runs In O(PrefixLength + log SuffixLength); Suffix Data Is Not Needed
+ ****************************************************************************************************/
+uint8_t crc_crc8StripPrefix(uint8_t crc8, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength)
+{
+    uint8_t crc8Prefix = CRC_CRC8_INITIAL_CRC8;
+    uint32_t i;
+    
+    /*** Error Check ***/
+    if((Prefix == NULL) || (PrefixLength == 0))
+        return crc8;
+    else if(SuffixLength == 0)
+        return CRC_CRC8_INITIAL_CRC8;
+    
+    /*** Calculate CRC-8 Of Prefix ***/
+    for(i = 0; i < PrefixLength; i++)
+        crc8Prefix = crc_crc8Step(Prefix[i], crc8Prefix);
+    
+    /*** Strip Prefix ***/
+    crc8 = (uint8_t)crc_genericStripPrefix(&crc_crc8Parameters, crc8, crc8Prefix, SuffixLength);
+    
+    return crc8;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8Unwind
+ * BRIEF:   Run CRC-8 Backward Over Known Trailing Data
+ * RETURN:  uint8_t: CRC-8 Of Data Preceding Trailing Data
+ * ARG:     crc8: CRC-8 Of Data Including Trailing Data
+ * ARG:     Data: Trailing Data Buffer
+ * ARG:     DataLength: Length Of Trailing Data Buffer
+ ****************************************************************************************************/
+uint8_t crc_crc8Unwind(uint8_t crc8, const uint8_t * const Data, const uint16_t DataLength)
+{
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength == 0))
+        return crc8;
+    
+    /*** Unwind CRC-8 ***/
+    crc8 = (uint8_t)crc_genericUnwind(&crc_crc8Parameters, crc8, Data, DataLength);
+    
+    return crc8;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8PrefixInitialize
+ * BRIEF:   Precompute CRC-8 State After Constant Prefix
+ * RETURN:  bool: True If Prefix State Computed
+ * ARG:     prefix: Prefix State
+ * ARG:     Data: Prefix Data Buffer (May Be NULL If DataLength Is Zero)
+ * ARG:     DataLength: Length Of Prefix Data Buffer
+ * NOTE:    The State Is Kept In The Same Form CalculatePartial Passes Between Bytes, Not As A
+ *          Finished CRC, So Resuming From It Is Exact For Every Method
+ ****************************************************************************************************/
+bool crc_crc8PrefixInitialize(crc_prefix_t * const prefix, const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8 = CRC_CRC8_INITIAL_CRC8;
+    uint32_t i;
+    
+    /*** Error Check ***/
+    if((prefix == NULL) || ((Data == NULL) && (DataLength != 0)))
+        return false;
+    
+    /*** Calculate CRC-8 State Of Prefix; Finish It For CRC Of Prefix ***/
+    for(i = 0; i < DataLength; i++)
+        crc8 = crc_crc8Step(Data[i], crc8);
+    prefix->state = crc8;
+    prefix->crc = crc8;
+    
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8PrefixCalculate
+ * BRIEF:   Calculate Full CRC-8 Of Constant Prefix Followed By Data
+ * RETURN:  uint8_t: CRC-8
+ * ARG:     Prefix: Prefix State From crc_crc8PrefixInitialize
+ * ARG:     Data: Data Buffer Following Prefix
+ * ARG:     DataLength: Length Of Data Buffer
+ * NOTE:    Only Data Is Processed; The Prefix Contribution Is Reused
+ ****************************************************************************************************/
+uint8_t crc_crc8PrefixCalculate(const crc_prefix_t * const Prefix, const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if(Prefix == NULL)
+        return CRC_CRC8_INITIAL_CRC8;
+    if((Data == NULL) || (DataLength == 0))
+        return (uint8_t)Prefix->crc;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8, DataLength);
+#endif
+    
+    /*** Resume CRC-8 From Prefix State ***/
+    crc8 = (uint8_t)Prefix->state;
+    for(i = 0; i < DataLength; i++)
+        crc8 = crc_crc8Step(Data[i], crc8);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8, metricsStart);
+#endif
+    
+    return crc8;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8CalculateMasked
+ * BRIEF:   Calculate Full CRC-8 With Masked Ranges Treated As Zero
+ * RETURN:  uint8_t: CRC-8
+ * ARG:     Data: Data Buffer To Calculate CRC-8 For
+ * ARG:     DataLength: Length Of Data Buffer
+ * ARG:     Mask: Masked Range List (Sorted By Offset; Ranges Beyond DataLength Are Clipped)
+ * ARG:     MaskCount: Number Of Masked Ranges In Masked Range List
+ * NOTE:    Data Is Not Copied Or Modified; Each Masked Range Costs O(log Length) With No Per-Byte Work
+ ****************************************************************************************************/
+uint8_t crc_crc8CalculateMasked(const uint8_t * const Data, const uint16_t DataLength, const crc_mask_t * const Mask, const uint16_t MaskCount)
+{
+    uint8_t crc8 = CRC_CRC8_INITIAL_CRC8;
+    uint32_t end, i = 0, m, start;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength == 0) || ((Mask == NULL) && (MaskCount != 0)))
+        return CRC_CRC8_INITIAL_CRC8;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8, DataLength);
+#endif
+    
+    /*** Calculate CRC-8 Up To Each Masked Range; Shift Over Masked Range ***/
+    for(m = 0; m < MaskCount; m++)
+    {
+        start = (Mask[m].offset > i) ? Mask[m].offset : i;
+        end = (uint32_t)Mask[m].offset + Mask[m].length;
+        if(end > DataLength)
+            end = DataLength;
+        if(end <= start)
+            continue;
+        for(; i < start; i++)
+            crc8 = crc_crc8Step(Data[i], crc8);
+        crc8 = (uint8_t)crc_genericShiftState(&crc_crc8Parameters, crc8, end - start);
+        i = end;
+    }
+    
+    /*** Calculate CRC-8 After Final Masked Range ***/
+    for(; i < DataLength; i++)
+        crc8 = crc_crc8Step(Data[i], crc8);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8, metricsStart);
+#endif
+    
+    return (uint8_t)crc_genericCrcFromState(&crc_crc8Parameters, crc8);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8CalculateBits
+ * BRIEF:   Calculate Full CRC-8 Over Bit-Granular Data
+ * RETURN:  uint8_t: CRC-8
+ * ARG:     Data: Data Buffer To Calculate CRC-8 For
+ * ARG:     BitOffset: Offset Of First Bit (Bits Within Byte In Transmission Order: Most Significant Bit First)
+ * ARG:     BitLength: Number Of Bits (BitOffset + BitLength Must Not Exceed UINT32_MAX)
+ * NOTE:    Whole Bytes Use The Byte-Wise Method; Only Leading And Trailing Partial Bytes Are Bitwise
+ ****************************************************************************************************/
+uint8_t crc_crc8CalculateBits(const uint8_t * const Data, const uint32_t BitOffset, const uint32_t BitLength)
+{
+    uint8_t crc8 = CRC_CRC8_INITIAL_CRC8;
+    uint8_t count;
+    uint32_t bit, end;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((Data == NULL) || (BitLength == 0) || (BitLength > (UINT32_MAX - BitOffset)))
+        return CRC_CRC8_INITIAL_CRC8;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8, ((BitLength - 1) / 8) + 1);
+#endif
+    
+    /*** Set Up ***/
+    bit = BitOffset;
+    end = BitOffset + BitLength;
+    
+    /*** Calculate CRC-8 Over Leading Bits (Up To Byte Boundary) ***/
+    if((bit & 0x07) != 0)
+    {
+        count = (uint8_t)(8 - (bit & 0x07));
+        if(count > (end - bit))
+            count = (uint8_t)(end - bit);
+        crc8 = (uint8_t)crc_genericUpdateBits(&crc_crc8Parameters, crc8, Data[bit >> 3], (uint8_t)(bit & 0x07), count);
+        bit += count;
+    }
+    
+    /*** Calculate CRC-8 Over Whole Bytes ***/
+    for(; (end - bit) >= 8; bit += 8)
+        crc8 = crc_crc8Step(Data[bit >> 3], crc8);
+    
+    /*** Calculate CRC-8 Over Trailing Bits ***/
+    if(bit < end)
+        crc8 = (uint8_t)crc_genericUpdateBits(&crc_crc8Parameters, crc8, Data[bit >> 3], 0, (uint8_t)(end - bit));
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8, metricsStart);
+#endif
+    return (uint8_t)crc_genericCrcFromState(&crc_crc8Parameters, crc8);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8CalculatePartialBits
+ * BRIEF:   Calculate Partial CRC-8 Over Bit-Granular Data
+ * RETURN:  uint8_t: Current/Final CRC-8
+ * ARG:     Data: Data Byte Containing Bits (First Bits In Transmission Order: Most Significant Bit First)
+ * ARG:     BitLength: Number Of Bits (1 ... 8)
+ * ARG:     crc8: Current CRC-8
+ * NOTE:    Set CRC-8 Value To CRC_CRC8_INITIAL_CRC8 If First Data Bits;
+ *          Returned CRC-8 Value Should Be Used On Subsequent Data Bits; May Be Mixed With
+ *          crc_crc8CalculatePartial For Whole Bytes
+ ****************************************************************************************************/
+uint8_t crc_crc8CalculatePartialBits(const uint8_t Data, const uint8_t BitLength, uint8_t crc8)
+{
+    /*** Error Check ***/
+    if(BitLength == 0)
+        return crc8;
+    else if(BitLength >= 8)
+        return crc_crc8Step(Data, crc8);
+    
+    /*** Calculate Partial CRC-8 ***/
+    crc8 = (uint8_t)crc_genericUpdateBits(&crc_crc8Parameters, crc8, Data, 0, BitLength);
+    return crc8;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8Verify
+ * BRIEF:   Verify Data Followed By Its CRC-8
+ * RETURN:  bool: True If CRC-8 Matches
+ * ARG:     Data: Data Buffer With CRC-8 In Trailing Byte
+ * ARG:     DataLength: Length Of Data Buffer Including CRC-8
+ * NOTE:    Runs Over Data And CRC-8 In One Pass And Compares Against The Residue Constant
+ ****************************************************************************************************/
+bool crc_crc8Verify(const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8 = CRC_CRC8_INITIAL_CRC8;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength < 1))
+        return false;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8, DataLength);
+#endif
+    
+    /*** Calculate Partial CRC-8 Over Data And CRC-8 ***/
+    for(i = 0; i < DataLength; i++)
+        crc8 = crc_crc8Step(Data[i], crc8);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8, metricsStart);
+#endif
+    
+    return (crc8 == CRC_CRC8_RESIDUE);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8Correct
+ * BRIEF:   Correct Single And Double Bit Errors In Data Followed By Its CRC-8
+ * RETURN:  crc_correction_t: Correction Result
+ * ARG:     syndrome: Syndrome Table (Rebuilt Only When Data Is Longer Than Any Seen Before)
+ * ARG:     data: Data Buffer With CRC-8 In Trailing Byte
+ * ARG:     DataLength: Length Of Data Buffer Including CRC-8
+ * NOTE:    Zero-Initialize Syndrome Table Before First Use; One Table Serves Every Data Length Up To
+ *          The Longest Seen, So Pass The Longest Frame First To Build It Once. Double Bit Errors Are
+ *          Only Corrected Where The Syndrome Is Unambiguous At The Built Length
+ ****************************************************************************************************/
+crc_correction_t crc_crc8Correct(crc_syndrome8_t * const syndrome, uint8_t * const data, const uint16_t DataLength)
+{
+    uint8_t crc8 = CRC_CRC8_INITIAL_CRC8;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((syndrome == NULL) || (data == NULL) || (DataLength < 1))
+        return CRC_CORRECTION_FAILED;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8, DataLength);
+#endif
+    
+    /*** Build Syndrome Table On First Use Of Longer Data Length ***/
+    if(syndrome->length < DataLength)
+    {
+        crc_syndromeInitialize(&crc_crc8Parameters, syndrome->position, (uint32_t)DataLength * 8);
+        syndrome->length = DataLength;
+    }
+    
+    /*** Calculate Partial CRC-8 Over Data And CRC-8 ***/
+    for(i = 0; i < DataLength; i++)
+        crc8 = crc_crc8Step(data[i], crc8);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8, metricsStart);
+#endif
+    
+    /*** Correct Errors From Syndrome ***/
+    return crc_syndromeCorrect(&crc_crc8Parameters, syndrome->position, data, DataLength, crc_genericRegisterFromState(&crc_crc8Parameters, (uint8_t)(crc8 ^ CRC_CRC8_RESIDUE)));
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8Forge
+ * BRIEF:   Patch Data So That Its CRC-8 Equals Target
+ * RETURN:  bool: True If Data Patched
+ * ARG:     data: Data Buffer To Patch
+ * ARG:     DataLength: Length Of Data Buffer
+ * ARG:     Offset: Offset Of 1 Patch Byte (Overwritten)
+ * ARG:     crc8: Current CRC-8 Of Data (Including Original Patch Bytes)
+ * ARG:     Target: CRC-8 To Reach
+ * NOTE:    Patch Is Solved Directly In O(log DataLength) From The Current CRC-8; Data Outside The
+ *          Patch Bytes Is Not Read, So A Wrong Current CRC-8 Gives A Wrong Patch
+ ****************************************************************************************************/
+bool crc_crc8Forge(uint8_t * const data, const uint16_t DataLength, const uint16_t Offset, const uint8_t crc8, const uint8_t Target)
+{
+    /*** Error Check ***/
+    if((data == NULL) || (DataLength < 1) || (Offset > (DataLength - 1)))
+        return false;
+    
+    /*** Solve Patch Bytes For Target CRC-8 ***/
+    return crc_genericForge(&crc_crc8Parameters, crc8, Target, (uint32_t)(DataLength - Offset - 1), &data[Offset]);
+}
+#endif
+
+#if defined(CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_CDMA2000_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crc_crc8Cdma2000Calculate
+ * BRIEF:   Calculate Full CRC-8/CDMA2000
+ * RETURN:  uint8_t: CRC-8/CDMA2000
+ * ARG:     Data: Data Buffer To Calculate CRC-8/CDMA2000 For
+ * ARG:     DataLength: Length Of Data Buffer
+ ****************************************************************************************************/
+uint8_t crc_crc8Cdma2000Calculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8Cdma2000 = CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength == 0))
+        return CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_CDMA2000, DataLength);
+#endif
+
     /*** Calculate Full CRC-8/CDMA2000 ***/
     for(i = 0; i < DataLength; i++)
-        crc8Cdma2000 = crc_crc8Cdma2000CalculatePartial(Data[i], crc8Cdma2000);
+        crc8Cdma2000 = crc_crc8Cdma2000Step(Data[i], crc8Cdma2000);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_CDMA2000, metricsStart);
+#endif
 
     return crc8Cdma2000;
 }
@@ -497,738 +1645,7444 @@ uint8_t crc_crc8Cdma2000Calculate(const uint8_t * const Data, const uint16_t Dat
  ****************************************************************************************************/
 uint8_t crc_crc8Cdma2000CalculatePartial(const uint8_t Data, uint8_t crc8Cdma2000)
 {
-#if defined(CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD) && defined(CRC_CRC8_CDMA2000_LOOP_METHOD)
-  #error CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD And CRC_CRC8_CDMA2000_LOOP_METHOD Cannot Both Be Defined
-#elif defined(CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD) 
     /*** Calculate Partial CRC-8/CDMA2000 ***/
-    crc8Cdma2000 ^= CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000;
-    crc8Cdma2000 = crc_crc8Cdma2000LookupTable[Data ^ crc8Cdma2000];
+    crc8Cdma2000 = crc_crc8Cdma2000Step(Data, crc8Cdma2000);
+    
     return crc8Cdma2000;
-#elif defined(CRC_CRC8_CDMA2000_LOOP_METHOD)
-    uint8_t bit;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8Cdma2000Modify
+ * BRIEF:   Update CRC-8/CDMA2000 After In-Place Modification Of Data
+ * RETURN:  uint8_t: CRC-8/CDMA2000 Of Modified Data
+ * ARG:     crc8Cdma2000: CRC-8/CDMA2000 Of Original Data
+ * ARG:     Delta: XOR Of Original And Modified Bytes
+ * ARG:     DeltaLength: Length Of Delta (Number Of Modified Bytes)
+ * ARG:     Distance: Number Of Bytes From End Of Modified Range To End Of Data
+ * NOTE:    Runs In O(DeltaLength + log Distance) Regardless Of Data Length
+ ****************************************************************************************************/
+uint8_t crc_crc8Cdma2000Modify(uint8_t crc8Cdma2000, const uint8_t * const Delta, const uint16_t DeltaLength, const uint32_t Distance)
+{
+    /*** Error Check ***/
+    if((Delta == NULL) || (DeltaLength == 0))
+        return crc8Cdma2000;
     
-    /*** Calculate Partial CRC-8/CDMA2000 ***/
-    crc8Cdma2000 ^= Data;
-    for(bit = 0; bit < 8; bit++)
+    /*** Update CRC-8/CDMA2000 ***/
+    crc8Cdma2000 ^= (uint8_t)crc_genericDelta(&crc_crc8Cdma2000Parameters, Delta, DeltaLength, Distance);
+    
+    return crc8Cdma2000;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8Cdma2000ModifyBatch
+ * BRIEF:   Update CRC-8/CDMA2000 After In-Place Modification Of Data (Multiple Patches)
+ * RETURN:  uint8_t: CRC-8/CDMA2000 Of Modified Data
+ * ARG:     crc8Cdma2000: CRC-8/CDMA2000 Of Original Data
+ * ARG:     Patch: Patch List (Patches May Be In Any Order)
+ * ARG:     PatchCount: Number Of Patches In Patch List
+ * ARG:     DataLength: Length Of Data
+ * NOTE:    Patches Extending Beyond DataLength Are Ignored
+ ****************************************************************************************************/
+uint8_t crc_crc8Cdma2000ModifyBatch(uint8_t crc8Cdma2000, const crc_patch_t * const Patch, const uint16_t PatchCount, const uint32_t DataLength)
+{
+    uint16_t i;
+    
+    /*** Error Check ***/
+    if(Patch == NULL)
+        return crc8Cdma2000;
+    
+    /*** Update CRC-8/CDMA2000 For Each Patch ***/
+    for(i = 0; i < PatchCount; i++)
+    {
+        if((Patch[i].delta == NULL) || (Patch[i].offset > DataLength) || (Patch[i].length > (DataLength - Patch[i].offset)))
+            continue;
+        crc8Cdma2000 = crc_crc8Cdma2000Modify(crc8Cdma2000, Patch[i].delta, Patch[i].length, DataLength - Patch[i].offset - Patch[i].length);
+    }
+    
+    return crc8Cdma2000;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8Cdma2000RollingInitialize
+ * BRIEF:   Initialize Rolling (Sliding Window) CRC-8/CDMA2000
+ * RETURN:  bool: Success Or Failure Status
+ * ARG:     Rolling: Rolling Context To Initialize
+ * ARG:     WindowLength: Length Of Sliding Window
+ * NOTE:    Precomputes Tables For WindowLength; Context Can Then Be Shared By Any Number Of Streams
+ ****************************************************************************************************/
+bool crc_crc8Cdma2000RollingInitialize(crc_rolling_t * const Rolling, const uint16_t WindowLength)
+{
+    /*** Error Check ***/
+    if((Rolling == NULL) || (WindowLength == 0))
+        return false;
+    
+    /*** Initialize Rolling CRC-8/CDMA2000 ***/
+    crc_genericRollingInitialize(&crc_crc8Cdma2000Parameters, Rolling, WindowLength);
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8Cdma2000RollingUpdate
+ * BRIEF:   Slide Rolling CRC-8/CDMA2000 Window Forward One Byte
+ * RETURN:  uint8_t: CRC-8/CDMA2000 Of New Window
+ * ARG:     Rolling: Rolling Context (Initialized By crc_crc8Cdma2000RollingInitialize)
+ * ARG:     Out: Data Leaving Window (Oldest Byte)
+ * ARG:     In: Data Entering Window
+ * ARG:     crc8Cdma2000: CRC-8/CDMA2000 Of Current Window
+ * NOTE:    Seed With crc_crc8Cdma2000Calculate Of First Window; Runs In O(1) Regardless Of Window Length
+ ****************************************************************************************************/
+uint8_t crc_crc8Cdma2000RollingUpdate(const crc_rolling_t * const Rolling, const uint8_t Out, const uint8_t In, const uint8_t crc8Cdma2000)
+{
+    /*** Error Check ***/
+    if(Rolling == NULL)
+        return crc8Cdma2000;
+    
+    /*** Slide Window ***/
+    return (uint8_t)crc_genericRollingUpdate(Rolling, Out, In, crc8Cdma2000);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8Cdma2000StripPrefix
+ * BRIEF:   Remove Known Prefix From CRC-8/CDMA2000
+ * RETURN:  uint8_t: CRC-8/CDMA2000 Of Data Following Prefix
+ * ARG:     crc8Cdma2000: CRC-8/CDMA2000 Of Prefix Followed By Suffix
+ * ARG:     Prefix: Prefix Data Buffer
+ * ARG:     PrefixLength: Length Of Prefix Data Buffer
+ * ARG:     SuffixLength: Length Of Data Following Prefix
+ * NOTE:    Runs In O(PrefixLength + log SuffixLength); Suffix Data Is Not Needed
+ ****************************************************************************************************/
+uint8_t crc_crc8Cdma2000StripPrefix(uint8_t crc8Cdma2000, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength)
+{
+    uint8_t crc8Cdma2000Prefix = CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000;
+    uint32_t i;
+    
+    /*** Error Check ***/
+    if((Prefix == NULL) || (PrefixLength == 0))
+        return crc8Cdma2000;
+    else if(SuffixLength == 0)
+        return CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000;
+    
+    /*** Calculate CRC-8/CDMA2000 Of Prefix ***/
+    for(i = 0; i < PrefixLength; i++)
+        crc8Cdma2000Prefix = crc_crc8Cdma2000Step(Prefix[i], crc8Cdma2000Prefix);
+    
+    /*** Strip Prefix ***/
+    crc8Cdma2000 = (uint8_t)crc_genericStripPrefix(&crc_crc8Cdma2000Parameters, crc8Cdma2000, crc8Cdma2000Prefix, SuffixLength);
+    
+    return crc8Cdma2000;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8Cdma2000Unwind
+ * BRIEF:   Run CRC-8/CDMA2000 Backward Over Known Trailing Data
+ * RETURN:  uint8_t: CRC-8/CDMA2000 Of Data Preceding Trailing Data
+ * ARG:     crc8Cdma2000: CRC-8/CDMA2000 Of Data Including Trailing Data
+ * ARG:     Data: Trailing Data Buffer
+ * ARG:     DataLength: Length Of Trailing Data Buffer
+ ****************************************************************************************************/
+uint8_t crc_crc8Cdma2000Unwind(uint8_t crc8Cdma2000, const uint8_t * const Data, const uint16_t DataLength)
+{
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength == 0))
+        return crc8Cdma2000;
+    
+    /*** Unwind CRC-8/CDMA2000 ***/
+    crc8Cdma2000 = (uint8_t)crc_genericUnwind(&crc_crc8Cdma2000Parameters, crc8Cdma2000, Data, DataLength);
+    
+    return crc8Cdma2000;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8Cdma2000PrefixInitialize
+ * BRIEF:   Precompute CRC-8/CDMA2000 State After Constant Prefix
+ * RETURN:  bool: True If Prefix State Computed
+ * ARG:     prefix: Prefix State
+ * ARG:     Data: Prefix Data Buffer (May Be NULL If DataLength Is Zero)
+ * ARG:     DataLength: Length Of Prefix Data Buffer
+ * NOTE:    The State Is Kept In The Same Form CalculatePartial Passes Between Bytes, Not As A
+ *          Finished CRC, So Resuming From It Is Exact For Every Method
+ ****************************************************************************************************/
+bool crc_crc8Cdma2000PrefixInitialize(crc_prefix_t * const prefix, const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8Cdma2000 = CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000;
+    uint32_t i;
+    
+    /*** Error Check ***/
+    if((prefix == NULL) || ((Data == NULL) && (DataLength != 0)))
+        return false;
+    
+    /*** Calculate CRC-8/CDMA2000 State Of Prefix; Finish It For CRC Of Prefix ***/
+    for(i = 0; i < DataLength; i++)
+        crc8Cdma2000 = crc_crc8Cdma2000Step(Data[i], crc8Cdma2000);
+    prefix->state = crc8Cdma2000;
+    prefix->crc = crc8Cdma2000;
+    
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8Cdma2000PrefixCalculate
+ * BRIEF:   Calculate Full CRC-8/CDMA2000 Of Constant Prefix Followed By Data
+ * RETURN:  uint8_t: CRC-8/CDMA2000
+ * ARG:     Prefix: Prefix State From crc_crc8Cdma2000PrefixInitialize
+ * ARG:     Data: Data Buffer Following Prefix
+ * ARG:     DataLength: Length Of Data Buffer
+ * NOTE:    Only Data Is Processed; The Prefix Contribution Is Reused
+ ****************************************************************************************************/
+uint8_t crc_crc8Cdma2000PrefixCalculate(const crc_prefix_t * const Prefix, const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8Cdma2000;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if(Prefix == NULL)
+        return CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000;
+    if((Data == NULL) || (DataLength == 0))
+        return (uint8_t)Prefix->crc;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_CDMA2000, DataLength);
+#endif
+    
+    /*** Resume CRC-8/CDMA2000 From Prefix State ***/
+    crc8Cdma2000 = (uint8_t)Prefix->state;
+    for(i = 0; i < DataLength; i++)
+        crc8Cdma2000 = crc_crc8Cdma2000Step(Data[i], crc8Cdma2000);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_CDMA2000, metricsStart);
+#endif
+    
+    return crc8Cdma2000;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8Cdma2000CalculateMasked
+ * BRIEF:   Calculate Full CRC-8/CDMA2000 With Masked Ranges Treated As Zero
+ * RETURN:  uint8_t: CRC-8/CDMA2000
+ * ARG:     Data: Data Buffer To Calculate CRC-8/CDMA2000 For
+ * ARG:     DataLength: Length Of Data Buffer
+ * ARG:     Mask: Masked Range List (Sorted By Offset; Ranges Beyond DataLength Are Clipped)
+ * ARG:     MaskCount: Number Of Masked Ranges In Masked Range List
+ * NOTE:    Data Is Not Copied Or Modified; Each Masked Range Costs O(log Length) With No Per-Byte Work
+ ****************************************************************************************************/
+uint8_t crc_crc8Cdma2000CalculateMasked(const uint8_t * const Data, const uint16_t DataLength, const crc_mask_t * const Mask, const uint16_t MaskCount)
+{
+    uint8_t crc8Cdma2000 = CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000;
+    uint32_t end, i = 0, m, start;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength == 0) || ((Mask == NULL) && (MaskCount != 0)))
+        return CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_CDMA2000, DataLength);
+#endif
+    
+    /*** Calculate CRC-8/CDMA2000 Up To Each Masked Range; Shift Over Masked Range ***/
+    for(m = 0; m < MaskCount; m++)
+    {
+        start = (Mask[m].offset > i) ? Mask[m].offset : i;
+        end = (uint32_t)Mask[m].offset + Mask[m].length;
+        if(end > DataLength)
+            end = DataLength;
+        if(end <= start)
+            continue;
+        for(; i < start; i++)
+            crc8Cdma2000 = crc_crc8Cdma2000Step(Data[i], crc8Cdma2000);
+        crc8Cdma2000 = (uint8_t)crc_genericShiftState(&crc_crc8Cdma2000Parameters, crc8Cdma2000, end - start);
+        i = end;
+    }
+    
+    /*** Calculate CRC-8/CDMA2000 After Final Masked Range ***/
+    for(; i < DataLength; i++)
+        crc8Cdma2000 = crc_crc8Cdma2000Step(Data[i], crc8Cdma2000);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_CDMA2000, metricsStart);
+#endif
+    
+    return (uint8_t)crc_genericCrcFromState(&crc_crc8Cdma2000Parameters, crc8Cdma2000);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8Cdma2000CalculateBits
+ * BRIEF:   Calculate Full CRC-8/CDMA2000 Over Bit-Granular Data
+ * RETURN:  uint8_t: CRC-8/CDMA2000
+ * ARG:     Data: Data Buffer To Calculate CRC-8/CDMA2000 For
+ * ARG:     BitOffset: Offset Of First Bit (Bits Within Byte In Transmission Order: Most Significant Bit First)
+ * ARG:     BitLength: Number Of Bits (BitOffset + BitLength Must Not Exceed UINT32_MAX)
+ * NOTE:    Whole Bytes Use The Byte-Wise Method; Only Leading And Trailing Partial Bytes Are Bitwise
+ ****************************************************************************************************/
+uint8_t crc_crc8Cdma2000CalculateBits(const uint8_t * const Data, const uint32_t BitOffset, const uint32_t BitLength)
+{
+    uint8_t crc8Cdma2000 = CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000;
+    uint8_t count;
+    uint32_t bit, end;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((Data == NULL) || (BitLength == 0) || (BitLength > (UINT32_MAX - BitOffset)))
+        return CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_CDMA2000, ((BitLength - 1) / 8) + 1);
+#endif
+    
+    /*** Set Up ***/
+    bit = BitOffset;
+    end = BitOffset + BitLength;
+    
+    /*** Calculate CRC-8/CDMA2000 Over Leading Bits (Up To Byte Boundary) ***/
+    if((bit & 0x07) != 0)
+    {
+        count = (uint8_t)(8 - (bit & 0x07));
+        if(count > (end - bit))
+            count = (uint8_t)(end - bit);
+        crc8Cdma2000 = (uint8_t)crc_genericUpdateBits(&crc_crc8Cdma2000Parameters, crc8Cdma2000, Data[bit >> 3], (uint8_t)(bit & 0x07), count);
+        bit += count;
+    }
+    
+    /*** Calculate CRC-8/CDMA2000 Over Whole Bytes ***/
+    for(; (end - bit) >= 8; bit += 8)
+        crc8Cdma2000 = crc_crc8Cdma2000Step(Data[bit >> 3], crc8Cdma2000);
+    
+    /*** Calculate CRC-8/CDMA2000 Over Trailing Bits ***/
+    if(bit < end)
+        crc8Cdma2000 = (uint8_t)crc_genericUpdateBits(&crc_crc8Cdma2000Parameters, crc8Cdma2000, Data[bit >> 3], 0, (uint8_t)(end - bit));
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_CDMA2000, metricsStart);
+#endif
+    return (uint8_t)crc_genericCrcFromState(&crc_crc8Cdma2000Parameters, crc8Cdma2000);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8Cdma2000CalculatePartialBits
+ * BRIEF:   Calculate Partial CRC-8/CDMA2000 Over Bit-Granular Data
+ * RETURN:  uint8_t: Current/Final CRC-8/CDMA2000
+ * ARG:     Data: Data Byte Containing Bits (First Bits In Transmission Order: Most Significant Bit First)
+ * ARG:     BitLength: Number Of Bits (1 ... 8)
+ * ARG:     crc8Cdma2000: Current CRC-8/CDMA2000
+ * NOTE:    Set CRC-8/CDMA2000 Value To CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000 If First Data Bits;
+ *          Returned CRC-8/CDMA2000 Value Should Be Used On Subsequent Data Bits; May Be Mixed With
+ *          crc_crc8Cdma2000CalculatePartial For Whole Bytes
+ ****************************************************************************************************/
+uint8_t crc_crc8Cdma2000CalculatePartialBits(const uint8_t Data, const uint8_t BitLength, uint8_t crc8Cdma2000)
+{
+    /*** Error Check ***/
+    if(BitLength == 0)
+        return crc8Cdma2000;
+    else if(BitLength >= 8)
+        return crc_crc8Cdma2000Step(Data, crc8Cdma2000);
+    
+    /*** Calculate Partial CRC-8/CDMA2000 ***/
+    crc8Cdma2000 = (uint8_t)crc_genericUpdateBits(&crc_crc8Cdma2000Parameters, crc8Cdma2000, Data, 0, BitLength);
+    return crc8Cdma2000;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8Cdma2000Verify
+ * BRIEF:   Verify Data Followed By Its CRC-8/CDMA2000
+ * RETURN:  bool: True If CRC-8/CDMA2000 Matches
+ * ARG:     Data: Data Buffer With CRC-8/CDMA2000 In Trailing Byte
+ * ARG:     DataLength: Length Of Data Buffer Including CRC-8/CDMA2000
+ * NOTE:    Runs Over Data And CRC-8/CDMA2000 In One Pass And Compares Against The Residue Constant
+ ****************************************************************************************************/
+bool crc_crc8Cdma2000Verify(const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8Cdma2000 = CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength < 1))
+        return false;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_CDMA2000, DataLength);
+#endif
+    
+    /*** Calculate Partial CRC-8/CDMA2000 Over Data And CRC-8/CDMA2000 ***/
+    for(i = 0; i < DataLength; i++)
+        crc8Cdma2000 = crc_crc8Cdma2000Step(Data[i], crc8Cdma2000);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_CDMA2000, metricsStart);
+#endif
+    
+    return (crc8Cdma2000 == CRC_CRC8_CDMA2000_RESIDUE);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8Cdma2000Forge
+ * BRIEF:   Patch Data So That Its CRC-8/CDMA2000 Equals Target
+ * RETURN:  bool: True If Data Patched
+ * ARG:     data: Data Buffer To Patch
+ * ARG:     DataLength: Length Of Data Buffer
+ * ARG:     Offset: Offset Of 1 Patch Byte (Overwritten)
+ * ARG:     crc8Cdma2000: Current CRC-8/CDMA2000 Of Data (Including Original Patch Bytes)
+ * ARG:     Target: CRC-8/CDMA2000 To Reach
+ * NOTE:    Patch Is Solved Directly In O(log DataLength) From The Current CRC-8/CDMA2000; Data Outside The
+ *          Patch Bytes Is Not Read, So A Wrong Current CRC-8/CDMA2000 Gives A Wrong Patch
+ ****************************************************************************************************/
+bool crc_crc8Cdma2000Forge(uint8_t * const data, const uint16_t DataLength, const uint16_t Offset, const uint8_t crc8Cdma2000, const uint8_t Target)
+{
+    /*** Error Check ***/
+    if((data == NULL) || (DataLength < 1) || (Offset > (DataLength - 1)))
+        return false;
+    
+    /*** Solve Patch Bytes For Target CRC-8/CDMA2000 ***/
+    return crc_genericForge(&crc_crc8Cdma2000Parameters, crc8Cdma2000, Target, (uint32_t)(DataLength - Offset - 1), &data[Offset]);
+}
+#endif
+
+#if defined(CRC_CRC8_DARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DARC_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crc_crc8DarcCalculate
+ * BRIEF:   Calculate Full CRC-8/DARC
+ * RETURN:  uint8_t: CRC-8/DARC
+ * ARG:     Data: Data Buffer To Calculate CRC-8/DARC For
+ * ARG:     DataLength: Length Of Data Buffer
+ ****************************************************************************************************/
+uint8_t crc_crc8DarcCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8Darc = CRC_CRC8_DARC_INITIAL_CRC8_DARC;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength == 0))
+        return CRC_CRC8_DARC_INITIAL_CRC8_DARC;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_DARC, DataLength);
+#endif
+
+    /*** Calculate CRC-8/DARC ***/
+    for(i = 0; i < DataLength; i++)
+        crc8Darc = crc_crc8DarcStep(Data[i], crc8Darc);
+    crc8Darc = crc_crc8DarcFinal(crc8Darc);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_DARC, metricsStart);
+#endif
+
+    return crc8Darc;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8DarcCalculatePartial
+ * BRIEF:   Calculate Partial CRC-8/DARC
+ * RETURN:  uint8_t: Current/Final CRC-8/DARC
+ * ARG:     Data: Data To Add To CRC-8/DARC Calculation
+ * ARG:     crc8Darc: Current CRC-8/DARC
+ * ARG:     Final: Final Data (Unused If CRC_CRC8_DARC_LOOKUP_TABLE_METHOD)
+ * NOTE:    Set CRC-8/DARC Value To CRC_CRC8_DARC_INITIAL_CRC8_DARC If First Data Byte (Data[0]);
+ *          Returned CRC-8/DARC Value Should Be Used On Subsequent Data Bytes (Data[1] ... Data[n])
+ ****************************************************************************************************/
+uint8_t crc_crc8DarcCalculatePartial(const uint8_t Data, uint8_t crc8Darc, const bool Final)
+{
+    /*** Calculate Partial CRC-8/DARC ***/
+    crc8Darc = crc_crc8DarcStep(Data, crc8Darc);
+    
+    /*** Convert To Output Form On Final Data ***/
+    if(Final)
+        crc8Darc = crc_crc8DarcFinal(crc8Darc);
+    
+    return crc8Darc;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8DarcModify
+ * BRIEF:   Update CRC-8/DARC After In-Place Modification Of Data
+ * RETURN:  uint8_t: CRC-8/DARC Of Modified Data
+ * ARG:     crc8Darc: CRC-8/DARC Of Original Data
+ * ARG:     Delta: XOR Of Original And Modified Bytes
+ * ARG:     DeltaLength: Length Of Delta (Number Of Modified Bytes)
+ * ARG:     Distance: Number Of Bytes From End Of Modified Range To End Of Data
+ * NOTE:    Runs In O(DeltaLength + log Distance) Regardless Of Data Length
+ ****************************************************************************************************/
+uint8_t crc_crc8DarcModify(uint8_t crc8Darc, const uint8_t * const Delta, const uint16_t DeltaLength, const uint32_t Distance)
+{
+    /*** Error Check ***/
+    if((Delta == NULL) || (DeltaLength == 0))
+        return crc8Darc;
+    
+    /*** Update CRC-8/DARC ***/
+    crc8Darc ^= (uint8_t)crc_genericDelta(&crc_crc8DarcParameters, Delta, DeltaLength, Distance);
+    
+    return crc8Darc;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8DarcModifyBatch
+ * BRIEF:   Update CRC-8/DARC After In-Place Modification Of Data (Multiple Patches)
+ * RETURN:  uint8_t: CRC-8/DARC Of Modified Data
+ * ARG:     crc8Darc: CRC-8/DARC Of Original Data
+ * ARG:     Patch: Patch List (Patches May Be In Any Order)
+ * ARG:     PatchCount: Number Of Patches In Patch List
+ * ARG:     DataLength: Length Of Data
+ * NOTE:    Patches Extending Beyond DataLength Are Ignored
+ ****************************************************************************************************/
+uint8_t crc_crc8DarcModifyBatch(uint8_t crc8Darc, const crc_patch_t * const Patch, const uint16_t PatchCount, const uint32_t DataLength)
+{
+    uint16_t i;
+    
+    /*** Error Check ***/
+    if(Patch == NULL)
+        return crc8Darc;
+    
+    /*** Update CRC-8/DARC For Each Patch ***/
+    for(i = 0; i < PatchCount; i++)
+    {
+        if((Patch[i].delta == NULL) || (Patch[i].offset > DataLength) || (Patch[i].length > (DataLength - Patch[i].offset)))
+            continue;
+        crc8Darc = crc_crc8DarcModify(crc8Darc, Patch[i].delta, Patch[i].length, DataLength - Patch[i].offset - Patch[i].length);
+    }
+    
+    return crc8Darc;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8DarcRollingInitialize
+ * BRIEF:   Initialize Rolling (Sliding Window) CRC-8/DARC
+ * RETURN:  bool: Success Or Failure Status
+ * ARG:     Rolling: Rolling Context To Initialize
+ * ARG:     WindowLength: Length Of Sliding Window
+ * NOTE:    Precomputes Tables For WindowLength; Context Can Then Be Shared By Any Number Of Streams
+ ****************************************************************************************************/
+bool crc_crc8DarcRollingInitialize(crc_rolling_t * const Rolling, const uint16_t WindowLength)
+{
+    /*** Error Check ***/
+    if((Rolling == NULL) || (WindowLength == 0))
+        return false;
+    
+    /*** Initialize Rolling CRC-8/DARC ***/
+    crc_genericRollingInitialize(&crc_crc8DarcParameters, Rolling, WindowLength);
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8DarcRollingUpdate
+ * BRIEF:   Slide Rolling CRC-8/DARC Window Forward One Byte
+ * RETURN:  uint8_t: CRC-8/DARC Of New Window
+ * ARG:     Rolling: Rolling Context (Initialized By crc_crc8DarcRollingInitialize)
+ * ARG:     Out: Data Leaving Window (Oldest Byte)
+ * ARG:     In: Data Entering Window
+ * ARG:     crc8Darc: CRC-8/DARC Of Current Window
+ * NOTE:    Seed With crc_crc8DarcCalculate Of First Window; Runs In O(1) Regardless Of Window Length
+ ****************************************************************************************************/
+uint8_t crc_crc8DarcRollingUpdate(const crc_rolling_t * const Rolling, const uint8_t Out, const uint8_t In, const uint8_t crc8Darc)
+{
+    /*** Error Check ***/
+    if(Rolling == NULL)
+        return crc8Darc;
+    
+    /*** Slide Window ***/
+    return (uint8_t)crc_genericRollingUpdate(Rolling, Out, In, crc8Darc);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8DarcStripPrefix
+ * BRIEF:   Remove Known Prefix From CRC-8/DARC
+ * RETURN:  uint8_t: CRC-8/DARC Of Data Following Prefix
+ * ARG:     crc8Darc: CRC-8/DARC Of Prefix Followed By Suffix
+ * ARG:     Prefix: Prefix Data Buffer
+ * ARG:     PrefixLength: Length Of Prefix Data Buffer
+ * ARG:     SuffixLength: Length Of Data Following Prefix
+ * NOTE:    Runs In O(PrefixLength + log SuffixLength); Suffix Data Is Not Needed
+ ****************************************************************************************************/
+uint8_t crc_crc8DarcStripPrefix(uint8_t crc8Darc, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength)
+{
+    uint8_t crc8DarcPrefix = CRC_CRC8_DARC_INITIAL_CRC8_DARC;
+    uint32_t i;
+    
+    /*** Error Check ***/
+    if((Prefix == NULL) || (PrefixLength == 0))
+        return crc8Darc;
+    else if(SuffixLength == 0)
+        return CRC_CRC8_DARC_INITIAL_CRC8_DARC;
+    
+    /*** Calculate CRC-8/DARC Of Prefix ***/
+    for(i = 0; i < PrefixLength; i++)
+        crc8DarcPrefix = crc_crc8DarcStep(Prefix[i], crc8DarcPrefix);
+    crc8DarcPrefix = crc_crc8DarcFinal(crc8DarcPrefix);
+    
+    /*** Strip Prefix ***/
+    crc8Darc = (uint8_t)crc_genericStripPrefix(&crc_crc8DarcParameters, crc8Darc, crc8DarcPrefix, SuffixLength);
+    
+    return crc8Darc;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8DarcUnwind
+ * BRIEF:   Run CRC-8/DARC Backward Over Known Trailing Data
+ * RETURN:  uint8_t: CRC-8/DARC Of Data Preceding Trailing Data
+ * ARG:     crc8Darc: CRC-8/DARC Of Data Including Trailing Data
+ * ARG:     Data: Trailing Data Buffer
+ * ARG:     DataLength: Length Of Trailing Data Buffer
+ ****************************************************************************************************/
+uint8_t crc_crc8DarcUnwind(uint8_t crc8Darc, const uint8_t * const Data, const uint16_t DataLength)
+{
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength == 0))
+        return crc8Darc;
+    
+    /*** Unwind CRC-8/DARC ***/
+    crc8Darc = (uint8_t)crc_genericUnwind(&crc_crc8DarcParameters, crc8Darc, Data, DataLength);
+    
+    return crc8Darc;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8DarcPrefixInitialize
+ * BRIEF:   Precompute CRC-8/DARC State After Constant Prefix
+ * RETURN:  bool: True If Prefix State Computed
+ * ARG:     prefix: Prefix State
+ * ARG:     Data: Prefix Data Buffer (May Be NULL If DataLength Is Zero)
+ * ARG:     DataLength: Length Of Prefix Data Buffer
+ * NOTE:    The State Is Kept In The Same Form CalculatePartial Passes Between Bytes, Not As A
+ *          Finished CRC, So Resuming From It Is Exact For Every Method
+ ****************************************************************************************************/
+bool crc_crc8DarcPrefixInitialize(crc_prefix_t * const prefix, const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8Darc = CRC_CRC8_DARC_INITIAL_CRC8_DARC;
+    uint32_t i;
+    
+    /*** Error Check ***/
+    if((prefix == NULL) || ((Data == NULL) && (DataLength != 0)))
+        return false;
+    
+    /*** Calculate CRC-8/DARC State Of Prefix; Finish It For CRC Of Prefix ***/
+    for(i = 0; i < DataLength; i++)
+        crc8Darc = crc_crc8DarcStep(Data[i], crc8Darc);
+    prefix->state = crc8Darc;
+    prefix->crc = (DataLength == 0) ? CRC_CRC8_DARC_INITIAL_CRC8_DARC : crc_crc8DarcFinal(crc8Darc);
+    
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8DarcPrefixCalculate
+ * BRIEF:   Calculate Full CRC-8/DARC Of Constant Prefix Followed By Data
+ * RETURN:  uint8_t: CRC-8/DARC
+ * ARG:     Prefix: Prefix State From crc_crc8DarcPrefixInitialize
+ * ARG:     Data: Data Buffer Following Prefix
+ * ARG:     DataLength: Length Of Data Buffer
+ * NOTE:    Only Data Is Processed; The Prefix Contribution Is Reused
+ ****************************************************************************************************/
+uint8_t crc_crc8DarcPrefixCalculate(const crc_prefix_t * const Prefix, const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8Darc;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if(Prefix == NULL)
+        return CRC_CRC8_DARC_INITIAL_CRC8_DARC;
+    if((Data == NULL) || (DataLength == 0))
+        return (uint8_t)Prefix->crc;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_DARC, DataLength);
+#endif
+    
+    /*** Resume CRC-8/DARC From Prefix State ***/
+    crc8Darc = (uint8_t)Prefix->state;
+    for(i = 0; i < DataLength; i++)
+        crc8Darc = crc_crc8DarcStep(Data[i], crc8Darc);
+    crc8Darc = crc_crc8DarcFinal(crc8Darc);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_DARC, metricsStart);
+#endif
+    
+    return crc8Darc;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8DarcCalculateMasked
+ * BRIEF:   Calculate Full CRC-8/DARC With Masked Ranges Treated As Zero
+ * RETURN:  uint8_t: CRC-8/DARC
+ * ARG:     Data: Data Buffer To Calculate CRC-8/DARC For
+ * ARG:     DataLength: Length Of Data Buffer
+ * ARG:     Mask: Masked Range List (Sorted By Offset; Ranges Beyond DataLength Are Clipped)
+ * ARG:     MaskCount: Number Of Masked Ranges In Masked Range List
+ * NOTE:    Data Is Not Copied Or Modified; Each Masked Range Costs O(log Length) With No Per-Byte Work
+ ****************************************************************************************************/
+uint8_t crc_crc8DarcCalculateMasked(const uint8_t * const Data, const uint16_t DataLength, const crc_mask_t * const Mask, const uint16_t MaskCount)
+{
+    uint8_t crc8Darc = CRC_CRC8_DARC_INITIAL_CRC8_DARC;
+    uint32_t end, i = 0, m, start;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength == 0) || ((Mask == NULL) && (MaskCount != 0)))
+        return CRC_CRC8_DARC_INITIAL_CRC8_DARC;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_DARC, DataLength);
+#endif
+    
+    /*** Calculate CRC-8/DARC Up To Each Masked Range; Shift Over Masked Range ***/
+    for(m = 0; m < MaskCount; m++)
+    {
+        start = (Mask[m].offset > i) ? Mask[m].offset : i;
+        end = (uint32_t)Mask[m].offset + Mask[m].length;
+        if(end > DataLength)
+            end = DataLength;
+        if(end <= start)
+            continue;
+        for(; i < start; i++)
+            crc8Darc = crc_crc8DarcStep(Data[i], crc8Darc);
+        crc8Darc = (uint8_t)crc_genericShiftState(&crc_crc8DarcParameters, crc8Darc, end - start);
+        i = end;
+    }
+    
+    /*** Calculate CRC-8/DARC After Final Masked Range ***/
+    for(; i < DataLength; i++)
+        crc8Darc = crc_crc8DarcStep(Data[i], crc8Darc);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_DARC, metricsStart);
+#endif
+    
+    return (uint8_t)crc_genericCrcFromState(&crc_crc8DarcParameters, crc8Darc);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8DarcCalculateBits
+ * BRIEF:   Calculate Full CRC-8/DARC Over Bit-Granular Data
+ * RETURN:  uint8_t: CRC-8/DARC
+ * ARG:     Data: Data Buffer To Calculate CRC-8/DARC For
+ * ARG:     BitOffset: Offset Of First Bit (Bits Within Byte In Transmission Order: Least Significant Bit First)
+ * ARG:     BitLength: Number Of Bits (BitOffset + BitLength Must Not Exceed UINT32_MAX)
+ * NOTE:    Whole Bytes Use The Byte-Wise Method; Only Leading And Trailing Partial Bytes Are Bitwise
+ ****************************************************************************************************/
+uint8_t crc_crc8DarcCalculateBits(const uint8_t * const Data, const uint32_t BitOffset, const uint32_t BitLength)
+{
+    uint8_t crc8Darc = CRC_CRC8_DARC_INITIAL_CRC8_DARC;
+    uint8_t count;
+    uint32_t bit, end;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((Data == NULL) || (BitLength == 0) || (BitLength > (UINT32_MAX - BitOffset)))
+        return CRC_CRC8_DARC_INITIAL_CRC8_DARC;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_DARC, ((BitLength - 1) / 8) + 1);
+#endif
+    
+    /*** Set Up ***/
+    bit = BitOffset;
+    end = BitOffset + BitLength;
+    
+    /*** Calculate CRC-8/DARC Over Leading Bits (Up To Byte Boundary) ***/
+    if((bit & 0x07) != 0)
+    {
+        count = (uint8_t)(8 - (bit & 0x07));
+        if(count > (end - bit))
+            count = (uint8_t)(end - bit);
+        crc8Darc = (uint8_t)crc_genericUpdateBits(&crc_crc8DarcParameters, crc8Darc, Data[bit >> 3], (uint8_t)(bit & 0x07), count);
+        bit += count;
+    }
+    
+    /*** Calculate CRC-8/DARC Over Whole Bytes ***/
+    for(; (end - bit) >= 8; bit += 8)
+        crc8Darc = crc_crc8DarcStep(Data[bit >> 3], crc8Darc);
+    
+    /*** Calculate CRC-8/DARC Over Trailing Bits ***/
+    if(bit < end)
+        crc8Darc = (uint8_t)crc_genericUpdateBits(&crc_crc8DarcParameters, crc8Darc, Data[bit >> 3], 0, (uint8_t)(end - bit));
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_DARC, metricsStart);
+#endif
+    
+    return (uint8_t)crc_genericCrcFromState(&crc_crc8DarcParameters, crc8Darc);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8DarcCalculatePartialBits
+ * BRIEF:   Calculate Partial CRC-8/DARC Over Bit-Granular Data
+ * RETURN:  uint8_t: Current/Final CRC-8/DARC
+ * ARG:     Data: Data Byte Containing Bits (First Bits In Transmission Order: Least Significant Bit First)
+ * ARG:     BitLength: Number Of Bits (1 ... 8)
+ * ARG:     crc8Darc: Current CRC-8/DARC
+ * ARG:     Final: Final Data
+ * NOTE:    Set CRC-8/DARC Value To CRC_CRC8_DARC_INITIAL_CRC8_DARC If First Data Bits;
+ *          Returned CRC-8/DARC Value Should Be Used On Subsequent Data Bits; May Be Mixed With
+ *          crc_crc8DarcCalculatePartial For Whole Bytes
+ ****************************************************************************************************/
+uint8_t crc_crc8DarcCalculatePartialBits(const uint8_t Data, const uint8_t BitLength, uint8_t crc8Darc, const bool Final)
+{
+    /*** Error Check ***/
+    if(BitLength == 0)
+        return crc8Darc;
+    else if(BitLength >= 8)
+        return crc_crc8DarcCalculatePartial(Data, crc8Darc, Final);
+    
+    /*** Calculate Partial CRC-8/DARC ***/
+    crc8Darc = (uint8_t)crc_genericUpdateBits(&crc_crc8DarcParameters, crc8Darc, Data, 0, BitLength);
+    
+    /*** Convert To CRC-8/DARC On Final Data ***/
+    if(Final)
+        crc8Darc = (uint8_t)crc_genericCrcFromState(&crc_crc8DarcParameters, crc8Darc);
+    
+    return crc8Darc;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8DarcVerify
+ * BRIEF:   Verify Data Followed By Its CRC-8/DARC
+ * RETURN:  bool: True If CRC-8/DARC Matches
+ * ARG:     Data: Data Buffer With CRC-8/DARC In Trailing Byte
+ * ARG:     DataLength: Length Of Data Buffer Including CRC-8/DARC
+ * NOTE:    Runs Over Data And CRC-8/DARC In One Pass And Compares Against The Residue Constant
+ ****************************************************************************************************/
+bool crc_crc8DarcVerify(const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8Darc = CRC_CRC8_DARC_INITIAL_CRC8_DARC;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength < 1))
+        return false;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_DARC, DataLength);
+#endif
+    
+    /*** Calculate Partial CRC-8/DARC Over Data And CRC-8/DARC ***/
+    for(i = 0; i < DataLength; i++)
+        crc8Darc = crc_crc8DarcStep(Data[i], crc8Darc);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_DARC, metricsStart);
+#endif
+    
+    return (crc8Darc == CRC_CRC8_DARC_RESIDUE);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8DarcForge
+ * BRIEF:   Patch Data So That Its CRC-8/DARC Equals Target
+ * RETURN:  bool: True If Data Patched
+ * ARG:     data: Data Buffer To Patch
+ * ARG:     DataLength: Length Of Data Buffer
+ * ARG:     Offset: Offset Of 1 Patch Byte (Overwritten)
+ * ARG:     crc8Darc: Current CRC-8/DARC Of Data (Including Original Patch Bytes)
+ * ARG:     Target: CRC-8/DARC To Reach
+ * NOTE:    Patch Is Solved Directly In O(log DataLength) From The Current CRC-8/DARC; Data Outside The
+ *          Patch Bytes Is Not Read, So A Wrong Current CRC-8/DARC Gives A Wrong Patch
+ ****************************************************************************************************/
+bool crc_crc8DarcForge(uint8_t * const data, const uint16_t DataLength, const uint16_t Offset, const uint8_t crc8Darc, const uint8_t Target)
+{
+    /*** Error Check ***/
+    if((data == NULL) || (DataLength < 1) || (Offset > (DataLength - 1)))
+        return false;
+    
+    /*** Solve Patch Bytes For Target CRC-8/DARC ***/
+    return crc_genericForge(&crc_crc8DarcParameters, crc8Darc, Target, (uint32_t)(DataLength - Offset - 1), &data[Offset]);
+}
+#endif
+
+#if defined(CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DVB_S2_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crc_crc8DvbS2Calculate
+ * BRIEF:   Calculate Full CRC-8/DVB-S2
+ * RETURN:  uint8_t: CRC-8/DVB-S2
+ * ARG:     Data: Data Buffer To Calculate CRC-8/DVB-S2 For
+ * ARG:     DataLength: Length Of Data Buffer
+ ****************************************************************************************************/
+uint8_t crc_crc8DvbS2Calculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8DvbS2 = CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength == 0))
+        return CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_DVB_S2, DataLength);
+#endif
+
+    /*** Calculate Full CRC-8/DVB-S2 ***/
+#ifdef CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD
+    if(DataLength == CRC_CRC8_DVB_S2_BBHEADER_LENGTH)
+        crc8DvbS2 = crc_crc8DvbS2CalculateBbHeader(Data);
+    else if(DataLength == CRC_CRC8_DVB_S2_TS_PACKET_LENGTH)
+        crc8DvbS2 = crc_crc8DvbS2CalculateTsPacket(Data);
+    else
+#endif
+    {
+        for(i = 0; i < DataLength; i++)
+            crc8DvbS2 = crc_crc8DvbS2Step(Data[i], crc8DvbS2);
+    }
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_DVB_S2, metricsStart);
+#endif
+
+    return crc8DvbS2;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8DvbS2CalculatePartial
+ * BRIEF:   Calculate Partial CRC-8/DVB-S2
+ * RETURN:  uint8_t: Current/Final CRC-8/DVB-S2
+ * ARG:     Data: Data To Add To CRC-8/DVB-S2 Calculation
+ * ARG:     crc8DvbS2: Current CRC-8/DVB-S2
+ * NOTE:    Set CRC-8/DVB-S2 Value To CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2 If First Data Byte
+ *          (Data[0]); Returned CRC-8/DVB-S2 Value Should Be Used On Subsequent Data Bytes
+ *          (Data[1] ... Data[n])
+ ****************************************************************************************************/
+uint8_t crc_crc8DvbS2CalculatePartial(const uint8_t Data, uint8_t crc8DvbS2)
+{
+    /*** Calculate Partial CRC-8/DVB-S2 ***/
+    crc8DvbS2 = crc_crc8DvbS2Step(Data, crc8DvbS2);
+    
+    return crc8DvbS2;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8DvbS2Modify
+ * BRIEF:   Update CRC-8/DVB-S2 After In-Place Modification Of Data
+ * RETURN:  uint8_t: CRC-8/DVB-S2 Of Modified Data
+ * ARG:     crc8DvbS2: CRC-8/DVB-S2 Of Original Data
+ * ARG:     Delta: XOR Of Original And Modified Bytes
+ * ARG:     DeltaLength: Length Of Delta (Number Of Modified Bytes)
+ * ARG:     Distance: Number Of Bytes From End Of Modified Range To End Of Data
+ * NOTE:    Runs In O(DeltaLength + log Distance) Regardless Of Data Length
+ ****************************************************************************************************/
+uint8_t crc_crc8DvbS2Modify(uint8_t crc8DvbS2, const uint8_t * const Delta, const uint16_t DeltaLength, const uint32_t Distance)
+{
+    /*** Error Check ***/
+    if((Delta == NULL) || (DeltaLength == 0))
+        return crc8DvbS2;
+    
+    /*** Update CRC-8/DVB-S2 ***/
+    crc8DvbS2 ^= (uint8_t)crc_genericDelta(&crc_crc8DvbS2Parameters, Delta, DeltaLength, Distance);
+    
+    return crc8DvbS2;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8DvbS2ModifyBatch
+ * BRIEF:   Update CRC-8/DVB-S2 After In-Place Modification Of Data (Multiple Patches)
+ * RETURN:  uint8_t: CRC-8/DVB-S2 Of Modified Data
+ * ARG:     crc8DvbS2: CRC-8/DVB-S2 Of Original Data
+ * ARG:     Patch: Patch List (Patches May Be In Any Order)
+ * ARG:     PatchCount: Number Of Patches In Patch List
+ * ARG:     DataLength: Length Of Data
+ * NOTE:    Patches Extending Beyond DataLength Are Ignored
+ ****************************************************************************************************/
+uint8_t crc_crc8DvbS2ModifyBatch(uint8_t crc8DvbS2, const crc_patch_t * const Patch, const uint16_t PatchCount, const uint32_t DataLength)
+{
+    uint16_t i;
+    
+    /*** Error Check ***/
+    if(Patch == NULL)
+        return crc8DvbS2;
+    
+    /*** Update CRC-8/DVB-S2 For Each Patch ***/
+    for(i = 0; i < PatchCount; i++)
+    {
+        if((Patch[i].delta == NULL) || (Patch[i].offset > DataLength) || (Patch[i].length > (DataLength - Patch[i].offset)))
+            continue;
+        crc8DvbS2 = crc_crc8DvbS2Modify(crc8DvbS2, Patch[i].delta, Patch[i].length, DataLength - Patch[i].offset - Patch[i].length);
+    }
+    
+    return crc8DvbS2;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8DvbS2RollingInitialize
+ * BRIEF:   Initialize Rolling (Sliding Window) CRC-8/DVB-S2
+ * RETURN:  bool: Success Or Failure Status
+ * ARG:     Rolling: Rolling Context To Initialize
+ * ARG:     WindowLength: Length Of Sliding Window
+ * NOTE:    Precomputes Tables For WindowLength; Context Can Then Be Shared By Any Number Of Streams
+ ****************************************************************************************************/
+bool crc_crc8DvbS2RollingInitialize(crc_rolling_t * const Rolling, const uint16_t WindowLength)
+{
+    /*** Error Check ***/
+    if((Rolling == NULL) || (WindowLength == 0))
+        return false;
+    
+    /*** Initialize Rolling CRC-8/DVB-S2 ***/
+    crc_genericRollingInitialize(&crc_crc8DvbS2Parameters, Rolling, WindowLength);
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8DvbS2RollingUpdate
+ * BRIEF:   Slide Rolling CRC-8/DVB-S2 Window Forward One Byte
+ * RETURN:  uint8_t: CRC-8/DVB-S2 Of New Window
+ * ARG:     Rolling: Rolling Context (Initialized By crc_crc8DvbS2RollingInitialize)
+ * ARG:     Out: Data Leaving Window (Oldest Byte)
+ * ARG:     In: Data Entering Window
+ * ARG:     crc8DvbS2: CRC-8/DVB-S2 Of Current Window
+ * NOTE:    Seed With crc_crc8DvbS2Calculate Of First Window; Runs In O(1) Regardless Of Window Length
+ ****************************************************************************************************/
+uint8_t crc_crc8DvbS2RollingUpdate(const crc_rolling_t * const Rolling, const uint8_t Out, const uint8_t In, const uint8_t crc8DvbS2)
+{
+    /*** Error Check ***/
+    if(Rolling == NULL)
+        return crc8DvbS2;
+    
+    /*** Slide Window ***/
+    return (uint8_t)crc_genericRollingUpdate(Rolling, Out, In, crc8DvbS2);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8DvbS2StripPrefix
+ * BRIEF:   Remove Known Prefix From CRC-8/DVB-S2
+ * RETURN:  uint8_t: CRC-8/DVB-S2 Of Data Following Prefix
+ * ARG:     crc8DvbS2: CRC-8/DVB-S2 Of Prefix Followed By Suffix
+ * ARG:     Prefix: Prefix Data Buffer
+ * ARG:     PrefixLength: Length Of Prefix Data Buffer
+ * ARG:     SuffixLength: Length Of Data Following Prefix
+ * NOTE:    Runs In O(PrefixLength + log SuffixLength); Suffix Data Is Not Needed
+ ****************************************************************************************************/
+uint8_t crc_crc8DvbS2StripPrefix(uint8_t crc8DvbS2, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength)
+{
+    uint8_t crc8DvbS2Prefix = CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2;
+    uint32_t i;
+    
+    /*** Error Check ***/
+    if((Prefix == NULL) || (PrefixLength == 0))
+        return crc8DvbS2;
+    else if(SuffixLength == 0)
+        return CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2;
+    
+    /*** Calculate CRC-8/DVB-S2 Of Prefix ***/
+    for(i = 0; i < PrefixLength; i++)
+        crc8DvbS2Prefix = crc_crc8DvbS2Step(Prefix[i], crc8DvbS2Prefix);
+    
+    /*** Strip Prefix ***/
+    crc8DvbS2 = (uint8_t)crc_genericStripPrefix(&crc_crc8DvbS2Parameters, crc8DvbS2, crc8DvbS2Prefix, SuffixLength);
+    
+    return crc8DvbS2;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8DvbS2Unwind
+ * BRIEF:   Run CRC-8/DVB-S2 Backward Over Known Trailing Data
+ * RETURN:  uint8_t: CRC-8/DVB-S2 Of Data Preceding Trailing Data
+ * ARG:     crc8DvbS2: CRC-8/DVB-S2 Of Data Including Trailing Data
+ * ARG:     Data: Trailing Data Buffer
+ * ARG:     DataLength: Length Of Trailing Data Buffer
+ ****************************************************************************************************/
+uint8_t crc_crc8DvbS2Unwind(uint8_t crc8DvbS2, const uint8_t * const Data, const uint16_t DataLength)
+{
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength == 0))
+        return crc8DvbS2;
+    
+    /*** Unwind CRC-8/DVB-S2 ***/
+    crc8DvbS2 = (uint8_t)crc_genericUnwind(&crc_crc8DvbS2Parameters, crc8DvbS2, Data, DataLength);
+    
+    return crc8DvbS2;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8DvbS2PrefixInitialize
+ * BRIEF:   Precompute CRC-8/DVB-S2 State After Constant Prefix
+ * RETURN:  bool: True If Prefix State Computed
+ * ARG:     prefix: Prefix State
+ * ARG:     Data: Prefix Data Buffer (May Be NULL If DataLength Is Zero)
+ * ARG:     DataLength: Length Of Prefix Data Buffer
+ * NOTE:    The State Is Kept In The Same Form CalculatePartial Passes Between Bytes, Not As A
+ *          Finished CRC, So Resuming From It Is Exact For Every Method
+ ****************************************************************************************************/
+bool crc_crc8DvbS2PrefixInitialize(crc_prefix_t * const prefix, const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8DvbS2 = CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2;
+    uint32_t i;
+    
+    /*** Error Check ***/
+    if((prefix == NULL) || ((Data == NULL) && (DataLength != 0)))
+        return false;
+    
+    /*** Calculate CRC-8/DVB-S2 State Of Prefix; Finish It For CRC Of Prefix ***/
+    for(i = 0; i < DataLength; i++)
+        crc8DvbS2 = crc_crc8DvbS2Step(Data[i], crc8DvbS2);
+    prefix->state = crc8DvbS2;
+    prefix->crc = crc8DvbS2;
+    
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8DvbS2PrefixCalculate
+ * BRIEF:   Calculate Full CRC-8/DVB-S2 Of Constant Prefix Followed By Data
+ * RETURN:  uint8_t: CRC-8/DVB-S2
+ * ARG:     Prefix: Prefix State From crc_crc8DvbS2PrefixInitialize
+ * ARG:     Data: Data Buffer Following Prefix
+ * ARG:     DataLength: Length Of Data Buffer
+ * NOTE:    Only Data Is Processed; The Prefix Contribution Is Reused
+ ****************************************************************************************************/
+uint8_t crc_crc8DvbS2PrefixCalculate(const crc_prefix_t * const Prefix, const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8DvbS2;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if(Prefix == NULL)
+        return CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2;
+    if((Data == NULL) || (DataLength == 0))
+        return (uint8_t)Prefix->crc;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_DVB_S2, DataLength);
+#endif
+    
+    /*** Resume CRC-8/DVB-S2 From Prefix State ***/
+    crc8DvbS2 = (uint8_t)Prefix->state;
+    for(i = 0; i < DataLength; i++)
+        crc8DvbS2 = crc_crc8DvbS2Step(Data[i], crc8DvbS2);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_DVB_S2, metricsStart);
+#endif
+    
+    return crc8DvbS2;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8DvbS2CalculateMasked
+ * BRIEF:   Calculate Full CRC-8/DVB-S2 With Masked Ranges Treated As Zero
+ * RETURN:  uint8_t: CRC-8/DVB-S2
+ * ARG:     Data: Data Buffer To Calculate CRC-8/DVB-S2 For
+ * ARG:     DataLength: Length Of Data Buffer
+ * ARG:     Mask: Masked Range List (Sorted By Offset; Ranges Beyond DataLength Are Clipped)
+ * ARG:     MaskCount: Number Of Masked Ranges In Masked Range List
+ * NOTE:    Data Is Not Copied Or Modified; Each Masked Range Costs O(log Length) With No Per-Byte Work
+ ****************************************************************************************************/
+uint8_t crc_crc8DvbS2CalculateMasked(const uint8_t * const Data, const uint16_t DataLength, const crc_mask_t * const Mask, const uint16_t MaskCount)
+{
+    uint8_t crc8DvbS2 = CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2;
+    uint32_t end, i = 0, m, start;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength == 0) || ((Mask == NULL) && (MaskCount != 0)))
+        return CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_DVB_S2, DataLength);
+#endif
+    
+    /*** Calculate CRC-8/DVB-S2 Up To Each Masked Range; Shift Over Masked Range ***/
+    for(m = 0; m < MaskCount; m++)
+    {
+        start = (Mask[m].offset > i) ? Mask[m].offset : i;
+        end = (uint32_t)Mask[m].offset + Mask[m].length;
+        if(end > DataLength)
+            end = DataLength;
+        if(end <= start)
+            continue;
+        for(; i < start; i++)
+            crc8DvbS2 = crc_crc8DvbS2Step(Data[i], crc8DvbS2);
+        crc8DvbS2 = (uint8_t)crc_genericShiftState(&crc_crc8DvbS2Parameters, crc8DvbS2, end - start);
+        i = end;
+    }
+    
+    /*** Calculate CRC-8/DVB-S2 After Final Masked Range ***/
+    for(; i < DataLength; i++)
+        crc8DvbS2 = crc_crc8DvbS2Step(Data[i], crc8DvbS2);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_DVB_S2, metricsStart);
+#endif
+    
+    return (uint8_t)crc_genericCrcFromState(&crc_crc8DvbS2Parameters, crc8DvbS2);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8DvbS2CalculateBits
+ * BRIEF:   Calculate Full CRC-8/DVB-S2 Over Bit-Granular Data
+ * RETURN:  uint8_t: CRC-8/DVB-S2
+ * ARG:     Data: Data Buffer To Calculate CRC-8/DVB-S2 For
+ * ARG:     BitOffset: Offset Of First Bit (Bits Within Byte In Transmission Order: Most Significant Bit First)
+ * ARG:     BitLength: Number Of Bits (BitOffset + BitLength Must Not Exceed UINT32_MAX)
+ * NOTE:    Whole Bytes Use The Byte-Wise Method; Only Leading And Trailing Partial Bytes Are Bitwise
+ ****************************************************************************************************/
+uint8_t crc_crc8DvbS2CalculateBits(const uint8_t * const Data, const uint32_t BitOffset, const uint32_t BitLength)
+{
+    uint8_t crc8DvbS2 = CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2;
+    uint8_t count;
+    uint32_t bit, end;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((Data == NULL) || (BitLength == 0) || (BitLength > (UINT32_MAX - BitOffset)))
+        return CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_DVB_S2, ((BitLength - 1) / 8) + 1);
+#endif
+    
+    /*** Set Up ***/
+    bit = BitOffset;
+    end = BitOffset + BitLength;
+    
+    /*** Calculate CRC-8/DVB-S2 Over Leading Bits (Up To Byte Boundary) ***/
+    if((bit & 0x07) != 0)
+    {
+        count = (uint8_t)(8 - (bit & 0x07));
+        if(count > (end - bit))
+            count = (uint8_t)(end - bit);
+        crc8DvbS2 = (uint8_t)crc_genericUpdateBits(&crc_crc8DvbS2Parameters, crc8DvbS2, Data[bit >> 3], (uint8_t)(bit & 0x07), count);
+        bit += count;
+    }
+    
+    /*** Calculate CRC-8/DVB-S2 Over Whole Bytes ***/
+    for(; (end - bit) >= 8; bit += 8)
+        crc8DvbS2 = crc_crc8DvbS2Step(Data[bit >> 3], crc8DvbS2);
+    
+    /*** Calculate CRC-8/DVB-S2 Over Trailing Bits ***/
+    if(bit < end)
+        crc8DvbS2 = (uint8_t)crc_genericUpdateBits(&crc_crc8DvbS2Parameters, crc8DvbS2, Data[bit >> 3], 0, (uint8_t)(end - bit));
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_DVB_S2, metricsStart);
+#endif
+    return (uint8_t)crc_genericCrcFromState(&crc_crc8DvbS2Parameters, crc8DvbS2);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8DvbS2CalculatePartialBits
+ * BRIEF:   Calculate Partial CRC-8/DVB-S2 Over Bit-Granular Data
+ * RETURN:  uint8_t: Current/Final CRC-8/DVB-S2
+ * ARG:     Data: Data Byte Containing Bits (First Bits In Transmission Order: Most Significant Bit First)
+ * ARG:     BitLength: Number Of Bits (1 ... 8)
+ * ARG:     crc8DvbS2: Current CRC-8/DVB-S2
+ * NOTE:    Set CRC-8/DVB-S2 Value To CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2 If First Data Bits;
+ *          Returned CRC-8/DVB-S2 Value Should Be Used On Subsequent Data Bits; May Be Mixed With
+ *          crc_crc8DvbS2CalculatePartial For Whole Bytes
+ ****************************************************************************************************/
+uint8_t crc_crc8DvbS2CalculatePartialBits(const uint8_t Data, const uint8_t BitLength, uint8_t crc8DvbS2)
+{
+    /*** Error Check ***/
+    if(BitLength == 0)
+        return crc8DvbS2;
+    else if(BitLength >= 8)
+        return crc_crc8DvbS2Step(Data, crc8DvbS2);
+    
+    /*** Calculate Partial CRC-8/DVB-S2 ***/
+    crc8DvbS2 = (uint8_t)crc_genericUpdateBits(&crc_crc8DvbS2Parameters, crc8DvbS2, Data, 0, BitLength);
+    return crc8DvbS2;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8DvbS2Verify
+ * BRIEF:   Verify Data Followed By Its CRC-8/DVB-S2
+ * RETURN:  bool: True If CRC-8/DVB-S2 Matches
+ * ARG:     Data: Data Buffer With CRC-8/DVB-S2 In Trailing Byte
+ * ARG:     DataLength: Length Of Data Buffer Including CRC-8/DVB-S2
+ * NOTE:    Runs Over Data And CRC-8/DVB-S2 In One Pass And Compares Against The Residue Constant
+ ****************************************************************************************************/
+bool crc_crc8DvbS2Verify(const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8DvbS2 = CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength < 1))
+        return false;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_DVB_S2, DataLength);
+#endif
+    
+    /*** Calculate Partial CRC-8/DVB-S2 Over Data And CRC-8/DVB-S2 ***/
+    for(i = 0; i < DataLength; i++)
+        crc8DvbS2 = crc_crc8DvbS2Step(Data[i], crc8DvbS2);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_DVB_S2, metricsStart);
+#endif
+    
+    return (crc8DvbS2 == CRC_CRC8_DVB_S2_RESIDUE);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8DvbS2Forge
+ * BRIEF:   Patch Data So That Its CRC-8/DVB-S2 Equals Target
+ * RETURN:  bool: True If Data Patched
+ * ARG:     data: Data Buffer To Patch
+ * ARG:     DataLength: Length Of Data Buffer
+ * ARG:     Offset: Offset Of 1 Patch Byte (Overwritten)
+ * ARG:     crc8DvbS2: Current CRC-8/DVB-S2 Of Data (Including Original Patch Bytes)
+ * ARG:     Target: CRC-8/DVB-S2 To Reach
+ * NOTE:    Patch Is Solved Directly In O(log DataLength) From The Current CRC-8/DVB-S2; Data Outside The
+ *          Patch Bytes Is Not Read, So A Wrong Current CRC-8/DVB-S2 Gives A Wrong Patch
+ ****************************************************************************************************/
+bool crc_crc8DvbS2Forge(uint8_t * const data, const uint16_t DataLength, const uint16_t Offset, const uint8_t crc8DvbS2, const uint8_t Target)
+{
+    /*** Error Check ***/
+    if((data == NULL) || (DataLength < 1) || (Offset > (DataLength - 1)))
+        return false;
+    
+    /*** Solve Patch Bytes For Target CRC-8/DVB-S2 ***/
+    return crc_genericForge(&crc_crc8DvbS2Parameters, crc8DvbS2, Target, (uint32_t)(DataLength - Offset - 1), &data[Offset]);
+}
+#endif
+
+#if defined(CRC_CRC8_EBU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_EBU_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crc_crc8EbuCalculate
+ * BRIEF:   Calculate Full CRC-8/EBU
+ * RETURN:  uint8_t: CRC-8/EBU
+ * ARG:     Data: Data Buffer To Calculate CRC-8/EBU For
+ * ARG:     DataLength: Length Of Data Buffer
+ ****************************************************************************************************/
+uint8_t crc_crc8EbuCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8Ebu = CRC_CRC8_EBU_INITIAL_CRC8_EBU;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength == 0))
+        return CRC_CRC8_EBU_INITIAL_CRC8_EBU;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_EBU, DataLength);
+#endif
+
+    /*** Calculate CRC-8/EBU ***/
+    for(i = 0; i < DataLength; i++)
+        crc8Ebu = crc_crc8EbuStep(Data[i], crc8Ebu);
+    crc8Ebu = crc_crc8EbuFinal(crc8Ebu);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_EBU, metricsStart);
+#endif
+
+    return crc8Ebu;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8EbuCalculatePartial
+ * BRIEF:   Calculate Partial CRC-8/EBU
+ * RETURN:  uint8_t: Current/Final CRC-8/EBU
+ * ARG:     Data: Data To Add To CRC-8/EBU Calculation
+ * ARG:     crc8Ebu: Current CRC-8/EBU
+ * ARG:     Final: Final Data (Unused If CRC_CRC8_EBU_LOOKUP_TABLE_METHOD)
+ * NOTE:    Set CRC-8/EBU Value To CRC_CRC8_EBU_INITIAL_CRC8_EBU If First Data Byte (Data[0]);
+ *          Returned CRC-8/EBU Value Should Be Used On Subsequent Data Bytes (Data[1] ... Data[n])
+ ****************************************************************************************************/
+uint8_t crc_crc8EbuCalculatePartial(const uint8_t Data, uint8_t crc8Ebu, const bool Final)
+{
+    /*** Calculate Partial CRC-8/EBU ***/
+    crc8Ebu = crc_crc8EbuStep(Data, crc8Ebu);
+    
+    /*** Convert To Output Form On Final Data ***/
+    if(Final)
+        crc8Ebu = crc_crc8EbuFinal(crc8Ebu);
+    
+    return crc8Ebu;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8EbuModify
+ * BRIEF:   Update CRC-8/EBU After In-Place Modification Of Data
+ * RETURN:  uint8_t: CRC-8/EBU Of Modified Data
+ * ARG:     crc8Ebu: CRC-8/EBU Of Original Data
+ * ARG:     Delta: XOR Of Original And Modified Bytes
+ * ARG:     DeltaLength: Length Of Delta (Number Of Modified Bytes)
+ * ARG:     Distance: Number Of Bytes From End Of Modified Range To End Of Data
+ * NOTE:    Runs In O(DeltaLength + log Distance) Regardless Of Data Length
+ ****************************************************************************************************/
+uint8_t crc_crc8EbuModify(uint8_t crc8Ebu, const uint8_t * const Delta, const uint16_t DeltaLength, const uint32_t Distance)
+{
+    /*** Error Check ***/
+    if((Delta == NULL) || (DeltaLength == 0))
+        return crc8Ebu;
+    
+    /*** Update CRC-8/EBU ***/
+    crc8Ebu ^= (uint8_t)crc_genericDelta(&crc_crc8EbuParameters, Delta, DeltaLength, Distance);
+    
+    return crc8Ebu;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8EbuModifyBatch
+ * BRIEF:   Update CRC-8/EBU After In-Place Modification Of Data (Multiple Patches)
+ * RETURN:  uint8_t: CRC-8/EBU Of Modified Data
+ * ARG:     crc8Ebu: CRC-8/EBU Of Original Data
+ * ARG:     Patch: Patch List (Patches May Be In Any Order)
+ * ARG:     PatchCount: Number Of Patches In Patch List
+ * ARG:     DataLength: Length Of Data
+ * NOTE:    Patches Extending Beyond DataLength Are Ignored
+ ****************************************************************************************************/
+uint8_t crc_crc8EbuModifyBatch(uint8_t crc8Ebu, const crc_patch_t * const Patch, const uint16_t PatchCount, const uint32_t DataLength)
+{
+    uint16_t i;
+    
+    /*** Error Check ***/
+    if(Patch == NULL)
+        return crc8Ebu;
+    
+    /*** Update CRC-8/EBU For Each Patch ***/
+    for(i = 0; i < PatchCount; i++)
+    {
+        if((Patch[i].delta == NULL) || (Patch[i].offset > DataLength) || (Patch[i].length > (DataLength - Patch[i].offset)))
+            continue;
+        crc8Ebu = crc_crc8EbuModify(crc8Ebu, Patch[i].delta, Patch[i].length, DataLength - Patch[i].offset - Patch[i].length);
+    }
+    
+    return crc8Ebu;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8EbuRollingInitialize
+ * BRIEF:   Initialize Rolling (Sliding Window) CRC-8/EBU
+ * RETURN:  bool: Success Or Failure Status
+ * ARG:     Rolling: Rolling Context To Initialize
+ * ARG:     WindowLength: Length Of Sliding Window
+ * NOTE:    Precomputes Tables For WindowLength; Context Can Then Be Shared By Any Number Of Streams
+ ****************************************************************************************************/
+bool crc_crc8EbuRollingInitialize(crc_rolling_t * const Rolling, const uint16_t WindowLength)
+{
+    /*** Error Check ***/
+    if((Rolling == NULL) || (WindowLength == 0))
+        return false;
+    
+    /*** Initialize Rolling CRC-8/EBU ***/
+    crc_genericRollingInitialize(&crc_crc8EbuParameters, Rolling, WindowLength);
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8EbuRollingUpdate
+ * BRIEF:   Slide Rolling CRC-8/EBU Window Forward One Byte
+ * RETURN:  uint8_t: CRC-8/EBU Of New Window
+ * ARG:     Rolling: Rolling Context (Initialized By crc_crc8EbuRollingInitialize)
+ * ARG:     Out: Data Leaving Window (Oldest Byte)
+ * ARG:     In: Data Entering Window
+ * ARG:     crc8Ebu: CRC-8/EBU Of Current Window
+ * NOTE:    Seed With crc_crc8EbuCalculate Of First Window; Runs In O(1) Regardless Of Window Length
+ ****************************************************************************************************/
+uint8_t crc_crc8EbuRollingUpdate(const crc_rolling_t * const Rolling, const uint8_t Out, const uint8_t In, const uint8_t crc8Ebu)
+{
+    /*** Error Check ***/
+    if(Rolling == NULL)
+        return crc8Ebu;
+    
+    /*** Slide Window ***/
+    return (uint8_t)crc_genericRollingUpdate(Rolling, Out, In, crc8Ebu);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8EbuStripPrefix
+ * BRIEF:   Remove Known Prefix From CRC-8/EBU
+ * RETURN:  uint8_t: CRC-8/EBU Of Data Following Prefix
+ * ARG:     crc8Ebu: CRC-8/EBU Of Prefix Followed By Suffix
+ * ARG:     Prefix: Prefix Data Buffer
+ * ARG:     PrefixLength: Length Of Prefix Data Buffer
+ * ARG:     SuffixLength: Length Of Data Following Prefix
+ * NOTE:    Runs In O(PrefixLength + log SuffixLength); Suffix Data Is Not Needed
+ ****************************************************************************************************/
+uint8_t crc_crc8EbuStripPrefix(uint8_t crc8Ebu, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength)
+{
+    uint8_t crc8EbuPrefix = CRC_CRC8_EBU_INITIAL_CRC8_EBU;
+    uint32_t i;
+    
+    /*** Error Check ***/
+    if((Prefix == NULL) || (PrefixLength == 0))
+        return crc8Ebu;
+    else if(SuffixLength == 0)
+        return CRC_CRC8_EBU_INITIAL_CRC8_EBU;
+    
+    /*** Calculate CRC-8/EBU Of Prefix ***/
+    for(i = 0; i < PrefixLength; i++)
+        crc8EbuPrefix = crc_crc8EbuStep(Prefix[i], crc8EbuPrefix);
+    crc8EbuPrefix = crc_crc8EbuFinal(crc8EbuPrefix);
+    
+    /*** Strip Prefix ***/
+    crc8Ebu = (uint8_t)crc_genericStripPrefix(&crc_crc8EbuParameters, crc8Ebu, crc8EbuPrefix, SuffixLength);
+    
+    return crc8Ebu;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8EbuUnwind
+ * BRIEF:   Run CRC-8/EBU Backward Over Known Trailing Data
+ * RETURN:  uint8_t: CRC-8/EBU Of Data Preceding Trailing Data
+ * ARG:     crc8Ebu: CRC-8/EBU Of Data Including Trailing Data
+ * ARG:     Data: Trailing Data Buffer
+ * ARG:     DataLength: Length Of Trailing Data Buffer
+ ****************************************************************************************************/
+uint8_t crc_crc8EbuUnwind(uint8_t crc8Ebu, const uint8_t * const Data, const uint16_t DataLength)
+{
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength == 0))
+        return crc8Ebu;
+    
+    /*** Unwind CRC-8/EBU ***/
+    crc8Ebu = (uint8_t)crc_genericUnwind(&crc_crc8EbuParameters, crc8Ebu, Data, DataLength);
+    
+    return crc8Ebu;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8EbuPrefixInitialize
+ * BRIEF:   Precompute CRC-8/EBU State After Constant Prefix
+ * RETURN:  bool: True If Prefix State Computed
+ * ARG:     prefix: Prefix State
+ * ARG:     Data: Prefix Data Buffer (May Be NULL If DataLength Is Zero)
+ * ARG:     DataLength: Length Of Prefix Data Buffer
+ * NOTE:    The State Is Kept In The Same Form CalculatePartial Passes Between Bytes, Not As A
+ *          Finished CRC, So Resuming From It Is Exact For Every Method
+ ****************************************************************************************************/
+bool crc_crc8EbuPrefixInitialize(crc_prefix_t * const prefix, const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8Ebu = CRC_CRC8_EBU_INITIAL_CRC8_EBU;
+    uint32_t i;
+    
+    /*** Error Check ***/
+    if((prefix == NULL) || ((Data == NULL) && (DataLength != 0)))
+        return false;
+    
+    /*** Calculate CRC-8/EBU State Of Prefix; Finish It For CRC Of Prefix ***/
+    for(i = 0; i < DataLength; i++)
+        crc8Ebu = crc_crc8EbuStep(Data[i], crc8Ebu);
+    prefix->state = crc8Ebu;
+    prefix->crc = (DataLength == 0) ? CRC_CRC8_EBU_INITIAL_CRC8_EBU : crc_crc8EbuFinal(crc8Ebu);
+    
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8EbuPrefixCalculate
+ * BRIEF:   Calculate Full CRC-8/EBU Of Constant Prefix Followed By Data
+ * RETURN:  uint8_t: CRC-8/EBU
+ * ARG:     Prefix: Prefix State From crc_crc8EbuPrefixInitialize
+ * ARG:     Data: Data Buffer Following Prefix
+ * ARG:     DataLength: Length Of Data Buffer
+ * NOTE:    Only Data Is Processed; The Prefix Contribution Is Reused
+ ****************************************************************************************************/
+uint8_t crc_crc8EbuPrefixCalculate(const crc_prefix_t * const Prefix, const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8Ebu;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if(Prefix == NULL)
+        return CRC_CRC8_EBU_INITIAL_CRC8_EBU;
+    if((Data == NULL) || (DataLength == 0))
+        return (uint8_t)Prefix->crc;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_EBU, DataLength);
+#endif
+    
+    /*** Resume CRC-8/EBU From Prefix State ***/
+    crc8Ebu = (uint8_t)Prefix->state;
+    for(i = 0; i < DataLength; i++)
+        crc8Ebu = crc_crc8EbuStep(Data[i], crc8Ebu);
+    crc8Ebu = crc_crc8EbuFinal(crc8Ebu);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_EBU, metricsStart);
+#endif
+    
+    return crc8Ebu;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8EbuCalculateMasked
+ * BRIEF:   Calculate Full CRC-8/EBU With Masked Ranges Treated As Zero
+ * RETURN:  uint8_t: CRC-8/EBU
+ * ARG:     Data: Data Buffer To Calculate CRC-8/EBU For
+ * ARG:     DataLength: Length Of Data Buffer
+ * ARG:     Mask: Masked Range List (Sorted By Offset; Ranges Beyond DataLength Are Clipped)
+ * ARG:     MaskCount: Number Of Masked Ranges In Masked Range List
+ * NOTE:    Data Is Not Copied Or Modified; Each Masked Range Costs O(log Length) With No Per-Byte Work
+ ****************************************************************************************************/
+uint8_t crc_crc8EbuCalculateMasked(const uint8_t * const Data, const uint16_t DataLength, const crc_mask_t * const Mask, const uint16_t MaskCount)
+{
+    uint8_t crc8Ebu = CRC_CRC8_EBU_INITIAL_CRC8_EBU;
+    uint32_t end, i = 0, m, start;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength == 0) || ((Mask == NULL) && (MaskCount != 0)))
+        return CRC_CRC8_EBU_INITIAL_CRC8_EBU;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_EBU, DataLength);
+#endif
+    
+    /*** Calculate CRC-8/EBU Up To Each Masked Range; Shift Over Masked Range ***/
+    for(m = 0; m < MaskCount; m++)
+    {
+        start = (Mask[m].offset > i) ? Mask[m].offset : i;
+        end = (uint32_t)Mask[m].offset + Mask[m].length;
+        if(end > DataLength)
+            end = DataLength;
+        if(end <= start)
+            continue;
+        for(; i < start; i++)
+            crc8Ebu = crc_crc8EbuStep(Data[i], crc8Ebu);
+        crc8Ebu = (uint8_t)crc_genericShiftState(&crc_crc8EbuParameters, crc8Ebu, end - start);
+        i = end;
+    }
+    
+    /*** Calculate CRC-8/EBU After Final Masked Range ***/
+    for(; i < DataLength; i++)
+        crc8Ebu = crc_crc8EbuStep(Data[i], crc8Ebu);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_EBU, metricsStart);
+#endif
+    
+    return (uint8_t)crc_genericCrcFromState(&crc_crc8EbuParameters, crc8Ebu);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8EbuCalculateBits
+ * BRIEF:   Calculate Full CRC-8/EBU Over Bit-Granular Data
+ * RETURN:  uint8_t: CRC-8/EBU
+ * ARG:     Data: Data Buffer To Calculate CRC-8/EBU For
+ * ARG:     BitOffset: Offset Of First Bit (Bits Within Byte In Transmission Order: Least Significant Bit First)
+ * ARG:     BitLength: Number Of Bits (BitOffset + BitLength Must Not Exceed UINT32_MAX)
+ * NOTE:    Whole Bytes Use The Byte-Wise Method; Only Leading And Trailing Partial Bytes Are Bitwise
+ ****************************************************************************************************/
+uint8_t crc_crc8EbuCalculateBits(const uint8_t * const Data, const uint32_t BitOffset, const uint32_t BitLength)
+{
+    uint8_t crc8Ebu = CRC_CRC8_EBU_INITIAL_CRC8_EBU;
+    uint8_t count;
+    uint32_t bit, end;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((Data == NULL) || (BitLength == 0) || (BitLength > (UINT32_MAX - BitOffset)))
+        return CRC_CRC8_EBU_INITIAL_CRC8_EBU;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_EBU, ((BitLength - 1) / 8) + 1);
+#endif
+    
+    /*** Set Up ***/
+    bit = BitOffset;
+    end = BitOffset + BitLength;
+    
+    /*** Calculate CRC-8/EBU Over Leading Bits (Up To Byte Boundary) ***/
+    if((bit & 0x07) != 0)
+    {
+        count = (uint8_t)(8 - (bit & 0x07));
+        if(count > (end - bit))
+            count = (uint8_t)(end - bit);
+        crc8Ebu = (uint8_t)crc_genericUpdateBits(&crc_crc8EbuParameters, crc8Ebu, Data[bit >> 3], (uint8_t)(bit & 0x07), count);
+        bit += count;
+    }
+    
+    /*** Calculate CRC-8/EBU Over Whole Bytes ***/
+    for(; (end - bit) >= 8; bit += 8)
+        crc8Ebu = crc_crc8EbuStep(Data[bit >> 3], crc8Ebu);
+    
+    /*** Calculate CRC-8/EBU Over Trailing Bits ***/
+    if(bit < end)
+        crc8Ebu = (uint8_t)crc_genericUpdateBits(&crc_crc8EbuParameters, crc8Ebu, Data[bit >> 3], 0, (uint8_t)(end - bit));
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_EBU, metricsStart);
+#endif
+    
+    return (uint8_t)crc_genericCrcFromState(&crc_crc8EbuParameters, crc8Ebu);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8EbuCalculatePartialBits
+ * BRIEF:   Calculate Partial CRC-8/EBU Over Bit-Granular Data
+ * RETURN:  uint8_t: Current/Final CRC-8/EBU
+ * ARG:     Data: Data Byte Containing Bits (First Bits In Transmission Order: Least Significant Bit First)
+ * ARG:     BitLength: Number Of Bits (1 ... 8)
+ * ARG:     crc8Ebu: Current CRC-8/EBU
+ * ARG:     Final: Final Data
+ * NOTE:    Set CRC-8/EBU Value To CRC_CRC8_EBU_INITIAL_CRC8_EBU If First Data Bits;
+ *          Returned CRC-8/EBU Value Should Be Used On Subsequent Data Bits; May Be Mixed With
+ *          crc_crc8EbuCalculatePartial For Whole Bytes
+ ****************************************************************************************************/
+uint8_t crc_crc8EbuCalculatePartialBits(const uint8_t Data, const uint8_t BitLength, uint8_t crc8Ebu, const bool Final)
+{
+    /*** Error Check ***/
+    if(BitLength == 0)
+        return crc8Ebu;
+    else if(BitLength >= 8)
+        return crc_crc8EbuCalculatePartial(Data, crc8Ebu, Final);
+    
+    /*** Calculate Partial CRC-8/EBU ***/
+    crc8Ebu = (uint8_t)crc_genericUpdateBits(&crc_crc8EbuParameters, crc8Ebu, Data, 0, BitLength);
+    
+    /*** Convert To CRC-8/EBU On Final Data ***/
+    if(Final)
+        crc8Ebu = (uint8_t)crc_genericCrcFromState(&crc_crc8EbuParameters, crc8Ebu);
+    
+    return crc8Ebu;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8EbuVerify
+ * BRIEF:   Verify Data Followed By Its CRC-8/EBU
+ * RETURN:  bool: True If CRC-8/EBU Matches
+ * ARG:     Data: Data Buffer With CRC-8/EBU In Trailing Byte
+ * ARG:     DataLength: Length Of Data Buffer Including CRC-8/EBU
+ * NOTE:    Runs Over Data And CRC-8/EBU In One Pass And Compares Against The Residue Constant
+ ****************************************************************************************************/
+bool crc_crc8EbuVerify(const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8Ebu = CRC_CRC8_EBU_INITIAL_CRC8_EBU;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength < 1))
+        return false;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_EBU, DataLength);
+#endif
+    
+    /*** Calculate Partial CRC-8/EBU Over Data And CRC-8/EBU ***/
+    for(i = 0; i < DataLength; i++)
+        crc8Ebu = crc_crc8EbuStep(Data[i], crc8Ebu);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_EBU, metricsStart);
+#endif
+    
+    return (crc8Ebu == CRC_CRC8_EBU_RESIDUE);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8EbuForge
+ * BRIEF:   Patch Data So That Its CRC-8/EBU Equals Target
+ * RETURN:  bool: True If Data Patched
+ * ARG:     data: Data Buffer To Patch
+ * ARG:     DataLength: Length Of Data Buffer
+ * ARG:     Offset: Offset Of 1 Patch Byte (Overwritten)
+ * ARG:     crc8Ebu: Current CRC-8/EBU Of Data (Including Original Patch Bytes)
+ * ARG:     Target: CRC-8/EBU To Reach
+ * NOTE:    Patch Is Solved Directly In O(log DataLength) From The Current CRC-8/EBU; Data Outside The
+ *          Patch Bytes Is Not Read, So A Wrong Current CRC-8/EBU Gives A Wrong Patch
+ ****************************************************************************************************/
+bool crc_crc8EbuForge(uint8_t * const data, const uint16_t DataLength, const uint16_t Offset, const uint8_t crc8Ebu, const uint8_t Target)
+{
+    /*** Error Check ***/
+    if((data == NULL) || (DataLength < 1) || (Offset > (DataLength - 1)))
+        return false;
+    
+    /*** Solve Patch Bytes For Target CRC-8/EBU ***/
+    return crc_genericForge(&crc_crc8EbuParameters, crc8Ebu, Target, (uint32_t)(DataLength - Offset - 1), &data[Offset]);
+}
+#endif
+
+#if defined(CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_I_CODE_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crc_crc8ICodeCalculate
+ * BRIEF:   Calculate Full CRC-8/I-CODE
+ * RETURN:  uint8_t: CRC-8/I-CODE
+ * ARG:     Data: Data Buffer To Calculate CRC-8/I-CODE For
+ * ARG:     DataLength: Length Of Data Buffer
+ ****************************************************************************************************/
+uint8_t crc_crc8ICodeCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8ICode = CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength == 0))
+        return CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_I_CODE, DataLength);
+#endif
+
+    /*** Calculate Full CRC-8/I-CODE ***/
+    for(i = 0; i < DataLength; i++)
+        crc8ICode = crc_crc8ICodeStep(Data[i], crc8ICode);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_I_CODE, metricsStart);
+#endif
+
+    return crc8ICode;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8ICodeCalculatePartial
+ * BRIEF:   Calculate Partial CRC-8/I-CODE
+ * RETURN:  uint8_t: Current/Final CRC-8/I-CODE
+ * ARG:     Data: Data To Add To CRC-8/I-CODE Calculation
+ * ARG:     crc8ICode: Current CRC-8/I-CODE
+ * NOTE:    Set CRC-8/I-CODE Value To CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE If First Data Byte
+ *          (Data[0]); Returned CRC-8/I-CODE Value Should Be Used On Subsequent Data Bytes
+ *          (Data[1] ... Data[n])
+ ****************************************************************************************************/
+uint8_t crc_crc8ICodeCalculatePartial(const uint8_t Data, uint8_t crc8ICode)
+{
+    /*** Calculate Partial CRC-8/I-CODE ***/
+    crc8ICode = crc_crc8ICodeStep(Data, crc8ICode);
+    
+    return crc8ICode;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8ICodeModify
+ * BRIEF:   Update CRC-8/I-CODE After In-Place Modification Of Data
+ * RETURN:  uint8_t: CRC-8/I-CODE Of Modified Data
+ * ARG:     crc8ICode: CRC-8/I-CODE Of Original Data
+ * ARG:     Delta: XOR Of Original And Modified Bytes
+ * ARG:     DeltaLength: Length Of Delta (Number Of Modified Bytes)
+ * ARG:     Distance: Number Of Bytes From End Of Modified Range To End Of Data
+ * NOTE:    Runs In O(DeltaLength + log Distance) Regardless Of Data Length
+ ****************************************************************************************************/
+uint8_t crc_crc8ICodeModify(uint8_t crc8ICode, const uint8_t * const Delta, const uint16_t DeltaLength, const uint32_t Distance)
+{
+    /*** Error Check ***/
+    if((Delta == NULL) || (DeltaLength == 0))
+        return crc8ICode;
+    
+    /*** Update CRC-8/I-CODE ***/
+    crc8ICode ^= (uint8_t)crc_genericDelta(&crc_crc8ICodeParameters, Delta, DeltaLength, Distance);
+    
+    return crc8ICode;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8ICodeModifyBatch
+ * BRIEF:   Update CRC-8/I-CODE After In-Place Modification Of Data (Multiple Patches)
+ * RETURN:  uint8_t: CRC-8/I-CODE Of Modified Data
+ * ARG:     crc8ICode: CRC-8/I-CODE Of Original Data
+ * ARG:     Patch: Patch List (Patches May Be In Any Order)
+ * ARG:     PatchCount: Number Of Patches In Patch List
+ * ARG:     DataLength: Length Of Data
+ * NOTE:    Patches Extending Beyond DataLength Are Ignored
+ ****************************************************************************************************/
+uint8_t crc_crc8ICodeModifyBatch(uint8_t crc8ICode, const crc_patch_t * const Patch, const uint16_t PatchCount, const uint32_t DataLength)
+{
+    uint16_t i;
+    
+    /*** Error Check ***/
+    if(Patch == NULL)
+        return crc8ICode;
+    
+    /*** Update CRC-8/I-CODE For Each Patch ***/
+    for(i = 0; i < PatchCount; i++)
+    {
+        if((Patch[i].delta == NULL) || (Patch[i].offset > DataLength) || (Patch[i].length > (DataLength - Patch[i].offset)))
+            continue;
+        crc8ICode = crc_crc8ICodeModify(crc8ICode, Patch[i].delta, Patch[i].length, DataLength - Patch[i].offset - Patch[i].length);
+    }
+    
+    return crc8ICode;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8ICodeRollingInitialize
+ * BRIEF:   Initialize Rolling (Sliding Window) CRC-8/I-CODE
+ * RETURN:  bool: Success Or Failure Status
+ * ARG:     Rolling: Rolling Context To Initialize
+ * ARG:     WindowLength: Length Of Sliding Window
+ * NOTE:    Precomputes Tables For WindowLength; Context Can Then Be Shared By Any Number Of Streams
+ ****************************************************************************************************/
+bool crc_crc8ICodeRollingInitialize(crc_rolling_t * const Rolling, const uint16_t WindowLength)
+{
+    /*** Error Check ***/
+    if((Rolling == NULL) || (WindowLength == 0))
+        return false;
+    
+    /*** Initialize Rolling CRC-8/I-CODE ***/
+    crc_genericRollingInitialize(&crc_crc8ICodeParameters, Rolling, WindowLength);
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8ICodeRollingUpdate
+ * BRIEF:   Slide Rolling CRC-8/I-CODE Window Forward One Byte
+ * RETURN:  uint8_t: CRC-8/I-CODE Of New Window
+ * ARG:     Rolling: Rolling Context (Initialized By crc_crc8ICodeRollingInitialize)
+ * ARG:     Out: Data Leaving Window (Oldest Byte)
+ * ARG:     In: Data Entering Window
+ * ARG:     crc8ICode: CRC-8/I-CODE Of Current Window
+ * NOTE:    Seed With crc_crc8ICodeCalculate Of First Window; Runs In O(1) Regardless Of Window Length
+ ****************************************************************************************************/
+uint8_t crc_crc8ICodeRollingUpdate(const crc_rolling_t * const Rolling, const uint8_t Out, const uint8_t In, const uint8_t crc8ICode)
+{
+    /*** Error Check ***/
+    if(Rolling == NULL)
+        return crc8ICode;
+    
+    /*** Slide Window ***/
+    return (uint8_t)crc_genericRollingUpdate(Rolling, Out, In, crc8ICode);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8ICodeStripPrefix
+ * BRIEF:   Remove Known Prefix From CRC-8/I-CODE
+ * RETURN:  uint8_t: CRC-8/I-CODE Of Data Following Prefix
+ * ARG:     crc8ICode: CRC-8/I-CODE Of Prefix Followed By Suffix
+ * ARG:     Prefix: Prefix Data Buffer
+ * ARG:     PrefixLength: Length Of Prefix Data Buffer
+ * ARG:     SuffixLength: Length Of Data Following Prefix
+ * NOTE:    Runs In O(PrefixLength + log SuffixLength); Suffix Data Is Not Needed
+ ****************************************************************************************************/
+uint8_t crc_crc8ICodeStripPrefix(uint8_t crc8ICode, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength)
+{
+    uint8_t crc8ICodePrefix = CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE;
+    uint32_t i;
+    
+    /*** Error Check ***/
+    if((Prefix == NULL) || (PrefixLength == 0))
+        return crc8ICode;
+    else if(SuffixLength == 0)
+        return CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE;
+    
+    /*** Calculate CRC-8/I-CODE Of Prefix ***/
+    for(i = 0; i < PrefixLength; i++)
+        crc8ICodePrefix = crc_crc8ICodeStep(Prefix[i], crc8ICodePrefix);
+    
+    /*** Strip Prefix ***/
+    crc8ICode = (uint8_t)crc_genericStripPrefix(&crc_crc8ICodeParameters, crc8ICode, crc8ICodePrefix, SuffixLength);
+    
+    return crc8ICode;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8ICodeUnwind
+ * BRIEF:   Run CRC-8/I-CODE Backward Over Known Trailing Data
+ * RETURN:  uint8_t: CRC-8/I-CODE Of Data Preceding Trailing Data
+ * ARG:     crc8ICode: CRC-8/I-CODE Of Data Including Trailing Data
+ * ARG:     Data: Trailing Data Buffer
+ * ARG:     DataLength: Length Of Trailing Data Buffer
+ ****************************************************************************************************/
+uint8_t crc_crc8ICodeUnwind(uint8_t crc8ICode, const uint8_t * const Data, const uint16_t DataLength)
+{
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength == 0))
+        return crc8ICode;
+    
+    /*** Unwind CRC-8/I-CODE ***/
+    crc8ICode = (uint8_t)crc_genericUnwind(&crc_crc8ICodeParameters, crc8ICode, Data, DataLength);
+    
+    return crc8ICode;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8ICodePrefixInitialize
+ * BRIEF:   Precompute CRC-8/I-CODE State After Constant Prefix
+ * RETURN:  bool: True If Prefix State Computed
+ * ARG:     prefix: Prefix State
+ * ARG:     Data: Prefix Data Buffer (May Be NULL If DataLength Is Zero)
+ * ARG:     DataLength: Length Of Prefix Data Buffer
+ * NOTE:    The State Is Kept In The Same Form CalculatePartial Passes Between Bytes, Not As A
+ *          Finished CRC, So Resuming From It Is Exact For Every Method
+ ****************************************************************************************************/
+bool crc_crc8ICodePrefixInitialize(crc_prefix_t * const prefix, const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8ICode = CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE;
+    uint32_t i;
+    
+    /*** Error Check ***/
+    if((prefix == NULL) || ((Data == NULL) && (DataLength != 0)))
+        return false;
+    
+    /*** Calculate CRC-8/I-CODE State Of Prefix; Finish It For CRC Of Prefix ***/
+    for(i = 0; i < DataLength; i++)
+        crc8ICode = crc_crc8ICodeStep(Data[i], crc8ICode);
+    prefix->state = crc8ICode;
+    prefix->crc = crc8ICode;
+    
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8ICodePrefixCalculate
+ * BRIEF:   Calculate Full CRC-8/I-CODE Of Constant Prefix Followed By Data
+ * RETURN:  uint8_t: CRC-8/I-CODE
+ * ARG:     Prefix: Prefix State From crc_crc8ICodePrefixInitialize
+ * ARG:     Data: Data Buffer Following Prefix
+ * ARG:     DataLength: Length Of Data Buffer
+ * NOTE:    Only Data Is Processed; The Prefix Contribution Is Reused
+ ****************************************************************************************************/
+uint8_t crc_crc8ICodePrefixCalculate(const crc_prefix_t * const Prefix, const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8ICode;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if(Prefix == NULL)
+        return CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE;
+    if((Data == NULL) || (DataLength == 0))
+        return (uint8_t)Prefix->crc;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_I_CODE, DataLength);
+#endif
+    
+    /*** Resume CRC-8/I-CODE From Prefix State ***/
+    crc8ICode = (uint8_t)Prefix->state;
+    for(i = 0; i < DataLength; i++)
+        crc8ICode = crc_crc8ICodeStep(Data[i], crc8ICode);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_I_CODE, metricsStart);
+#endif
+    
+    return crc8ICode;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8ICodeCalculateMasked
+ * BRIEF:   Calculate Full CRC-8/I-CODE With Masked Ranges Treated As Zero
+ * RETURN:  uint8_t: CRC-8/I-CODE
+ * ARG:     Data: Data Buffer To Calculate CRC-8/I-CODE For
+ * ARG:     DataLength: Length Of Data Buffer
+ * ARG:     Mask: Masked Range List (Sorted By Offset; Ranges Beyond DataLength Are Clipped)
+ * ARG:     MaskCount: Number Of Masked Ranges In Masked Range List
+ * NOTE:    Data Is Not Copied Or Modified; Each Masked Range Costs O(log Length) With No Per-Byte Work
+ ****************************************************************************************************/
+uint8_t crc_crc8ICodeCalculateMasked(const uint8_t * const Data, const uint16_t DataLength, const crc_mask_t * const Mask, const uint16_t MaskCount)
+{
+    uint8_t crc8ICode = CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE;
+    uint32_t end, i = 0, m, start;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength == 0) || ((Mask == NULL) && (MaskCount != 0)))
+        return CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_I_CODE, DataLength);
+#endif
+    
+    /*** Calculate CRC-8/I-CODE Up To Each Masked Range; Shift Over Masked Range ***/
+    for(m = 0; m < MaskCount; m++)
+    {
+        start = (Mask[m].offset > i) ? Mask[m].offset : i;
+        end = (uint32_t)Mask[m].offset + Mask[m].length;
+        if(end > DataLength)
+            end = DataLength;
+        if(end <= start)
+            continue;
+        for(; i < start; i++)
+            crc8ICode = crc_crc8ICodeStep(Data[i], crc8ICode);
+        crc8ICode = (uint8_t)crc_genericShiftState(&crc_crc8ICodeParameters, crc8ICode, end - start);
+        i = end;
+    }
+    
+    /*** Calculate CRC-8/I-CODE After Final Masked Range ***/
+    for(; i < DataLength; i++)
+        crc8ICode = crc_crc8ICodeStep(Data[i], crc8ICode);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_I_CODE, metricsStart);
+#endif
+    
+    return (uint8_t)crc_genericCrcFromState(&crc_crc8ICodeParameters, crc8ICode);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8ICodeCalculateBits
+ * BRIEF:   Calculate Full CRC-8/I-CODE Over Bit-Granular Data
+ * RETURN:  uint8_t: CRC-8/I-CODE
+ * ARG:     Data: Data Buffer To Calculate CRC-8/I-CODE For
+ * ARG:     BitOffset: Offset Of First Bit (Bits Within Byte In Transmission Order: Most Significant Bit First)
+ * ARG:     BitLength: Number Of Bits (BitOffset + BitLength Must Not Exceed UINT32_MAX)
+ * NOTE:    Whole Bytes Use The Byte-Wise Method; Only Leading And Trailing Partial Bytes Are Bitwise
+ ****************************************************************************************************/
+uint8_t crc_crc8ICodeCalculateBits(const uint8_t * const Data, const uint32_t BitOffset, const uint32_t BitLength)
+{
+    uint8_t crc8ICode = CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE;
+    uint8_t count;
+    uint32_t bit, end;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((Data == NULL) || (BitLength == 0) || (BitLength > (UINT32_MAX - BitOffset)))
+        return CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_I_CODE, ((BitLength - 1) / 8) + 1);
+#endif
+    
+    /*** Set Up ***/
+    bit = BitOffset;
+    end = BitOffset + BitLength;
+    
+    /*** Calculate CRC-8/I-CODE Over Leading Bits (Up To Byte Boundary) ***/
+    if((bit & 0x07) != 0)
+    {
+        count = (uint8_t)(8 - (bit & 0x07));
+        if(count > (end - bit))
+            count = (uint8_t)(end - bit);
+        crc8ICode = (uint8_t)crc_genericUpdateBits(&crc_crc8ICodeParameters, crc8ICode, Data[bit >> 3], (uint8_t)(bit & 0x07), count);
+        bit += count;
+    }
+    
+    /*** Calculate CRC-8/I-CODE Over Whole Bytes ***/
+    for(; (end - bit) >= 8; bit += 8)
+        crc8ICode = crc_crc8ICodeStep(Data[bit >> 3], crc8ICode);
+    
+    /*** Calculate CRC-8/I-CODE Over Trailing Bits ***/
+    if(bit < end)
+        crc8ICode = (uint8_t)crc_genericUpdateBits(&crc_crc8ICodeParameters, crc8ICode, Data[bit >> 3], 0, (uint8_t)(end - bit));
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_I_CODE, metricsStart);
+#endif
+    return (uint8_t)crc_genericCrcFromState(&crc_crc8ICodeParameters, crc8ICode);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8ICodeCalculatePartialBits
+ * BRIEF:   Calculate Partial CRC-8/I-CODE Over Bit-Granular Data
+ * RETURN:  uint8_t: Current/Final CRC-8/I-CODE
+ * ARG:     Data: Data Byte Containing Bits (First Bits In Transmission Order: Most Significant Bit First)
+ * ARG:     BitLength: Number Of Bits (1 ... 8)
+ * ARG:     crc8ICode: Current CRC-8/I-CODE
+ * NOTE:    Set CRC-8/I-CODE Value To CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE If First Data Bits;
+ *          Returned CRC-8/I-CODE Value Should Be Used On Subsequent Data Bits; May Be Mixed With
+ *          crc_crc8ICodeCalculatePartial For Whole Bytes
+ ****************************************************************************************************/
+uint8_t crc_crc8ICodeCalculatePartialBits(const uint8_t Data, const uint8_t BitLength, uint8_t crc8ICode)
+{
+    /*** Error Check ***/
+    if(BitLength == 0)
+        return crc8ICode;
+    else if(BitLength >= 8)
+        return crc_crc8ICodeStep(Data, crc8ICode);
+    
+    /*** Calculate Partial CRC-8/I-CODE ***/
+    crc8ICode = (uint8_t)crc_genericUpdateBits(&crc_crc8ICodeParameters, crc8ICode, Data, 0, BitLength);
+    return crc8ICode;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8ICodeVerify
+ * BRIEF:   Verify Data Followed By Its CRC-8/I-CODE
+ * RETURN:  bool: True If CRC-8/I-CODE Matches
+ * ARG:     Data: Data Buffer With CRC-8/I-CODE In Trailing Byte
+ * ARG:     DataLength: Length Of Data Buffer Including CRC-8/I-CODE
+ * NOTE:    Runs Over Data And CRC-8/I-CODE In One Pass And Compares Against The Residue Constant
+ ****************************************************************************************************/
+bool crc_crc8ICodeVerify(const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8ICode = CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength < 1))
+        return false;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_I_CODE, DataLength);
+#endif
+    
+    /*** Calculate Partial CRC-8/I-CODE Over Data And CRC-8/I-CODE ***/
+    for(i = 0; i < DataLength; i++)
+        crc8ICode = crc_crc8ICodeStep(Data[i], crc8ICode);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_I_CODE, metricsStart);
+#endif
+    
+    return (crc8ICode == CRC_CRC8_I_CODE_RESIDUE);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8ICodeForge
+ * BRIEF:   Patch Data So That Its CRC-8/I-CODE Equals Target
+ * RETURN:  bool: True If Data Patched
+ * ARG:     data: Data Buffer To Patch
+ * ARG:     DataLength: Length Of Data Buffer
+ * ARG:     Offset: Offset Of 1 Patch Byte (Overwritten)
+ * ARG:     crc8ICode: Current CRC-8/I-CODE Of Data (Including Original Patch Bytes)
+ * ARG:     Target: CRC-8/I-CODE To Reach
+ * NOTE:    Patch Is Solved Directly In O(log DataLength) From The Current CRC-8/I-CODE; Data Outside The
+ *          Patch Bytes Is Not Read, So A Wrong Current CRC-8/I-CODE Gives A Wrong Patch
+ ****************************************************************************************************/
+bool crc_crc8ICodeForge(uint8_t * const data, const uint16_t DataLength, const uint16_t Offset, const uint8_t crc8ICode, const uint8_t Target)
+{
+    /*** Error Check ***/
+    if((data == NULL) || (DataLength < 1) || (Offset > (DataLength - 1)))
+        return false;
+    
+    /*** Solve Patch Bytes For Target CRC-8/I-CODE ***/
+    return crc_genericForge(&crc_crc8ICodeParameters, crc8ICode, Target, (uint32_t)(DataLength - Offset - 1), &data[Offset]);
+}
+#endif
+
+#if defined(CRC_CRC8_ITU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ITU_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crc_crc8ItuCalculate
+ * BRIEF:   Calculate Full CRC-8/ITU
+ * RETURN:  uint8_t: CRC-8/ITU
+ * ARG:     Data: Data Buffer To Calculate CRC-8/ITU For
+ * ARG:     DataLength: Length Of Data Buffer
+ ****************************************************************************************************/
+uint8_t crc_crc8ItuCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8Itu = CRC_CRC8_ITU_INITIAL_CRC8_ITU;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength == 0))
+        return CRC_CRC8_ITU_INITIAL_CRC8_ITU;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_ITU, DataLength);
+#endif
+
+    /*** Calculate Full CRC-8/ITU ***/
+    for(i = 0; i < DataLength; i++)
+        crc8Itu = crc_crc8ItuStep(Data[i], crc8Itu);
+    crc8Itu = crc_crc8ItuFinal(crc8Itu);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_ITU, metricsStart);
+#endif
+
+    return crc8Itu;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8ItuCalculatePartial
+ * BRIEF:   Calculate Partial CRC-8/ITU
+ * RETURN:  uint8_t: Current/Final CRC-8/ITU
+ * ARG:     Data: Data To Add To CRC-8/ITU Calculation
+ * ARG:     crc8Itu: Current CRC-8/ITU
+ * ARG:     Final: Final Data
+ * NOTE:    Set CRC-8/ITU Value To CRC_CRC8_ITU_INITIAL_CRC8_ITU If First Data Byte (Data[0]);
+ *          Returned CRC-8/ITU Value Should Be Used On Subsequent Data Bytes (Data[1] ... Data[n])
+ ****************************************************************************************************/
+uint8_t crc_crc8ItuCalculatePartial(const uint8_t Data, uint8_t crc8Itu, const bool Final)
+{
+    /*** Calculate Partial CRC-8/ITU ***/
+    crc8Itu = crc_crc8ItuStep(Data, crc8Itu);
+    
+    /*** Convert To Output Form On Final Data ***/
+    if(Final)
+        crc8Itu = crc_crc8ItuFinal(crc8Itu);
+    
+    return crc8Itu;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8ItuModify
+ * BRIEF:   Update CRC-8/ITU After In-Place Modification Of Data
+ * RETURN:  uint8_t: CRC-8/ITU Of Modified Data
+ * ARG:     crc8Itu: CRC-8/ITU Of Original Data
+ * ARG:     Delta: XOR Of Original And Modified Bytes
+ * ARG:     DeltaLength: Length Of Delta (Number Of Modified Bytes)
+ * ARG:     Distance: Number Of Bytes From End Of Modified Range To End Of Data
+ * NOTE:    Runs In O(DeltaLength + log Distance) Regardless Of Data Length
+ ****************************************************************************************************/
+uint8_t crc_crc8ItuModify(uint8_t crc8Itu, const uint8_t * const Delta, const uint16_t DeltaLength, const uint32_t Distance)
+{
+    /*** Error Check ***/
+    if((Delta == NULL) || (DeltaLength == 0))
+        return crc8Itu;
+    
+    /*** Update CRC-8/ITU ***/
+    crc8Itu ^= (uint8_t)crc_genericDelta(&crc_crc8ItuParameters, Delta, DeltaLength, Distance);
+    
+    return crc8Itu;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8ItuModifyBatch
+ * BRIEF:   Update CRC-8/ITU After In-Place Modification Of Data (Multiple Patches)
+ * RETURN:  uint8_t: CRC-8/ITU Of Modified Data
+ * ARG:     crc8Itu: CRC-8/ITU Of Original Data
+ * ARG:     Patch: Patch List (Patches May Be In Any Order)
+ * ARG:     PatchCount: Number Of Patches In Patch List
+ * ARG:     DataLength: Length Of Data
+ * NOTE:    Patches Extending Beyond DataLength Are Ignored
+ ****************************************************************************************************/
+uint8_t crc_crc8ItuModifyBatch(uint8_t crc8Itu, const crc_patch_t * const Patch, const uint16_t PatchCount, const uint32_t DataLength)
+{
+    uint16_t i;
+    
+    /*** Error Check ***/
+    if(Patch == NULL)
+        return crc8Itu;
+    
+    /*** Update CRC-8/ITU For Each Patch ***/
+    for(i = 0; i < PatchCount; i++)
+    {
+        if((Patch[i].delta == NULL) || (Patch[i].offset > DataLength) || (Patch[i].length > (DataLength - Patch[i].offset)))
+            continue;
+        crc8Itu = crc_crc8ItuModify(crc8Itu, Patch[i].delta, Patch[i].length, DataLength - Patch[i].offset - Patch[i].length);
+    }
+    
+    return crc8Itu;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8ItuRollingInitialize
+ * BRIEF:   Initialize Rolling (Sliding Window) CRC-8/ITU
+ * RETURN:  bool: Success Or Failure Status
+ * ARG:     Rolling: Rolling Context To Initialize
+ * ARG:     WindowLength: Length Of Sliding Window
+ * NOTE:    Precomputes Tables For WindowLength; Context Can Then Be Shared By Any Number Of Streams
+ ****************************************************************************************************/
+bool crc_crc8ItuRollingInitialize(crc_rolling_t * const Rolling, const uint16_t WindowLength)
+{
+    /*** Error Check ***/
+    if((Rolling == NULL) || (WindowLength == 0))
+        return false;
+    
+    /*** Initialize Rolling CRC-8/ITU ***/
+    crc_genericRollingInitialize(&crc_crc8ItuParameters, Rolling, WindowLength);
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8ItuRollingUpdate
+ * BRIEF:   Slide Rolling CRC-8/ITU Window Forward One Byte
+ * RETURN:  uint8_t: CRC-8/ITU Of New Window
+ * ARG:     Rolling: Rolling Context (Initialized By crc_crc8ItuRollingInitialize)
+ * ARG:     Out: Data Leaving Window (Oldest Byte)
+ * ARG:     In: Data Entering Window
+ * ARG:     crc8Itu: CRC-8/ITU Of Current Window
+ * NOTE:    Seed With crc_crc8ItuCalculate Of First Window; Runs In O(1) Regardless Of Window Length
+ ****************************************************************************************************/
+uint8_t crc_crc8ItuRollingUpdate(const crc_rolling_t * const Rolling, const uint8_t Out, const uint8_t In, const uint8_t crc8Itu)
+{
+    /*** Error Check ***/
+    if(Rolling == NULL)
+        return crc8Itu;
+    
+    /*** Slide Window ***/
+    return (uint8_t)crc_genericRollingUpdate(Rolling, Out, In, crc8Itu);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8ItuStripPrefix
+ * BRIEF:   Remove Known Prefix From CRC-8/ITU
+ * RETURN:  uint8_t: CRC-8/ITU Of Data Following Prefix
+ * ARG:     crc8Itu: CRC-8/ITU Of Prefix Followed By Suffix
+ * ARG:     Prefix: Prefix Data Buffer
+ * ARG:     PrefixLength: Length Of Prefix Data Buffer
+ * ARG:     SuffixLength: Length Of Data Following Prefix
+ * NOTE:    Runs In O(PrefixLength + log SuffixLength); Suffix Data Is Not Needed
+ ****************************************************************************************************/
+uint8_t crc_crc8ItuStripPrefix(uint8_t crc8Itu, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength)
+{
+    uint8_t crc8ItuPrefix = CRC_CRC8_ITU_INITIAL_CRC8_ITU;
+    uint32_t i;
+    
+    /*** Error Check ***/
+    if((Prefix == NULL) || (PrefixLength == 0))
+        return crc8Itu;
+    else if(SuffixLength == 0)
+        return CRC_CRC8_ITU_INITIAL_CRC8_ITU;
+    
+    /*** Calculate CRC-8/ITU Of Prefix ***/
+    for(i = 0; i < PrefixLength; i++)
+        crc8ItuPrefix = crc_crc8ItuStep(Prefix[i], crc8ItuPrefix);
+    crc8ItuPrefix = crc_crc8ItuFinal(crc8ItuPrefix);
+    
+    /*** Strip Prefix ***/
+    crc8Itu = (uint8_t)crc_genericStripPrefix(&crc_crc8ItuParameters, crc8Itu, crc8ItuPrefix, SuffixLength);
+    
+    return crc8Itu;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8ItuUnwind
+ * BRIEF:   Run CRC-8/ITU Backward Over Known Trailing Data
+ * RETURN:  uint8_t: CRC-8/ITU Of Data Preceding Trailing Data
+ * ARG:     crc8Itu: CRC-8/ITU Of Data Including Trailing Data
+ * ARG:     Data: Trailing Data Buffer
+ * ARG:     DataLength: Length Of Trailing Data Buffer
+ ****************************************************************************************************/
+uint8_t crc_crc8ItuUnwind(uint8_t crc8Itu, const uint8_t * const Data, const uint16_t DataLength)
+{
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength == 0))
+        return crc8Itu;
+    
+    /*** Unwind CRC-8/ITU ***/
+    crc8Itu = (uint8_t)crc_genericUnwind(&crc_crc8ItuParameters, crc8Itu, Data, DataLength);
+    
+    return crc8Itu;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8ItuPrefixInitialize
+ * BRIEF:   Precompute CRC-8/ITU State After Constant Prefix
+ * RETURN:  bool: True If Prefix State Computed
+ * ARG:     prefix: Prefix State
+ * ARG:     Data: Prefix Data Buffer (May Be NULL If DataLength Is Zero)
+ * ARG:     DataLength: Length Of Prefix Data Buffer
+ * NOTE:    The State Is Kept In The Same Form CalculatePartial Passes Between Bytes, Not As A
+ *          Finished CRC, So Resuming From It Is Exact For Every Method
+ ****************************************************************************************************/
+bool crc_crc8ItuPrefixInitialize(crc_prefix_t * const prefix, const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8Itu = CRC_CRC8_ITU_INITIAL_CRC8_ITU;
+    uint32_t i;
+    
+    /*** Error Check ***/
+    if((prefix == NULL) || ((Data == NULL) && (DataLength != 0)))
+        return false;
+    
+    /*** Calculate CRC-8/ITU State Of Prefix; Finish It For CRC Of Prefix ***/
+    for(i = 0; i < DataLength; i++)
+        crc8Itu = crc_crc8ItuStep(Data[i], crc8Itu);
+    prefix->state = crc8Itu;
+    prefix->crc = (DataLength == 0) ? CRC_CRC8_ITU_INITIAL_CRC8_ITU : crc_crc8ItuFinal(crc8Itu);
+    
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8ItuPrefixCalculate
+ * BRIEF:   Calculate Full CRC-8/ITU Of Constant Prefix Followed By Data
+ * RETURN:  uint8_t: CRC-8/ITU
+ * ARG:     Prefix: Prefix State From crc_crc8ItuPrefixInitialize
+ * ARG:     Data: Data Buffer Following Prefix
+ * ARG:     DataLength: Length Of Data Buffer
+ * NOTE:    Only Data Is Processed; The Prefix Contribution Is Reused
+ ****************************************************************************************************/
+uint8_t crc_crc8ItuPrefixCalculate(const crc_prefix_t * const Prefix, const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8Itu;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if(Prefix == NULL)
+        return CRC_CRC8_ITU_INITIAL_CRC8_ITU;
+    if((Data == NULL) || (DataLength == 0))
+        return (uint8_t)Prefix->crc;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_ITU, DataLength);
+#endif
+    
+    /*** Resume CRC-8/ITU From Prefix State ***/
+    crc8Itu = (uint8_t)Prefix->state;
+    for(i = 0; i < DataLength; i++)
+        crc8Itu = crc_crc8ItuStep(Data[i], crc8Itu);
+    crc8Itu = crc_crc8ItuFinal(crc8Itu);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_ITU, metricsStart);
+#endif
+    
+    return crc8Itu;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8ItuCalculateMasked
+ * BRIEF:   Calculate Full CRC-8/ITU With Masked Ranges Treated As Zero
+ * RETURN:  uint8_t: CRC-8/ITU
+ * ARG:     Data: Data Buffer To Calculate CRC-8/ITU For
+ * ARG:     DataLength: Length Of Data Buffer
+ * ARG:     Mask: Masked Range List (Sorted By Offset; Ranges Beyond DataLength Are Clipped)
+ * ARG:     MaskCount: Number Of Masked Ranges In Masked Range List
+ * NOTE:    Data Is Not Copied Or Modified; Each Masked Range Costs O(log Length) With No Per-Byte Work
+ ****************************************************************************************************/
+uint8_t crc_crc8ItuCalculateMasked(const uint8_t * const Data, const uint16_t DataLength, const crc_mask_t * const Mask, const uint16_t MaskCount)
+{
+    uint8_t crc8Itu = CRC_CRC8_ITU_INITIAL_CRC8_ITU;
+    uint32_t end, i = 0, m, start;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength == 0) || ((Mask == NULL) && (MaskCount != 0)))
+        return CRC_CRC8_ITU_INITIAL_CRC8_ITU;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_ITU, DataLength);
+#endif
+    
+    /*** Calculate CRC-8/ITU Up To Each Masked Range; Shift Over Masked Range ***/
+    for(m = 0; m < MaskCount; m++)
+    {
+        start = (Mask[m].offset > i) ? Mask[m].offset : i;
+        end = (uint32_t)Mask[m].offset + Mask[m].length;
+        if(end > DataLength)
+            end = DataLength;
+        if(end <= start)
+            continue;
+        for(; i < start; i++)
+            crc8Itu = crc_crc8ItuStep(Data[i], crc8Itu);
+        crc8Itu = (uint8_t)crc_genericShiftState(&crc_crc8ItuParameters, crc8Itu, end - start);
+        i = end;
+    }
+    
+    /*** Calculate CRC-8/ITU After Final Masked Range ***/
+    for(; i < DataLength; i++)
+        crc8Itu = crc_crc8ItuStep(Data[i], crc8Itu);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_ITU, metricsStart);
+#endif
+    
+    return (uint8_t)crc_genericCrcFromState(&crc_crc8ItuParameters, crc8Itu);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8ItuCalculateBits
+ * BRIEF:   Calculate Full CRC-8/ITU Over Bit-Granular Data
+ * RETURN:  uint8_t: CRC-8/ITU
+ * ARG:     Data: Data Buffer To Calculate CRC-8/ITU For
+ * ARG:     BitOffset: Offset Of First Bit (Bits Within Byte In Transmission Order: Most Significant Bit First)
+ * ARG:     BitLength: Number Of Bits (BitOffset + BitLength Must Not Exceed UINT32_MAX)
+ * NOTE:    Whole Bytes Use The Byte-Wise Method; Only Leading And Trailing Partial Bytes Are Bitwise
+ ****************************************************************************************************/
+uint8_t crc_crc8ItuCalculateBits(const uint8_t * const Data, const uint32_t BitOffset, const uint32_t BitLength)
+{
+    uint8_t crc8Itu = CRC_CRC8_ITU_INITIAL_CRC8_ITU;
+    uint8_t count;
+    uint32_t bit, end;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((Data == NULL) || (BitLength == 0) || (BitLength > (UINT32_MAX - BitOffset)))
+        return CRC_CRC8_ITU_INITIAL_CRC8_ITU;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_ITU, ((BitLength - 1) / 8) + 1);
+#endif
+    
+    /*** Set Up ***/
+    bit = BitOffset;
+    end = BitOffset + BitLength;
+    
+    /*** Calculate CRC-8/ITU Over Leading Bits (Up To Byte Boundary) ***/
+    if((bit & 0x07) != 0)
+    {
+        count = (uint8_t)(8 - (bit & 0x07));
+        if(count > (end - bit))
+            count = (uint8_t)(end - bit);
+        crc8Itu = (uint8_t)crc_genericUpdateBits(&crc_crc8ItuParameters, crc8Itu, Data[bit >> 3], (uint8_t)(bit & 0x07), count);
+        bit += count;
+    }
+    
+    /*** Calculate CRC-8/ITU Over Whole Bytes ***/
+    for(; (end - bit) >= 8; bit += 8)
+        crc8Itu = crc_crc8ItuStep(Data[bit >> 3], crc8Itu);
+    
+    /*** Calculate CRC-8/ITU Over Trailing Bits ***/
+    if(bit < end)
+        crc8Itu = (uint8_t)crc_genericUpdateBits(&crc_crc8ItuParameters, crc8Itu, Data[bit >> 3], 0, (uint8_t)(end - bit));
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_ITU, metricsStart);
+#endif
+    
+    return (uint8_t)crc_genericCrcFromState(&crc_crc8ItuParameters, crc8Itu);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8ItuCalculatePartialBits
+ * BRIEF:   Calculate Partial CRC-8/ITU Over Bit-Granular Data
+ * RETURN:  uint8_t: Current/Final CRC-8/ITU
+ * ARG:     Data: Data Byte Containing Bits (First Bits In Transmission Order: Most Significant Bit First)
+ * ARG:     BitLength: Number Of Bits (1 ... 8)
+ * ARG:     crc8Itu: Current CRC-8/ITU
+ * ARG:     Final: Final Data
+ * NOTE:    Set CRC-8/ITU Value To CRC_CRC8_ITU_INITIAL_CRC8_ITU If First Data Bits;
+ *          Returned CRC-8/ITU Value Should Be Used On Subsequent Data Bits; May Be Mixed With
+ *          crc_crc8ItuCalculatePartial For Whole Bytes
+ ****************************************************************************************************/
+uint8_t crc_crc8ItuCalculatePartialBits(const uint8_t Data, const uint8_t BitLength, uint8_t crc8Itu, const bool Final)
+{
+    /*** Error Check ***/
+    if(BitLength == 0)
+        return crc8Itu;
+    else if(BitLength >= 8)
+        return crc_crc8ItuCalculatePartial(Data, crc8Itu, Final);
+    
+    /*** Calculate Partial CRC-8/ITU ***/
+    crc8Itu = (uint8_t)crc_genericUpdateBits(&crc_crc8ItuParameters, crc8Itu, Data, 0, BitLength);
+    
+    /*** Convert To CRC-8/ITU On Final Data ***/
+    if(Final)
+        crc8Itu = (uint8_t)crc_genericCrcFromState(&crc_crc8ItuParameters, crc8Itu);
+    
+    return crc8Itu;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8ItuVerify
+ * BRIEF:   Verify Data Followed By Its CRC-8/ITU
+ * RETURN:  bool: True If CRC-8/ITU Matches
+ * ARG:     Data: Data Buffer With CRC-8/ITU In Trailing Byte
+ * ARG:     DataLength: Length Of Data Buffer Including CRC-8/ITU
+ * NOTE:    Runs Over Data And CRC-8/ITU In One Pass And Compares Against The Residue Constant
+ ****************************************************************************************************/
+bool crc_crc8ItuVerify(const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8Itu = CRC_CRC8_ITU_INITIAL_CRC8_ITU;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength < 1))
+        return false;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_ITU, DataLength);
+#endif
+    
+    /*** Calculate Partial CRC-8/ITU Over Data And CRC-8/ITU ***/
+    for(i = 0; i < DataLength; i++)
+        crc8Itu = crc_crc8ItuStep(Data[i], crc8Itu);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_ITU, metricsStart);
+#endif
+    
+    return (crc8Itu == CRC_CRC8_ITU_RESIDUE);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8ItuForge
+ * BRIEF:   Patch Data So That Its CRC-8/ITU Equals Target
+ * RETURN:  bool: True If Data Patched
+ * ARG:     data: Data Buffer To Patch
+ * ARG:     DataLength: Length Of Data Buffer
+ * ARG:     Offset: Offset Of 1 Patch Byte (Overwritten)
+ * ARG:     crc8Itu: Current CRC-8/ITU Of Data (Including Original Patch Bytes)
+ * ARG:     Target: CRC-8/ITU To Reach
+ * NOTE:    Patch Is Solved Directly In O(log DataLength) From The Current CRC-8/ITU; Data Outside The
+ *          Patch Bytes Is Not Read, So A Wrong Current CRC-8/ITU Gives A Wrong Patch
+ ****************************************************************************************************/
+bool crc_crc8ItuForge(uint8_t * const data, const uint16_t DataLength, const uint16_t Offset, const uint8_t crc8Itu, const uint8_t Target)
+{
+    /*** Error Check ***/
+    if((data == NULL) || (DataLength < 1) || (Offset > (DataLength - 1)))
+        return false;
+    
+    /*** Solve Patch Bytes For Target CRC-8/ITU ***/
+    return crc_genericForge(&crc_crc8ItuParameters, crc8Itu, Target, (uint32_t)(DataLength - Offset - 1), &data[Offset]);
+}
+#endif
+
+#if defined(CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_MAXIM_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crc_crc8MaximCalculate
+ * BRIEF:   Calculate Full CRC-8/MAXIM
+ * RETURN:  uint8_t: CRC-8/MAXIM
+ * ARG:     Data: Data Buffer To Calculate CRC-8/MAXIM For
+ * ARG:     DataLength: Length Of Data Buffer
+ ****************************************************************************************************/
+uint8_t crc_crc8MaximCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8Maxim = CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength == 0))
+        return CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_MAXIM, DataLength);
+#endif
+
+    /*** Calculate CRC-8/MAXIM ***/
+#ifdef CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD
+    if(DataLength == CRC_CRC8_MAXIM_ROM_ID_LENGTH)
+        crc8Maxim = crc_crc8MaximCalculateRomId(Data);
+    else
+#endif
+    {
+        for(i = 0; i < DataLength; i++)
+            crc8Maxim = crc_crc8MaximStep(Data[i], crc8Maxim);
+        crc8Maxim = crc_crc8MaximFinal(crc8Maxim);
+    }
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_MAXIM, metricsStart);
+#endif
+
+    return crc8Maxim;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8MaximCalculatePartial
+ * BRIEF:   Calculate Partial CRC-8/MAXIM
+ * RETURN:  uint8_t: Current/Final CRC-8/MAXIM
+ * ARG:     Data: Data To Add To CRC-8/MAXIM Calculation
+ * ARG:     crc8Maxim: Current CRC-8/MAXIM
+ * ARG:     Final: Final Data (Unused If CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD)
+ * NOTE:    Set CRC-8/MAXIM Value To CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM If First Data Byte (Data[0]);
+ *          Returned CRC-8/MAXIM Value Should Be Used On Subsequent Data Bytes (Data[1] ... Data[n])
+ ****************************************************************************************************/
+uint8_t crc_crc8MaximCalculatePartial(const uint8_t Data, uint8_t crc8Maxim, const bool Final)
+{
+    /*** Calculate Partial CRC-8/MAXIM ***/
+    crc8Maxim = crc_crc8MaximStep(Data, crc8Maxim);
+    
+    /*** Convert To Output Form On Final Data ***/
+    if(Final)
+        crc8Maxim = crc_crc8MaximFinal(crc8Maxim);
+    
+    return crc8Maxim;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8MaximModify
+ * BRIEF:   Update CRC-8/MAXIM After In-Place Modification Of Data
+ * RETURN:  uint8_t: CRC-8/MAXIM Of Modified Data
+ * ARG:     crc8Maxim: CRC-8/MAXIM Of Original Data
+ * ARG:     Delta: XOR Of Original And Modified Bytes
+ * ARG:     DeltaLength: Length Of Delta (Number Of Modified Bytes)
+ * ARG:     Distance: Number Of Bytes From End Of Modified Range To End Of Data
+ * NOTE:    Runs In O(DeltaLength + log Distance) Regardless Of Data Length
+ ****************************************************************************************************/
+uint8_t crc_crc8MaximModify(uint8_t crc8Maxim, const uint8_t * const Delta, const uint16_t DeltaLength, const uint32_t Distance)
+{
+    /*** Error Check ***/
+    if((Delta == NULL) || (DeltaLength == 0))
+        return crc8Maxim;
+    
+    /*** Update CRC-8/MAXIM ***/
+    crc8Maxim ^= (uint8_t)crc_genericDelta(&crc_crc8MaximParameters, Delta, DeltaLength, Distance);
+    
+    return crc8Maxim;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8MaximModifyBatch
+ * BRIEF:   Update CRC-8/MAXIM After In-Place Modification Of Data (Multiple Patches)
+ * RETURN:  uint8_t: CRC-8/MAXIM Of Modified Data
+ * ARG:     crc8Maxim: CRC-8/MAXIM Of Original Data
+ * ARG:     Patch: Patch List (Patches May Be In Any Order)
+ * ARG:     PatchCount: Number Of Patches In Patch List
+ * ARG:     DataLength: Length Of Data
+ * NOTE:    Patches Extending Beyond DataLength Are Ignored
+ ****************************************************************************************************/
+uint8_t crc_crc8MaximModifyBatch(uint8_t crc8Maxim, const crc_patch_t * const Patch, const uint16_t PatchCount, const uint32_t DataLength)
+{
+    uint16_t i;
+    
+    /*** Error Check ***/
+    if(Patch == NULL)
+        return crc8Maxim;
+    
+    /*** Update CRC-8/MAXIM For Each Patch ***/
+    for(i = 0; i < PatchCount; i++)
+    {
+        if((Patch[i].delta == NULL) || (Patch[i].offset > DataLength) || (Patch[i].length > (DataLength - Patch[i].offset)))
+            continue;
+        crc8Maxim = crc_crc8MaximModify(crc8Maxim, Patch[i].delta, Patch[i].length, DataLength - Patch[i].offset - Patch[i].length);
+    }
+    
+    return crc8Maxim;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8MaximRollingInitialize
+ * BRIEF:   Initialize Rolling (Sliding Window) CRC-8/MAXIM
+ * RETURN:  bool: Success Or Failure Status
+ * ARG:     Rolling: Rolling Context To Initialize
+ * ARG:     WindowLength: Length Of Sliding Window
+ * NOTE:    Precomputes Tables For WindowLength; Context Can Then Be Shared By Any Number Of Streams
+ ****************************************************************************************************/
+bool crc_crc8MaximRollingInitialize(crc_rolling_t * const Rolling, const uint16_t WindowLength)
+{
+    /*** Error Check ***/
+    if((Rolling == NULL) || (WindowLength == 0))
+        return false;
+    
+    /*** Initialize Rolling CRC-8/MAXIM ***/
+    crc_genericRollingInitialize(&crc_crc8MaximParameters, Rolling, WindowLength);
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8MaximRollingUpdate
+ * BRIEF:   Slide Rolling CRC-8/MAXIM Window Forward One Byte
+ * RETURN:  uint8_t: CRC-8/MAXIM Of New Window
+ * ARG:     Rolling: Rolling Context (Initialized By crc_crc8MaximRollingInitialize)
+ * ARG:     Out: Data Leaving Window (Oldest Byte)
+ * ARG:     In: Data Entering Window
+ * ARG:     crc8Maxim: CRC-8/MAXIM Of Current Window
+ * NOTE:    Seed With crc_crc8MaximCalculate Of First Window; Runs In O(1) Regardless Of Window Length
+ ****************************************************************************************************/
+uint8_t crc_crc8MaximRollingUpdate(const crc_rolling_t * const Rolling, const uint8_t Out, const uint8_t In, const uint8_t crc8Maxim)
+{
+    /*** Error Check ***/
+    if(Rolling == NULL)
+        return crc8Maxim;
+    
+    /*** Slide Window ***/
+    return (uint8_t)crc_genericRollingUpdate(Rolling, Out, In, crc8Maxim);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8MaximStripPrefix
+ * BRIEF:   Remove Known Prefix From CRC-8/MAXIM
+ * RETURN:  uint8_t: CRC-8/MAXIM Of Data Following Prefix
+ * ARG:     crc8Maxim: CRC-8/MAXIM Of Prefix Followed By Suffix
+ * ARG:     Prefix: Prefix Data Buffer
+ * ARG:     PrefixLength: Length Of Prefix Data Buffer
+ * ARG:     SuffixLength: Length Of Data Following Prefix
+ * NOTE:    Runs In O(PrefixLength + log SuffixLength); Suffix Data Is Not Needed
+ ****************************************************************************************************/
+uint8_t crc_crc8MaximStripPrefix(uint8_t crc8Maxim, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength)
+{
+    uint8_t crc8MaximPrefix = CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM;
+    uint32_t i;
+    
+    /*** Error Check ***/
+    if((Prefix == NULL) || (PrefixLength == 0))
+        return crc8Maxim;
+    else if(SuffixLength == 0)
+        return CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM;
+    
+    /*** Calculate CRC-8/MAXIM Of Prefix ***/
+    for(i = 0; i < PrefixLength; i++)
+        crc8MaximPrefix = crc_crc8MaximStep(Prefix[i], crc8MaximPrefix);
+    crc8MaximPrefix = crc_crc8MaximFinal(crc8MaximPrefix);
+    
+    /*** Strip Prefix ***/
+    crc8Maxim = (uint8_t)crc_genericStripPrefix(&crc_crc8MaximParameters, crc8Maxim, crc8MaximPrefix, SuffixLength);
+    
+    return crc8Maxim;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8MaximUnwind
+ * BRIEF:   Run CRC-8/MAXIM Backward Over Known Trailing Data
+ * RETURN:  uint8_t: CRC-8/MAXIM Of Data Preceding Trailing Data
+ * ARG:     crc8Maxim: CRC-8/MAXIM Of Data Including Trailing Data
+ * ARG:     Data: Trailing Data Buffer
+ * ARG:     DataLength: Length Of Trailing Data Buffer
+ ****************************************************************************************************/
+uint8_t crc_crc8MaximUnwind(uint8_t crc8Maxim, const uint8_t * const Data, const uint16_t DataLength)
+{
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength == 0))
+        return crc8Maxim;
+    
+    /*** Unwind CRC-8/MAXIM ***/
+    crc8Maxim = (uint8_t)crc_genericUnwind(&crc_crc8MaximParameters, crc8Maxim, Data, DataLength);
+    
+    return crc8Maxim;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8MaximPrefixInitialize
+ * BRIEF:   Precompute CRC-8/MAXIM State After Constant Prefix
+ * RETURN:  bool: True If Prefix State Computed
+ * ARG:     prefix: Prefix State
+ * ARG:     Data: Prefix Data Buffer (May Be NULL If DataLength Is Zero)
+ * ARG:     DataLength: Length Of Prefix Data Buffer
+ * NOTE:    The State Is Kept In The Same Form CalculatePartial Passes Between Bytes, Not As A
+ *          Finished CRC, So Resuming From It Is Exact For Every Method
+ ****************************************************************************************************/
+bool crc_crc8MaximPrefixInitialize(crc_prefix_t * const prefix, const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8Maxim = CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM;
+    uint32_t i;
+    
+    /*** Error Check ***/
+    if((prefix == NULL) || ((Data == NULL) && (DataLength != 0)))
+        return false;
+    
+    /*** Calculate CRC-8/MAXIM State Of Prefix; Finish It For CRC Of Prefix ***/
+    for(i = 0; i < DataLength; i++)
+        crc8Maxim = crc_crc8MaximStep(Data[i], crc8Maxim);
+    prefix->state = crc8Maxim;
+    prefix->crc = (DataLength == 0) ? CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM : crc_crc8MaximFinal(crc8Maxim);
+    
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8MaximPrefixCalculate
+ * BRIEF:   Calculate Full CRC-8/MAXIM Of Constant Prefix Followed By Data
+ * RETURN:  uint8_t: CRC-8/MAXIM
+ * ARG:     Prefix: Prefix State From crc_crc8MaximPrefixInitialize
+ * ARG:     Data: Data Buffer Following Prefix
+ * ARG:     DataLength: Length Of Data Buffer
+ * NOTE:    Only Data Is Processed; The Prefix Contribution Is Reused
+ ****************************************************************************************************/
+uint8_t crc_crc8MaximPrefixCalculate(const crc_prefix_t * const Prefix, const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8Maxim;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if(Prefix == NULL)
+        return CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM;
+    if((Data == NULL) || (DataLength == 0))
+        return (uint8_t)Prefix->crc;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_MAXIM, DataLength);
+#endif
+    
+    /*** Resume CRC-8/MAXIM From Prefix State ***/
+    crc8Maxim = (uint8_t)Prefix->state;
+    for(i = 0; i < DataLength; i++)
+        crc8Maxim = crc_crc8MaximStep(Data[i], crc8Maxim);
+    crc8Maxim = crc_crc8MaximFinal(crc8Maxim);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_MAXIM, metricsStart);
+#endif
+    
+    return crc8Maxim;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8MaximCalculateMasked
+ * BRIEF:   Calculate Full CRC-8/MAXIM With Masked Ranges Treated As Zero
+ * RETURN:  uint8_t: CRC-8/MAXIM
+ * ARG:     Data: Data Buffer To Calculate CRC-8/MAXIM For
+ * ARG:     DataLength: Length Of Data Buffer
+ * ARG:     Mask: Masked Range List (Sorted By Offset; Ranges Beyond DataLength Are Clipped)
+ * ARG:     MaskCount: Number Of Masked Ranges In Masked Range List
+ * NOTE:    Data Is Not Copied Or Modified; Each Masked Range Costs O(log Length) With No Per-Byte Work
+ ****************************************************************************************************/
+uint8_t crc_crc8MaximCalculateMasked(const uint8_t * const Data, const uint16_t DataLength, const crc_mask_t * const Mask, const uint16_t MaskCount)
+{
+    uint8_t crc8Maxim = CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM;
+    uint32_t end, i = 0, m, start;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength == 0) || ((Mask == NULL) && (MaskCount != 0)))
+        return CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_MAXIM, DataLength);
+#endif
+    
+    /*** Calculate CRC-8/MAXIM Up To Each Masked Range; Shift Over Masked Range ***/
+    for(m = 0; m < MaskCount; m++)
+    {
+        start = (Mask[m].offset > i) ? Mask[m].offset : i;
+        end = (uint32_t)Mask[m].offset + Mask[m].length;
+        if(end > DataLength)
+            end = DataLength;
+        if(end <= start)
+            continue;
+        for(; i < start; i++)
+            crc8Maxim = crc_crc8MaximStep(Data[i], crc8Maxim);
+        crc8Maxim = (uint8_t)crc_genericShiftState(&crc_crc8MaximParameters, crc8Maxim, end - start);
+        i = end;
+    }
+    
+    /*** Calculate CRC-8/MAXIM After Final Masked Range ***/
+    for(; i < DataLength; i++)
+        crc8Maxim = crc_crc8MaximStep(Data[i], crc8Maxim);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_MAXIM, metricsStart);
+#endif
+    
+    return (uint8_t)crc_genericCrcFromState(&crc_crc8MaximParameters, crc8Maxim);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8MaximCalculateBits
+ * BRIEF:   Calculate Full CRC-8/MAXIM Over Bit-Granular Data
+ * RETURN:  uint8_t: CRC-8/MAXIM
+ * ARG:     Data: Data Buffer To Calculate CRC-8/MAXIM For
+ * ARG:     BitOffset: Offset Of First Bit (Bits Within Byte In Transmission Order: Least Significant Bit First)
+ * ARG:     BitLength: Number Of Bits (BitOffset + BitLength Must Not Exceed UINT32_MAX)
+ * NOTE:    Whole Bytes Use The Byte-Wise Method; Only Leading And Trailing Partial Bytes Are Bitwise
+ ****************************************************************************************************/
+uint8_t crc_crc8MaximCalculateBits(const uint8_t * const Data, const uint32_t BitOffset, const uint32_t BitLength)
+{
+    uint8_t crc8Maxim = CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM;
+    uint8_t count;
+    uint32_t bit, end;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((Data == NULL) || (BitLength == 0) || (BitLength > (UINT32_MAX - BitOffset)))
+        return CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_MAXIM, ((BitLength - 1) / 8) + 1);
+#endif
+    
+    /*** Set Up ***/
+    bit = BitOffset;
+    end = BitOffset + BitLength;
+    
+    /*** Calculate CRC-8/MAXIM Over Leading Bits (Up To Byte Boundary) ***/
+    if((bit & 0x07) != 0)
+    {
+        count = (uint8_t)(8 - (bit & 0x07));
+        if(count > (end - bit))
+            count = (uint8_t)(end - bit);
+        crc8Maxim = (uint8_t)crc_genericUpdateBits(&crc_crc8MaximParameters, crc8Maxim, Data[bit >> 3], (uint8_t)(bit & 0x07), count);
+        bit += count;
+    }
+    
+    /*** Calculate CRC-8/MAXIM Over Whole Bytes ***/
+    for(; (end - bit) >= 8; bit += 8)
+        crc8Maxim = crc_crc8MaximStep(Data[bit >> 3], crc8Maxim);
+    
+    /*** Calculate CRC-8/MAXIM Over Trailing Bits ***/
+    if(bit < end)
+        crc8Maxim = (uint8_t)crc_genericUpdateBits(&crc_crc8MaximParameters, crc8Maxim, Data[bit >> 3], 0, (uint8_t)(end - bit));
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_MAXIM, metricsStart);
+#endif
+    
+    return (uint8_t)crc_genericCrcFromState(&crc_crc8MaximParameters, crc8Maxim);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8MaximCalculatePartialBits
+ * BRIEF:   Calculate Partial CRC-8/MAXIM Over Bit-Granular Data
+ * RETURN:  uint8_t: Current/Final CRC-8/MAXIM
+ * ARG:     Data: Data Byte Containing Bits (First Bits In Transmission Order: Least Significant Bit First)
+ * ARG:     BitLength: Number Of Bits (1 ... 8)
+ * ARG:     crc8Maxim: Current CRC-8/MAXIM
+ * ARG:     Final: Final Data
+ * NOTE:    Set CRC-8/MAXIM Value To CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM If First Data Bits;
+ *          Returned CRC-8/MAXIM Value Should Be Used On Subsequent Data Bits; May Be Mixed With
+ *          crc_crc8MaximCalculatePartial For Whole Bytes
+ ****************************************************************************************************/
+uint8_t crc_crc8MaximCalculatePartialBits(const uint8_t Data, const uint8_t BitLength, uint8_t crc8Maxim, const bool Final)
+{
+    /*** Error Check ***/
+    if(BitLength == 0)
+        return crc8Maxim;
+    else if(BitLength >= 8)
+        return crc_crc8MaximCalculatePartial(Data, crc8Maxim, Final);
+    
+    /*** Calculate Partial CRC-8/MAXIM ***/
+    crc8Maxim = (uint8_t)crc_genericUpdateBits(&crc_crc8MaximParameters, crc8Maxim, Data, 0, BitLength);
+    
+    /*** Convert To CRC-8/MAXIM On Final Data ***/
+    if(Final)
+        crc8Maxim = (uint8_t)crc_genericCrcFromState(&crc_crc8MaximParameters, crc8Maxim);
+    
+    return crc8Maxim;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8MaximVerify
+ * BRIEF:   Verify Data Followed By Its CRC-8/MAXIM
+ * RETURN:  bool: True If CRC-8/MAXIM Matches
+ * ARG:     Data: Data Buffer With CRC-8/MAXIM In Trailing Byte
+ * ARG:     DataLength: Length Of Data Buffer Including CRC-8/MAXIM
+ * NOTE:    Runs Over Data And CRC-8/MAXIM In One Pass And Compares Against The Residue Constant
+ ****************************************************************************************************/
+bool crc_crc8MaximVerify(const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8Maxim = CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength < 1))
+        return false;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_MAXIM, DataLength);
+#endif
+    
+    /*** Calculate Partial CRC-8/MAXIM Over Data And CRC-8/MAXIM ***/
+    for(i = 0; i < DataLength; i++)
+        crc8Maxim = crc_crc8MaximStep(Data[i], crc8Maxim);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_MAXIM, metricsStart);
+#endif
+    
+    return (crc8Maxim == CRC_CRC8_MAXIM_RESIDUE);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8MaximForge
+ * BRIEF:   Patch Data So That Its CRC-8/MAXIM Equals Target
+ * RETURN:  bool: True If Data Patched
+ * ARG:     data: Data Buffer To Patch
+ * ARG:     DataLength: Length Of Data Buffer
+ * ARG:     Offset: Offset Of 1 Patch Byte (Overwritten)
+ * ARG:     crc8Maxim: Current CRC-8/MAXIM Of Data (Including Original Patch Bytes)
+ * ARG:     Target: CRC-8/MAXIM To Reach
+ * NOTE:    Patch Is Solved Directly In O(log DataLength) From The Current CRC-8/MAXIM; Data Outside The
+ *          Patch Bytes Is Not Read, So A Wrong Current CRC-8/MAXIM Gives A Wrong Patch
+ ****************************************************************************************************/
+bool crc_crc8MaximForge(uint8_t * const data, const uint16_t DataLength, const uint16_t Offset, const uint8_t crc8Maxim, const uint8_t Target)
+{
+    /*** Error Check ***/
+    if((data == NULL) || (DataLength < 1) || (Offset > (DataLength - 1)))
+        return false;
+    
+    /*** Solve Patch Bytes For Target CRC-8/MAXIM ***/
+    return crc_genericForge(&crc_crc8MaximParameters, crc8Maxim, Target, (uint32_t)(DataLength - Offset - 1), &data[Offset]);
+}
+#endif
+
+#if defined(CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ROHC_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crc_crc8RohcCalculate
+ * BRIEF:   Calculate Full CRC-8/ROHC
+ * RETURN:  uint8_t: CRC-8/ROHC
+ * ARG:     Data: Data Buffer To Calculate CRC-8/ROHC For
+ * ARG:     DataLength: Length Of Data Buffer
+ ****************************************************************************************************/
+uint8_t crc_crc8RohcCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8Rohc = CRC_CRC8_ROHC_INITIAL_CRC8_ROHC;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength == 0))
+        return CRC_CRC8_ROHC_INITIAL_CRC8_ROHC;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_ROHC, DataLength);
+#endif
+
+    /*** Calculate CRC-8/ROHC ***/
+    for(i = 0; i < DataLength; i++)
+        crc8Rohc = crc_crc8RohcStep(Data[i], crc8Rohc);
+    crc8Rohc = crc_crc8RohcFinal(crc8Rohc);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_ROHC, metricsStart);
+#endif
+
+    return crc8Rohc;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8RohcCalculatePartial
+ * BRIEF:   Calculate Partial CRC-8/ROHC
+ * RETURN:  uint8_t: Current/Final CRC-8/ROHC
+ * ARG:     Data: Data To Add To CRC-8/ROHC Calculation
+ * ARG:     crc8Rohc: Current CRC-8/ROHC
+ * ARG:     Final: Final Data (Unused If CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD)
+ * NOTE:    Set CRC-8/ROHC Value To CRC_CRC8_ROHC_INITIAL_CRC8_ROHC If First Data Byte (Data[0]);
+ *          Returned CRC-8/ROHC Value Should Be Used On Subsequent Data Bytes (Data[1] ... Data[n])
+ ****************************************************************************************************/
+uint8_t crc_crc8RohcCalculatePartial(const uint8_t Data, uint8_t crc8Rohc, const bool Final)
+{
+    /*** Calculate Partial CRC-8/ROHC ***/
+    crc8Rohc = crc_crc8RohcStep(Data, crc8Rohc);
+    
+    /*** Convert To Output Form On Final Data ***/
+    if(Final)
+        crc8Rohc = crc_crc8RohcFinal(crc8Rohc);
+    
+    return crc8Rohc;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8RohcModify
+ * BRIEF:   Update CRC-8/ROHC After In-Place Modification Of Data
+ * RETURN:  uint8_t: CRC-8/ROHC Of Modified Data
+ * ARG:     crc8Rohc: CRC-8/ROHC Of Original Data
+ * ARG:     Delta: XOR Of Original And Modified Bytes
+ * ARG:     DeltaLength: Length Of Delta (Number Of Modified Bytes)
+ * ARG:     Distance: Number Of Bytes From End Of Modified Range To End Of Data
+ * NOTE:    Runs In O(DeltaLength + log Distance) Regardless Of Data Length
+ ****************************************************************************************************/
+uint8_t crc_crc8RohcModify(uint8_t crc8Rohc, const uint8_t * const Delta, const uint16_t DeltaLength, const uint32_t Distance)
+{
+    /*** Error Check ***/
+    if((Delta == NULL) || (DeltaLength == 0))
+        return crc8Rohc;
+    
+    /*** Update CRC-8/ROHC ***/
+    crc8Rohc ^= (uint8_t)crc_genericDelta(&crc_crc8RohcParameters, Delta, DeltaLength, Distance);
+    
+    return crc8Rohc;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8RohcModifyBatch
+ * BRIEF:   Update CRC-8/ROHC After In-Place Modification Of Data (Multiple Patches)
+ * RETURN:  uint8_t: CRC-8/ROHC Of Modified Data
+ * ARG:     crc8Rohc: CRC-8/ROHC Of Original Data
+ * ARG:     Patch: Patch List (Patches May Be In Any Order)
+ * ARG:     PatchCount: Number Of Patches In Patch List
+ * ARG:     DataLength: Length Of Data
+ * NOTE:    Patches Extending Beyond DataLength Are Ignored
+ ****************************************************************************************************/
+uint8_t crc_crc8RohcModifyBatch(uint8_t crc8Rohc, const crc_patch_t * const Patch, const uint16_t PatchCount, const uint32_t DataLength)
+{
+    uint16_t i;
+    
+    /*** Error Check ***/
+    if(Patch == NULL)
+        return crc8Rohc;
+    
+    /*** Update CRC-8/ROHC For Each Patch ***/
+    for(i = 0; i < PatchCount; i++)
+    {
+        if((Patch[i].delta == NULL) || (Patch[i].offset > DataLength) || (Patch[i].length > (DataLength - Patch[i].offset)))
+            continue;
+        crc8Rohc = crc_crc8RohcModify(crc8Rohc, Patch[i].delta, Patch[i].length, DataLength - Patch[i].offset - Patch[i].length);
+    }
+    
+    return crc8Rohc;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8RohcRollingInitialize
+ * BRIEF:   Initialize Rolling (Sliding Window) CRC-8/ROHC
+ * RETURN:  bool: Success Or Failure Status
+ * ARG:     Rolling: Rolling Context To Initialize
+ * ARG:     WindowLength: Length Of Sliding Window
+ * NOTE:    Precomputes Tables For WindowLength; Context Can Then Be Shared By Any Number Of Streams
+ ****************************************************************************************************/
+bool crc_crc8RohcRollingInitialize(crc_rolling_t * const Rolling, const uint16_t WindowLength)
+{
+    /*** Error Check ***/
+    if((Rolling == NULL) || (WindowLength == 0))
+        return false;
+    
+    /*** Initialize Rolling CRC-8/ROHC ***/
+    crc_genericRollingInitialize(&crc_crc8RohcParameters, Rolling, WindowLength);
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8RohcRollingUpdate
+ * BRIEF:   Slide Rolling CRC-8/ROHC Window Forward One Byte
+ * RETURN:  uint8_t: CRC-8/ROHC Of New Window
+ * ARG:     Rolling: Rolling Context (Initialized By crc_crc8RohcRollingInitialize)
+ * ARG:     Out: Data Leaving Window (Oldest Byte)
+ * ARG:     In: Data Entering Window
+ * ARG:     crc8Rohc: CRC-8/ROHC Of Current Window
+ * NOTE:    Seed With crc_crc8RohcCalculate Of First Window; Runs In O(1) Regardless Of Window Length
+ ****************************************************************************************************/
+uint8_t crc_crc8RohcRollingUpdate(const crc_rolling_t * const Rolling, const uint8_t Out, const uint8_t In, const uint8_t crc8Rohc)
+{
+    /*** Error Check ***/
+    if(Rolling == NULL)
+        return crc8Rohc;
+    
+    /*** Slide Window ***/
+    return (uint8_t)crc_genericRollingUpdate(Rolling, Out, In, crc8Rohc);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8RohcStripPrefix
+ * BRIEF:   Remove Known Prefix From CRC-8/ROHC
+ * RETURN:  uint8_t: CRC-8/ROHC Of Data Following Prefix
+ * ARG:     crc8Rohc: CRC-8/ROHC Of Prefix Followed By Suffix
+ * ARG:     Prefix: Prefix Data Buffer
+ * ARG:     PrefixLength: Length Of Prefix Data Buffer
+ * ARG:     SuffixLength: Length Of Data Following Prefix
+ * NOTE:    Runs In O(PrefixLength + log SuffixLength); Suffix Data Is Not Needed
+ ****************************************************************************************************/
+uint8_t crc_crc8RohcStripPrefix(uint8_t crc8Rohc, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength)
+{
+    uint8_t crc8RohcPrefix = CRC_CRC8_ROHC_INITIAL_CRC8_ROHC;
+    uint32_t i;
+    
+    /*** Error Check ***/
+    if((Prefix == NULL) || (PrefixLength == 0))
+        return crc8Rohc;
+    else if(SuffixLength == 0)
+        return CRC_CRC8_ROHC_INITIAL_CRC8_ROHC;
+    
+    /*** Calculate CRC-8/ROHC Of Prefix ***/
+    for(i = 0; i < PrefixLength; i++)
+        crc8RohcPrefix = crc_crc8RohcStep(Prefix[i], crc8RohcPrefix);
+    crc8RohcPrefix = crc_crc8RohcFinal(crc8RohcPrefix);
+    
+    /*** Strip Prefix ***/
+    crc8Rohc = (uint8_t)crc_genericStripPrefix(&crc_crc8RohcParameters, crc8Rohc, crc8RohcPrefix, SuffixLength);
+    
+    return crc8Rohc;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8RohcUnwind
+ * BRIEF:   Run CRC-8/ROHC Backward Over Known Trailing Data
+ * RETURN:  uint8_t: CRC-8/ROHC Of Data Preceding Trailing Data
+ * ARG:     crc8Rohc: CRC-8/ROHC Of Data Including Trailing Data
+ * ARG:     Data: Trailing Data Buffer
+ * ARG:     DataLength: Length Of Trailing Data Buffer
+ ****************************************************************************************************/
+uint8_t crc_crc8RohcUnwind(uint8_t crc8Rohc, const uint8_t * const Data, const uint16_t DataLength)
+{
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength == 0))
+        return crc8Rohc;
+    
+    /*** Unwind CRC-8/ROHC ***/
+    crc8Rohc = (uint8_t)crc_genericUnwind(&crc_crc8RohcParameters, crc8Rohc, Data, DataLength);
+    
+    return crc8Rohc;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8RohcPrefixInitialize
+ * BRIEF:   Precompute CRC-8/ROHC State After Constant Prefix
+ * RETURN:  bool: True If Prefix State Computed
+ * ARG:     prefix: Prefix State
+ * ARG:     Data: Prefix Data Buffer (May Be NULL If DataLength Is Zero)
+ * ARG:     DataLength: Length Of Prefix Data Buffer
+ * NOTE:    The State Is Kept In The Same Form CalculatePartial Passes Between Bytes, Not As A
+ *          Finished CRC, So Resuming From It Is Exact For Every Method
+ ****************************************************************************************************/
+bool crc_crc8RohcPrefixInitialize(crc_prefix_t * const prefix, const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8Rohc = CRC_CRC8_ROHC_INITIAL_CRC8_ROHC;
+    uint32_t i;
+    
+    /*** Error Check ***/
+    if((prefix == NULL) || ((Data == NULL) && (DataLength != 0)))
+        return false;
+    
+    /*** Calculate CRC-8/ROHC State Of Prefix; Finish It For CRC Of Prefix ***/
+    for(i = 0; i < DataLength; i++)
+        crc8Rohc = crc_crc8RohcStep(Data[i], crc8Rohc);
+    prefix->state = crc8Rohc;
+    prefix->crc = (DataLength == 0) ? CRC_CRC8_ROHC_INITIAL_CRC8_ROHC : crc_crc8RohcFinal(crc8Rohc);
+    
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8RohcPrefixCalculate
+ * BRIEF:   Calculate Full CRC-8/ROHC Of Constant Prefix Followed By Data
+ * RETURN:  uint8_t: CRC-8/ROHC
+ * ARG:     Prefix: Prefix State From crc_crc8RohcPrefixInitialize
+ * ARG:     Data: Data Buffer Following Prefix
+ * ARG:     DataLength: Length Of Data Buffer
+ * NOTE:    Only Data Is Processed; The Prefix Contribution Is Reused
+ ****************************************************************************************************/
+uint8_t crc_crc8RohcPrefixCalculate(const crc_prefix_t * const Prefix, const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8Rohc;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if(Prefix == NULL)
+        return CRC_CRC8_ROHC_INITIAL_CRC8_ROHC;
+    if((Data == NULL) || (DataLength == 0))
+        return (uint8_t)Prefix->crc;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_ROHC, DataLength);
+#endif
+    
+    /*** Resume CRC-8/ROHC From Prefix State ***/
+    crc8Rohc = (uint8_t)Prefix->state;
+    for(i = 0; i < DataLength; i++)
+        crc8Rohc = crc_crc8RohcStep(Data[i], crc8Rohc);
+    crc8Rohc = crc_crc8RohcFinal(crc8Rohc);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_ROHC, metricsStart);
+#endif
+    
+    return crc8Rohc;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8RohcCalculateMasked
+ * BRIEF:   Calculate Full CRC-8/ROHC With Masked Ranges Treated As Zero
+ * RETURN:  uint8_t: CRC-8/ROHC
+ * ARG:     Data: Data Buffer To Calculate CRC-8/ROHC For
+ * ARG:     DataLength: Length Of Data Buffer
+ * ARG:     Mask: Masked Range List (Sorted By Offset; Ranges Beyond DataLength Are Clipped)
+ * ARG:     MaskCount: Number Of Masked Ranges In Masked Range List
+ * NOTE:    Data Is Not Copied Or Modified; Each Masked Range Costs O(log Length) With No Per-Byte Work
+ ****************************************************************************************************/
+uint8_t crc_crc8RohcCalculateMasked(const uint8_t * const Data, const uint16_t DataLength, const crc_mask_t * const Mask, const uint16_t MaskCount)
+{
+    uint8_t crc8Rohc = CRC_CRC8_ROHC_INITIAL_CRC8_ROHC;
+    uint32_t end, i = 0, m, start;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength == 0) || ((Mask == NULL) && (MaskCount != 0)))
+        return CRC_CRC8_ROHC_INITIAL_CRC8_ROHC;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_ROHC, DataLength);
+#endif
+    
+    /*** Calculate CRC-8/ROHC Up To Each Masked Range; Shift Over Masked Range ***/
+    for(m = 0; m < MaskCount; m++)
+    {
+        start = (Mask[m].offset > i) ? Mask[m].offset : i;
+        end = (uint32_t)Mask[m].offset + Mask[m].length;
+        if(end > DataLength)
+            end = DataLength;
+        if(end <= start)
+            continue;
+        for(; i < start; i++)
+            crc8Rohc = crc_crc8RohcStep(Data[i], crc8Rohc);
+        crc8Rohc = (uint8_t)crc_genericShiftState(&crc_crc8RohcParameters, crc8Rohc, end - start);
+        i = end;
+    }
+    
+    /*** Calculate CRC-8/ROHC After Final Masked Range ***/
+    for(; i < DataLength; i++)
+        crc8Rohc = crc_crc8RohcStep(Data[i], crc8Rohc);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_ROHC, metricsStart);
+#endif
+    
+    return (uint8_t)crc_genericCrcFromState(&crc_crc8RohcParameters, crc8Rohc);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8RohcCalculateBits
+ * BRIEF:   Calculate Full CRC-8/ROHC Over Bit-Granular Data
+ * RETURN:  uint8_t: CRC-8/ROHC
+ * ARG:     Data: Data Buffer To Calculate CRC-8/ROHC For
+ * ARG:     BitOffset: Offset Of First Bit (Bits Within Byte In Transmission Order: Least Significant Bit First)
+ * ARG:     BitLength: Number Of Bits (BitOffset + BitLength Must Not Exceed UINT32_MAX)
+ * NOTE:    Whole Bytes Use The Byte-Wise Method; Only Leading And Trailing Partial Bytes Are Bitwise
+ ****************************************************************************************************/
+uint8_t crc_crc8RohcCalculateBits(const uint8_t * const Data, const uint32_t BitOffset, const uint32_t BitLength)
+{
+    uint8_t crc8Rohc = CRC_CRC8_ROHC_INITIAL_CRC8_ROHC;
+    uint8_t count;
+    uint32_t bit, end;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((Data == NULL) || (BitLength == 0) || (BitLength > (UINT32_MAX - BitOffset)))
+        return CRC_CRC8_ROHC_INITIAL_CRC8_ROHC;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_ROHC, ((BitLength - 1) / 8) + 1);
+#endif
+    
+    /*** Set Up ***/
+    bit = BitOffset;
+    end = BitOffset + BitLength;
+    
+    /*** Calculate CRC-8/ROHC Over Leading Bits (Up To Byte Boundary) ***/
+    if((bit & 0x07) != 0)
+    {
+        count = (uint8_t)(8 - (bit & 0x07));
+        if(count > (end - bit))
+            count = (uint8_t)(end - bit);
+        crc8Rohc = (uint8_t)crc_genericUpdateBits(&crc_crc8RohcParameters, crc8Rohc, Data[bit >> 3], (uint8_t)(bit & 0x07), count);
+        bit += count;
+    }
+    
+    /*** Calculate CRC-8/ROHC Over Whole Bytes ***/
+    for(; (end - bit) >= 8; bit += 8)
+        crc8Rohc = crc_crc8RohcStep(Data[bit >> 3], crc8Rohc);
+    
+    /*** Calculate CRC-8/ROHC Over Trailing Bits ***/
+    if(bit < end)
+        crc8Rohc = (uint8_t)crc_genericUpdateBits(&crc_crc8RohcParameters, crc8Rohc, Data[bit >> 3], 0, (uint8_t)(end - bit));
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_ROHC, metricsStart);
+#endif
+    
+    return (uint8_t)crc_genericCrcFromState(&crc_crc8RohcParameters, crc8Rohc);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8RohcCalculatePartialBits
+ * BRIEF:   Calculate Partial CRC-8/ROHC Over Bit-Granular Data
+ * RETURN:  uint8_t: Current/Final CRC-8/ROHC
+ * ARG:     Data: Data Byte Containing Bits (First Bits In Transmission Order: Least Significant Bit First)
+ * ARG:     BitLength: Number Of Bits (1 ... 8)
+ * ARG:     crc8Rohc: Current CRC-8/ROHC
+ * ARG:     Final: Final Data
+ * NOTE:    Set CRC-8/ROHC Value To CRC_CRC8_ROHC_INITIAL_CRC8_ROHC If First Data Bits;
+ *          Returned CRC-8/ROHC Value Should Be Used On Subsequent Data Bits; May Be Mixed With
+ *          crc_crc8RohcCalculatePartial For Whole Bytes
+ ****************************************************************************************************/
+uint8_t crc_crc8RohcCalculatePartialBits(const uint8_t Data, const uint8_t BitLength, uint8_t crc8Rohc, const bool Final)
+{
+    /*** Error Check ***/
+    if(BitLength == 0)
+        return crc8Rohc;
+    else if(BitLength >= 8)
+        return crc_crc8RohcCalculatePartial(Data, crc8Rohc, Final);
+    
+    /*** Calculate Partial CRC-8/ROHC ***/
+    crc8Rohc = (uint8_t)crc_genericUpdateBits(&crc_crc8RohcParameters, crc8Rohc, Data, 0, BitLength);
+    
+    /*** Convert To CRC-8/ROHC On Final Data ***/
+    if(Final)
+        crc8Rohc = (uint8_t)crc_genericCrcFromState(&crc_crc8RohcParameters, crc8Rohc);
+    
+    return crc8Rohc;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8RohcVerify
+ * BRIEF:   Verify Data Followed By Its CRC-8/ROHC
+ * RETURN:  bool: True If CRC-8/ROHC Matches
+ * ARG:     Data: Data Buffer With CRC-8/ROHC In Trailing Byte
+ * ARG:     DataLength: Length Of Data Buffer Including CRC-8/ROHC
+ * NOTE:    Runs Over Data And CRC-8/ROHC In One Pass And Compares Against The Residue Constant
+ ****************************************************************************************************/
+bool crc_crc8RohcVerify(const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8Rohc = CRC_CRC8_ROHC_INITIAL_CRC8_ROHC;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength < 1))
+        return false;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_ROHC, DataLength);
+#endif
+    
+    /*** Calculate Partial CRC-8/ROHC Over Data And CRC-8/ROHC ***/
+    for(i = 0; i < DataLength; i++)
+        crc8Rohc = crc_crc8RohcStep(Data[i], crc8Rohc);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_ROHC, metricsStart);
+#endif
+    
+    return (crc8Rohc == CRC_CRC8_ROHC_RESIDUE);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8RohcForge
+ * BRIEF:   Patch Data So That Its CRC-8/ROHC Equals Target
+ * RETURN:  bool: True If Data Patched
+ * ARG:     data: Data Buffer To Patch
+ * ARG:     DataLength: Length Of Data Buffer
+ * ARG:     Offset: Offset Of 1 Patch Byte (Overwritten)
+ * ARG:     crc8Rohc: Current CRC-8/ROHC Of Data (Including Original Patch Bytes)
+ * ARG:     Target: CRC-8/ROHC To Reach
+ * NOTE:    Patch Is Solved Directly In O(log DataLength) From The Current CRC-8/ROHC; Data Outside The
+ *          Patch Bytes Is Not Read, So A Wrong Current CRC-8/ROHC Gives A Wrong Patch
+ ****************************************************************************************************/
+bool crc_crc8RohcForge(uint8_t * const data, const uint16_t DataLength, const uint16_t Offset, const uint8_t crc8Rohc, const uint8_t Target)
+{
+    /*** Error Check ***/
+    if((data == NULL) || (DataLength < 1) || (Offset > (DataLength - 1)))
+        return false;
+    
+    /*** Solve Patch Bytes For Target CRC-8/ROHC ***/
+    return crc_genericForge(&crc_crc8RohcParameters, crc8Rohc, Target, (uint32_t)(DataLength - Offset - 1), &data[Offset]);
+}
+#endif
+
+#if defined(CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_WCDMA_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crc_crc8WcdmaCalculate
+ * BRIEF:   Calculate Full CRC-8/WCDMA
+ * RETURN:  uint8_t: CRC-8/WCDMA
+ * ARG:     Data: Data Buffer To Calculate CRC-8/WCDMA For
+ * ARG:     DataLength: Length Of Data Buffer
+ ****************************************************************************************************/
+uint8_t crc_crc8WcdmaCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8Wcdma = CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength == 0))
+        return CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_WCDMA, DataLength);
+#endif
+
+    /*** Calculate CRC-8/WCDMA ***/
+    for(i = 0; i < DataLength; i++)
+        crc8Wcdma = crc_crc8WcdmaStep(Data[i], crc8Wcdma);
+    crc8Wcdma = crc_crc8WcdmaFinal(crc8Wcdma);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_WCDMA, metricsStart);
+#endif
+
+    return crc8Wcdma;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8WcdmaCalculatePartial
+ * BRIEF:   Calculate Partial CRC-8/WCDMA
+ * RETURN:  uint8_t: Current/Final CRC-8/WCDMA
+ * ARG:     Data: Data To Add To CRC-8/WCDMA Calculation
+ * ARG:     crc8Wcdma: Current CRC-8/WCDMA
+ * ARG:     Final: Final Data (Unused If CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD)
+ * NOTE:    Set CRC-8/WCDMA Value To CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA If First Data Byte (Data[0]);
+ *          Returned CRC-8/WCDMA Value Should Be Used On Subsequent Data Bytes (Data[1] ... Data[n])
+ ****************************************************************************************************/
+uint8_t crc_crc8WcdmaCalculatePartial(const uint8_t Data, uint8_t crc8Wcdma, const bool Final)
+{
+    /*** Calculate Partial CRC-8/WCDMA ***/
+    crc8Wcdma = crc_crc8WcdmaStep(Data, crc8Wcdma);
+    
+    /*** Convert To Output Form On Final Data ***/
+    if(Final)
+        crc8Wcdma = crc_crc8WcdmaFinal(crc8Wcdma);
+    
+    return crc8Wcdma;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8WcdmaModify
+ * BRIEF:   Update CRC-8/WCDMA After In-Place Modification Of Data
+ * RETURN:  uint8_t: CRC-8/WCDMA Of Modified Data
+ * ARG:     crc8Wcdma: CRC-8/WCDMA Of Original Data
+ * ARG:     Delta: XOR Of Original And Modified Bytes
+ * ARG:     DeltaLength: Length Of Delta (Number Of Modified Bytes)
+ * ARG:     Distance: Number Of Bytes From End Of Modified Range To End Of Data
+ * NOTE:    Runs In O(DeltaLength + log Distance) Regardless Of Data Length
+ ****************************************************************************************************/
+uint8_t crc_crc8WcdmaModify(uint8_t crc8Wcdma, const uint8_t * const Delta, const uint16_t DeltaLength, const uint32_t Distance)
+{
+    /*** Error Check ***/
+    if((Delta == NULL) || (DeltaLength == 0))
+        return crc8Wcdma;
+    
+    /*** Update CRC-8/WCDMA ***/
+    crc8Wcdma ^= (uint8_t)crc_genericDelta(&crc_crc8WcdmaParameters, Delta, DeltaLength, Distance);
+    
+    return crc8Wcdma;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8WcdmaModifyBatch
+ * BRIEF:   Update CRC-8/WCDMA After In-Place Modification Of Data (Multiple Patches)
+ * RETURN:  uint8_t: CRC-8/WCDMA Of Modified Data
+ * ARG:     crc8Wcdma: CRC-8/WCDMA Of Original Data
+ * ARG:     Patch: Patch List (Patches May Be In Any Order)
+ * ARG:     PatchCount: Number Of Patches In Patch List
+ * ARG:     DataLength: Length Of Data
+ * NOTE:    Patches Extending Beyond DataLength Are Ignored
+ ****************************************************************************************************/
+uint8_t crc_crc8WcdmaModifyBatch(uint8_t crc8Wcdma, const crc_patch_t * const Patch, const uint16_t PatchCount, const uint32_t DataLength)
+{
+    uint16_t i;
+    
+    /*** Error Check ***/
+    if(Patch == NULL)
+        return crc8Wcdma;
+    
+    /*** Update CRC-8/WCDMA For Each Patch ***/
+    for(i = 0; i < PatchCount; i++)
+    {
+        if((Patch[i].delta == NULL) || (Patch[i].offset > DataLength) || (Patch[i].length > (DataLength - Patch[i].offset)))
+            continue;
+        crc8Wcdma = crc_crc8WcdmaModify(crc8Wcdma, Patch[i].delta, Patch[i].length, DataLength - Patch[i].offset - Patch[i].length);
+    }
+    
+    return crc8Wcdma;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8WcdmaRollingInitialize
+ * BRIEF:   Initialize Rolling (Sliding Window) CRC-8/WCDMA
+ * RETURN:  bool: Success Or Failure Status
+ * ARG:     Rolling: Rolling Context To Initialize
+ * ARG:     WindowLength: Length Of Sliding Window
+ * NOTE:    Precomputes Tables For WindowLength; Context Can Then Be Shared By Any Number Of Streams
+ ****************************************************************************************************/
+bool crc_crc8WcdmaRollingInitialize(crc_rolling_t * const Rolling, const uint16_t WindowLength)
+{
+    /*** Error Check ***/
+    if((Rolling == NULL) || (WindowLength == 0))
+        return false;
+    
+    /*** Initialize Rolling CRC-8/WCDMA ***/
+    crc_genericRollingInitialize(&crc_crc8WcdmaParameters, Rolling, WindowLength);
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8WcdmaRollingUpdate
+ * BRIEF:   Slide Rolling CRC-8/WCDMA Window Forward One Byte
+ * RETURN:  uint8_t: CRC-8/WCDMA Of New Window
+ * ARG:     Rolling: Rolling Context (Initialized By crc_crc8WcdmaRollingInitialize)
+ * ARG:     Out: Data Leaving Window (Oldest Byte)
+ * ARG:     In: Data Entering Window
+ * ARG:     crc8Wcdma: CRC-8/WCDMA Of Current Window
+ * NOTE:    Seed With crc_crc8WcdmaCalculate Of First Window; Runs In O(1) Regardless Of Window Length
+ ****************************************************************************************************/
+uint8_t crc_crc8WcdmaRollingUpdate(const crc_rolling_t * const Rolling, const uint8_t Out, const uint8_t In, const uint8_t crc8Wcdma)
+{
+    /*** Error Check ***/
+    if(Rolling == NULL)
+        return crc8Wcdma;
+    
+    /*** Slide Window ***/
+    return (uint8_t)crc_genericRollingUpdate(Rolling, Out, In, crc8Wcdma);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8WcdmaStripPrefix
+ * BRIEF:   Remove Known Prefix From CRC-8/WCDMA
+ * RETURN:  uint8_t: CRC-8/WCDMA Of Data Following Prefix
+ * ARG:     crc8Wcdma: CRC-8/WCDMA Of Prefix Followed By Suffix
+ * ARG:     Prefix: Prefix Data Buffer
+ * ARG:     PrefixLength: Length Of Prefix Data Buffer
+ * ARG:     SuffixLength: Length Of Data Following Prefix
+ * NOTE:    Runs In O(PrefixLength + log SuffixLength); Suffix Data Is Not Needed
+ ****************************************************************************************************/
+uint8_t crc_crc8WcdmaStripPrefix(uint8_t crc8Wcdma, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength)
+{
+    uint8_t crc8WcdmaPrefix = CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA;
+    uint32_t i;
+    
+    /*** Error Check ***/
+    if((Prefix == NULL) || (PrefixLength == 0))
+        return crc8Wcdma;
+    else if(SuffixLength == 0)
+        return CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA;
+    
+    /*** Calculate CRC-8/WCDMA Of Prefix ***/
+    for(i = 0; i < PrefixLength; i++)
+        crc8WcdmaPrefix = crc_crc8WcdmaStep(Prefix[i], crc8WcdmaPrefix);
+    crc8WcdmaPrefix = crc_crc8WcdmaFinal(crc8WcdmaPrefix);
+    
+    /*** Strip Prefix ***/
+    crc8Wcdma = (uint8_t)crc_genericStripPrefix(&crc_crc8WcdmaParameters, crc8Wcdma, crc8WcdmaPrefix, SuffixLength);
+    
+    return crc8Wcdma;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8WcdmaUnwind
+ * BRIEF:   Run CRC-8/WCDMA Backward Over Known Trailing Data
+ * RETURN:  uint8_t: CRC-8/WCDMA Of Data Preceding Trailing Data
+ * ARG:     crc8Wcdma: CRC-8/WCDMA Of Data Including Trailing Data
+ * ARG:     Data: Trailing Data Buffer
+ * ARG:     DataLength: Length Of Trailing Data Buffer
+ ****************************************************************************************************/
+uint8_t crc_crc8WcdmaUnwind(uint8_t crc8Wcdma, const uint8_t * const Data, const uint16_t DataLength)
+{
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength == 0))
+        return crc8Wcdma;
+    
+    /*** Unwind CRC-8/WCDMA ***/
+    crc8Wcdma = (uint8_t)crc_genericUnwind(&crc_crc8WcdmaParameters, crc8Wcdma, Data, DataLength);
+    
+    return crc8Wcdma;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8WcdmaPrefixInitialize
+ * BRIEF:   Precompute CRC-8/WCDMA State After Constant Prefix
+ * RETURN:  bool: True If Prefix State Computed
+ * ARG:     prefix: Prefix State
+ * ARG:     Data: Prefix Data Buffer (May Be NULL If DataLength Is Zero)
+ * ARG:     DataLength: Length Of Prefix Data Buffer
+ * NOTE:    The State Is Kept In The Same Form CalculatePartial Passes Between Bytes, Not As A
+ *          Finished CRC, So Resuming From It Is Exact For Every Method
+ ****************************************************************************************************/
+bool crc_crc8WcdmaPrefixInitialize(crc_prefix_t * const prefix, const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8Wcdma = CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA;
+    uint32_t i;
+    
+    /*** Error Check ***/
+    if((prefix == NULL) || ((Data == NULL) && (DataLength != 0)))
+        return false;
+    
+    /*** Calculate CRC-8/WCDMA State Of Prefix; Finish It For CRC Of Prefix ***/
+    for(i = 0; i < DataLength; i++)
+        crc8Wcdma = crc_crc8WcdmaStep(Data[i], crc8Wcdma);
+    prefix->state = crc8Wcdma;
+    prefix->crc = (DataLength == 0) ? CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA : crc_crc8WcdmaFinal(crc8Wcdma);
+    
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8WcdmaPrefixCalculate
+ * BRIEF:   Calculate Full CRC-8/WCDMA Of Constant Prefix Followed By Data
+ * RETURN:  uint8_t: CRC-8/WCDMA
+ * ARG:     Prefix: Prefix State From crc_crc8WcdmaPrefixInitialize
+ * ARG:     Data: Data Buffer Following Prefix
+ * ARG:     DataLength: Length Of Data Buffer
+ * NOTE:    Only Data Is Processed; The Prefix Contribution Is Reused
+ ****************************************************************************************************/
+uint8_t crc_crc8WcdmaPrefixCalculate(const crc_prefix_t * const Prefix, const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8Wcdma;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if(Prefix == NULL)
+        return CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA;
+    if((Data == NULL) || (DataLength == 0))
+        return (uint8_t)Prefix->crc;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_WCDMA, DataLength);
+#endif
+    
+    /*** Resume CRC-8/WCDMA From Prefix State ***/
+    crc8Wcdma = (uint8_t)Prefix->state;
+    for(i = 0; i < DataLength; i++)
+        crc8Wcdma = crc_crc8WcdmaStep(Data[i], crc8Wcdma);
+    crc8Wcdma = crc_crc8WcdmaFinal(crc8Wcdma);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_WCDMA, metricsStart);
+#endif
+    
+    return crc8Wcdma;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8WcdmaCalculateMasked
+ * BRIEF:   Calculate Full CRC-8/WCDMA With Masked Ranges Treated As Zero
+ * RETURN:  uint8_t: CRC-8/WCDMA
+ * ARG:     Data: Data Buffer To Calculate CRC-8/WCDMA For
+ * ARG:     DataLength: Length Of Data Buffer
+ * ARG:     Mask: Masked Range List (Sorted By Offset; Ranges Beyond DataLength Are Clipped)
+ * ARG:     MaskCount: Number Of Masked Ranges In Masked Range List
+ * NOTE:    Data Is Not Copied Or Modified; Each Masked Range Costs O(log Length) With No Per-Byte Work
+ ****************************************************************************************************/
+uint8_t crc_crc8WcdmaCalculateMasked(const uint8_t * const Data, const uint16_t DataLength, const crc_mask_t * const Mask, const uint16_t MaskCount)
+{
+    uint8_t crc8Wcdma = CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA;
+    uint32_t end, i = 0, m, start;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength == 0) || ((Mask == NULL) && (MaskCount != 0)))
+        return CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_WCDMA, DataLength);
+#endif
+    
+    /*** Calculate CRC-8/WCDMA Up To Each Masked Range; Shift Over Masked Range ***/
+    for(m = 0; m < MaskCount; m++)
+    {
+        start = (Mask[m].offset > i) ? Mask[m].offset : i;
+        end = (uint32_t)Mask[m].offset + Mask[m].length;
+        if(end > DataLength)
+            end = DataLength;
+        if(end <= start)
+            continue;
+        for(; i < start; i++)
+            crc8Wcdma = crc_crc8WcdmaStep(Data[i], crc8Wcdma);
+        crc8Wcdma = (uint8_t)crc_genericShiftState(&crc_crc8WcdmaParameters, crc8Wcdma, end - start);
+        i = end;
+    }
+    
+    /*** Calculate CRC-8/WCDMA After Final Masked Range ***/
+    for(; i < DataLength; i++)
+        crc8Wcdma = crc_crc8WcdmaStep(Data[i], crc8Wcdma);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_WCDMA, metricsStart);
+#endif
+    
+    return (uint8_t)crc_genericCrcFromState(&crc_crc8WcdmaParameters, crc8Wcdma);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8WcdmaCalculateBits
+ * BRIEF:   Calculate Full CRC-8/WCDMA Over Bit-Granular Data
+ * RETURN:  uint8_t: CRC-8/WCDMA
+ * ARG:     Data: Data Buffer To Calculate CRC-8/WCDMA For
+ * ARG:     BitOffset: Offset Of First Bit (Bits Within Byte In Transmission Order: Least Significant Bit First)
+ * ARG:     BitLength: Number Of Bits (BitOffset + BitLength Must Not Exceed UINT32_MAX)
+ * NOTE:    Whole Bytes Use The Byte-Wise Method; Only Leading And Trailing Partial Bytes Are Bitwise
+ ****************************************************************************************************/
+uint8_t crc_crc8WcdmaCalculateBits(const uint8_t * const Data, const uint32_t BitOffset, const uint32_t BitLength)
+{
+    uint8_t crc8Wcdma = CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA;
+    uint8_t count;
+    uint32_t bit, end;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((Data == NULL) || (BitLength == 0) || (BitLength > (UINT32_MAX - BitOffset)))
+        return CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_WCDMA, ((BitLength - 1) / 8) + 1);
+#endif
+    
+    /*** Set Up ***/
+    bit = BitOffset;
+    end = BitOffset + BitLength;
+    
+    /*** Calculate CRC-8/WCDMA Over Leading Bits (Up To Byte Boundary) ***/
+    if((bit & 0x07) != 0)
+    {
+        count = (uint8_t)(8 - (bit & 0x07));
+        if(count > (end - bit))
+            count = (uint8_t)(end - bit);
+        crc8Wcdma = (uint8_t)crc_genericUpdateBits(&crc_crc8WcdmaParameters, crc8Wcdma, Data[bit >> 3], (uint8_t)(bit & 0x07), count);
+        bit += count;
+    }
+    
+    /*** Calculate CRC-8/WCDMA Over Whole Bytes ***/
+    for(; (end - bit) >= 8; bit += 8)
+        crc8Wcdma = crc_crc8WcdmaStep(Data[bit >> 3], crc8Wcdma);
+    
+    /*** Calculate CRC-8/WCDMA Over Trailing Bits ***/
+    if(bit < end)
+        crc8Wcdma = (uint8_t)crc_genericUpdateBits(&crc_crc8WcdmaParameters, crc8Wcdma, Data[bit >> 3], 0, (uint8_t)(end - bit));
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_WCDMA, metricsStart);
+#endif
+    
+    return (uint8_t)crc_genericCrcFromState(&crc_crc8WcdmaParameters, crc8Wcdma);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8WcdmaCalculatePartialBits
+ * BRIEF:   Calculate Partial CRC-8/WCDMA Over Bit-Granular Data
+ * RETURN:  uint8_t: Current/Final CRC-8/WCDMA
+ * ARG:     Data: Data Byte Containing Bits (First Bits In Transmission Order: Least Significant Bit First)
+ * ARG:     BitLength: Number Of Bits (1 ... 8)
+ * ARG:     crc8Wcdma: Current CRC-8/WCDMA
+ * ARG:     Final: Final Data
+ * NOTE:    Set CRC-8/WCDMA Value To CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA If First Data Bits;
+ *          Returned CRC-8/WCDMA Value Should Be Used On Subsequent Data Bits; May Be Mixed With
+ *          crc_crc8WcdmaCalculatePartial For Whole Bytes
+ ****************************************************************************************************/
+uint8_t crc_crc8WcdmaCalculatePartialBits(const uint8_t Data, const uint8_t BitLength, uint8_t crc8Wcdma, const bool Final)
+{
+    /*** Error Check ***/
+    if(BitLength == 0)
+        return crc8Wcdma;
+    else if(BitLength >= 8)
+        return crc_crc8WcdmaCalculatePartial(Data, crc8Wcdma, Final);
+    
+    /*** Calculate Partial CRC-8/WCDMA ***/
+    crc8Wcdma = (uint8_t)crc_genericUpdateBits(&crc_crc8WcdmaParameters, crc8Wcdma, Data, 0, BitLength);
+    
+    /*** Convert To CRC-8/WCDMA On Final Data ***/
+    if(Final)
+        crc8Wcdma = (uint8_t)crc_genericCrcFromState(&crc_crc8WcdmaParameters, crc8Wcdma);
+    
+    return crc8Wcdma;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8WcdmaVerify
+ * BRIEF:   Verify Data Followed By Its CRC-8/WCDMA
+ * RETURN:  bool: True If CRC-8/WCDMA Matches
+ * ARG:     Data: Data Buffer With CRC-8/WCDMA In Trailing Byte
+ * ARG:     DataLength: Length Of Data Buffer Including CRC-8/WCDMA
+ * NOTE:    Runs Over Data And CRC-8/WCDMA In One Pass And Compares Against The Residue Constant
+ ****************************************************************************************************/
+bool crc_crc8WcdmaVerify(const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t crc8Wcdma = CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength < 1))
+        return false;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC8_WCDMA, DataLength);
+#endif
+    
+    /*** Calculate Partial CRC-8/WCDMA Over Data And CRC-8/WCDMA ***/
+    for(i = 0; i < DataLength; i++)
+        crc8Wcdma = crc_crc8WcdmaStep(Data[i], crc8Wcdma);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC8_WCDMA, metricsStart);
+#endif
+    
+    return (crc8Wcdma == CRC_CRC8_WCDMA_RESIDUE);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8WcdmaForge
+ * BRIEF:   Patch Data So That Its CRC-8/WCDMA Equals Target
+ * RETURN:  bool: True If Data Patched
+ * ARG:     data: Data Buffer To Patch
+ * ARG:     DataLength: Length Of Data Buffer
+ * ARG:     Offset: Offset Of 1 Patch Byte (Overwritten)
+ * ARG:     crc8Wcdma: Current CRC-8/WCDMA Of Data (Including Original Patch Bytes)
+ * ARG:     Target: CRC-8/WCDMA To Reach
+ * NOTE:    Patch Is Solved Directly In O(log DataLength) From The Current CRC-8/WCDMA; Data Outside The
+ *          Patch Bytes Is Not Read, So A Wrong Current CRC-8/WCDMA Gives A Wrong Patch
+ ****************************************************************************************************/
+bool crc_crc8WcdmaForge(uint8_t * const data, const uint16_t DataLength, const uint16_t Offset, const uint8_t crc8Wcdma, const uint8_t Target)
+{
+    /*** Error Check ***/
+    if((data == NULL) || (DataLength < 1) || (Offset > (DataLength - 1)))
+        return false;
+    
+    /*** Solve Patch Bytes For Target CRC-8/WCDMA ***/
+    return crc_genericForge(&crc_crc8WcdmaParameters, crc8Wcdma, Target, (uint32_t)(DataLength - Offset - 1), &data[Offset]);
+}
+#endif
+
+#if defined(CRC_CRC16_ARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_ARC_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crc_crc16ArcCalculate
+ * BRIEF:   Calculate Full CRC-16/ARC
+ * RETURN:  uint16_t: CRC-16/ARC
+ * ARG:     Data: Data Buffer To Calculate CRC-16/ARC For
+ * ARG:     DataLength: Length Of Data Buffer
+ ****************************************************************************************************/
+uint16_t crc_crc16ArcCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint16_t crc16Arc = CRC_CRC16_ARC_INITIAL_CRC16_ARC;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength == 0))
+        return CRC_CRC16_ARC_INITIAL_CRC16_ARC;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC16_ARC, DataLength);
+#endif
+
+    /*** Calculate CRC-16/ARC ***/
+    for(i = 0; i < DataLength; i++)
+        crc16Arc = crc_crc16ArcStep(Data[i], crc16Arc);
+    crc16Arc = crc_crc16ArcFinal(crc16Arc);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC16_ARC, metricsStart);
+#endif
+
+    return crc16Arc;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc16ArcCalculatePartial
+ * BRIEF:   Calculate Partial CRC-16/ARC
+ * RETURN:  uint16_t: Current/Final CRC-16/ARC
+ * ARG:     Data: Data To Add To CRC-16/ARC Calculation
+ * ARG:     crc16Arc: Current CRC-16/ARC
+ * ARG:     Final: Final Data (Unused If CRC_CRC16_ARC_LOOKUP_TABLE_METHOD)
+ * NOTE:    Set CRC-16/ARC Value To CRC_CRC16_ARC_INITIAL_CRC16_ARC If First Data Byte (Data[0]);
+ *          Returned CRC-16/ARC Value Should Be Used On Subsequent Data Bytes (Data[1] ... Data[n])
+ ****************************************************************************************************/
+uint16_t crc_crc16ArcCalculatePartial(const uint8_t Data, uint16_t crc16Arc, const bool Final)
+{
+    /*** Calculate Partial CRC-16/ARC ***/
+    crc16Arc = crc_crc16ArcStep(Data, crc16Arc);
+    
+    /*** Convert To Output Form On Final Data ***/
+    if(Final)
+        crc16Arc = crc_crc16ArcFinal(crc16Arc);
+    
+    return crc16Arc;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc16ArcModify
+ * BRIEF:   Update CRC-16/ARC After In-Place Modification Of Data
+ * RETURN:  uint16_t: CRC-16/ARC Of Modified Data
+ * ARG:     crc16Arc: CRC-16/ARC Of Original Data
+ * ARG:     Delta: XOR Of Original And Modified Bytes
+ * ARG:     DeltaLength: Length Of Delta (Number Of Modified Bytes)
+ * ARG:     Distance: Number Of Bytes From End Of Modified Range To End Of Data
+ * NOTE:    Runs In O(DeltaLength + log Distance) Regardless Of Data Length
+ ****************************************************************************************************/
+uint16_t crc_crc16ArcModify(uint16_t crc16Arc, const uint8_t * const Delta, const uint16_t DeltaLength, const uint32_t Distance)
+{
+    /*** Error Check ***/
+    if((Delta == NULL) || (DeltaLength == 0))
+        return crc16Arc;
+    
+    /*** Update CRC-16/ARC ***/
+    crc16Arc ^= (uint16_t)crc_genericDelta(&crc_crc16ArcParameters, Delta, DeltaLength, Distance);
+    
+    return crc16Arc;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc16ArcModifyBatch
+ * BRIEF:   Update CRC-16/ARC After In-Place Modification Of Data (Multiple Patches)
+ * RETURN:  uint16_t: CRC-16/ARC Of Modified Data
+ * ARG:     crc16Arc: CRC-16/ARC Of Original Data
+ * ARG:     Patch: Patch List (Patches May Be In Any Order)
+ * ARG:     PatchCount: Number Of Patches In Patch List
+ * ARG:     DataLength: Length Of Data
+ * NOTE:    Patches Extending Beyond DataLength Are Ignored
+ ****************************************************************************************************/
+uint16_t crc_crc16ArcModifyBatch(uint16_t crc16Arc, const crc_patch_t * const Patch, const uint16_t PatchCount, const uint32_t DataLength)
+{
+    uint16_t i;
+    
+    /*** Error Check ***/
+    if(Patch == NULL)
+        return crc16Arc;
+    
+    /*** Update CRC-16/ARC For Each Patch ***/
+    for(i = 0; i < PatchCount; i++)
+    {
+        if((Patch[i].delta == NULL) || (Patch[i].offset > DataLength) || (Patch[i].length > (DataLength - Patch[i].offset)))
+            continue;
+        crc16Arc = crc_crc16ArcModify(crc16Arc, Patch[i].delta, Patch[i].length, DataLength - Patch[i].offset - Patch[i].length);
+    }
+    
+    return crc16Arc;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc16ArcRollingInitialize
+ * BRIEF:   Initialize Rolling (Sliding Window) CRC-16/ARC
+ * RETURN:  bool: Success Or Failure Status
+ * ARG:     Rolling: Rolling Context To Initialize
+ * ARG:     WindowLength: Length Of Sliding Window
+ * NOTE:    Precomputes Tables For WindowLength; Context Can Then Be Shared By Any Number Of Streams
+ ****************************************************************************************************/
+bool crc_crc16ArcRollingInitialize(crc_rolling_t * const Rolling, const uint16_t WindowLength)
+{
+    /*** Error Check ***/
+    if((Rolling == NULL) || (WindowLength == 0))
+        return false;
+    
+    /*** Initialize Rolling CRC-16/ARC ***/
+    crc_genericRollingInitialize(&crc_crc16ArcParameters, Rolling, WindowLength);
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc16ArcRollingUpdate
+ * BRIEF:   Slide Rolling CRC-16/ARC Window Forward One Byte
+ * RETURN:  uint16_t: CRC-16/ARC Of New Window
+ * ARG:     Rolling: Rolling Context (Initialized By crc_crc16ArcRollingInitialize)
+ * ARG:     Out: Data Leaving Window (Oldest Byte)
+ * ARG:     In: Data Entering Window
+ * ARG:     crc16Arc: CRC-16/ARC Of Current Window
+ * NOTE:    Seed With crc_crc16ArcCalculate Of First Window; Runs In O(1) Regardless Of Window Length
+ ****************************************************************************************************/
+uint16_t crc_crc16ArcRollingUpdate(const crc_rolling_t * const Rolling, const uint8_t Out, const uint8_t In, const uint16_t crc16Arc)
+{
+    /*** Error Check ***/
+    if(Rolling == NULL)
+        return crc16Arc;
+    
+    /*** Slide Window ***/
+    return (uint16_t)crc_genericRollingUpdate(Rolling, Out, In, crc16Arc);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc16ArcStripPrefix
+ * BRIEF:   Remove Known Prefix From CRC-16/ARC
+ * RETURN:  uint16_t: CRC-16/ARC Of Data Following Prefix
+ * ARG:     crc16Arc: CRC-16/ARC Of Prefix Followed By Suffix
+ * ARG:     Prefix: Prefix Data Buffer
+ * ARG:     PrefixLength: Length Of Prefix Data Buffer
+ * ARG:     SuffixLength: Length Of Data Following Prefix
+ * NOTE:    Runs In O(PrefixLength + log SuffixLength); Suffix Data Is Not Needed
+ ****************************************************************************************************/
+uint16_t crc_crc16ArcStripPrefix(uint16_t crc16Arc, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength)
+{
+    uint16_t crc16ArcPrefix = CRC_CRC16_ARC_INITIAL_CRC16_ARC;
+    uint32_t i;
+    
+    /*** Error Check ***/
+    if((Prefix == NULL) || (PrefixLength == 0))
+        return crc16Arc;
+    else if(SuffixLength == 0)
+        return CRC_CRC16_ARC_INITIAL_CRC16_ARC;
+    
+    /*** Calculate CRC-16/ARC Of Prefix ***/
+    for(i = 0; i < PrefixLength; i++)
+        crc16ArcPrefix = crc_crc16ArcStep(Prefix[i], crc16ArcPrefix);
+    crc16ArcPrefix = crc_crc16ArcFinal(crc16ArcPrefix);
+    
+    /*** Strip Prefix ***/
+    crc16Arc = (uint16_t)crc_genericStripPrefix(&crc_crc16ArcParameters, crc16Arc, crc16ArcPrefix, SuffixLength);
+    
+    return crc16Arc;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc16ArcUnwind
+ * BRIEF:   Run CRC-16/ARC Backward Over Known Trailing Data
+ * RETURN:  uint16_t: CRC-16/ARC Of Data Preceding Trailing Data
+ * ARG:     crc16Arc: CRC-16/ARC Of Data Including Trailing Data
+ * ARG:     Data: Trailing Data Buffer
+ * ARG:     DataLength: Length Of Trailing Data Buffer
+ ****************************************************************************************************/
+uint16_t crc_crc16ArcUnwind(uint16_t crc16Arc, const uint8_t * const Data, const uint16_t DataLength)
+{
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength == 0))
+        return crc16Arc;
+    
+    /*** Unwind CRC-16/ARC ***/
+    crc16Arc = (uint16_t)crc_genericUnwind(&crc_crc16ArcParameters, crc16Arc, Data, DataLength);
+    
+    return crc16Arc;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc16ArcPrefixInitialize
+ * BRIEF:   Precompute CRC-16/ARC State After Constant Prefix
+ * RETURN:  bool: True If Prefix State Computed
+ * ARG:     prefix: Prefix State
+ * ARG:     Data: Prefix Data Buffer (May Be NULL If DataLength Is Zero)
+ * ARG:     DataLength: Length Of Prefix Data Buffer
+ * NOTE:    The State Is Kept In The Same Form CalculatePartial Passes Between Bytes, Not As A
+ *          Finished CRC, So Resuming From It Is Exact For Every Method
+ ****************************************************************************************************/
+bool crc_crc16ArcPrefixInitialize(crc_prefix_t * const prefix, const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint16_t crc16Arc = CRC_CRC16_ARC_INITIAL_CRC16_ARC;
+    uint32_t i;
+    
+    /*** Error Check ***/
+    if((prefix == NULL) || ((Data == NULL) && (DataLength != 0)))
+        return false;
+    
+    /*** Calculate CRC-16/ARC State Of Prefix; Finish It For CRC Of Prefix ***/
+    for(i = 0; i < DataLength; i++)
+        crc16Arc = crc_crc16ArcStep(Data[i], crc16Arc);
+    prefix->state = crc16Arc;
+    prefix->crc = (DataLength == 0) ? CRC_CRC16_ARC_INITIAL_CRC16_ARC : crc_crc16ArcFinal(crc16Arc);
+    
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc16ArcPrefixCalculate
+ * BRIEF:   Calculate Full CRC-16/ARC Of Constant Prefix Followed By Data
+ * RETURN:  uint16_t: CRC-16/ARC
+ * ARG:     Prefix: Prefix State From crc_crc16ArcPrefixInitialize
+ * ARG:     Data: Data Buffer Following Prefix
+ * ARG:     DataLength: Length Of Data Buffer
+ * NOTE:    Only Data Is Processed; The Prefix Contribution Is Reused
+ ****************************************************************************************************/
+uint16_t crc_crc16ArcPrefixCalculate(const crc_prefix_t * const Prefix, const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint16_t crc16Arc;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if(Prefix == NULL)
+        return CRC_CRC16_ARC_INITIAL_CRC16_ARC;
+    if((Data == NULL) || (DataLength == 0))
+        return Prefix->crc;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC16_ARC, DataLength);
+#endif
+    
+    /*** Resume CRC-16/ARC From Prefix State ***/
+    crc16Arc = Prefix->state;
+    for(i = 0; i < DataLength; i++)
+        crc16Arc = crc_crc16ArcStep(Data[i], crc16Arc);
+    crc16Arc = crc_crc16ArcFinal(crc16Arc);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC16_ARC, metricsStart);
+#endif
+    
+    return crc16Arc;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc16ArcCalculateMasked
+ * BRIEF:   Calculate Full CRC-16/ARC With Masked Ranges Treated As Zero
+ * RETURN:  uint16_t: CRC-16/ARC
+ * ARG:     Data: Data Buffer To Calculate CRC-16/ARC For
+ * ARG:     DataLength: Length Of Data Buffer
+ * ARG:     Mask: Masked Range List (Sorted By Offset; Ranges Beyond DataLength Are Clipped)
+ * ARG:     MaskCount: Number Of Masked Ranges In Masked Range List
+ * NOTE:    Data Is Not Copied Or Modified; Each Masked Range Costs O(log Length) With No Per-Byte Work
+ ****************************************************************************************************/
+uint16_t crc_crc16ArcCalculateMasked(const uint8_t * const Data, const uint16_t DataLength, const crc_mask_t * const Mask, const uint16_t MaskCount)
+{
+    uint16_t crc16Arc = CRC_CRC16_ARC_INITIAL_CRC16_ARC;
+    uint32_t end, i = 0, m, start;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength == 0) || ((Mask == NULL) && (MaskCount != 0)))
+        return CRC_CRC16_ARC_INITIAL_CRC16_ARC;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC16_ARC, DataLength);
+#endif
+    
+    /*** Calculate CRC-16/ARC Up To Each Masked Range; Shift Over Masked Range ***/
+    for(m = 0; m < MaskCount; m++)
+    {
+        start = (Mask[m].offset > i) ? Mask[m].offset : i;
+        end = (uint32_t)Mask[m].offset + Mask[m].length;
+        if(end > DataLength)
+            end = DataLength;
+        if(end <= start)
+            continue;
+        for(; i < start; i++)
+            crc16Arc = crc_crc16ArcStep(Data[i], crc16Arc);
+        crc16Arc = (uint16_t)crc_genericShiftState(&crc_crc16ArcParameters, crc16Arc, end - start);
+        i = end;
+    }
+    
+    /*** Calculate CRC-16/ARC After Final Masked Range ***/
+    for(; i < DataLength; i++)
+        crc16Arc = crc_crc16ArcStep(Data[i], crc16Arc);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC16_ARC, metricsStart);
+#endif
+    
+    return (uint16_t)crc_genericCrcFromState(&crc_crc16ArcParameters, crc16Arc);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc16ArcCalculateBits
+ * BRIEF:   Calculate Full CRC-16/ARC Over Bit-Granular Data
+ * RETURN:  uint16_t: CRC-16/ARC
+ * ARG:     Data: Data Buffer To Calculate CRC-16/ARC For
+ * ARG:     BitOffset: Offset Of First Bit (Bits Within Byte In Transmission Order: Least Significant Bit First)
+ * ARG:     BitLength: Number Of Bits (BitOffset + BitLength Must Not Exceed UINT32_MAX)
+ * NOTE:    Whole Bytes Use The Byte-Wise Method; Only Leading And Trailing Partial Bytes Are Bitwise
+ ****************************************************************************************************/
+uint16_t crc_crc16ArcCalculateBits(const uint8_t * const Data, const uint32_t BitOffset, const uint32_t BitLength)
+{
+    uint16_t crc16Arc = CRC_CRC16_ARC_INITIAL_CRC16_ARC;
+    uint8_t count;
+    uint32_t bit, end;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((Data == NULL) || (BitLength == 0) || (BitLength > (UINT32_MAX - BitOffset)))
+        return CRC_CRC16_ARC_INITIAL_CRC16_ARC;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC16_ARC, ((BitLength - 1) / 8) + 1);
+#endif
+    
+    /*** Set Up ***/
+    bit = BitOffset;
+    end = BitOffset + BitLength;
+    
+    /*** Calculate CRC-16/ARC Over Leading Bits (Up To Byte Boundary) ***/
+    if((bit & 0x07) != 0)
+    {
+        count = (uint8_t)(8 - (bit & 0x07));
+        if(count > (end - bit))
+            count = (uint8_t)(end - bit);
+        crc16Arc = (uint16_t)crc_genericUpdateBits(&crc_crc16ArcParameters, crc16Arc, Data[bit >> 3], (uint8_t)(bit & 0x07), count);
+        bit += count;
+    }
+    
+    /*** Calculate CRC-16/ARC Over Whole Bytes ***/
+    for(; (end - bit) >= 8; bit += 8)
+        crc16Arc = crc_crc16ArcStep(Data[bit >> 3], crc16Arc);
+    
+    /*** Calculate CRC-16/ARC Over Trailing Bits ***/
+    if(bit < end)
+        crc16Arc = (uint16_t)crc_genericUpdateBits(&crc_crc16ArcParameters, crc16Arc, Data[bit >> 3], 0, (uint8_t)(end - bit));
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC16_ARC, metricsStart);
+#endif
+    
+    return (uint16_t)crc_genericCrcFromState(&crc_crc16ArcParameters, crc16Arc);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc16ArcCalculatePartialBits
+ * BRIEF:   Calculate Partial CRC-16/ARC Over Bit-Granular Data
+ * RETURN:  uint16_t: Current/Final CRC-16/ARC
+ * ARG:     Data: Data Byte Containing Bits (First Bits In Transmission Order: Least Significant Bit First)
+ * ARG:     BitLength: Number Of Bits (1 ... 8)
+ * ARG:     crc16Arc: Current CRC-16/ARC
+ * ARG:     Final: Final Data
+ * NOTE:    Set CRC-16/ARC Value To CRC_CRC16_ARC_INITIAL_CRC16_ARC If First Data Bits;
+ *          Returned CRC-16/ARC Value Should Be Used On Subsequent Data Bits; May Be Mixed With
+ *          crc_crc16ArcCalculatePartial For Whole Bytes
+ ****************************************************************************************************/
+uint16_t crc_crc16ArcCalculatePartialBits(const uint8_t Data, const uint8_t BitLength, uint16_t crc16Arc, const bool Final)
+{
+    /*** Error Check ***/
+    if(BitLength == 0)
+        return crc16Arc;
+    else if(BitLength >= 8)
+        return crc_crc16ArcCalculatePartial(Data, crc16Arc, Final);
+    
+    /*** Calculate Partial CRC-16/ARC ***/
+    crc16Arc = (uint16_t)crc_genericUpdateBits(&crc_crc16ArcParameters, crc16Arc, Data, 0, BitLength);
+    
+    /*** Convert To CRC-16/ARC On Final Data ***/
+    if(Final)
+        crc16Arc = (uint16_t)crc_genericCrcFromState(&crc_crc16ArcParameters, crc16Arc);
+    
+    return crc16Arc;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc16ArcVerify
+ * BRIEF:   Verify Data Followed By Its CRC-16/ARC
+ * RETURN:  bool: True If CRC-16/ARC Matches
+ * ARG:     Data: Data Buffer With CRC-16/ARC In Trailing 2 Bytes (Least Significant Byte First)
+ * ARG:     DataLength: Length Of Data Buffer Including CRC-16/ARC
+ * NOTE:    Runs Over Data And CRC-16/ARC In One Pass And Compares Against The Residue Constant
+ ****************************************************************************************************/
+bool crc_crc16ArcVerify(const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint16_t crc16Arc = CRC_CRC16_ARC_INITIAL_CRC16_ARC;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength < 2))
+        return false;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC16_ARC, DataLength);
+#endif
+    
+    /*** Calculate Partial CRC-16/ARC Over Data And CRC-16/ARC ***/
+    for(i = 0; i < DataLength; i++)
+        crc16Arc = crc_crc16ArcStep(Data[i], crc16Arc);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC16_ARC, metricsStart);
+#endif
+    
+    return (crc16Arc == CRC_CRC16_ARC_RESIDUE);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc16ArcForge
+ * BRIEF:   Patch Data So That Its CRC-16/ARC Equals Target
+ * RETURN:  bool: True If Data Patched
+ * ARG:     data: Data Buffer To Patch
+ * ARG:     DataLength: Length Of Data Buffer
+ * ARG:     Offset: Offset Of 2 Patch Bytes (Overwritten)
+ * ARG:     crc16Arc: Current CRC-16/ARC Of Data (Including Original Patch Bytes)
+ * ARG:     Target: CRC-16/ARC To Reach
+ * NOTE:    Patch Is Solved Directly In O(log DataLength) From The Current CRC-16/ARC; Data Outside The
+ *          Patch Bytes Is Not Read, So A Wrong Current CRC-16/ARC Gives A Wrong Patch
+ ****************************************************************************************************/
+bool crc_crc16ArcForge(uint8_t * const data, const uint16_t DataLength, const uint16_t Offset, const uint16_t crc16Arc, const uint16_t Target)
+{
+    /*** Error Check ***/
+    if((data == NULL) || (DataLength < 2) || (Offset > (DataLength - 2)))
+        return false;
+    
+    /*** Solve Patch Bytes For Target CRC-16/ARC ***/
+    return crc_genericForge(&crc_crc16ArcParameters, crc16Arc, Target, (uint32_t)(DataLength - Offset - 2), &data[Offset]);
+}
+#endif
+
+#if defined(CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_CCITT_FALSE_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crc_crc16CcittFalseCalculate
+ * BRIEF:   Calculate Full CRC-16/CCITT-FALSE
+ * RETURN:  uint16_t: CRC-16/CCITT-FALSE
+ * ARG:     Data: Data Buffer To Calculate CRC-16/CCITT-FALSE For
+ * ARG:     DataLength: Length Of Data Buffer
+ ****************************************************************************************************/
+uint16_t crc_crc16CcittFalseCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint16_t crc16CcittFalse = CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength == 0))
+        return CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC16_CCITT_FALSE, DataLength);
+#endif
+
+    /*** Calculate Full CRC-16/CCITT-FALSE ***/
+    for(i = 0; i < DataLength; i++)
+        crc16CcittFalse = crc_crc16CcittFalseStep(Data[i], crc16CcittFalse);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC16_CCITT_FALSE, metricsStart);
+#endif
+
+    return crc16CcittFalse;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc16CcittFalseCalculatePartial
+ * BRIEF:   Calculate Partial CRC-16/CCITT-FALSE
+ * RETURN:  uint16_t: Current/Final CRC-16/CCITT-FALSE
+ * ARG:     Data: Data To Add To CRC-16/CCITT-FALSE Calculation
+ * ARG:     crc16CcittFalse: Current CRC-16/CCITT-FALSE
+ * NOTE:    Set CRC-16/CCITT-FALSE Value To CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE If First
+ *          Data Byte (Data[0]); Returned CRC-16/CCITT-FALSE Value Should Be Used On Subsequent Data
+ *          Bytes (Data[1] ... Data[n])
+ ****************************************************************************************************/
+uint16_t crc_crc16CcittFalseCalculatePartial(const uint8_t Data, uint16_t crc16CcittFalse)
+{
+    /*** Calculate Partial CRC-16/CCITT-FALSE ***/
+    crc16CcittFalse = crc_crc16CcittFalseStep(Data, crc16CcittFalse);
+    
+    return crc16CcittFalse;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc16CcittFalseModify
+ * BRIEF:   Update CRC-16/CCITT-FALSE After In-Place Modification Of Data
+ * RETURN:  uint16_t: CRC-16/CCITT-FALSE Of Modified Data
+ * ARG:     crc16CcittFalse: CRC-16/CCITT-FALSE Of Original Data
+ * ARG:     Delta: XOR Of Original And Modified Bytes
+ * ARG:     DeltaLength: Length Of Delta (Number Of Modified Bytes)
+ * ARG:     Distance: Number Of Bytes From End Of Modified Range To End Of Data
+ * NOTE:    Runs In O(DeltaLength + log Distance) Regardless Of Data Length
+ ****************************************************************************************************/
+uint16_t crc_crc16CcittFalseModify(uint16_t crc16CcittFalse, const uint8_t * const Delta, const uint16_t DeltaLength, const uint32_t Distance)
+{
+    /*** Error Check ***/
+    if((Delta == NULL) || (DeltaLength == 0))
+        return crc16CcittFalse;
+    
+    /*** Update CRC-16/CCITT-FALSE ***/
+    crc16CcittFalse ^= (uint16_t)crc_genericDelta(&crc_crc16CcittFalseParameters, Delta, DeltaLength, Distance);
+    
+    return crc16CcittFalse;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc16CcittFalseModifyBatch
+ * BRIEF:   Update CRC-16/CCITT-FALSE After In-Place Modification Of Data (Multiple Patches)
+ * RETURN:  uint16_t: CRC-16/CCITT-FALSE Of Modified Data
+ * ARG:     crc16CcittFalse: CRC-16/CCITT-FALSE Of Original Data
+ * ARG:     Patch: Patch List (Patches May Be In Any Order)
+ * ARG:     PatchCount: Number Of Patches In Patch List
+ * ARG:     DataLength: Length Of Data
+ * NOTE:    Patches Extending Beyond DataLength Are Ignored
+ ****************************************************************************************************/
+uint16_t crc_crc16CcittFalseModifyBatch(uint16_t crc16CcittFalse, const crc_patch_t * const Patch, const uint16_t PatchCount, const uint32_t DataLength)
+{
+    uint16_t i;
+    
+    /*** Error Check ***/
+    if(Patch == NULL)
+        return crc16CcittFalse;
+    
+    /*** Update CRC-16/CCITT-FALSE For Each Patch ***/
+    for(i = 0; i < PatchCount; i++)
+    {
+        if((Patch[i].delta == NULL) || (Patch[i].offset > DataLength) || (Patch[i].length > (DataLength - Patch[i].offset)))
+            continue;
+        crc16CcittFalse = crc_crc16CcittFalseModify(crc16CcittFalse, Patch[i].delta, Patch[i].length, DataLength - Patch[i].offset - Patch[i].length);
+    }
+    
+    return crc16CcittFalse;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc16CcittFalseRollingInitialize
+ * BRIEF:   Initialize Rolling (Sliding Window) CRC-16/CCITT-FALSE
+ * RETURN:  bool: Success Or Failure Status
+ * ARG:     Rolling: Rolling Context To Initialize
+ * ARG:     WindowLength: Length Of Sliding Window
+ * NOTE:    Precomputes Tables For WindowLength; Context Can Then Be Shared By Any Number Of Streams
+ ****************************************************************************************************/
+bool crc_crc16CcittFalseRollingInitialize(crc_rolling_t * const Rolling, const uint16_t WindowLength)
+{
+    /*** Error Check ***/
+    if((Rolling == NULL) || (WindowLength == 0))
+        return false;
+    
+    /*** Initialize Rolling CRC-16/CCITT-FALSE ***/
+    crc_genericRollingInitialize(&crc_crc16CcittFalseParameters, Rolling, WindowLength);
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc16CcittFalseRollingUpdate
+ * BRIEF:   Slide Rolling CRC-16/CCITT-FALSE Window Forward One Byte
+ * RETURN:  uint16_t: CRC-16/CCITT-FALSE Of New Window
+ * ARG:     Rolling: Rolling Context (Initialized By crc_crc16CcittFalseRollingInitialize)
+ * ARG:     Out: Data Leaving Window (Oldest Byte)
+ * ARG:     In: Data Entering Window
+ * ARG:     crc16CcittFalse: CRC-16/CCITT-FALSE Of Current Window
+ * NOTE:    Seed With crc_crc16CcittFalseCalculate Of First Window; Runs In O(1) Regardless Of Window Length
+ ****************************************************************************************************/
+uint16_t crc_crc16CcittFalseRollingUpdate(const crc_rolling_t * const Rolling, const uint8_t Out, const uint8_t In, const uint16_t crc16CcittFalse)
+{
+    /*** Error Check ***/
+    if(Rolling == NULL)
+        return crc16CcittFalse;
+    
+    /*** Slide Window ***/
+    return (uint16_t)crc_genericRollingUpdate(Rolling, Out, In, crc16CcittFalse);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc16CcittFalseStripPrefix
+ * BRIEF:   Remove Known Prefix From CRC-16/CCITT-FALSE
+ * RETURN:  uint16_t: CRC-16/CCITT-FALSE Of Data Following Prefix
+ * ARG:     crc16CcittFalse: CRC-16/CCITT-FALSE Of Prefix Followed By Suffix
+ * ARG:     Prefix: Prefix Data Buffer
+ * ARG:     PrefixLength: Length Of Prefix Data Buffer
+ * ARG:     SuffixLength: Length Of Data Following Prefix
+ * NOTE:    Runs In O(PrefixLength + log SuffixLength); Suffix Data Is Not Needed
+ ****************************************************************************************************/
+uint16_t crc_crc16CcittFalseStripPrefix(uint16_t crc16CcittFalse, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength)
+{
+    uint16_t crc16CcittFalsePrefix = CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE;
+    uint32_t i;
+    
+    /*** Error Check ***/
+    if((Prefix == NULL) || (PrefixLength == 0))
+        return crc16CcittFalse;
+    else if(SuffixLength == 0)
+        return CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE;
+    
+    /*** Calculate CRC-16/CCITT-FALSE Of Prefix ***/
+    for(i = 0; i < PrefixLength; i++)
+        crc16CcittFalsePrefix = crc_crc16CcittFalseStep(Prefix[i], crc16CcittFalsePrefix);
+    
+    /*** Strip Prefix ***/
+    crc16CcittFalse = (uint16_t)crc_genericStripPrefix(&crc_crc16CcittFalseParameters, crc16CcittFalse, crc16CcittFalsePrefix, SuffixLength);
+    
+    return crc16CcittFalse;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc16CcittFalseUnwind
+ * BRIEF:   Run CRC-16/CCITT-FALSE Backward Over Known Trailing Data
+ * RETURN:  uint16_t: CRC-16/CCITT-FALSE Of Data Preceding Trailing Data
+ * ARG:     crc16CcittFalse: CRC-16/CCITT-FALSE Of Data Including Trailing Data
+ * ARG:     Data: Trailing Data Buffer
+ * ARG:     DataLength: Length Of Trailing Data Buffer
+ ****************************************************************************************************/
+uint16_t crc_crc16CcittFalseUnwind(uint16_t crc16CcittFalse, const uint8_t * const Data, const uint16_t DataLength)
+{
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength == 0))
+        return crc16CcittFalse;
+    
+    /*** Unwind CRC-16/CCITT-FALSE ***/
+    crc16CcittFalse = (uint16_t)crc_genericUnwind(&crc_crc16CcittFalseParameters, crc16CcittFalse, Data, DataLength);
+    
+    return crc16CcittFalse;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc16CcittFalsePrefixInitialize
+ * BRIEF:   Precompute CRC-16/CCITT-FALSE State After Constant Prefix
+ * RETURN:  bool: True If Prefix State Computed
+ * ARG:     prefix: Prefix State
+ * ARG:     Data: Prefix Data Buffer (May Be NULL If DataLength Is Zero)
+ * ARG:     DataLength: Length Of Prefix Data Buffer
+ * NOTE:    The State Is Kept In The Same Form CalculatePartial Passes Between Bytes, Not As A
+ *          Finished CRC, So Resuming From It Is Exact For Every Method
+ ****************************************************************************************************/
+bool crc_crc16CcittFalsePrefixInitialize(crc_prefix_t * const prefix, const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint16_t crc16CcittFalse = CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE;
+    uint32_t i;
+    
+    /*** Error Check ***/
+    if((prefix == NULL) || ((Data == NULL) && (DataLength != 0)))
+        return false;
+    
+    /*** Calculate CRC-16/CCITT-FALSE State Of Prefix; Finish It For CRC Of Prefix ***/
+    for(i = 0; i < DataLength; i++)
+        crc16CcittFalse = crc_crc16CcittFalseStep(Data[i], crc16CcittFalse);
+    prefix->state = crc16CcittFalse;
+    prefix->crc = crc16CcittFalse;
+    
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc16CcittFalsePrefixCalculate
+ * BRIEF:   Calculate Full CRC-16/CCITT-FALSE Of Constant Prefix Followed By Data
+ * RETURN:  uint16_t: CRC-16/CCITT-FALSE
+ * ARG:     Prefix: Prefix State From crc_crc16CcittFalsePrefixInitialize
+ * ARG:     Data: Data Buffer Following Prefix
+ * ARG:     DataLength: Length Of Data Buffer
+ * NOTE:    Only Data Is Processed; The Prefix Contribution Is Reused
+ ****************************************************************************************************/
+uint16_t crc_crc16CcittFalsePrefixCalculate(const crc_prefix_t * const Prefix, const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint16_t crc16CcittFalse;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if(Prefix == NULL)
+        return CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE;
+    if((Data == NULL) || (DataLength == 0))
+        return Prefix->crc;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC16_CCITT_FALSE, DataLength);
+#endif
+    
+    /*** Resume CRC-16/CCITT-FALSE From Prefix State ***/
+    crc16CcittFalse = Prefix->state;
+    for(i = 0; i < DataLength; i++)
+        crc16CcittFalse = crc_crc16CcittFalseStep(Data[i], crc16CcittFalse);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC16_CCITT_FALSE, metricsStart);
+#endif
+    
+    return crc16CcittFalse;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc16CcittFalseCalculateMasked
+ * BRIEF:   Calculate Full CRC-16/CCITT-FALSE With Masked Ranges Treated As Zero
+ * RETURN:  uint16_t: CRC-16/CCITT-FALSE
+ * ARG:     Data: Data Buffer To Calculate CRC-16/CCITT-FALSE For
+ * ARG:     DataLength: Length Of Data Buffer
+ * ARG:     Mask: Masked Range List (Sorted By Offset; Ranges Beyond DataLength Are Clipped)
+ * ARG:     MaskCount: Number Of Masked Ranges In Masked Range List
+ * NOTE:    Data Is Not Copied Or Modified; Each Masked Range Costs O(log Length) With No Per-Byte Work
+ ****************************************************************************************************/
+uint16_t crc_crc16CcittFalseCalculateMasked(const uint8_t * const Data, const uint16_t DataLength, const crc_mask_t * const Mask, const uint16_t MaskCount)
+{
+    uint16_t crc16CcittFalse = CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE;
+    uint32_t end, i = 0, m, start;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength == 0) || ((Mask == NULL) && (MaskCount != 0)))
+        return CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC16_CCITT_FALSE, DataLength);
+#endif
+    
+    /*** Calculate CRC-16/CCITT-FALSE Up To Each Masked Range; Shift Over Masked Range ***/
+    for(m = 0; m < MaskCount; m++)
+    {
+        start = (Mask[m].offset > i) ? Mask[m].offset : i;
+        end = (uint32_t)Mask[m].offset + Mask[m].length;
+        if(end > DataLength)
+            end = DataLength;
+        if(end <= start)
+            continue;
+        for(; i < start; i++)
+            crc16CcittFalse = crc_crc16CcittFalseStep(Data[i], crc16CcittFalse);
+        crc16CcittFalse = (uint16_t)crc_genericShiftState(&crc_crc16CcittFalseParameters, crc16CcittFalse, end - start);
+        i = end;
+    }
+    
+    /*** Calculate CRC-16/CCITT-FALSE After Final Masked Range ***/
+    for(; i < DataLength; i++)
+        crc16CcittFalse = crc_crc16CcittFalseStep(Data[i], crc16CcittFalse);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC16_CCITT_FALSE, metricsStart);
+#endif
+    
+    return (uint16_t)crc_genericCrcFromState(&crc_crc16CcittFalseParameters, crc16CcittFalse);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc16CcittFalseCalculateBits
+ * BRIEF:   Calculate Full CRC-16/CCITT-FALSE Over Bit-Granular Data
+ * RETURN:  uint16_t: CRC-16/CCITT-FALSE
+ * ARG:     Data: Data Buffer To Calculate CRC-16/CCITT-FALSE For
+ * ARG:     BitOffset: Offset Of First Bit (Bits Within Byte In Transmission Order: Most Significant Bit First)
+ * ARG:     BitLength: Number Of Bits (BitOffset + BitLength Must Not Exceed UINT32_MAX)
+ * NOTE:    Whole Bytes Use The Byte-Wise Method; Only Leading And Trailing Partial Bytes Are Bitwise
+ ****************************************************************************************************/
+uint16_t crc_crc16CcittFalseCalculateBits(const uint8_t * const Data, const uint32_t BitOffset, const uint32_t BitLength)
+{
+    uint16_t crc16CcittFalse = CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE;
+    uint8_t count;
+    uint32_t bit, end;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((Data == NULL) || (BitLength == 0) || (BitLength > (UINT32_MAX - BitOffset)))
+        return CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC16_CCITT_FALSE, ((BitLength - 1) / 8) + 1);
+#endif
+    
+    /*** Set Up ***/
+    bit = BitOffset;
+    end = BitOffset + BitLength;
+    
+    /*** Calculate CRC-16/CCITT-FALSE Over Leading Bits (Up To Byte Boundary) ***/
+    if((bit & 0x07) != 0)
+    {
+        count = (uint8_t)(8 - (bit & 0x07));
+        if(count > (end - bit))
+            count = (uint8_t)(end - bit);
+        crc16CcittFalse = (uint16_t)crc_genericUpdateBits(&crc_crc16CcittFalseParameters, crc16CcittFalse, Data[bit >> 3], (uint8_t)(bit & 0x07), count);
+        bit += count;
+    }
+    
+    /*** Calculate CRC-16/CCITT-FALSE Over Whole Bytes ***/
+    for(; (end - bit) >= 8; bit += 8)
+        crc16CcittFalse = crc_crc16CcittFalseStep(Data[bit >> 3], crc16CcittFalse);
+    
+    /*** Calculate CRC-16/CCITT-FALSE Over Trailing Bits ***/
+    if(bit < end)
+        crc16CcittFalse = (uint16_t)crc_genericUpdateBits(&crc_crc16CcittFalseParameters, crc16CcittFalse, Data[bit >> 3], 0, (uint8_t)(end - bit));
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC16_CCITT_FALSE, metricsStart);
+#endif
+    return (uint16_t)crc_genericCrcFromState(&crc_crc16CcittFalseParameters, crc16CcittFalse);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc16CcittFalseCalculatePartialBits
+ * BRIEF:   Calculate Partial CRC-16/CCITT-FALSE Over Bit-Granular Data
+ * RETURN:  uint16_t: Current/Final CRC-16/CCITT-FALSE
+ * ARG:     Data: Data Byte Containing Bits (First Bits In Transmission Order: Most Significant Bit First)
+ * ARG:     BitLength: Number Of Bits (1 ... 8)
+ * ARG:     crc16CcittFalse: Current CRC-16/CCITT-FALSE
+ * NOTE:    Set CRC-16/CCITT-FALSE Value To CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE If First Data Bits;
+ *          Returned CRC-16/CCITT-FALSE Value Should Be Used On Subsequent Data Bits; May Be Mixed With
+ *          crc_crc16CcittFalseCalculatePartial For Whole Bytes
+ ****************************************************************************************************/
+uint16_t crc_crc16CcittFalseCalculatePartialBits(const uint8_t Data, const uint8_t BitLength, uint16_t crc16CcittFalse)
+{
+    /*** Error Check ***/
+    if(BitLength == 0)
+        return crc16CcittFalse;
+    else if(BitLength >= 8)
+        return crc_crc16CcittFalseStep(Data, crc16CcittFalse);
+    
+    /*** Calculate Partial CRC-16/CCITT-FALSE ***/
+    crc16CcittFalse = (uint16_t)crc_genericUpdateBits(&crc_crc16CcittFalseParameters, crc16CcittFalse, Data, 0, BitLength);
+    return crc16CcittFalse;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc16CcittFalseVerify
+ * BRIEF:   Verify Data Followed By Its CRC-16/CCITT-FALSE
+ * RETURN:  bool: True If CRC-16/CCITT-FALSE Matches
+ * ARG:     Data: Data Buffer With CRC-16/CCITT-FALSE In Trailing 2 Bytes (Most Significant Byte First)
+ * ARG:     DataLength: Length Of Data Buffer Including CRC-16/CCITT-FALSE
+ * NOTE:    Runs Over Data And CRC-16/CCITT-FALSE In One Pass And Compares Against The Residue Constant
+ ****************************************************************************************************/
+bool crc_crc16CcittFalseVerify(const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint16_t crc16CcittFalse = CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((Data == NULL) || (DataLength < 2))
+        return false;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC16_CCITT_FALSE, DataLength);
+#endif
+    
+    /*** Calculate Partial CRC-16/CCITT-FALSE Over Data And CRC-16/CCITT-FALSE ***/
+    for(i = 0; i < DataLength; i++)
+        crc16CcittFalse = crc_crc16CcittFalseStep(Data[i], crc16CcittFalse);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC16_CCITT_FALSE, metricsStart);
+#endif
+    
+    return (crc16CcittFalse == CRC_CRC16_CCITT_FALSE_RESIDUE);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc16CcittFalseCorrect
+ * BRIEF:   Correct Single And Double Bit Errors In Data Followed By Its CRC-16/CCITT-FALSE
+ * RETURN:  crc_correction_t: Correction Result
+ * ARG:     syndrome: Syndrome Table (Rebuilt Only When Data Is Longer Than Any Seen Before)
+ * ARG:     data: Data Buffer With CRC-16/CCITT-FALSE In Trailing Bytes (Most Significant Byte First)
+ * ARG:     DataLength: Length Of Data Buffer Including CRC-16/CCITT-FALSE
+ * NOTE:    Zero-Initialize Syndrome Table Before First Use; One Table Serves Every Data Length Up To
+ *          The Longest Seen, So Pass The Longest Frame First To Build It Once. Double Bit Errors Are
+ *          Only Corrected Where The Syndrome Is Unambiguous At The Built Length
+ ****************************************************************************************************/
+crc_correction_t crc_crc16CcittFalseCorrect(crc_syndrome16_t * const syndrome, uint8_t * const data, const uint16_t DataLength)
+{
+    uint16_t crc16CcittFalse = CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE;
+    uint32_t i;
+#ifdef CRC_METRICS
+    uint64_t metricsStart;
+#endif
+    
+    /*** Error Check ***/
+    if((syndrome == NULL) || (data == NULL) || (DataLength < 2))
+        return CRC_CORRECTION_FAILED;
+#ifdef CRC_METRICS
+    metricsStart = crc_metricsBegin(CRC_VARIANT_CRC16_CCITT_FALSE, DataLength);
+#endif
+    
+    /*** Build Syndrome Table On First Use Of Longer Data Length ***/
+    if(syndrome->length < DataLength)
+    {
+        crc_syndromeInitialize(&crc_crc16CcittFalseParameters, syndrome->position, (uint32_t)DataLength * 8);
+        syndrome->length = DataLength;
+    }
+    
+    /*** Calculate Partial CRC-16/CCITT-FALSE Over Data And CRC-16/CCITT-FALSE ***/
+    for(i = 0; i < DataLength; i++)
+        crc16CcittFalse = crc_crc16CcittFalseStep(data[i], crc16CcittFalse);
+#ifdef CRC_METRICS
+    crc_metricsEnd(CRC_VARIANT_CRC16_CCITT_FALSE, metricsStart);
+#endif
+    
+    /*** Correct Errors From Syndrome ***/
+    return crc_syndromeCorrect(&crc_crc16CcittFalseParameters, syndrome->position, data, DataLength, crc_genericRegisterFromState(&crc_crc16CcittFalseParameters, (uint16_t)(crc16CcittFalse ^ CRC_CRC16_CCITT_FALSE_RESIDUE)));
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc16CcittFalseForge
+ * BRIEF:   Patch Data So That Its CRC-16/CCITT-FALSE Equals Target
+ * RETURN:  bool: True If Data Patched
+ * ARG:     data: Data Buffer To Patch
+ * ARG:     DataLength: Length Of Data Buffer
+ * ARG:     Offset: Offset Of 2 Patch Bytes (Overwritten)
+ * ARG:     crc16CcittFalse: Current CRC-16/CCITT-FALSE Of Data (Including Original Patch Bytes)
+ * ARG:     Target: CRC-16/CCITT-FALSE To Reach
+ * NOTE:    Patch Is Solved Directly In O(log DataLength) From The Current CRC-16/CCITT-FALSE; Data Outside The
+ *          Patch Bytes Is Not Read, So A Wrong Current CRC-16/CCITT-FALSE Gives A Wrong Patch
+ ****************************************************************************************************/
+bool crc_crc16CcittFalseForge(uint8_t * const data, const uint16_t DataLength, const uint16_t Offset, const uint16_t crc16CcittFalse, const uint16_t Target)
+{
+    /*** Error Check ***/
+    if((data == NULL) || (DataLength < 2) || (Offset > (DataLength - 2)))
+        return false;
+    
+    /*** Solve Patch Bytes For Target CRC-16/CCITT-FALSE ***/
+    return crc_genericForge(&crc_crc16CcittFalseParameters, crc16CcittFalse, Target, (uint32_t)(DataLength - Offset - 2), &data[Offset]);
+}
+#endif
+
+/****************************************************************************************************
+ * FUNCT:   crc_multiCalculate
+ * BRIEF:   Calculate Full CRC For Multiple Variants In Single Pass
+ * RETURN:  void: Returns Nothing
+ * ARG:     Data: Data Buffer To Calculate CRCs For
+ * ARG:     DataLength: Length Of Data Buffer
+ * ARG:     Variants: Variants To Calculate (Bitwise OR Of CRC_VARIANT_MASK(crc_variant_t))
+ * ARG:     Crc: CRC List Indexed By crc_variant_t (CRC_VARIANT_COUNT Entries); Only Entries For
+ *          Requested And Enabled Variants Are Written
+ * NOTE:    Data Is Walked In CRC_MULTI_BLOCK_LENGTH Blocks; Each Requested Variant Runs A Branch-Free
+ *          Step Loop Over A Block While It Is In L1 Cache, So Memory Is Read Once And Variant Mask
+ *          Tests Run Once Per Block Rather Than Once Per Byte
+ ****************************************************************************************************/
+void crc_multiCalculate(const uint8_t * const Data, const uint16_t DataLength, const uint32_t Variants, uint16_t * const Crc)
+{
+#ifdef CRC_GENERIC
+    uint32_t block, end, i, variants = Variants;
+#endif
+#if defined(CRC_CRC8_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_LOOP_METHOD)
+    uint8_t crc8 = CRC_CRC8_INITIAL_CRC8;
+#endif
+#if defined(CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_CDMA2000_LOOP_METHOD)
+    uint8_t crc8Cdma2000 = CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000;
+#endif
+#if defined(CRC_CRC8_DARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DARC_LOOP_METHOD)
+    uint8_t crc8Darc = CRC_CRC8_DARC_INITIAL_CRC8_DARC;
+#endif
+#if defined(CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DVB_S2_LOOP_METHOD)
+    uint8_t crc8DvbS2 = CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2;
+#endif
+#if defined(CRC_CRC8_EBU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_EBU_LOOP_METHOD)
+    uint8_t crc8Ebu = CRC_CRC8_EBU_INITIAL_CRC8_EBU;
+#endif
+#if defined(CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_I_CODE_LOOP_METHOD)
+    uint8_t crc8ICode = CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE;
+#endif
+#if defined(CRC_CRC8_ITU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ITU_LOOP_METHOD)
+    uint8_t crc8Itu = CRC_CRC8_ITU_INITIAL_CRC8_ITU;
+#endif
+#if defined(CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_MAXIM_LOOP_METHOD)
+    uint8_t crc8Maxim = CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM;
+#endif
+#if defined(CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ROHC_LOOP_METHOD)
+    uint8_t crc8Rohc = CRC_CRC8_ROHC_INITIAL_CRC8_ROHC;
+#endif
+#if defined(CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_WCDMA_LOOP_METHOD)
+    uint8_t crc8Wcdma = CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA;
+#endif
+#if defined(CRC_CRC16_ARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_ARC_LOOP_METHOD)
+    uint16_t crc16Arc = CRC_CRC16_ARC_INITIAL_CRC16_ARC;
+#endif
+#if defined(CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_CCITT_FALSE_LOOP_METHOD)
+    uint16_t crc16CcittFalse = CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE;
+#endif
+
+    /*** Error Check ***/
+    if(Crc == NULL)
+        return;
+
+#ifdef CRC_GENERIC
+    /*** Calculate Full CRCs ***/
+    if((Data != NULL) && (DataLength != 0))
+    {
+        /* Fixed Length Kernels (Variants Handled Here Are Dropped From Byte Loop) */
+#ifdef CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD
+        if(((variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8_DVB_S2)) != 0) && (DataLength == CRC_CRC8_DVB_S2_BBHEADER_LENGTH))
+        {
+            crc8DvbS2 = crc_crc8DvbS2CalculateBbHeader(Data);
+            variants &= ~CRC_VARIANT_MASK(CRC_VARIANT_CRC8_DVB_S2);
+        }
+        else if(((variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8_DVB_S2)) != 0) && (DataLength == CRC_CRC8_DVB_S2_TS_PACKET_LENGTH))
+        {
+            crc8DvbS2 = crc_crc8DvbS2CalculateTsPacket(Data);
+            variants &= ~CRC_VARIANT_MASK(CRC_VARIANT_CRC8_DVB_S2);
+        }
+#endif
+#ifdef CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD
+        if(((variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8_MAXIM)) != 0) && (DataLength == CRC_CRC8_MAXIM_ROM_ID_LENGTH))
+        {
+            crc8Maxim = crc_crc8MaximCalculateRomId(Data);
+            variants &= ~CRC_VARIANT_MASK(CRC_VARIANT_CRC8_MAXIM);
+        }
+#endif
+        
+        /* Block Loop (Mask Tests Run Once Per Block; Each Requested Variant Runs Its Step Loop Over The Block While It Is In Cache) */
+        for(block = 0; block < DataLength; block = end)
+        {
+            end = ((DataLength - block) > CRC_MULTI_BLOCK_LENGTH) ? (block + CRC_MULTI_BLOCK_LENGTH) : DataLength;
+#if defined(CRC_CRC8_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_LOOP_METHOD)
+            if((variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8)) != 0)
+            {
+                for(i = block; i < end; i++)
+                    crc8 = crc_crc8Step(Data[i], crc8);
+            }
+#endif
+#if defined(CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_CDMA2000_LOOP_METHOD)
+            if((variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8_CDMA2000)) != 0)
+            {
+                for(i = block; i < end; i++)
+                    crc8Cdma2000 = crc_crc8Cdma2000Step(Data[i], crc8Cdma2000);
+            }
+#endif
+#if defined(CRC_CRC8_DARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DARC_LOOP_METHOD)
+            if((variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8_DARC)) != 0)
+            {
+                for(i = block; i < end; i++)
+                    crc8Darc = crc_crc8DarcStep(Data[i], crc8Darc);
+            }
+#endif
+#if defined(CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DVB_S2_LOOP_METHOD)
+            if((variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8_DVB_S2)) != 0)
+            {
+                for(i = block; i < end; i++)
+                    crc8DvbS2 = crc_crc8DvbS2Step(Data[i], crc8DvbS2);
+            }
+#endif
+#if defined(CRC_CRC8_EBU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_EBU_LOOP_METHOD)
+            if((variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8_EBU)) != 0)
+            {
+                for(i = block; i < end; i++)
+                    crc8Ebu = crc_crc8EbuStep(Data[i], crc8Ebu);
+            }
+#endif
+#if defined(CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_I_CODE_LOOP_METHOD)
+            if((variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8_I_CODE)) != 0)
+            {
+                for(i = block; i < end; i++)
+                    crc8ICode = crc_crc8ICodeStep(Data[i], crc8ICode);
+            }
+#endif
+#if defined(CRC_CRC8_ITU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ITU_LOOP_METHOD)
+            if((variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8_ITU)) != 0)
+            {
+                for(i = block; i < end; i++)
+                    crc8Itu = crc_crc8ItuStep(Data[i], crc8Itu);
+            }
+#endif
+#if defined(CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_MAXIM_LOOP_METHOD)
+            if((variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8_MAXIM)) != 0)
+            {
+                for(i = block; i < end; i++)
+                    crc8Maxim = crc_crc8MaximStep(Data[i], crc8Maxim);
+            }
+#endif
+#if defined(CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ROHC_LOOP_METHOD)
+            if((variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8_ROHC)) != 0)
+            {
+                for(i = block; i < end; i++)
+                    crc8Rohc = crc_crc8RohcStep(Data[i], crc8Rohc);
+            }
+#endif
+#if defined(CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_WCDMA_LOOP_METHOD)
+            if((variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8_WCDMA)) != 0)
+            {
+                for(i = block; i < end; i++)
+                    crc8Wcdma = crc_crc8WcdmaStep(Data[i], crc8Wcdma);
+            }
+#endif
+#if defined(CRC_CRC16_ARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_ARC_LOOP_METHOD)
+            if((variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC16_ARC)) != 0)
+            {
+                for(i = block; i < end; i++)
+                    crc16Arc = crc_crc16ArcStep(Data[i], crc16Arc);
+            }
+#endif
+#if defined(CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_CCITT_FALSE_LOOP_METHOD)
+            if((variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC16_CCITT_FALSE)) != 0)
+            {
+                for(i = block; i < end; i++)
+                    crc16CcittFalse = crc_crc16CcittFalseStep(Data[i], crc16CcittFalse);
+            }
+#endif
+        }
+        
+        /* Final Output Fixups (Applied Once After Byte Loop) */
+#if defined(CRC_CRC8_DARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DARC_LOOP_METHOD)
+        if((variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8_DARC)) != 0)
+            crc8Darc = crc_crc8DarcFinal(crc8Darc);
+#endif
+#if defined(CRC_CRC8_EBU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_EBU_LOOP_METHOD)
+        if((variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8_EBU)) != 0)
+            crc8Ebu = crc_crc8EbuFinal(crc8Ebu);
+#endif
+#if defined(CRC_CRC8_ITU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ITU_LOOP_METHOD)
+        if((variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8_ITU)) != 0)
+            crc8Itu = crc_crc8ItuFinal(crc8Itu);
+#endif
+#if defined(CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_MAXIM_LOOP_METHOD)
+        if((variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8_MAXIM)) != 0)
+            crc8Maxim = crc_crc8MaximFinal(crc8Maxim);
+#endif
+#if defined(CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ROHC_LOOP_METHOD)
+        if((variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8_ROHC)) != 0)
+            crc8Rohc = crc_crc8RohcFinal(crc8Rohc);
+#endif
+#if defined(CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_WCDMA_LOOP_METHOD)
+        if((variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8_WCDMA)) != 0)
+            crc8Wcdma = crc_crc8WcdmaFinal(crc8Wcdma);
+#endif
+#if defined(CRC_CRC16_ARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_ARC_LOOP_METHOD)
+        if((variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC16_ARC)) != 0)
+            crc16Arc = crc_crc16ArcFinal(crc16Arc);
+#endif
+#ifdef CRC_METRICS
+        
+        /* Count Requested Variants (Not Timed: One Pass Serves Every Variant) */
+#if defined(CRC_CRC8_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_LOOP_METHOD)
+        if((Variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8)) != 0)
+            (void)crc_metricsCount(CRC_VARIANT_CRC8, DataLength);
+#endif
+#if defined(CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_CDMA2000_LOOP_METHOD)
+        if((Variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8_CDMA2000)) != 0)
+            (void)crc_metricsCount(CRC_VARIANT_CRC8_CDMA2000, DataLength);
+#endif
+#if defined(CRC_CRC8_DARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DARC_LOOP_METHOD)
+        if((Variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8_DARC)) != 0)
+            (void)crc_metricsCount(CRC_VARIANT_CRC8_DARC, DataLength);
+#endif
+#if defined(CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DVB_S2_LOOP_METHOD)
+        if((Variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8_DVB_S2)) != 0)
+            (void)crc_metricsCount(CRC_VARIANT_CRC8_DVB_S2, DataLength);
+#endif
+#if defined(CRC_CRC8_EBU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_EBU_LOOP_METHOD)
+        if((Variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8_EBU)) != 0)
+            (void)crc_metricsCount(CRC_VARIANT_CRC8_EBU, DataLength);
+#endif
+#if defined(CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_I_CODE_LOOP_METHOD)
+        if((Variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8_I_CODE)) != 0)
+            (void)crc_metricsCount(CRC_VARIANT_CRC8_I_CODE, DataLength);
+#endif
+#if defined(CRC_CRC8_ITU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ITU_LOOP_METHOD)
+        if((Variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8_ITU)) != 0)
+            (void)crc_metricsCount(CRC_VARIANT_CRC8_ITU, DataLength);
+#endif
+#if defined(CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_MAXIM_LOOP_METHOD)
+        if((Variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8_MAXIM)) != 0)
+            (void)crc_metricsCount(CRC_VARIANT_CRC8_MAXIM, DataLength);
+#endif
+#if defined(CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ROHC_LOOP_METHOD)
+        if((Variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8_ROHC)) != 0)
+            (void)crc_metricsCount(CRC_VARIANT_CRC8_ROHC, DataLength);
+#endif
+#if defined(CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_WCDMA_LOOP_METHOD)
+        if((Variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8_WCDMA)) != 0)
+            (void)crc_metricsCount(CRC_VARIANT_CRC8_WCDMA, DataLength);
+#endif
+#if defined(CRC_CRC16_ARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_ARC_LOOP_METHOD)
+        if((Variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC16_ARC)) != 0)
+            (void)crc_metricsCount(CRC_VARIANT_CRC16_ARC, DataLength);
+#endif
+#if defined(CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_CCITT_FALSE_LOOP_METHOD)
+        if((Variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC16_CCITT_FALSE)) != 0)
+            (void)crc_metricsCount(CRC_VARIANT_CRC16_CCITT_FALSE, DataLength);
+#endif
+#endif
+    }
+#else
+    (void)Data;       // Silence Compiler Warning
+    (void)DataLength; // Silence Compiler Warning
+    (void)Variants;   // Silence Compiler Warning
+#endif
+
+    /*** Store CRCs ***/
+#if defined(CRC_CRC8_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_LOOP_METHOD)
+    if((Variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8)) != 0)
+        Crc[CRC_VARIANT_CRC8] = crc8;
+#endif
+#if defined(CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_CDMA2000_LOOP_METHOD)
+    if((Variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8_CDMA2000)) != 0)
+        Crc[CRC_VARIANT_CRC8_CDMA2000] = crc8Cdma2000;
+#endif
+#if defined(CRC_CRC8_DARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DARC_LOOP_METHOD)
+    if((Variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8_DARC)) != 0)
+        Crc[CRC_VARIANT_CRC8_DARC] = crc8Darc;
+#endif
+#if defined(CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DVB_S2_LOOP_METHOD)
+    if((Variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8_DVB_S2)) != 0)
+        Crc[CRC_VARIANT_CRC8_DVB_S2] = crc8DvbS2;
+#endif
+#if defined(CRC_CRC8_EBU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_EBU_LOOP_METHOD)
+    if((Variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8_EBU)) != 0)
+        Crc[CRC_VARIANT_CRC8_EBU] = crc8Ebu;
+#endif
+#if defined(CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_I_CODE_LOOP_METHOD)
+    if((Variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8_I_CODE)) != 0)
+        Crc[CRC_VARIANT_CRC8_I_CODE] = crc8ICode;
+#endif
+#if defined(CRC_CRC8_ITU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ITU_LOOP_METHOD)
+    if((Variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8_ITU)) != 0)
+        Crc[CRC_VARIANT_CRC8_ITU] = crc8Itu;
+#endif
+#if defined(CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_MAXIM_LOOP_METHOD)
+    if((Variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8_MAXIM)) != 0)
+        Crc[CRC_VARIANT_CRC8_MAXIM] = crc8Maxim;
+#endif
+#if defined(CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ROHC_LOOP_METHOD)
+    if((Variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8_ROHC)) != 0)
+        Crc[CRC_VARIANT_CRC8_ROHC] = crc8Rohc;
+#endif
+#if defined(CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_WCDMA_LOOP_METHOD)
+    if((Variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC8_WCDMA)) != 0)
+        Crc[CRC_VARIANT_CRC8_WCDMA] = crc8Wcdma;
+#endif
+#if defined(CRC_CRC16_ARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_ARC_LOOP_METHOD)
+    if((Variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC16_ARC)) != 0)
+        Crc[CRC_VARIANT_CRC16_ARC] = crc16Arc;
+#endif
+#if defined(CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_CCITT_FALSE_LOOP_METHOD)
+    if((Variants & CRC_VARIANT_MASK(CRC_VARIANT_CRC16_CCITT_FALSE)) != 0)
+        Crc[CRC_VARIANT_CRC16_CCITT_FALSE] = crc16CcittFalse;
+#endif
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_variantName
+ * BRIEF:   Get Name Of CRC Variant
+ * RETURN:  const char *: Variant Name (E.g. "CRC-16/CCITT-FALSE"); NULL If Variant Invalid
+ * ARG:     Variant: CRC Variant
+ ****************************************************************************************************/
+const char *crc_variantName(const crc_variant_t Variant)
+{
+    /*** Error Check ***/
+    if(Variant >= CRC_VARIANT_COUNT)
+        return NULL;
+    
+    /*** Look Up Variant Name ***/
+    return crc_variantNameList[Variant];
+}
+
+#ifdef CRC_METRICS
+/****************************************************************************************************
+ * FUNCT:   crc_metricsSnapshot
+ * BRIEF:   Snapshot Runtime Metrics Of All Threads
+ * RETURN:  bool: True If Snapshot Taken
+ * ARG:     metrics: Metrics Per Variant (CRC_VARIANT_COUNT Entries, Indexed By crc_variant_t)
+ * NOTE:    Counters Only Increase (Exited Threads Are Folded Into Retired Totals), So Rates Come From
+ *          Differences Between Snapshots. Only The Snapshot Takes A Lock; Calculate Updates Its
+ *          Thread's Counters With Relaxed Single-Writer Stores.
+ ****************************************************************************************************/
+bool crc_metricsSnapshot(crc_metrics_t * const metrics)
+{
+    crc_metrics_thread_t *thread;
+    uint8_t v;
+    
+    /*** Error Check ***/
+    if(metrics == NULL)
+        return false;
+    
+    /*** Sum Retired Totals And Live Threads ***/
+    (void)pthread_mutex_lock(&crc_metricsMutex);
+    for(v = 0; v < CRC_VARIANT_COUNT; v++)
+        metrics[v] = crc_metricsRetired[v];
+    for(thread = crc_metricsThreadList; thread != NULL; thread = thread->next)
+    {
+        for(v = 0; v < CRC_VARIANT_COUNT; v++)
+            crc_metricsFold(&metrics[v], &thread->counter[v]);
+    }
+    (void)pthread_mutex_unlock(&crc_metricsMutex);
+    
+    return true;
+}
+#endif
+
+#ifdef CRC_REVERSE
+/****************************************************************************************************
+ * FUNCT:   crc_reverseModel
+ * BRIEF:   Get Preset Model Of CRC Variant
+ * RETURN:  bool: True If Variant Valid
+ * ARG:     Variant: CRC Variant
+ * ARG:     model: Preset Model
+ * NOTE:    Presets Cover Every Variant In This Module, Whether Or Not Its Method Is Defined
+ ****************************************************************************************************/
+bool crc_reverseModel(const crc_variant_t Variant, crc_model_t * const model)
+{
+    /*** Error Check ***/
+    if((Variant >= CRC_VARIANT_COUNT) || (model == NULL))
+        return false;
+    
+    /*** Copy Preset Model ***/
+    *model = crc_reversePresetModel[Variant];
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_reversePreset
+ * BRIEF:   Find Preset CRC Variants Matching Sample Messages
+ * RETURN:  uint16_t: Number Of Matching Presets
+ * ARG:     Sample: Sample Messages With Their CRCs
+ * ARG:     SampleCount: Number Of Samples
+ * ARG:     model: Matching Models (Up To ModelCount Are Written)
+ * ARG:     ModelCount: Maximum Number Of Models To Write
+ * NOTE:    Presets Cover Every Variant In This Module, Whether Or Not Its Method Is Defined
+ ****************************************************************************************************/
+uint16_t crc_reversePreset(const crc_sample_t * const Sample, const uint16_t SampleCount, crc_model_t * const model, const uint16_t ModelCount)
+{
+    uint16_t count = 0, s;
+    uint8_t v;
+    
+    /*** Error Check ***/
+    if((Sample == NULL) || (SampleCount == 0))
+        return 0;
+    
+    /*** Check Every Preset Against Every Sample ***/
+    for(v = 0; v < CRC_VARIANT_COUNT; v++)
+    {
+        for(s = 0; s < SampleCount; s++)
+        {
+            if((Sample[s].crc >> crc_reversePresetModel[v].width) != 0x0000)
+                break;
+            else if(crc_reverseCalculate(&crc_reversePresetModel[v], Sample[s].data, Sample[s].length) != Sample[s].crc)
+                break;
+        }
+        if(s == SampleCount)
+        {
+            if((model != NULL) && (count < ModelCount))
+                model[count] = crc_reversePresetModel[v];
+            count++;
+        }
+    }
+    
+    return count;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_reverseSearch
+ * BRIEF:   Search Polynomial Range For CRC Models Matching Sample Messages
+ * RETURN:  uint16_t: Number Of Matching Models
+ * ARG:     Sample: Sample Messages With Their CRCs
+ * ARG:     SampleCount: Number Of Samples
+ * ARG:     Width: CRC Width (8 Or 16 Bits)
+ * ARG:     PolynomialFirst: First Polynomial To Search (Normal Form)
+ * ARG:     PolynomialLast: Last Polynomial To Search (Normal Form, Inclusive)
+ * ARG:     model: Matching Models (Up To ModelCount Are Written)
+ * ARG:     ModelCount: Maximum Number Of Models To Write
+ * NOTE:    Initial Value And Output XOR Are Solved By GF(2) Elimination For Each Polynomial And
+ *          Reflection, So Only Polynomials Are Searched; Where Samples Cannot Separate Them (E.g. All
+ *          Samples Of Equal Length) A Consistent Preset Is Reported, Otherwise Free Bits Are Zero;
+ *          Polynomials Without The x^0 Term Are Skipped; Disjoint Ranges May Be Searched Concurrently
+ ****************************************************************************************************/
+uint16_t crc_reverseSearch(const crc_sample_t * const Sample, const uint16_t SampleCount, const uint8_t Width, const uint16_t PolynomialFirst, const uint16_t PolynomialLast, crc_model_t * const model, const uint16_t ModelCount)
+{
+    crc_model_t found;
+    crc_parameters_t parameters;
+    uint16_t count = 0;
+    uint32_t polynomial;
+    uint8_t reflect;
+    
+    /*** Error Check ***/
+    if((Sample == NULL) || (SampleCount == 0) || ((Width != 8) && (Width != 16)) || (PolynomialFirst > PolynomialLast))
+        return 0;
+    
+    /*** Set Up ***/
+    parameters.width = Width;
+    parameters.initial = 0x0000;
+    parameters.xorOut = 0x0000;
+    parameters.reflectedState = false;
+    
+    /*** Solve Initial Value And Output XOR For Each Polynomial And Reflection ***/
+    for(polynomial = PolynomialFirst; (polynomial <= PolynomialLast) && ((polynomial >> Width) == 0); polynomial++)
+    {
+        if((polynomial & 0x0001) == 0x0000)
+            continue;
+        parameters.polynomial = (uint16_t)polynomial;
+        for(reflect = 0; reflect < 4; reflect++)
+        {
+            parameters.reflect = ((reflect & 0x01) == 0x01);
+            if(crc_reverseSolve(&parameters, ((reflect & 0x02) == 0x02), Sample, SampleCount, &found))
+            {
+                if((model != NULL) && (count < ModelCount))
+                    model[count] = found;
+                count++;
+            }
+        }
+    }
+    
+    return count;
+}
+#endif
+
+#ifdef CRC_JIT
+/****************************************************************************************************
+ * FUNCT:   crc_jitCalculate
+ * BRIEF:   Calculate CRC For Any Model With A Kernel Specialized For It
+ * RETURN:  uint16_t: CRC (0 If Model Invalid)
+ * ARG:     Model: CRC Model (variant Is Ignored)
+ * ARG:     Data: Data Buffer To Calculate CRC For
+ * ARG:     DataLength: Length Of Data Buffer
+ * NOTE:    Slice-By-8 Tables Are Built Once Per (Width, Polynomial, Reflect In) And, On x86-64, A
+ *          Kernel With The Table Address And Register Orientation Baked In Is Emitted For Them.
+ *          Where Executable Memory Cannot Be Mapped The Same Tables Run Through The Interpreter.
+ *          Once CRC_JIT_CACHE_COUNT Models Are Cached, Other Models Run Byte-Wise On A Single
+ *          256-Entry Table Built Per Call Rather Than Rebuilding All Slices Every Call.
+ ****************************************************************************************************/
+uint16_t crc_jitCalculate(const crc_model_t * const Model, const uint8_t * const Data, const uint16_t DataLength)
+{
+    const crc_jit_entry_t *entry;
+    uint16_t reg, table[256];
+    
+    /*** Error Check ***/
+    if((Model == NULL) || ((Model->width != 8) && (Model->width != 16)) || ((Data == NULL) && (DataLength != 0)))
+        return 0;
+    
+    /*** Find Or Build Tables And Kernel ***/
+    entry = crc_jitFind(Model);
+    
+    /*** Run Data Through Register (Cache Full: Single Table For This Call Only) ***/
+    if(entry != NULL)
+    {
+        reg = crc_jitRun(entry, crc_modelInitial(Model), Data, DataLength);
+    }
+    else
+    {
+        crc_modelTable(table, Model->width, Model->polynomial, Model->reflectIn);
+        reg = crc_modelUpdate(table, Model->width, Model->reflectIn, crc_modelInitial(Model), Data, DataLength);
+    }
+    
+    return crc_modelFinal(Model, reg);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_jitNative
+ * BRIEF:   Check Whether Model Runs On An Emitted Kernel
+ * RETURN:  bool: True If Emitted Kernel Used (False: Interpreter Or Model Invalid)
+ * ARG:     Model: CRC Model
+ * NOTE:    Builds The Model's Tables And Kernel If Not Already Cached
+ ****************************************************************************************************/
+bool crc_jitNative(const crc_model_t * const Model)
+{
+    const crc_jit_entry_t *entry;
+    
+    /*** Error Check ***/
+    if((Model == NULL) || ((Model->width != 8) && (Model->width != 16)))
+        return false;
+    
+    /*** Find Or Build Tables And Kernel ***/
+    entry = crc_jitFind(Model);
+    return (entry != NULL) && (entry->kernel != NULL);
+}
+#endif
+
+#ifdef CRC_TABLE
+/****************************************************************************************************
+ * FUNCT:   crc_tableAcquire
+ * BRIEF:   Acquire Cached Table For Parameter Set
+ * RETURN:  const crc_table_t *: Table Handle (NULL If Width Invalid Or Out Of Memory)
+ * ARG:     Width: CRC Width (8 Or 16 Bits)
+ * ARG:     Polynomial: Polynomial (Normal Form, Implicit x^width Term)
+ * ARG:     ReflectIn: Reflect Input Bytes
+ * NOTE:    Every Acquire Takes A Reference That crc_tableRelease Drops. A Resident Table Is Shared,
+ *          Otherwise It Is Taken From The Mapped Blob Or Built. Tables Are Never Evicted While
+ *          Referenced, So The Budget May Be Exceeded By Tables In Use.
+ ****************************************************************************************************/
+const crc_table_t *crc_tableAcquire(const uint8_t Width, const uint16_t Polynomial, const bool ReflectIn)
+{
+    const crc_table_record_t *record = NULL;
+    crc_table_t *table;
+    uint32_t bucket, first, key, last, middle;
+    
+    /*** Error Check ***/
+    if((Width != 8) && (Width != 16))
+        return NULL;
+    
+    /*** Set Up ***/
+    key = crc_tableKey(Width, Polynomial, ReflectIn);
+    bucket = crc_tableBucketIndex(key);
+    (void)pthread_mutex_lock(&crc_tableMutex);
+    
+    /*** Resident Table ***/
+    for(table = crc_tableBucket[bucket]; table != NULL; table = table->bucketNext)
+    {
+        if(crc_tableKey(table->width, table->polynomial, table->reflectIn) == key)
+            break;
+    }
+    if(table != NULL)
+    {
+        if((table->references == 0) && (table->lookup == table->built))
+            crc_tableIdleRemove(table);
+        table->references++;
+        crc_tableStatisticsTotal.hits++;
+        (void)pthread_mutex_unlock(&crc_tableMutex);
+        return table;
+    }
+    
+    /*** Mapped Blob Record (Records Sorted By Key) ***/
+    first = 0;
+    last = crc_tableBlobCount;
+    while((record == NULL) && (first < last))
+    {
+        middle = first + ((last - first) / 2);
+        if(crc_tableBlob[middle].key == key)
+            record = &crc_tableBlob[middle];
+        else if(crc_tableBlob[middle].key < key)
+            first = middle + 1;
+        else
+            last = middle;
+    }
+    
+    /*** Add Table From Blob Or Build It ***/
+    if(record != NULL)
+        table = malloc(sizeof(crc_table_t));
+    else
+        table = malloc(sizeof(crc_table_t) + (CRC_TABLE_LENGTH * sizeof(uint16_t)));
+    if(table != NULL)
+    {
+        table->width = Width;
+        table->polynomial = Polynomial & (uint16_t)(0xFFFF >> (16 - Width));
+        table->reflectIn = ReflectIn;
+        table->references = 1;
+        table->idlePrevious = NULL;
+        table->idleNext = NULL;
+        if(record != NULL)
+        {
+            table->lookup = record->lookup;
+            crc_tableStatisticsTotal.mapped++;
+        }
+        else
+        {
+            crc_modelTable(table->built, Width, table->polynomial, ReflectIn);
+            table->lookup = table->built;
+            crc_tableStatisticsTotal.builds++;
+            crc_tableStatisticsTotal.residentBytes += CRC_TABLE_LENGTH * sizeof(uint16_t);
+        }
+        table->bucketNext = crc_tableBucket[bucket];
+        crc_tableBucket[bucket] = table;
+        crc_tableStatisticsTotal.tableCount++;
+        crc_tableEvict();
+    }
+    (void)pthread_mutex_unlock(&crc_tableMutex);
+    
+    return table;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_tableRelease
+ * BRIEF:   Release Table Handle
+ * RETURN:  void: Returns Nothing
+ * ARG:     Table: Table Handle From crc_tableAcquire
+ * NOTE:    A Built Table Whose Last Reference Is Released Becomes The Most Recently Used Idle Table;
+ *          Idle Tables Are Evicted Least Recently Used First When Over Budget
+ ****************************************************************************************************/
+void crc_tableRelease(const crc_table_t * const Table)
+{
+    crc_table_t *table;
+    
+    /*** Error Check ***/
+    if(Table == NULL)
+        return;
+    
+    /*** Find Table (Handle Is Read Only) And Drop Reference ***/
+    (void)pthread_mutex_lock(&crc_tableMutex);
+    for(table = crc_tableBucket[crc_tableBucketIndex(crc_tableKey(Table->width, Table->polynomial, Table->reflectIn))]; table != NULL; table = table->bucketNext)
+    {
+        if(table == Table)
+            break;
+    }
+    if((table != NULL) && (table->references != 0))
+    {
+        table->references--;
+        if((table->references == 0) && (table->lookup == table->built))
+        {
+            table->idlePrevious = NULL;
+            table->idleNext = crc_tableIdleFirst;
+            if(crc_tableIdleFirst != NULL)
+                crc_tableIdleFirst->idlePrevious = table;
+            else
+                crc_tableIdleLast = table;
+            crc_tableIdleFirst = table;
+            crc_tableEvict();
+        }
+    }
+    (void)pthread_mutex_unlock(&crc_tableMutex);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_tableCalculate
+ * BRIEF:   Calculate CRC For Model With Cached Table
+ * RETURN:  uint16_t: CRC (0 If Table Does Not Match Model)
+ * ARG:     Table: Table Handle Acquired For Model's Width, Polynomial And Reflect In
+ * ARG:     Model: CRC Model (variant Is Ignored)
+ * ARG:     Data: Data Buffer To Calculate CRC For
+ * ARG:     DataLength: Length Of Data Buffer
+ * NOTE:    Takes No Lock; The Handle's Reference Keeps The Table Alive
+ ****************************************************************************************************/
+uint16_t crc_tableCalculate(const crc_table_t * const Table, const crc_model_t * const Model, const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint16_t reg;
+    
+    /*** Error Check ***/
+    if((Table == NULL) || (Model == NULL) || ((Data == NULL) && (DataLength != 0)))
+        return 0;
+    if((Model->width != Table->width) || (crc_tableKey(Model->width, Model->polynomial, Model->reflectIn) != crc_tableKey(Table->width, Table->polynomial, Table->reflectIn)))
+        return 0;
+    
+    /*** Run Data Through Register ***/
+    reg = crc_modelUpdate(Table->lookup, Table->width, Table->reflectIn, crc_modelInitial(Model), Data, DataLength);
+    
+    return crc_modelFinal(Model, reg);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_tableBudget
+ * BRIEF:   Set Eviction Budget
+ * RETURN:  void: Returns Nothing
+ * ARG:     Bytes: Bytes Of Built Tables Kept Resident (Default CRC_TABLE_BUDGET)
+ * NOTE:    Idle Tables Over The New Budget Are Evicted Immediately; Mapped Tables Cost Nothing
+ ****************************************************************************************************/
+void crc_tableBudget(const size_t Bytes)
+{
+    /*** Set Budget And Evict ***/
+    (void)pthread_mutex_lock(&crc_tableMutex);
+    crc_tableBudgetBytes = Bytes;
+    crc_tableEvict();
+    (void)pthread_mutex_unlock(&crc_tableMutex);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_tableStatistics
+ * BRIEF:   Snapshot Table Cache Statistics
+ * RETURN:  bool: True If Snapshot Taken
+ * ARG:     statistics: Statistics
+ ****************************************************************************************************/
+bool crc_tableStatistics(crc_table_statistics_t * const statistics)
+{
+    /*** Error Check ***/
+    if(statistics == NULL)
+        return false;
+    
+    /*** Copy Statistics ***/
+    (void)pthread_mutex_lock(&crc_tableMutex);
+    *statistics = crc_tableStatisticsTotal;
+    (void)pthread_mutex_unlock(&crc_tableMutex);
+    
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_tableSave
+ * BRIEF:   Save Resident Tables To Blob
+ * RETURN:  bool: True If Blob Written
+ * ARG:     Path: Blob File Path
+ * NOTE:    The Blob Is Native Endian And Tied To This Build's Record Layout; It Is Meant To Be Written
+ *          Once (E.g. By A Parent Process) And Mapped By Workers On The Same Host With crc_tableMap
+ ****************************************************************************************************/
+bool crc_tableSave(const char * const Path)
+{
+    crc_table_header_t header;
+    crc_table_record_t *record;
+    crc_table_t *table;
+    uint32_t b, count = 0;
+    FILE *file;
+    bool saved;
+    
+    /*** Error Check ***/
+    if(Path == NULL)
+        return false;
+    
+    /*** Copy Resident Tables Into Records ***/
+    (void)pthread_mutex_lock(&crc_tableMutex);
+    record = malloc((crc_tableStatisticsTotal.tableCount + 1) * sizeof(crc_table_record_t));
+    for(b = 0; (record != NULL) && (b < CRC_TABLE_BUCKET_COUNT); b++)
+    {
+        for(table = crc_tableBucket[b]; table != NULL; table = table->bucketNext)
+        {
+            record[count].key = crc_tableKey(table->width, table->polynomial, table->reflectIn);
+            memcpy(record[count].lookup, table->lookup, sizeof(record[count].lookup));
+            count++;
+        }
+    }
+    (void)pthread_mutex_unlock(&crc_tableMutex);
+    if(record == NULL)
+        return false;
+    qsort(record, count, sizeof(crc_table_record_t), crc_tableCompare);
+    
+    /*** Write Header And Records ***/
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, CRC_TABLE_BLOB_MAGIC, sizeof(CRC_TABLE_BLOB_MAGIC));
+    header.count = count;
+    header.recordLength = sizeof(crc_table_record_t);
+    file = fopen(Path, "wb");
+    saved = (file != NULL) && (fwrite(&header, sizeof(header), 1, file) == 1) && (fwrite(record, sizeof(crc_table_record_t), count, file) == count);
+    if((file != NULL) && (fclose(file) != 0))
+        saved = false;
+    free(record);
+    
+    return saved;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_tableMap
+ * BRIEF:   Map Blob Of Tables Read Only
+ * RETURN:  bool: True If Blob Valid And Mapped
+ * ARG:     Path: Blob File Path (Written By crc_tableSave)
+ * NOTE:    Tables Missing From The Cache Are Then Taken From The Blob Instead Of Built. The Mapping Is
+ *          Shared, So Processes Mapping The Same Blob (Or Forked After Mapping It) Share Its Pages.
+ *          Only One Blob Can Be Mapped; It Stays Mapped Because Handles Point Into It.
+ ****************************************************************************************************/
+bool crc_tableMap(const char * const Path)
+{
+    const crc_table_header_t *header;
+    const crc_table_record_t *record;
+    struct stat status;
+    void *blob;
+    uint32_t r;
+    int file;
+    bool valid;
+    
+    /*** Error Check ***/
+    if(Path == NULL)
+        return false;
+    
+    /*** Map Blob ***/
+    file = open(Path, O_RDONLY);
+    if(file < 0)
+        return false;
+    if((fstat(file, &status) != 0) || (status.st_size < (off_t)sizeof(crc_table_header_t)))
+    {
+        (void)close(file);
+        return false;
+    }
+    blob = mmap(NULL, (size_t)status.st_size, PROT_READ, MAP_SHARED, file, 0);
+    (void)close(file);
+    if(blob == MAP_FAILED)
+        return false;
+    
+    /*** Validate Header, Length And Record Order ***/
+    header = blob;
+    record = (const crc_table_record_t *)(const void *)(header + 1);
+    valid = (memcmp(header->magic, CRC_TABLE_BLOB_MAGIC, sizeof(CRC_TABLE_BLOB_MAGIC)) == 0) &&
+            (header->recordLength == sizeof(crc_table_record_t)) &&
+            ((uint64_t)status.st_size == (sizeof(crc_table_header_t) + ((uint64_t)header->count * sizeof(crc_table_record_t))));
+    for(r = 1; valid && (r < header->count); r++)
+        valid = (record[r - 1].key < record[r].key);
+    
+    /*** Install Blob ***/
+    (void)pthread_mutex_lock(&crc_tableMutex);
+    if(valid && (crc_tableBlob == NULL))
+    {
+        crc_tableBlob = record;
+        crc_tableBlobCount = header->count;
+    }
+    else
+        valid = false;
+    (void)pthread_mutex_unlock(&crc_tableMutex);
+    if(!valid)
+        (void)munmap(blob, (size_t)status.st_size);
+    
+    return valid;
+}
+#endif
+
+#ifdef CRC_REGISTRY
+/****************************************************************************************************
+ * FUNCT:   crc_registryFind
+ * BRIEF:   Find Registry Entry By Canonical Name Or Alias
+ * RETURN:  const crc_registry_t *: Entry (NULL If Name Unknown Or Variant's Method Not Defined)
+ * ARG:     Name: Name (E.g. "CRC-16/ARC" Or Alias "CRC-16"; Case Sensitive)
+ * NOTE:    Names Are Placed By A Perfect Hash (Top Bits Of FNV-1a From CRC_REGISTRY_SEED), So Lookup
+ *          Hashes The Name Once And Compares It With A Single Slot; Nothing Is Allocated
+ ****************************************************************************************************/
+const crc_registry_t *crc_registryFind(const char * const Name)
+{
+    static const crc_registry_t Registry[CRC_VARIANT_COUNT] =
+    {
+#if defined(CRC_CRC8_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_LOOP_METHOD)
+        [CRC_VARIANT_CRC8] = {"CRC-8", CRC_VARIANT_CRC8, 8, {0}, crc_registryCrc8Initialize, crc_registryCrc8Update, crc_registryCrc8Finalize, crc_registryCrc8Combine},
+#endif
+#if defined(CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_CDMA2000_LOOP_METHOD)
+        [CRC_VARIANT_CRC8_CDMA2000] = {"CRC-8/CDMA2000", CRC_VARIANT_CRC8_CDMA2000, 8, {0}, crc_registryCrc8Cdma2000Initialize, crc_registryCrc8Cdma2000Update, crc_registryCrc8Cdma2000Finalize, crc_registryCrc8Cdma2000Combine},
+#endif
+#if defined(CRC_CRC8_DARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DARC_LOOP_METHOD)
+        [CRC_VARIANT_CRC8_DARC] = {"CRC-8/DARC", CRC_VARIANT_CRC8_DARC, 8, {0}, crc_registryCrc8DarcInitialize, crc_registryCrc8DarcUpdate, crc_registryCrc8DarcFinalize, crc_registryCrc8DarcCombine},
+#endif
+#if defined(CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DVB_S2_LOOP_METHOD)
+        [CRC_VARIANT_CRC8_DVB_S2] = {"CRC-8/DVB-S2", CRC_VARIANT_CRC8_DVB_S2, 8, {0}, crc_registryCrc8DvbS2Initialize, crc_registryCrc8DvbS2Update, crc_registryCrc8DvbS2Finalize, crc_registryCrc8DvbS2Combine},
+#endif
+#if defined(CRC_CRC8_EBU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_EBU_LOOP_METHOD)
+        [CRC_VARIANT_CRC8_EBU] = {"CRC-8/EBU", CRC_VARIANT_CRC8_EBU, 8, {0}, crc_registryCrc8EbuInitialize, crc_registryCrc8EbuUpdate, crc_registryCrc8EbuFinalize, crc_registryCrc8EbuCombine},
+#endif
+#if defined(CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_I_CODE_LOOP_METHOD)
+        [CRC_VARIANT_CRC8_I_CODE] = {"CRC-8/I-CODE", CRC_VARIANT_CRC8_I_CODE, 8, {0}, crc_registryCrc8ICodeInitialize, crc_registryCrc8ICodeUpdate, crc_registryCrc8ICodeFinalize, crc_registryCrc8ICodeCombine},
+#endif
+#if defined(CRC_CRC8_ITU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ITU_LOOP_METHOD)
+        [CRC_VARIANT_CRC8_ITU] = {"CRC-8/ITU", CRC_VARIANT_CRC8_ITU, 8, {0}, crc_registryCrc8ItuInitialize, crc_registryCrc8ItuUpdate, crc_registryCrc8ItuFinalize, crc_registryCrc8ItuCombine},
+#endif
+#if defined(CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_MAXIM_LOOP_METHOD)
+        [CRC_VARIANT_CRC8_MAXIM] = {"CRC-8/MAXIM", CRC_VARIANT_CRC8_MAXIM, 8, {0}, crc_registryCrc8MaximInitialize, crc_registryCrc8MaximUpdate, crc_registryCrc8MaximFinalize, crc_registryCrc8MaximCombine},
+#endif
+#if defined(CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ROHC_LOOP_METHOD)
+        [CRC_VARIANT_CRC8_ROHC] = {"CRC-8/ROHC", CRC_VARIANT_CRC8_ROHC, 8, {0}, crc_registryCrc8RohcInitialize, crc_registryCrc8RohcUpdate, crc_registryCrc8RohcFinalize, crc_registryCrc8RohcCombine},
+#endif
+#if defined(CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_WCDMA_LOOP_METHOD)
+        [CRC_VARIANT_CRC8_WCDMA] = {"CRC-8/WCDMA", CRC_VARIANT_CRC8_WCDMA, 8, {0}, crc_registryCrc8WcdmaInitialize, crc_registryCrc8WcdmaUpdate, crc_registryCrc8WcdmaFinalize, crc_registryCrc8WcdmaCombine},
+#endif
+#if defined(CRC_CRC16_ARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_ARC_LOOP_METHOD)
+        [CRC_VARIANT_CRC16_ARC] = {"CRC-16/ARC", CRC_VARIANT_CRC16_ARC, 16, {0}, crc_registryCrc16ArcInitialize, crc_registryCrc16ArcUpdate, crc_registryCrc16ArcFinalize, crc_registryCrc16ArcCombine},
+#endif
+#if defined(CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_CCITT_FALSE_LOOP_METHOD)
+        [CRC_VARIANT_CRC16_CCITT_FALSE] = {"CRC-16/CCITT-FALSE", CRC_VARIANT_CRC16_CCITT_FALSE, 16, {0}, crc_registryCrc16CcittFalseInitialize, crc_registryCrc16CcittFalseUpdate, crc_registryCrc16CcittFalseFinalize, crc_registryCrc16CcittFalseCombine},
+#endif
+    };
+    const crc_registry_slot_t *slot;
+    uint32_t hash = CRC_REGISTRY_SEED;
+    const char *c;
+    
+    /*** Error Check ***/
+    if(Name == NULL)
+        return NULL;
+    
+    /*** Hash Name ***/
+    for(c = Name; *c != '\0'; c++)
+        hash = (hash ^ (uint8_t)*c) * 16777619U;
+    
+    /*** Verify Slot Holds Name And Variant Is Enabled ***/
+    slot = &crc_registrySlot[hash >> (32 - CRC_REGISTRY_SLOT_BITS)];
+    if((slot->name == NULL) || (strcmp(slot->name, Name) != 0) || (Registry[slot->variant].initialize == NULL))
+        return NULL;
+    
+    return &Registry[slot->variant];
+}
+#endif
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+#ifdef CRC_GENERIC
+/****************************************************************************************************
+ * FUNCT:   crc_genericCrcFromRegister
+ * BRIEF:   Convert Register To CRC (Output Form)
+ * RETURN:  uint16_t: CRC
+ * ARG:     Parameters: CRC Parameters
+ * ARG:     Register: Register (Normal Form)
+ ****************************************************************************************************/
+static uint16_t crc_genericCrcFromRegister(const crc_parameters_t * const Parameters, const uint16_t Register)
+{
+    /*** Reflect Output And XOR Output ***/
+    return crc_genericReflect(Parameters, Register) ^ Parameters->xorOut;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_genericCrcFromState
+ * BRIEF:   Convert Partial State To CRC (Output Form)
+ * RETURN:  uint16_t: CRC
+ * ARG:     Parameters: CRC Parameters
+ * ARG:     State: Partial State (Returned By CalculatePartial With Final False)
+ ****************************************************************************************************/
+static uint16_t crc_genericCrcFromState(const crc_parameters_t * const Parameters, const uint16_t State)
+{
+    /*** Convert Partial State To CRC ***/
+    return crc_genericCrcFromRegister(Parameters, crc_genericRegisterFromState(Parameters, State));
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_genericDelta
+ * BRIEF:   Calculate Change In CRC Caused By XOR Delta
+ * RETURN:  uint16_t: Value To XOR Into Original CRC
+ * ARG:     Parameters: CRC Parameters
+ * ARG:     Delta: XOR Of Original And Modified Bytes
+ * ARG:     DeltaLength: Length Of Delta
+ * ARG:     Distance: Number Of Bytes From End Of Delta To End Of Data
+ * NOTE:    CRC Is Linear: CRC(A ^ B) = CRC(A) ^ CRC(B) ^ CRC(0); Initial Value And Output XOR Cancel, So
+ *          Only The Delta Is Run Through The Register (From Zero) And Then Shifted Past Distance
+ ****************************************************************************************************/
+static uint16_t crc_genericDelta(const crc_parameters_t * const Parameters, const uint8_t * const Delta, const uint16_t DeltaLength, const uint32_t Distance)
+{
+    uint16_t i, reg = 0x0000;
+    
+    /*** Run Delta Through Register ***/
+    for(i = 0; i < DeltaLength; i++)
+        reg = crc_genericUpdate(Parameters, reg, Delta[i]);
+    
+    /*** Shift Register Past Remaining Data; Convert To Output Form ***/
+    reg = crc_genericShift(Parameters, reg, Distance);
+    return crc_genericReflect(Parameters, reg);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_genericForge
+ * BRIEF:   Calculate Patch Bytes That Change CRC To Target
+ * RETURN:  bool: True If Patch Found
+ * ARG:     Parameters: CRC Parameters
+ * ARG:     Crc: CRC Of Data With Original Patch Bytes
+ * ARG:     Target: CRC To Reach
+ * ARG:     Distance: Number Of Bytes From End Of Patch To End Of Data
+ * ARG:     patch: Patch Bytes (Width / 8 Bytes; Original On Entry, Replacement On Return)
+ * NOTE:    Each Patch Bit Changes The CRC By A Fixed Column (Delta Shifted Past Distance); The Columns
+ *          Are Solved For The Required Change By Gauss-Jordan Elimination Over GF(2)
+ ****************************************************************************************************/
+static bool crc_genericForge(const crc_parameters_t * const Parameters, const uint16_t Crc, const uint16_t Target, const uint32_t Distance, uint8_t * const patch)
+{
+    uint8_t bit, i, k, rank = 0, unit[2];
+    uint16_t column[16], combination[16], factor, mask, required, solution = 0x0000, swap;
+    
+    /*** Build Columns (Register Change Caused By Each Patch Bit) ***/
+    factor = crc_genericShift(Parameters, 0x0001, Distance);
+    for(k = 0; k < Parameters->width; k++)
+    {
+        unit[0] = 0x00;
+        unit[1] = 0x00;
+        unit[k >> 3] = (uint8_t)(1U << (k & 0x07));
+        column[k] = 0x0000;
+        for(i = 0; i < (Parameters->width / 8); i++)
+            column[k] = crc_genericUpdate(Parameters, column[k], unit[i]);
+        column[k] = crc_genericMultiply(Parameters, column[k], factor);
+        combination[k] = (uint16_t)(1U << k);
+    }
+    
+    /*** Reduce Columns To Unit Vectors (Gauss-Jordan Elimination) ***/
+    for(bit = Parameters->width; bit > 0; bit--)
+    {
+        mask = (uint16_t)(1U << (bit - 1));
+        i = rank;
+        while((i < Parameters->width) && ((column[i] & mask) != mask))
+            i++;
+        if(i == Parameters->width)
+            continue;
+        swap = column[i];
+        column[i] = column[rank];
+        column[rank] = swap;
+        swap = combination[i];
+        combination[i] = combination[rank];
+        combination[rank] = swap;
+        for(i = 0; i < Parameters->width; i++)
+        {
+            if((i != rank) && ((column[i] & mask) == mask))
+            {
+                column[i] ^= column[rank];
+                combination[i] ^= combination[rank];
+            }
+        }
+        rank++;
+    }
+    if(rank != Parameters->width)
+        return false;
+    
+    /*** Combine Patch Bits For Required Register Change ***/
+    required = crc_genericReflect(Parameters, (uint16_t)(Crc ^ Target));
+    for(i = 0; i < Parameters->width; i++)
+    {
+        if((column[i] & required) != 0x0000)
+            solution ^= combination[i];
+    }
+    
+    /*** Apply Patch ***/
+    for(i = 0; i < (Parameters->width / 8); i++)
+        patch[i] ^= (uint8_t)(solution >> (8 * i));
+    
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_genericMultiply
+ * BRIEF:   Multiply Two Registers Modulo CRC Polynomial
+ * RETURN:  uint16_t: (A * B) Mod Polynomial
+ * ARG:     Parameters: CRC Parameters
+ * ARG:     A: Multiplicand (Normal Form Register)
+ * ARG:     B: Multiplier (Normal Form Register)
+ ****************************************************************************************************/
+static uint16_t crc_genericMultiply(const crc_parameters_t * const Parameters, const uint16_t A, const uint16_t B)
+{
+    uint8_t bit;
+    uint16_t mask, product = 0x0000, topBit;
+    
+    /*** Set Up ***/
+    mask = (uint16_t)((1UL << Parameters->width) - 1UL);
+    topBit = (uint16_t)(1U << (Parameters->width - 1));
+    
+    /*** Multiply (Shift And Add, Most Significant Bit Of A First) ***/
+    for(bit = Parameters->width; bit > 0; bit--)
+    {
+        if((product & topBit) == topBit)
+            product = (uint16_t)(((product << 1) ^ Parameters->polynomial) & mask);
+        else
+            product = (uint16_t)((product << 1) & mask);
+        if(((A >> (bit - 1)) & 0x0001) == 0x0001)
+            product ^= B;
+    }
+    
+    return product;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_genericReflect
+ * BRIEF:   Reflect Register If CRC Reflects Output
+ * RETURN:  uint16_t: Reflected (Or Unchanged) Register
+ * ARG:     Parameters: CRC Parameters
+ * ARG:     Register: Register To Reflect
+ ****************************************************************************************************/
+static uint16_t crc_genericReflect(const crc_parameters_t * const Parameters, const uint16_t Register)
+{
+    /*** Reflect Register ***/
+    if(!Parameters->reflect)
+        return Register;
+    else if(Parameters->width == 8)
+        return crc_inlineReflectU8((uint8_t)Register);
+    else
+        return crc_inlineReflectU16(Register);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_genericRegisterFromCrc
+ * BRIEF:   Convert CRC (Output Form) To Register
+ * RETURN:  uint16_t: Register (Normal Form)
+ * ARG:     Parameters: CRC Parameters
+ * ARG:     Crc: CRC
+ ****************************************************************************************************/
+static uint16_t crc_genericRegisterFromCrc(const crc_parameters_t * const Parameters, const uint16_t Crc)
+{
+    /*** Undo XOR Output And Reflect Output ***/
+    return crc_genericReflect(Parameters, Crc ^ Parameters->xorOut);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_genericRegisterFromState
+ * BRIEF:   Convert Partial State To Register
+ * RETURN:  uint16_t: Register (Normal Form)
+ * ARG:     Parameters: CRC Parameters
+ * ARG:     State: Partial State (Returned By CalculatePartial With Final False)
+ * NOTE:    Lookup Table Method Of Reflected Variants Keeps Register Reflected Between Partial Calls
+ ****************************************************************************************************/
+static uint16_t crc_genericRegisterFromState(const crc_parameters_t * const Parameters, const uint16_t State)
+{
+    /*** Convert Partial State To Register ***/
+    if(Parameters->reflectedState)
+        return crc_genericReflect(Parameters, State);
+    else
+        return State;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_genericReverseUpdate
+ * BRIEF:   Remove Data Byte From Register (Inverse Of crc_genericUpdate)
+ * RETURN:  uint16_t: Register Before Data Was Added (Normal Form)
+ * ARG:     Parameters: CRC Parameters
+ * ARG:     Register: Register After Data Was Added (Normal Form)
+ * ARG:     Data: Data Byte Last Added To Register
+ * NOTE:    Requires Polynomial With x^0 Term (True Of Every Supported Variant): Bit 0 Of Each Shifted
+ *          Register Is Then Set Exactly When The Polynomial Was XORed In, So Each Bit Step Inverts
+ ****************************************************************************************************/
+static uint16_t crc_genericReverseUpdate(const crc_parameters_t * const Parameters, uint16_t Register, const uint8_t Data)
+{
+    uint8_t bit;
+    uint16_t topBit;
+    
+    /*** Set Up ***/
+    topBit = (uint16_t)(1U << (Parameters->width - 1));
+    
+    /*** Undo Bit Steps ***/
+    for(bit = 0; bit < 8; bit++)
+    {
+        if((Register & 0x0001) == 0x0001)
+            Register = (uint16_t)(((Register ^ Parameters->polynomial) >> 1) | topBit);
+        else
+            Register >>= 1;
+    }
+    
+    /*** Remove Data Byte From Register ***/
+    if(Parameters->reflect)
+        Register ^= (uint16_t)(crc_inlineReflectU8(Data) << (Parameters->width - 8));
+    else
+        Register ^= (uint16_t)(Data << (Parameters->width - 8));
+    
+    return Register;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_genericRollingInitialize
+ * BRIEF:   Build Rolling (Sliding Window) Tables
+ * RETURN:  void: Returns Nothing
+ * ARG:     Parameters: CRC Parameters
+ * ARG:     Rolling: Rolling Context To Initialize
+ * ARG:     WindowLength: Length Of Sliding Window
+ * NOTE:    Appending In To Window [Out, ..., Last] Leaves Out Shifted By WindowLength Bytes And The
+ *          Initial Value Shifted By (WindowLength + 1) Bytes; Remove Table Cancels Both, Plus Restores
+ *          Initial Value Shifted By WindowLength Bytes. Remove Entries Are Linear In Out, So Only The
+ *          Eight Single Bit Entries Need A Shift
+ ****************************************************************************************************/
+static void crc_genericRollingInitialize(const crc_parameters_t * const Parameters, crc_rolling_t * const Rolling, const uint16_t WindowLength)
+{
+    uint8_t bit;
+    uint16_t i, initial, reg, remove[8];
+    
+    /*** Set Up ***/
+    Rolling->xorOut = Parameters->xorOut;
+    Rolling->width = Parameters->width;
+    Rolling->reflect = Parameters->reflect;
+    
+    /*** Build Update Table ***/
+    for(i = 0; i < 256; i++)
+        Rolling->updateTable[i] = crc_genericReflect(Parameters, crc_genericUpdate(Parameters, 0x0000, (uint8_t)i));
+    
+    /*** Build Remove Table ***/
+    initial = crc_genericShift(Parameters, Parameters->initial, WindowLength);
+    initial ^= crc_genericShift(Parameters, initial, 1);
+    for(bit = 0; bit < 8; bit++)
+        remove[bit] = crc_genericShift(Parameters, crc_genericUpdate(Parameters, 0x0000, (uint8_t)(1U << bit)), WindowLength);
+    for(i = 0; i < 256; i++)
+    {
+        reg = initial;
+        for(bit = 0; bit < 8; bit++)
+        {
+            if(((i >> bit) & 0x0001) == 0x0001)
+                reg ^= remove[bit];
+        }
+        Rolling->removeTable[i] = crc_genericReflect(Parameters, reg);
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_genericRollingUpdate
+ * BRIEF:   Slide Rolling Window Forward One Byte
+ * RETURN:  uint16_t: CRC Of New Window
+ * ARG:     Rolling: Rolling Context
+ * ARG:     Out: Data Leaving Window
+ * ARG:     In: Data Entering Window
+ * ARG:     Crc: CRC Of Current Window
+ ****************************************************************************************************/
+static uint16_t crc_genericRollingUpdate(const crc_rolling_t * const Rolling, const uint8_t Out, const uint8_t In, const uint16_t Crc)
+{
+    uint16_t reg;
+    
+    /*** Add In To Register ***/
+    reg = Crc ^ Rolling->xorOut;
+    if(Rolling->width == 8)
+        reg = Rolling->updateTable[(uint8_t)(reg ^ In)];
+    else if(Rolling->reflect)
+        reg = (uint16_t)((reg >> 8) ^ Rolling->updateTable[(uint8_t)(reg ^ In)]);
+    else
+        reg = (uint16_t)((reg << 8) ^ Rolling->updateTable[(uint8_t)((reg >> 8) ^ In)]);
+    
+    /*** Remove Out From Register ***/
+    reg ^= Rolling->removeTable[Out];
+    
+    return reg ^ Rolling->xorOut;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_genericShift
+ * BRIEF:   Advance Register Over Run Of Zero Bytes
+ * RETURN:  uint16_t: Register * x^(8 * ZeroBytes) Mod Polynomial
+ * ARG:     Parameters: CRC Parameters
+ * ARG:     Register: Register To Advance (Normal Form)
+ * ARG:     ZeroBytes: Number Of Zero Bytes
+ * NOTE:    Square-And-Multiply; Runs In O(log ZeroBytes) Rather Than O(ZeroBytes)
+ ****************************************************************************************************/
+static uint16_t crc_genericShift(const crc_parameters_t * const Parameters, uint16_t Register, uint32_t ZeroBytes)
+{
+    uint16_t power;
+    
+    /*** Calculate x^8 Mod Polynomial ***/
+    power = crc_genericUpdate(Parameters, 0x0001, 0x00);
+    
+    /*** Multiply Register By x^(8 * ZeroBytes) ***/
+    while(ZeroBytes != 0)
+    {
+        if((ZeroBytes & 0x00000001) == 0x00000001)
+            Register = crc_genericMultiply(Parameters, Register, power);
+        power = crc_genericMultiply(Parameters, power, power);
+        ZeroBytes >>= 1;
+    }
+    
+    return Register;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_genericShiftState
+ * BRIEF:   Advance Partial State Over Run Of Zero Bytes
+ * RETURN:  uint16_t: Partial State After ZeroBytes Zero Bytes
+ * ARG:     Parameters: CRC Parameters
+ * ARG:     State: Partial State (Returned By CalculatePartial With Final False)
+ * ARG:     ZeroBytes: Number Of Zero Bytes
+ ****************************************************************************************************/
+static uint16_t crc_genericShiftState(const crc_parameters_t * const Parameters, const uint16_t State, const uint32_t ZeroBytes)
+{
+    uint16_t reg;
+    
+    /*** Shift Register ***/
+    reg = crc_genericRegisterFromState(Parameters, State);
+    reg = crc_genericShift(Parameters, reg, ZeroBytes);
+    
+    return crc_genericStateFromRegister(Parameters, reg);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_genericStateFromRegister
+ * BRIEF:   Convert Register To Partial State
+ * RETURN:  uint16_t: Partial State
+ * ARG:     Parameters: CRC Parameters
+ * ARG:     Register: Register (Normal Form)
+ ****************************************************************************************************/
+static uint16_t crc_genericStateFromRegister(const crc_parameters_t * const Parameters, const uint16_t Register)
+{
+    /*** Convert Register To Partial State ***/
+    if(Parameters->reflectedState)
+        return crc_genericReflect(Parameters, Register);
+    else
+        return Register;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_genericStripPrefix
+ * BRIEF:   Remove Prefix From CRC
+ * RETURN:  uint16_t: CRC Of Suffix
+ * ARG:     Parameters: CRC Parameters
+ * ARG:     Crc: CRC Of Prefix Followed By Suffix
+ * ARG:     PrefixCrc: CRC Of Prefix
+ * ARG:     SuffixLength: Length Of Suffix
+ * NOTE:    Register(Prefix + Suffix) = Register(Prefix) * x^(8 * SuffixLength) ^ Register0(Suffix),
+ *          Register(Suffix) = Initial * x^(8 * SuffixLength) ^ Register0(Suffix)
+ ****************************************************************************************************/
+static uint16_t crc_genericStripPrefix(const crc_parameters_t * const Parameters, const uint16_t Crc, const uint16_t PrefixCrc, const uint32_t SuffixLength)
+{
+    uint16_t reg;
+    
+    /*** Replace Prefix Contribution With Initial Value Contribution ***/
+    reg = crc_genericRegisterFromCrc(Parameters, PrefixCrc) ^ Parameters->initial;
+    reg = crc_genericShift(Parameters, reg, SuffixLength);
+    reg ^= crc_genericRegisterFromCrc(Parameters, Crc);
+    
+    return crc_genericCrcFromRegister(Parameters, reg);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_genericUnwind
+ * BRIEF:   Run CRC Backward Over Trailing Data
+ * RETURN:  uint16_t: CRC Of Data Preceding Trailing Data
+ * ARG:     Parameters: CRC Parameters
+ * ARG:     Crc: CRC Of Data Including Trailing Data
+ * ARG:     Data: Trailing Data Buffer
+ * ARG:     DataLength: Length Of Trailing Data Buffer
+ ****************************************************************************************************/
+static uint16_t crc_genericUnwind(const crc_parameters_t * const Parameters, const uint16_t Crc, const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint16_t i, reg;
+    
+    /*** Remove Trailing Data From Register (Last Byte First) ***/
+    reg = crc_genericRegisterFromCrc(Parameters, Crc);
+    for(i = DataLength; i > 0; i--)
+        reg = crc_genericReverseUpdate(Parameters, reg, Data[i - 1]);
+    
+    return crc_genericCrcFromRegister(Parameters, reg);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_genericUpdate
+ * BRIEF:   Add Data Byte To Register (Bitwise, Table-Free)
+ * RETURN:  uint16_t: Updated Register (Normal Form)
+ * ARG:     Parameters: CRC Parameters
+ * ARG:     Register: Current Register (Normal Form)
+ * ARG:     Data: Data To Add To Register (Reflected First If CRC Reflects Input)
+ ****************************************************************************************************/
+static uint16_t crc_genericUpdate(const crc_parameters_t * const Parameters, uint16_t Register, const uint8_t Data)
+{
+    uint8_t bit;
+    uint16_t mask, topBit;
+    
+    /*** Set Up ***/
+    mask = (uint16_t)((1UL << Parameters->width) - 1UL);
+    topBit = (uint16_t)(1U << (Parameters->width - 1));
+    
+    /*** Add Data Byte To Register ***/
+    if(Parameters->reflect)
+        Register ^= (uint16_t)(crc_inlineReflectU8(Data) << (Parameters->width - 8));
+    else
+        Register ^= (uint16_t)(Data << (Parameters->width - 8));
+    for(bit = 0; bit < 8; bit++)
+    {
+        if((Register & topBit) == topBit)
+            Register = (uint16_t)(((Register << 1) ^ Parameters->polynomial) & mask);
+        else
+            Register = (uint16_t)((Register << 1) & mask);
+    }
+    
+    return Register;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_genericUpdateBits
+ * BRIEF:   Add Bits Of Data Byte To Partial State (Bitwise, Table-Free)
+ * RETURN:  uint16_t: Updated Partial State
+ * ARG:     Parameters: CRC Parameters
+ * ARG:     State: Partial State (Returned By CalculatePartial With Final False)
+ * ARG:     Data: Data Byte Containing Bits
+ * ARG:     FirstBit: Index Of First Bit To Add (Transmission Order)
+ * ARG:     BitCount: Number Of Bits To Add
+ * NOTE:    Transmission Order Is Most Significant Bit First, Or Least Significant Bit First If CRC
+ *          Reflects Input
+ ****************************************************************************************************/
+static uint16_t crc_genericUpdateBits(const crc_parameters_t * const Parameters, const uint16_t State, const uint8_t Data, const uint8_t FirstBit, const uint8_t BitCount)
+{
+    uint8_t bit, data;
+    uint16_t mask, reg, topBit;
+    
+    /*** Set Up ***/
+    mask = (uint16_t)((1UL << Parameters->width) - 1UL);
+    topBit = (uint16_t)(1U << (Parameters->width - 1));
+    reg = crc_genericRegisterFromState(Parameters, State);
+    data = Parameters->reflect ? crc_inlineReflectU8(Data) : Data;
+    
+    /*** Add Bits To Register (Most Significant Bit Of Normal Form Data First) ***/
+    for(bit = FirstBit; bit < (FirstBit + BitCount); bit++)
+    {
+        if(((data >> (7 - bit)) & 0x01) == 0x01)
+            reg ^= topBit;
+        if((reg & topBit) == topBit)
+            reg = (uint16_t)(((reg << 1) ^ Parameters->polynomial) & mask);
+        else
+            reg = (uint16_t)((reg << 1) & mask);
+    }
+    
+    return crc_genericStateFromRegister(Parameters, reg);
+}
+#endif
+
+#ifdef CRC_SYNDROME
+/****************************************************************************************************
+ * FUNCT:   crc_syndromeCorrect
+ * BRIEF:   Correct Bit Errors Using Syndrome Table
+ * RETURN:  crc_correction_t: Correction Result
+ * ARG:     Parameters: CRC Parameters
+ * ARG:     Position: Syndrome Table (Error Bit Distances Indexed By Syndrome)
+ * ARG:     data: Data Buffer (Including CRC) To Correct
+ * ARG:     DataLength: Length Of Data Buffer (Including CRC)
+ * ARG:     Syndrome: Syndrome (Register XOR Residue, Native Register Form)
+ * NOTE:    Table May Be Built For Longer Data; Error Bit Distances Only Depend On Position From End
+ *          Of Data, So Entries Within Data Stay Valid And Entries Beyond It Are Rejected
+ ****************************************************************************************************/
+static crc_correction_t crc_syndromeCorrect(const crc_parameters_t * const Parameters, const uint32_t * const Position, uint8_t * const data, const uint16_t DataLength, const uint16_t Syndrome)
+{
+    uint32_t entry, first, second;
+    
+    /*** No Error ***/
+    if(Syndrome == 0x0000)
+        return CRC_CORRECTION_NONE;
+    
+    /*** Look Up Error Pattern ***/
+    entry = Position[Syndrome];
+    if((entry == 0) || ((entry & CRC_SYNDROME_AMBIGUOUS) == CRC_SYNDROME_AMBIGUOUS))
+        return CRC_CORRECTION_FAILED;
+    first = entry & CRC_SYNDROME_FIRST_MASK;
+    second = (entry >> CRC_SYNDROME_SECOND_SHIFT) & CRC_SYNDROME_SECOND_MASK;
+    
+    /*** Reject Error Patterns Beyond Data (Table Built For Longer Data) ***/
+    if((first > ((uint32_t)DataLength * 8)) || (second > ((uint32_t)DataLength * 8)))
+        return CRC_CORRECTION_FAILED;
+    
+    /*** Correct Single Bit Error ***/
+    crc_syndromeFlipBit(Parameters, data, DataLength, first - 1);
+    if(second == 0)
+        return CRC_CORRECTION_SINGLE;
+    
+    /*** Correct Double Bit Error ***/
+    crc_syndromeFlipBit(Parameters, data, DataLength, second - 1);
+    return CRC_CORRECTION_DOUBLE;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_syndromeFlipBit
+ * BRIEF:   Flip Bit At Distance From End Of Data
+ * RETURN:  void: Returns Nothing
+ * ARG:     Parameters: CRC Parameters
+ * ARG:     data: Data Buffer
+ * ARG:     DataLength: Length Of Data Buffer
+ * ARG:     Distance: Bit Distance From Last Transmitted Bit
+ ****************************************************************************************************/
+static void crc_syndromeFlipBit(const crc_parameters_t * const Parameters, uint8_t * const data, const uint16_t DataLength, const uint32_t Distance)
+{
+    /*** Flip Bit (Transmission Order: Least Significant Bit First If Reflected) ***/
+    if(Parameters->reflect)
+        data[DataLength - 1 - (Distance >> 3)] ^= (uint8_t)(0x80U >> (Distance & 0x07));
+    else
+        data[DataLength - 1 - (Distance >> 3)] ^= (uint8_t)(1U << (Distance & 0x07));
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_syndromeInitialize
+ * BRIEF:   Build Syndrome Table For Data Length
+ * RETURN:  void: Returns Nothing
+ * ARG:     Parameters: CRC Parameters
+ * ARG:     position: Syndrome Table To Build (2^Width Entries)
+ * ARG:     BitLength: Length Of Data (Including CRC) In Bits
+ * NOTE:    Syndromes Shared By More Than One Error Pattern Are Marked Ambiguous; Double Bit Errors
+ *          Are Only Mapped While The Number Of Bit Pairs Fits In The Syndrome Space
+ ****************************************************************************************************/
+static void crc_syndromeInitialize(const crc_parameters_t * const Parameters, uint32_t * const position, const uint32_t BitLength)
+{
+    uint16_t syndromeA, syndromeB;
+    uint32_t a, b, count, i;
+    
+    /*** Clear Syndrome Table ***/
+    count = 1UL << Parameters->width;
+    for(i = 0; i < count; i++)
+        position[i] = 0;
+    
+    /*** Map Single Bit Errors (Syndrome Of Last Bit Is x^Width) ***/
+    syndromeA = Parameters->polynomial;
+    for(a = 0; a < BitLength; a++)
     {
-        if((crc8Cdma2000 & 0x80) == 0x80)
-            crc8Cdma2000 = (uint8_t)((crc8Cdma2000 << 1) ^ CRC_CRC8_CDMA2000_POLYNOMIAL);
+        if(position[syndromeA] == 0)
+            position[syndromeA] = a + 1;
         else
-            crc8Cdma2000 <<= 1;
+            position[syndromeA] |= CRC_SYNDROME_AMBIGUOUS;
+        syndromeA = crc_genericMultiply(Parameters, syndromeA, 0x0002);
     }
     
-    return crc8Cdma2000;
-#endif
+    /*** Map Double Bit Errors ***/
+    if((((uint64_t)BitLength * (BitLength - 1)) / 2) > count)
+        return;
+    syndromeA = Parameters->polynomial;
+    for(a = 0; a < BitLength; a++)
+    {
+        syndromeB = crc_genericMultiply(Parameters, syndromeA, 0x0002);
+        for(b = a + 1; b < BitLength; b++)
+        {
+            i = (uint16_t)(syndromeA ^ syndromeB);
+            if(position[i] == 0)
+                position[i] = (a + 1) | ((b + 1) << CRC_SYNDROME_SECOND_SHIFT);
+            else
+                position[i] |= CRC_SYNDROME_AMBIGUOUS;
+            syndromeB = crc_genericMultiply(Parameters, syndromeB, 0x0002);
+        }
+        syndromeA = crc_genericMultiply(Parameters, syndromeA, 0x0002);
+    }
 }
 #endif
 
-#if defined(CRC_CRC8_DARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DARC_LOOP_METHOD)
+#ifdef CRC_REVERSE
 /****************************************************************************************************
- * FUNCT:   crc_crc8DarcCalculate
- * BRIEF:   Calculate Full CRC-8/DARC
- * RETURN:  uint8_t: CRC-8/DARC
- * ARG:     Data: Data Buffer To Calculate CRC-8/DARC For
+ * FUNCT:   crc_reverseCalculate
+ * BRIEF:   Calculate CRC For Model
+ * RETURN:  uint16_t: CRC
+ * ARG:     Model: CRC Model
+ * ARG:     Data: Data Buffer To Calculate CRC For
  * ARG:     DataLength: Length Of Data Buffer
  ****************************************************************************************************/
-uint8_t crc_crc8DarcCalculate(const uint8_t * const Data, const uint16_t DataLength)
+static uint16_t crc_reverseCalculate(const crc_model_t * const Model, const uint8_t * const Data, const uint16_t DataLength)
 {
-    uint8_t crc8Darc = CRC_CRC8_DARC_INITIAL_CRC8_DARC;
-    uint32_t i;
-
-    /*** Error Check ***/
-    if((Data == NULL) || (DataLength == 0))
-        return CRC_CRC8_DARC_INITIAL_CRC8_DARC;
-
-    /*** Calculate CRC-8/DARC ***/
-    for(i = 0; i < (DataLength - 1); i++)
-        crc8Darc = crc_crc8DarcCalculatePartial(Data[i], crc8Darc, false);
-    crc8Darc = crc_crc8DarcCalculatePartial(Data[i], crc8Darc, true);
+    crc_parameters_t parameters;
+    uint16_t i, reg;
+    
+    /*** Set Up ***/
+    parameters.width = Model->width;
+    parameters.polynomial = Model->polynomial;
+    parameters.initial = Model->initial;
+    parameters.reflect = Model->reflectIn;
+    parameters.xorOut = Model->xorOut;
+    parameters.reflectedState = false;
+    
+    /*** Run Data Through Register ***/
+    reg = Model->initial;
+    for(i = 0; i < DataLength; i++)
+        reg = crc_genericUpdate(&parameters, reg, Data[i]);
+    
+    /*** Reflect Output And XOR Output ***/
+    parameters.reflect = Model->reflectOut;
+    return crc_genericReflect(&parameters, reg) ^ Model->xorOut;
+}
 
-    return crc8Darc;
+/****************************************************************************************************
+ * FUNCT:   crc_reverseMatchPreset
+ * BRIEF:   Find Preset Equal To Model
+ * RETURN:  crc_variant_t: Matching Preset (CRC_VARIANT_COUNT If None)
+ * ARG:     Model: CRC Model
+ ****************************************************************************************************/
+static crc_variant_t crc_reverseMatchPreset(const crc_model_t * const Model)
+{
+    uint8_t v;
+    
+    /*** Compare Model Against Presets ***/
+    for(v = 0; v < CRC_VARIANT_COUNT; v++)
+    {
+        if((crc_reversePresetModel[v].width == Model->width)           &&
+           (crc_reversePresetModel[v].polynomial == Model->polynomial) &&
+           (crc_reversePresetModel[v].initial == Model->initial)       &&
+           (crc_reversePresetModel[v].reflectIn == Model->reflectIn)   &&
+           (crc_reversePresetModel[v].reflectOut == Model->reflectOut) &&
+           (crc_reversePresetModel[v].xorOut == Model->xorOut))
+            return crc_reversePresetModel[v].variant;
+    }
+    
+    return CRC_VARIANT_COUNT;
 }
 
 /****************************************************************************************************
- * FUNCT:   crc_crc8DarcCalculatePartial
- * BRIEF:   Calculate Partial CRC-8/DARC
- * RETURN:  uint8_t: Current/Final CRC-8/DARC
- * ARG:     Data: Data To Add To CRC-8/DARC Calculation
- * ARG:     crc8Darc: Current CRC-8/DARC
- * ARG:     Final: Final Data (Unused If CRC_CRC8_DARC_LOOKUP_TABLE_METHOD)
- * NOTE:    Set CRC-8/DARC Value To CRC_CRC8_DARC_INITIAL_CRC8_DARC If First Data Byte (Data[0]);
- *          Returned CRC-8/DARC Value Should Be Used On Subsequent Data Bytes (Data[1] ... Data[n])
+ * FUNCT:   crc_reverseSolve
+ * BRIEF:   Solve Initial Value And Output XOR For Polynomial And Reflection
+ * RETURN:  bool: True If All Samples Are Consistent
+ * ARG:     Parameters: CRC Parameters (Width, Polynomial And Input Reflection)
+ * ARG:     ReflectOut: Reflect Output
+ * ARG:     Sample: Sample Messages With Their CRCs
+ * ARG:     SampleCount: Number Of Samples
+ * ARG:     model: Solved Model
+ * NOTE:    Each Sample Gives Width Equations Register = (Initial * x^(8 * Length)) ^ Message ^ XorOut
+ *          (Register Form) In 2 * Width Unknowns; Rows Are Reduced As They Arrive So Inconsistent
+ *          Polynomials Are Rejected Early; If Unknowns Are Left Free, A Consistent Preset Is Preferred,
+ *          Otherwise Free Unknowns Are Set To Zero
  ****************************************************************************************************/
-uint8_t crc_crc8DarcCalculatePartial(const uint8_t Data, uint8_t crc8Darc, const bool Final)
+static bool crc_reverseSolve(const crc_parameters_t * const Parameters, const bool ReflectOut, const crc_sample_t * const Sample, const uint16_t SampleCount, crc_model_t * const model)
 {
-#if defined(CRC_CRC8_DARC_LOOKUP_TABLE_METHOD) && defined(CRC_CRC8_DARC_LOOP_METHOD)
-  #error CRC_CRC8_DARC_LOOKUP_TABLE_METHOD And CRC_CRC8_DARC_LOOP_METHOD Cannot Both Be Defined
-#elif defined(CRC_CRC8_DARC_LOOKUP_TABLE_METHOD) 
-    /*** Calculate Partial CRC-8/DARC ***/
-    (void)Final; // Silence Compiler Warning
-    crc8Darc = crc_crc8DarcLookupTable[Data ^ crc8Darc];
-    return crc8Darc;
-#elif defined(CRC_CRC8_DARC_LOOP_METHOD)
-    uint8_t bit, data;
+    crc_parameters_t output = *Parameters;
+    uint8_t bit, k, pivot, right, rowRight[32], v;
+    uint16_t column[16], i, message, s, shift;
+    uint32_t row, rowPivot[32], solution, used = 0;
     
-    /*** Reflect Input (Data) ***/
-    data = crc_reflectU8(Data);
+    /*** Reduce Equations Of Each Sample ***/
+    output.reflect = ReflectOut;
+    for(s = 0; s < SampleCount; s++)
+    {
+        /* Register Of Message From Zero And Initial Value Columns */
+        if((Sample[s].crc >> Parameters->width) != 0x0000)
+            return false;
+        message = 0x0000;
+        for(i = 0; i < Sample[s].length; i++)
+            message = crc_genericUpdate(Parameters, message, Sample[s].data[i]);
+        message ^= crc_genericReflect(&output, Sample[s].crc);
+        shift = crc_genericShift(Parameters, 0x0001, Sample[s].length);
+        for(k = 0; k < Parameters->width; k++)
+            column[k] = crc_genericMultiply(Parameters, (uint16_t)(1U << k), shift);
+        
+        /* One Equation Per Register Bit */
+        for(bit = 0; bit < Parameters->width; bit++)
+        {
+            row = 1UL << (Parameters->width + bit);
+            for(k = 0; k < Parameters->width; k++)
+                row |= (uint32_t)((column[k] >> bit) & 0x0001) << k;
+            right = (uint8_t)((message >> bit) & 0x0001);
+            for(pivot = (uint8_t)(2 * Parameters->width); (pivot > 0) && (row != 0); pivot--)
+            {
+                if(((row >> (pivot - 1)) & 0x00000001UL) == 0)
+                    continue;
+                else if(((used >> (pivot - 1)) & 0x00000001UL) == 0)
+                    break;
+                row ^= rowPivot[pivot - 1];
+                right ^= rowRight[pivot - 1];
+            }
+            if(row == 0)
+            {
+                if(right != 0)
+                    return false;
+                continue;
+            }
+            rowPivot[pivot - 1] = row;
+            rowRight[pivot - 1] = right;
+            used |= 1UL << (pivot - 1);
+        }
+    }
     
-    /*** Calculate Partial CRC-8/DARC ***/
-    crc8Darc ^= data;
-    for(bit = 0; bit < 8; bit++)
+    /*** Build Model ***/
+    model->width = Parameters->width;
+    model->polynomial = Parameters->polynomial;
+    model->reflectIn = Parameters->reflect;
+    model->reflectOut = ReflectOut;
+    
+    /*** Prefer Preset Where Samples Cannot Separate Initial Value And Output XOR ***/
+    for(v = 0; v < CRC_VARIANT_COUNT; v++)
     {
-        if((crc8Darc & 0x80) == 0x80)
-            crc8Darc = (uint8_t)((crc8Darc << 1) ^ CRC_CRC8_DARC_POLYNOMIAL);
-        else
-            crc8Darc <<= 1;
+        model->initial = crc_reversePresetModel[v].initial;
+        model->xorOut = crc_reversePresetModel[v].xorOut;
+        if(crc_reverseMatchPreset(model) != crc_reversePresetModel[v].variant)
+            continue;
+        solution = model->initial | ((uint32_t)crc_genericReflect(&output, model->xorOut) << Parameters->width);
+        for(pivot = 0; pivot < (2 * Parameters->width); pivot++)
+        {
+            if(((used >> pivot) & 0x00000001UL) == 0)
+                continue;
+            right = rowRight[pivot];
+            for(row = rowPivot[pivot] & solution; row != 0; row &= row - 1)
+                right ^= 1;
+            if(right != 0)
+                break;
+        }
+        if(pivot == (2 * Parameters->width))
+        {
+            model->variant = crc_reversePresetModel[v].variant;
+            return true;
+        }
     }
     
-    /*** Reflect Output (CRC-8/DARC) On Final Data ***/
-    if(Final)
-        crc8Darc = crc_reflectU8(crc8Darc);
+    /*** Back Substitute (Lowest Pivot First; Free Unknowns Are Zero) ***/
+    solution = 0;
+    for(pivot = 0; pivot < (2 * Parameters->width); pivot++)
+    {
+        if(((used >> pivot) & 0x00000001UL) == 0)
+            continue;
+        right = rowRight[pivot];
+        for(row = rowPivot[pivot] & (uint32_t)((1UL << pivot) - 1UL) & solution; row != 0; row &= row - 1)
+            right ^= 1;
+        solution |= (uint32_t)right << pivot;
+    }
+    model->initial = (uint16_t)(solution & ((1UL << Parameters->width) - 1UL));
+    model->xorOut = crc_genericReflect(&output, (uint16_t)(solution >> Parameters->width));
+    model->variant = crc_reverseMatchPreset(model);
     
-    return crc8Darc;
-#endif
+    return true;
 }
 #endif
 
-#if defined(CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DVB_S2_LOOP_METHOD)
+#ifdef CRC_METRICS
 /****************************************************************************************************
- * FUNCT:   crc_crc8DvbS2Calculate
- * BRIEF:   Calculate Full CRC-8/DVB-S2
- * RETURN:  uint8_t: CRC-8/DVB-S2
- * ARG:     Data: Data Buffer To Calculate CRC-8/DVB-S2 For
- * ARG:     DataLength: Length Of Data Buffer
+ * FUNCT:   crc_metricsAdd
+ * BRIEF:   Add To Counter Owned By This Thread
+ * RETURN:  void: Returns Nothing
+ * ARG:     counter: Counter To Add To
+ * ARG:     Value: Value To Add
+ * NOTE:    Only The Owning Thread Writes, So A Relaxed Load And Store Suffices (No Locked
+ *          Read-Modify-Write); Snapshots Still Read Whole Values.
  ****************************************************************************************************/
-uint8_t crc_crc8DvbS2Calculate(const uint8_t * const Data, const uint16_t DataLength)
+static void crc_metricsAdd(CRC_ATOMIC uint64_t * const counter, const uint64_t Value)
 {
-    uint8_t crc8DvbS2 = CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2;
-    uint32_t i;
-
-    /*** Error Check ***/
-    if((Data == NULL) || (DataLength == 0))
-        return CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2;
-
-    /*** Calculate Full CRC-8/DVB-S2 ***/
-    for(i = 0; i < DataLength; i++)
-        crc8DvbS2 = crc_crc8DvbS2CalculatePartial(Data[i], crc8DvbS2);
-
-    return crc8DvbS2;
+    CRC_ATOMIC_STORE(counter, CRC_ATOMIC_LOAD(counter, CRC_ATOMIC_RELAXED) + Value, CRC_ATOMIC_RELAXED);
 }
 
 /****************************************************************************************************
- * FUNCT:   crc_crc8DvbS2CalculatePartial
- * BRIEF:   Calculate Partial CRC-8/DVB-S2
- * RETURN:  uint8_t: Current/Final CRC-8/DVB-S2
- * ARG:     Data: Data To Add To CRC-8/DVB-S2 Calculation
- * ARG:     crc8DvbS2: Current CRC-8/DVB-S2
- * NOTE:    Set CRC-8/DVB-S2 Value To CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2 If First Data Byte
- *          (Data[0]); Returned CRC-8/DVB-S2 Value Should Be Used On Subsequent Data Bytes
- *          (Data[1] ... Data[n])
+ * FUNCT:   crc_metricsBegin
+ * BRIEF:   Record Calculate Call
+ * RETURN:  uint64_t: Start Timestamp If Call Is Timed; 0 Otherwise
+ * ARG:     Variant: CRC Variant
+ * ARG:     DataLength: Length Of Data Buffer
+ * NOTE:    One Call In Every CRC_METRICS_SAMPLE_PERIOD Is Timed.
  ****************************************************************************************************/
-uint8_t crc_crc8DvbS2CalculatePartial(const uint8_t Data, uint8_t crc8DvbS2)
+static uint64_t crc_metricsBegin(const crc_variant_t Variant, const uint32_t DataLength)
 {
-#if defined(CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD) && defined(CRC_CRC8_DVB_S2_LOOP_METHOD)
-  #error CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD And CRC_CRC8_DVB_S2_LOOP_METHOD Cannot Both Be Defined
-#elif defined(CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD) 
-    /*** Calculate Partial CRC-8/DVB-S2 ***/
-    crc8DvbS2 = crc_crc8DvbS2LookupTable[Data ^ crc8DvbS2];
-    return crc8DvbS2;
-#elif defined(CRC_CRC8_DVB_S2_LOOP_METHOD)
-    uint8_t bit;
+    crc_metrics_thread_t *thread;
     
-    /*** Calculate Partial CRC-8/DVB-S2 ***/
-    crc8DvbS2 ^= Data;
-    for(bit = 0; bit < 8; bit++)
+    /*** Count Call ***/
+    thread = crc_metricsCount(Variant, DataLength);
+    if(thread == NULL)
+        return 0;
+    
+    /*** Time Sampled Call ***/
+    if(thread->sample != 0)
     {
-        if((crc8DvbS2 & 0x80) == 0x80)
-            crc8DvbS2 = (uint8_t)((crc8DvbS2 << 1) ^ CRC_CRC8_DVB_S2_POLYNOMIAL);
-        else
-            crc8DvbS2 <<= 1;
+        thread->sample--;
+        return 0;
     }
+    thread->sample = CRC_METRICS_SAMPLE_PERIOD - 1;
     
-    return crc8DvbS2;
-#endif
+    return crc_metricsTimestamp();
 }
-#endif
 
-#if defined(CRC_CRC8_EBU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_EBU_LOOP_METHOD)
 /****************************************************************************************************
- * FUNCT:   crc_crc8EbuCalculate
- * BRIEF:   Calculate Full CRC-8/EBU
- * RETURN:  uint8_t: CRC-8/EBU
- * ARG:     Data: Data Buffer To Calculate CRC-8/EBU For
- * ARG:     DataLength: Length Of Data Buffer
+ * FUNCT:   crc_metricsBucket
+ * BRIEF:   Get Histogram Bucket Of Value
+ * RETURN:  uint8_t: floor(log2(value)) (0 For 0 And 1; Capped At CRC_METRICS_BUCKET_COUNT - 1)
+ * ARG:     value: Value To Bucket
  ****************************************************************************************************/
-uint8_t crc_crc8EbuCalculate(const uint8_t * const Data, const uint16_t DataLength)
+static uint8_t crc_metricsBucket(uint64_t value)
 {
-    uint8_t crc8Ebu = CRC_CRC8_EBU_INITIAL_CRC8_EBU;
-    uint32_t i;
-
-    /*** Error Check ***/
-    if((Data == NULL) || (DataLength == 0))
-        return CRC_CRC8_EBU_INITIAL_CRC8_EBU;
-
-    /*** Calculate CRC-8/EBU ***/
-    for(i = 0; i < (DataLength - 1); i++)
-        crc8Ebu = crc_crc8EbuCalculatePartial(Data[i], crc8Ebu, false);
-    crc8Ebu = crc_crc8EbuCalculatePartial(Data[i], crc8Ebu, true);
-
-    return crc8Ebu;
+    uint8_t bucket = 0;
+    
+    /*** Find Highest Set Bit ***/
+    while((value > 1) && (bucket < (CRC_METRICS_BUCKET_COUNT - 1)))
+    {
+        value >>= 1;
+        bucket++;
+    }
+    
+    return bucket;
 }
 
 /****************************************************************************************************
- * FUNCT:   crc_crc8EbuCalculatePartial
- * BRIEF:   Calculate Partial CRC-8/EBU
- * RETURN:  uint8_t: Current/Final CRC-8/EBU
- * ARG:     Data: Data To Add To CRC-8/EBU Calculation
- * ARG:     crc8Ebu: Current CRC-8/EBU
- * ARG:     Final: Final Data (Unused If CRC_CRC8_EBU_LOOKUP_TABLE_METHOD)
- * NOTE:    Set CRC-8/EBU Value To CRC_CRC8_EBU_INITIAL_CRC8_EBU If First Data Byte (Data[0]);
- *          Returned CRC-8/EBU Value Should Be Used On Subsequent Data Bytes (Data[1] ... Data[n])
+ * FUNCT:   crc_metricsCount
+ * BRIEF:   Count Call, Bytes And Length (Not Timed)
+ * RETURN:  crc_metrics_thread_t *: This Thread's Counters (NULL If Registration Failed)
+ * ARG:     Variant: CRC Variant
+ * ARG:     DataLength: Length Of Data Buffer
+ * NOTE:    Registers The Calling Thread On Its First Call
  ****************************************************************************************************/
-uint8_t crc_crc8EbuCalculatePartial(const uint8_t Data, uint8_t crc8Ebu, const bool Final)
+static crc_metrics_thread_t *crc_metricsCount(const crc_variant_t Variant, const uint32_t DataLength)
 {
-#if defined(CRC_CRC8_EBU_LOOKUP_TABLE_METHOD) && defined(CRC_CRC8_EBU_LOOP_METHOD)
-  #error CRC_CRC8_EBU_LOOKUP_TABLE_METHOD And CRC_CRC8_EBU_LOOP_METHOD Cannot Both Be Defined
-#elif defined(CRC_CRC8_EBU_LOOKUP_TABLE_METHOD) 
-    /*** Calculate Partial CRC-8/EBU ***/
-    (void)Final; // Silence Compiler Warning
-    crc8Ebu ^= CRC_CRC8_EBU_INITIAL_CRC8_EBU;
-    crc8Ebu = crc_crc8EbuLookupTable[Data ^ crc8Ebu];
-    return crc8Ebu;
-#elif defined(CRC_CRC8_EBU_LOOP_METHOD)
-    uint8_t bit, data;
-    
-    /*** Reflect Input (Data) ***/
-    data = crc_reflectU8(Data);
+    crc_metrics_thread_t *thread = crc_metricsThread;
+    crc_metrics_counter_t *counter;
     
-    /*** Calculate Partial CRC-8/EBU ***/
-    crc8Ebu ^= data;
-    for(bit = 0; bit < 8; bit++)
+    /*** Register Thread On First Call ***/
+    if(thread == NULL)
     {
-        if((crc8Ebu & 0x80) == 0x80)
-            crc8Ebu = (uint8_t)((crc8Ebu << 1) ^ CRC_CRC8_EBU_POLYNOMIAL);
-        else
-            crc8Ebu <<= 1;
+        thread = calloc(1, sizeof(*thread));
+        if(thread == NULL)
+            return NULL;
+        (void)pthread_once(&crc_metricsOnce, crc_metricsKeyCreate);
+        (void)pthread_setspecific(crc_metricsKey, thread);
+        (void)pthread_mutex_lock(&crc_metricsMutex);
+        thread->next = crc_metricsThreadList;
+        if(crc_metricsThreadList != NULL)
+            crc_metricsThreadList->previous = thread;
+        crc_metricsThreadList = thread;
+        (void)pthread_mutex_unlock(&crc_metricsMutex);
+        crc_metricsThread = thread;
     }
     
-    /*** Reflect Output (CRC-8/EBU) On Final Data ***/
-    if(Final)
-        crc8Ebu = crc_reflectU8(crc8Ebu);
+    /*** Count Call, Bytes And Length ***/
+    counter = &thread->counter[Variant];
+    crc_metricsAdd(&counter->calls, 1);
+    crc_metricsAdd(&counter->bytes, DataLength);
+    crc_metricsAdd(&counter->length[crc_metricsBucket(DataLength)], 1);
     
-    return crc8Ebu;
-#endif
+    return thread;
 }
-#endif
 
-#if defined(CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_I_CODE_LOOP_METHOD)
 /****************************************************************************************************
- * FUNCT:   crc_crc8ICodeCalculate
- * BRIEF:   Calculate Full CRC-8/I-CODE
- * RETURN:  uint8_t: CRC-8/I-CODE
- * ARG:     Data: Data Buffer To Calculate CRC-8/I-CODE For
- * ARG:     DataLength: Length Of Data Buffer
+ * FUNCT:   crc_metricsEnd
+ * BRIEF:   Record Duration Of Timed Calculate Call
+ * RETURN:  void: Returns Nothing
+ * ARG:     Variant: CRC Variant
+ * ARG:     Start: Start Timestamp From crc_metricsBegin (0 If Call Not Timed)
  ****************************************************************************************************/
-uint8_t crc_crc8ICodeCalculate(const uint8_t * const Data, const uint16_t DataLength)
+static void crc_metricsEnd(const crc_variant_t Variant, const uint64_t Start)
 {
-    uint8_t crc8ICode = CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE;
-    uint32_t i;
-
+    crc_metrics_counter_t *counter;
+    uint64_t duration;
+    
     /*** Error Check ***/
-    if((Data == NULL) || (DataLength == 0))
-        return CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE;
-
-    /*** Calculate Full CRC-8/I-CODE ***/
-    for(i = 0; i < DataLength; i++)
-        crc8ICode = crc_crc8ICodeCalculatePartial(Data[i], crc8ICode);
-
-    return crc8ICode;
+    if((Start == 0) || (crc_metricsThread == NULL))
+        return;
+    
+    /*** Record Duration ***/
+    duration = crc_metricsTimestamp() - Start;
+    counter = &crc_metricsThread->counter[Variant];
+    crc_metricsAdd(&counter->sampledCycles, duration);
+    crc_metricsAdd(&counter->cycles[crc_metricsBucket(duration)], 1);
 }
 
 /****************************************************************************************************
- * FUNCT:   crc_crc8ICodeCalculatePartial
- * BRIEF:   Calculate Partial CRC-8/I-CODE
- * RETURN:  uint8_t: Current/Final CRC-8/I-CODE
- * ARG:     Data: Data To Add To CRC-8/I-CODE Calculation
- * ARG:     crc8ICode: Current CRC-8/I-CODE
- * NOTE:    Set CRC-8/I-CODE Value To CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE If First Data Byte
- *          (Data[0]); Returned CRC-8/I-CODE Value Should Be Used On Subsequent Data Bytes
- *          (Data[1] ... Data[n])
+ * FUNCT:   crc_metricsFold
+ * BRIEF:   Add Thread Counters To Metrics
+ * RETURN:  void: Returns Nothing
+ * ARG:     metrics: Metrics To Add To
+ * ARG:     counter: Thread Counters To Add
  ****************************************************************************************************/
-uint8_t crc_crc8ICodeCalculatePartial(const uint8_t Data, uint8_t crc8ICode)
+static void crc_metricsFold(crc_metrics_t * const metrics, crc_metrics_counter_t * const counter)
 {
-#if defined(CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD) && defined(CRC_CRC8_I_CODE_LOOP_METHOD)
-  #error CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD And CRC_CRC8_I_CODE_LOOP_METHOD Cannot Both Be Defined
-#elif defined(CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD) 
-    /*** Calculate Partial CRC-8/I-CODE ***/
-    crc8ICode ^= CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE;
-    crc8ICode = crc_crc8ICodeLookupTable[Data ^ crc8ICode];
-    return crc8ICode;
-#elif defined(CRC_CRC8_I_CODE_LOOP_METHOD)
-    uint8_t bit;
+    uint8_t b;
     
-    /*** Calculate Partial CRC-8/I-CODE ***/
-    crc8ICode ^= Data;
-    for(bit = 0; bit < 8; bit++)
+    /*** Add Totals And Histograms ***/
+    metrics->calls += CRC_ATOMIC_LOAD(&counter->calls, CRC_ATOMIC_RELAXED);
+    metrics->bytes += CRC_ATOMIC_LOAD(&counter->bytes, CRC_ATOMIC_RELAXED);
+    metrics->sampledCycles += CRC_ATOMIC_LOAD(&counter->sampledCycles, CRC_ATOMIC_RELAXED);
+    for(b = 0; b < CRC_METRICS_BUCKET_COUNT; b++)
     {
-        if((crc8ICode & 0x80) == 0x80)
-            crc8ICode = (uint8_t)((crc8ICode << 1) ^ CRC_CRC8_I_CODE_POLYNOMIAL);
-        else
-            crc8ICode <<= 1;
+        metrics->length[b] += CRC_ATOMIC_LOAD(&counter->length[b], CRC_ATOMIC_RELAXED);
+        metrics->cycles[b] += CRC_ATOMIC_LOAD(&counter->cycles[b], CRC_ATOMIC_RELAXED);
     }
-    
-    return crc8ICode;
-#endif
 }
-#endif
 
-#if defined(CRC_CRC8_ITU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ITU_LOOP_METHOD)
 /****************************************************************************************************
- * FUNCT:   crc_crc8ItuCalculate
- * BRIEF:   Calculate Full CRC-8/ITU
- * RETURN:  uint8_t: CRC-8/ITU
- * ARG:     Data: Data Buffer To Calculate CRC-8/ITU For
- * ARG:     DataLength: Length Of Data Buffer
+ * FUNCT:   crc_metricsKeyCreate
+ * BRIEF:   Create Thread Exit Key (Run Once)
+ * RETURN:  void: Returns Nothing
  ****************************************************************************************************/
-uint8_t crc_crc8ItuCalculate(const uint8_t * const Data, const uint16_t DataLength)
+static void crc_metricsKeyCreate(void)
 {
-    uint8_t crc8Itu = CRC_CRC8_ITU_INITIAL_CRC8_ITU;
-    uint32_t i;
-
-    /*** Error Check ***/
-    if((Data == NULL) || (DataLength == 0))
-        return CRC_CRC8_ITU_INITIAL_CRC8_ITU;
-
-    /*** Calculate Full CRC-8/ITU ***/
-    for(i = 0; i < (DataLength - 1); i++)
-        crc8Itu = crc_crc8ItuCalculatePartial(Data[i], crc8Itu, false);
-    crc8Itu = crc_crc8ItuCalculatePartial(Data[i], crc8Itu, true);
-
-    return crc8Itu;
+    (void)pthread_key_create(&crc_metricsKey, crc_metricsRetire);
 }
 
 /****************************************************************************************************
- * FUNCT:   crc_crc8ItuCalculatePartial
- * BRIEF:   Calculate Partial CRC-8/ITU
- * RETURN:  uint8_t: Current/Final CRC-8/ITU
- * ARG:     Data: Data To Add To CRC-8/ITU Calculation
- * ARG:     crc8Itu: Current CRC-8/ITU
- * ARG:     Final: Final Data
- * NOTE:    Set CRC-8/ITU Value To CRC_CRC8_ITU_INITIAL_CRC8_ITU If First Data Byte (Data[0]);
- *          Returned CRC-8/ITU Value Should Be Used On Subsequent Data Bytes (Data[1] ... Data[n])
+ * FUNCT:   crc_metricsRetire
+ * BRIEF:   Fold Exiting Thread's Counters Into Retired Totals (Thread Exit Destructor)
+ * RETURN:  void: Returns Nothing
+ * ARG:     thread: Exiting Thread's Counters (crc_metrics_thread_t)
  ****************************************************************************************************/
-uint8_t crc_crc8ItuCalculatePartial(const uint8_t Data, uint8_t crc8Itu, const bool Final)
+static void crc_metricsRetire(void *thread)
 {
-#if defined(CRC_CRC8_ITU_LOOKUP_TABLE_METHOD) && defined(CRC_CRC8_ITU_LOOP_METHOD)
-  #error CRC_CRC8_ITU_LOOKUP_TABLE_METHOD And CRC_CRC8_ITU_LOOP_METHOD Cannot Both Be Defined
-#elif defined(CRC_CRC8_ITU_LOOKUP_TABLE_METHOD) 
-    /*** Calculate Partial CRC-8/ITU ***/
-    crc8Itu = crc_crc8ItuLookupTable[Data ^ crc8Itu];
-    
-    /*** XOR Output (CRC-8/ITU) On Final Data ***/
-    if(Final)
-        crc8Itu = crc8Itu ^ CRC_CRC8_ITU_XOR_OUT;
+    crc_metrics_thread_t *retiring = thread;
+    uint8_t v;
     
-    return crc8Itu;
-#elif defined(CRC_CRC8_ITU_LOOP_METHOD)
-    uint8_t bit;
+    /*** Fold Counters And Unregister ***/
+    (void)pthread_mutex_lock(&crc_metricsMutex);
+    for(v = 0; v < CRC_VARIANT_COUNT; v++)
+        crc_metricsFold(&crc_metricsRetired[v], &retiring->counter[v]);
+    if(retiring->previous != NULL)
+        retiring->previous->next = retiring->next;
+    else
+        crc_metricsThreadList = retiring->next;
+    if(retiring->next != NULL)
+        retiring->next->previous = retiring->previous;
+    (void)pthread_mutex_unlock(&crc_metricsMutex);
     
-    /*** Calculate Partial CRC-8/ITU ***/
-    crc8Itu ^= Data;
-    for(bit = 0; bit < 8; bit++)
-    {
-        if((crc8Itu & 0x80) == 0x80)
-            crc8Itu = (uint8_t)((crc8Itu << 1) ^ CRC_CRC8_ITU_POLYNOMIAL);
-        else
-            crc8Itu <<= 1;
-    }
+    crc_metricsThread = NULL;
+    free(retiring);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_metricsTimestamp
+ * BRIEF:   Read Timestamp
+ * RETURN:  uint64_t: Timestamp Counter (Monotonic Nanoseconds Where Unavailable)
+ ****************************************************************************************************/
+static uint64_t crc_metricsTimestamp(void)
+{
+#ifdef CRC_METRICS_TSC
+    return (uint64_t)__rdtsc();
+#else
+    struct timespec now;
     
-    /*** XOR Output (CRC-8/ITU) On Final Data ***/
-    if(Final)
-        crc8Itu = crc8Itu ^ CRC_CRC8_ITU_XOR_OUT;
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
     
-    return crc8Itu;
+    return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
 #endif
 }
 #endif
 
-#if defined(CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_MAXIM_LOOP_METHOD)
+#ifdef CRC_JIT
 /****************************************************************************************************
- * FUNCT:   crc_crc8MaximCalculate
- * BRIEF:   Calculate Full CRC-8/MAXIM
- * RETURN:  uint8_t: CRC-8/MAXIM
- * ARG:     Data: Data Buffer To Calculate CRC-8/MAXIM For
- * ARG:     DataLength: Length Of Data Buffer
+ * FUNCT:   crc_jitBuild
+ * BRIEF:   Build Slice-By-8 Tables For Model
+ * RETURN:  void: Returns Nothing
+ * ARG:     entry: Entry To Build (Kernel Left NULL)
+ * ARG:     Model: CRC Model
+ * NOTE:    table[k][x] Is The Register After Byte x Then k Zero Bytes, Starting From Zero, So An
+ *          8-Byte Block Is The XOR Of One Lookup Per Byte
  ****************************************************************************************************/
-uint8_t crc_crc8MaximCalculate(const uint8_t * const Data, const uint16_t DataLength)
+static void crc_jitBuild(crc_jit_entry_t * const entry, const crc_model_t * const Model)
 {
-    uint8_t crc8Maxim = CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM;
-    uint32_t i;
-
-    /*** Error Check ***/
-    if((Data == NULL) || (DataLength == 0))
-        return CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM;
-
-    /*** Calculate CRC-8/MAXIM ***/
-    for(i = 0; i < (DataLength - 1); i++)
-        crc8Maxim = crc_crc8MaximCalculatePartial(Data[i], crc8Maxim, false);
-    crc8Maxim = crc_crc8MaximCalculatePartial(Data[i], crc8Maxim, true);
-
-    return crc8Maxim;
+    const uint16_t Mask = (uint16_t)(0xFFFF >> (16 - Model->width));
+    uint16_t reg, x;
+    uint8_t k;
+    
+    /*** Set Up ***/
+    entry->width = Model->width;
+    entry->polynomial = Model->polynomial & Mask;
+    entry->reflectIn = Model->reflectIn;
+    entry->kernel = NULL;
+    
+    /*** Single Byte Table ***/
+    crc_modelTable(entry->table[0], entry->width, entry->polynomial, entry->reflectIn);
+    
+    /*** Tables For Byte Followed By Zero Bytes ***/
+    for(k = 1; k < CRC_JIT_SLICE_COUNT; k++)
+    {
+        for(x = 0; x < 256; x++)
+        {
+            reg = entry->table[k - 1][x];
+            if(entry->reflectIn)
+                entry->table[k][x] = (uint16_t)((reg >> 8) ^ entry->table[0][reg & 0xFF]);
+            else
+                entry->table[k][x] = (uint16_t)(((reg << 8) & Mask) ^ entry->table[0][reg >> (entry->width - 8)]);
+        }
+    }
 }
 
+#ifdef CRC_JIT_NATIVE
 /****************************************************************************************************
- * FUNCT:   crc_crc8MaximCalculatePartial
- * BRIEF:   Calculate Partial CRC-8/MAXIM
- * RETURN:  uint8_t: Current/Final CRC-8/MAXIM
- * ARG:     Data: Data To Add To CRC-8/MAXIM Calculation
- * ARG:     crc8Maxim: Current CRC-8/MAXIM
- * ARG:     Final: Final Data (Unused If CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD)
- * NOTE:    Set CRC-8/MAXIM Value To CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM If First Data Byte (Data[0]);
- *          Returned CRC-8/MAXIM Value Should Be Used On Subsequent Data Bytes (Data[1] ... Data[n])
+ * FUNCT:   crc_jitEmit
+ * BRIEF:   Emit x86-64 Block Kernel For Entry
+ * RETURN:  crc_jit_kernel_t: Kernel (NULL If Executable Memory Not Available)
+ * ARG:     Entry: Entry With Built Tables
+ * NOTE:    Kernel Is uint32_t (uint32_t reg, const uint8_t *data, size_t blockCount) (System V). The
+ *          Table Address Is An Immediate, Table Offsets Are Displacements And The Byte Swap Of A
+ *          Non-Reflected 16-Bit Register Is Only Emitted When Needed. The Buffer Is Mapped Writable,
+ *          Then Switched To Executable, So It Is Never Both (W^X).
  ****************************************************************************************************/
-uint8_t crc_crc8MaximCalculatePartial(const uint8_t Data, uint8_t crc8Maxim, const bool Final)
+static crc_jit_kernel_t crc_jitEmit(const crc_jit_entry_t * const Entry)
 {
-#if defined(CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD) && defined(CRC_CRC8_MAXIM_LOOP_METHOD)
-  #error CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD And CRC_CRC8_MAXIM_LOOP_METHOD Cannot Both Be Defined
-#elif defined(CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD) 
-    /*** Calculate Partial CRC-8/MAXIM ***/
-    (void)Final; // Silence Compiler Warning
-    crc8Maxim = crc_crc8MaximLookupTable[Data ^ crc8Maxim];
-    return crc8Maxim;
-#elif defined(CRC_CRC8_MAXIM_LOOP_METHOD)
-    uint8_t bit, data;
+    static const uint8_t Prologue[] =
+    {
+        0x89, 0xF8,       // mov eax, edi
+        0x48, 0x85, 0xD2, // test rdx, rdx
+        0x0F, 0x84        // jz epilogue (rel32 Follows)
+    };
+    static const uint8_t Swap[] =
+    {
+        0x66, 0xC1, 0xC0, 0x08 // rol ax, 8
+    };
+    static const uint8_t Combine[] =
+    {
+        0x0F, 0xB7, 0xC0, // movzx eax, ax
+        0x48, 0x33, 0x06  // xor rax, [rsi]
+    };
+    static const uint8_t FirstLookup[] =
+    {
+        0x0F, 0xB6, 0xC8,            // movzx ecx, al
+        0x45, 0x0F, 0xB7, 0x94, 0x49 // movzx r10d, word [r9 + rcx * 2 + disp32] (disp32 Follows)
+    };
+    static const uint8_t NextLookup[] =
+    {
+        0x48, 0xC1, 0xE8, 0x08,      // shr rax, 8
+        0x0F, 0xB6, 0xC8,            // movzx ecx, al
+        0x45, 0x0F, 0xB7, 0x84, 0x49 // movzx r8d, word [r9 + rcx * 2 + disp32] (disp32 Follows)
+    };
+    static const uint8_t Accumulate[] =
+    {
+        0x45, 0x31, 0xC2 // xor r10d, r8d
+    };
+    static const uint8_t Advance[] =
+    {
+        0x44, 0x89, 0xD0,       // mov eax, r10d
+        0x48, 0x83, 0xC6, 0x08, // add rsi, 8
+        0x48, 0xFF, 0xCA,       // dec rdx
+        0x0F, 0x85              // jnz loop (rel32 Follows)
+    };
+    crc_jit_kernel_t kernel;
+    size_t length = 0, loop, skip;
+    uint8_t *code;
+    uint8_t j;
     
-    /*** Reflect Input (Data) ***/
-    data = crc_reflectU8(Data);
+    /*** Map Writable Buffer ***/
+    code = mmap(NULL, CRC_JIT_CODE_LENGTH, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(code == MAP_FAILED)
+        return NULL;
     
-    /*** Calculate Partial CRC-8/MAXIM ***/
-    crc8Maxim ^= data;
-    for(bit = 0; bit < 8; bit++)
+    /*** Prologue (r9 = Table) ***/
+    memcpy(&code[length], Prologue, sizeof(Prologue));
+    length += sizeof(Prologue);
+    skip = length;
+    length = crc_jitPut(code, length, 0, 4);
+    code[length++] = 0x49; // movabs r9, imm64
+    code[length++] = 0xB9;
+    length = crc_jitPut(code, length, (uint64_t)(uintptr_t)Entry->table, 8);
+    
+    /*** Loop: XOR Register Into Block, Then Byte j Looks Up table[7 - j] ***/
+    loop = length;
+    if(!Entry->reflectIn && (Entry->width == 16))
     {
-        if((crc8Maxim & 0x80) == 0x80)
-            crc8Maxim = (uint8_t)((crc8Maxim << 1) ^ CRC_CRC8_MAXIM_POLYNOMIAL);
-        else
-            crc8Maxim <<= 1;
+        memcpy(&code[length], Swap, sizeof(Swap));
+        length += sizeof(Swap);
     }
+    memcpy(&code[length], Combine, sizeof(Combine));
+    length += sizeof(Combine);
+    memcpy(&code[length], FirstLookup, sizeof(FirstLookup));
+    length += sizeof(FirstLookup);
+    length = crc_jitPut(code, length, (CRC_JIT_SLICE_COUNT - 1) * sizeof(Entry->table[0]), 4);
+    for(j = 1; j < CRC_JIT_SLICE_COUNT; j++)
+    {
+        memcpy(&code[length], NextLookup, sizeof(NextLookup));
+        length += sizeof(NextLookup);
+        length = crc_jitPut(code, length, (uint64_t)(CRC_JIT_SLICE_COUNT - 1 - j) * sizeof(Entry->table[0]), 4);
+        memcpy(&code[length], Accumulate, sizeof(Accumulate));
+        length += sizeof(Accumulate);
+    }
+    memcpy(&code[length], Advance, sizeof(Advance));
+    length += sizeof(Advance);
+    length = crc_jitPut(code, length, (uint64_t)(loop - (length + 4)) & 0xFFFFFFFF, 4);
     
-    /*** Reflect Output (CRC-8/MAXIM) On Final Data ***/
-    if(Final)
-        crc8Maxim = crc_reflectU8(crc8Maxim);
+    /*** Epilogue ***/
+    (void)crc_jitPut(code, skip, length - (skip + 4), 4);
+    code[length++] = 0xC3; // ret
     
-    return crc8Maxim;
-#endif
+    /*** Switch Buffer To Executable ***/
+    if(mprotect(code, CRC_JIT_CODE_LENGTH, PROT_READ | PROT_EXEC) != 0)
+    {
+        (void)munmap(code, CRC_JIT_CODE_LENGTH);
+        return NULL;
+    }
+    kernel = (crc_jit_kernel_t)(uintptr_t)code;
+    
+    return kernel;
 }
 #endif
 
-#if defined(CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ROHC_LOOP_METHOD)
 /****************************************************************************************************
- * FUNCT:   crc_crc8RohcCalculate
- * BRIEF:   Calculate Full CRC-8/ROHC
- * RETURN:  uint8_t: CRC-8/ROHC
- * ARG:     Data: Data Buffer To Calculate CRC-8/ROHC For
- * ARG:     DataLength: Length Of Data Buffer
+ * FUNCT:   crc_jitFind
+ * BRIEF:   Find Cached Entry For Model, Building It If Not Cached
+ * RETURN:  const crc_jit_entry_t *: Entry (NULL If Cache Full)
+ * ARG:     Model: CRC Model
+ * NOTE:    Entries Are Only Appended And Published With A Release Store, So Lookups Take No Lock
  ****************************************************************************************************/
-uint8_t crc_crc8RohcCalculate(const uint8_t * const Data, const uint16_t DataLength)
+static const crc_jit_entry_t *crc_jitFind(const crc_model_t * const Model)
 {
-    uint8_t crc8Rohc = CRC_CRC8_ROHC_INITIAL_CRC8_ROHC;
-    uint32_t i;
-
-    /*** Error Check ***/
-    if((Data == NULL) || (DataLength == 0))
-        return CRC_CRC8_ROHC_INITIAL_CRC8_ROHC;
-
-    /*** Calculate CRC-8/ROHC ***/
-    for(i = 0; i < (DataLength - 1); i++)
-        crc8Rohc = crc_crc8RohcCalculatePartial(Data[i], crc8Rohc, false);
-    crc8Rohc = crc_crc8RohcCalculatePartial(Data[i], crc8Rohc, true);
-
-    return crc8Rohc;
+    crc_jit_entry_t *entry = NULL;
+    uint8_t count, e;
+    
+    /*** Search Published Entries ***/
+    count = CRC_ATOMIC_LOAD(&crc_jitCacheCount, CRC_ATOMIC_ACQUIRE);
+    for(e = 0; e < count; e++)
+    {
+        if(crc_jitMatch(&crc_jitCache[e], Model))
+            return &crc_jitCache[e];
+    }
+    
+    /*** Search Again Under Lock (Another Thread May Have Built It), Then Build ***/
+    (void)pthread_mutex_lock(&crc_jitMutex);
+    count = CRC_ATOMIC_LOAD(&crc_jitCacheCount, CRC_ATOMIC_RELAXED);
+    for(e = 0; (e < count) && (entry == NULL); e++)
+    {
+        if(crc_jitMatch(&crc_jitCache[e], Model))
+            entry = &crc_jitCache[e];
+    }
+    if((entry == NULL) && (count < CRC_JIT_CACHE_COUNT))
+    {
+        entry = &crc_jitCache[count];
+        crc_jitBuild(entry, Model);
+#ifdef CRC_JIT_NATIVE
+        entry->kernel = crc_jitEmit(entry);
+#endif
+        CRC_ATOMIC_STORE(&crc_jitCacheCount, (uint8_t)(count + 1), CRC_ATOMIC_RELEASE);
+    }
+    (void)pthread_mutex_unlock(&crc_jitMutex);
+    
+    return entry;
 }
 
 /****************************************************************************************************
- * FUNCT:   crc_crc8RohcCalculatePartial
- * BRIEF:   Calculate Partial CRC-8/ROHC
- * RETURN:  uint8_t: Current/Final CRC-8/ROHC
- * ARG:     Data: Data To Add To CRC-8/ROHC Calculation
- * ARG:     crc8Rohc: Current CRC-8/ROHC
- * ARG:     Final: Final Data (Unused If CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD)
- * NOTE:    Set CRC-8/ROHC Value To CRC_CRC8_ROHC_INITIAL_CRC8_ROHC If First Data Byte (Data[0]);
- *          Returned CRC-8/ROHC Value Should Be Used On Subsequent Data Bytes (Data[1] ... Data[n])
+ * FUNCT:   crc_jitInterpret
+ * BRIEF:   Run 8-Byte Blocks Through Register Using Entry's Tables
+ * RETURN:  uint16_t: Register
+ * ARG:     Entry: Entry With Built Tables
+ * ARG:     reg: Register (Input Orientation)
+ * ARG:     data: Blocks
+ * ARG:     blockCount: Number Of 8-Byte Blocks
+ * NOTE:    Computes Exactly What The Emitted Kernel Computes
  ****************************************************************************************************/
-uint8_t crc_crc8RohcCalculatePartial(const uint8_t Data, uint8_t crc8Rohc, const bool Final)
+static uint16_t crc_jitInterpret(const crc_jit_entry_t * const Entry, uint16_t reg, const uint8_t *data, size_t blockCount)
 {
-#if defined(CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD) && defined(CRC_CRC8_ROHC_LOOP_METHOD)
-  #error CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD And CRC_CRC8_ROHC_LOOP_METHOD Cannot Both Be Defined
-#elif defined(CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD) 
-    /*** Calculate Partial CRC-8/ROHC ***/
-    (void)Final; // Silence Compiler Warning
-    crc8Rohc ^= CRC_CRC8_ROHC_INITIAL_CRC8_ROHC;
-    crc8Rohc = crc_crc8RohcLookupTable[Data ^ crc8Rohc];
-    return crc8Rohc;
-#elif defined(CRC_CRC8_ROHC_LOOP_METHOD)
-    uint8_t bit, data;
+    uint8_t block[CRC_JIT_SLICE_COUNT];
+    uint8_t j;
     
-    /*** Reflect Input (Data) ***/
-    data = crc_reflectU8(Data);
-    
-    /*** Calculate Partial CRC-8/ROHC ***/
-    crc8Rohc ^= data;
-    for(bit = 0; bit < 8; bit++)
+    /*** Run Blocks ***/
+    for(; blockCount > 0; blockCount--)
     {
-        if((crc8Rohc & 0x80) == 0x80)
-            crc8Rohc = (uint8_t)((crc8Rohc << 1) ^ CRC_CRC8_ROHC_POLYNOMIAL);
+        for(j = 0; j < CRC_JIT_SLICE_COUNT; j++)
+            block[j] = data[j];
+        if(!Entry->reflectIn && (Entry->width == 16))
+        {
+            block[0] ^= (uint8_t)(reg >> 8);
+            block[1] ^= (uint8_t)reg;
+        }
         else
-            crc8Rohc <<= 1;
+        {
+            block[0] ^= (uint8_t)reg;
+            block[1] ^= (uint8_t)(reg >> 8);
+        }
+        reg = 0;
+        for(j = 0; j < CRC_JIT_SLICE_COUNT; j++)
+            reg ^= Entry->table[CRC_JIT_SLICE_COUNT - 1 - j][block[j]];
+        data += CRC_JIT_SLICE_COUNT;
     }
     
-    /*** Reflect Output (CRC-8/ROHC) On Final Data ***/
-    if(Final)
-        crc8Rohc = crc_reflectU8(crc8Rohc);
-    
-    return crc8Rohc;
-#endif
+    return reg;
 }
-#endif
 
-#if defined(CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_WCDMA_LOOP_METHOD)
 /****************************************************************************************************
- * FUNCT:   crc_crc8WcdmaCalculate
- * BRIEF:   Calculate Full CRC-8/WCDMA
- * RETURN:  uint8_t: CRC-8/WCDMA
- * ARG:     Data: Data Buffer To Calculate CRC-8/WCDMA For
- * ARG:     DataLength: Length Of Data Buffer
+ * FUNCT:   crc_jitMatch
+ * BRIEF:   Check Whether Entry Was Built For Model
+ * RETURN:  bool: True If Width, Polynomial And Reflect In Match
+ * ARG:     Entry: Entry
+ * ARG:     Model: CRC Model
  ****************************************************************************************************/
-uint8_t crc_crc8WcdmaCalculate(const uint8_t * const Data, const uint16_t DataLength)
+static bool crc_jitMatch(const crc_jit_entry_t * const Entry, const crc_model_t * const Model)
 {
-    uint8_t crc8Wcdma = CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA;
-    uint32_t i;
-
-    /*** Error Check ***/
-    if((Data == NULL) || (DataLength == 0))
-        return CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA;
-
-    /*** Calculate CRC-8/WCDMA ***/
-    for(i = 0; i < (DataLength - 1); i++)
-        crc8Wcdma = crc_crc8WcdmaCalculatePartial(Data[i], crc8Wcdma, false);
-    crc8Wcdma = crc_crc8WcdmaCalculatePartial(Data[i], crc8Wcdma, true);
-
-    return crc8Wcdma;
+    const uint16_t Mask = (uint16_t)(0xFFFF >> (16 - Model->width));
+    
+    return (Entry->width == Model->width) && (Entry->polynomial == (Model->polynomial & Mask)) && (Entry->reflectIn == Model->reflectIn);
 }
 
+#ifdef CRC_JIT_NATIVE
 /****************************************************************************************************
- * FUNCT:   crc_crc8WcdmaCalculatePartial
- * BRIEF:   Calculate Partial CRC-8/WCDMA
- * RETURN:  uint8_t: Current/Final CRC-8/WCDMA
- * ARG:     Data: Data To Add To CRC-8/WCDMA Calculation
- * ARG:     crc8Wcdma: Current CRC-8/WCDMA
- * ARG:     Final: Final Data (Unused If CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD)
- * NOTE:    Set CRC-8/WCDMA Value To CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA If First Data Byte (Data[0]);
- *          Returned CRC-8/WCDMA Value Should Be Used On Subsequent Data Bytes (Data[1] ... Data[n])
+ * FUNCT:   crc_jitPut
+ * BRIEF:   Write Little-Endian Value Into Code Buffer
+ * RETURN:  size_t: Code Length After Value
+ * ARG:     code: Code Buffer
+ * ARG:     length: Position To Write At
+ * ARG:     Value: Value
+ * ARG:     ByteCount: Number Of Bytes Written
  ****************************************************************************************************/
-uint8_t crc_crc8WcdmaCalculatePartial(const uint8_t Data, uint8_t crc8Wcdma, const bool Final)
+static size_t crc_jitPut(uint8_t * const code, size_t length, const uint64_t Value, const uint8_t ByteCount)
 {
-#if defined(CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD) && defined(CRC_CRC8_WCDMA_LOOP_METHOD)
-  #error CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD And CRC_CRC8_WCDMA_LOOP_METHOD Cannot Both Be Defined
-#elif defined(CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD) 
-    /*** Calculate Partial CRC-8/WCDMA ***/
-    (void)Final; // Silence Compiler Warning
-    crc8Wcdma = crc_crc8WcdmaLookupTable[Data ^ crc8Wcdma];
-    return crc8Wcdma;
-#elif defined(CRC_CRC8_WCDMA_LOOP_METHOD)
-    uint8_t bit, data;
+    uint8_t i;
     
-    /*** Reflect Input (Data) ***/
-    data = crc_reflectU8(Data);
+    /*** Write Value ***/
+    for(i = 0; i < ByteCount; i++)
+        code[length++] = (uint8_t)(Value >> (8 * i));
     
-    /*** Calculate Partial CRC-8/WCDMA ***/
-    crc8Wcdma ^= data;
-    for(bit = 0; bit < 8; bit++)
+    return length;
+}
+#endif
+
+/****************************************************************************************************
+ * FUNCT:   crc_jitRun
+ * BRIEF:   Run Data Through Register
+ * RETURN:  uint16_t: Register
+ * ARG:     Entry: Entry With Built Tables
+ * ARG:     reg: Register (Input Orientation)
+ * ARG:     Data: Data Buffer
+ * ARG:     DataLength: Length Of Data Buffer
+ * NOTE:    Whole 8-Byte Blocks Go Through The Kernel (Or Interpreter), Remaining Bytes Use table[0]
+ ****************************************************************************************************/
+static uint16_t crc_jitRun(const crc_jit_entry_t * const Entry, uint16_t reg, const uint8_t * const Data, const uint16_t DataLength)
+{
+    const uint16_t BlockCount = DataLength / CRC_JIT_SLICE_COUNT;
+    const uint16_t BlockLength = (uint16_t)(BlockCount * CRC_JIT_SLICE_COUNT);
+    
+    /*** Run Blocks ***/
+    if(BlockCount != 0)
     {
-        if((crc8Wcdma & 0x80) == 0x80)
-            crc8Wcdma = (uint8_t)((crc8Wcdma << 1) ^ CRC_CRC8_WCDMA_POLYNOMIAL);
+        if(Entry->kernel != NULL)
+            reg = (uint16_t)Entry->kernel(reg, Data, BlockCount);
         else
-            crc8Wcdma <<= 1;
+            reg = crc_jitInterpret(Entry, reg, Data, BlockCount);
     }
     
-    /*** Reflect Output (CRC-8/WCDMA) On Final Data ***/
-    if(Final)
-        crc8Wcdma = crc_reflectU8(crc8Wcdma);
-    
-    return crc8Wcdma;
-#endif
+    /*** Run Remaining Bytes ***/
+    return crc_modelUpdate(Entry->table[0], Entry->width, Entry->reflectIn, reg, &Data[BlockLength], (uint16_t)(DataLength - BlockLength));
 }
 #endif
 
-#if defined(CRC_CRC16_ARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_ARC_LOOP_METHOD)
+#ifdef CRC_TABLE
 /****************************************************************************************************
- * FUNCT:   crc_crc16ArcCalculate
- * BRIEF:   Calculate Full CRC-16/ARC
- * RETURN:  uint16_t: CRC-16/ARC
- * ARG:     Data: Data Buffer To Calculate CRC-16/ARC For
- * ARG:     DataLength: Length Of Data Buffer
+ * FUNCT:   crc_tableBucketIndex
+ * BRIEF:   Hash Key To Bucket
+ * RETURN:  uint32_t: Bucket Index
+ * ARG:     Key: Key (See crc_tableKey)
  ****************************************************************************************************/
-uint16_t crc_crc16ArcCalculate(const uint8_t * const Data, const uint16_t DataLength)
+static uint32_t crc_tableBucketIndex(const uint32_t Key)
 {
-    uint16_t crc16Arc = CRC_CRC16_ARC_INITIAL_CRC16_ARC;
-    uint32_t i;
-
-    /*** Error Check ***/
-    if((Data == NULL) || (DataLength == 0))
-        return CRC_CRC16_ARC_INITIAL_CRC16_ARC;
-
-    /*** Calculate CRC-16/ARC ***/
-    for(i = 0; i < (DataLength - 1); i++)
-        crc16Arc = crc_crc16ArcCalculatePartial(Data[i], crc16Arc, false);
-    crc16Arc = crc_crc16ArcCalculatePartial(Data[i], crc16Arc, true);
-
-    return crc16Arc;
+    return ((uint32_t)((Key ^ (Key >> 16)) * 0x9E3779B1UL) >> 16) % CRC_TABLE_BUCKET_COUNT;
 }
 
 /****************************************************************************************************
- * FUNCT:   crc_crc16ArcCalculatePartial
- * BRIEF:   Calculate Partial CRC-16/ARC
- * RETURN:  uint16_t: Current/Final CRC-16/ARC
- * ARG:     Data: Data To Add To CRC-16/ARC Calculation
- * ARG:     crc16Arc: Current CRC-16/ARC
- * ARG:     Final: Final Data (Unused If CRC_CRC16_ARC_LOOKUP_TABLE_METHOD)
- * NOTE:    Set CRC-16/ARC Value To CRC_CRC16_ARC_INITIAL_CRC16_ARC If First Data Byte (Data[0]);
- *          Returned CRC-16/ARC Value Should Be Used On Subsequent Data Bytes (Data[1] ... Data[n])
+ * FUNCT:   crc_tableCompare
+ * BRIEF:   Compare Blob Records By Key (qsort)
+ * RETURN:  int: Negative, Zero Or Positive If a Sorts Before, With Or After b
+ * ARG:     a: Record
+ * ARG:     b: Record
  ****************************************************************************************************/
-uint16_t crc_crc16ArcCalculatePartial(const uint8_t Data, uint16_t crc16Arc, const bool Final)
+static int crc_tableCompare(const void *a, const void *b)
 {
-#if defined(CRC_CRC16_ARC_LOOKUP_TABLE_METHOD) && defined(CRC_CRC16_ARC_LOOP_METHOD)
-  #error CRC_CRC16_ARC_LOOKUP_TABLE_METHOD And CRC_CRC16_ARC_LOOP_METHOD Cannot Both Be Defined
-#elif defined(CRC_CRC16_ARC_LOOKUP_TABLE_METHOD) 
-    /*** Calculate Partial CRC-16/ARC ***/
-    (void)Final; // Silence Compiler Warning
-    crc16Arc = (uint16_t)((crc16Arc >> 8) ^ crc_crc16ArcLookupTable[(uint8_t)(Data ^ (crc16Arc & 0x00FF))]);
-    return crc16Arc;
-#elif defined(CRC_CRC16_ARC_LOOP_METHOD)
-    uint8_t bit, data;
+    const uint32_t KeyA = ((const crc_table_record_t *)a)->key;
+    const uint32_t KeyB = ((const crc_table_record_t *)b)->key;
     
-    /*** Reflect Input (Data) ***/
-    data = crc_reflectU8(Data);
+    return (KeyA > KeyB) - (KeyA < KeyB);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_tableEvict
+ * BRIEF:   Evict Least Recently Used Idle Tables Until Within Budget
+ * RETURN:  void: Returns Nothing
+ * NOTE:    Caller Holds crc_tableMutex
+ ****************************************************************************************************/
+static void crc_tableEvict(void)
+{
+    crc_table_t **link;
+    crc_table_t *table;
     
-    /*** Calculate Partial CRC-16/ARC ***/
-    crc16Arc ^= (data << 8);
-    for(bit = 0; bit < 8; bit++)
+    /*** Free Idle Tables From Least Recently Used ***/
+    while((crc_tableStatisticsTotal.residentBytes > crc_tableBudgetBytes) && (crc_tableIdleLast != NULL))
     {
-        if((crc16Arc & 0x8000) == 0x8000)
-            crc16Arc = (uint16_t)((crc16Arc << 1) ^ CRC_CRC16_ARC_POLYNOMIAL);
-        else
-            crc16Arc <<= 1;
+        table = crc_tableIdleLast;
+        crc_tableIdleRemove(table);
+        link = &crc_tableBucket[crc_tableBucketIndex(crc_tableKey(table->width, table->polynomial, table->reflectIn))];
+        while(*link != table)
+            link = &(*link)->bucketNext;
+        *link = table->bucketNext;
+        free(table);
+        crc_tableStatisticsTotal.residentBytes -= CRC_TABLE_LENGTH * sizeof(uint16_t);
+        crc_tableStatisticsTotal.tableCount--;
+        crc_tableStatisticsTotal.evictions++;
     }
-    
-    /*** Reflect Output (CRC-16/ARC) On Final Data ***/
-    if(Final)
-        crc16Arc = crc_reflectU16(crc16Arc);
-    
-    return crc16Arc;
-#endif
 }
-#endif
 
-#if defined(CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_CCITT_FALSE_LOOP_METHOD)
 /****************************************************************************************************
- * FUNCT:   crc_crc16CcittFalseCalculate
- * BRIEF:   Calculate Full CRC-16/CCITT-FALSE
- * RETURN:  uint16_t: CRC-16/CCITT-FALSE
- * ARG:     Data: Data Buffer To Calculate CRC-16/CCITT-FALSE For
- * ARG:     DataLength: Length Of Data Buffer
+ * FUNCT:   crc_tableIdleRemove
+ * BRIEF:   Remove Table From Idle List
+ * RETURN:  void: Returns Nothing
+ * ARG:     table: Idle Table
+ * NOTE:    Caller Holds crc_tableMutex
  ****************************************************************************************************/
-uint16_t crc_crc16CcittFalseCalculate(const uint8_t * const Data, const uint16_t DataLength)
+static void crc_tableIdleRemove(crc_table_t * const table)
 {
-    uint16_t crc16CcittFalse = CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE;
-    uint32_t i;
+    /*** Unlink ***/
+    if(table->idlePrevious != NULL)
+        table->idlePrevious->idleNext = table->idleNext;
+    else
+        crc_tableIdleFirst = table->idleNext;
+    if(table->idleNext != NULL)
+        table->idleNext->idlePrevious = table->idlePrevious;
+    else
+        crc_tableIdleLast = table->idlePrevious;
+    table->idlePrevious = NULL;
+    table->idleNext = NULL;
+}
 
-    /*** Error Check ***/
-    if((Data == NULL) || (DataLength == 0))
-        return CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE;
+/****************************************************************************************************
+ * FUNCT:   crc_tableKey
+ * BRIEF:   Get Key Of Parameter Set
+ * RETURN:  uint32_t: Key (Width, Reflect In, Polynomial Masked To Width)
+ * ARG:     Width: CRC Width (8 Or 16 Bits)
+ * ARG:     Polynomial: Polynomial (Normal Form)
+ * ARG:     ReflectIn: Reflect Input Bytes
+ ****************************************************************************************************/
+static uint32_t crc_tableKey(const uint8_t Width, const uint16_t Polynomial, const bool ReflectIn)
+{
+    return ((uint32_t)Width << 17) | ((uint32_t)ReflectIn << 16) | (Polynomial & (0xFFFFU >> (16 - Width)));
+}
+#endif
 
-    /*** Calculate Full CRC-16/CCITT-FALSE ***/
-    for(i = 0; i < DataLength; i++)
-        crc16CcittFalse = crc_crc16CcittFalseCalculatePartial(Data[i], crc16CcittFalse);
+#if defined(CRC_REGISTRY) && (defined(CRC_CRC8_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_LOOP_METHOD))
+/* CRC-8 */
+CRC_REGISTRY_INITIALIZE(Crc8, CRC_CRC8_INITIAL_CRC8)
+CRC_REGISTRY_UPDATE(Crc8, crc8, uint8_t)
+CRC_REGISTRY_FINALIZE(Crc8, crc8)
+CRC_REGISTRY_COMBINE(Crc8, crc8)
+#endif
 
-    return crc16CcittFalse;
-}
+#if defined(CRC_REGISTRY) && (defined(CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_CDMA2000_LOOP_METHOD))
+/* CRC-8/CDMA2000 */
+CRC_REGISTRY_INITIALIZE(Crc8Cdma2000, CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000)
+CRC_REGISTRY_UPDATE(Crc8Cdma2000, crc8Cdma2000, uint8_t)
+CRC_REGISTRY_FINALIZE(Crc8Cdma2000, crc8Cdma2000)
+CRC_REGISTRY_COMBINE(Crc8Cdma2000, crc8Cdma2000)
+#endif
+
+#if defined(CRC_REGISTRY) && (defined(CRC_CRC8_DARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DARC_LOOP_METHOD))
+/* CRC-8/DARC */
+CRC_REGISTRY_INITIALIZE(Crc8Darc, CRC_CRC8_DARC_INITIAL_CRC8_DARC)
+CRC_REGISTRY_UPDATE(Crc8Darc, crc8Darc, uint8_t)
+CRC_REGISTRY_FINALIZE(Crc8Darc, crc8Darc)
+CRC_REGISTRY_COMBINE(Crc8Darc, crc8Darc)
+#endif
+
+#if defined(CRC_REGISTRY) && (defined(CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DVB_S2_LOOP_METHOD))
+/* CRC-8/DVB-S2 */
+CRC_REGISTRY_INITIALIZE(Crc8DvbS2, CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2)
+CRC_REGISTRY_UPDATE(Crc8DvbS2, crc8DvbS2, uint8_t)
+CRC_REGISTRY_FINALIZE(Crc8DvbS2, crc8DvbS2)
+CRC_REGISTRY_COMBINE(Crc8DvbS2, crc8DvbS2)
+#endif
+
+#if defined(CRC_REGISTRY) && (defined(CRC_CRC8_EBU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_EBU_LOOP_METHOD))
+/* CRC-8/EBU */
+CRC_REGISTRY_INITIALIZE(Crc8Ebu, CRC_CRC8_EBU_INITIAL_CRC8_EBU)
+CRC_REGISTRY_UPDATE(Crc8Ebu, crc8Ebu, uint8_t)
+CRC_REGISTRY_FINALIZE(Crc8Ebu, crc8Ebu)
+CRC_REGISTRY_COMBINE(Crc8Ebu, crc8Ebu)
+#endif
+
+#if defined(CRC_REGISTRY) && (defined(CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_I_CODE_LOOP_METHOD))
+/* CRC-8/I-CODE */
+CRC_REGISTRY_INITIALIZE(Crc8ICode, CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE)
+CRC_REGISTRY_UPDATE(Crc8ICode, crc8ICode, uint8_t)
+CRC_REGISTRY_FINALIZE(Crc8ICode, crc8ICode)
+CRC_REGISTRY_COMBINE(Crc8ICode, crc8ICode)
+#endif
+
+#if defined(CRC_REGISTRY) && (defined(CRC_CRC8_ITU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ITU_LOOP_METHOD))
+/* CRC-8/ITU */
+CRC_REGISTRY_INITIALIZE(Crc8Itu, CRC_CRC8_ITU_INITIAL_CRC8_ITU)
+CRC_REGISTRY_UPDATE(Crc8Itu, crc8Itu, uint8_t)
+CRC_REGISTRY_FINALIZE(Crc8Itu, crc8Itu)
+CRC_REGISTRY_COMBINE(Crc8Itu, crc8Itu)
+#endif
+
+#if defined(CRC_REGISTRY) && (defined(CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_MAXIM_LOOP_METHOD))
+/* CRC-8/MAXIM */
+CRC_REGISTRY_INITIALIZE(Crc8Maxim, CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM)
+CRC_REGISTRY_UPDATE(Crc8Maxim, crc8Maxim, uint8_t)
+CRC_REGISTRY_FINALIZE(Crc8Maxim, crc8Maxim)
+CRC_REGISTRY_COMBINE(Crc8Maxim, crc8Maxim)
+#endif
+
+#if defined(CRC_REGISTRY) && (defined(CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ROHC_LOOP_METHOD))
+/* CRC-8/ROHC */
+CRC_REGISTRY_INITIALIZE(Crc8Rohc, CRC_CRC8_ROHC_INITIAL_CRC8_ROHC)
+CRC_REGISTRY_UPDATE(Crc8Rohc, crc8Rohc, uint8_t)
+CRC_REGISTRY_FINALIZE(Crc8Rohc, crc8Rohc)
+CRC_REGISTRY_COMBINE(Crc8Rohc, crc8Rohc)
+#endif
+
+#if defined(CRC_REGISTRY) && (defined(CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_WCDMA_LOOP_METHOD))
+/* CRC-8/WCDMA */
+CRC_REGISTRY_INITIALIZE(Crc8Wcdma, CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA)
+CRC_REGISTRY_UPDATE(Crc8Wcdma, crc8Wcdma, uint8_t)
+CRC_REGISTRY_FINALIZE(Crc8Wcdma, crc8Wcdma)
+CRC_REGISTRY_COMBINE(Crc8Wcdma, crc8Wcdma)
+#endif
+
+#if defined(CRC_REGISTRY) && (defined(CRC_CRC16_ARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_ARC_LOOP_METHOD))
+/* CRC-16/ARC */
+CRC_REGISTRY_INITIALIZE(Crc16Arc, CRC_CRC16_ARC_INITIAL_CRC16_ARC)
+CRC_REGISTRY_UPDATE(Crc16Arc, crc16Arc, uint16_t)
+CRC_REGISTRY_FINALIZE(Crc16Arc, crc16Arc)
+CRC_REGISTRY_COMBINE(Crc16Arc, crc16Arc)
+#endif
+
+#if defined(CRC_REGISTRY) && (defined(CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_CCITT_FALSE_LOOP_METHOD))
+/* CRC-16/CCITT-FALSE */
+CRC_REGISTRY_INITIALIZE(Crc16CcittFalse, CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE)
+CRC_REGISTRY_UPDATE(Crc16CcittFalse, crc16CcittFalse, uint16_t)
+CRC_REGISTRY_FINALIZE(Crc16CcittFalse, crc16CcittFalse)
+CRC_REGISTRY_COMBINE(Crc16CcittFalse, crc16CcittFalse)
+#endif
 
+#ifdef CRC_MODEL
 /****************************************************************************************************
- * FUNCT:   crc_crc16CcittFalseCalculatePartial
- * BRIEF:   Calculate Partial CRC-16/CCITT-FALSE
- * RETURN:  uint16_t: Current/Final CRC-16/CCITT-FALSE
- * ARG:     Data: Data To Add To CRC-16/CCITT-FALSE Calculation
- * ARG:     crc16CcittFalse: Current CRC-16/CCITT-FALSE
- * NOTE:    Set CRC-16/CCITT-FALSE Value To CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE If First
- *          Data Byte (Data[0]); Returned CRC-16/CCITT-FALSE Value Should Be Used On Subsequent Data
- *          Bytes (Data[1] ... Data[n])
+ * FUNCT:   crc_modelFinal
+ * BRIEF:   Convert Register To CRC Of Model
+ * RETURN:  uint16_t: CRC
+ * ARG:     Model: CRC Model
+ * ARG:     Register: Register (Input Orientation)
  ****************************************************************************************************/
-uint16_t crc_crc16CcittFalseCalculatePartial(const uint8_t Data, uint16_t crc16CcittFalse)
+static uint16_t crc_modelFinal(const crc_model_t * const Model, const uint16_t Register)
 {
-#if defined(CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD) && defined(CRC_CRC16_CCITT_FALSE_LOOP_METHOD)
-  #error CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD And CRC_CRC16_CCITT_FALSE_LOOP_METHOD Cannot Both Be Defined
-#elif defined(CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD) 
-    /*** Calculate Partial CRC-16/CCITT-FALSE ***/
-    crc16CcittFalse ^= CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE;
-    crc16CcittFalse = (uint16_t)((crc16CcittFalse << 8) ^ crc_crc16CcittFalseLookupTable[(uint8_t)(Data ^ (crc16CcittFalse >> 8))]);
-    return crc16CcittFalse;
-#elif defined(CRC_CRC16_CCITT_FALSE_LOOP_METHOD)
-    uint8_t bit;
+    uint16_t reg = Register;
     
-    /*** Calculate Partial CRC-16/CCITT-FALSE ***/
-    crc16CcittFalse ^= (Data << 8);
-    for(bit = 0; bit < 8; bit++)
-    {
-        if((crc16CcittFalse & 0x8000) == 0x8000)
-            crc16CcittFalse = (uint16_t)((crc16CcittFalse << 1) ^ CRC_CRC16_CCITT_FALSE_POLYNOMIAL);
-        else
-            crc16CcittFalse <<= 1;
-    }
+    /*** Reflect Output And XOR Output ***/
+    if(Model->reflectIn != Model->reflectOut)
+        reg = crc_modelReflect(reg, Model->width);
     
-    return crc16CcittFalse;
-#endif
+    return (reg ^ Model->xorOut) & (uint16_t)(0xFFFF >> (16 - Model->width));
 }
-#endif
 
 /****************************************************************************************************
- * Function Definitions (Private)
+ * FUNCT:   crc_modelInitial
+ * BRIEF:   Get Initial Register Of Model
+ * RETURN:  uint16_t: Register (Input Orientation: Reflected If Model Reflects Input)
+ * ARG:     Model: CRC Model
  ****************************************************************************************************/
+static uint16_t crc_modelInitial(const crc_model_t * const Model)
+{
+    const uint16_t Initial = Model->initial & (uint16_t)(0xFFFF >> (16 - Model->width));
+    
+    return Model->reflectIn ? crc_modelReflect(Initial, Model->width) : Initial;
+}
 
-#ifdef CRC_REFLECT_U8
 /****************************************************************************************************
- * FUNCT:   crc_reflectU8
- * BRIEF:   Reflect U8 (uint8_t)
- * RETURN:  uint8_t: Reflected U8 (uint8_t)
- * ARG:     Data: Data To Reflect
+ * FUNCT:   crc_modelReflect
+ * BRIEF:   Reflect Register Over CRC Width
+ * RETURN:  uint16_t: Reflected Register
+ * ARG:     Register: Register
+ * ARG:     Width: CRC Width (8 Or 16 Bits)
  ****************************************************************************************************/
-static uint8_t crc_reflectU8(const uint8_t Data)
+static uint16_t crc_modelReflect(const uint16_t Register, const uint8_t Width)
 {
-    uint8_t bit, reflectedData = 0x00;
-  
-    /*** Reflect U8 (uint8_t) ***/
-    for(bit = 0; bit < 8; bit++)
-        reflectedData |= ((Data & (1 << bit)) >> bit) << (7 - bit);
+    uint16_t reflected = 0;
+    uint8_t bit;
     
-    return reflectedData;
+    /*** Reflect Bits ***/
+    for(bit = 0; bit < Width; bit++)
+    {
+        if(Register & (1U << bit))
+            reflected |= (uint16_t)(1U << (Width - 1 - bit));
+    }
+    
+    return reflected;
 }
-#endif
 
-#ifdef CRC_REFLECT_U16
 /****************************************************************************************************
- * FUNCT:   crc_reflectU16
- * BRIEF:   Reflect U16 (uint16_t)
- * RETURN:  uint16_t: Reflected U16 (uint16_t)
- * ARG:     Data: Data To Reflect
+ * FUNCT:   crc_modelTable
+ * BRIEF:   Build Single Byte Table
+ * RETURN:  void: Returns Nothing
+ * ARG:     table: Table (256 Entries)
+ * ARG:     Width: CRC Width (8 Or 16 Bits)
+ * ARG:     Polynomial: Polynomial (Normal Form)
+ * ARG:     ReflectIn: Build For Reflected Register (Shifts Right)
+ * NOTE:    table[x] Is The Register After Byte x, Starting From Zero
  ****************************************************************************************************/
-static uint16_t crc_reflectU16(const uint16_t Data)
+static void crc_modelTable(uint16_t * const table, const uint8_t Width, const uint16_t Polynomial, const bool ReflectIn)
 {
+    const uint16_t Mask = (uint16_t)(0xFFFF >> (16 - Width));
+    const uint16_t Top = (uint16_t)(1U << (Width - 1));
+    const uint16_t ReflectedPolynomial = crc_modelReflect(Polynomial & Mask, Width);
+    uint16_t reg, x;
     uint8_t bit;
-    uint16_t reflectedData = 0x0000;
-  
-    /*** Reflect U16 (uint16_t) ***/
-    for(bit = 0; bit < 16; bit++)
-        reflectedData |= ((Data & (1 << bit)) >> bit) << (15 - bit);
     
-    return reflectedData;
+    /*** Run Each Byte Through Zero Register ***/
+    for(x = 0; x < 256; x++)
+    {
+        if(ReflectIn)
+        {
+            reg = x;
+            for(bit = 0; bit < 8; bit++)
+                reg = (reg & 0x0001) ? (uint16_t)((reg >> 1) ^ ReflectedPolynomial) : (uint16_t)(reg >> 1);
+        }
+        else
+        {
+            reg = (uint16_t)(x << (Width - 8));
+            for(bit = 0; bit < 8; bit++)
+                reg = (reg & Top) ? (uint16_t)(((reg << 1) ^ Polynomial) & Mask) : (uint16_t)((reg << 1) & Mask);
+        }
+        table[x] = reg;
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_modelUpdate
+ * BRIEF:   Run Data Through Register With Single Byte Table
+ * RETURN:  uint16_t: Register
+ * ARG:     Table: Table From crc_modelTable
+ * ARG:     Width: CRC Width (8 Or 16 Bits)
+ * ARG:     ReflectIn: Table Built For Reflected Register
+ * ARG:     reg: Register (Input Orientation)
+ * ARG:     Data: Data Buffer
+ * ARG:     DataLength: Length Of Data Buffer
+ ****************************************************************************************************/
+static uint16_t crc_modelUpdate(const uint16_t * const Table, const uint8_t Width, const bool ReflectIn, uint16_t reg, const uint8_t * const Data, const uint16_t DataLength)
+{
+    const uint16_t Mask = (uint16_t)(0xFFFF >> (16 - Width));
+    uint16_t i;
+    
+    /*** Run Bytes ***/
+    for(i = 0; i < DataLength; i++)
+    {
+        if(ReflectIn)
+            reg = (uint16_t)((reg >> 8) ^ Table[(reg ^ Data[i]) & 0xFF]);
+        else
+            reg = (uint16_t)(((reg << 8) & Mask) ^ Table[((reg >> (Width - 8)) ^ Data[i]) & 0xFF]);
+    }
+    
+    return reg;
 }
 #endif
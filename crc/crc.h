@@ -72,76 +72,363 @@
   #define CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE (0xFFFF)
 #endif
 
+/*** Variant ***/
+#define CRC_VARIANT_MASK(variant) (1U << (variant))
+
+/*** Metrics ***/
+#ifdef CRC_METRICS
+  #define CRC_METRICS_BUCKET_COUNT (32)
+#endif
+
 /****************************************************************************************************
  * Includes
  ****************************************************************************************************/
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+/*** Variant ***/
+typedef enum
+{
+    CRC_VARIANT_CRC8,
+    CRC_VARIANT_CRC8_CDMA2000,
+    CRC_VARIANT_CRC8_DARC,
+    CRC_VARIANT_CRC8_DVB_S2,
+    CRC_VARIANT_CRC8_EBU,
+    CRC_VARIANT_CRC8_I_CODE,
+    CRC_VARIANT_CRC8_ITU,
+    CRC_VARIANT_CRC8_MAXIM,
+    CRC_VARIANT_CRC8_ROHC,
+    CRC_VARIANT_CRC8_WCDMA,
+    CRC_VARIANT_CRC16_ARC,
+    CRC_VARIANT_CRC16_CCITT_FALSE,
+    CRC_VARIANT_COUNT
+} crc_variant_t;
+
+/*** Mask ***/
+typedef struct
+{
+    uint16_t offset; // Offset Of First Masked Byte
+    uint16_t length; // Number Of Masked Bytes
+} crc_mask_t;
+
+/*** Patch ***/
+typedef struct
+{
+    const uint8_t *delta; // XOR Of Original And Modified Bytes
+    uint32_t offset;      // Offset Of First Modified Byte
+    uint16_t length;      // Number Of Modified Bytes
+    uint16_t reserved;    // Explicit Padding
+} crc_patch_t;
+
+/*** Rolling ***/
+typedef struct
+{
+    uint16_t updateTable[256]; // Per-Byte Update Table (Native Register Form)
+    uint16_t removeTable[256]; // Outgoing Byte Remove Table For Window Length (Native Register Form)
+    uint16_t xorOut;           // Output XOR Value
+    uint8_t width;             // CRC Width (8 Or 16 Bits)
+    bool reflect;              // Register Is Reflected (Shifts Right)
+} crc_rolling_t;
+
+/*** Prefix ***/
+typedef struct
+{
+    uint16_t state; // Partial State After Prefix (Step Form)
+    uint16_t crc;   // Full CRC Of Prefix Alone
+} crc_prefix_t;
+
+/*** Syndrome ***/
+typedef enum
+{
+    CRC_CORRECTION_NONE,   // No Errors
+    CRC_CORRECTION_SINGLE, // Single Bit Error Corrected
+    CRC_CORRECTION_DOUBLE, // Double Bit Error Corrected
+    CRC_CORRECTION_FAILED  // Errors Not Correctable
+} crc_correction_t;
+
+/* Tables Are Keyed By Longest Data Length Built For And Serve Any Data Up To That Length; A Longer
+   Frame Rebuilds The Table. crc_syndrome8_t Is ~1 KiB; crc_syndrome16_t Is ~256 KiB (Keep It Static
+   Or On The Heap, Not On The Stack) And Takes O(Bits^2) To Build While Double Bit Errors Fit. */
+typedef struct
+{
+    uint16_t length;        // Longest Data Length Table Is Built For (0: Not Built)
+    uint16_t reserved;      // Explicit Padding
+    uint32_t position[256]; // Error Bit Distances Indexed By Syndrome
+} crc_syndrome8_t;
+
+typedef struct
+{
+    uint16_t length;          // Longest Data Length Table Is Built For (0: Not Built)
+    uint16_t reserved;        // Explicit Padding
+    uint32_t position[65536]; // Error Bit Distances Indexed By Syndrome
+} crc_syndrome16_t;
+
+/*** Reverse ***/
+typedef struct
+{
+    const uint8_t *data; // Message
+    uint16_t length;     // Message Length
+    uint16_t crc;        // CRC Of Message
+    uint32_t reserved;   // Explicit Padding
+} crc_sample_t;
+
+typedef struct
+{
+    crc_variant_t variant; // Matching Preset (CRC_VARIANT_COUNT If None)
+    uint16_t polynomial;   // Polynomial (Normal Form, Implicit x^width Term)
+    uint16_t initial;      // Initial Value
+    uint16_t xorOut;       // Output XOR Value
+    uint8_t width;         // CRC Width (8 Or 16 Bits)
+    bool reflectIn;        // Reflect Input Bytes
+    bool reflectOut;       // Reflect Output
+    uint8_t reserved[3];   // Explicit Padding
+} crc_model_t;
+
+/*** Metrics ***/
+#ifdef CRC_METRICS
+  typedef struct
+  {
+      uint64_t calls;                            // Whole-Buffer Calls (Calculate, PrefixCalculate, Masked, Bits, Verify, Correct, multiCalculate)
+      uint64_t bytes;                            // Bytes Passed To Whole-Buffer Calls
+      uint64_t sampledCycles;                    // Total Duration Of Timed Calls (Timestamp Counter Ticks)
+      uint64_t length[CRC_METRICS_BUCKET_COUNT]; // Calls By floor(log2(DataLength)) (Invalid Arguments Not Counted)
+      uint64_t cycles[CRC_METRICS_BUCKET_COUNT]; // Timed Calls By floor(log2(Duration)) (One Per CRC_METRICS_SAMPLE_PERIOD)
+  } crc_metrics_t;
+#endif
+
+/*** Table ***/
+#ifdef CRC_TABLE
+  typedef struct crc_table_s crc_table_t; // Cached Table Handle (Opaque)
+
+  typedef struct
+  {
+      uint64_t hits;        // Acquires Served By A Resident Table
+      uint64_t mapped;      // Acquires Served From The Mapped Blob
+      uint64_t builds;      // Acquires That Built A Table
+      uint64_t evictions;   // Idle Built Tables Freed To Stay Within Budget
+      size_t residentBytes; // Bytes Of Built Tables Currently Held (Counted Against Budget)
+      size_t tableCount;    // Resident Tables (Built And Mapped)
+  } crc_table_statistics_t;
+#endif
+
+/*** Registry ***/
+#ifdef CRC_REGISTRY
+  typedef struct
+  {
+      const char *name;                                                                         // Canonical Name
+      crc_variant_t variant;                                                                    // Variant
+      uint8_t width;                                                                            // CRC Width (8 Or 16 Bits)
+      uint8_t reserved[3];                                                                      // Explicit Padding
+      uint16_t (*initialize)(void);                                                             // Get Initial State
+      uint16_t (*update)(uint16_t state, const uint8_t * const Data, const uint16_t DataLength); // Run Data Through State
+      uint16_t (*finalize)(const uint16_t State);                                               // Get CRC Of State
+      uint16_t (*combine)(const uint16_t CrcA, const uint16_t CrcB, const uint32_t LengthB);    // Get CRC Of A Followed By B
+  } crc_registry_t;
+#endif
+
 /****************************************************************************************************
  * Function Prototypes
  ****************************************************************************************************/
 
+/* Forge: Pass The Current CRC Of Data, Including The Patch Bytes At Offset That Get Overwritten; The
+   Patch Is Solved In O(log DataLength) Without Reading Data, So That CRC Must Match Data Exactly. */
+
 /*** CRC-8 ***/
 /* CRC-8 */
 #if defined(CRC_CRC8_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_LOOP_METHOD)
   extern uint8_t crc_crc8Calculate(const uint8_t * const Data, const uint16_t DataLength);
   extern uint8_t crc_crc8CalculatePartial(const uint8_t Data, uint8_t crc8);
+  extern uint8_t crc_crc8Modify(uint8_t crc8, const uint8_t * const Delta, const uint16_t DeltaLength, const uint32_t Distance);
+  extern uint8_t crc_crc8ModifyBatch(uint8_t crc8, const crc_patch_t * const Patch, const uint16_t PatchCount, const uint32_t DataLength);
+  extern bool crc_crc8RollingInitialize(crc_rolling_t * const Rolling, const uint16_t WindowLength);
+  extern uint8_t crc_crc8RollingUpdate(const crc_rolling_t * const Rolling, const uint8_t Out, const uint8_t In, const uint8_t crc8);
+  extern uint8_t crc_crc8StripPrefix(uint8_t crc8, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength);
+  extern uint8_t crc_crc8Unwind(uint8_t crc8, const uint8_t * const Data, const uint16_t DataLength);
+  extern bool crc_crc8PrefixInitialize(crc_prefix_t * const prefix, const uint8_t * const Data, const uint16_t DataLength);
+  extern uint8_t crc_crc8PrefixCalculate(const crc_prefix_t * const Prefix, const uint8_t * const Data, const uint16_t DataLength);
+  extern uint8_t crc_crc8CalculateMasked(const uint8_t * const Data, const uint16_t DataLength, const crc_mask_t * const Mask, const uint16_t MaskCount);
+  extern uint8_t crc_crc8CalculateBits(const uint8_t * const Data, const uint32_t BitOffset, const uint32_t BitLength);
+  extern uint8_t crc_crc8CalculatePartialBits(const uint8_t Data, const uint8_t BitLength, uint8_t crc8);
+  extern bool crc_crc8Verify(const uint8_t * const Data, const uint16_t DataLength);
+  extern crc_correction_t crc_crc8Correct(crc_syndrome8_t * const syndrome, uint8_t * const data, const uint16_t DataLength);
+  extern bool crc_crc8Forge(uint8_t * const data, const uint16_t DataLength, const uint16_t Offset, const uint8_t crc8, const uint8_t Target);
 #endif
 
 /* CRC-8/CDMA2000 */
 #if defined(CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_CDMA2000_LOOP_METHOD)
   extern uint8_t crc_crc8Cdma2000Calculate(const uint8_t * const Data, const uint16_t DataLength);
   extern uint8_t crc_crc8Cdma2000CalculatePartial(const uint8_t Data, uint8_t crc8Cdma2000);
+  extern uint8_t crc_crc8Cdma2000Modify(uint8_t crc8Cdma2000, const uint8_t * const Delta, const uint16_t DeltaLength, const uint32_t Distance);
+  extern uint8_t crc_crc8Cdma2000ModifyBatch(uint8_t crc8Cdma2000, const crc_patch_t * const Patch, const uint16_t PatchCount, const uint32_t DataLength);
+  extern bool crc_crc8Cdma2000RollingInitialize(crc_rolling_t * const Rolling, const uint16_t WindowLength);
+  extern uint8_t crc_crc8Cdma2000RollingUpdate(const crc_rolling_t * const Rolling, const uint8_t Out, const uint8_t In, const uint8_t crc8Cdma2000);
+  extern uint8_t crc_crc8Cdma2000StripPrefix(uint8_t crc8Cdma2000, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength);
+  extern uint8_t crc_crc8Cdma2000Unwind(uint8_t crc8Cdma2000, const uint8_t * const Data, const uint16_t DataLength);
+  extern bool crc_crc8Cdma2000PrefixInitialize(crc_prefix_t * const prefix, const uint8_t * const Data, const uint16_t DataLength);
+  extern uint8_t crc_crc8Cdma2000PrefixCalculate(const crc_prefix_t * const Prefix, const uint8_t * const Data, const uint16_t DataLength);
+  extern uint8_t crc_crc8Cdma2000CalculateMasked(const uint8_t * const Data, const uint16_t DataLength, const crc_mask_t * const Mask, const uint16_t MaskCount);
+  extern uint8_t crc_crc8Cdma2000CalculateBits(const uint8_t * const Data, const uint32_t BitOffset, const uint32_t BitLength);
+  extern uint8_t crc_crc8Cdma2000CalculatePartialBits(const uint8_t Data, const uint8_t BitLength, uint8_t crc8Cdma2000);
+  extern bool crc_crc8Cdma2000Verify(const uint8_t * const Data, const uint16_t DataLength);
+  extern bool crc_crc8Cdma2000Forge(uint8_t * const data, const uint16_t DataLength, const uint16_t Offset, const uint8_t crc8Cdma2000, const uint8_t Target);
 #endif
 
 /* CRC-8/DARC */
 #if defined(CRC_CRC8_DARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DARC_LOOP_METHOD)
   extern uint8_t crc_crc8DarcCalculate(const uint8_t * const Data, const uint16_t DataLength);
   extern uint8_t crc_crc8DarcCalculatePartial(const uint8_t Data, uint8_t crc8Darc, const bool Final);
+  extern uint8_t crc_crc8DarcModify(uint8_t crc8Darc, const uint8_t * const Delta, const uint16_t DeltaLength, const uint32_t Distance);
+  extern uint8_t crc_crc8DarcModifyBatch(uint8_t crc8Darc, const crc_patch_t * const Patch, const uint16_t PatchCount, const uint32_t DataLength);
+  extern bool crc_crc8DarcRollingInitialize(crc_rolling_t * const Rolling, const uint16_t WindowLength);
+  extern uint8_t crc_crc8DarcRollingUpdate(const crc_rolling_t * const Rolling, const uint8_t Out, const uint8_t In, const uint8_t crc8Darc);
+  extern uint8_t crc_crc8DarcStripPrefix(uint8_t crc8Darc, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength);
+  extern uint8_t crc_crc8DarcUnwind(uint8_t crc8Darc, const uint8_t * const Data, const uint16_t DataLength);
+  extern bool crc_crc8DarcPrefixInitialize(crc_prefix_t * const prefix, const uint8_t * const Data, const uint16_t DataLength);
+  extern uint8_t crc_crc8DarcPrefixCalculate(const crc_prefix_t * const Prefix, const uint8_t * const Data, const uint16_t DataLength);
+  extern uint8_t crc_crc8DarcCalculateMasked(const uint8_t * const Data, const uint16_t DataLength, const crc_mask_t * const Mask, const uint16_t MaskCount);
+  extern uint8_t crc_crc8DarcCalculateBits(const uint8_t * const Data, const uint32_t BitOffset, const uint32_t BitLength);
+  extern uint8_t crc_crc8DarcCalculatePartialBits(const uint8_t Data, const uint8_t BitLength, uint8_t crc8Darc, const bool Final);
+  extern bool crc_crc8DarcVerify(const uint8_t * const Data, const uint16_t DataLength);
+  extern bool crc_crc8DarcForge(uint8_t * const data, const uint16_t DataLength, const uint16_t Offset, const uint8_t crc8Darc, const uint8_t Target);
 #endif
 
 /* CRC-8/DVB-S2 */
 #if defined(CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DVB_S2_LOOP_METHOD)
   extern uint8_t crc_crc8DvbS2Calculate(const uint8_t * const Data, const uint16_t DataLength);
   extern uint8_t crc_crc8DvbS2CalculatePartial(const uint8_t Data, uint8_t crc8DvbS2);
+  extern uint8_t crc_crc8DvbS2Modify(uint8_t crc8DvbS2, const uint8_t * const Delta, const uint16_t DeltaLength, const uint32_t Distance);
+  extern uint8_t crc_crc8DvbS2ModifyBatch(uint8_t crc8DvbS2, const crc_patch_t * const Patch, const uint16_t PatchCount, const uint32_t DataLength);
+  extern bool crc_crc8DvbS2RollingInitialize(crc_rolling_t * const Rolling, const uint16_t WindowLength);
+  extern uint8_t crc_crc8DvbS2RollingUpdate(const crc_rolling_t * const Rolling, const uint8_t Out, const uint8_t In, const uint8_t crc8DvbS2);
+  extern uint8_t crc_crc8DvbS2StripPrefix(uint8_t crc8DvbS2, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength);
+  extern uint8_t crc_crc8DvbS2Unwind(uint8_t crc8DvbS2, const uint8_t * const Data, const uint16_t DataLength);
+  extern bool crc_crc8DvbS2PrefixInitialize(crc_prefix_t * const prefix, const uint8_t * const Data, const uint16_t DataLength);
+  extern uint8_t crc_crc8DvbS2PrefixCalculate(const crc_prefix_t * const Prefix, const uint8_t * const Data, const uint16_t DataLength);
+  extern uint8_t crc_crc8DvbS2CalculateMasked(const uint8_t * const Data, const uint16_t DataLength, const crc_mask_t * const Mask, const uint16_t MaskCount);
+  extern uint8_t crc_crc8DvbS2CalculateBits(const uint8_t * const Data, const uint32_t BitOffset, const uint32_t BitLength);
+  extern uint8_t crc_crc8DvbS2CalculatePartialBits(const uint8_t Data, const uint8_t BitLength, uint8_t crc8DvbS2);
+  extern bool crc_crc8DvbS2Verify(const uint8_t * const Data, const uint16_t DataLength);
+  extern bool crc_crc8DvbS2Forge(uint8_t * const data, const uint16_t DataLength, const uint16_t Offset, const uint8_t crc8DvbS2, const uint8_t Target);
 #endif
 
 /* CRC-8/EBU */
 #if defined(CRC_CRC8_EBU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_EBU_LOOP_METHOD)
   extern uint8_t crc_crc8EbuCalculate(const uint8_t * const Data, const uint16_t DataLength);
   extern uint8_t crc_crc8EbuCalculatePartial(const uint8_t Data, uint8_t crc8Ebu, const bool Final);
+  extern uint8_t crc_crc8EbuModify(uint8_t crc8Ebu, const uint8_t * const Delta, const uint16_t DeltaLength, const uint32_t Distance);
+  extern uint8_t crc_crc8EbuModifyBatch(uint8_t crc8Ebu, const crc_patch_t * const Patch, const uint16_t PatchCount, const uint32_t DataLength);
+  extern bool crc_crc8EbuRollingInitialize(crc_rolling_t * const Rolling, const uint16_t WindowLength);
+  extern uint8_t crc_crc8EbuRollingUpdate(const crc_rolling_t * const Rolling, const uint8_t Out, const uint8_t In, const uint8_t crc8Ebu);
+  extern uint8_t crc_crc8EbuStripPrefix(uint8_t crc8Ebu, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength);
+  extern uint8_t crc_crc8EbuUnwind(uint8_t crc8Ebu, const uint8_t * const Data, const uint16_t DataLength);
+  extern bool crc_crc8EbuPrefixInitialize(crc_prefix_t * const prefix, const uint8_t * const Data, const uint16_t DataLength);
+  extern uint8_t crc_crc8EbuPrefixCalculate(const crc_prefix_t * const Prefix, const uint8_t * const Data, const uint16_t DataLength);
+  extern uint8_t crc_crc8EbuCalculateMasked(const uint8_t * const Data, const uint16_t DataLength, const crc_mask_t * const Mask, const uint16_t MaskCount);
+  extern uint8_t crc_crc8EbuCalculateBits(const uint8_t * const Data, const uint32_t BitOffset, const uint32_t BitLength);
+  extern uint8_t crc_crc8EbuCalculatePartialBits(const uint8_t Data, const uint8_t BitLength, uint8_t crc8Ebu, const bool Final);
+  extern bool crc_crc8EbuVerify(const uint8_t * const Data, const uint16_t DataLength);
+  extern bool crc_crc8EbuForge(uint8_t * const data, const uint16_t DataLength, const uint16_t Offset, const uint8_t crc8Ebu, const uint8_t Target);
 #endif
 
 /* CRC-8/I-CODE */
 #if defined(CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_I_CODE_LOOP_METHOD)
   extern uint8_t crc_crc8ICodeCalculate(const uint8_t * const Data, const uint16_t DataLength);
   extern uint8_t crc_crc8ICodeCalculatePartial(const uint8_t Data, uint8_t crc8ICode);
+  extern uint8_t crc_crc8ICodeModify(uint8_t crc8ICode, const uint8_t * const Delta, const uint16_t DeltaLength, const uint32_t Distance);
+  extern uint8_t crc_crc8ICodeModifyBatch(uint8_t crc8ICode, const crc_patch_t * const Patch, const uint16_t PatchCount, const uint32_t DataLength);
+  extern bool crc_crc8ICodeRollingInitialize(crc_rolling_t * const Rolling, const uint16_t WindowLength);
+  extern uint8_t crc_crc8ICodeRollingUpdate(const crc_rolling_t * const Rolling, const uint8_t Out, const uint8_t In, const uint8_t crc8ICode);
+  extern uint8_t crc_crc8ICodeStripPrefix(uint8_t crc8ICode, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength);
+  extern uint8_t crc_crc8ICodeUnwind(uint8_t crc8ICode, const uint8_t * const Data, const uint16_t DataLength);
+  extern bool crc_crc8ICodePrefixInitialize(crc_prefix_t * const prefix, const uint8_t * const Data, const uint16_t DataLength);
+  extern uint8_t crc_crc8ICodePrefixCalculate(const crc_prefix_t * const Prefix, const uint8_t * const Data, const uint16_t DataLength);
+  extern uint8_t crc_crc8ICodeCalculateMasked(const uint8_t * const Data, const uint16_t DataLength, const crc_mask_t * const Mask, const uint16_t MaskCount);
+  extern uint8_t crc_crc8ICodeCalculateBits(const uint8_t * const Data, const uint32_t BitOffset, const uint32_t BitLength);
+  extern uint8_t crc_crc8ICodeCalculatePartialBits(const uint8_t Data, const uint8_t BitLength, uint8_t crc8ICode);
+  extern bool crc_crc8ICodeVerify(const uint8_t * const Data, const uint16_t DataLength);
+  extern bool crc_crc8ICodeForge(uint8_t * const data, const uint16_t DataLength, const uint16_t Offset, const uint8_t crc8ICode, const uint8_t Target);
 #endif
 
 /* CRC-8/ITU */
 #if defined(CRC_CRC8_ITU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ITU_LOOP_METHOD)
   extern uint8_t crc_crc8ItuCalculate(const uint8_t * const Data, const uint16_t DataLength);
   extern uint8_t crc_crc8ItuCalculatePartial(const uint8_t Data, uint8_t crc8Itu, const bool Final);
+  extern uint8_t crc_crc8ItuModify(uint8_t crc8Itu, const uint8_t * const Delta, const uint16_t DeltaLength, const uint32_t Distance);
+  extern uint8_t crc_crc8ItuModifyBatch(uint8_t crc8Itu, const crc_patch_t * const Patch, const uint16_t PatchCount, const uint32_t DataLength);
+  extern bool crc_crc8ItuRollingInitialize(crc_rolling_t * const Rolling, const uint16_t WindowLength);
+  extern uint8_t crc_crc8ItuRollingUpdate(const crc_rolling_t * const Rolling, const uint8_t Out, const uint8_t In, const uint8_t crc8Itu);
+  extern uint8_t crc_crc8ItuStripPrefix(uint8_t crc8Itu, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength);
+  extern uint8_t crc_crc8ItuUnwind(uint8_t crc8Itu, const uint8_t * const Data, const uint16_t DataLength);
+  extern bool crc_crc8ItuPrefixInitialize(crc_prefix_t * const prefix, const uint8_t * const Data, const uint16_t DataLength);
+  extern uint8_t crc_crc8ItuPrefixCalculate(const crc_prefix_t * const Prefix, const uint8_t * const Data, const uint16_t DataLength);
+  extern uint8_t crc_crc8ItuCalculateMasked(const uint8_t * const Data, const uint16_t DataLength, const crc_mask_t * const Mask, const uint16_t MaskCount);
+  extern uint8_t crc_crc8ItuCalculateBits(const uint8_t * const Data, const uint32_t BitOffset, const uint32_t BitLength);
+  extern uint8_t crc_crc8ItuCalculatePartialBits(const uint8_t Data, const uint8_t BitLength, uint8_t crc8Itu, const bool Final);
+  extern bool crc_crc8ItuVerify(const uint8_t * const Data, const uint16_t DataLength);
+  extern bool crc_crc8ItuForge(uint8_t * const data, const uint16_t DataLength, const uint16_t Offset, const uint8_t crc8Itu, const uint8_t Target);
 #endif
 
 /* CRC-8/MAXIM */
 #if defined(CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_MAXIM_LOOP_METHOD)
   extern uint8_t crc_crc8MaximCalculate(const uint8_t * const Data, const uint16_t DataLength);
   extern uint8_t crc_crc8MaximCalculatePartial(const uint8_t Data, uint8_t crc8Maxim, const bool Final);
+  extern uint8_t crc_crc8MaximModify(uint8_t crc8Maxim, const uint8_t * const Delta, const uint16_t DeltaLength, const uint32_t Distance);
+  extern uint8_t crc_crc8MaximModifyBatch(uint8_t crc8Maxim, const crc_patch_t * const Patch, const uint16_t PatchCount, const uint32_t DataLength);
+  extern bool crc_crc8MaximRollingInitialize(crc_rolling_t * const Rolling, const uint16_t WindowLength);
+  extern uint8_t crc_crc8MaximRollingUpdate(const crc_rolling_t * const Rolling, const uint8_t Out, const uint8_t In, const uint8_t crc8Maxim);
+  extern uint8_t crc_crc8MaximStripPrefix(uint8_t crc8Maxim, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength);
+  extern uint8_t crc_crc8MaximUnwind(uint8_t crc8Maxim, const uint8_t * const Data, const uint16_t DataLength);
+  extern bool crc_crc8MaximPrefixInitialize(crc_prefix_t * const prefix, const uint8_t * const Data, const uint16_t DataLength);
+  extern uint8_t crc_crc8MaximPrefixCalculate(const crc_prefix_t * const Prefix, const uint8_t * const Data, const uint16_t DataLength);
+  extern uint8_t crc_crc8MaximCalculateMasked(const uint8_t * const Data, const uint16_t DataLength, const crc_mask_t * const Mask, const uint16_t MaskCount);
+  extern uint8_t crc_crc8MaximCalculateBits(const uint8_t * const Data, const uint32_t BitOffset, const uint32_t BitLength);
+  extern uint8_t crc_crc8MaximCalculatePartialBits(const uint8_t Data, const uint8_t BitLength, uint8_t crc8Maxim, const bool Final);
+  extern bool crc_crc8MaximVerify(const uint8_t * const Data, const uint16_t DataLength);
+  extern bool crc_crc8MaximForge(uint8_t * const data, const uint16_t DataLength, const uint16_t Offset, const uint8_t crc8Maxim, const uint8_t Target);
 #endif
 
 /* CRC-8/ROHC */
 #if defined(CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ROHC_LOOP_METHOD)
   extern uint8_t crc_crc8RohcCalculate(const uint8_t * const Data, const uint16_t DataLength);
   extern uint8_t crc_crc8RohcCalculatePartial(const uint8_t Data, uint8_t crc8Rohc, const bool Final);
+  extern uint8_t crc_crc8RohcModify(uint8_t crc8Rohc, const uint8_t * const Delta, const uint16_t DeltaLength, const uint32_t Distance);
+  extern uint8_t crc_crc8RohcModifyBatch(uint8_t crc8Rohc, const crc_patch_t * const Patch, const uint16_t PatchCount, const uint32_t DataLength);
+  extern bool crc_crc8RohcRollingInitialize(crc_rolling_t * const Rolling, const uint16_t WindowLength);
+  extern uint8_t crc_crc8RohcRollingUpdate(const crc_rolling_t * const Rolling, const uint8_t Out, const uint8_t In, const uint8_t crc8Rohc);
+  extern uint8_t crc_crc8RohcStripPrefix(uint8_t crc8Rohc, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength);
+  extern uint8_t crc_crc8RohcUnwind(uint8_t crc8Rohc, const uint8_t * const Data, const uint16_t DataLength);
+  extern bool crc_crc8RohcPrefixInitialize(crc_prefix_t * const prefix, const uint8_t * const Data, const uint16_t DataLength);
+  extern uint8_t crc_crc8RohcPrefixCalculate(const crc_prefix_t * const Prefix, const uint8_t * const Data, const uint16_t DataLength);
+  extern uint8_t crc_crc8RohcCalculateMasked(const uint8_t * const Data, const uint16_t DataLength, const crc_mask_t * const Mask, const uint16_t MaskCount);
+  extern uint8_t crc_crc8RohcCalculateBits(const uint8_t * const Data, const uint32_t BitOffset, const uint32_t BitLength);
+  extern uint8_t crc_crc8RohcCalculatePartialBits(const uint8_t Data, const uint8_t BitLength, uint8_t crc8Rohc, const bool Final);
+  extern bool crc_crc8RohcVerify(const uint8_t * const Data, const uint16_t DataLength);
+  extern bool crc_crc8RohcForge(uint8_t * const data, const uint16_t DataLength, const uint16_t Offset, const uint8_t crc8Rohc, const uint8_t Target);
 #endif
 
 /* CRC-8/WCDMA */
 #if defined(CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_WCDMA_LOOP_METHOD)
   extern uint8_t crc_crc8WcdmaCalculate(const uint8_t * const Data, const uint16_t DataLength);
   extern uint8_t crc_crc8WcdmaCalculatePartial(const uint8_t Data, uint8_t crc8Wcdma, const bool Final);
+  extern uint8_t crc_crc8WcdmaModify(uint8_t crc8Wcdma, const uint8_t * const Delta, const uint16_t DeltaLength, const uint32_t Distance);
+  extern uint8_t crc_crc8WcdmaModifyBatch(uint8_t crc8Wcdma, const crc_patch_t * const Patch, const uint16_t PatchCount, const uint32_t DataLength);
+  extern bool crc_crc8WcdmaRollingInitialize(crc_rolling_t * const Rolling, const uint16_t WindowLength);
+  extern uint8_t crc_crc8WcdmaRollingUpdate(const crc_rolling_t * const Rolling, const uint8_t Out, const uint8_t In, const uint8_t crc8Wcdma);
+  extern uint8_t crc_crc8WcdmaStripPrefix(uint8_t crc8Wcdma, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength);
+  extern uint8_t crc_crc8WcdmaUnwind(uint8_t crc8Wcdma, const uint8_t * const Data, const uint16_t DataLength);
+  extern bool crc_crc8WcdmaPrefixInitialize(crc_prefix_t * const prefix, const uint8_t * const Data, const uint16_t DataLength);
+  extern uint8_t crc_crc8WcdmaPrefixCalculate(const crc_prefix_t * const Prefix, const uint8_t * const Data, const uint16_t DataLength);
+  extern uint8_t crc_crc8WcdmaCalculateMasked(const uint8_t * const Data, const uint16_t DataLength, const crc_mask_t * const Mask, const uint16_t MaskCount);
+  extern uint8_t crc_crc8WcdmaCalculateBits(const uint8_t * const Data, const uint32_t BitOffset, const uint32_t BitLength);
+  extern uint8_t crc_crc8WcdmaCalculatePartialBits(const uint8_t Data, const uint8_t BitLength, uint8_t crc8Wcdma, const bool Final);
+  extern bool crc_crc8WcdmaVerify(const uint8_t * const Data, const uint16_t DataLength);
+  extern bool crc_crc8WcdmaForge(uint8_t * const data, const uint16_t DataLength, const uint16_t Offset, const uint8_t crc8Wcdma, const uint8_t Target);
 #endif
 
 /*** CRC-16 ***/
@@ -149,12 +436,79 @@
 #if defined(CRC_CRC16_ARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_ARC_LOOP_METHOD)
   extern uint16_t crc_crc16ArcCalculate(const uint8_t * const Data, const uint16_t DataLength);
   extern uint16_t crc_crc16ArcCalculatePartial(const uint8_t Data, uint16_t crc16Arc, const bool Final);
+  extern uint16_t crc_crc16ArcModify(uint16_t crc16Arc, const uint8_t * const Delta, const uint16_t DeltaLength, const uint32_t Distance);
+  extern uint16_t crc_crc16ArcModifyBatch(uint16_t crc16Arc, const crc_patch_t * const Patch, const uint16_t PatchCount, const uint32_t DataLength);
+  extern bool crc_crc16ArcRollingInitialize(crc_rolling_t * const Rolling, const uint16_t WindowLength);
+  extern uint16_t crc_crc16ArcRollingUpdate(const crc_rolling_t * const Rolling, const uint8_t Out, const uint8_t In, const uint16_t crc16Arc);
+  extern uint16_t crc_crc16ArcStripPrefix(uint16_t crc16Arc, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength);
+  extern uint16_t crc_crc16ArcUnwind(uint16_t crc16Arc, const uint8_t * const Data, const uint16_t DataLength);
+  extern bool crc_crc16ArcPrefixInitialize(crc_prefix_t * const prefix, const uint8_t * const Data, const uint16_t DataLength);
+  extern uint16_t crc_crc16ArcPrefixCalculate(const crc_prefix_t * const Prefix, const uint8_t * const Data, const uint16_t DataLength);
+  extern uint16_t crc_crc16ArcCalculateMasked(const uint8_t * const Data, const uint16_t DataLength, const crc_mask_t * const Mask, const uint16_t MaskCount);
+  extern uint16_t crc_crc16ArcCalculateBits(const uint8_t * const Data, const uint32_t BitOffset, const uint32_t BitLength);
+  extern uint16_t crc_crc16ArcCalculatePartialBits(const uint8_t Data, const uint8_t BitLength, uint16_t crc16Arc, const bool Final);
+  extern bool crc_crc16ArcVerify(const uint8_t * const Data, const uint16_t DataLength);
+  extern bool crc_crc16ArcForge(uint8_t * const data, const uint16_t DataLength, const uint16_t Offset, const uint16_t crc16Arc, const uint16_t Target);
 #endif
 
 /* CRC-16/CCITT-FALSE */
 #if defined(CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_CCITT_FALSE_LOOP_METHOD)
   extern uint16_t crc_crc16CcittFalseCalculate(const uint8_t * const Data, const uint16_t DataLength);
   extern uint16_t crc_crc16CcittFalseCalculatePartial(const uint8_t Data, uint16_t crc16CcittFalse);
+  extern uint16_t crc_crc16CcittFalseModify(uint16_t crc16CcittFalse, const uint8_t * const Delta, const uint16_t DeltaLength, const uint32_t Distance);
+  extern uint16_t crc_crc16CcittFalseModifyBatch(uint16_t crc16CcittFalse, const crc_patch_t * const Patch, const uint16_t PatchCount, const uint32_t DataLength);
+  extern bool crc_crc16CcittFalseRollingInitialize(crc_rolling_t * const Rolling, const uint16_t WindowLength);
+  extern uint16_t crc_crc16CcittFalseRollingUpdate(const crc_rolling_t * const Rolling, const uint8_t Out, const uint8_t In, const uint16_t crc16CcittFalse);
+  extern uint16_t crc_crc16CcittFalseStripPrefix(uint16_t crc16CcittFalse, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength);
+  extern uint16_t crc_crc16CcittFalseUnwind(uint16_t crc16CcittFalse, const uint8_t * const Data, const uint16_t DataLength);
+  extern bool crc_crc16CcittFalsePrefixInitialize(crc_prefix_t * const prefix, const uint8_t * const Data, const uint16_t DataLength);
+  extern uint16_t crc_crc16CcittFalsePrefixCalculate(const crc_prefix_t * const Prefix, const uint8_t * const Data, const uint16_t DataLength);
+  extern uint16_t crc_crc16CcittFalseCalculateMasked(const uint8_t * const Data, const uint16_t DataLength, const crc_mask_t * const Mask, const uint16_t MaskCount);
+  extern uint16_t crc_crc16CcittFalseCalculateBits(const uint8_t * const Data, const uint32_t BitOffset, const uint32_t BitLength);
+  extern uint16_t crc_crc16CcittFalseCalculatePartialBits(const uint8_t Data, const uint8_t BitLength, uint16_t crc16CcittFalse);
+  extern bool crc_crc16CcittFalseVerify(const uint8_t * const Data, const uint16_t DataLength);
+  extern crc_correction_t crc_crc16CcittFalseCorrect(crc_syndrome16_t * const syndrome, uint8_t * const data, const uint16_t DataLength);
+  extern bool crc_crc16CcittFalseForge(uint8_t * const data, const uint16_t DataLength, const uint16_t Offset, const uint16_t crc16CcittFalse, const uint16_t Target);
+#endif
+
+/*** Multi ***/
+extern void crc_multiCalculate(const uint8_t * const Data, const uint16_t DataLength, const uint32_t Variants, uint16_t * const Crc);
+
+/*** Variant ***/
+extern const char *crc_variantName(const crc_variant_t Variant);
+
+/*** Metrics ***/
+#ifdef CRC_METRICS
+  extern bool crc_metricsSnapshot(crc_metrics_t * const metrics);
+#endif
+
+/*** Reverse ***/
+#ifdef CRC_REVERSE
+  extern bool crc_reverseModel(const crc_variant_t Variant, crc_model_t * const model);
+  extern uint16_t crc_reversePreset(const crc_sample_t * const Sample, const uint16_t SampleCount, crc_model_t * const model, const uint16_t ModelCount);
+  extern uint16_t crc_reverseSearch(const crc_sample_t * const Sample, const uint16_t SampleCount, const uint8_t Width, const uint16_t PolynomialFirst, const uint16_t PolynomialLast, crc_model_t * const model, const uint16_t ModelCount);
+#endif
+
+/*** JIT ***/
+#ifdef CRC_JIT
+  extern uint16_t crc_jitCalculate(const crc_model_t * const Model, const uint8_t * const Data, const uint16_t DataLength);
+  extern bool crc_jitNative(const crc_model_t * const Model);
+#endif
+
+/*** Table ***/
+#ifdef CRC_TABLE
+  extern const crc_table_t *crc_tableAcquire(const uint8_t Width, const uint16_t Polynomial, const bool ReflectIn);
+  extern void crc_tableRelease(const crc_table_t * const Table);
+  extern uint16_t crc_tableCalculate(const crc_table_t * const Table, const crc_model_t * const Model, const uint8_t * const Data, const uint16_t DataLength);
+  extern void crc_tableBudget(const size_t Bytes);
+  extern bool crc_tableStatistics(crc_table_statistics_t * const statistics);
+  extern bool crc_tableSave(const char * const Path);
+  extern bool crc_tableMap(const char * const Path);
+#endif
+
+/*** Registry ***/
+#ifdef CRC_REGISTRY
+  extern const crc_registry_t *crc_registryFind(const char * const Name);
 #endif
 
 #endif
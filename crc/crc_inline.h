@@ -0,0 +1,797 @@
+/****************************************************************************************************
+ * FILE:    crc_inline.h
+ * BRIEF:   Cyclic Redundancy Check (CRC) Inline Per-Byte Step Header File
+ * NOTE:    Include Instead Of crc.h To Add Bytes Without A Function Call; crc.c Builds Its Own Bulk
+ *          Loops On These Steps; Helpers, Tables And Constants Used Only By The Steps Are Prefixed
+ *          crc_inline / CRC_INLINE_
+ ****************************************************************************************************/
+
+#ifndef CRC_INLINE_H
+#define CRC_INLINE_H
+
+/****************************************************************************************************
+ * Definitions
+ ****************************************************************************************************/
+
+/*** CRC-8 ***/
+/* CRC-8 */
+#if defined(CRC_CRC8_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_LOOP_METHOD)
+  #define CRC_INLINE_CRC8_POLYNOMIAL (0x07)
+#endif
+
+/* CRC-8/CDMA2000 */
+#if defined(CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_CDMA2000_LOOP_METHOD)
+  #define CRC_INLINE_CRC8_CDMA2000_POLYNOMIAL (0x9B)
+#endif
+
+/* CRC-8/DARC */
+#if defined(CRC_CRC8_DARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DARC_LOOP_METHOD)
+  #define CRC_INLINE_CRC8_DARC_POLYNOMIAL (0x39)
+#endif
+
+/* CRC-8/DVB-S2 */
+#if defined(CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DVB_S2_LOOP_METHOD)
+  #define CRC_INLINE_CRC8_DVB_S2_POLYNOMIAL (0xD5)
+#endif
+
+/* CRC-8/EBU */
+#if defined(CRC_CRC8_EBU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_EBU_LOOP_METHOD)
+  #define CRC_INLINE_CRC8_EBU_POLYNOMIAL (0x1D)
+#endif
+
+/* CRC-8/I-CODE */
+#if defined(CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_I_CODE_LOOP_METHOD)
+  #define CRC_INLINE_CRC8_I_CODE_POLYNOMIAL (0x1D)
+#endif
+
+/* CRC-8/ITU */
+#if defined(CRC_CRC8_ITU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ITU_LOOP_METHOD)
+  #define CRC_INLINE_CRC8_ITU_POLYNOMIAL (0x07)
+  #define CRC_INLINE_CRC8_ITU_XOR_OUT    (0x55)
+#endif
+
+/* CRC-8/MAXIM */
+#if defined(CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_MAXIM_LOOP_METHOD)
+  #define CRC_INLINE_CRC8_MAXIM_POLYNOMIAL (0x31)
+#endif
+
+/* CRC-8/ROHC */
+#if defined(CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ROHC_LOOP_METHOD)
+  #define CRC_INLINE_CRC8_ROHC_POLYNOMIAL (0x07)
+#endif
+
+/* CRC-8/WCDMA */
+#if defined(CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_WCDMA_LOOP_METHOD)
+  #define CRC_INLINE_CRC8_WCDMA_POLYNOMIAL (0x9B)
+#endif
+
+/*** CRC-16 ***/
+/* CRC-16/ARC */
+#if defined(CRC_CRC16_ARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_ARC_LOOP_METHOD)
+  #define CRC_INLINE_CRC16_ARC_POLYNOMIAL (0x8005)
+#endif
+
+/* CRC-16/CCITT-FALSE */
+#if defined(CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_CCITT_FALSE_LOOP_METHOD)
+  #define CRC_INLINE_CRC16_CCITT_FALSE_POLYNOMIAL (0x1021)
+#endif
+
+/*** Fixed Length ***/
+#ifdef CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD
+  #define CRC_CRC8_DVB_S2_BBHEADER_LENGTH  (10)  // DVB-S2 Baseband Header
+  #define CRC_CRC8_DVB_S2_TS_PACKET_LENGTH (188) // MPEG Transport Stream Packet
+#endif
+#ifdef CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD
+  #define CRC_CRC8_MAXIM_ROM_ID_LENGTH (8) // 1-Wire ROM ID
+#endif
+
+/*** Unroll ***/
+#if defined(__GNUC__) || defined(__clang__)
+  #define CRC_INLINE_PRAGMA(text)  _Pragma(#text)
+  #define CRC_INLINE_UNROLL(count) CRC_INLINE_PRAGMA(GCC unroll count)
+#else
+  #define CRC_INLINE_UNROLL(count)
+#endif
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "crc.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Constants
+ ****************************************************************************************************/
+
+/*** Lookup Table ***/
+#ifdef CRC_CRC8_LOOKUP_TABLE_METHOD
+  extern const uint8_t crc_inlineCrc8LookupTable[256];
+#endif
+#ifdef CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD
+  extern const uint8_t crc_inlineCrc8Cdma2000LookupTable[256];
+#endif
+#ifdef CRC_CRC8_DARC_LOOKUP_TABLE_METHOD
+  extern const uint8_t crc_inlineCrc8DarcLookupTable[256];
+#endif
+#ifdef CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD
+  extern const uint8_t crc_inlineCrc8DvbS2LookupTable[256];
+#endif
+#ifdef CRC_CRC8_EBU_LOOKUP_TABLE_METHOD
+  extern const uint8_t crc_inlineCrc8EbuLookupTable[256];
+#endif
+#ifdef CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD
+  extern const uint8_t crc_inlineCrc8ICodeLookupTable[256];
+#endif
+#ifdef CRC_CRC8_ITU_LOOKUP_TABLE_METHOD
+  extern const uint8_t crc_inlineCrc8ItuLookupTable[256];
+#endif
+#ifdef CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD
+  extern const uint8_t crc_inlineCrc8MaximLookupTable[256];
+#endif
+#ifdef CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD
+  extern const uint8_t crc_inlineCrc8RohcLookupTable[256];
+#endif
+#ifdef CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD
+  extern const uint8_t crc_inlineCrc8WcdmaLookupTable[256];
+#endif
+#ifdef CRC_CRC16_ARC_LOOKUP_TABLE_METHOD
+  extern const uint16_t crc_inlineCrc16ArcLookupTable[256];
+#endif
+#ifdef CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD
+  extern const uint16_t crc_inlineCrc16CcittFalseLookupTable[256];
+#endif
+
+/****************************************************************************************************
+ * Function Definitions (Inline)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   crc_inlineReflectU8
+ * BRIEF:   Reflect U8 (uint8_t)
+ * RETURN:  uint8_t: Reflected U8
+ * ARG:     Data: U8 To Reflect
+ ****************************************************************************************************/
+static inline uint8_t crc_inlineReflectU8(const uint8_t Data)
+{
+    uint8_t reflectedData = Data;
+    
+    /*** Reflect U8 (uint8_t) ***/
+    reflectedData = (uint8_t)(((reflectedData & 0xF0) >> 4) | ((reflectedData & 0x0F) << 4));
+    reflectedData = (uint8_t)(((reflectedData & 0xCC) >> 2) | ((reflectedData & 0x33) << 2));
+    reflectedData = (uint8_t)(((reflectedData & 0xAA) >> 1) | ((reflectedData & 0x55) << 1));
+    
+    return reflectedData;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_inlineReflectU16
+ * BRIEF:   Reflect U16 (uint16_t)
+ * RETURN:  uint16_t: Reflected U16
+ * ARG:     Data: U16 To Reflect
+ ****************************************************************************************************/
+static inline uint16_t crc_inlineReflectU16(const uint16_t Data)
+{
+    /*** Reflect U16 (uint16_t) As Swapped Reflected Bytes ***/
+    return (uint16_t)((crc_inlineReflectU8((uint8_t)(Data & 0xFF)) << 8) | crc_inlineReflectU8((uint8_t)(Data >> 8)));
+}
+
+#if defined(CRC_CRC8_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crc_crc8Step
+ * BRIEF:   Add One Byte To CRC-8
+ * RETURN:  uint8_t: Current CRC-8
+ * ARG:     Data: Data To Add To CRC-8 Calculation
+ * ARG:     crc8: Current CRC-8
+ ****************************************************************************************************/
+static inline uint8_t crc_crc8Step(const uint8_t Data, uint8_t crc8)
+{
+#if defined(CRC_CRC8_LOOKUP_TABLE_METHOD) && defined(CRC_CRC8_LOOP_METHOD)
+  #error CRC_CRC8_LOOKUP_TABLE_METHOD And CRC_CRC8_LOOP_METHOD Cannot Both Be Defined
+#elif defined(CRC_CRC8_LOOKUP_TABLE_METHOD) 
+    /*** Calculate Partial CRC-8 ***/
+    crc8 = crc_inlineCrc8LookupTable[Data ^ crc8];
+    return crc8;
+#elif defined(CRC_CRC8_LOOP_METHOD)
+    uint8_t bit;
+    
+    /*** Calculate Partial CRC-8 ***/
+    crc8 ^= Data;
+    for(bit = 0; bit < 8; bit++)
+    {
+        if((crc8 & 0x80) == 0x80)
+            crc8 = (uint8_t)((crc8 << 1) ^ CRC_INLINE_CRC8_POLYNOMIAL);
+        else
+            crc8 <<= 1;
+    }
+    
+    return crc8;
+#endif
+}
+#endif
+
+#if defined(CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_CDMA2000_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crc_crc8Cdma2000Step
+ * BRIEF:   Add One Byte To CRC-8/CDMA2000
+ * RETURN:  uint8_t: Current CRC-8/CDMA2000
+ * ARG:     Data: Data To Add To CRC-8/CDMA2000 Calculation
+ * ARG:     crc8Cdma2000: Current CRC-8/CDMA2000
+ ****************************************************************************************************/
+static inline uint8_t crc_crc8Cdma2000Step(const uint8_t Data, uint8_t crc8Cdma2000)
+{
+#if defined(CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD) && defined(CRC_CRC8_CDMA2000_LOOP_METHOD)
+  #error CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD And CRC_CRC8_CDMA2000_LOOP_METHOD Cannot Both Be Defined
+#elif defined(CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD) 
+    /*** Calculate Partial CRC-8/CDMA2000 ***/
+    crc8Cdma2000 = crc_inlineCrc8Cdma2000LookupTable[Data ^ crc8Cdma2000];
+    return crc8Cdma2000;
+#elif defined(CRC_CRC8_CDMA2000_LOOP_METHOD)
+    uint8_t bit;
+    
+    /*** Calculate Partial CRC-8/CDMA2000 ***/
+    crc8Cdma2000 ^= Data;
+    for(bit = 0; bit < 8; bit++)
+    {
+        if((crc8Cdma2000 & 0x80) == 0x80)
+            crc8Cdma2000 = (uint8_t)((crc8Cdma2000 << 1) ^ CRC_INLINE_CRC8_CDMA2000_POLYNOMIAL);
+        else
+            crc8Cdma2000 <<= 1;
+    }
+    
+    return crc8Cdma2000;
+#endif
+}
+#endif
+
+#if defined(CRC_CRC8_DARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DARC_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crc_crc8DarcStep
+ * BRIEF:   Add One Byte To CRC-8/DARC
+ * RETURN:  uint8_t: Current CRC-8/DARC
+ * ARG:     Data: Data To Add To CRC-8/DARC Calculation
+ * ARG:     crc8Darc: Current CRC-8/DARC
+ * NOTE:    Same As crc_crc8DarcCalculatePartial On Non-Final Data; Finish With crc_crc8DarcFinal
+ *          After The Last Byte
+ ****************************************************************************************************/
+static inline uint8_t crc_crc8DarcStep(const uint8_t Data, uint8_t crc8Darc)
+{
+#if defined(CRC_CRC8_DARC_LOOKUP_TABLE_METHOD) && defined(CRC_CRC8_DARC_LOOP_METHOD)
+  #error CRC_CRC8_DARC_LOOKUP_TABLE_METHOD And CRC_CRC8_DARC_LOOP_METHOD Cannot Both Be Defined
+#elif defined(CRC_CRC8_DARC_LOOKUP_TABLE_METHOD) 
+    /*** Calculate Partial CRC-8/DARC ***/
+    crc8Darc = crc_inlineCrc8DarcLookupTable[Data ^ crc8Darc];
+    return crc8Darc;
+#elif defined(CRC_CRC8_DARC_LOOP_METHOD)
+    uint8_t bit, data;
+    
+    /*** Reflect Input (Data) ***/
+    data = crc_inlineReflectU8(Data);
+    
+    /*** Calculate Partial CRC-8/DARC ***/
+    crc8Darc ^= data;
+    for(bit = 0; bit < 8; bit++)
+    {
+        if((crc8Darc & 0x80) == 0x80)
+            crc8Darc = (uint8_t)((crc8Darc << 1) ^ CRC_INLINE_CRC8_DARC_POLYNOMIAL);
+        else
+            crc8Darc <<= 1;
+    }
+    
+    return crc8Darc;
+#endif
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8DarcFinal
+ * BRIEF:   Convert Current CRC-8/DARC After Last Byte To Output Form
+ * RETURN:  uint8_t: CRC-8/DARC
+ * ARG:     crc8Darc: Current CRC-8/DARC From crc_crc8DarcStep
+ ****************************************************************************************************/
+static inline uint8_t crc_crc8DarcFinal(uint8_t crc8Darc)
+{
+#ifdef CRC_CRC8_DARC_LOOP_METHOD
+    /*** Reflect Output (CRC-8/DARC) ***/
+    crc8Darc = crc_inlineReflectU8(crc8Darc);
+#endif
+    
+    return crc8Darc;
+}
+#endif
+
+#if defined(CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DVB_S2_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crc_crc8DvbS2Step
+ * BRIEF:   Add One Byte To CRC-8/DVB-S2
+ * RETURN:  uint8_t: Current CRC-8/DVB-S2
+ * ARG:     Data: Data To Add To CRC-8/DVB-S2 Calculation
+ * ARG:     crc8DvbS2: Current CRC-8/DVB-S2
+ ****************************************************************************************************/
+static inline uint8_t crc_crc8DvbS2Step(const uint8_t Data, uint8_t crc8DvbS2)
+{
+#if defined(CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD) && defined(CRC_CRC8_DVB_S2_LOOP_METHOD)
+  #error CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD And CRC_CRC8_DVB_S2_LOOP_METHOD Cannot Both Be Defined
+#elif defined(CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD) 
+    /*** Calculate Partial CRC-8/DVB-S2 ***/
+    crc8DvbS2 = crc_inlineCrc8DvbS2LookupTable[Data ^ crc8DvbS2];
+    return crc8DvbS2;
+#elif defined(CRC_CRC8_DVB_S2_LOOP_METHOD)
+    uint8_t bit;
+    
+    /*** Calculate Partial CRC-8/DVB-S2 ***/
+    crc8DvbS2 ^= Data;
+    for(bit = 0; bit < 8; bit++)
+    {
+        if((crc8DvbS2 & 0x80) == 0x80)
+            crc8DvbS2 = (uint8_t)((crc8DvbS2 << 1) ^ CRC_INLINE_CRC8_DVB_S2_POLYNOMIAL);
+        else
+            crc8DvbS2 <<= 1;
+    }
+    
+    return crc8DvbS2;
+#endif
+}
+#endif
+
+#if defined(CRC_CRC8_EBU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_EBU_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crc_crc8EbuStep
+ * BRIEF:   Add One Byte To CRC-8/EBU
+ * RETURN:  uint8_t: Current CRC-8/EBU
+ * ARG:     Data: Data To Add To CRC-8/EBU Calculation
+ * ARG:     crc8Ebu: Current CRC-8/EBU
+ * NOTE:    Same As crc_crc8EbuCalculatePartial On Non-Final Data; Finish With crc_crc8EbuFinal
+ *          After The Last Byte
+ ****************************************************************************************************/
+static inline uint8_t crc_crc8EbuStep(const uint8_t Data, uint8_t crc8Ebu)
+{
+#if defined(CRC_CRC8_EBU_LOOKUP_TABLE_METHOD) && defined(CRC_CRC8_EBU_LOOP_METHOD)
+  #error CRC_CRC8_EBU_LOOKUP_TABLE_METHOD And CRC_CRC8_EBU_LOOP_METHOD Cannot Both Be Defined
+#elif defined(CRC_CRC8_EBU_LOOKUP_TABLE_METHOD) 
+    /*** Calculate Partial CRC-8/EBU ***/
+    crc8Ebu = crc_inlineCrc8EbuLookupTable[Data ^ crc8Ebu];
+    return crc8Ebu;
+#elif defined(CRC_CRC8_EBU_LOOP_METHOD)
+    uint8_t bit, data;
+    
+    /*** Reflect Input (Data) ***/
+    data = crc_inlineReflectU8(Data);
+    
+    /*** Calculate Partial CRC-8/EBU ***/
+    crc8Ebu ^= data;
+    for(bit = 0; bit < 8; bit++)
+    {
+        if((crc8Ebu & 0x80) == 0x80)
+            crc8Ebu = (uint8_t)((crc8Ebu << 1) ^ CRC_INLINE_CRC8_EBU_POLYNOMIAL);
+        else
+            crc8Ebu <<= 1;
+    }
+    
+    return crc8Ebu;
+#endif
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8EbuFinal
+ * BRIEF:   Convert Current CRC-8/EBU After Last Byte To Output Form
+ * RETURN:  uint8_t: CRC-8/EBU
+ * ARG:     crc8Ebu: Current CRC-8/EBU From crc_crc8EbuStep
+ ****************************************************************************************************/
+static inline uint8_t crc_crc8EbuFinal(uint8_t crc8Ebu)
+{
+#ifdef CRC_CRC8_EBU_LOOP_METHOD
+    /*** Reflect Output (CRC-8/EBU) ***/
+    crc8Ebu = crc_inlineReflectU8(crc8Ebu);
+#endif
+    
+    return crc8Ebu;
+}
+#endif
+
+#if defined(CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_I_CODE_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crc_crc8ICodeStep
+ * BRIEF:   Add One Byte To CRC-8/I-CODE
+ * RETURN:  uint8_t: Current CRC-8/I-CODE
+ * ARG:     Data: Data To Add To CRC-8/I-CODE Calculation
+ * ARG:     crc8ICode: Current CRC-8/I-CODE
+ ****************************************************************************************************/
+static inline uint8_t crc_crc8ICodeStep(const uint8_t Data, uint8_t crc8ICode)
+{
+#if defined(CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD) && defined(CRC_CRC8_I_CODE_LOOP_METHOD)
+  #error CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD And CRC_CRC8_I_CODE_LOOP_METHOD Cannot Both Be Defined
+#elif defined(CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD) 
+    /*** Calculate Partial CRC-8/I-CODE ***/
+    crc8ICode = crc_inlineCrc8ICodeLookupTable[Data ^ crc8ICode];
+    return crc8ICode;
+#elif defined(CRC_CRC8_I_CODE_LOOP_METHOD)
+    uint8_t bit;
+    
+    /*** Calculate Partial CRC-8/I-CODE ***/
+    crc8ICode ^= Data;
+    for(bit = 0; bit < 8; bit++)
+    {
+        if((crc8ICode & 0x80) == 0x80)
+            crc8ICode = (uint8_t)((crc8ICode << 1) ^ CRC_INLINE_CRC8_I_CODE_POLYNOMIAL);
+        else
+            crc8ICode <<= 1;
+    }
+    
+    return crc8ICode;
+#endif
+}
+#endif
+
+#if defined(CRC_CRC8_ITU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ITU_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crc_crc8ItuStep
+ * BRIEF:   Add One Byte To CRC-8/ITU
+ * RETURN:  uint8_t: Current CRC-8/ITU
+ * ARG:     Data: Data To Add To CRC-8/ITU Calculation
+ * ARG:     crc8Itu: Current CRC-8/ITU
+ * NOTE:    Same As crc_crc8ItuCalculatePartial On Non-Final Data; Finish With crc_crc8ItuFinal
+ *          After The Last Byte
+ ****************************************************************************************************/
+static inline uint8_t crc_crc8ItuStep(const uint8_t Data, uint8_t crc8Itu)
+{
+#if defined(CRC_CRC8_ITU_LOOKUP_TABLE_METHOD) && defined(CRC_CRC8_ITU_LOOP_METHOD)
+  #error CRC_CRC8_ITU_LOOKUP_TABLE_METHOD And CRC_CRC8_ITU_LOOP_METHOD Cannot Both Be Defined
+#elif defined(CRC_CRC8_ITU_LOOKUP_TABLE_METHOD) 
+    /*** Calculate Partial CRC-8/ITU ***/
+    crc8Itu = crc_inlineCrc8ItuLookupTable[Data ^ crc8Itu];
+    return crc8Itu;
+#elif defined(CRC_CRC8_ITU_LOOP_METHOD)
+    uint8_t bit;
+    
+    /*** Calculate Partial CRC-8/ITU ***/
+    crc8Itu ^= Data;
+    for(bit = 0; bit < 8; bit++)
+    {
+        if((crc8Itu & 0x80) == 0x80)
+            crc8Itu = (uint8_t)((crc8Itu << 1) ^ CRC_INLINE_CRC8_ITU_POLYNOMIAL);
+        else
+            crc8Itu <<= 1;
+    }
+    
+    return crc8Itu;
+#endif
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8ItuFinal
+ * BRIEF:   Convert Current CRC-8/ITU After Last Byte To Output Form
+ * RETURN:  uint8_t: CRC-8/ITU
+ * ARG:     crc8Itu: Current CRC-8/ITU From crc_crc8ItuStep
+ ****************************************************************************************************/
+static inline uint8_t crc_crc8ItuFinal(uint8_t crc8Itu)
+{
+    /*** XOR Output (CRC-8/ITU) ***/
+    crc8Itu = crc8Itu ^ CRC_INLINE_CRC8_ITU_XOR_OUT;
+    
+    return crc8Itu;
+}
+#endif
+
+#if defined(CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_MAXIM_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crc_crc8MaximStep
+ * BRIEF:   Add One Byte To CRC-8/MAXIM
+ * RETURN:  uint8_t: Current CRC-8/MAXIM
+ * ARG:     Data: Data To Add To CRC-8/MAXIM Calculation
+ * ARG:     crc8Maxim: Current CRC-8/MAXIM
+ * NOTE:    Same As crc_crc8MaximCalculatePartial On Non-Final Data; Finish With crc_crc8MaximFinal
+ *          After The Last Byte
+ ****************************************************************************************************/
+static inline uint8_t crc_crc8MaximStep(const uint8_t Data, uint8_t crc8Maxim)
+{
+#if defined(CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD) && defined(CRC_CRC8_MAXIM_LOOP_METHOD)
+  #error CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD And CRC_CRC8_MAXIM_LOOP_METHOD Cannot Both Be Defined
+#elif defined(CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD) 
+    /*** Calculate Partial CRC-8/MAXIM ***/
+    crc8Maxim = crc_inlineCrc8MaximLookupTable[Data ^ crc8Maxim];
+    return crc8Maxim;
+#elif defined(CRC_CRC8_MAXIM_LOOP_METHOD)
+    uint8_t bit, data;
+    
+    /*** Reflect Input (Data) ***/
+    data = crc_inlineReflectU8(Data);
+    
+    /*** Calculate Partial CRC-8/MAXIM ***/
+    crc8Maxim ^= data;
+    for(bit = 0; bit < 8; bit++)
+    {
+        if((crc8Maxim & 0x80) == 0x80)
+            crc8Maxim = (uint8_t)((crc8Maxim << 1) ^ CRC_INLINE_CRC8_MAXIM_POLYNOMIAL);
+        else
+            crc8Maxim <<= 1;
+    }
+    
+    return crc8Maxim;
+#endif
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8MaximFinal
+ * BRIEF:   Convert Current CRC-8/MAXIM After Last Byte To Output Form
+ * RETURN:  uint8_t: CRC-8/MAXIM
+ * ARG:     crc8Maxim: Current CRC-8/MAXIM From crc_crc8MaximStep
+ ****************************************************************************************************/
+static inline uint8_t crc_crc8MaximFinal(uint8_t crc8Maxim)
+{
+#ifdef CRC_CRC8_MAXIM_LOOP_METHOD
+    /*** Reflect Output (CRC-8/MAXIM) ***/
+    crc8Maxim = crc_inlineReflectU8(crc8Maxim);
+#endif
+    
+    return crc8Maxim;
+}
+#endif
+
+#if defined(CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ROHC_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crc_crc8RohcStep
+ * BRIEF:   Add One Byte To CRC-8/ROHC
+ * RETURN:  uint8_t: Current CRC-8/ROHC
+ * ARG:     Data: Data To Add To CRC-8/ROHC Calculation
+ * ARG:     crc8Rohc: Current CRC-8/ROHC
+ * NOTE:    Same As crc_crc8RohcCalculatePartial On Non-Final Data; Finish With crc_crc8RohcFinal
+ *          After The Last Byte
+ ****************************************************************************************************/
+static inline uint8_t crc_crc8RohcStep(const uint8_t Data, uint8_t crc8Rohc)
+{
+#if defined(CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD) && defined(CRC_CRC8_ROHC_LOOP_METHOD)
+  #error CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD And CRC_CRC8_ROHC_LOOP_METHOD Cannot Both Be Defined
+#elif defined(CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD) 
+    /*** Calculate Partial CRC-8/ROHC ***/
+    crc8Rohc = crc_inlineCrc8RohcLookupTable[Data ^ crc8Rohc];
+    return crc8Rohc;
+#elif defined(CRC_CRC8_ROHC_LOOP_METHOD)
+    uint8_t bit, data;
+    
+    /*** Reflect Input (Data) ***/
+    data = crc_inlineReflectU8(Data);
+    
+    /*** Calculate Partial CRC-8/ROHC ***/
+    crc8Rohc ^= data;
+    for(bit = 0; bit < 8; bit++)
+    {
+        if((crc8Rohc & 0x80) == 0x80)
+            crc8Rohc = (uint8_t)((crc8Rohc << 1) ^ CRC_INLINE_CRC8_ROHC_POLYNOMIAL);
+        else
+            crc8Rohc <<= 1;
+    }
+    
+    return crc8Rohc;
+#endif
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8RohcFinal
+ * BRIEF:   Convert Current CRC-8/ROHC After Last Byte To Output Form
+ * RETURN:  uint8_t: CRC-8/ROHC
+ * ARG:     crc8Rohc: Current CRC-8/ROHC From crc_crc8RohcStep
+ ****************************************************************************************************/
+static inline uint8_t crc_crc8RohcFinal(uint8_t crc8Rohc)
+{
+#ifdef CRC_CRC8_ROHC_LOOP_METHOD
+    /*** Reflect Output (CRC-8/ROHC) ***/
+    crc8Rohc = crc_inlineReflectU8(crc8Rohc);
+#endif
+    
+    return crc8Rohc;
+}
+#endif
+
+#if defined(CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_WCDMA_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crc_crc8WcdmaStep
+ * BRIEF:   Add One Byte To CRC-8/WCDMA
+ * RETURN:  uint8_t: Current CRC-8/WCDMA
+ * ARG:     Data: Data To Add To CRC-8/WCDMA Calculation
+ * ARG:     crc8Wcdma: Current CRC-8/WCDMA
+ * NOTE:    Same As crc_crc8WcdmaCalculatePartial On Non-Final Data; Finish With crc_crc8WcdmaFinal
+ *          After The Last Byte
+ ****************************************************************************************************/
+static inline uint8_t crc_crc8WcdmaStep(const uint8_t Data, uint8_t crc8Wcdma)
+{
+#if defined(CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD) && defined(CRC_CRC8_WCDMA_LOOP_METHOD)
+  #error CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD And CRC_CRC8_WCDMA_LOOP_METHOD Cannot Both Be Defined
+#elif defined(CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD) 
+    /*** Calculate Partial CRC-8/WCDMA ***/
+    crc8Wcdma = crc_inlineCrc8WcdmaLookupTable[Data ^ crc8Wcdma];
+    return crc8Wcdma;
+#elif defined(CRC_CRC8_WCDMA_LOOP_METHOD)
+    uint8_t bit, data;
+    
+    /*** Reflect Input (Data) ***/
+    data = crc_inlineReflectU8(Data);
+    
+    /*** Calculate Partial CRC-8/WCDMA ***/
+    crc8Wcdma ^= data;
+    for(bit = 0; bit < 8; bit++)
+    {
+        if((crc8Wcdma & 0x80) == 0x80)
+            crc8Wcdma = (uint8_t)((crc8Wcdma << 1) ^ CRC_INLINE_CRC8_WCDMA_POLYNOMIAL);
+        else
+            crc8Wcdma <<= 1;
+    }
+    
+    return crc8Wcdma;
+#endif
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc8WcdmaFinal
+ * BRIEF:   Convert Current CRC-8/WCDMA After Last Byte To Output Form
+ * RETURN:  uint8_t: CRC-8/WCDMA
+ * ARG:     crc8Wcdma: Current CRC-8/WCDMA From crc_crc8WcdmaStep
+ ****************************************************************************************************/
+static inline uint8_t crc_crc8WcdmaFinal(uint8_t crc8Wcdma)
+{
+#ifdef CRC_CRC8_WCDMA_LOOP_METHOD
+    /*** Reflect Output (CRC-8/WCDMA) ***/
+    crc8Wcdma = crc_inlineReflectU8(crc8Wcdma);
+#endif
+    
+    return crc8Wcdma;
+}
+#endif
+
+#if defined(CRC_CRC16_ARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_ARC_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crc_crc16ArcStep
+ * BRIEF:   Add One Byte To CRC-16/ARC
+ * RETURN:  uint16_t: Current CRC-16/ARC
+ * ARG:     Data: Data To Add To CRC-16/ARC Calculation
+ * ARG:     crc16Arc: Current CRC-16/ARC
+ * NOTE:    Same As crc_crc16ArcCalculatePartial On Non-Final Data; Finish With crc_crc16ArcFinal
+ *          After The Last Byte
+ ****************************************************************************************************/
+static inline uint16_t crc_crc16ArcStep(const uint8_t Data, uint16_t crc16Arc)
+{
+#if defined(CRC_CRC16_ARC_LOOKUP_TABLE_METHOD) && defined(CRC_CRC16_ARC_LOOP_METHOD)
+  #error CRC_CRC16_ARC_LOOKUP_TABLE_METHOD And CRC_CRC16_ARC_LOOP_METHOD Cannot Both Be Defined
+#elif defined(CRC_CRC16_ARC_LOOKUP_TABLE_METHOD) 
+    /*** Calculate Partial CRC-16/ARC ***/
+    crc16Arc = (uint16_t)((crc16Arc >> 8) ^ crc_inlineCrc16ArcLookupTable[(uint8_t)(Data ^ (crc16Arc & 0x00FF))]);
+    return crc16Arc;
+#elif defined(CRC_CRC16_ARC_LOOP_METHOD)
+    uint8_t bit, data;
+    
+    /*** Reflect Input (Data) ***/
+    data = crc_inlineReflectU8(Data);
+    
+    /*** Calculate Partial CRC-16/ARC ***/
+    crc16Arc ^= (data << 8);
+    for(bit = 0; bit < 8; bit++)
+    {
+        if((crc16Arc & 0x8000) == 0x8000)
+            crc16Arc = (uint16_t)((crc16Arc << 1) ^ CRC_INLINE_CRC16_ARC_POLYNOMIAL);
+        else
+            crc16Arc <<= 1;
+    }
+    
+    return crc16Arc;
+#endif
+}
+
+/****************************************************************************************************
+ * FUNCT:   crc_crc16ArcFinal
+ * BRIEF:   Convert Current CRC-16/ARC After Last Byte To Output Form
+ * RETURN:  uint16_t: CRC-16/ARC
+ * ARG:     crc16Arc: Current CRC-16/ARC From crc_crc16ArcStep
+ ****************************************************************************************************/
+static inline uint16_t crc_crc16ArcFinal(uint16_t crc16Arc)
+{
+#ifdef CRC_CRC16_ARC_LOOP_METHOD
+    /*** Reflect Output (CRC-16/ARC) ***/
+    crc16Arc = crc_inlineReflectU16(crc16Arc);
+#endif
+    
+    return crc16Arc;
+}
+#endif
+
+#if defined(CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_CCITT_FALSE_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crc_crc16CcittFalseStep
+ * BRIEF:   Add One Byte To CRC-16/CCITT-FALSE
+ * RETURN:  uint16_t: Current CRC-16/CCITT-FALSE
+ * ARG:     Data: Data To Add To CRC-16/CCITT-FALSE Calculation
+ * ARG:     crc16CcittFalse: Current CRC-16/CCITT-FALSE
+ ****************************************************************************************************/
+static inline uint16_t crc_crc16CcittFalseStep(const uint8_t Data, uint16_t crc16CcittFalse)
+{
+#if defined(CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD) && defined(CRC_CRC16_CCITT_FALSE_LOOP_METHOD)
+  #error CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD And CRC_CRC16_CCITT_FALSE_LOOP_METHOD Cannot Both Be Defined
+#elif defined(CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD) 
+    /*** Calculate Partial CRC-16/CCITT-FALSE ***/
+    crc16CcittFalse = (uint16_t)((crc16CcittFalse << 8) ^ crc_inlineCrc16CcittFalseLookupTable[(uint8_t)(Data ^ (crc16CcittFalse >> 8))]);
+    return crc16CcittFalse;
+#elif defined(CRC_CRC16_CCITT_FALSE_LOOP_METHOD)
+    uint8_t bit;
+    
+    /*** Calculate Partial CRC-16/CCITT-FALSE ***/
+    crc16CcittFalse ^= (Data << 8);
+    for(bit = 0; bit < 8; bit++)
+    {
+        if((crc16CcittFalse & 0x8000) == 0x8000)
+            crc16CcittFalse = (uint16_t)((crc16CcittFalse << 1) ^ CRC_INLINE_CRC16_CCITT_FALSE_POLYNOMIAL);
+        else
+            crc16CcittFalse <<= 1;
+    }
+    
+    return crc16CcittFalse;
+#endif
+}
+#endif
+
+#ifdef CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD
+/****************************************************************************************************
+ * FUNCT:   crc_crc8DvbS2CalculateBbHeader
+ * BRIEF:   Calculate Full CRC-8/DVB-S2 Of DVB-S2 Baseband Header
+ * RETURN:  uint8_t: CRC-8/DVB-S2
+ * ARG:     Data: Data Buffer Of CRC_CRC8_DVB_S2_BBHEADER_LENGTH Bytes (Not NULL)
+ * NOTE:    Fully Unrolled For The Constant Length; Calculate Selects It Automatically
+ ****************************************************************************************************/
+static inline uint8_t crc_crc8DvbS2CalculateBbHeader(const uint8_t * const Data)
+{
+    uint8_t crc8DvbS2 = CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2;
+    uint16_t i;
+    
+    /*** Calculate Full CRC-8/DVB-S2 ***/
+    CRC_INLINE_UNROLL(10)
+    for(i = 0; i < CRC_CRC8_DVB_S2_BBHEADER_LENGTH; i++)
+        crc8DvbS2 = crc_crc8DvbS2Step(Data[i], crc8DvbS2);
+    
+    return crc8DvbS2;
+}
+#endif
+
+#ifdef CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD
+/****************************************************************************************************
+ * FUNCT:   crc_crc8DvbS2CalculateTsPacket
+ * BRIEF:   Calculate Full CRC-8/DVB-S2 Of Transport Stream Packet
+ * RETURN:  uint8_t: CRC-8/DVB-S2
+ * ARG:     Data: Data Buffer Of CRC_CRC8_DVB_S2_TS_PACKET_LENGTH Bytes (Not NULL)
+ * NOTE:    Unrolled By 4 (188 = 4 x 47, No Remainder) So Inlined Call Sites Stay Small; Calculate
+ *          Selects It Automatically
+ ****************************************************************************************************/
+static inline uint8_t crc_crc8DvbS2CalculateTsPacket(const uint8_t * const Data)
+{
+    uint8_t crc8DvbS2 = CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2;
+    uint16_t i;
+    
+    /*** Calculate Full CRC-8/DVB-S2 ***/
+    CRC_INLINE_UNROLL(4)
+    for(i = 0; i < CRC_CRC8_DVB_S2_TS_PACKET_LENGTH; i++)
+        crc8DvbS2 = crc_crc8DvbS2Step(Data[i], crc8DvbS2);
+    
+    return crc8DvbS2;
+}
+#endif
+
+#ifdef CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD
+/****************************************************************************************************
+ * FUNCT:   crc_crc8MaximCalculateRomId
+ * BRIEF:   Calculate Full CRC-8/MAXIM Of 1-Wire ROM ID
+ * RETURN:  uint8_t: CRC-8/MAXIM
+ * ARG:     Data: Data Buffer Of CRC_CRC8_MAXIM_ROM_ID_LENGTH Bytes (Not NULL)
+ * NOTE:    Fully Unrolled For The Constant Length; Calculate Selects It Automatically
+ ****************************************************************************************************/
+static inline uint8_t crc_crc8MaximCalculateRomId(const uint8_t * const Data)
+{
+    uint8_t crc8Maxim = CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM;
+    uint16_t i;
+    
+    /*** Calculate Full CRC-8/MAXIM ***/
+    CRC_INLINE_UNROLL(8)
+    for(i = 0; i < CRC_CRC8_MAXIM_ROM_ID_LENGTH; i++)
+        crc8Maxim = crc_crc8MaximStep(Data[i], crc8Maxim);
+    
+    return crc8Maxim;
+}
+#endif
+
+#endif
@@ -0,0 +1,885 @@
+/****************************************************************************************************
+ * FILE:    crc_benchmark.c
+ * BRIEF:   CRC Throughput Benchmark Tool Source File
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Definitions
+ ****************************************************************************************************/
+
+#define CRC_BENCHMARK_ALIGNMENT      (64)
+#define CRC_BENCHMARK_CHUNK_LENGTH   (32768)
+#define CRC_BENCHMARK_COLD_RUNS      (5)
+#define CRC_BENCHMARK_EVICT_LENGTH   (64UL * 1024UL * 1024UL)
+#define CRC_BENCHMARK_MAXIMUM_LENGTH (64UL * 1024UL * 1024UL)
+#define CRC_BENCHMARK_MINIMUM_TIME   (10UL)
+#define CRC_BENCHMARK_MAXIMUM_RAW    (4)
+
+/*** Method ***/
+#if defined(CRC_CRC8_LOOKUP_TABLE_METHOD)
+  #define CRC_BENCHMARK_CRC8_METHOD "lookup_table"
+#else
+  #define CRC_BENCHMARK_CRC8_METHOD "loop"
+#endif
+#if defined(CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD)
+  #define CRC_BENCHMARK_CRC8_CDMA2000_METHOD "lookup_table"
+#else
+  #define CRC_BENCHMARK_CRC8_CDMA2000_METHOD "loop"
+#endif
+#if defined(CRC_CRC8_DARC_LOOKUP_TABLE_METHOD)
+  #define CRC_BENCHMARK_CRC8_DARC_METHOD "lookup_table"
+#else
+  #define CRC_BENCHMARK_CRC8_DARC_METHOD "loop"
+#endif
+#if defined(CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD)
+  #define CRC_BENCHMARK_CRC8_DVB_S2_METHOD "lookup_table"
+#else
+  #define CRC_BENCHMARK_CRC8_DVB_S2_METHOD "loop"
+#endif
+#if defined(CRC_CRC8_EBU_LOOKUP_TABLE_METHOD)
+  #define CRC_BENCHMARK_CRC8_EBU_METHOD "lookup_table"
+#else
+  #define CRC_BENCHMARK_CRC8_EBU_METHOD "loop"
+#endif
+#if defined(CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD)
+  #define CRC_BENCHMARK_CRC8_I_CODE_METHOD "lookup_table"
+#else
+  #define CRC_BENCHMARK_CRC8_I_CODE_METHOD "loop"
+#endif
+#if defined(CRC_CRC8_ITU_LOOKUP_TABLE_METHOD)
+  #define CRC_BENCHMARK_CRC8_ITU_METHOD "lookup_table"
+#else
+  #define CRC_BENCHMARK_CRC8_ITU_METHOD "loop"
+#endif
+#if defined(CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD)
+  #define CRC_BENCHMARK_CRC8_MAXIM_METHOD "lookup_table"
+#else
+  #define CRC_BENCHMARK_CRC8_MAXIM_METHOD "loop"
+#endif
+#if defined(CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD)
+  #define CRC_BENCHMARK_CRC8_ROHC_METHOD "lookup_table"
+#else
+  #define CRC_BENCHMARK_CRC8_ROHC_METHOD "loop"
+#endif
+#if defined(CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD)
+  #define CRC_BENCHMARK_CRC8_WCDMA_METHOD "lookup_table"
+#else
+  #define CRC_BENCHMARK_CRC8_WCDMA_METHOD "loop"
+#endif
+#if defined(CRC_CRC16_ARC_LOOKUP_TABLE_METHOD)
+  #define CRC_BENCHMARK_CRC16_ARC_METHOD "lookup_table"
+#else
+  #define CRC_BENCHMARK_CRC16_ARC_METHOD "loop"
+#endif
+#if defined(CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD)
+  #define CRC_BENCHMARK_CRC16_CCITT_FALSE_METHOD "lookup_table"
+#else
+  #define CRC_BENCHMARK_CRC16_CCITT_FALSE_METHOD "loop"
+#endif
+
+/*** Timestamp Counter ***/
+#if defined(__x86_64__) || defined(__i386__)
+  #define CRC_BENCHMARK_TSC
+#endif
+
+/*** Performance Counters ***/
+#ifdef __linux__
+  #define CRC_BENCHMARK_PERF
+#endif
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "crc.h"
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#ifdef CRC_BENCHMARK_TSC
+  #include <x86intrin.h>
+#endif
+#ifdef CRC_BENCHMARK_PERF
+  #include <linux/perf_event.h>
+  #include <sys/ioctl.h>
+  #include <sys/syscall.h>
+  #include <unistd.h>
+#endif
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+/*** Counter ***/
+typedef enum
+{
+    CRC_BENCHMARK_COUNTER_CYCLES,
+    CRC_BENCHMARK_COUNTER_INSTRUCTIONS,
+    CRC_BENCHMARK_COUNTER_L1D_MISSES,
+    CRC_BENCHMARK_COUNTER_BRANCH_MISSES,
+    CRC_BENCHMARK_COUNTER_RAW,
+    CRC_BENCHMARK_COUNTER_COUNT = CRC_BENCHMARK_COUNTER_RAW + CRC_BENCHMARK_MAXIMUM_RAW
+} crc_benchmark_counter_t;
+
+/*** Kernel ***/
+typedef struct
+{
+    crc_variant_t variant;                                                        // Variant
+    uint32_t reserved;                                                            // Explicit Padding
+    const char *method;                                                           // Compiled Method
+    uint16_t (*calculate)(const uint8_t * const Data, const uint16_t DataLength); // Calculate Kernel
+} crc_benchmark_kernel_t;
+
+/*** Measurement ***/
+typedef struct
+{
+    uint64_t iterations;                            // Number Of Timed Passes Over The Buffer
+    uint64_t nanoseconds;                           // Elapsed Wall-Clock Time
+    uint64_t cycles;                                // Elapsed Timestamp Counter Cycles (0 If Unavailable)
+    uint64_t counter[CRC_BENCHMARK_COUNTER_COUNT];  // Performance Counter Totals (Scaled If Multiplexed)
+    bool counted[CRC_BENCHMARK_COUNTER_COUNT];      // True If The Counter Ran During The Measurement
+} crc_benchmark_measurement_t;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+#if defined(CRC_CRC8_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_LOOP_METHOD)
+  static uint16_t crcBenchmark_crc8Calculate(const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_CDMA2000_LOOP_METHOD)
+  static uint16_t crcBenchmark_crc8Cdma2000Calculate(const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC8_DARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DARC_LOOP_METHOD)
+  static uint16_t crcBenchmark_crc8DarcCalculate(const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DVB_S2_LOOP_METHOD)
+  static uint16_t crcBenchmark_crc8DvbS2Calculate(const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC8_EBU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_EBU_LOOP_METHOD)
+  static uint16_t crcBenchmark_crc8EbuCalculate(const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_I_CODE_LOOP_METHOD)
+  static uint16_t crcBenchmark_crc8ICodeCalculate(const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC8_ITU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ITU_LOOP_METHOD)
+  static uint16_t crcBenchmark_crc8ItuCalculate(const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_MAXIM_LOOP_METHOD)
+  static uint16_t crcBenchmark_crc8MaximCalculate(const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ROHC_LOOP_METHOD)
+  static uint16_t crcBenchmark_crc8RohcCalculate(const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_WCDMA_LOOP_METHOD)
+  static uint16_t crcBenchmark_crc8WcdmaCalculate(const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC16_ARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_ARC_LOOP_METHOD)
+  static uint16_t crcBenchmark_crc16ArcCalculate(const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_CCITT_FALSE_LOOP_METHOD)
+  static uint16_t crcBenchmark_crc16CcittFalseCalculate(const uint8_t * const Data, const uint16_t DataLength);
+#endif
+static void crcBenchmark_counterClose(void);
+static void crcBenchmark_counterOpen(void);
+static void crcBenchmark_counterStart(void);
+static void crcBenchmark_counterStop(crc_benchmark_measurement_t * const measurement);
+static uint64_t crcBenchmark_cycles(void);
+static void crcBenchmark_evict(uint8_t * const evict, const size_t EvictLength);
+static void crcBenchmark_measureCold(const crc_benchmark_kernel_t * const Kernel, const uint8_t * const Data, const size_t Length, uint8_t * const evict, const size_t EvictLength, crc_benchmark_measurement_t * const measurement);
+static void crcBenchmark_measureWarm(const crc_benchmark_kernel_t * const Kernel, const uint8_t * const Data, const size_t Length, const uint64_t MinimumTime, crc_benchmark_measurement_t * const measurement);
+static uint64_t crcBenchmark_nanoseconds(void);
+static void crcBenchmark_print(const crc_benchmark_kernel_t * const Kernel, const size_t Length, const bool Cold, const size_t Offset, const crc_benchmark_measurement_t * const Measurement, const bool First);
+static void crcBenchmark_run(const crc_benchmark_kernel_t * const Kernel, const uint8_t * const Data, const size_t Length);
+static void crcBenchmark_usage(const char * const Name);
+
+/****************************************************************************************************
+ * Constants
+ ****************************************************************************************************/
+
+/*** Counter ***/
+static const char * const crcBenchmark_counterName[CRC_BENCHMARK_COUNTER_RAW] =
+{
+    "cycles",
+    "instructions",
+    "l1dMisses",
+    "branchMisses"
+};
+
+/*** Kernel ***/
+static const crc_benchmark_kernel_t crcBenchmark_kernel[] =
+{
+#if defined(CRC_CRC8_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_LOOP_METHOD)
+    {CRC_VARIANT_CRC8, 0, CRC_BENCHMARK_CRC8_METHOD, crcBenchmark_crc8Calculate},
+#endif
+#if defined(CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_CDMA2000_LOOP_METHOD)
+    {CRC_VARIANT_CRC8_CDMA2000, 0, CRC_BENCHMARK_CRC8_CDMA2000_METHOD, crcBenchmark_crc8Cdma2000Calculate},
+#endif
+#if defined(CRC_CRC8_DARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DARC_LOOP_METHOD)
+    {CRC_VARIANT_CRC8_DARC, 0, CRC_BENCHMARK_CRC8_DARC_METHOD, crcBenchmark_crc8DarcCalculate},
+#endif
+#if defined(CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DVB_S2_LOOP_METHOD)
+    {CRC_VARIANT_CRC8_DVB_S2, 0, CRC_BENCHMARK_CRC8_DVB_S2_METHOD, crcBenchmark_crc8DvbS2Calculate},
+#endif
+#if defined(CRC_CRC8_EBU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_EBU_LOOP_METHOD)
+    {CRC_VARIANT_CRC8_EBU, 0, CRC_BENCHMARK_CRC8_EBU_METHOD, crcBenchmark_crc8EbuCalculate},
+#endif
+#if defined(CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_I_CODE_LOOP_METHOD)
+    {CRC_VARIANT_CRC8_I_CODE, 0, CRC_BENCHMARK_CRC8_I_CODE_METHOD, crcBenchmark_crc8ICodeCalculate},
+#endif
+#if defined(CRC_CRC8_ITU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ITU_LOOP_METHOD)
+    {CRC_VARIANT_CRC8_ITU, 0, CRC_BENCHMARK_CRC8_ITU_METHOD, crcBenchmark_crc8ItuCalculate},
+#endif
+#if defined(CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_MAXIM_LOOP_METHOD)
+    {CRC_VARIANT_CRC8_MAXIM, 0, CRC_BENCHMARK_CRC8_MAXIM_METHOD, crcBenchmark_crc8MaximCalculate},
+#endif
+#if defined(CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ROHC_LOOP_METHOD)
+    {CRC_VARIANT_CRC8_ROHC, 0, CRC_BENCHMARK_CRC8_ROHC_METHOD, crcBenchmark_crc8RohcCalculate},
+#endif
+#if defined(CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_WCDMA_LOOP_METHOD)
+    {CRC_VARIANT_CRC8_WCDMA, 0, CRC_BENCHMARK_CRC8_WCDMA_METHOD, crcBenchmark_crc8WcdmaCalculate},
+#endif
+#if defined(CRC_CRC16_ARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_ARC_LOOP_METHOD)
+    {CRC_VARIANT_CRC16_ARC, 0, CRC_BENCHMARK_CRC16_ARC_METHOD, crcBenchmark_crc16ArcCalculate},
+#endif
+#if defined(CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_CCITT_FALSE_LOOP_METHOD)
+    {CRC_VARIANT_CRC16_CCITT_FALSE, 0, CRC_BENCHMARK_CRC16_CCITT_FALSE_METHOD, crcBenchmark_crc16CcittFalseCalculate},
+#endif
+};
+
+/****************************************************************************************************
+ * Variables
+ ****************************************************************************************************/
+
+/*** Result Sink (Keeps Kernels From Being Optimized Away) ***/
+static volatile uint16_t crcBenchmark_sink;
+
+/*** Performance Counters ***/
+static int crcBenchmark_counterFd[CRC_BENCHMARK_COUNTER_COUNT];
+static uint64_t crcBenchmark_rawConfig[CRC_BENCHMARK_MAXIMUM_RAW];
+static size_t crcBenchmark_rawCount;
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   main
+ * BRIEF:   CRC Throughput Benchmark Tool Main Entry
+ * RETURN:  int: Success Or Failure Status
+ * ARG:     argc: Number Of Arguments
+ * ARG:     argv: Argument String List
+ * NOTE:    Command Line Options:
+ *              -s [bytes]: Largest Message Length (Default: 64 MiB; Lengths Step By Powers Of 4 From 1)
+ *              -m [milliseconds]: Minimum Timed Duration Per Warm Measurement (Default: 10)
+ *              -e [bytes]: Cold Cache Eviction Buffer Length (Default: 64 MiB)
+ *              -r [config]: Also Count Raw PMU Event [config] (Repeatable Up To
+ *                  CRC_BENCHMARK_MAXIMUM_RAW Times; E.g. 0x01A1 Is Port 0 Dispatch On Skylake)
+ *              [variant]: Preset Name To Benchmark (Default: All Compiled)
+ *          Results Are Written To Standard Output As JSON; Each Length Is Measured Warm And Cold
+ *          (Caches Flushed By The Eviction Buffer Before Every Pass) With Both A Cache Line Aligned
+ *          And A Misaligned (Offset 1) Buffer. Performance Counters (Linux perf_event_open, User
+ *          Mode Only) Are Reported Per Byte, Or As null Where The PMU Or Permissions Deny Them.
+ ****************************************************************************************************/
+int main(int argc, const char *argv[])
+{
+    static const size_t Offset[] = {0, 1};
+    crc_benchmark_measurement_t measurement;
+    uint8_t *buffer, *evict;
+    uint32_t variants = 0;
+    unsigned long maximumLength = CRC_BENCHMARK_MAXIMUM_LENGTH, minimumTime = CRC_BENCHMARK_MINIMUM_TIME, evictLength = CRC_BENCHMARK_EVICT_LENGTH;
+    size_t i, k, length, o;
+    bool first = true;
+    uint8_t v;
+    int a;
+    
+    /*** Parse Arguments ***/
+    for(a = 1; a < argc; a++)
+    {
+        if((strcmp(argv[a], "-s") == 0) && ((a + 1) < argc))
+        {
+            maximumLength = strtoul(argv[++a], NULL, 0);
+        }
+        else if((strcmp(argv[a], "-m") == 0) && ((a + 1) < argc))
+        {
+            minimumTime = strtoul(argv[++a], NULL, 0);
+        }
+        else if((strcmp(argv[a], "-e") == 0) && ((a + 1) < argc))
+        {
+            evictLength = strtoul(argv[++a], NULL, 0);
+        }
+        else if((strcmp(argv[a], "-r") == 0) && ((a + 1) < argc) && (crcBenchmark_rawCount < CRC_BENCHMARK_MAXIMUM_RAW))
+        {
+            crcBenchmark_rawConfig[crcBenchmark_rawCount++] = strtoull(argv[++a], NULL, 0);
+        }
+        else
+        {
+            for(v = 0; (v < CRC_VARIANT_COUNT) && (strcmp(argv[a], crc_variantName((crc_variant_t)v)) != 0); v++)
+                continue;
+            if(v == CRC_VARIANT_COUNT)
+            {
+                crcBenchmark_usage(argv[0]);
+                return EXIT_FAILURE;
+            }
+            variants |= CRC_VARIANT_MASK(v);
+        }
+    }
+    if((maximumLength == 0) || (evictLength == 0))
+    {
+        crcBenchmark_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    if(variants == 0)
+        variants = CRC_VARIANT_MASK(CRC_VARIANT_COUNT) - 1U;
+    
+    /*** Allocate Cache Line Aligned Buffers ***/
+    if(posix_memalign((void **)&buffer, CRC_BENCHMARK_ALIGNMENT, maximumLength + CRC_BENCHMARK_ALIGNMENT) != 0)
+        return EXIT_FAILURE;
+    if(posix_memalign((void **)&evict, CRC_BENCHMARK_ALIGNMENT, evictLength) != 0)
+    {
+        free(buffer);
+        return EXIT_FAILURE;
+    }
+    for(i = 0; i < (maximumLength + CRC_BENCHMARK_ALIGNMENT); i++)
+        buffer[i] = (uint8_t)((i * 0x9DU) ^ (i >> 8));
+    (void)memset(evict, 0, evictLength);
+    crcBenchmark_counterOpen();
+    
+    /*** Measure Every Kernel, Length, Cache State And Alignment ***/
+    printf("{\n  \"timer\": \"%s\",\n  \"results\": [", (crcBenchmark_cycles() != 0) ? "tsc" : "none");
+    for(k = 0; k < (sizeof(crcBenchmark_kernel) / sizeof(crcBenchmark_kernel[0])); k++)
+    {
+        if((variants & CRC_VARIANT_MASK(crcBenchmark_kernel[k].variant)) == 0)
+            continue;
+        for(length = 1; length <= maximumLength; length *= 4)
+        {
+            for(o = 0; o < (sizeof(Offset) / sizeof(Offset[0])); o++)
+            {
+                crcBenchmark_measureWarm(&crcBenchmark_kernel[k], &buffer[Offset[o]], length, (uint64_t)minimumTime * 1000000ULL, &measurement);
+                crcBenchmark_print(&crcBenchmark_kernel[k], length, false, Offset[o], &measurement, first);
+                first = false;
+                crcBenchmark_measureCold(&crcBenchmark_kernel[k], &buffer[Offset[o]], length, evict, evictLength, &measurement);
+                crcBenchmark_print(&crcBenchmark_kernel[k], length, true, Offset[o], &measurement, first);
+            }
+        }
+    }
+    printf("\n  ]\n}\n");
+    
+    crcBenchmark_counterClose();
+    free(evict);
+    free(buffer);
+    
+    return EXIT_SUCCESS;
+}
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+#if defined(CRC_CRC8_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcBenchmark_crc8Calculate
+ * BRIEF:   CRC-8 Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcBenchmark_crc8Calculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8Calculate(Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_CDMA2000_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcBenchmark_crc8Cdma2000Calculate
+ * BRIEF:   CRC-8/CDMA2000 Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcBenchmark_crc8Cdma2000Calculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8Cdma2000Calculate(Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC8_DARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DARC_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcBenchmark_crc8DarcCalculate
+ * BRIEF:   CRC-8/DARC Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcBenchmark_crc8DarcCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8DarcCalculate(Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DVB_S2_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcBenchmark_crc8DvbS2Calculate
+ * BRIEF:   CRC-8/DVB-S2 Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcBenchmark_crc8DvbS2Calculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8DvbS2Calculate(Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC8_EBU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_EBU_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcBenchmark_crc8EbuCalculate
+ * BRIEF:   CRC-8/EBU Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcBenchmark_crc8EbuCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8EbuCalculate(Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_I_CODE_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcBenchmark_crc8ICodeCalculate
+ * BRIEF:   CRC-8/I-CODE Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcBenchmark_crc8ICodeCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8ICodeCalculate(Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC8_ITU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ITU_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcBenchmark_crc8ItuCalculate
+ * BRIEF:   CRC-8/ITU Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcBenchmark_crc8ItuCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8ItuCalculate(Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_MAXIM_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcBenchmark_crc8MaximCalculate
+ * BRIEF:   CRC-8/MAXIM Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcBenchmark_crc8MaximCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8MaximCalculate(Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ROHC_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcBenchmark_crc8RohcCalculate
+ * BRIEF:   CRC-8/ROHC Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcBenchmark_crc8RohcCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8RohcCalculate(Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_WCDMA_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcBenchmark_crc8WcdmaCalculate
+ * BRIEF:   CRC-8/WCDMA Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcBenchmark_crc8WcdmaCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8WcdmaCalculate(Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC16_ARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_ARC_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcBenchmark_crc16ArcCalculate
+ * BRIEF:   CRC-16/ARC Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcBenchmark_crc16ArcCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc16ArcCalculate(Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_CCITT_FALSE_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcBenchmark_crc16CcittFalseCalculate
+ * BRIEF:   CRC-16/CCITT-FALSE Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcBenchmark_crc16CcittFalseCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc16CcittFalseCalculate(Data, DataLength);
+}
+#endif
+
+/****************************************************************************************************
+ * FUNCT:   crcBenchmark_counterClose
+ * BRIEF:   Close Performance Counters
+ * RETURN:  void: Returns Nothing
+ ****************************************************************************************************/
+static void crcBenchmark_counterClose(void)
+{
+#ifdef CRC_BENCHMARK_PERF
+    size_t c;
+    
+    /*** Close Open Counters ***/
+    for(c = 0; c < CRC_BENCHMARK_COUNTER_COUNT; c++)
+    {
+        if(crcBenchmark_counterFd[c] >= 0)
+            (void)close(crcBenchmark_counterFd[c]);
+        crcBenchmark_counterFd[c] = -1;
+    }
+#endif
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcBenchmark_counterOpen
+ * BRIEF:   Open Performance Counters For This Thread
+ * RETURN:  void: Returns Nothing
+ * NOTE:    Each Counter Is Opened On Its Own, So A Counter The PMU Lacks (Or A Virtual Machine Hides)
+ *          Is Reported As null Without Losing The Rest.
+ ****************************************************************************************************/
+static void crcBenchmark_counterOpen(void)
+{
+#ifdef CRC_BENCHMARK_PERF
+    struct perf_event_attr attribute;
+    size_t c;
+    
+    /*** Open Each Counter Disabled, User Mode Only ***/
+    for(c = 0; c < CRC_BENCHMARK_COUNTER_COUNT; c++)
+    {
+        crcBenchmark_counterFd[c] = -1;
+        (void)memset(&attribute, 0, sizeof(attribute));
+        attribute.size = sizeof(attribute);
+        attribute.disabled = 1;
+        attribute.exclude_kernel = 1;
+        attribute.exclude_hv = 1;
+        attribute.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        switch(c)
+        {
+            case CRC_BENCHMARK_COUNTER_CYCLES:
+                attribute.type = PERF_TYPE_HARDWARE;
+                attribute.config = PERF_COUNT_HW_CPU_CYCLES;
+                break;
+            case CRC_BENCHMARK_COUNTER_INSTRUCTIONS:
+                attribute.type = PERF_TYPE_HARDWARE;
+                attribute.config = PERF_COUNT_HW_INSTRUCTIONS;
+                break;
+            case CRC_BENCHMARK_COUNTER_L1D_MISSES:
+                attribute.type = PERF_TYPE_HW_CACHE;
+                attribute.config = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+                break;
+            case CRC_BENCHMARK_COUNTER_BRANCH_MISSES:
+                attribute.type = PERF_TYPE_HARDWARE;
+                attribute.config = PERF_COUNT_HW_BRANCH_MISSES;
+                break;
+            default:
+                if((c - CRC_BENCHMARK_COUNTER_RAW) >= crcBenchmark_rawCount)
+                    continue;
+                attribute.type = PERF_TYPE_RAW;
+                attribute.config = crcBenchmark_rawConfig[c - CRC_BENCHMARK_COUNTER_RAW];
+                break;
+        }
+        crcBenchmark_counterFd[c] = (int)syscall(SYS_perf_event_open, &attribute, 0, -1, -1, 0);
+    }
+#endif
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcBenchmark_counterStart
+ * BRIEF:   Reset And Enable Performance Counters
+ * RETURN:  void: Returns Nothing
+ ****************************************************************************************************/
+static void crcBenchmark_counterStart(void)
+{
+#ifdef CRC_BENCHMARK_PERF
+    size_t c;
+    
+    /*** Reset And Enable Open Counters ***/
+    for(c = 0; c < CRC_BENCHMARK_COUNTER_COUNT; c++)
+    {
+        if(crcBenchmark_counterFd[c] < 0)
+            continue;
+        (void)ioctl(crcBenchmark_counterFd[c], PERF_EVENT_IOC_RESET, 0);
+        (void)ioctl(crcBenchmark_counterFd[c], PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcBenchmark_counterStop
+ * BRIEF:   Disable And Read Performance Counters
+ * RETURN:  void: Returns Nothing
+ * ARG:     measurement: Measurement To Receive Counter Totals
+ * NOTE:    Totals Are Scaled By Enabled / Running Time When The Kernel Multiplexed The PMU.
+ ****************************************************************************************************/
+static void crcBenchmark_counterStop(crc_benchmark_measurement_t * const measurement)
+{
+    size_t c;
+#ifdef CRC_BENCHMARK_PERF
+    uint64_t value[3];
+    
+    /*** Disable All First So Every Counter Covers The Same Window ***/
+    for(c = 0; c < CRC_BENCHMARK_COUNTER_COUNT; c++)
+    {
+        if(crcBenchmark_counterFd[c] >= 0)
+            (void)ioctl(crcBenchmark_counterFd[c], PERF_EVENT_IOC_DISABLE, 0);
+    }
+    
+    /*** Read Value, Time Enabled And Time Running ***/
+    for(c = 0; c < CRC_BENCHMARK_COUNTER_COUNT; c++)
+    {
+        measurement->counted[c] = (crcBenchmark_counterFd[c] >= 0) && (read(crcBenchmark_counterFd[c], value, sizeof(value)) == (ssize_t)sizeof(value)) && (value[2] != 0);
+        measurement->counter[c] = measurement->counted[c] ? (uint64_t)((double)value[0] * ((double)value[1] / (double)value[2])) : 0;
+    }
+#else
+    
+    /*** No Counters On This Platform ***/
+    for(c = 0; c < CRC_BENCHMARK_COUNTER_COUNT; c++)
+    {
+        measurement->counted[c] = false;
+        measurement->counter[c] = 0;
+    }
+#endif
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcBenchmark_cycles
+ * BRIEF:   Read Timestamp Counter
+ * RETURN:  uint64_t: Timestamp Counter (0 If Unavailable)
+ * NOTE:    The Timestamp Counter Ticks At The Nominal (Reference) Frequency, Not The Core Clock.
+ ****************************************************************************************************/
+static uint64_t crcBenchmark_cycles(void)
+{
+#ifdef CRC_BENCHMARK_TSC
+    return (uint64_t)__rdtsc();
+#else
+    return 0;
+#endif
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcBenchmark_evict
+ * BRIEF:   Flush Caches By Dirtying Every Line Of The Eviction Buffer
+ * RETURN:  void: Returns Nothing
+ * ARG:     evict: Eviction Buffer (Should Exceed The Last Level Cache)
+ * ARG:     EvictLength: Eviction Buffer Length
+ ****************************************************************************************************/
+static void crcBenchmark_evict(uint8_t * const evict, const size_t EvictLength)
+{
+    size_t i;
+    
+    /*** Read-Modify-Write One Byte Per Cache Line ***/
+    for(i = 0; i < EvictLength; i += CRC_BENCHMARK_ALIGNMENT)
+        evict[i]++;
+    crcBenchmark_sink = (uint16_t)(crcBenchmark_sink ^ evict[0]);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcBenchmark_measureCold
+ * BRIEF:   Measure Single Passes With Caches Flushed Before Each
+ * RETURN:  void: Returns Nothing
+ * ARG:     Kernel: Kernel To Measure
+ * ARG:     Data: Message
+ * ARG:     Length: Message Length
+ * ARG:     evict: Eviction Buffer
+ * ARG:     EvictLength: Eviction Buffer Length
+ * ARG:     measurement: Median Of CRC_BENCHMARK_COLD_RUNS Passes
+ ****************************************************************************************************/
+static void crcBenchmark_measureCold(const crc_benchmark_kernel_t * const Kernel, const uint8_t * const Data, const size_t Length, uint8_t * const evict, const size_t EvictLength, crc_benchmark_measurement_t * const measurement)
+{
+    crc_benchmark_measurement_t run[CRC_BENCHMARK_COLD_RUNS], swap;
+    uint64_t cycles, nanoseconds;
+    size_t i, j;
+    
+    /*** Time Each Pass From A Flushed Cache ***/
+    for(i = 0; i < CRC_BENCHMARK_COLD_RUNS; i++)
+    {
+        crcBenchmark_evict(evict, EvictLength);
+        nanoseconds = crcBenchmark_nanoseconds();
+        cycles = crcBenchmark_cycles();
+        crcBenchmark_counterStart();
+        crcBenchmark_run(Kernel, Data, Length);
+        crcBenchmark_counterStop(&run[i]);
+        run[i].cycles = crcBenchmark_cycles() - cycles;
+        run[i].nanoseconds = crcBenchmark_nanoseconds() - nanoseconds;
+        run[i].iterations = 1;
+    }
+    
+    /*** Keep The Median Pass ***/
+    for(i = 1; i < CRC_BENCHMARK_COLD_RUNS; i++)
+    {
+        for(j = i; (j > 0) && (run[j - 1].nanoseconds > run[j].nanoseconds); j--)
+        {
+            swap = run[j];
+            run[j] = run[j - 1];
+            run[j - 1] = swap;
+        }
+    }
+    *measurement = run[CRC_BENCHMARK_COLD_RUNS / 2];
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcBenchmark_measureWarm
+ * BRIEF:   Measure Repeated Passes Over A Cached Buffer
+ * RETURN:  void: Returns Nothing
+ * ARG:     Kernel: Kernel To Measure
+ * ARG:     Data: Message
+ * ARG:     Length: Message Length
+ * ARG:     MinimumTime: Minimum Timed Duration (Nanoseconds)
+ * ARG:     measurement: Measurement Of The First Batch Lasting At Least MinimumTime
+ * NOTE:    The Batch Size Doubles Until The Timed Duration Is Long Enough To Swamp Timer Overhead.
+ ****************************************************************************************************/
+static void crcBenchmark_measureWarm(const crc_benchmark_kernel_t * const Kernel, const uint8_t * const Data, const size_t Length, const uint64_t MinimumTime, crc_benchmark_measurement_t * const measurement)
+{
+    uint64_t cycles, i, nanoseconds;
+    
+    /*** Warm Up Caches And Branch Predictors ***/
+    crcBenchmark_run(Kernel, Data, Length);
+    
+    /*** Double Batch Size Until Long Enough ***/
+    measurement->iterations = 1;
+    for(;;)
+    {
+        nanoseconds = crcBenchmark_nanoseconds();
+        cycles = crcBenchmark_cycles();
+        crcBenchmark_counterStart();
+        for(i = 0; i < measurement->iterations; i++)
+            crcBenchmark_run(Kernel, Data, Length);
+        crcBenchmark_counterStop(measurement);
+        measurement->cycles = crcBenchmark_cycles() - cycles;
+        measurement->nanoseconds = crcBenchmark_nanoseconds() - nanoseconds;
+        if(measurement->nanoseconds >= MinimumTime)
+            break;
+        measurement->iterations *= 2;
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcBenchmark_nanoseconds
+ * BRIEF:   Read Monotonic Clock
+ * RETURN:  uint64_t: Monotonic Time (Nanoseconds)
+ ****************************************************************************************************/
+static uint64_t crcBenchmark_nanoseconds(void)
+{
+    struct timespec now;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    
+    return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcBenchmark_print
+ * BRIEF:   Print Measurement As A JSON Result Object
+ * RETURN:  void: Returns Nothing
+ * ARG:     Kernel: Measured Kernel
+ * ARG:     Length: Message Length
+ * ARG:     Cold: True If Caches Were Flushed Before Each Pass
+ * ARG:     Offset: Buffer Offset From Cache Line Alignment
+ * ARG:     Measurement: Measurement To Print
+ * ARG:     First: True If This Is The First Result (No Leading Separator)
+ * NOTE:    Counters Are Printed Per Byte; cycles Counts Core Clocks, Unlike The Reference Clocked
+ *          cyclesPerByte From The Timestamp Counter.
+ ****************************************************************************************************/
+static void crcBenchmark_print(const crc_benchmark_kernel_t * const Kernel, const size_t Length, const bool Cold, const size_t Offset, const crc_benchmark_measurement_t * const Measurement, const bool First)
+{
+    double bytes = (double)Length * (double)Measurement->iterations;
+    size_t c;
+    
+    /*** Print Result Object ***/
+    printf("%s\n    {\"variant\": \"%s\", \"method\": \"%s\", \"length\": %zu, \"cache\": \"%s\", \"offset\": %zu, \"iterations\": %" PRIu64 ", \"nanoseconds\": %" PRIu64 ", ",
+           First ? "" : ",", crc_variantName(Kernel->variant), Kernel->method, Length, Cold ? "cold" : "warm", Offset, Measurement->iterations, Measurement->nanoseconds);
+    if(Measurement->cycles != 0)
+        printf("\"cyclesPerByte\": %.4f, ", (double)Measurement->cycles / bytes);
+    else
+        printf("\"cyclesPerByte\": null, ");
+    printf("\"gigabytesPerSecond\": %.4f, ", (Measurement->nanoseconds != 0) ? (bytes / (double)Measurement->nanoseconds) : 0.0);
+    
+    /*** Print Performance Counters Per Byte ***/
+    printf("\"counters\": {");
+    for(c = 0; c < (CRC_BENCHMARK_COUNTER_RAW + crcBenchmark_rawCount); c++)
+    {
+        if(c < CRC_BENCHMARK_COUNTER_RAW)
+            printf("%s\"%s\": ", (c == 0) ? "" : ", ", crcBenchmark_counterName[c]);
+        else
+            printf(", \"raw:0x%" PRIX64 "\": ", crcBenchmark_rawConfig[c - CRC_BENCHMARK_COUNTER_RAW]);
+        if(Measurement->counted[c])
+            printf("%.4f", (double)Measurement->counter[c] / bytes);
+        else
+            printf("null");
+    }
+    printf("}}");
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcBenchmark_run
+ * BRIEF:   Run Kernel Over Message
+ * RETURN:  void: Returns Nothing
+ * ARG:     Kernel: Kernel To Run
+ * ARG:     Data: Message
+ * ARG:     Length: Message Length
+ * NOTE:    Calculate Takes A 16-Bit Length, So Longer Messages Are Processed As Independent
+ *          CRC_BENCHMARK_CHUNK_LENGTH Chunks (Throughput Is Unaffected; The CRC Is Only A Sink).
+ ****************************************************************************************************/
+static void crcBenchmark_run(const crc_benchmark_kernel_t * const Kernel, const uint8_t * const Data, const size_t Length)
+{
+    size_t chunk, offset;
+    uint16_t crc = 0;
+    
+    /*** Calculate Over Each Chunk ***/
+    for(offset = 0; offset < Length; offset += chunk)
+    {
+        chunk = ((Length - offset) < CRC_BENCHMARK_CHUNK_LENGTH) ? (Length - offset) : CRC_BENCHMARK_CHUNK_LENGTH;
+        crc ^= Kernel->calculate(&Data[offset], (uint16_t)chunk);
+    }
+    crcBenchmark_sink = crc;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcBenchmark_usage
+ * BRIEF:   Print Usage
+ * RETURN:  void: Returns Nothing
+ * ARG:     Name: Program Name
+ ****************************************************************************************************/
+static void crcBenchmark_usage(const char * const Name)
+{
+    /*** Print Usage ***/
+    fprintf(stderr, "Usage: %s [-s bytes] [-m milliseconds] [-e bytes] [-r config ...] [variant ...]\n", Name);
+}
@@ -0,0 +1,412 @@
+/****************************************************************************************************
+ * FILE:    crc_channel.c
+ * BRIEF:   CRC Monte Carlo Channel Simulator Tool Source File
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Definitions
+ ****************************************************************************************************/
+
+#define CRC_CHANNEL_BATCH           (4096)
+#define CRC_CHANNEL_MAXIMUM_ERRORS  (4096)
+#define CRC_CHANNEL_MAXIMUM_THREADS (256)
+#define CRC_CHANNEL_TRAILER_BITS    (16)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "crc.h"
+#include <inttypes.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+/*** Channel ***/
+typedef struct
+{
+    double bitErrorRate; // Bit Error Probability (Good State)
+    double goodToBad;    // Probability Of Good To Bad State Transition Per Bit
+    double badToGood;    // Probability Of Bad To Good State Transition Per Bit
+    double badErrorRate; // Bit Error Probability (Bad State)
+    bool burst;          // Use Gilbert-Elliott Burst Model
+    uint8_t reserved[7]; // Explicit Padding
+} crc_channel_model_t;
+
+/*** Simulation ***/
+typedef struct
+{
+    const crc_channel_model_t *model;            // Channel Model
+    uint32_t variants;                           // Variants To Check (CRC_VARIANT_MASK)
+    crc_model_t variantModel[CRC_VARIANT_COUNT]; // Variant Parameters (Width And Bit Order)
+    uint16_t payloadLength;                      // Payload Length (Bytes)
+    uint16_t reserved;                           // Explicit Padding
+    uint64_t trials;                             // Number Of Frames To Simulate
+    uint64_t seed;                               // Random Seed
+    uint64_t errored[CRC_VARIANT_COUNT];         // Frames With At Least One Bit Error
+    uint64_t undetected[CRC_VARIANT_COUNT];      // Frames With Undetected Errors
+} crc_channel_simulation_t;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static uint32_t crcChannel_errors(const crc_channel_model_t * const Model, uint64_t * const state, const uint32_t BitCount, uint32_t * const position);
+static uint64_t crcChannel_random(uint64_t * const state);
+static double crcChannel_uniform(uint64_t * const state);
+static void crcChannel_usage(const char * const Name);
+static void *crcChannel_worker(void *argument);
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   main
+ * BRIEF:   CRC Monte Carlo Channel Simulator Tool Main Entry
+ * RETURN:  int: Success Or Failure Status
+ * ARG:     argc: Number Of Arguments
+ * ARG:     argv: Argument String List
+ * NOTE:    Command Line Options:
+ *              -n [bytes]: Payload Length In Bytes (Default: 32)
+ *              -N [count]: Number Of Frames (Default: 100000000)
+ *              -b [rate]: Bit Error Rate (Default: 0.001)
+ *              -g [goodToBad]:[badToGood]:[badRate]: Gilbert-Elliott Burst Model (Bit Error Rate Of
+ *                  -b Applies In Good State)
+ *              -s [seed]: Random Seed (Default: 1)
+ *              -t [count]: Simulate With [count] Threads (Default: Number Of Online Processors)
+ *              [variant]: Preset Name To Check (Default: All)
+ ****************************************************************************************************/
+int main(int argc, const char *argv[])
+{
+    static crc_channel_simulation_t simulation[CRC_CHANNEL_MAXIMUM_THREADS];
+    crc_channel_model_t model = {0.001, 0.0, 0.0, 0.0, false, {0}};
+    pthread_t thread[CRC_CHANNEL_MAXIMUM_THREADS];
+    bool created[CRC_CHANNEL_MAXIMUM_THREADS];
+    uint64_t errored, seed = 1, trials = 100000000ULL, undetected;
+    uint32_t variants = 0;
+    unsigned long payloadLength = 32;
+    long t, threadCount;
+    uint8_t v;
+    int a;
+    
+    /*** Parse Arguments ***/
+    threadCount = sysconf(_SC_NPROCESSORS_ONLN);
+    for(a = 1; a < argc; a++)
+    {
+        if((strcmp(argv[a], "-n") == 0) && ((a + 1) < argc))
+        {
+            payloadLength = strtoul(argv[++a], NULL, 0);
+        }
+        else if((strcmp(argv[a], "-N") == 0) && ((a + 1) < argc))
+        {
+            trials = strtoull(argv[++a], NULL, 0);
+        }
+        else if((strcmp(argv[a], "-b") == 0) && ((a + 1) < argc))
+        {
+            model.bitErrorRate = strtod(argv[++a], NULL);
+        }
+        else if((strcmp(argv[a], "-g") == 0) && ((a + 1) < argc))
+        {
+            model.burst = (sscanf(argv[++a], "%lf:%lf:%lf", &model.goodToBad, &model.badToGood, &model.badErrorRate) == 3);
+            if(!model.burst)
+            {
+                crcChannel_usage(argv[0]);
+                return EXIT_FAILURE;
+            }
+        }
+        else if((strcmp(argv[a], "-s") == 0) && ((a + 1) < argc))
+        {
+            seed = strtoull(argv[++a], NULL, 0);
+        }
+        else if((strcmp(argv[a], "-t") == 0) && ((a + 1) < argc))
+        {
+            threadCount = strtol(argv[++a], NULL, 0);
+        }
+        else
+        {
+            for(v = 0; (v < CRC_VARIANT_COUNT) && (strcmp(argv[a], crc_variantName((crc_variant_t)v)) != 0); v++)
+                continue;
+            if(v == CRC_VARIANT_COUNT)
+            {
+                crcChannel_usage(argv[0]);
+                return EXIT_FAILURE;
+            }
+            variants |= CRC_VARIANT_MASK(v);
+        }
+    }
+    if((payloadLength == 0) || (payloadLength > UINT16_MAX) || (trials == 0) ||
+       (model.bitErrorRate < 0.0) || (model.bitErrorRate >= 1.0) || (model.badErrorRate < 0.0) || (model.badErrorRate >= 1.0))
+    {
+        crcChannel_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    if(variants == 0)
+        variants = CRC_VARIANT_MASK(CRC_VARIANT_COUNT) - 1U;
+    if(threadCount < 1)
+        threadCount = 1;
+    else if(threadCount > CRC_CHANNEL_MAXIMUM_THREADS)
+        threadCount = CRC_CHANNEL_MAXIMUM_THREADS;
+    
+    /*** Simulate Across Threads (Independent Random Streams) ***/
+    for(t = 0; t < threadCount; t++)
+    {
+        simulation[t].model = &model;
+        simulation[t].variants = variants;
+        for(v = 0; v < CRC_VARIANT_COUNT; v++)
+            (void)crc_reverseModel((crc_variant_t)v, &simulation[t].variantModel[v]);
+        simulation[t].payloadLength = (uint16_t)payloadLength;
+        simulation[t].trials = (trials / (uint64_t)threadCount) + (((uint64_t)t < (trials % (uint64_t)threadCount)) ? 1U : 0U);
+        simulation[t].seed = seed + (0x9E3779B97F4A7C15ULL * (uint64_t)(t + 1));
+        created[t] = (pthread_create(&thread[t], NULL, crcChannel_worker, &simulation[t]) == 0);
+        if(!created[t])
+            (void)crcChannel_worker(&simulation[t]);
+    }
+    for(t = 0; t < threadCount; t++)
+    {
+        if(created[t])
+            (void)pthread_join(thread[t], NULL);
+    }
+    
+    /*** Report Residual Error Probability Per Variant ***/
+    printf("variant,frames,errored,undetected,p_undetected,p_undetected_given_error\n");
+    for(v = 0; v < CRC_VARIANT_COUNT; v++)
+    {
+        if((variants & CRC_VARIANT_MASK(v)) == 0)
+            continue;
+        errored = undetected = 0;
+        for(t = 0; t < threadCount; t++)
+        {
+            errored += simulation[t].errored[v];
+            undetected += simulation[t].undetected[v];
+        }
+        printf("%s,%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%.6e,%.6e\n", crc_variantName((crc_variant_t)v), trials, errored, undetected, (double)undetected / (double)trials, (errored != 0) ? ((double)undetected / (double)errored) : 0.0);
+    }
+    
+    return EXIT_SUCCESS;
+}
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   crcChannel_errors
+ * BRIEF:   Generate Bit Error Positions For One Frame
+ * RETURN:  uint32_t: Number Of Bit Errors
+ * ARG:     Model: Channel Model
+ * ARG:     state: Random State
+ * ARG:     BitCount: Number Of Bits In Frame
+ * ARG:     position: Bit Error Positions (Ascending, Transmission Order)
+ * NOTE:    Independent Errors Skip Directly To The Next Error (Geometric Gaps), So Error-Free Frames
+ *          Cost One Random Number; The Burst Model Steps The Gilbert-Elliott Chain Per Bit
+ ****************************************************************************************************/
+static uint32_t crcChannel_errors(const crc_channel_model_t * const Model, uint64_t * const state, const uint32_t BitCount, uint32_t * const position)
+{
+    double gap, logGood;
+    uint32_t bit, count = 0;
+    bool bad = false;
+    
+    /*** Independent Bit Errors ***/
+    if(!Model->burst)
+    {
+        if(Model->bitErrorRate <= 0.0)
+            return 0;
+        logGood = log1p(-Model->bitErrorRate);
+        for(gap = floor(log(1.0 - crcChannel_uniform(state)) / logGood); gap < (double)BitCount; gap += 1.0 + floor(log(1.0 - crcChannel_uniform(state)) / logGood))
+        {
+            if(count < CRC_CHANNEL_MAXIMUM_ERRORS)
+                position[count++] = (uint32_t)gap;
+        }
+        return count;
+    }
+    
+    /*** Gilbert-Elliott Burst Errors ***/
+    bad = (crcChannel_uniform(state) < (Model->goodToBad / (Model->goodToBad + Model->badToGood)));
+    for(bit = 0; bit < BitCount; bit++)
+    {
+        if(crcChannel_uniform(state) < (bad ? Model->badErrorRate : Model->bitErrorRate))
+        {
+            if(count < CRC_CHANNEL_MAXIMUM_ERRORS)
+                position[count++] = bit;
+        }
+        if(crcChannel_uniform(state) < (bad ? Model->badToGood : Model->goodToBad))
+            bad = !bad;
+    }
+    
+    return count;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcChannel_random
+ * BRIEF:   Generate 64-Bit Random Number (xoshiro256** Seeded By splitmix64)
+ * RETURN:  uint64_t: Random Number
+ * ARG:     state: Random State (4 Words)
+ ****************************************************************************************************/
+static uint64_t crcChannel_random(uint64_t * const state)
+{
+    uint64_t result, t;
+    
+    /*** Advance Generator ***/
+    result = state[1] * 5;
+    result = ((result << 7) | (result >> 57)) * 9;
+    t = state[1] << 17;
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= t;
+    state[3] = (state[3] << 45) | (state[3] >> 19);
+    
+    return result;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcChannel_uniform
+ * BRIEF:   Generate Uniform Random Number In [0, 1)
+ * RETURN:  double: Random Number
+ * ARG:     state: Random State
+ ****************************************************************************************************/
+static double crcChannel_uniform(uint64_t * const state)
+{
+    /*** Use Top 53 Bits ***/
+    return (double)(crcChannel_random(state) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcChannel_usage
+ * BRIEF:   Print Usage
+ * RETURN:  void: Returns Nothing
+ * ARG:     Name: Program Name
+ ****************************************************************************************************/
+static void crcChannel_usage(const char * const Name)
+{
+    uint8_t v;
+    
+    /*** Print Usage ***/
+    printf("Usage: %s [-n bytes] [-N frames] [-b rate] [-g goodToBad:badToGood:badRate] [-s seed] [-t threads] [variant ...]\n", Name);
+    printf("  Variants:");
+    for(v = 0; v < CRC_VARIANT_COUNT; v++)
+        printf(" %s", crc_variantName((crc_variant_t)v));
+    printf("\n");
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcChannel_worker
+ * BRIEF:   Simulate Frames (Thread Entry)
+ * RETURN:  void *: Returns NULL
+ * ARG:     argument: Simulation (crc_channel_simulation_t)
+ * NOTE:    Errors Are Applied In Each Variant's Transmission Order (Least Significant Bit First If
+ *          Reflected); Each Corrupted Frame Is Checked For Every Variant Of That Order In One
+ *          crc_multiCalculate Pass; Payload Is Redrawn Every CRC_CHANNEL_BATCH Frames
+ ****************************************************************************************************/
+static void *crcChannel_worker(void *argument)
+{
+    crc_channel_simulation_t *simulation = argument;
+    uint16_t clean[CRC_VARIANT_COUNT], crc[CRC_VARIANT_COUNT], trailer[CRC_VARIANT_COUNT];
+    uint32_t order[2] = {0, 0}, *position, bit, bitCount, e, errorCount, i, payloadBits;
+    uint64_t frame, state[4], z;
+    uint8_t *corrupted, *payload, o, v;
+    
+    /*** Set Up ***/
+    payloadBits = (uint32_t)simulation->payloadLength * 8;
+    bitCount = payloadBits + CRC_CHANNEL_TRAILER_BITS;
+    payload = malloc(simulation->payloadLength);
+    corrupted = malloc(simulation->payloadLength);
+    position = malloc(CRC_CHANNEL_MAXIMUM_ERRORS * sizeof(uint32_t));
+    if((payload == NULL) || (corrupted == NULL) || (position == NULL))
+    {
+        free(payload);
+        free(corrupted);
+        free(position);
+        return NULL;
+    }
+    z = simulation->seed;
+    for(i = 0; i < 4; i++)
+    {
+        z += 0x9E3779B97F4A7C15ULL;
+        state[i] = z;
+        state[i] = (state[i] ^ (state[i] >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        state[i] = (state[i] ^ (state[i] >> 27)) * 0x94D049BB133111EBULL;
+        state[i] ^= state[i] >> 31;
+    }
+    for(v = 0; v < CRC_VARIANT_COUNT; v++)
+    {
+        simulation->errored[v] = 0;
+        simulation->undetected[v] = 0;
+        if((simulation->variants & CRC_VARIANT_MASK(v)) != 0)
+            order[simulation->variantModel[v].reflectIn ? 1 : 0] |= CRC_VARIANT_MASK(v);
+    }
+    
+    /*** Simulate Frames ***/
+    for(frame = 0; frame < simulation->trials; frame++)
+    {
+        /* Draw Payload And Its CRCs Once Per Batch */
+        if((frame % CRC_CHANNEL_BATCH) == 0)
+        {
+            for(i = 0; i < simulation->payloadLength; i++)
+                payload[i] = (uint8_t)crcChannel_random(state);
+            crc_multiCalculate(payload, simulation->payloadLength, simulation->variants, clean);
+        }
+    
+        /* Error-Free Frames Cannot Be Undetected Errors */
+        errorCount = crcChannel_errors(simulation->model, state, bitCount, position);
+        if(errorCount == 0)
+            continue;
+    
+        /* Check Frame For Each Transmission Order */
+        for(o = 0; o < 2; o++)
+        {
+            if(order[o] == 0)
+                continue;
+    
+            /* Apply Errors To Payload And CRC Trailers */
+            memcpy(corrupted, payload, simulation->payloadLength);
+            for(v = 0; v < CRC_VARIANT_COUNT; v++)
+                trailer[v] = 0x0000;
+            for(e = 0; e < errorCount; e++)
+            {
+                bit = position[e];
+                if(bit < payloadBits)
+                {
+                    corrupted[bit >> 3] ^= (uint8_t)((o == 1) ? (1U << (bit & 0x07)) : (0x80U >> (bit & 0x07)));
+                    continue;
+                }
+                bit -= payloadBits;
+                for(v = 0; v < CRC_VARIANT_COUNT; v++)
+                {
+                    if(((order[o] & CRC_VARIANT_MASK(v)) != 0) && (bit < simulation->variantModel[v].width))
+                        trailer[v] ^= (uint16_t)((o == 1) ? (1U << bit) : (1U << (simulation->variantModel[v].width - 1 - bit)));
+                }
+            }
+    
+            /* Recalculate CRCs Of All Variants In One Pass */
+            crc_multiCalculate(corrupted, simulation->payloadLength, order[o], crc);
+            for(v = 0; v < CRC_VARIANT_COUNT; v++)
+            {
+                if((order[o] & CRC_VARIANT_MASK(v)) == 0)
+                    continue;
+                if(position[0] >= (payloadBits + simulation->variantModel[v].width))
+                    continue;
+                simulation->errored[v]++;
+                if(crc[v] == (clean[v] ^ trailer[v]))
+                    simulation->undetected[v]++;
+            }
+        }
+    }
+    free(payload);
+    free(corrupted);
+    free(position);
+    
+    return NULL;
+}
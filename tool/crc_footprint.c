@@ -0,0 +1,611 @@
+/****************************************************************************************************
+ * FILE:    crc_footprint.c
+ * BRIEF:   CRC Code Size And Cache Footprint Report Source File
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Definitions
+ ****************************************************************************************************/
+
+#define CRC_FOOTPRINT_DATA_LENGTH (4096)
+#define CRC_FOOTPRINT_DIRECTORY   "../build/footprint"
+#define CRC_FOOTPRINT_PATH_LENGTH (512)
+#define CRC_FOOTPRINT_RUNS        (5)
+#define CRC_FOOTPRINT_RUN_TIME    (20000000ULL) // Nanoseconds
+
+/*** Method ***/
+#if defined(CRC_CRC8_LOOKUP_TABLE_METHOD)
+  #define CRC_FOOTPRINT_CRC8_METHOD "lookup_table"
+#else
+  #define CRC_FOOTPRINT_CRC8_METHOD "loop"
+#endif
+#if defined(CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD)
+  #define CRC_FOOTPRINT_CRC8_CDMA2000_METHOD "lookup_table"
+#else
+  #define CRC_FOOTPRINT_CRC8_CDMA2000_METHOD "loop"
+#endif
+#if defined(CRC_CRC8_DARC_LOOKUP_TABLE_METHOD)
+  #define CRC_FOOTPRINT_CRC8_DARC_METHOD "lookup_table"
+#else
+  #define CRC_FOOTPRINT_CRC8_DARC_METHOD "loop"
+#endif
+#if defined(CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD)
+  #define CRC_FOOTPRINT_CRC8_DVB_S2_METHOD "lookup_table"
+#else
+  #define CRC_FOOTPRINT_CRC8_DVB_S2_METHOD "loop"
+#endif
+#if defined(CRC_CRC8_EBU_LOOKUP_TABLE_METHOD)
+  #define CRC_FOOTPRINT_CRC8_EBU_METHOD "lookup_table"
+#else
+  #define CRC_FOOTPRINT_CRC8_EBU_METHOD "loop"
+#endif
+#if defined(CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD)
+  #define CRC_FOOTPRINT_CRC8_I_CODE_METHOD "lookup_table"
+#else
+  #define CRC_FOOTPRINT_CRC8_I_CODE_METHOD "loop"
+#endif
+#if defined(CRC_CRC8_ITU_LOOKUP_TABLE_METHOD)
+  #define CRC_FOOTPRINT_CRC8_ITU_METHOD "lookup_table"
+#else
+  #define CRC_FOOTPRINT_CRC8_ITU_METHOD "loop"
+#endif
+#if defined(CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD)
+  #define CRC_FOOTPRINT_CRC8_MAXIM_METHOD "lookup_table"
+#else
+  #define CRC_FOOTPRINT_CRC8_MAXIM_METHOD "loop"
+#endif
+#if defined(CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD)
+  #define CRC_FOOTPRINT_CRC8_ROHC_METHOD "lookup_table"
+#else
+  #define CRC_FOOTPRINT_CRC8_ROHC_METHOD "loop"
+#endif
+#if defined(CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD)
+  #define CRC_FOOTPRINT_CRC8_WCDMA_METHOD "lookup_table"
+#else
+  #define CRC_FOOTPRINT_CRC8_WCDMA_METHOD "loop"
+#endif
+#if defined(CRC_CRC16_ARC_LOOKUP_TABLE_METHOD)
+  #define CRC_FOOTPRINT_CRC16_ARC_METHOD "lookup_table"
+#else
+  #define CRC_FOOTPRINT_CRC16_ARC_METHOD "loop"
+#endif
+#if defined(CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD)
+  #define CRC_FOOTPRINT_CRC16_CCITT_FALSE_METHOD "lookup_table"
+#else
+  #define CRC_FOOTPRINT_CRC16_CCITT_FALSE_METHOD "loop"
+#endif
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "crc.h"
+#include <elf.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+/*** Kernel ***/
+typedef struct
+{
+    crc_variant_t variant;                                                        // Variant
+    uint32_t reserved;                                                            // Explicit Padding
+    const char *method;                                                           // Compiled Method
+    const char *object;                                                           // Object File Stem (Lower Case Define Stem)
+    uint16_t (*calculate)(const uint8_t * const Data, const uint16_t DataLength); // Calculate Kernel
+} crc_footprint_kernel_t;
+
+/*** Object Section Sizes ***/
+typedef struct
+{
+    uint64_t text;   // Executable Code (.text*)
+    uint64_t rodata; // Read-Only Data, Including Lookup Tables (.rodata*)
+    uint64_t data;   // Writable Data (Other Allocated Sections, Except Unwind Tables)
+} crc_footprint_size_t;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+#if defined(CRC_CRC8_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_LOOP_METHOD)
+  static uint16_t crcFootprint_crc8Calculate(const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_CDMA2000_LOOP_METHOD)
+  static uint16_t crcFootprint_crc8Cdma2000Calculate(const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC8_DARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DARC_LOOP_METHOD)
+  static uint16_t crcFootprint_crc8DarcCalculate(const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DVB_S2_LOOP_METHOD)
+  static uint16_t crcFootprint_crc8DvbS2Calculate(const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC8_EBU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_EBU_LOOP_METHOD)
+  static uint16_t crcFootprint_crc8EbuCalculate(const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_I_CODE_LOOP_METHOD)
+  static uint16_t crcFootprint_crc8ICodeCalculate(const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC8_ITU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ITU_LOOP_METHOD)
+  static uint16_t crcFootprint_crc8ItuCalculate(const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_MAXIM_LOOP_METHOD)
+  static uint16_t crcFootprint_crc8MaximCalculate(const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ROHC_LOOP_METHOD)
+  static uint16_t crcFootprint_crc8RohcCalculate(const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_WCDMA_LOOP_METHOD)
+  static uint16_t crcFootprint_crc8WcdmaCalculate(const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC16_ARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_ARC_LOOP_METHOD)
+  static uint16_t crcFootprint_crc16ArcCalculate(const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_CCITT_FALSE_LOOP_METHOD)
+  static uint16_t crcFootprint_crc16CcittFalseCalculate(const uint8_t * const Data, const uint16_t DataLength);
+#endif
+static uint64_t crcFootprint_nanoseconds(void);
+static bool crcFootprint_size(const char * const Path, crc_footprint_size_t * const size);
+static double crcFootprint_throughput(const crc_footprint_kernel_t * const Kernel, const uint8_t * const Data, const uint16_t DataLength);
+static void crcFootprint_usage(const char * const Name);
+
+/****************************************************************************************************
+ * Constants
+ ****************************************************************************************************/
+
+/*** Kernel ***/
+static const crc_footprint_kernel_t crcFootprint_kernel[] =
+{
+#if defined(CRC_CRC8_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_LOOP_METHOD)
+    {CRC_VARIANT_CRC8, 0, CRC_FOOTPRINT_CRC8_METHOD, "crc8", crcFootprint_crc8Calculate},
+#endif
+#if defined(CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_CDMA2000_LOOP_METHOD)
+    {CRC_VARIANT_CRC8_CDMA2000, 0, CRC_FOOTPRINT_CRC8_CDMA2000_METHOD, "crc8_cdma2000", crcFootprint_crc8Cdma2000Calculate},
+#endif
+#if defined(CRC_CRC8_DARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DARC_LOOP_METHOD)
+    {CRC_VARIANT_CRC8_DARC, 0, CRC_FOOTPRINT_CRC8_DARC_METHOD, "crc8_darc", crcFootprint_crc8DarcCalculate},
+#endif
+#if defined(CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DVB_S2_LOOP_METHOD)
+    {CRC_VARIANT_CRC8_DVB_S2, 0, CRC_FOOTPRINT_CRC8_DVB_S2_METHOD, "crc8_dvb_s2", crcFootprint_crc8DvbS2Calculate},
+#endif
+#if defined(CRC_CRC8_EBU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_EBU_LOOP_METHOD)
+    {CRC_VARIANT_CRC8_EBU, 0, CRC_FOOTPRINT_CRC8_EBU_METHOD, "crc8_ebu", crcFootprint_crc8EbuCalculate},
+#endif
+#if defined(CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_I_CODE_LOOP_METHOD)
+    {CRC_VARIANT_CRC8_I_CODE, 0, CRC_FOOTPRINT_CRC8_I_CODE_METHOD, "crc8_i_code", crcFootprint_crc8ICodeCalculate},
+#endif
+#if defined(CRC_CRC8_ITU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ITU_LOOP_METHOD)
+    {CRC_VARIANT_CRC8_ITU, 0, CRC_FOOTPRINT_CRC8_ITU_METHOD, "crc8_itu", crcFootprint_crc8ItuCalculate},
+#endif
+#if defined(CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_MAXIM_LOOP_METHOD)
+    {CRC_VARIANT_CRC8_MAXIM, 0, CRC_FOOTPRINT_CRC8_MAXIM_METHOD, "crc8_maxim", crcFootprint_crc8MaximCalculate},
+#endif
+#if defined(CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ROHC_LOOP_METHOD)
+    {CRC_VARIANT_CRC8_ROHC, 0, CRC_FOOTPRINT_CRC8_ROHC_METHOD, "crc8_rohc", crcFootprint_crc8RohcCalculate},
+#endif
+#if defined(CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_WCDMA_LOOP_METHOD)
+    {CRC_VARIANT_CRC8_WCDMA, 0, CRC_FOOTPRINT_CRC8_WCDMA_METHOD, "crc8_wcdma", crcFootprint_crc8WcdmaCalculate},
+#endif
+#if defined(CRC_CRC16_ARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_ARC_LOOP_METHOD)
+    {CRC_VARIANT_CRC16_ARC, 0, CRC_FOOTPRINT_CRC16_ARC_METHOD, "crc16_arc", crcFootprint_crc16ArcCalculate},
+#endif
+#if defined(CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_CCITT_FALSE_LOOP_METHOD)
+    {CRC_VARIANT_CRC16_CCITT_FALSE, 0, CRC_FOOTPRINT_CRC16_CCITT_FALSE_METHOD, "crc16_ccitt_false", crcFootprint_crc16CcittFalseCalculate},
+#endif
+};
+
+/****************************************************************************************************
+ * Variables
+ ****************************************************************************************************/
+
+/*** Result Sink (Keeps Kernels From Being Optimized Away) ***/
+static volatile uint16_t crcFootprint_sink;
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   main
+ * BRIEF:   CRC Code Size And Cache Footprint Report Main Entry
+ * RETURN:  int: Success Or Failure Status
+ * ARG:     argc: Number Of Arguments
+ * ARG:     argv: Argument String List
+ * NOTE:    Command Line Options:
+ *              -d [directory]: Object Directory (Default: ../build/footprint)
+ *              -l [bytes]: Message Length For Throughput (Default: 4096)
+ *          The Object Directory Holds crc_none.o (crc.c With No Variant Enabled) And One
+ *          crc_[variant]_[method].o Per Variant, Each Compiled With Only That Variant Enabled, So
+ *          Section Size Differences Are The Variant's Own Cost. The Working Set Is Its Code Plus
+ *          Read-Only Data (Tables), An Upper Bound On What A Call Touches; Output Is CSV With
+ *          Throughput Per KiB Of Working Set To Compare Configurations By Speed Per Cache Byte.
+ ****************************************************************************************************/
+int main(int argc, const char *argv[])
+{
+    crc_footprint_size_t none, variant;
+    const char *directory = CRC_FOOTPRINT_DIRECTORY;
+    char path[CRC_FOOTPRINT_PATH_LENGTH];
+    uint64_t text, rodata, workingSet;
+    unsigned long dataLength = CRC_FOOTPRINT_DATA_LENGTH;
+    long l1Size, l2Size;
+    double throughput;
+    uint8_t *data;
+    size_t i, k;
+    int a;
+    
+    /*** Parse Arguments ***/
+    for(a = 1; a < argc; a++)
+    {
+        if((strcmp(argv[a], "-d") == 0) && ((a + 1) < argc))
+        {
+            directory = argv[++a];
+        }
+        else if((strcmp(argv[a], "-l") == 0) && ((a + 1) < argc))
+        {
+            dataLength = strtoul(argv[++a], NULL, 0);
+        }
+        else
+        {
+            crcFootprint_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if((dataLength == 0) || (dataLength > UINT16_MAX))
+    {
+        crcFootprint_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    
+    /*** Size Common Code ***/
+    (void)snprintf(path, sizeof(path), "%s/crc_none.o", directory);
+    if(!crcFootprint_size(path, &none))
+    {
+        fprintf(stderr, "Cannot Read Object: %s\n", path);
+        return EXIT_FAILURE;
+    }
+    
+    /*** Fill Data With Known Pattern ***/
+    data = malloc(dataLength);
+    if(data == NULL)
+        return EXIT_FAILURE;
+    for(i = 0; i < dataLength; i++)
+        data[i] = (uint8_t)((i * 7) + 3);
+    
+    /*** Report Each Variant ***/
+    l1Size = sysconf(_SC_LEVEL1_DCACHE_SIZE);
+    l2Size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+    printf("variant,method,text_bytes,rodata_bytes,data_bytes,working_set_bytes,l1d_percent,l2_percent,mb_per_s,mb_per_s_per_kib\n");
+    for(k = 0; k < (sizeof(crcFootprint_kernel) / sizeof(crcFootprint_kernel[0])); k++)
+    {
+        (void)snprintf(path, sizeof(path), "%s/crc_%s_%s.o", directory, crcFootprint_kernel[k].object, crcFootprint_kernel[k].method);
+        if(!crcFootprint_size(path, &variant))
+        {
+            fprintf(stderr, "Cannot Read Object: %s\n", path);
+            free(data);
+            return EXIT_FAILURE;
+        }
+        text = (variant.text > none.text) ? (variant.text - none.text) : 0;
+        rodata = (variant.rodata > none.rodata) ? (variant.rodata - none.rodata) : 0;
+        workingSet = text + rodata;
+        throughput = crcFootprint_throughput(&crcFootprint_kernel[k], data, (uint16_t)dataLength);
+        printf("%s,%s,%llu,%llu,%llu,%llu,%.2f,%.3f,%.1f,%.1f\n", crc_variantName(crcFootprint_kernel[k].variant), crcFootprint_kernel[k].method,
+               (unsigned long long)text, (unsigned long long)rodata, (unsigned long long)((variant.data > none.data) ? (variant.data - none.data) : 0), (unsigned long long)workingSet,
+               (l1Size > 0) ? (((double)workingSet * 100.0) / (double)l1Size) : 0.0, (l2Size > 0) ? (((double)workingSet * 100.0) / (double)l2Size) : 0.0,
+               throughput, (workingSet != 0) ? ((throughput * 1024.0) / (double)workingSet) : 0.0);
+    }
+    
+    free(data);
+    
+    return EXIT_SUCCESS;
+}
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+#if defined(CRC_CRC8_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcFootprint_crc8Calculate
+ * BRIEF:   CRC-8 Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcFootprint_crc8Calculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8Calculate(Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_CDMA2000_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcFootprint_crc8Cdma2000Calculate
+ * BRIEF:   CRC-8/CDMA2000 Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcFootprint_crc8Cdma2000Calculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8Cdma2000Calculate(Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC8_DARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DARC_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcFootprint_crc8DarcCalculate
+ * BRIEF:   CRC-8/DARC Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcFootprint_crc8DarcCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8DarcCalculate(Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DVB_S2_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcFootprint_crc8DvbS2Calculate
+ * BRIEF:   CRC-8/DVB-S2 Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcFootprint_crc8DvbS2Calculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8DvbS2Calculate(Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC8_EBU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_EBU_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcFootprint_crc8EbuCalculate
+ * BRIEF:   CRC-8/EBU Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcFootprint_crc8EbuCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8EbuCalculate(Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_I_CODE_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcFootprint_crc8ICodeCalculate
+ * BRIEF:   CRC-8/I-CODE Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcFootprint_crc8ICodeCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8ICodeCalculate(Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC8_ITU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ITU_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcFootprint_crc8ItuCalculate
+ * BRIEF:   CRC-8/ITU Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcFootprint_crc8ItuCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8ItuCalculate(Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_MAXIM_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcFootprint_crc8MaximCalculate
+ * BRIEF:   CRC-8/MAXIM Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcFootprint_crc8MaximCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8MaximCalculate(Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ROHC_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcFootprint_crc8RohcCalculate
+ * BRIEF:   CRC-8/ROHC Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcFootprint_crc8RohcCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8RohcCalculate(Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_WCDMA_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcFootprint_crc8WcdmaCalculate
+ * BRIEF:   CRC-8/WCDMA Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcFootprint_crc8WcdmaCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8WcdmaCalculate(Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC16_ARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_ARC_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcFootprint_crc16ArcCalculate
+ * BRIEF:   CRC-16/ARC Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcFootprint_crc16ArcCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc16ArcCalculate(Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_CCITT_FALSE_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcFootprint_crc16CcittFalseCalculate
+ * BRIEF:   CRC-16/CCITT-FALSE Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcFootprint_crc16CcittFalseCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc16CcittFalseCalculate(Data, DataLength);
+}
+#endif
+
+/****************************************************************************************************
+ * FUNCT:   crcFootprint_nanoseconds
+ * BRIEF:   Read Monotonic Clock
+ * RETURN:  uint64_t: Monotonic Time (Nanoseconds)
+ ****************************************************************************************************/
+static uint64_t crcFootprint_nanoseconds(void)
+{
+    struct timespec now;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    
+    return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFootprint_size
+ * BRIEF:   Sum Allocated Section Sizes Of 64-Bit ELF Object
+ * RETURN:  bool: True If Object Was Read
+ * ARG:     Path: Object File Path
+ * ARG:     size: Section Sizes
+ ****************************************************************************************************/
+static bool crcFootprint_size(const char * const Path, crc_footprint_size_t * const size)
+{
+    const Elf64_Shdr *section;
+    const Elf64_Ehdr *header;
+    const char *name, *names;
+    uint8_t *object;
+    long objectLength;
+    bool valid = false;
+    FILE *file;
+    uint16_t s;
+    
+    /*** Read Object ***/
+    file = fopen(Path, "rb");
+    if(file == NULL)
+        return false;
+    object = NULL;
+    if((fseek(file, 0, SEEK_END) == 0) && ((objectLength = ftell(file)) > (long)sizeof(Elf64_Ehdr)) && (fseek(file, 0, SEEK_SET) == 0))
+    {
+        object = malloc((size_t)objectLength);
+        if((object != NULL) && (fread(object, 1, (size_t)objectLength, file) == (size_t)objectLength))
+            valid = true;
+    }
+    (void)fclose(file);
+    
+    /*** Validate Header And Section Table ***/
+    header = (const Elf64_Ehdr *)(const void *)object;
+    if(valid)
+    {
+        valid = (memcmp(header->e_ident, ELFMAG, SELFMAG) == 0) && (header->e_ident[EI_CLASS] == ELFCLASS64) && (header->e_shentsize == sizeof(Elf64_Shdr)) &&
+                (header->e_shstrndx < header->e_shnum) && (header->e_shoff <= (uint64_t)objectLength) &&
+                (((uint64_t)header->e_shnum * sizeof(Elf64_Shdr)) <= ((uint64_t)objectLength - header->e_shoff));
+    }
+    if(valid)
+    {
+        section = (const Elf64_Shdr *)(const void *)&object[header->e_shoff];
+        valid = (section[header->e_shstrndx].sh_offset < (uint64_t)objectLength) && (section[header->e_shstrndx].sh_size <= ((uint64_t)objectLength - section[header->e_shstrndx].sh_offset));
+    }
+    
+    /*** Sum Allocated Sections By Kind ***/
+    if(valid)
+    {
+        section = (const Elf64_Shdr *)(const void *)&object[header->e_shoff];
+        names = (const char *)&object[section[header->e_shstrndx].sh_offset];
+        memset(size, 0, sizeof(*size));
+        for(s = 0; s < header->e_shnum; s++)
+        {
+            if(((section[s].sh_flags & SHF_ALLOC) == 0) || (section[s].sh_name >= section[header->e_shstrndx].sh_size))
+                continue;
+            name = &names[section[s].sh_name];
+            if(strncmp(name, ".text", 5) == 0)
+                size->text += section[s].sh_size;
+            else if(strncmp(name, ".rodata", 7) == 0)
+                size->rodata += section[s].sh_size;
+            else if(strncmp(name, ".eh_frame", 9) != 0)
+                size->data += section[s].sh_size;
+        }
+    }
+    free(object);
+    
+    return valid;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFootprint_throughput
+ * BRIEF:   Measure Warm Kernel Throughput
+ * RETURN:  double: Best Throughput (MB/s)
+ * ARG:     Kernel: Kernel
+ * ARG:     Data: Message
+ * ARG:     DataLength: Message Length
+ * NOTE:    Best Of CRC_FOOTPRINT_RUNS Runs, Each At Least CRC_FOOTPRINT_RUN_TIME, As In The
+ *          Performance Regression Tests; See The Benchmark Tool For Cold Cache Figures.
+ ****************************************************************************************************/
+static double crcFootprint_throughput(const crc_footprint_kernel_t * const Kernel, const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint64_t bytes, elapsed, start;
+    double best = 0.0, throughput;
+    uint8_t run;
+    
+    /*** Measure Best Throughput (MB/s) ***/
+    crcFootprint_sink = Kernel->calculate(Data, DataLength);
+    for(run = 0; run < CRC_FOOTPRINT_RUNS; run++)
+    {
+        bytes = 0;
+        start = crcFootprint_nanoseconds();
+        do
+        {
+            crcFootprint_sink = Kernel->calculate(Data, DataLength);
+            bytes += DataLength;
+            elapsed = crcFootprint_nanoseconds() - start;
+        } while(elapsed < CRC_FOOTPRINT_RUN_TIME);
+        throughput = ((double)bytes * 1000.0) / (double)elapsed;
+        if(throughput > best)
+            best = throughput;
+    }
+    
+    return best;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFootprint_usage
+ * BRIEF:   Print Usage
+ * RETURN:  void: Returns Nothing
+ * ARG:     Name: Program Name
+ ****************************************************************************************************/
+static void crcFootprint_usage(const char * const Name)
+{
+    /*** Print Usage ***/
+    printf("Usage: %s [-d directory] [-l bytes]\n", Name);
+}
@@ -0,0 +1,1107 @@
+/****************************************************************************************************
+ * FILE:    crc_fuzz.c
+ * BRIEF:   CRC Differential Fuzzing Harness Source File
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Definitions
+ ****************************************************************************************************/
+
+#define CRC_FUZZ_ALIGNMENT      (64)
+#define CRC_FUZZ_HEADER_LENGTH  (3)
+#define CRC_FUZZ_ITERATIONS     (10000ULL)
+#define CRC_FUZZ_LENGTH         (4096UL)
+#define CRC_FUZZ_MAXIMUM_LENGTH (65535UL)
+
+/*** Alignment ***/
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+  #define CRC_FUZZ_ALIGNED(alignment) _Alignas(alignment)
+#elif defined(__GNUC__) || defined(__clang__)
+  #define CRC_FUZZ_ALIGNED(alignment) __attribute__((aligned(alignment)))
+#else
+  #define CRC_FUZZ_ALIGNED(alignment)
+#endif
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "crc.h"
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+/*** Kernel ***/
+typedef struct
+{
+    crc_variant_t variant;                                                                                                               // Variant
+    uint32_t reserved;                                                                                                                   // Explicit Padding
+    uint16_t (*calculate)(const uint8_t * const Data, const uint16_t DataLength);                                                        // Bulk Kernel
+    uint16_t (*calculatePartial)(const uint8_t Data, const uint16_t Crc, const bool Final);                                              // Streaming Kernel
+    uint16_t (*stripPrefix)(const uint16_t Crc, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength); // Strip Prefix Kernel
+    uint16_t (*unwind)(const uint16_t Crc, const uint8_t * const Data, const uint16_t DataLength);                                       // Unwind Kernel
+} crc_fuzz_kernel_t;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+#ifdef CRC_FUZZ_LIBFUZZER
+  int LLVMFuzzerTestOneInput(const uint8_t *Data, size_t Size);
+#endif
+static bool crcFuzz_check(const crc_variant_t Variant, const char * const Check, const uint16_t Expected, const uint16_t Actual, const uint16_t Length, const size_t Offset, const uint16_t Split);
+#if defined(CRC_CRC8_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_LOOP_METHOD)
+  static uint16_t crcFuzz_crc8Calculate(const uint8_t * const Data, const uint16_t DataLength);
+  static uint16_t crcFuzz_crc8CalculatePartial(const uint8_t Data, const uint16_t Crc, const bool Final);
+  static uint16_t crcFuzz_crc8StripPrefix(const uint16_t Crc, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength);
+  static uint16_t crcFuzz_crc8Unwind(const uint16_t Crc, const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_CDMA2000_LOOP_METHOD)
+  static uint16_t crcFuzz_crc8Cdma2000Calculate(const uint8_t * const Data, const uint16_t DataLength);
+  static uint16_t crcFuzz_crc8Cdma2000CalculatePartial(const uint8_t Data, const uint16_t Crc, const bool Final);
+  static uint16_t crcFuzz_crc8Cdma2000StripPrefix(const uint16_t Crc, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength);
+  static uint16_t crcFuzz_crc8Cdma2000Unwind(const uint16_t Crc, const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC8_DARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DARC_LOOP_METHOD)
+  static uint16_t crcFuzz_crc8DarcCalculate(const uint8_t * const Data, const uint16_t DataLength);
+  static uint16_t crcFuzz_crc8DarcCalculatePartial(const uint8_t Data, const uint16_t Crc, const bool Final);
+  static uint16_t crcFuzz_crc8DarcStripPrefix(const uint16_t Crc, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength);
+  static uint16_t crcFuzz_crc8DarcUnwind(const uint16_t Crc, const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DVB_S2_LOOP_METHOD)
+  static uint16_t crcFuzz_crc8DvbS2Calculate(const uint8_t * const Data, const uint16_t DataLength);
+  static uint16_t crcFuzz_crc8DvbS2CalculatePartial(const uint8_t Data, const uint16_t Crc, const bool Final);
+  static uint16_t crcFuzz_crc8DvbS2StripPrefix(const uint16_t Crc, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength);
+  static uint16_t crcFuzz_crc8DvbS2Unwind(const uint16_t Crc, const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC8_EBU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_EBU_LOOP_METHOD)
+  static uint16_t crcFuzz_crc8EbuCalculate(const uint8_t * const Data, const uint16_t DataLength);
+  static uint16_t crcFuzz_crc8EbuCalculatePartial(const uint8_t Data, const uint16_t Crc, const bool Final);
+  static uint16_t crcFuzz_crc8EbuStripPrefix(const uint16_t Crc, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength);
+  static uint16_t crcFuzz_crc8EbuUnwind(const uint16_t Crc, const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_I_CODE_LOOP_METHOD)
+  static uint16_t crcFuzz_crc8ICodeCalculate(const uint8_t * const Data, const uint16_t DataLength);
+  static uint16_t crcFuzz_crc8ICodeCalculatePartial(const uint8_t Data, const uint16_t Crc, const bool Final);
+  static uint16_t crcFuzz_crc8ICodeStripPrefix(const uint16_t Crc, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength);
+  static uint16_t crcFuzz_crc8ICodeUnwind(const uint16_t Crc, const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC8_ITU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ITU_LOOP_METHOD)
+  static uint16_t crcFuzz_crc8ItuCalculate(const uint8_t * const Data, const uint16_t DataLength);
+  static uint16_t crcFuzz_crc8ItuCalculatePartial(const uint8_t Data, const uint16_t Crc, const bool Final);
+  static uint16_t crcFuzz_crc8ItuStripPrefix(const uint16_t Crc, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength);
+  static uint16_t crcFuzz_crc8ItuUnwind(const uint16_t Crc, const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_MAXIM_LOOP_METHOD)
+  static uint16_t crcFuzz_crc8MaximCalculate(const uint8_t * const Data, const uint16_t DataLength);
+  static uint16_t crcFuzz_crc8MaximCalculatePartial(const uint8_t Data, const uint16_t Crc, const bool Final);
+  static uint16_t crcFuzz_crc8MaximStripPrefix(const uint16_t Crc, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength);
+  static uint16_t crcFuzz_crc8MaximUnwind(const uint16_t Crc, const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ROHC_LOOP_METHOD)
+  static uint16_t crcFuzz_crc8RohcCalculate(const uint8_t * const Data, const uint16_t DataLength);
+  static uint16_t crcFuzz_crc8RohcCalculatePartial(const uint8_t Data, const uint16_t Crc, const bool Final);
+  static uint16_t crcFuzz_crc8RohcStripPrefix(const uint16_t Crc, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength);
+  static uint16_t crcFuzz_crc8RohcUnwind(const uint16_t Crc, const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_WCDMA_LOOP_METHOD)
+  static uint16_t crcFuzz_crc8WcdmaCalculate(const uint8_t * const Data, const uint16_t DataLength);
+  static uint16_t crcFuzz_crc8WcdmaCalculatePartial(const uint8_t Data, const uint16_t Crc, const bool Final);
+  static uint16_t crcFuzz_crc8WcdmaStripPrefix(const uint16_t Crc, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength);
+  static uint16_t crcFuzz_crc8WcdmaUnwind(const uint16_t Crc, const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC16_ARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_ARC_LOOP_METHOD)
+  static uint16_t crcFuzz_crc16ArcCalculate(const uint8_t * const Data, const uint16_t DataLength);
+  static uint16_t crcFuzz_crc16ArcCalculatePartial(const uint8_t Data, const uint16_t Crc, const bool Final);
+  static uint16_t crcFuzz_crc16ArcStripPrefix(const uint16_t Crc, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength);
+  static uint16_t crcFuzz_crc16ArcUnwind(const uint16_t Crc, const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_CCITT_FALSE_LOOP_METHOD)
+  static uint16_t crcFuzz_crc16CcittFalseCalculate(const uint8_t * const Data, const uint16_t DataLength);
+  static uint16_t crcFuzz_crc16CcittFalseCalculatePartial(const uint8_t Data, const uint16_t Crc, const bool Final);
+  static uint16_t crcFuzz_crc16CcittFalseStripPrefix(const uint16_t Crc, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength);
+  static uint16_t crcFuzz_crc16CcittFalseUnwind(const uint16_t Crc, const uint8_t * const Data, const uint16_t DataLength);
+#endif
+static uint64_t crcFuzz_random(uint64_t * const state);
+static uint16_t crcFuzz_reference(const crc_model_t * const Model, const uint8_t * const Data, const uint16_t DataLength);
+static bool crcFuzz_test(const uint8_t * const Data, const size_t Size);
+#ifndef CRC_FUZZ_LIBFUZZER
+  static void crcFuzz_usage(const char * const Name);
+#endif
+
+/****************************************************************************************************
+ * Constants
+ ****************************************************************************************************/
+
+/*** Kernel ***/
+static const crc_fuzz_kernel_t crcFuzz_kernel[] =
+{
+#if defined(CRC_CRC8_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_LOOP_METHOD)
+    {CRC_VARIANT_CRC8, 0, crcFuzz_crc8Calculate, crcFuzz_crc8CalculatePartial, crcFuzz_crc8StripPrefix, crcFuzz_crc8Unwind},
+#endif
+#if defined(CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_CDMA2000_LOOP_METHOD)
+    {CRC_VARIANT_CRC8_CDMA2000, 0, crcFuzz_crc8Cdma2000Calculate, crcFuzz_crc8Cdma2000CalculatePartial, crcFuzz_crc8Cdma2000StripPrefix, crcFuzz_crc8Cdma2000Unwind},
+#endif
+#if defined(CRC_CRC8_DARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DARC_LOOP_METHOD)
+    {CRC_VARIANT_CRC8_DARC, 0, crcFuzz_crc8DarcCalculate, crcFuzz_crc8DarcCalculatePartial, crcFuzz_crc8DarcStripPrefix, crcFuzz_crc8DarcUnwind},
+#endif
+#if defined(CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DVB_S2_LOOP_METHOD)
+    {CRC_VARIANT_CRC8_DVB_S2, 0, crcFuzz_crc8DvbS2Calculate, crcFuzz_crc8DvbS2CalculatePartial, crcFuzz_crc8DvbS2StripPrefix, crcFuzz_crc8DvbS2Unwind},
+#endif
+#if defined(CRC_CRC8_EBU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_EBU_LOOP_METHOD)
+    {CRC_VARIANT_CRC8_EBU, 0, crcFuzz_crc8EbuCalculate, crcFuzz_crc8EbuCalculatePartial, crcFuzz_crc8EbuStripPrefix, crcFuzz_crc8EbuUnwind},
+#endif
+#if defined(CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_I_CODE_LOOP_METHOD)
+    {CRC_VARIANT_CRC8_I_CODE, 0, crcFuzz_crc8ICodeCalculate, crcFuzz_crc8ICodeCalculatePartial, crcFuzz_crc8ICodeStripPrefix, crcFuzz_crc8ICodeUnwind},
+#endif
+#if defined(CRC_CRC8_ITU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ITU_LOOP_METHOD)
+    {CRC_VARIANT_CRC8_ITU, 0, crcFuzz_crc8ItuCalculate, crcFuzz_crc8ItuCalculatePartial, crcFuzz_crc8ItuStripPrefix, crcFuzz_crc8ItuUnwind},
+#endif
+#if defined(CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_MAXIM_LOOP_METHOD)
+    {CRC_VARIANT_CRC8_MAXIM, 0, crcFuzz_crc8MaximCalculate, crcFuzz_crc8MaximCalculatePartial, crcFuzz_crc8MaximStripPrefix, crcFuzz_crc8MaximUnwind},
+#endif
+#if defined(CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ROHC_LOOP_METHOD)
+    {CRC_VARIANT_CRC8_ROHC, 0, crcFuzz_crc8RohcCalculate, crcFuzz_crc8RohcCalculatePartial, crcFuzz_crc8RohcStripPrefix, crcFuzz_crc8RohcUnwind},
+#endif
+#if defined(CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_WCDMA_LOOP_METHOD)
+    {CRC_VARIANT_CRC8_WCDMA, 0, crcFuzz_crc8WcdmaCalculate, crcFuzz_crc8WcdmaCalculatePartial, crcFuzz_crc8WcdmaStripPrefix, crcFuzz_crc8WcdmaUnwind},
+#endif
+#if defined(CRC_CRC16_ARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_ARC_LOOP_METHOD)
+    {CRC_VARIANT_CRC16_ARC, 0, crcFuzz_crc16ArcCalculate, crcFuzz_crc16ArcCalculatePartial, crcFuzz_crc16ArcStripPrefix, crcFuzz_crc16ArcUnwind},
+#endif
+#if defined(CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_CCITT_FALSE_LOOP_METHOD)
+    {CRC_VARIANT_CRC16_CCITT_FALSE, 0, crcFuzz_crc16CcittFalseCalculate, crcFuzz_crc16CcittFalseCalculatePartial, crcFuzz_crc16CcittFalseStripPrefix, crcFuzz_crc16CcittFalseUnwind},
+#endif
+};
+
+/****************************************************************************************************
+ * Variables
+ ****************************************************************************************************/
+
+/*** Message Buffer (Cache Line Aligned So Offsets Select Alignment) ***/
+static CRC_FUZZ_ALIGNED(CRC_FUZZ_ALIGNMENT) uint8_t crcFuzz_buffer[CRC_FUZZ_ALIGNMENT + CRC_FUZZ_MAXIMUM_LENGTH];
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+#ifdef CRC_FUZZ_LIBFUZZER
+/****************************************************************************************************
+ * FUNCT:   LLVMFuzzerTestOneInput
+ * BRIEF:   libFuzzer Entry
+ * RETURN:  int: Always 0 (Aborts On Mismatch So libFuzzer Saves The Input)
+ * ARG:     Data: Fuzzer Input
+ * ARG:     Size: Fuzzer Input Size
+ ****************************************************************************************************/
+int LLVMFuzzerTestOneInput(const uint8_t *Data, size_t Size)
+{
+    if(!crcFuzz_test(Data, Size))
+        abort();
+    
+    return 0;
+}
+#else
+/****************************************************************************************************
+ * FUNCT:   main
+ * BRIEF:   CRC Differential Fuzzing Harness Main Entry (Standalone)
+ * RETURN:  int: Success Or Failure Status
+ * ARG:     argc: Number Of Arguments
+ * ARG:     argv: Argument String List
+ * NOTE:    Command Line Options:
+ *              -n [count]: Number Of Random Inputs (Default: 10000)
+ *              -l [bytes]: Largest Message Length (Default: 4096; At Most 65535)
+ *              -s [seed]: Random Seed (Default: 1)
+ ****************************************************************************************************/
+int main(int argc, const char *argv[])
+{
+    static uint8_t input[CRC_FUZZ_HEADER_LENGTH + CRC_FUZZ_MAXIMUM_LENGTH];
+    uint64_t iteration, iterations = CRC_FUZZ_ITERATIONS, random, seed = 1, state;
+    unsigned long maximumLength = CRC_FUZZ_LENGTH;
+    size_t i, size;
+    uint8_t pattern;
+    int a;
+    
+    /*** Parse Arguments ***/
+    for(a = 1; a < argc; a++)
+    {
+        if((strcmp(argv[a], "-n") == 0) && ((a + 1) < argc))
+        {
+            iterations = strtoull(argv[++a], NULL, 0);
+        }
+        else if((strcmp(argv[a], "-l") == 0) && ((a + 1) < argc))
+        {
+            maximumLength = strtoul(argv[++a], NULL, 0);
+        }
+        else if((strcmp(argv[a], "-s") == 0) && ((a + 1) < argc))
+        {
+            seed = strtoull(argv[++a], NULL, 0);
+        }
+        else
+        {
+            crcFuzz_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if(maximumLength > CRC_FUZZ_MAXIMUM_LENGTH)
+    {
+        crcFuzz_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    
+    /*** Test Random Inputs (Random, All Zero, All One And Sparse Messages) ***/
+    state = seed;
+    for(iteration = 0; iteration < iterations; iteration++)
+    {
+        size = CRC_FUZZ_HEADER_LENGTH + (size_t)(crcFuzz_random(&state) % (maximumLength + 1U));
+        pattern = (uint8_t)(crcFuzz_random(&state) % 4U);
+        for(i = 0; i < size; i++)
+        {
+            random = crcFuzz_random(&state);
+            if((i < CRC_FUZZ_HEADER_LENGTH) || (pattern == 0))
+                input[i] = (uint8_t)random;
+            else if(pattern == 1)
+                input[i] = 0x00;
+            else if(pattern == 2)
+                input[i] = 0xFF;
+            else
+                input[i] = ((random >> 8) % 64U == 0) ? (uint8_t)random : 0x00;
+        }
+        if(!crcFuzz_test(input, size))
+        {
+            fprintf(stderr, "Failed At Iteration %" PRIu64 " (Seed %" PRIu64 ")\n", iteration, seed);
+            return EXIT_FAILURE;
+        }
+    }
+    printf("Passed %" PRIu64 " Inputs Across %u Kernels\n", iterations, (unsigned int)(sizeof(crcFuzz_kernel) / sizeof(crcFuzz_kernel[0])));
+    
+    return EXIT_SUCCESS;
+}
+#endif
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_check
+ * BRIEF:   Compare Kernel Result With Oracle
+ * RETURN:  bool: True If Results Match
+ * ARG:     Variant: CRC Variant
+ * ARG:     Check: Name Of Check
+ * ARG:     Expected: Oracle Result
+ * ARG:     Actual: Kernel Result
+ * ARG:     Length: Message Length
+ * ARG:     Offset: Message Offset From Cache Line Alignment
+ * ARG:     Split: Split Point (Prefix Length)
+ ****************************************************************************************************/
+static bool crcFuzz_check(const crc_variant_t Variant, const char * const Check, const uint16_t Expected, const uint16_t Actual, const uint16_t Length, const size_t Offset, const uint16_t Split)
+{
+    /*** Report Mismatch ***/
+    if(Expected != Actual)
+    {
+        fprintf(stderr, "Mismatch: %s %s (length=%u offset=%zu split=%u): expected 0x%04X, got 0x%04X\n", crc_variantName(Variant), Check, Length, Offset, Split, Expected, Actual);
+        return false;
+    }
+    
+    return true;
+}
+
+#if defined(CRC_CRC8_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8Calculate
+ * BRIEF:   CRC-8 Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8Calculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8Calculate(Data, DataLength);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8CalculatePartial
+ * BRIEF:   CRC-8 Streaming Kernel
+ * RETURN:  uint16_t: Current/Final CRC
+ * ARG:     Data: Data Byte
+ * ARG:     Crc: Current CRC
+ * ARG:     Final: Final Data Byte
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8CalculatePartial(const uint8_t Data, const uint16_t Crc, const bool Final)
+{
+    (void)Final; // Silence Compiler Warning
+    return crc_crc8CalculatePartial(Data, (uint8_t)Crc);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8StripPrefix
+ * BRIEF:   CRC-8 Strip Prefix Kernel
+ * RETURN:  uint16_t: CRC Of Data Following Prefix
+ * ARG:     Crc: CRC Of Prefix Followed By Suffix
+ * ARG:     Prefix: Prefix Data
+ * ARG:     PrefixLength: Prefix Data Length
+ * ARG:     SuffixLength: Length Of Data Following Prefix
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8StripPrefix(const uint16_t Crc, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength)
+{
+    return crc_crc8StripPrefix((uint8_t)Crc, Prefix, PrefixLength, SuffixLength);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8Unwind
+ * BRIEF:   CRC-8 Unwind Kernel
+ * RETURN:  uint16_t: CRC Of Data Preceding Trailing Data
+ * ARG:     Crc: CRC Of Data Including Trailing Data
+ * ARG:     Data: Trailing Data
+ * ARG:     DataLength: Trailing Data Length
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8Unwind(const uint16_t Crc, const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8Unwind((uint8_t)Crc, Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_CDMA2000_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8Cdma2000Calculate
+ * BRIEF:   CRC-8/CDMA2000 Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8Cdma2000Calculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8Cdma2000Calculate(Data, DataLength);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8Cdma2000CalculatePartial
+ * BRIEF:   CRC-8/CDMA2000 Streaming Kernel
+ * RETURN:  uint16_t: Current/Final CRC
+ * ARG:     Data: Data Byte
+ * ARG:     Crc: Current CRC
+ * ARG:     Final: Final Data Byte
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8Cdma2000CalculatePartial(const uint8_t Data, const uint16_t Crc, const bool Final)
+{
+    (void)Final; // Silence Compiler Warning
+    return crc_crc8Cdma2000CalculatePartial(Data, (uint8_t)Crc);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8Cdma2000StripPrefix
+ * BRIEF:   CRC-8/CDMA2000 Strip Prefix Kernel
+ * RETURN:  uint16_t: CRC Of Data Following Prefix
+ * ARG:     Crc: CRC Of Prefix Followed By Suffix
+ * ARG:     Prefix: Prefix Data
+ * ARG:     PrefixLength: Prefix Data Length
+ * ARG:     SuffixLength: Length Of Data Following Prefix
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8Cdma2000StripPrefix(const uint16_t Crc, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength)
+{
+    return crc_crc8Cdma2000StripPrefix((uint8_t)Crc, Prefix, PrefixLength, SuffixLength);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8Cdma2000Unwind
+ * BRIEF:   CRC-8/CDMA2000 Unwind Kernel
+ * RETURN:  uint16_t: CRC Of Data Preceding Trailing Data
+ * ARG:     Crc: CRC Of Data Including Trailing Data
+ * ARG:     Data: Trailing Data
+ * ARG:     DataLength: Trailing Data Length
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8Cdma2000Unwind(const uint16_t Crc, const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8Cdma2000Unwind((uint8_t)Crc, Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC8_DARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DARC_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8DarcCalculate
+ * BRIEF:   CRC-8/DARC Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8DarcCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8DarcCalculate(Data, DataLength);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8DarcCalculatePartial
+ * BRIEF:   CRC-8/DARC Streaming Kernel
+ * RETURN:  uint16_t: Current/Final CRC
+ * ARG:     Data: Data Byte
+ * ARG:     Crc: Current CRC
+ * ARG:     Final: Final Data Byte
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8DarcCalculatePartial(const uint8_t Data, const uint16_t Crc, const bool Final)
+{
+    return crc_crc8DarcCalculatePartial(Data, (uint8_t)Crc, Final);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8DarcStripPrefix
+ * BRIEF:   CRC-8/DARC Strip Prefix Kernel
+ * RETURN:  uint16_t: CRC Of Data Following Prefix
+ * ARG:     Crc: CRC Of Prefix Followed By Suffix
+ * ARG:     Prefix: Prefix Data
+ * ARG:     PrefixLength: Prefix Data Length
+ * ARG:     SuffixLength: Length Of Data Following Prefix
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8DarcStripPrefix(const uint16_t Crc, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength)
+{
+    return crc_crc8DarcStripPrefix((uint8_t)Crc, Prefix, PrefixLength, SuffixLength);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8DarcUnwind
+ * BRIEF:   CRC-8/DARC Unwind Kernel
+ * RETURN:  uint16_t: CRC Of Data Preceding Trailing Data
+ * ARG:     Crc: CRC Of Data Including Trailing Data
+ * ARG:     Data: Trailing Data
+ * ARG:     DataLength: Trailing Data Length
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8DarcUnwind(const uint16_t Crc, const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8DarcUnwind((uint8_t)Crc, Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DVB_S2_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8DvbS2Calculate
+ * BRIEF:   CRC-8/DVB-S2 Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8DvbS2Calculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8DvbS2Calculate(Data, DataLength);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8DvbS2CalculatePartial
+ * BRIEF:   CRC-8/DVB-S2 Streaming Kernel
+ * RETURN:  uint16_t: Current/Final CRC
+ * ARG:     Data: Data Byte
+ * ARG:     Crc: Current CRC
+ * ARG:     Final: Final Data Byte
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8DvbS2CalculatePartial(const uint8_t Data, const uint16_t Crc, const bool Final)
+{
+    (void)Final; // Silence Compiler Warning
+    return crc_crc8DvbS2CalculatePartial(Data, (uint8_t)Crc);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8DvbS2StripPrefix
+ * BRIEF:   CRC-8/DVB-S2 Strip Prefix Kernel
+ * RETURN:  uint16_t: CRC Of Data Following Prefix
+ * ARG:     Crc: CRC Of Prefix Followed By Suffix
+ * ARG:     Prefix: Prefix Data
+ * ARG:     PrefixLength: Prefix Data Length
+ * ARG:     SuffixLength: Length Of Data Following Prefix
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8DvbS2StripPrefix(const uint16_t Crc, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength)
+{
+    return crc_crc8DvbS2StripPrefix((uint8_t)Crc, Prefix, PrefixLength, SuffixLength);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8DvbS2Unwind
+ * BRIEF:   CRC-8/DVB-S2 Unwind Kernel
+ * RETURN:  uint16_t: CRC Of Data Preceding Trailing Data
+ * ARG:     Crc: CRC Of Data Including Trailing Data
+ * ARG:     Data: Trailing Data
+ * ARG:     DataLength: Trailing Data Length
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8DvbS2Unwind(const uint16_t Crc, const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8DvbS2Unwind((uint8_t)Crc, Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC8_EBU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_EBU_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8EbuCalculate
+ * BRIEF:   CRC-8/EBU Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8EbuCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8EbuCalculate(Data, DataLength);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8EbuCalculatePartial
+ * BRIEF:   CRC-8/EBU Streaming Kernel
+ * RETURN:  uint16_t: Current/Final CRC
+ * ARG:     Data: Data Byte
+ * ARG:     Crc: Current CRC
+ * ARG:     Final: Final Data Byte
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8EbuCalculatePartial(const uint8_t Data, const uint16_t Crc, const bool Final)
+{
+    return crc_crc8EbuCalculatePartial(Data, (uint8_t)Crc, Final);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8EbuStripPrefix
+ * BRIEF:   CRC-8/EBU Strip Prefix Kernel
+ * RETURN:  uint16_t: CRC Of Data Following Prefix
+ * ARG:     Crc: CRC Of Prefix Followed By Suffix
+ * ARG:     Prefix: Prefix Data
+ * ARG:     PrefixLength: Prefix Data Length
+ * ARG:     SuffixLength: Length Of Data Following Prefix
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8EbuStripPrefix(const uint16_t Crc, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength)
+{
+    return crc_crc8EbuStripPrefix((uint8_t)Crc, Prefix, PrefixLength, SuffixLength);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8EbuUnwind
+ * BRIEF:   CRC-8/EBU Unwind Kernel
+ * RETURN:  uint16_t: CRC Of Data Preceding Trailing Data
+ * ARG:     Crc: CRC Of Data Including Trailing Data
+ * ARG:     Data: Trailing Data
+ * ARG:     DataLength: Trailing Data Length
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8EbuUnwind(const uint16_t Crc, const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8EbuUnwind((uint8_t)Crc, Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_I_CODE_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8ICodeCalculate
+ * BRIEF:   CRC-8/I-CODE Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8ICodeCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8ICodeCalculate(Data, DataLength);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8ICodeCalculatePartial
+ * BRIEF:   CRC-8/I-CODE Streaming Kernel
+ * RETURN:  uint16_t: Current/Final CRC
+ * ARG:     Data: Data Byte
+ * ARG:     Crc: Current CRC
+ * ARG:     Final: Final Data Byte
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8ICodeCalculatePartial(const uint8_t Data, const uint16_t Crc, const bool Final)
+{
+    (void)Final; // Silence Compiler Warning
+    return crc_crc8ICodeCalculatePartial(Data, (uint8_t)Crc);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8ICodeStripPrefix
+ * BRIEF:   CRC-8/I-CODE Strip Prefix Kernel
+ * RETURN:  uint16_t: CRC Of Data Following Prefix
+ * ARG:     Crc: CRC Of Prefix Followed By Suffix
+ * ARG:     Prefix: Prefix Data
+ * ARG:     PrefixLength: Prefix Data Length
+ * ARG:     SuffixLength: Length Of Data Following Prefix
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8ICodeStripPrefix(const uint16_t Crc, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength)
+{
+    return crc_crc8ICodeStripPrefix((uint8_t)Crc, Prefix, PrefixLength, SuffixLength);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8ICodeUnwind
+ * BRIEF:   CRC-8/I-CODE Unwind Kernel
+ * RETURN:  uint16_t: CRC Of Data Preceding Trailing Data
+ * ARG:     Crc: CRC Of Data Including Trailing Data
+ * ARG:     Data: Trailing Data
+ * ARG:     DataLength: Trailing Data Length
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8ICodeUnwind(const uint16_t Crc, const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8ICodeUnwind((uint8_t)Crc, Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC8_ITU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ITU_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8ItuCalculate
+ * BRIEF:   CRC-8/ITU Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8ItuCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8ItuCalculate(Data, DataLength);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8ItuCalculatePartial
+ * BRIEF:   CRC-8/ITU Streaming Kernel
+ * RETURN:  uint16_t: Current/Final CRC
+ * ARG:     Data: Data Byte
+ * ARG:     Crc: Current CRC
+ * ARG:     Final: Final Data Byte
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8ItuCalculatePartial(const uint8_t Data, const uint16_t Crc, const bool Final)
+{
+    return crc_crc8ItuCalculatePartial(Data, (uint8_t)Crc, Final);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8ItuStripPrefix
+ * BRIEF:   CRC-8/ITU Strip Prefix Kernel
+ * RETURN:  uint16_t: CRC Of Data Following Prefix
+ * ARG:     Crc: CRC Of Prefix Followed By Suffix
+ * ARG:     Prefix: Prefix Data
+ * ARG:     PrefixLength: Prefix Data Length
+ * ARG:     SuffixLength: Length Of Data Following Prefix
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8ItuStripPrefix(const uint16_t Crc, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength)
+{
+    return crc_crc8ItuStripPrefix((uint8_t)Crc, Prefix, PrefixLength, SuffixLength);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8ItuUnwind
+ * BRIEF:   CRC-8/ITU Unwind Kernel
+ * RETURN:  uint16_t: CRC Of Data Preceding Trailing Data
+ * ARG:     Crc: CRC Of Data Including Trailing Data
+ * ARG:     Data: Trailing Data
+ * ARG:     DataLength: Trailing Data Length
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8ItuUnwind(const uint16_t Crc, const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8ItuUnwind((uint8_t)Crc, Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_MAXIM_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8MaximCalculate
+ * BRIEF:   CRC-8/MAXIM Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8MaximCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8MaximCalculate(Data, DataLength);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8MaximCalculatePartial
+ * BRIEF:   CRC-8/MAXIM Streaming Kernel
+ * RETURN:  uint16_t: Current/Final CRC
+ * ARG:     Data: Data Byte
+ * ARG:     Crc: Current CRC
+ * ARG:     Final: Final Data Byte
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8MaximCalculatePartial(const uint8_t Data, const uint16_t Crc, const bool Final)
+{
+    return crc_crc8MaximCalculatePartial(Data, (uint8_t)Crc, Final);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8MaximStripPrefix
+ * BRIEF:   CRC-8/MAXIM Strip Prefix Kernel
+ * RETURN:  uint16_t: CRC Of Data Following Prefix
+ * ARG:     Crc: CRC Of Prefix Followed By Suffix
+ * ARG:     Prefix: Prefix Data
+ * ARG:     PrefixLength: Prefix Data Length
+ * ARG:     SuffixLength: Length Of Data Following Prefix
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8MaximStripPrefix(const uint16_t Crc, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength)
+{
+    return crc_crc8MaximStripPrefix((uint8_t)Crc, Prefix, PrefixLength, SuffixLength);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8MaximUnwind
+ * BRIEF:   CRC-8/MAXIM Unwind Kernel
+ * RETURN:  uint16_t: CRC Of Data Preceding Trailing Data
+ * ARG:     Crc: CRC Of Data Including Trailing Data
+ * ARG:     Data: Trailing Data
+ * ARG:     DataLength: Trailing Data Length
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8MaximUnwind(const uint16_t Crc, const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8MaximUnwind((uint8_t)Crc, Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ROHC_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8RohcCalculate
+ * BRIEF:   CRC-8/ROHC Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8RohcCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8RohcCalculate(Data, DataLength);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8RohcCalculatePartial
+ * BRIEF:   CRC-8/ROHC Streaming Kernel
+ * RETURN:  uint16_t: Current/Final CRC
+ * ARG:     Data: Data Byte
+ * ARG:     Crc: Current CRC
+ * ARG:     Final: Final Data Byte
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8RohcCalculatePartial(const uint8_t Data, const uint16_t Crc, const bool Final)
+{
+    return crc_crc8RohcCalculatePartial(Data, (uint8_t)Crc, Final);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8RohcStripPrefix
+ * BRIEF:   CRC-8/ROHC Strip Prefix Kernel
+ * RETURN:  uint16_t: CRC Of Data Following Prefix
+ * ARG:     Crc: CRC Of Prefix Followed By Suffix
+ * ARG:     Prefix: Prefix Data
+ * ARG:     PrefixLength: Prefix Data Length
+ * ARG:     SuffixLength: Length Of Data Following Prefix
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8RohcStripPrefix(const uint16_t Crc, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength)
+{
+    return crc_crc8RohcStripPrefix((uint8_t)Crc, Prefix, PrefixLength, SuffixLength);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8RohcUnwind
+ * BRIEF:   CRC-8/ROHC Unwind Kernel
+ * RETURN:  uint16_t: CRC Of Data Preceding Trailing Data
+ * ARG:     Crc: CRC Of Data Including Trailing Data
+ * ARG:     Data: Trailing Data
+ * ARG:     DataLength: Trailing Data Length
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8RohcUnwind(const uint16_t Crc, const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8RohcUnwind((uint8_t)Crc, Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_WCDMA_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8WcdmaCalculate
+ * BRIEF:   CRC-8/WCDMA Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8WcdmaCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8WcdmaCalculate(Data, DataLength);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8WcdmaCalculatePartial
+ * BRIEF:   CRC-8/WCDMA Streaming Kernel
+ * RETURN:  uint16_t: Current/Final CRC
+ * ARG:     Data: Data Byte
+ * ARG:     Crc: Current CRC
+ * ARG:     Final: Final Data Byte
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8WcdmaCalculatePartial(const uint8_t Data, const uint16_t Crc, const bool Final)
+{
+    return crc_crc8WcdmaCalculatePartial(Data, (uint8_t)Crc, Final);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8WcdmaStripPrefix
+ * BRIEF:   CRC-8/WCDMA Strip Prefix Kernel
+ * RETURN:  uint16_t: CRC Of Data Following Prefix
+ * ARG:     Crc: CRC Of Prefix Followed By Suffix
+ * ARG:     Prefix: Prefix Data
+ * ARG:     PrefixLength: Prefix Data Length
+ * ARG:     SuffixLength: Length Of Data Following Prefix
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8WcdmaStripPrefix(const uint16_t Crc, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength)
+{
+    return crc_crc8WcdmaStripPrefix((uint8_t)Crc, Prefix, PrefixLength, SuffixLength);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc8WcdmaUnwind
+ * BRIEF:   CRC-8/WCDMA Unwind Kernel
+ * RETURN:  uint16_t: CRC Of Data Preceding Trailing Data
+ * ARG:     Crc: CRC Of Data Including Trailing Data
+ * ARG:     Data: Trailing Data
+ * ARG:     DataLength: Trailing Data Length
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc8WcdmaUnwind(const uint16_t Crc, const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8WcdmaUnwind((uint8_t)Crc, Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC16_ARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_ARC_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc16ArcCalculate
+ * BRIEF:   CRC-16/ARC Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc16ArcCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc16ArcCalculate(Data, DataLength);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc16ArcCalculatePartial
+ * BRIEF:   CRC-16/ARC Streaming Kernel
+ * RETURN:  uint16_t: Current/Final CRC
+ * ARG:     Data: Data Byte
+ * ARG:     Crc: Current CRC
+ * ARG:     Final: Final Data Byte
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc16ArcCalculatePartial(const uint8_t Data, const uint16_t Crc, const bool Final)
+{
+    return crc_crc16ArcCalculatePartial(Data, (uint16_t)Crc, Final);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc16ArcStripPrefix
+ * BRIEF:   CRC-16/ARC Strip Prefix Kernel
+ * RETURN:  uint16_t: CRC Of Data Following Prefix
+ * ARG:     Crc: CRC Of Prefix Followed By Suffix
+ * ARG:     Prefix: Prefix Data
+ * ARG:     PrefixLength: Prefix Data Length
+ * ARG:     SuffixLength: Length Of Data Following Prefix
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc16ArcStripPrefix(const uint16_t Crc, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength)
+{
+    return crc_crc16ArcStripPrefix((uint16_t)Crc, Prefix, PrefixLength, SuffixLength);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc16ArcUnwind
+ * BRIEF:   CRC-16/ARC Unwind Kernel
+ * RETURN:  uint16_t: CRC Of Data Preceding Trailing Data
+ * ARG:     Crc: CRC Of Data Including Trailing Data
+ * ARG:     Data: Trailing Data
+ * ARG:     DataLength: Trailing Data Length
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc16ArcUnwind(const uint16_t Crc, const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc16ArcUnwind((uint16_t)Crc, Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_CCITT_FALSE_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc16CcittFalseCalculate
+ * BRIEF:   CRC-16/CCITT-FALSE Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc16CcittFalseCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc16CcittFalseCalculate(Data, DataLength);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc16CcittFalseCalculatePartial
+ * BRIEF:   CRC-16/CCITT-FALSE Streaming Kernel
+ * RETURN:  uint16_t: Current/Final CRC
+ * ARG:     Data: Data Byte
+ * ARG:     Crc: Current CRC
+ * ARG:     Final: Final Data Byte
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc16CcittFalseCalculatePartial(const uint8_t Data, const uint16_t Crc, const bool Final)
+{
+    (void)Final; // Silence Compiler Warning
+    return crc_crc16CcittFalseCalculatePartial(Data, (uint16_t)Crc);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc16CcittFalseStripPrefix
+ * BRIEF:   CRC-16/CCITT-FALSE Strip Prefix Kernel
+ * RETURN:  uint16_t: CRC Of Data Following Prefix
+ * ARG:     Crc: CRC Of Prefix Followed By Suffix
+ * ARG:     Prefix: Prefix Data
+ * ARG:     PrefixLength: Prefix Data Length
+ * ARG:     SuffixLength: Length Of Data Following Prefix
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc16CcittFalseStripPrefix(const uint16_t Crc, const uint8_t * const Prefix, const uint16_t PrefixLength, const uint32_t SuffixLength)
+{
+    return crc_crc16CcittFalseStripPrefix((uint16_t)Crc, Prefix, PrefixLength, SuffixLength);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_crc16CcittFalseUnwind
+ * BRIEF:   CRC-16/CCITT-FALSE Unwind Kernel
+ * RETURN:  uint16_t: CRC Of Data Preceding Trailing Data
+ * ARG:     Crc: CRC Of Data Including Trailing Data
+ * ARG:     Data: Trailing Data
+ * ARG:     DataLength: Trailing Data Length
+ ****************************************************************************************************/
+static uint16_t crcFuzz_crc16CcittFalseUnwind(const uint16_t Crc, const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc16CcittFalseUnwind((uint16_t)Crc, Data, DataLength);
+}
+#endif
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_random
+ * BRIEF:   Generate 64-Bit Random Number (splitmix64)
+ * RETURN:  uint64_t: Random Number
+ * ARG:     state: Generator State
+ ****************************************************************************************************/
+static uint64_t crcFuzz_random(uint64_t * const state)
+{
+    uint64_t z;
+    
+    *state += 0x9E3779B97F4A7C15ULL;
+    z = *state;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    
+    return z ^ (z >> 31);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_reference
+ * BRIEF:   Calculate CRC With Bit-At-A-Time Oracle
+ * RETURN:  uint16_t: CRC
+ * ARG:     Model: CRC Model (From crc_reverseModel)
+ * ARG:     Data: Data Buffer
+ * ARG:     DataLength: Length Of Data Buffer
+ * NOTE:    Same Shift Register As The LOOP Method, Driven Only By The Model Parameters, So It Is
+ *          Independent Of Whichever Method The Library Was Built With.
+ ****************************************************************************************************/
+static uint16_t crcFuzz_reference(const crc_model_t * const Model, const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint32_t mask = (uint32_t)((1UL << Model->width) - 1UL), top = (uint32_t)(1UL << (Model->width - 1U)), crc = Model->initial, reflected;
+    uint32_t i;
+    uint8_t bit, data;
+    
+    /*** Shift Each Bit Through Register ***/
+    for(i = 0; i < DataLength; i++)
+    {
+        data = Data[i];
+        if(Model->reflectIn)
+        {
+            data = (uint8_t)(((data & 0x01U) << 7) | ((data & 0x02U) << 5) | ((data & 0x04U) << 3) | ((data & 0x08U) << 1) |
+                             ((data & 0x10U) >> 1) | ((data & 0x20U) >> 3) | ((data & 0x40U) >> 5) | ((data & 0x80U) >> 7));
+        }
+        crc ^= (uint32_t)data << (Model->width - 8U);
+        for(bit = 0; bit < 8; bit++)
+            crc = ((crc & top) != 0) ? (((crc << 1) ^ Model->polynomial) & mask) : ((crc << 1) & mask);
+    }
+    
+    /*** Reflect Output And Apply Output XOR ***/
+    if(Model->reflectOut)
+    {
+        reflected = 0;
+        for(bit = 0; bit < Model->width; bit++)
+            reflected |= ((crc >> bit) & 1UL) << (Model->width - 1U - bit);
+        crc = reflected;
+    }
+    
+    return (uint16_t)(crc ^ Model->xorOut);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_test
+ * BRIEF:   Differentially Test Every Kernel On One Input
+ * RETURN:  bool: True If Every Kernel Matches The Oracle
+ * ARG:     Data: Input ([offset][split high][split low][message ...])
+ * ARG:     Size: Input Size
+ * NOTE:    The Message Is Placed At offset % CRC_FUZZ_ALIGNMENT From A Cache Line; Bulk, Byte Stream,
+ *          Multi-Variant, And Split-Point (StripPrefix And Unwind) Results Are Compared.
+ ****************************************************************************************************/
+static bool crcFuzz_test(const uint8_t * const Data, const size_t Size)
+{
+    const crc_fuzz_kernel_t *kernel;
+    uint16_t crc, expected[CRC_VARIANT_COUNT], length, multi[CRC_VARIANT_COUNT], split;
+    crc_model_t model;
+    uint32_t variants = 0;
+    size_t k, offset;
+    uint16_t i;
+    bool passed = true;
+    
+    /*** Decode Header And Place Message (Empty Messages Take The Error Path And Are Skipped) ***/
+    if(Size <= CRC_FUZZ_HEADER_LENGTH)
+        return true;
+    length = (uint16_t)(((Size - CRC_FUZZ_HEADER_LENGTH) < CRC_FUZZ_MAXIMUM_LENGTH) ? (Size - CRC_FUZZ_HEADER_LENGTH) : CRC_FUZZ_MAXIMUM_LENGTH);
+    offset = Data[0] % CRC_FUZZ_ALIGNMENT;
+    split = (uint16_t)((((uint16_t)Data[1] << 8) | Data[2]) % length);
+    (void)memcpy(&crcFuzz_buffer[offset], &Data[CRC_FUZZ_HEADER_LENGTH], length);
+    
+    /*** Compare Each Kernel With Oracle ***/
+    for(k = 0; k < (sizeof(crcFuzz_kernel) / sizeof(crcFuzz_kernel[0])); k++)
+    {
+        kernel = &crcFuzz_kernel[k];
+        (void)crc_reverseModel(kernel->variant, &model);
+        expected[kernel->variant] = crcFuzz_reference(&model, &crcFuzz_buffer[offset], length);
+        variants |= CRC_VARIANT_MASK(kernel->variant);
+    
+        /* Bulk */
+        crc = kernel->calculate(&crcFuzz_buffer[offset], length);
+        passed = crcFuzz_check(kernel->variant, "Calculate", expected[kernel->variant], crc, length, offset, split) && passed;
+    
+        /* Byte Stream (Seeded With Initial Value Returned For Empty Data) */
+        crc = kernel->calculate(NULL, 0);
+        for(i = 0; i < length; i++)
+            crc = kernel->calculatePartial(crcFuzz_buffer[offset + i], crc, (i == (length - 1)));
+        passed = crcFuzz_check(kernel->variant, "CalculatePartial", expected[kernel->variant], crc, length, offset, split) && passed;
+    
+        /* Split Point */
+        if(split != 0)
+        {
+            crc = kernel->stripPrefix(expected[kernel->variant], &crcFuzz_buffer[offset], split, (uint32_t)(length - split));
+            passed = crcFuzz_check(kernel->variant, "StripPrefix", crcFuzz_reference(&model, &crcFuzz_buffer[offset + split], (uint16_t)(length - split)), crc, length, offset, split) && passed;
+            crc = kernel->unwind(expected[kernel->variant], &crcFuzz_buffer[offset + split], (uint16_t)(length - split));
+            passed = crcFuzz_check(kernel->variant, "Unwind", crcFuzz_reference(&model, &crcFuzz_buffer[offset], split), crc, length, offset, split) && passed;
+        }
+    }
+    
+    /*** Compare Multi-Variant Kernel With Oracle ***/
+    crc_multiCalculate(&crcFuzz_buffer[offset], length, variants, multi);
+    for(k = 0; k < (sizeof(crcFuzz_kernel) / sizeof(crcFuzz_kernel[0])); k++)
+    {
+        kernel = &crcFuzz_kernel[k];
+        passed = crcFuzz_check(kernel->variant, "multiCalculate", expected[kernel->variant], multi[kernel->variant], length, offset, split) && passed;
+    }
+    
+    return passed;
+}
+
+#ifndef CRC_FUZZ_LIBFUZZER
+/****************************************************************************************************
+ * FUNCT:   crcFuzz_usage
+ * BRIEF:   Print Usage
+ * RETURN:  void: Returns Nothing
+ * ARG:     Name: Program Name
+ ****************************************************************************************************/
+static void crcFuzz_usage(const char * const Name)
+{
+    /*** Print Usage ***/
+    printf("Usage: %s [-n count] [-l bytes] [-s seed]\n", Name);
+}
+#endif
@@ -0,0 +1,357 @@
+/****************************************************************************************************
+ * FILE:    crc_hd.c
+ * BRIEF:   CRC Hamming Distance Evaluator Tool Source File
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Definitions
+ ****************************************************************************************************/
+
+#define CRC_HD_DEFAULT_WEIGHT      (6)
+#define CRC_HD_MAXIMUM_LENGTH      (65535)      // Largest Data Length (Bytes, Same As Library DataLength)
+#define CRC_HD_MAXIMUM_POLYNOMIALS (64)
+#define CRC_HD_MAXIMUM_THREADS     (256)
+#define CRC_HD_MAXIMUM_WEIGHT      (8)
+#define CRC_HD_OVERFLOW            (UINT64_MAX) // Saturated Count (Does Not Fit 64 Bits)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "crc.h"
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+/*** Polynomial ***/
+typedef struct
+{
+    const char *name;    // Preset Name (NULL If Generic)
+    uint16_t polynomial; // Polynomial (Normal Form, Implicit x^width Term)
+    uint8_t width;       // CRC Width (Bits)
+    uint8_t reserved[5]; // Explicit Padding
+    uint64_t *weight;    // Undetected Error Weight Profile (Per Length, Weights 0 ... Maximum)
+} crc_hd_polynomial_t;
+
+/*** Evaluation ***/
+typedef struct
+{
+    crc_hd_polynomial_t *polynomial; // Polynomials To Evaluate
+    pthread_mutex_t lock;            // Protects next
+    uint32_t lengthFirst;            // First Data Length (Bytes)
+    uint32_t lengthLast;             // Last Data Length (Bytes, Inclusive)
+    uint16_t polynomialCount;        // Number Of Polynomials
+    uint16_t next;                   // Next Polynomial To Evaluate
+    uint8_t maximumWeight;           // Largest Error Weight Counted
+    uint8_t reserved[3];             // Explicit Padding
+} crc_hd_evaluation_t;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static uint64_t crcHd_add(const uint64_t A, const uint64_t B);
+static void crcHd_evaluate(const crc_hd_evaluation_t * const Evaluation, crc_hd_polynomial_t * const polynomial, uint64_t * const subset);
+static bool crcHd_parsePolynomial(const char * const Argument, crc_hd_polynomial_t * const polynomial);
+static void crcHd_usage(const char * const Name);
+static void *crcHd_worker(void *argument);
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   main
+ * BRIEF:   CRC Hamming Distance Evaluator Tool Main Entry
+ * RETURN:  int: Success Or Failure Status
+ * ARG:     argc: Number Of Arguments
+ * ARG:     argv: Argument String List
+ * NOTE:    Command Line Options:
+ *              -l [first]:[last]: Data Lengths In Bytes (1 ... 65535; Default: 1:64)
+ *              -k [weight]: Count Undetected Errors Up To Weight [weight] (2 ... 8; Default: 6)
+ *              -t [count]: Evaluate With [count] Threads (Default: Number Of Online Processors)
+ *              [polynomial]: Preset Name (E.g. CRC-8/WCDMA) Or [width]:[polynomial] (E.g. 8:0x9B)
+ *          Output Is CSV: name,width,polynomial,data_bytes,hd,a2 ... ak; hd Is Reported As k+1 If
+ *          No Undetected Error Of Weight k Or Less Exists; A Count That Does Not Fit 64 Bits Is
+ *          Reported As overflow (Saturated, Never Wrapped)
+ ****************************************************************************************************/
+int main(int argc, const char *argv[])
+{
+    static crc_hd_polynomial_t polynomial[CRC_HD_MAXIMUM_POLYNOMIALS];
+    crc_hd_evaluation_t evaluation;
+    pthread_t thread[CRC_HD_MAXIMUM_THREADS];
+    const uint64_t *weight;
+    uint32_t length;
+    uint16_t i, polynomialCount = 0;
+    uint8_t hd, w;
+    long t, threadCount;
+    int a, consumed;
+    
+    /*** Parse Arguments ***/
+    evaluation.lengthFirst = 1;
+    evaluation.lengthLast = 64;
+    evaluation.maximumWeight = CRC_HD_DEFAULT_WEIGHT;
+    threadCount = sysconf(_SC_NPROCESSORS_ONLN);
+    for(a = 1; a < argc; a++)
+    {
+        if((strcmp(argv[a], "-l") == 0) && ((a + 1) < argc))
+        {
+            consumed = 0;
+            if((sscanf(argv[++a], "%" SCNu32 ":%" SCNu32 "%n", &evaluation.lengthFirst, &evaluation.lengthLast, &consumed) != 2) ||
+               (argv[a][consumed] != '\0') || (strchr(argv[a], '-') != NULL))
+                evaluation.lengthFirst = 0;
+        }
+        else if((strcmp(argv[a], "-k") == 0) && ((a + 1) < argc))
+        {
+            evaluation.maximumWeight = (uint8_t)strtoul(argv[++a], NULL, 0);
+        }
+        else if((strcmp(argv[a], "-t") == 0) && ((a + 1) < argc))
+        {
+            threadCount = strtol(argv[++a], NULL, 0);
+        }
+        else if((polynomialCount >= CRC_HD_MAXIMUM_POLYNOMIALS) || !crcHd_parsePolynomial(argv[a], &polynomial[polynomialCount++]))
+        {
+            crcHd_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if((polynomialCount == 0) || (evaluation.lengthFirst == 0) || (evaluation.lengthFirst > evaluation.lengthLast) || (evaluation.lengthLast > CRC_HD_MAXIMUM_LENGTH) ||
+       (evaluation.maximumWeight < 2) || (evaluation.maximumWeight > CRC_HD_MAXIMUM_WEIGHT))
+    {
+        crcHd_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    if(threadCount < 1)
+        threadCount = 1;
+    else if(threadCount > CRC_HD_MAXIMUM_THREADS)
+        threadCount = CRC_HD_MAXIMUM_THREADS;
+    
+    /*** Allocate Weight Profiles ***/
+    for(i = 0; i < polynomialCount; i++)
+    {
+        polynomial[i].weight = calloc((size_t)(evaluation.lengthLast - evaluation.lengthFirst + 1) * (evaluation.maximumWeight + 1U), sizeof(uint64_t));
+        if(polynomial[i].weight == NULL)
+        {
+            printf("Out Of Memory\n");
+            return EXIT_FAILURE;
+        }
+    }
+    
+    /*** Evaluate Polynomials Across Threads ***/
+    evaluation.polynomial = polynomial;
+    evaluation.polynomialCount = polynomialCount;
+    evaluation.next = 0;
+    (void)pthread_mutex_init(&evaluation.lock, NULL);
+    for(t = 0; t < threadCount; t++)
+    {
+        if(pthread_create(&thread[t], NULL, crcHd_worker, &evaluation) != 0)
+            break;
+    }
+    if(t == 0)
+        (void)crcHd_worker(&evaluation);
+    threadCount = t;
+    for(t = 0; t < threadCount; t++)
+        (void)pthread_join(thread[t], NULL);
+    (void)pthread_mutex_destroy(&evaluation.lock);
+    
+    /*** Report Hamming Distance And Weight Profile ***/
+    printf("name,width,polynomial,data_bytes,hd");
+    for(w = 2; w <= evaluation.maximumWeight; w++)
+        printf(",a%u", w);
+    printf("\n");
+    for(i = 0; i < polynomialCount; i++)
+    {
+        for(length = evaluation.lengthFirst; length <= evaluation.lengthLast; length++)
+        {
+            weight = &polynomial[i].weight[(length - evaluation.lengthFirst) * (evaluation.maximumWeight + 1U)];
+            hd = 2;
+            while((hd <= evaluation.maximumWeight) && (weight[hd] == 0))
+                hd++;
+            printf("%s,%u,0x%0*X,%" PRIu32 ",%u", (polynomial[i].name != NULL) ? polynomial[i].name : "", polynomial[i].width, (polynomial[i].width + 3) / 4, polynomial[i].polynomial, length, hd);
+            for(w = 2; w <= evaluation.maximumWeight; w++)
+            {
+                if(weight[w] == CRC_HD_OVERFLOW)
+                    printf(",overflow");
+                else
+                    printf(",%" PRIu64, weight[w]);
+            }
+            printf("\n");
+        }
+        free(polynomial[i].weight);
+    }
+    
+    return EXIT_SUCCESS;
+}
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   crcHd_add
+ * BRIEF:   Add Counts, Saturating At CRC_HD_OVERFLOW
+ * RETURN:  uint64_t: A + B (CRC_HD_OVERFLOW If It Does Not Fit)
+ * ARG:     A: Count
+ * ARG:     B: Count
+ ****************************************************************************************************/
+static uint64_t crcHd_add(const uint64_t A, const uint64_t B)
+{
+    return (A > (CRC_HD_OVERFLOW - B)) ? CRC_HD_OVERFLOW : (A + B);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcHd_evaluate
+ * BRIEF:   Evaluate Undetected Error Weight Profile Of Polynomial Over All Data Lengths
+ * RETURN:  void: Returns Nothing
+ * ARG:     Evaluation: Evaluation Settings
+ * ARG:     polynomial: Polynomial To Evaluate (Weight Profile Is Written)
+ * ARG:     subset: Work Area (maximumWeight * 2^width Counters)
+ * NOTE:    An Error Is Undetected If The Syndromes (x^i mod P) Of Its Bit Positions XOR To Zero; The
+ *          Codeword Is Grown One Bit At A Time, Keeping subset[k][s] = Number Of k-Bit Patterns With
+ *          Syndrome s, So Each New Bit Adds subset[w - 1][Its Syndrome] Undetected Errors Of Weight
+ *          w; Every Length Is Evaluated Incrementally In One Pass; Counts Saturate At
+ *          CRC_HD_OVERFLOW (Long Frames With Large k Exceed 64 Bits)
+ ****************************************************************************************************/
+static void crcHd_evaluate(const crc_hd_evaluation_t * const Evaluation, crc_hd_polynomial_t * const polynomial, uint64_t * const subset)
+{
+    uint64_t weight[CRC_HD_MAXIMUM_WEIGHT + 1] = {0};
+    uint32_t bit, bitLast, mask, size, syndrome, topBit, v;
+    uint8_t k, w;
+    
+    /*** Set Up ***/
+    size = 1UL << polynomial->width;
+    mask = size - 1U;
+    topBit = 1UL << (polynomial->width - 1);
+    bitLast = polynomial->width + (Evaluation->lengthLast * 8);
+    memset(subset, 0, (size_t)Evaluation->maximumWeight * size * sizeof(uint64_t));
+    subset[0] = 1;
+    
+    /*** Grow Codeword One Bit At A Time (Check Bits First) ***/
+    syndrome = 0x0001;
+    for(bit = 1; bit <= bitLast; bit++)
+    {
+        /* Count Undetected Errors That Include New Bit */
+        for(w = 2; w <= Evaluation->maximumWeight; w++)
+            weight[w] = crcHd_add(weight[w], subset[((w - 1U) * size) + syndrome]);
+    
+        /* Add New Bit To Patterns (Largest Weight First So Each Pattern Uses It Once) */
+        for(k = (uint8_t)(Evaluation->maximumWeight - 1); k > 0; k--)
+        {
+            for(v = 0; v < size; v++)
+                subset[(k * size) + v] = crcHd_add(subset[(k * size) + v], subset[((k - 1U) * size) + (v ^ syndrome)]);
+        }
+    
+        /* Record Weight Profile At Whole Data Bytes */
+        if((bit > polynomial->width) && (((bit - polynomial->width) % 8) == 0) && (((bit - polynomial->width) / 8) >= Evaluation->lengthFirst))
+            memcpy(&polynomial->weight[(((bit - polynomial->width) / 8) - Evaluation->lengthFirst) * (Evaluation->maximumWeight + 1U)], weight, (Evaluation->maximumWeight + 1U) * sizeof(uint64_t));
+    
+        /* Syndrome Of Next Bit (Multiply By x) */
+        if((syndrome & topBit) == topBit)
+            syndrome = ((syndrome << 1) ^ polynomial->polynomial) & mask;
+        else
+            syndrome = (syndrome << 1) & mask;
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcHd_parsePolynomial
+ * BRIEF:   Parse Polynomial Argument
+ * RETURN:  bool: True If Polynomial Parsed
+ * ARG:     Argument: Preset Name Or [width]:[polynomial]
+ * ARG:     polynomial: Parsed Polynomial
+ ****************************************************************************************************/
+static bool crcHd_parsePolynomial(const char * const Argument, crc_hd_polynomial_t * const polynomial)
+{
+    crc_model_t model;
+    unsigned long value;
+    char *end;
+    uint8_t v;
+    
+    /*** Look Up Preset ***/
+    for(v = 0; v < CRC_VARIANT_COUNT; v++)
+    {
+        if((strcmp(Argument, crc_variantName((crc_variant_t)v)) == 0) && crc_reverseModel((crc_variant_t)v, &model))
+        {
+            polynomial->name = crc_variantName((crc_variant_t)v);
+            polynomial->width = model.width;
+            polynomial->polynomial = model.polynomial;
+            return true;
+        }
+    }
+    
+    /*** Parse Generic Polynomial ***/
+    value = strtoul(Argument, &end, 0);
+    if((*end != ':') || (value < 3) || (value > 16))
+        return false;
+    polynomial->name = NULL;
+    polynomial->width = (uint8_t)value;
+    value = strtoul(end + 1, &end, 0);
+    if((*end != '\0') || ((value >> polynomial->width) != 0) || ((value & 0x0001) == 0))
+        return false;
+    polynomial->polynomial = (uint16_t)value;
+    
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcHd_usage
+ * BRIEF:   Print Usage
+ * RETURN:  void: Returns Nothing
+ * ARG:     Name: Program Name
+ ****************************************************************************************************/
+static void crcHd_usage(const char * const Name)
+{
+    uint8_t v;
+    
+    /*** Print Usage ***/
+    printf("Usage: %s [-l first:last] [-k weight] [-t threads] polynomial [polynomial ...]\n", Name);
+    printf("  polynomial Is A Preset Name Or width:polynomial (E.g. 8:0x9B; Normal Form, Odd)\n");
+    printf("  Presets:");
+    for(v = 0; v < CRC_VARIANT_COUNT; v++)
+        printf(" %s", crc_variantName((crc_variant_t)v));
+    printf("\n");
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcHd_worker
+ * BRIEF:   Evaluate Polynomials Until None Remain (Thread Entry)
+ * RETURN:  void *: Returns NULL
+ * ARG:     argument: Evaluation (crc_hd_evaluation_t)
+ ****************************************************************************************************/
+static void *crcHd_worker(void *argument)
+{
+    crc_hd_evaluation_t *evaluation = argument;
+    uint64_t *subset;
+    uint16_t next;
+    
+    /*** Allocate Work Area For Widest Polynomial ***/
+    subset = malloc((size_t)evaluation->maximumWeight * (1UL << 16) * sizeof(uint64_t));
+    if(subset == NULL)
+        return NULL;
+    
+    /*** Take Next Polynomial Until None Remain ***/
+    while(true)
+    {
+        (void)pthread_mutex_lock(&evaluation->lock);
+        next = evaluation->next;
+        if(next < evaluation->polynomialCount)
+            evaluation->next++;
+        (void)pthread_mutex_unlock(&evaluation->lock);
+        if(next >= evaluation->polynomialCount)
+            break;
+        crcHd_evaluate(evaluation, &evaluation->polynomial[next], subset);
+    }
+    free(subset);
+    
+    return NULL;
+}
@@ -0,0 +1,733 @@
+/****************************************************************************************************
+ * FILE:    crc_replay.c
+ * BRIEF:   CRC Trace-Driven Workload Replay Tool Source File
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Definitions
+ ****************************************************************************************************/
+
+#define CRC_REPLAY_LINE_LENGTH (256)
+#define CRC_REPLAY_POOL_LENGTH (16UL * 1024UL * 1024UL)
+
+/*** Method ***/
+#if defined(CRC_CRC8_LOOKUP_TABLE_METHOD)
+  #define CRC_REPLAY_CRC8_METHOD "lookup_table"
+#else
+  #define CRC_REPLAY_CRC8_METHOD "loop"
+#endif
+#if defined(CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD)
+  #define CRC_REPLAY_CRC8_CDMA2000_METHOD "lookup_table"
+#else
+  #define CRC_REPLAY_CRC8_CDMA2000_METHOD "loop"
+#endif
+#if defined(CRC_CRC8_DARC_LOOKUP_TABLE_METHOD)
+  #define CRC_REPLAY_CRC8_DARC_METHOD "lookup_table"
+#else
+  #define CRC_REPLAY_CRC8_DARC_METHOD "loop"
+#endif
+#if defined(CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD)
+  #define CRC_REPLAY_CRC8_DVB_S2_METHOD "lookup_table"
+#else
+  #define CRC_REPLAY_CRC8_DVB_S2_METHOD "loop"
+#endif
+#if defined(CRC_CRC8_EBU_LOOKUP_TABLE_METHOD)
+  #define CRC_REPLAY_CRC8_EBU_METHOD "lookup_table"
+#else
+  #define CRC_REPLAY_CRC8_EBU_METHOD "loop"
+#endif
+#if defined(CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD)
+  #define CRC_REPLAY_CRC8_I_CODE_METHOD "lookup_table"
+#else
+  #define CRC_REPLAY_CRC8_I_CODE_METHOD "loop"
+#endif
+#if defined(CRC_CRC8_ITU_LOOKUP_TABLE_METHOD)
+  #define CRC_REPLAY_CRC8_ITU_METHOD "lookup_table"
+#else
+  #define CRC_REPLAY_CRC8_ITU_METHOD "loop"
+#endif
+#if defined(CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD)
+  #define CRC_REPLAY_CRC8_MAXIM_METHOD "lookup_table"
+#else
+  #define CRC_REPLAY_CRC8_MAXIM_METHOD "loop"
+#endif
+#if defined(CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD)
+  #define CRC_REPLAY_CRC8_ROHC_METHOD "lookup_table"
+#else
+  #define CRC_REPLAY_CRC8_ROHC_METHOD "loop"
+#endif
+#if defined(CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD)
+  #define CRC_REPLAY_CRC8_WCDMA_METHOD "lookup_table"
+#else
+  #define CRC_REPLAY_CRC8_WCDMA_METHOD "loop"
+#endif
+#if defined(CRC_CRC16_ARC_LOOKUP_TABLE_METHOD)
+  #define CRC_REPLAY_CRC16_ARC_METHOD "lookup_table"
+#else
+  #define CRC_REPLAY_CRC16_ARC_METHOD "loop"
+#endif
+#if defined(CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD)
+  #define CRC_REPLAY_CRC16_CCITT_FALSE_METHOD "lookup_table"
+#else
+  #define CRC_REPLAY_CRC16_CCITT_FALSE_METHOD "loop"
+#endif
+
+/*** Timestamp Counter ***/
+#if defined(__x86_64__) || defined(__i386__)
+  #define CRC_REPLAY_TSC
+#endif
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "crc.h"
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#ifdef CRC_REPLAY_TSC
+  #include <x86intrin.h>
+#endif
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+/*** Kernel ***/
+typedef struct
+{
+    crc_variant_t variant;                                                        // Variant
+    uint32_t reserved;                                                            // Explicit Padding
+    const char *method;                                                           // Compiled Method
+    uint16_t (*calculate)(const uint8_t * const Data, const uint16_t DataLength); // Calculate Kernel
+} crc_replay_kernel_t;
+
+/*** Event ***/
+typedef struct
+{
+    const crc_replay_kernel_t *kernel; // Kernel To Call
+    uint32_t offset;                   // Message Offset In Buffer Pool
+    uint16_t length;                   // Message Length
+    uint16_t reserved;                 // Explicit Padding
+} crc_replay_event_t;
+
+/*** Latency ***/
+typedef struct
+{
+    uint64_t ticks;        // Call Duration (Timestamp Counter Ticks)
+    crc_variant_t variant; // Variant Called
+    uint32_t reserved;     // Explicit Padding
+} crc_replay_latency_t;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+#if defined(CRC_CRC8_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_LOOP_METHOD)
+  static uint16_t crcReplay_crc8Calculate(const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_CDMA2000_LOOP_METHOD)
+  static uint16_t crcReplay_crc8Cdma2000Calculate(const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC8_DARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DARC_LOOP_METHOD)
+  static uint16_t crcReplay_crc8DarcCalculate(const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DVB_S2_LOOP_METHOD)
+  static uint16_t crcReplay_crc8DvbS2Calculate(const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC8_EBU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_EBU_LOOP_METHOD)
+  static uint16_t crcReplay_crc8EbuCalculate(const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_I_CODE_LOOP_METHOD)
+  static uint16_t crcReplay_crc8ICodeCalculate(const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC8_ITU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ITU_LOOP_METHOD)
+  static uint16_t crcReplay_crc8ItuCalculate(const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_MAXIM_LOOP_METHOD)
+  static uint16_t crcReplay_crc8MaximCalculate(const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ROHC_LOOP_METHOD)
+  static uint16_t crcReplay_crc8RohcCalculate(const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_WCDMA_LOOP_METHOD)
+  static uint16_t crcReplay_crc8WcdmaCalculate(const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC16_ARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_ARC_LOOP_METHOD)
+  static uint16_t crcReplay_crc16ArcCalculate(const uint8_t * const Data, const uint16_t DataLength);
+#endif
+#if defined(CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_CCITT_FALSE_LOOP_METHOD)
+  static uint16_t crcReplay_crc16CcittFalseCalculate(const uint8_t * const Data, const uint16_t DataLength);
+#endif
+static int crcReplay_compareLatency(const void *a, const void *b);
+static int crcReplay_compareTicks(const void *a, const void *b);
+static uint64_t crcReplay_nanoseconds(void);
+static uint64_t crcReplay_percentile(const uint64_t * const Ticks, const size_t Count, const uint32_t PerMille);
+static bool crcReplay_readTrace(FILE * const file, crc_replay_event_t **event, size_t * const eventCount);
+static uint64_t crcReplay_random(uint64_t * const state);
+static void crcReplay_report(const char * const Name, const char * const Method, uint64_t * const ticks, const size_t Count, const uint64_t Bytes, const double NanosecondsPerTick);
+static uint64_t crcReplay_ticks(void);
+static void crcReplay_usage(const char * const Name);
+
+/****************************************************************************************************
+ * Constants
+ ****************************************************************************************************/
+
+/*** Kernel ***/
+static const crc_replay_kernel_t crcReplay_kernel[] =
+{
+#if defined(CRC_CRC8_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_LOOP_METHOD)
+    {CRC_VARIANT_CRC8, 0, CRC_REPLAY_CRC8_METHOD, crcReplay_crc8Calculate},
+#endif
+#if defined(CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_CDMA2000_LOOP_METHOD)
+    {CRC_VARIANT_CRC8_CDMA2000, 0, CRC_REPLAY_CRC8_CDMA2000_METHOD, crcReplay_crc8Cdma2000Calculate},
+#endif
+#if defined(CRC_CRC8_DARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DARC_LOOP_METHOD)
+    {CRC_VARIANT_CRC8_DARC, 0, CRC_REPLAY_CRC8_DARC_METHOD, crcReplay_crc8DarcCalculate},
+#endif
+#if defined(CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DVB_S2_LOOP_METHOD)
+    {CRC_VARIANT_CRC8_DVB_S2, 0, CRC_REPLAY_CRC8_DVB_S2_METHOD, crcReplay_crc8DvbS2Calculate},
+#endif
+#if defined(CRC_CRC8_EBU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_EBU_LOOP_METHOD)
+    {CRC_VARIANT_CRC8_EBU, 0, CRC_REPLAY_CRC8_EBU_METHOD, crcReplay_crc8EbuCalculate},
+#endif
+#if defined(CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_I_CODE_LOOP_METHOD)
+    {CRC_VARIANT_CRC8_I_CODE, 0, CRC_REPLAY_CRC8_I_CODE_METHOD, crcReplay_crc8ICodeCalculate},
+#endif
+#if defined(CRC_CRC8_ITU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ITU_LOOP_METHOD)
+    {CRC_VARIANT_CRC8_ITU, 0, CRC_REPLAY_CRC8_ITU_METHOD, crcReplay_crc8ItuCalculate},
+#endif
+#if defined(CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_MAXIM_LOOP_METHOD)
+    {CRC_VARIANT_CRC8_MAXIM, 0, CRC_REPLAY_CRC8_MAXIM_METHOD, crcReplay_crc8MaximCalculate},
+#endif
+#if defined(CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ROHC_LOOP_METHOD)
+    {CRC_VARIANT_CRC8_ROHC, 0, CRC_REPLAY_CRC8_ROHC_METHOD, crcReplay_crc8RohcCalculate},
+#endif
+#if defined(CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_WCDMA_LOOP_METHOD)
+    {CRC_VARIANT_CRC8_WCDMA, 0, CRC_REPLAY_CRC8_WCDMA_METHOD, crcReplay_crc8WcdmaCalculate},
+#endif
+#if defined(CRC_CRC16_ARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_ARC_LOOP_METHOD)
+    {CRC_VARIANT_CRC16_ARC, 0, CRC_REPLAY_CRC16_ARC_METHOD, crcReplay_crc16ArcCalculate},
+#endif
+#if defined(CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_CCITT_FALSE_LOOP_METHOD)
+    {CRC_VARIANT_CRC16_CCITT_FALSE, 0, CRC_REPLAY_CRC16_CCITT_FALSE_METHOD, crcReplay_crc16CcittFalseCalculate},
+#endif
+};
+
+/****************************************************************************************************
+ * Variables
+ ****************************************************************************************************/
+
+/*** Result Sink (Keeps Kernels From Being Optimized Away) ***/
+static volatile uint16_t crcReplay_sink;
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   main
+ * BRIEF:   CRC Trace-Driven Workload Replay Tool Main Entry
+ * RETURN:  int: Success Or Failure Status
+ * ARG:     argc: Number Of Arguments
+ * ARG:     argv: Argument String List
+ * NOTE:    Command Line Options:
+ *              -r [count]: Replay Trace [count] Times (Default: 1)
+ *              -p [bytes]: Buffer Pool Length (Default: 16 MiB; Messages Start At Random Offsets)
+ *              -s [seed]: Random Seed For Shuffle, Offsets And Data (Default: 1)
+ *              [trace]: Trace File ("-" Or Omitted For Standard Input)
+ *          Trace Lines Are "[variant] [length] [count]" (count Defaults To 1, So Both Raw Event Logs
+ *          And Exported Size Histograms Replay); Blank Lines And Lines Starting With # Are Skipped.
+ *          Events Are Shuffled Once So Histograms Do Not Replay In Sorted Order. Output Is CSV Per
+ *          Variant Plus An "all" Row; Throughput Counts Time Inside Calculate Only.
+ ****************************************************************************************************/
+int main(int argc, const char *argv[])
+{
+    crc_replay_event_t *event = NULL, swap;
+    crc_replay_latency_t *latency;
+    uint64_t *ticks, bytes, nanoseconds, seed = 1, start, state;
+    unsigned long poolLength = CRC_REPLAY_POOL_LENGTH, repeat = 1, r;
+    const char *traceName = "-";
+    double nanosecondsPerTick;
+    size_t count, e, eventCount = 0, first, i, k, latencyCount;
+    uint8_t *pool;
+    FILE *trace;
+    int a;
+    
+    /*** Parse Arguments ***/
+    for(a = 1; a < argc; a++)
+    {
+        if((strcmp(argv[a], "-r") == 0) && ((a + 1) < argc))
+        {
+            repeat = strtoul(argv[++a], NULL, 0);
+        }
+        else if((strcmp(argv[a], "-p") == 0) && ((a + 1) < argc))
+        {
+            poolLength = strtoul(argv[++a], NULL, 0);
+        }
+        else if((strcmp(argv[a], "-s") == 0) && ((a + 1) < argc))
+        {
+            seed = strtoull(argv[++a], NULL, 0);
+        }
+        else
+        {
+            traceName = argv[a];
+        }
+    }
+    if((repeat == 0) || (poolLength <= UINT16_MAX))
+    {
+        crcReplay_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    
+    /*** Read Trace ***/
+    trace = (strcmp(traceName, "-") == 0) ? stdin : fopen(traceName, "r");
+    if(trace == NULL)
+    {
+        fprintf(stderr, "Cannot Open Trace: %s\n", traceName);
+        return EXIT_FAILURE;
+    }
+    if(!crcReplay_readTrace(trace, &event, &eventCount) || (eventCount == 0))
+    {
+        if(trace != stdin)
+            (void)fclose(trace);
+        free(event);
+        crcReplay_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    if(trace != stdin)
+        (void)fclose(trace);
+    
+    /*** Synthesize Buffers, Shuffle Events And Pick Offsets ***/
+    latencyCount = eventCount * repeat;
+    pool = malloc(poolLength);
+    latency = malloc(latencyCount * sizeof(*latency));
+    ticks = malloc(latencyCount * sizeof(*ticks));
+    if((pool == NULL) || (latency == NULL) || (ticks == NULL))
+    {
+        free(ticks);
+        free(latency);
+        free(pool);
+        free(event);
+        return EXIT_FAILURE;
+    }
+    state = seed;
+    for(i = 0; i < poolLength; i++)
+        pool[i] = (uint8_t)crcReplay_random(&state);
+    for(e = eventCount - 1; e > 0; e--)
+    {
+        k = (size_t)(crcReplay_random(&state) % (e + 1));
+        swap = event[e];
+        event[e] = event[k];
+        event[k] = swap;
+    }
+    for(e = 0; e < eventCount; e++)
+        event[e].offset = (uint32_t)(crcReplay_random(&state) % (poolLength - event[e].length + 1U));
+    
+    /*** Replay, Timing Each Call ***/
+    nanoseconds = crcReplay_nanoseconds();
+    start = crcReplay_ticks();
+    for(r = 0, i = 0; r < repeat; r++)
+    {
+        for(e = 0; e < eventCount; e++, i++)
+        {
+            latency[i].variant = event[e].kernel->variant;
+            latency[i].ticks = crcReplay_ticks();
+            crcReplay_sink = event[e].kernel->calculate(&pool[event[e].offset], event[e].length);
+            latency[i].ticks = crcReplay_ticks() - latency[i].ticks;
+        }
+    }
+    nanosecondsPerTick = (double)(crcReplay_nanoseconds() - nanoseconds) / (double)(crcReplay_ticks() - start);
+    
+    /*** Report All Calls, Then Each Variant ***/
+    printf("variant,method,calls,bytes,mb_per_s,p50_ns,p99_ns,p999_ns\n");
+    bytes = 0;
+    for(e = 0; e < eventCount; e++)
+        bytes += event[e].length;
+    for(i = 0; i < latencyCount; i++)
+        ticks[i] = latency[i].ticks;
+    crcReplay_report("all", "-", ticks, latencyCount, bytes * repeat, nanosecondsPerTick);
+    qsort(latency, latencyCount, sizeof(*latency), crcReplay_compareLatency);
+    for(k = 0; k < (sizeof(crcReplay_kernel) / sizeof(crcReplay_kernel[0])); k++)
+    {
+        bytes = 0;
+        for(e = 0; e < eventCount; e++)
+        {
+            if(event[e].kernel == &crcReplay_kernel[k])
+                bytes += event[e].length;
+        }
+        for(first = 0; (first < latencyCount) && (latency[first].variant != crcReplay_kernel[k].variant); first++)
+            continue;
+        for(count = 0; ((first + count) < latencyCount) && (latency[first + count].variant == crcReplay_kernel[k].variant); count++)
+            ticks[count] = latency[first + count].ticks;
+        if(count != 0)
+            crcReplay_report(crc_variantName(crcReplay_kernel[k].variant), crcReplay_kernel[k].method, ticks, count, bytes * repeat, nanosecondsPerTick);
+    }
+    
+    free(ticks);
+    free(latency);
+    free(pool);
+    free(event);
+    
+    return EXIT_SUCCESS;
+}
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   crcReplay_compareLatency
+ * BRIEF:   Order Latencies By Variant, Then Duration (qsort Comparator)
+ * RETURN:  int: Negative, Zero Or Positive
+ * ARG:     a: First Latency (crc_replay_latency_t)
+ * ARG:     b: Second Latency (crc_replay_latency_t)
+ ****************************************************************************************************/
+static int crcReplay_compareLatency(const void *a, const void *b)
+{
+    const crc_replay_latency_t *first = a, *second = b;
+    
+    if(first->variant != second->variant)
+        return (first->variant < second->variant) ? -1 : 1;
+    
+    return (first->ticks < second->ticks) ? -1 : ((first->ticks > second->ticks) ? 1 : 0);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcReplay_compareTicks
+ * BRIEF:   Order Durations (qsort Comparator)
+ * RETURN:  int: Negative, Zero Or Positive
+ * ARG:     a: First Duration (uint64_t)
+ * ARG:     b: Second Duration (uint64_t)
+ ****************************************************************************************************/
+static int crcReplay_compareTicks(const void *a, const void *b)
+{
+    const uint64_t *first = a, *second = b;
+    
+    return (*first < *second) ? -1 : ((*first > *second) ? 1 : 0);
+}
+
+#if defined(CRC_CRC8_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcReplay_crc8Calculate
+ * BRIEF:   CRC-8 Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcReplay_crc8Calculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8Calculate(Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_CDMA2000_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcReplay_crc8Cdma2000Calculate
+ * BRIEF:   CRC-8/CDMA2000 Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcReplay_crc8Cdma2000Calculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8Cdma2000Calculate(Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC8_DARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DARC_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcReplay_crc8DarcCalculate
+ * BRIEF:   CRC-8/DARC Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcReplay_crc8DarcCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8DarcCalculate(Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_DVB_S2_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcReplay_crc8DvbS2Calculate
+ * BRIEF:   CRC-8/DVB-S2 Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcReplay_crc8DvbS2Calculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8DvbS2Calculate(Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC8_EBU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_EBU_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcReplay_crc8EbuCalculate
+ * BRIEF:   CRC-8/EBU Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcReplay_crc8EbuCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8EbuCalculate(Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_I_CODE_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcReplay_crc8ICodeCalculate
+ * BRIEF:   CRC-8/I-CODE Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcReplay_crc8ICodeCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8ICodeCalculate(Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC8_ITU_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ITU_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcReplay_crc8ItuCalculate
+ * BRIEF:   CRC-8/ITU Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcReplay_crc8ItuCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8ItuCalculate(Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_MAXIM_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcReplay_crc8MaximCalculate
+ * BRIEF:   CRC-8/MAXIM Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcReplay_crc8MaximCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8MaximCalculate(Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_ROHC_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcReplay_crc8RohcCalculate
+ * BRIEF:   CRC-8/ROHC Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcReplay_crc8RohcCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8RohcCalculate(Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD) || defined(CRC_CRC8_WCDMA_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcReplay_crc8WcdmaCalculate
+ * BRIEF:   CRC-8/WCDMA Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcReplay_crc8WcdmaCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8WcdmaCalculate(Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC16_ARC_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_ARC_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcReplay_crc16ArcCalculate
+ * BRIEF:   CRC-16/ARC Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcReplay_crc16ArcCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc16ArcCalculate(Data, DataLength);
+}
+#endif
+
+#if defined(CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD) || defined(CRC_CRC16_CCITT_FALSE_LOOP_METHOD)
+/****************************************************************************************************
+ * FUNCT:   crcReplay_crc16CcittFalseCalculate
+ * BRIEF:   CRC-16/CCITT-FALSE Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcReplay_crc16CcittFalseCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc16CcittFalseCalculate(Data, DataLength);
+}
+#endif
+
+/****************************************************************************************************
+ * FUNCT:   crcReplay_nanoseconds
+ * BRIEF:   Read Monotonic Clock
+ * RETURN:  uint64_t: Monotonic Time (Nanoseconds)
+ ****************************************************************************************************/
+static uint64_t crcReplay_nanoseconds(void)
+{
+    struct timespec now;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    
+    return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcReplay_percentile
+ * BRIEF:   Get Percentile Of Sorted Durations (Nearest Rank)
+ * RETURN:  uint64_t: Duration At Percentile
+ * ARG:     Ticks: Sorted Durations
+ * ARG:     Count: Number Of Durations
+ * ARG:     PerMille: Percentile In Tenths Of A Percent (E.g. 999 For p99.9)
+ ****************************************************************************************************/
+static uint64_t crcReplay_percentile(const uint64_t * const Ticks, const size_t Count, const uint32_t PerMille)
+{
+    size_t rank = (size_t)((((uint64_t)Count * PerMille) + 999U) / 1000U);
+    
+    return Ticks[(rank == 0) ? 0 : (rank - 1)];
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcReplay_readTrace
+ * BRIEF:   Read Trace Into Event List
+ * RETURN:  bool: True If Every Line Parsed
+ * ARG:     file: Trace File
+ * ARG:     event: Event List (Allocated; Caller Frees)
+ * ARG:     eventCount: Number Of Events
+ ****************************************************************************************************/
+static bool crcReplay_readTrace(FILE * const file, crc_replay_event_t **event, size_t * const eventCount)
+{
+    char line[CRC_REPLAY_LINE_LENGTH], name[CRC_REPLAY_LINE_LENGTH];
+    crc_replay_event_t *grown;
+    unsigned long count, length;
+    size_t capacity = 0, c, k;
+    int fields;
+    
+    /*** Parse [variant] [length] [count] Lines ***/
+    while(fgets(line, sizeof(line), file) != NULL)
+    {
+        count = 1;
+        fields = sscanf(line, "%255s %lu %lu", name, &length, &count);
+        if((fields <= 0) || (name[0] == '#'))
+            continue;
+        for(k = 0; (k < (sizeof(crcReplay_kernel) / sizeof(crcReplay_kernel[0]))) && (strcmp(name, crc_variantName(crcReplay_kernel[k].variant)) != 0); k++)
+            continue;
+        if((fields < 2) || (length > UINT16_MAX) || (k == (sizeof(crcReplay_kernel) / sizeof(crcReplay_kernel[0]))))
+        {
+            fprintf(stderr, "Invalid Or Uncompiled Trace Line: %s", line);
+            return false;
+        }
+    
+        /* Expand Histogram Count Into Events */
+        for(c = 0; c < count; c++)
+        {
+            if(*eventCount == capacity)
+            {
+                capacity = (capacity == 0) ? 1024 : (capacity * 2);
+                grown = realloc(*event, capacity * sizeof(**event));
+                if(grown == NULL)
+                    return false;
+                *event = grown;
+            }
+            (*event)[*eventCount].kernel = &crcReplay_kernel[k];
+            (*event)[*eventCount].length = (uint16_t)length;
+            (*event)[*eventCount].offset = 0;
+            (*eventCount)++;
+        }
+    }
+    
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcReplay_random
+ * BRIEF:   Generate 64-Bit Random Number (splitmix64)
+ * RETURN:  uint64_t: Random Number
+ * ARG:     state: Generator State
+ ****************************************************************************************************/
+static uint64_t crcReplay_random(uint64_t * const state)
+{
+    uint64_t z;
+    
+    *state += 0x9E3779B97F4A7C15ULL;
+    z = *state;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    
+    return z ^ (z >> 31);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcReplay_report
+ * BRIEF:   Print CSV Row Of Throughput And Latency Percentiles
+ * RETURN:  void: Returns Nothing
+ * ARG:     Name: Row Name (Variant Or "all")
+ * ARG:     Method: Compiled Method
+ * ARG:     ticks: Call Durations (Sorted In Place)
+ * ARG:     Count: Number Of Calls
+ * ARG:     Bytes: Bytes Processed By Calls
+ * ARG:     NanosecondsPerTick: Timestamp Tick Length
+ ****************************************************************************************************/
+static void crcReplay_report(const char * const Name, const char * const Method, uint64_t * const ticks, const size_t Count, const uint64_t Bytes, const double NanosecondsPerTick)
+{
+    uint64_t total = 0;
+    size_t i;
+    
+    /*** Sum And Sort Durations ***/
+    for(i = 0; i < Count; i++)
+        total += ticks[i];
+    qsort(ticks, Count, sizeof(*ticks), crcReplay_compareTicks);
+    
+    /*** Print Row ***/
+    printf("%s,%s,%zu,%" PRIu64 ",%.1f,%.1f,%.1f,%.1f\n", Name, Method, Count, Bytes, (total != 0) ? (((double)Bytes * 1000.0) / ((double)total * NanosecondsPerTick)) : 0.0,
+           (double)crcReplay_percentile(ticks, Count, 500) * NanosecondsPerTick, (double)crcReplay_percentile(ticks, Count, 990) * NanosecondsPerTick, (double)crcReplay_percentile(ticks, Count, 999) * NanosecondsPerTick);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcReplay_ticks
+ * BRIEF:   Read Timestamp
+ * RETURN:  uint64_t: Timestamp Counter (Monotonic Nanoseconds Where Unavailable)
+ ****************************************************************************************************/
+static uint64_t crcReplay_ticks(void)
+{
+#ifdef CRC_REPLAY_TSC
+    return (uint64_t)__rdtsc();
+#else
+    return crcReplay_nanoseconds();
+#endif
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcReplay_usage
+ * BRIEF:   Print Usage
+ * RETURN:  void: Returns Nothing
+ * ARG:     Name: Program Name
+ ****************************************************************************************************/
+static void crcReplay_usage(const char * const Name)
+{
+    /*** Print Usage ***/
+    printf("Usage: %s [-r repeat] [-p bytes] [-s seed] [trace]\n", Name);
+    printf("  trace Lines Are \"[variant] [length] [count]\" (E.g. \"CRC-16/ARC 1500 4096\")\n");
+}
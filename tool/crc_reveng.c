@@ -0,0 +1,246 @@
+/****************************************************************************************************
+ * FILE:    crc_reveng.c
+ * BRIEF:   CRC Parameter Reverse-Engineering Tool Source File
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Definitions
+ ****************************************************************************************************/
+
+#define CRC_REVENG_MAXIMUM_MODELS  (64)
+#define CRC_REVENG_MAXIMUM_SAMPLES (64)
+#define CRC_REVENG_MAXIMUM_THREADS (256)
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "crc.h"
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+/*** Search ***/
+typedef struct
+{
+    const crc_sample_t *sample;                   // Sample Messages With Their CRCs
+    uint16_t sampleCount;                         // Number Of Samples
+    uint16_t polynomialFirst;                     // First Polynomial To Search
+    uint16_t polynomialLast;                      // Last Polynomial To Search (Inclusive)
+    uint16_t modelCount;                          // Number Of Matching Models
+    uint8_t width;                                // CRC Width (8 Or 16 Bits)
+    uint8_t reserved[7];                          // Explicit Padding
+    crc_model_t model[CRC_REVENG_MAXIMUM_MODELS]; // Matching Models
+} crc_reveng_search_t;
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static bool crcReveng_parseSample(const char * const Argument, crc_sample_t * const sample);
+static void crcReveng_printModel(const crc_model_t * const Model);
+static void *crcReveng_search(void *argument);
+static void crcReveng_usage(const char * const Name);
+
+/****************************************************************************************************
+ * Function Definitions (Public)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   main
+ * BRIEF:   CRC Parameter Reverse-Engineering Tool Main Entry
+ * RETURN:  int: Success Or Failure Status
+ * ARG:     argc: Number Of Arguments
+ * ARG:     argv: Argument String List
+ * NOTE:    Command Line Options:
+ *              -w [width]: Search Only CRC Width [width] (8 Or 16; Default: Both)
+ *              -t [count]: Search With [count] Threads (Default: Number Of Online Processors)
+ *              [message]:[crc]: Sample Message And Its CRC (Both Hexadecimal)
+ ****************************************************************************************************/
+int main(int argc, const char *argv[])
+{
+    static crc_reveng_search_t search[CRC_REVENG_MAXIMUM_THREADS];
+    crc_model_t model[CRC_VARIANT_COUNT];
+    crc_sample_t sample[CRC_REVENG_MAXIMUM_SAMPLES];
+    pthread_t thread[CRC_REVENG_MAXIMUM_THREADS];
+    uint32_t first, last, span;
+    uint16_t count, i, j, sampleCount = 0;
+    long threadCount;
+    uint8_t width, widthFirst = 8, widthLast = 16;
+    int a;
+    
+    /*** Parse Arguments ***/
+    threadCount = sysconf(_SC_NPROCESSORS_ONLN);
+    for(a = 1; a < argc; a++)
+    {
+        if((strcmp(argv[a], "-w") == 0) && ((a + 1) < argc))
+        {
+            widthFirst = widthLast = (uint8_t)strtoul(argv[++a], NULL, 0);
+            if((widthFirst != 8) && (widthFirst != 16))
+            {
+                crcReveng_usage(argv[0]);
+                return EXIT_FAILURE;
+            }
+        }
+        else if((strcmp(argv[a], "-t") == 0) && ((a + 1) < argc))
+        {
+            threadCount = strtol(argv[++a], NULL, 0);
+        }
+        else if((sampleCount >= CRC_REVENG_MAXIMUM_SAMPLES) || !crcReveng_parseSample(argv[a], &sample[sampleCount++]))
+        {
+            crcReveng_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if(sampleCount == 0)
+    {
+        crcReveng_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    if(threadCount < 1)
+        threadCount = 1;
+    else if(threadCount > CRC_REVENG_MAXIMUM_THREADS)
+        threadCount = CRC_REVENG_MAXIMUM_THREADS;
+    
+    /*** Report Preset Matches First ***/
+    count = crc_reversePreset(sample, sampleCount, model, CRC_VARIANT_COUNT);
+    printf("Preset Matches: %u\n", count);
+    for(i = 0; i < count; i++)
+        crcReveng_printModel(&model[i]);
+    
+    /*** Search Polynomials Of Each Width Across Threads ***/
+    for(width = widthFirst; width <= widthLast; width = (uint8_t)(width + 8))
+    {
+        span = (uint32_t)(((1UL << width) + (uint32_t)threadCount - 1UL) / (uint32_t)threadCount);
+        for(i = 0; i < threadCount; i++)
+        {
+            first = i * span;
+            last = first + span - 1U;
+            if(last >= (1UL << width))
+                last = (uint32_t)((1UL << width) - 1UL);
+            search[i].sample = sample;
+            search[i].sampleCount = sampleCount;
+            search[i].width = width;
+            search[i].polynomialFirst = (uint16_t)first;
+            search[i].polynomialLast = (uint16_t)last;
+            search[i].modelCount = 0;
+            if((first > last) || (pthread_create(&thread[i], NULL, crcReveng_search, &search[i]) != 0))
+                search[i].sampleCount = 0;
+        }
+        count = 0;
+        for(i = 0; i < threadCount; i++)
+        {
+            if(search[i].sampleCount != 0)
+                (void)pthread_join(thread[i], NULL);
+            count = (uint16_t)(count + search[i].modelCount);
+        }
+    
+        /* Report Matches In Polynomial Order */
+        printf("CRC-%u Matches: %u\n", width, count);
+        for(i = 0; i < threadCount; i++)
+        {
+            for(j = 0; (j < search[i].modelCount) && (j < CRC_REVENG_MAXIMUM_MODELS); j++)
+                crcReveng_printModel(&search[i].model[j]);
+        }
+    }
+    
+    return EXIT_SUCCESS;
+}
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   crcReveng_parseSample
+ * BRIEF:   Parse Sample Argument
+ * RETURN:  bool: True If Sample Parsed
+ * ARG:     Argument: Sample Argument ([message]:[crc], Both Hexadecimal)
+ * ARG:     sample: Parsed Sample (Message Is Allocated)
+ ****************************************************************************************************/
+static bool crcReveng_parseSample(const char * const Argument, crc_sample_t * const sample)
+{
+    const char *separator;
+    char byte[3] = {0};
+    uint8_t *data;
+    size_t i, length;
+    
+    /*** Split Message And CRC ***/
+    separator = strchr(Argument, ':');
+    if((separator == NULL) || (((separator - Argument) % 2) != 0) || (((separator - Argument) / 2) > UINT16_MAX))
+        return false;
+    length = (size_t)(separator - Argument) / 2;
+    
+    /*** Parse Message ***/
+    data = malloc((length == 0) ? 1 : length);
+    if(data == NULL)
+        return false;
+    for(i = 0; i < length; i++)
+    {
+        byte[0] = Argument[2 * i];
+        byte[1] = Argument[(2 * i) + 1];
+        data[i] = (uint8_t)strtoul(byte, NULL, 16);
+    }
+    
+    /*** Parse CRC ***/
+    sample->data = data;
+    sample->length = (uint16_t)length;
+    sample->crc = (uint16_t)strtoul(separator + 1, NULL, 16);
+    
+    return true;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcReveng_printModel
+ * BRIEF:   Print CRC Model
+ * RETURN:  void: Returns Nothing
+ * ARG:     Model: CRC Model To Print
+ ****************************************************************************************************/
+static void crcReveng_printModel(const crc_model_t * const Model)
+{
+    int digits = Model->width / 4;
+    
+    /*** Print Model (And Preset Name) ***/
+    printf("  width=%u poly=0x%0*X init=0x%0*X refin=%s refout=%s xorout=0x%0*X", Model->width, digits, Model->polynomial, digits, Model->initial, Model->reflectIn ? "true" : "false", Model->reflectOut ? "true" : "false", digits, Model->xorOut);
+    if(Model->variant < CRC_VARIANT_COUNT)
+        printf(" (%s)", crc_variantName(Model->variant));
+    printf("\n");
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcReveng_search
+ * BRIEF:   Search Polynomial Range (Thread Entry)
+ * RETURN:  void *: Returns NULL
+ * ARG:     argument: Search Range And Results (crc_reveng_search_t)
+ ****************************************************************************************************/
+static void *crcReveng_search(void *argument)
+{
+    crc_reveng_search_t *search = argument;
+    
+    /*** Search Polynomial Range ***/
+    search->modelCount = crc_reverseSearch(search->sample, search->sampleCount, search->width, search->polynomialFirst, search->polynomialLast, search->model, CRC_REVENG_MAXIMUM_MODELS);
+    
+    return NULL;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcReveng_usage
+ * BRIEF:   Print Usage
+ * RETURN:  void: Returns Nothing
+ * ARG:     Name: Program Name
+ ****************************************************************************************************/
+static void crcReveng_usage(const char * const Name)
+{
+    /*** Print Usage ***/
+    printf("Usage: %s [-w 8|16] [-t threads] message:crc [message:crc ...]\n", Name);
+    printf("  message And crc Are Hexadecimal (E.g. 313233343536373839:29B1)\n");
+}
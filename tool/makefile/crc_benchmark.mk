@@ -0,0 +1,94 @@
+####################################################################################################
+# Targets
+####################################################################################################
+
+BUILD_DIRECTORY := ../build
+LOOP_EXECUTABLE := crc_benchmark_loop.exe
+LOOKUP_TABLE_EXECUTABLE := crc_benchmark_lookup_table.exe
+
+####################################################################################################
+# Defines
+####################################################################################################
+
+LOOP_DEFINES :=                       \
+  -DCRC_CRC8_LOOP_METHOD              \
+  -DCRC_CRC8_CDMA2000_LOOP_METHOD     \
+  -DCRC_CRC8_DARC_LOOP_METHOD         \
+  -DCRC_CRC8_DVB_S2_LOOP_METHOD       \
+  -DCRC_CRC8_EBU_LOOP_METHOD          \
+  -DCRC_CRC8_I_CODE_LOOP_METHOD       \
+  -DCRC_CRC8_ITU_LOOP_METHOD          \
+  -DCRC_CRC8_MAXIM_LOOP_METHOD        \
+  -DCRC_CRC8_ROHC_LOOP_METHOD         \
+  -DCRC_CRC8_WCDMA_LOOP_METHOD        \
+  -DCRC_CRC16_ARC_LOOP_METHOD         \
+  -DCRC_CRC16_CCITT_FALSE_LOOP_METHOD
+
+LOOKUP_TABLE_DEFINES :=                       \
+  -DCRC_CRC8_LOOKUP_TABLE_METHOD              \
+  -DCRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD     \
+  -DCRC_CRC8_DARC_LOOKUP_TABLE_METHOD         \
+  -DCRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD       \
+  -DCRC_CRC8_EBU_LOOKUP_TABLE_METHOD          \
+  -DCRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD       \
+  -DCRC_CRC8_ITU_LOOKUP_TABLE_METHOD          \
+  -DCRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD        \
+  -DCRC_CRC8_ROHC_LOOKUP_TABLE_METHOD         \
+  -DCRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD        \
+  -DCRC_CRC16_ARC_LOOKUP_TABLE_METHOD         \
+  -DCRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD
+
+####################################################################################################
+# Include Paths
+####################################################################################################
+
+APPLICATION_INCLUDE_PATHS := \
+  -I../../crc/
+
+####################################################################################################
+# Compiler Flags
+####################################################################################################
+
+APPLICATION_COMPILER_FLAGS := \
+  -O2                         \
+  -Weverything
+
+####################################################################################################
+# Sources
+####################################################################################################
+
+APPLICATION_SOURCES := \
+  ../crc_benchmark.c    \
+  ../../crc/crc.c
+
+####################################################################################################
+# Rules
+####################################################################################################
+
+all: $(BUILD_DIRECTORY)
+	@echo "Building Executable: $(LOOP_EXECUTABLE)"
+	@clang -c $(LOOP_DEFINES) $(APPLICATION_COMPILER_FLAGS) $(APPLICATION_INCLUDE_PATHS) $(APPLICATION_SOURCES)
+	@clang *.o -o $(LOOP_EXECUTABLE)
+	@mv $(LOOP_EXECUTABLE) $(BUILD_DIRECTORY)
+	@rm -f *.o
+	@echo "Building Executable: $(LOOKUP_TABLE_EXECUTABLE)"
+	@clang -c $(LOOKUP_TABLE_DEFINES) $(APPLICATION_COMPILER_FLAGS) $(APPLICATION_INCLUDE_PATHS) $(APPLICATION_SOURCES)
+	@clang *.o -o $(LOOKUP_TABLE_EXECUTABLE)
+	@mv $(LOOKUP_TABLE_EXECUTABLE) $(BUILD_DIRECTORY)
+	@rm -f *.o
+
+run: all
+	@echo "Running Benchmark: $(LOOP_EXECUTABLE)"
+	@./$(BUILD_DIRECTORY)/$(LOOP_EXECUTABLE) > $(BUILD_DIRECTORY)/crc_benchmark_loop.json
+	@echo "Running Benchmark: $(LOOKUP_TABLE_EXECUTABLE)"
+	@./$(BUILD_DIRECTORY)/$(LOOKUP_TABLE_EXECUTABLE) > $(BUILD_DIRECTORY)/crc_benchmark_lookup_table.json
+
+$(BUILD_DIRECTORY):
+	@mkdir $(BUILD_DIRECTORY)
+
+clean: FORCE
+	@rm -f *.exe.stackdump
+	@rm -f *.o
+	@rm -fr $(BUILD_DIRECTORY)
+
+FORCE:
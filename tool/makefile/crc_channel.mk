@@ -0,0 +1,70 @@
+####################################################################################################
+# Targets
+####################################################################################################
+
+BUILD_DIRECTORY := ../build
+EXECUTABLE := crc_channel.exe
+
+####################################################################################################
+# Defines
+####################################################################################################
+
+APPLICATION_DEFINES :=                        \
+  -DCRC_CRC8_LOOKUP_TABLE_METHOD              \
+  -DCRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD     \
+  -DCRC_CRC8_DARC_LOOKUP_TABLE_METHOD         \
+  -DCRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD       \
+  -DCRC_CRC8_EBU_LOOKUP_TABLE_METHOD          \
+  -DCRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD       \
+  -DCRC_CRC8_ITU_LOOKUP_TABLE_METHOD          \
+  -DCRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD        \
+  -DCRC_CRC8_ROHC_LOOKUP_TABLE_METHOD         \
+  -DCRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD        \
+  -DCRC_CRC16_ARC_LOOKUP_TABLE_METHOD         \
+  -DCRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD \
+  -DCRC_REVERSE
+
+####################################################################################################
+# Include Paths
+####################################################################################################
+
+APPLICATION_INCLUDE_PATHS := \
+  -I../../crc/
+
+####################################################################################################
+# Compiler Flags
+####################################################################################################
+
+APPLICATION_COMPILER_FLAGS := \
+  -O2                         \
+  -pthread                    \
+  -Weverything
+
+####################################################################################################
+# Sources
+####################################################################################################
+
+APPLICATION_SOURCES := \
+  ../crc_channel.c      \
+  ../../crc/crc.c
+
+####################################################################################################
+# Rules
+####################################################################################################
+
+all: $(BUILD_DIRECTORY)
+	@echo "Building Executable: $(EXECUTABLE)"
+	@clang -c $(APPLICATION_DEFINES) $(APPLICATION_COMPILER_FLAGS) $(APPLICATION_INCLUDE_PATHS) $(APPLICATION_SOURCES)
+	@clang -pthread *.o -o $(EXECUTABLE) -lm
+	@mv $(EXECUTABLE) $(BUILD_DIRECTORY)
+	@rm -f *.o
+
+$(BUILD_DIRECTORY):
+	@mkdir $(BUILD_DIRECTORY)
+
+clean: FORCE
+	@rm -f *.exe.stackdump
+	@rm -f *.o
+	@rm -fr $(BUILD_DIRECTORY)
+
+FORCE:
@@ -0,0 +1,108 @@
+####################################################################################################
+# Targets
+####################################################################################################
+
+BUILD_DIRECTORY := ../build
+LOOP_EXECUTABLE := crc_fuzz_loop.exe
+LOOKUP_TABLE_EXECUTABLE := crc_fuzz_lookup_table.exe
+LIBFUZZER_EXECUTABLE := crc_fuzz_libfuzzer.exe
+
+####################################################################################################
+# Defines
+####################################################################################################
+
+LOOP_DEFINES :=                       \
+  -DCRC_CRC8_LOOP_METHOD              \
+  -DCRC_CRC8_CDMA2000_LOOP_METHOD     \
+  -DCRC_CRC8_DARC_LOOP_METHOD         \
+  -DCRC_CRC8_DVB_S2_LOOP_METHOD       \
+  -DCRC_CRC8_EBU_LOOP_METHOD          \
+  -DCRC_CRC8_I_CODE_LOOP_METHOD       \
+  -DCRC_CRC8_ITU_LOOP_METHOD          \
+  -DCRC_CRC8_MAXIM_LOOP_METHOD        \
+  -DCRC_CRC8_ROHC_LOOP_METHOD         \
+  -DCRC_CRC8_WCDMA_LOOP_METHOD        \
+  -DCRC_CRC16_ARC_LOOP_METHOD         \
+  -DCRC_CRC16_CCITT_FALSE_LOOP_METHOD \
+  -DCRC_REVERSE
+
+LOOKUP_TABLE_DEFINES :=                       \
+  -DCRC_CRC8_LOOKUP_TABLE_METHOD              \
+  -DCRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD     \
+  -DCRC_CRC8_DARC_LOOKUP_TABLE_METHOD         \
+  -DCRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD       \
+  -DCRC_CRC8_EBU_LOOKUP_TABLE_METHOD          \
+  -DCRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD       \
+  -DCRC_CRC8_ITU_LOOKUP_TABLE_METHOD          \
+  -DCRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD        \
+  -DCRC_CRC8_ROHC_LOOKUP_TABLE_METHOD         \
+  -DCRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD        \
+  -DCRC_CRC16_ARC_LOOKUP_TABLE_METHOD         \
+  -DCRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD \
+  -DCRC_REVERSE
+
+####################################################################################################
+# Include Paths
+####################################################################################################
+
+APPLICATION_INCLUDE_PATHS := \
+  -I../../crc/
+
+####################################################################################################
+# Compiler Flags
+####################################################################################################
+
+APPLICATION_COMPILER_FLAGS := \
+  -O2                         \
+  -Weverything
+
+LIBFUZZER_COMPILER_FLAGS :=           \
+  -DCRC_FUZZ_LIBFUZZER                \
+  -fsanitize=fuzzer,address,undefined
+
+####################################################################################################
+# Sources
+####################################################################################################
+
+APPLICATION_SOURCES := \
+  ../crc_fuzz.c         \
+  ../../crc/crc.c
+
+####################################################################################################
+# Rules
+####################################################################################################
+
+all: $(BUILD_DIRECTORY)
+	@echo "Building Executable: $(LOOP_EXECUTABLE)"
+	@clang -c $(LOOP_DEFINES) $(APPLICATION_COMPILER_FLAGS) $(APPLICATION_INCLUDE_PATHS) $(APPLICATION_SOURCES)
+	@clang *.o -o $(LOOP_EXECUTABLE)
+	@mv $(LOOP_EXECUTABLE) $(BUILD_DIRECTORY)
+	@rm -f *.o
+	@echo "Building Executable: $(LOOKUP_TABLE_EXECUTABLE)"
+	@clang -c $(LOOKUP_TABLE_DEFINES) $(APPLICATION_COMPILER_FLAGS) $(APPLICATION_INCLUDE_PATHS) $(APPLICATION_SOURCES)
+	@clang *.o -o $(LOOKUP_TABLE_EXECUTABLE)
+	@mv $(LOOKUP_TABLE_EXECUTABLE) $(BUILD_DIRECTORY)
+	@rm -f *.o
+
+run: all
+	@echo "Running Fuzzer: $(LOOP_EXECUTABLE)"
+	@./$(BUILD_DIRECTORY)/$(LOOP_EXECUTABLE)
+	@echo "Running Fuzzer: $(LOOKUP_TABLE_EXECUTABLE)"
+	@./$(BUILD_DIRECTORY)/$(LOOKUP_TABLE_EXECUTABLE)
+
+libfuzzer: $(BUILD_DIRECTORY)
+	@echo "Building Executable: $(LIBFUZZER_EXECUTABLE)"
+	@clang -c $(LOOKUP_TABLE_DEFINES) $(APPLICATION_COMPILER_FLAGS) $(LIBFUZZER_COMPILER_FLAGS) $(APPLICATION_INCLUDE_PATHS) $(APPLICATION_SOURCES)
+	@clang -fsanitize=fuzzer,address,undefined *.o -o $(LIBFUZZER_EXECUTABLE)
+	@mv $(LIBFUZZER_EXECUTABLE) $(BUILD_DIRECTORY)
+	@rm -f *.o
+
+$(BUILD_DIRECTORY):
+	@mkdir $(BUILD_DIRECTORY)
+
+clean: FORCE
+	@rm -f *.exe.stackdump
+	@rm -f *.o
+	@rm -fr $(BUILD_DIRECTORY)
+
+FORCE:
@@ -54,4 +54,8 @@ static void main_runTestGroups(void)
 {
     /*** Run Test Groups ***/
     RUN_TEST_GROUP(crc_test)
+    
+    /*** Run Performance Test Group Only When Selected (-g crc_perf_test) ***/
+    if(UnityFixture.GroupFilter != NULL)
+        RUN_TEST_GROUP(crc_perf_test)
 }
@@ -22,7 +22,12 @@ APPLICATION_DEFINES :=                \
   -DCRC_CRC8_ROHC_LOOP_METHOD         \
   -DCRC_CRC8_WCDMA_LOOP_METHOD        \
   -DCRC_CRC16_ARC_LOOP_METHOD         \
-  -DCRC_CRC16_CCITT_FALSE_LOOP_METHOD
+  -DCRC_CRC16_CCITT_FALSE_LOOP_METHOD \
+  -DCRC_METRICS                       \
+  -DCRC_REVERSE                       \
+  -DCRC_JIT                           \
+  -DCRC_TABLE                         \
+  -DCRC_REGISTRY
 
 LIBRARY_DEFINES := 
 
@@ -42,6 +47,7 @@ LIBRARY_INCLUDE_PATHS := \
 ####################################################################################################
 
 APPLICATION_COMPILER_FLAGS := \
+  -pthread                    \
   -Weverything
 
 LIBRARY_COMPILER_FLAGS := \
@@ -51,9 +57,10 @@ LIBRARY_COMPILER_FLAGS := \
 # Sources
 ####################################################################################################
 
-APPLICATION_SOURCES := \
-  ../main.c            \
-  ../test/crc_test.c   \
+APPLICATION_SOURCES :=      \
+  ../main.c                 \
+  ../test/crc_perf_test.c   \
+  ../test/crc_test.c        \
   ../../crc/crc.c
 
 LIBRARY_SOURCES :=         \
@@ -67,7 +74,7 @@ LIBRARY_SOURCES :=         \
 all: $(BUILD_DIRECTORY)/$(LIBRARY)
 	@echo "Building Executable: $(EXECUTABLE)"
 	@clang -c $(APPLICATION_DEFINES) $(APPLICATION_COMPILER_FLAGS) $(APPLICATION_INCLUDE_PATHS) $(APPLICATION_SOURCES)
-	@clang *.o -o $(EXECUTABLE) $(BUILD_DIRECTORY)/$(LIBRARY)
+	@clang -pthread *.o -o $(EXECUTABLE) $(BUILD_DIRECTORY)/$(LIBRARY)
 	@mv $(EXECUTABLE) $(BUILD_DIRECTORY)
 	@rm -f *.o
 	@./$(BUILD_DIRECTORY)/$(EXECUTABLE)
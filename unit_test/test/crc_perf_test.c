@@ -0,0 +1,499 @@
+/****************************************************************************************************
+ * FILE:    crc_perf_test.c
+ * BRIEF:   Cyclic Redundancy Check (CRC) Performance Regression Test Source File
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * Definitions
+ ****************************************************************************************************/
+
+#define CRC_PERF_TEST_DATA_LENGTH (4096)
+#define CRC_PERF_TEST_RUNS        (5)
+#define CRC_PERF_TEST_RUN_TIME    (20000000ULL) // Nanoseconds
+
+/*** Reference ***/
+#define CRC_PERF_TEST_REFERENCE_POLYNOMIAL (0x07) // CRC-8 Polynomial, Bit At A Time
+
+/*** Method ***/
+#if defined(CRC_CRC8_LOOKUP_TABLE_METHOD)
+  #define CRC_PERF_TEST_CRC8_METHOD "lookup_table"
+#else
+  #define CRC_PERF_TEST_CRC8_METHOD "loop"
+#endif
+#if defined(CRC_CRC8_CDMA2000_LOOKUP_TABLE_METHOD)
+  #define CRC_PERF_TEST_CRC8_CDMA2000_METHOD "lookup_table"
+#else
+  #define CRC_PERF_TEST_CRC8_CDMA2000_METHOD "loop"
+#endif
+#if defined(CRC_CRC8_DARC_LOOKUP_TABLE_METHOD)
+  #define CRC_PERF_TEST_CRC8_DARC_METHOD "lookup_table"
+#else
+  #define CRC_PERF_TEST_CRC8_DARC_METHOD "loop"
+#endif
+#if defined(CRC_CRC8_DVB_S2_LOOKUP_TABLE_METHOD)
+  #define CRC_PERF_TEST_CRC8_DVB_S2_METHOD "lookup_table"
+#else
+  #define CRC_PERF_TEST_CRC8_DVB_S2_METHOD "loop"
+#endif
+#if defined(CRC_CRC8_EBU_LOOKUP_TABLE_METHOD)
+  #define CRC_PERF_TEST_CRC8_EBU_METHOD "lookup_table"
+#else
+  #define CRC_PERF_TEST_CRC8_EBU_METHOD "loop"
+#endif
+#if defined(CRC_CRC8_I_CODE_LOOKUP_TABLE_METHOD)
+  #define CRC_PERF_TEST_CRC8_I_CODE_METHOD "lookup_table"
+#else
+  #define CRC_PERF_TEST_CRC8_I_CODE_METHOD "loop"
+#endif
+#if defined(CRC_CRC8_ITU_LOOKUP_TABLE_METHOD)
+  #define CRC_PERF_TEST_CRC8_ITU_METHOD "lookup_table"
+#else
+  #define CRC_PERF_TEST_CRC8_ITU_METHOD "loop"
+#endif
+#if defined(CRC_CRC8_MAXIM_LOOKUP_TABLE_METHOD)
+  #define CRC_PERF_TEST_CRC8_MAXIM_METHOD "lookup_table"
+#else
+  #define CRC_PERF_TEST_CRC8_MAXIM_METHOD "loop"
+#endif
+#if defined(CRC_CRC8_ROHC_LOOKUP_TABLE_METHOD)
+  #define CRC_PERF_TEST_CRC8_ROHC_METHOD "lookup_table"
+#else
+  #define CRC_PERF_TEST_CRC8_ROHC_METHOD "loop"
+#endif
+#if defined(CRC_CRC8_WCDMA_LOOKUP_TABLE_METHOD)
+  #define CRC_PERF_TEST_CRC8_WCDMA_METHOD "lookup_table"
+#else
+  #define CRC_PERF_TEST_CRC8_WCDMA_METHOD "loop"
+#endif
+#if defined(CRC_CRC16_ARC_LOOKUP_TABLE_METHOD)
+  #define CRC_PERF_TEST_CRC16_ARC_METHOD "lookup_table"
+#else
+  #define CRC_PERF_TEST_CRC16_ARC_METHOD "loop"
+#endif
+#if defined(CRC_CRC16_CCITT_FALSE_LOOKUP_TABLE_METHOD)
+  #define CRC_PERF_TEST_CRC16_CCITT_FALSE_METHOD "lookup_table"
+#else
+  #define CRC_PERF_TEST_CRC16_CCITT_FALSE_METHOD "loop"
+#endif
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "crc.h"
+#include "crc_perf_test_baseline.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "unity_fixture.h"
+
+/****************************************************************************************************
+ * Function Prototypes
+ ****************************************************************************************************/
+
+static void crcPerfTest_assertThroughput(const crc_variant_t Variant, const char * const Method, uint16_t (*calculate)(const uint8_t * const Data, const uint16_t DataLength));
+static uint16_t crcPerfTest_crc8Calculate(const uint8_t * const Data, const uint16_t DataLength);
+static uint16_t crcPerfTest_crc8Cdma2000Calculate(const uint8_t * const Data, const uint16_t DataLength);
+static uint16_t crcPerfTest_crc8DarcCalculate(const uint8_t * const Data, const uint16_t DataLength);
+static uint16_t crcPerfTest_crc8DvbS2Calculate(const uint8_t * const Data, const uint16_t DataLength);
+static uint16_t crcPerfTest_crc8EbuCalculate(const uint8_t * const Data, const uint16_t DataLength);
+static uint16_t crcPerfTest_crc8ICodeCalculate(const uint8_t * const Data, const uint16_t DataLength);
+static uint16_t crcPerfTest_crc8ItuCalculate(const uint8_t * const Data, const uint16_t DataLength);
+static uint16_t crcPerfTest_crc8MaximCalculate(const uint8_t * const Data, const uint16_t DataLength);
+static uint16_t crcPerfTest_crc8RohcCalculate(const uint8_t * const Data, const uint16_t DataLength);
+static uint16_t crcPerfTest_crc8WcdmaCalculate(const uint8_t * const Data, const uint16_t DataLength);
+static uint16_t crcPerfTest_crc16ArcCalculate(const uint8_t * const Data, const uint16_t DataLength);
+static uint16_t crcPerfTest_crc16CcittFalseCalculate(const uint8_t * const Data, const uint16_t DataLength);
+static double crcPerfTest_measure(uint16_t (*calculate)(const uint8_t * const Data, const uint16_t DataLength));
+static uint64_t crcPerfTest_nanoseconds(void);
+static uint16_t crcPerfTest_referenceCalculate(const uint8_t * const Data, const uint16_t DataLength);
+
+/****************************************************************************************************
+ * Constants and Variables
+ ****************************************************************************************************/
+
+static uint8_t crcPerfTest_Data[CRC_PERF_TEST_DATA_LENGTH];
+static volatile uint16_t crcPerfTest_Sink;
+
+/****************************************************************************************************
+ * Test Group
+ ****************************************************************************************************/
+
+TEST_GROUP(crc_perf_test);
+
+/****************************************************************************************************
+ * Test Setup And Teardown
+ ****************************************************************************************************/
+
+TEST_SETUP(crc_perf_test)
+{
+    uint16_t i;
+    
+    /*** Fill Data With Known Pattern ***/
+    for(i = 0; i < sizeof(crcPerfTest_Data); i++)
+        crcPerfTest_Data[i] = (uint8_t)((i * 7) + 3);
+}
+
+TEST_TEAR_DOWN(crc_perf_test)
+{
+}
+
+/****************************************************************************************************
+ * Tests
+ ****************************************************************************************************/
+
+TEST(crc_perf_test, crc8Calculate)
+{
+    crcPerfTest_assertThroughput(CRC_VARIANT_CRC8, CRC_PERF_TEST_CRC8_METHOD, crcPerfTest_crc8Calculate);
+}
+
+TEST(crc_perf_test, crc8Cdma2000Calculate)
+{
+    crcPerfTest_assertThroughput(CRC_VARIANT_CRC8_CDMA2000, CRC_PERF_TEST_CRC8_CDMA2000_METHOD, crcPerfTest_crc8Cdma2000Calculate);
+}
+
+TEST(crc_perf_test, crc8DarcCalculate)
+{
+    crcPerfTest_assertThroughput(CRC_VARIANT_CRC8_DARC, CRC_PERF_TEST_CRC8_DARC_METHOD, crcPerfTest_crc8DarcCalculate);
+}
+
+TEST(crc_perf_test, crc8DvbS2Calculate)
+{
+    crcPerfTest_assertThroughput(CRC_VARIANT_CRC8_DVB_S2, CRC_PERF_TEST_CRC8_DVB_S2_METHOD, crcPerfTest_crc8DvbS2Calculate);
+}
+
+TEST(crc_perf_test, crc8EbuCalculate)
+{
+    crcPerfTest_assertThroughput(CRC_VARIANT_CRC8_EBU, CRC_PERF_TEST_CRC8_EBU_METHOD, crcPerfTest_crc8EbuCalculate);
+}
+
+TEST(crc_perf_test, crc8ICodeCalculate)
+{
+    crcPerfTest_assertThroughput(CRC_VARIANT_CRC8_I_CODE, CRC_PERF_TEST_CRC8_I_CODE_METHOD, crcPerfTest_crc8ICodeCalculate);
+}
+
+TEST(crc_perf_test, crc8ItuCalculate)
+{
+    crcPerfTest_assertThroughput(CRC_VARIANT_CRC8_ITU, CRC_PERF_TEST_CRC8_ITU_METHOD, crcPerfTest_crc8ItuCalculate);
+}
+
+TEST(crc_perf_test, crc8MaximCalculate)
+{
+    crcPerfTest_assertThroughput(CRC_VARIANT_CRC8_MAXIM, CRC_PERF_TEST_CRC8_MAXIM_METHOD, crcPerfTest_crc8MaximCalculate);
+}
+
+TEST(crc_perf_test, crc8RohcCalculate)
+{
+    crcPerfTest_assertThroughput(CRC_VARIANT_CRC8_ROHC, CRC_PERF_TEST_CRC8_ROHC_METHOD, crcPerfTest_crc8RohcCalculate);
+}
+
+TEST(crc_perf_test, crc8WcdmaCalculate)
+{
+    crcPerfTest_assertThroughput(CRC_VARIANT_CRC8_WCDMA, CRC_PERF_TEST_CRC8_WCDMA_METHOD, crcPerfTest_crc8WcdmaCalculate);
+}
+
+TEST(crc_perf_test, crc16ArcCalculate)
+{
+    crcPerfTest_assertThroughput(CRC_VARIANT_CRC16_ARC, CRC_PERF_TEST_CRC16_ARC_METHOD, crcPerfTest_crc16ArcCalculate);
+}
+
+TEST(crc_perf_test, crc16CcittFalseCalculate)
+{
+    crcPerfTest_assertThroughput(CRC_VARIANT_CRC16_CCITT_FALSE, CRC_PERF_TEST_CRC16_CCITT_FALSE_METHOD, crcPerfTest_crc16CcittFalseCalculate);
+}
+
+/****************************************************************************************************
+ * Test Group Runner
+ ****************************************************************************************************/
+
+TEST_GROUP_RUNNER(crc_perf_test)
+{
+    /*** CRC-8 ***/
+    RUN_TEST_CASE(crc_perf_test, crc8Calculate)
+    RUN_TEST_CASE(crc_perf_test, crc8Cdma2000Calculate)
+    RUN_TEST_CASE(crc_perf_test, crc8DarcCalculate)
+    RUN_TEST_CASE(crc_perf_test, crc8DvbS2Calculate)
+    RUN_TEST_CASE(crc_perf_test, crc8EbuCalculate)
+    RUN_TEST_CASE(crc_perf_test, crc8ICodeCalculate)
+    RUN_TEST_CASE(crc_perf_test, crc8ItuCalculate)
+    RUN_TEST_CASE(crc_perf_test, crc8MaximCalculate)
+    RUN_TEST_CASE(crc_perf_test, crc8RohcCalculate)
+    RUN_TEST_CASE(crc_perf_test, crc8WcdmaCalculate)
+    
+    /*** CRC-16 ***/
+    RUN_TEST_CASE(crc_perf_test, crc16ArcCalculate)
+    RUN_TEST_CASE(crc_perf_test, crc16CcittFalseCalculate)
+}
+
+/****************************************************************************************************
+ * Function Definitions (Private)
+ ****************************************************************************************************/
+
+/****************************************************************************************************
+ * FUNCT:   crcPerfTest_assertThroughput
+ * BRIEF:   Measure Kernel Throughput And Assert It Has Not Regressed Below Baseline
+ * RETURN:  void: Returns Nothing
+ * ARG:     Variant: CRC Variant
+ * ARG:     Method: Compiled Method ("loop" Or "lookup_table")
+ * ARG:     calculate: Calculate Kernel
+ * NOTE:    Throughput Is Compared As A Ratio To A Bitwise Reference Kernel Measured In The Same Runs,
+ *          So Machine Speed And Clock Frequency Cancel Out. Runs Alternate Reference And Kernel And
+ *          The Best Of CRC_PERF_TEST_RUNS Runs Of Each Is Kept, So Preemption Or Frequency Ramp In
+ *          A Single Run Does Not Fail The Test. Variants Without A Baseline Entry Are Ignored;
+ *          Measured Ratio Is Always Printed To Ease Rebaselining.
+ ****************************************************************************************************/
+static void crcPerfTest_assertThroughput(const crc_variant_t Variant, const char * const Method, uint16_t (*calculate)(const uint8_t * const Data, const uint16_t DataLength))
+{
+    const crc_perf_test_baseline_t *baseline = NULL;
+    double best = 0.0, minimum, ratio, reference = 0.0, throughput;
+    char message[160];
+    size_t b;
+    uint8_t run;
+    
+    /*** Find Baseline ***/
+    for(b = 0; b < (sizeof(crcPerfTest_Baseline) / sizeof(crcPerfTest_Baseline[0])); b++)
+    {
+        if((crcPerfTest_Baseline[b].variant == Variant) && (strcmp(crcPerfTest_Baseline[b].method, Method) == 0))
+            baseline = &crcPerfTest_Baseline[b];
+    }
+    
+    /*** Measure Best Throughput Of Reference And Kernel (MB/s) ***/
+    crcPerfTest_Sink = crcPerfTest_referenceCalculate(crcPerfTest_Data, sizeof(crcPerfTest_Data));
+    crcPerfTest_Sink = calculate(crcPerfTest_Data, sizeof(crcPerfTest_Data));
+    for(run = 0; run < CRC_PERF_TEST_RUNS; run++)
+    {
+        throughput = crcPerfTest_measure(crcPerfTest_referenceCalculate);
+        if(throughput > reference)
+            reference = throughput;
+        throughput = crcPerfTest_measure(calculate);
+        if(throughput > best)
+            best = throughput;
+    }
+    ratio = best / reference;
+    
+    /*** Compare Against Baseline ***/
+    if(baseline == NULL)
+    {
+        (void)snprintf(message, sizeof(message), "%s (%s): %.1f MB/s, %.2fx Reference; No Baseline", crc_variantName(Variant), Method, best, ratio);
+        TEST_IGNORE_MESSAGE(message);
+    }
+    else
+    {
+        minimum = (baseline->ratio * (100.0 - baseline->tolerance)) / 100.0;
+        (void)snprintf(message, sizeof(message), "%s (%s): %.1f MB/s, %.2fx Reference; Baseline %.2fx, Minimum %.2fx", crc_variantName(Variant), Method, best, ratio, baseline->ratio, minimum);
+        if(ratio < minimum)
+            TEST_FAIL_MESSAGE(message);
+        TEST_MESSAGE(message);
+    }
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcPerfTest_crc8Calculate
+ * BRIEF:   CRC-8 Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcPerfTest_crc8Calculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8Calculate(Data, DataLength);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcPerfTest_crc8Cdma2000Calculate
+ * BRIEF:   CRC-8/CDMA2000 Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcPerfTest_crc8Cdma2000Calculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8Cdma2000Calculate(Data, DataLength);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcPerfTest_crc8DarcCalculate
+ * BRIEF:   CRC-8/DARC Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcPerfTest_crc8DarcCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8DarcCalculate(Data, DataLength);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcPerfTest_crc8DvbS2Calculate
+ * BRIEF:   CRC-8/DVB-S2 Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcPerfTest_crc8DvbS2Calculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8DvbS2Calculate(Data, DataLength);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcPerfTest_crc8EbuCalculate
+ * BRIEF:   CRC-8/EBU Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcPerfTest_crc8EbuCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8EbuCalculate(Data, DataLength);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcPerfTest_crc8ICodeCalculate
+ * BRIEF:   CRC-8/I-CODE Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcPerfTest_crc8ICodeCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8ICodeCalculate(Data, DataLength);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcPerfTest_crc8ItuCalculate
+ * BRIEF:   CRC-8/ITU Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcPerfTest_crc8ItuCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8ItuCalculate(Data, DataLength);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcPerfTest_crc8MaximCalculate
+ * BRIEF:   CRC-8/MAXIM Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcPerfTest_crc8MaximCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8MaximCalculate(Data, DataLength);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcPerfTest_crc8RohcCalculate
+ * BRIEF:   CRC-8/ROHC Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcPerfTest_crc8RohcCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8RohcCalculate(Data, DataLength);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcPerfTest_crc8WcdmaCalculate
+ * BRIEF:   CRC-8/WCDMA Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcPerfTest_crc8WcdmaCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc8WcdmaCalculate(Data, DataLength);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcPerfTest_crc16ArcCalculate
+ * BRIEF:   CRC-16/ARC Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcPerfTest_crc16ArcCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc16ArcCalculate(Data, DataLength);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcPerfTest_crc16CcittFalseCalculate
+ * BRIEF:   CRC-16/CCITT-FALSE Calculate Kernel
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcPerfTest_crc16CcittFalseCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    return crc_crc16CcittFalseCalculate(Data, DataLength);
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcPerfTest_measure
+ * BRIEF:   Measure Throughput Of Kernel Over One Run
+ * RETURN:  double: Throughput (MB/s)
+ * ARG:     calculate: Calculate Kernel
+ ****************************************************************************************************/
+static double crcPerfTest_measure(uint16_t (*calculate)(const uint8_t * const Data, const uint16_t DataLength))
+{
+    uint64_t bytes = 0, elapsed, start;
+    
+    /*** Run Kernel For At Least CRC_PERF_TEST_RUN_TIME ***/
+    start = crcPerfTest_nanoseconds();
+    do
+    {
+        crcPerfTest_Sink = calculate(crcPerfTest_Data, sizeof(crcPerfTest_Data));
+        bytes += sizeof(crcPerfTest_Data);
+        elapsed = crcPerfTest_nanoseconds() - start;
+    } while(elapsed < CRC_PERF_TEST_RUN_TIME);
+    
+    return ((double)bytes * 1000.0) / (double)elapsed;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcPerfTest_nanoseconds
+ * BRIEF:   Read Monotonic Clock
+ * RETURN:  uint64_t: Monotonic Time (Nanoseconds)
+ ****************************************************************************************************/
+static uint64_t crcPerfTest_nanoseconds(void)
+{
+    struct timespec now;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    
+    return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcPerfTest_referenceCalculate
+ * BRIEF:   Reference Kernel (Bit At A Time CRC-8, Independent Of The Compiled Methods)
+ * RETURN:  uint16_t: CRC
+ * ARG:     Data: Data
+ * ARG:     DataLength: Data Length
+ ****************************************************************************************************/
+static uint16_t crcPerfTest_referenceCalculate(const uint8_t * const Data, const uint16_t DataLength)
+{
+    uint8_t bit, crc = 0x00;
+    uint16_t i;
+    
+    /*** Calculate CRC One Bit At A Time ***/
+    for(i = 0; i < DataLength; i++)
+    {
+        crc ^= Data[i];
+        for(bit = 0; bit < 8; bit++)
+        {
+            if((crc & 0x80) == 0x80)
+                crc = (uint8_t)((crc << 1) ^ CRC_PERF_TEST_REFERENCE_POLYNOMIAL);
+            else
+                crc <<= 1;
+        }
+    }
+    
+    return crc;
+}
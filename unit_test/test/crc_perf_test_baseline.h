@@ -0,0 +1,73 @@
+/****************************************************************************************************
+ * FILE:    crc_perf_test_baseline.h
+ * BRIEF:   Cyclic Redundancy Check (CRC) Performance Regression Baseline Header File
+ * NOTE:    Throughput Of Each Variant's Calculate Over A 4 KiB Buffer As Built By crc_loop.mk And
+ *          crc_lookup_table.mk, As A Ratio To The Bitwise Reference Kernel Measured In The Same Run,
+ *          So The Baseline Holds Across Machines. Rebaseline From The Ratio Printed By
+ *          "-g crc_perf_test"; Tolerance Is The Allowed Drop In Percent.
+ ****************************************************************************************************/
+
+#ifndef CRC_PERF_TEST_BASELINE_H
+#define CRC_PERF_TEST_BASELINE_H
+
+/****************************************************************************************************
+ * Definitions
+ ****************************************************************************************************/
+
+#define CRC_PERF_TEST_BASELINE_TOLERANCE (25) // Percent
+
+/****************************************************************************************************
+ * Includes
+ ****************************************************************************************************/
+
+#include "crc.h"
+#include <stdint.h>
+
+/****************************************************************************************************
+ * Type Definitions
+ ****************************************************************************************************/
+
+typedef struct
+{
+    crc_variant_t variant;     // CRC Variant
+    const char *method;        // Method ("loop" Or "lookup_table")
+    double ratio;              // Baseline Throughput Relative To Reference Kernel
+    uint8_t tolerance;         // Allowed Drop Below Baseline (Percent)
+} crc_perf_test_baseline_t;
+
+/****************************************************************************************************
+ * Constants
+ ****************************************************************************************************/
+
+static const crc_perf_test_baseline_t crcPerfTest_Baseline[] =
+{
+    /* LOOP Method */
+    {CRC_VARIANT_CRC8, "loop", 0.95, CRC_PERF_TEST_BASELINE_TOLERANCE},
+    {CRC_VARIANT_CRC8_CDMA2000, "loop", 0.95, CRC_PERF_TEST_BASELINE_TOLERANCE},
+    {CRC_VARIANT_CRC8_DARC, "loop", 0.95, CRC_PERF_TEST_BASELINE_TOLERANCE},
+    {CRC_VARIANT_CRC8_DVB_S2, "loop", 1.00, CRC_PERF_TEST_BASELINE_TOLERANCE},
+    {CRC_VARIANT_CRC8_EBU, "loop", 0.95, CRC_PERF_TEST_BASELINE_TOLERANCE},
+    {CRC_VARIANT_CRC8_I_CODE, "loop", 0.90, CRC_PERF_TEST_BASELINE_TOLERANCE},
+    {CRC_VARIANT_CRC8_ITU, "loop", 0.95, CRC_PERF_TEST_BASELINE_TOLERANCE},
+    {CRC_VARIANT_CRC8_MAXIM, "loop", 0.95, CRC_PERF_TEST_BASELINE_TOLERANCE},
+    {CRC_VARIANT_CRC8_ROHC, "loop", 0.95, CRC_PERF_TEST_BASELINE_TOLERANCE},
+    {CRC_VARIANT_CRC8_WCDMA, "loop", 0.95, CRC_PERF_TEST_BASELINE_TOLERANCE},
+    {CRC_VARIANT_CRC16_ARC, "loop", 0.95, CRC_PERF_TEST_BASELINE_TOLERANCE},
+    {CRC_VARIANT_CRC16_CCITT_FALSE, "loop", 0.90, CRC_PERF_TEST_BASELINE_TOLERANCE},
+    
+    /* LOOKUP_TABLE Method */
+    {CRC_VARIANT_CRC8, "lookup_table", 4.30, CRC_PERF_TEST_BASELINE_TOLERANCE},
+    {CRC_VARIANT_CRC8_CDMA2000, "lookup_table", 3.80, CRC_PERF_TEST_BASELINE_TOLERANCE},
+    {CRC_VARIANT_CRC8_DARC, "lookup_table", 4.40, CRC_PERF_TEST_BASELINE_TOLERANCE},
+    {CRC_VARIANT_CRC8_DVB_S2, "lookup_table", 4.35, CRC_PERF_TEST_BASELINE_TOLERANCE},
+    {CRC_VARIANT_CRC8_EBU, "lookup_table", 3.90, CRC_PERF_TEST_BASELINE_TOLERANCE},
+    {CRC_VARIANT_CRC8_I_CODE, "lookup_table", 3.90, CRC_PERF_TEST_BASELINE_TOLERANCE},
+    {CRC_VARIANT_CRC8_ITU, "lookup_table", 4.35, CRC_PERF_TEST_BASELINE_TOLERANCE},
+    {CRC_VARIANT_CRC8_MAXIM, "lookup_table", 4.40, CRC_PERF_TEST_BASELINE_TOLERANCE},
+    {CRC_VARIANT_CRC8_ROHC, "lookup_table", 3.80, CRC_PERF_TEST_BASELINE_TOLERANCE},
+    {CRC_VARIANT_CRC8_WCDMA, "lookup_table", 4.35, CRC_PERF_TEST_BASELINE_TOLERANCE},
+    {CRC_VARIANT_CRC16_ARC, "lookup_table", 3.90, CRC_PERF_TEST_BASELINE_TOLERANCE},
+    {CRC_VARIANT_CRC16_CCITT_FALSE, "lookup_table", 2.95, CRC_PERF_TEST_BASELINE_TOLERANCE}
+};
+
+#endif
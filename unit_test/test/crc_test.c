@@ -23,14 +23,23 @@
 #define CRC_TEST_CRC16_ARC_CHECK         (0xBB3D)
 #define CRC_TEST_CRC16_CCITT_FALSE_CHECK (0x29B1)
 
+/*** Registry ***/
+#define CRC_TEST_REGISTRY_NAME_COUNT (24)          // Canonical Names And Aliases
+#define CRC_TEST_REGISTRY_SEED       (0x811C9DDEU) // Must Match CRC_REGISTRY_SEED
+#define CRC_TEST_REGISTRY_SLOT_BITS  (6)           // Must Match CRC_REGISTRY_SLOT_BITS
+
 /****************************************************************************************************
  * Includes
  ****************************************************************************************************/
 
 #include "crc.h"
+#include "crc_inline.h"
+#include <pthread.h>
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
 #include "unity_fixture.h"
 
 /****************************************************************************************************
@@ -38,6 +47,8 @@
  ****************************************************************************************************/
 
 static const uint8_t crcTest_CheckData[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+static const uint8_t crcTest_Delta[] = {0x5A, 0x3C, 0x81};
+static uint8_t crcTest_Data[1000];
  
 /****************************************************************************************************
  * Test Group
@@ -51,6 +62,11 @@ TEST_GROUP(crc_test);
 
 TEST_SETUP(crc_test)
 {
+    uint16_t i;
+    
+    /*** Fill Data With Known Pattern ***/
+    for(i = 0; i < sizeof(crcTest_Data); i++)
+        crcTest_Data[i] = (uint8_t)((i * 7) + 3);
 }
 
 TEST_TEAR_DOWN(crc_test)
@@ -92,354 +108,4899 @@ TEST(crc_test, crc8CalculatePartial)
     TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_CHECK, crc8);
 }
 
-TEST(crc_test, crc8Cdma2000Calculate)
-{
-    uint8_t crc8Cdma2000;
-    
-    /*** Error Check ***/
-    /* NULL Pointer */
-    crc8Cdma2000 = crc_crc8Cdma2000Calculate(NULL, sizeof(crcTest_CheckData));
-    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000, crc8Cdma2000);
-    
-    /* Zero Length Data */
-    crc8Cdma2000 = crc_crc8Cdma2000Calculate(crcTest_CheckData, 0);
-    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000, crc8Cdma2000);
-    
-    /*** Calculate CRC-8/CDMA2000 For Check Data; Verify Result As Expected ***/
-    crc8Cdma2000 = crc_crc8Cdma2000Calculate(crcTest_CheckData, sizeof(crcTest_CheckData));
-    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_CDMA2000_CHECK, crc8Cdma2000);
-}
-
-TEST(crc_test, crc8Cdma2000CalculatePartial)
+TEST(crc_test, crc8Step)
 {
-    uint8_t crc8Cdma2000, i;
+    uint8_t crc8, i;
     
     /*** Set Up ***/
-    crc8Cdma2000 = CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000;
+    crc8 = CRC_CRC8_INITIAL_CRC8;
     
-    /*** Calculate CRC-8/CDMA2000 For Check Data; Verify Result As Expected ***/
+    /*** Calculate CRC-8 For Check Data With Inline Step; Verify Result As Expected ***/
     for(i = 0; i < sizeof(crcTest_CheckData); i++)
-        crc8Cdma2000 = crc_crc8Cdma2000CalculatePartial(crcTest_CheckData[i], crc8Cdma2000);
-    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_CDMA2000_CHECK, crc8Cdma2000);
+        crc8 = crc_crc8Step(crcTest_CheckData[i], crc8);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_CHECK, crc8);
 }
 
-TEST(crc_test, crc8DarcCalculate)
+TEST(crc_test, crc8Modify)
 {
-    uint8_t crc8Darc;
+    uint8_t crc8;
+    uint8_t i;
+    
+    /*** Set Up ***/
+    crc8 = crc_crc8Calculate(crcTest_Data, sizeof(crcTest_Data));
     
     /*** Error Check ***/
     /* NULL Pointer */
-    crc8Darc = crc_crc8DarcCalculate(NULL, sizeof(crcTest_CheckData));
-    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_DARC_INITIAL_CRC8_DARC, crc8Darc);
+    TEST_ASSERT_EQUAL_HEX8(crc8, crc_crc8Modify(crc8, NULL, sizeof(crcTest_Delta), 0));
     
-    /* Zero Length Data */
-    crc8Darc = crc_crc8DarcCalculate(crcTest_CheckData, 0);
-    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_DARC_INITIAL_CRC8_DARC, crc8Darc);
+    /* Zero Length Delta */
+    TEST_ASSERT_EQUAL_HEX8(crc8, crc_crc8Modify(crc8, crcTest_Delta, 0, 0));
     
-    /*** Calculate CRC-8/DARC For Check Data; Verify Result As Expected ***/
-    crc8Darc = crc_crc8DarcCalculate(crcTest_CheckData, sizeof(crcTest_CheckData));
-    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_DARC_CHECK, crc8Darc);
+    /*** Modify Data In Place; Verify Updated CRC-8 Matches Full Calculation ***/
+    for(i = 0; i < sizeof(crcTest_Delta); i++)
+        crcTest_Data[100 + i] ^= crcTest_Delta[i];
+    crc8 = crc_crc8Modify(crc8, crcTest_Delta, sizeof(crcTest_Delta), sizeof(crcTest_Data) - 100 - sizeof(crcTest_Delta));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8Calculate(crcTest_Data, sizeof(crcTest_Data)), crc8);
+    
+    /*** Modify Final Data; Verify Updated CRC-8 Matches Full Calculation ***/
+    crcTest_Data[sizeof(crcTest_Data) - 1] ^= crcTest_Delta[0];
+    crc8 = crc_crc8Modify(crc8, crcTest_Delta, 1, 0);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8Calculate(crcTest_Data, sizeof(crcTest_Data)), crc8);
 }
 
-TEST(crc_test, crc8DarcCalculatePartial)
+TEST(crc_test, crc8ModifyBatch)
 {
-    uint8_t crc8Darc, i;
+    uint8_t crc8;
+    const crc_patch_t Patch[] = {{crcTest_Delta, 0, sizeof(crcTest_Delta), 0}, {crcTest_Delta, 500, 2, 0}, {crcTest_Delta, 999, 2, 0}};
+    uint8_t i;
     
     /*** Set Up ***/
-    crc8Darc = CRC_CRC8_DARC_INITIAL_CRC8_DARC;
+    crc8 = crc_crc8Calculate(crcTest_Data, sizeof(crcTest_Data));
     
-    /*** Calculate CRC-8/DARC For Check Data; Verify Result As Expected ***/
-    for(i = 0; i < (sizeof(crcTest_CheckData) - 1); i++)
-        crc8Darc = crc_crc8DarcCalculatePartial(crcTest_CheckData[i], crc8Darc, false);
-    crc8Darc = crc_crc8DarcCalculatePartial(crcTest_CheckData[i], crc8Darc, true);
-    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_DARC_CHECK, crc8Darc);
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8, crc_crc8ModifyBatch(crc8, NULL, 1, sizeof(crcTest_Data)));
+    
+    /*** Modify Data In Place (Final Patch Out Of Range); Verify Updated CRC-8 Matches Full Calculation ***/
+    for(i = 0; i < sizeof(crcTest_Delta); i++)
+        crcTest_Data[i] ^= crcTest_Delta[i];
+    for(i = 0; i < 2; i++)
+        crcTest_Data[500 + i] ^= crcTest_Delta[i];
+    crc8 = crc_crc8ModifyBatch(crc8, Patch, sizeof(Patch) / sizeof(Patch[0]), sizeof(crcTest_Data));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8Calculate(crcTest_Data, sizeof(crcTest_Data)), crc8);
 }
 
-TEST(crc_test, crc8DvbS2Calculate)
+TEST(crc_test, crc8RollingInitialize)
 {
-    uint8_t crc8DvbS2;
-
+    crc_rolling_t rolling;
+    
     /*** Error Check ***/
     /* NULL Pointer */
-    crc8DvbS2 = crc_crc8DvbS2Calculate(NULL, sizeof(crcTest_CheckData));
-    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2, crc8DvbS2);
+    TEST_ASSERT_FALSE(crc_crc8RollingInitialize(NULL, 16));
     
-    /* Zero Length Data */
-    crc8DvbS2 = crc_crc8DvbS2Calculate(crcTest_CheckData, 0);
-    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2, crc8DvbS2);
+    /* Zero Length Window */
+    TEST_ASSERT_FALSE(crc_crc8RollingInitialize(&rolling, 0));
     
-    /*** Calculate CRC-8/DVB-S2 For Check Data; Verify Result As Expected ***/
-    crc8DvbS2 = crc_crc8DvbS2Calculate(crcTest_CheckData, sizeof(crcTest_CheckData));
-    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_DVB_S2_CHECK, crc8DvbS2);
+    /*** Initialize Rolling CRC-8 ***/
+    TEST_ASSERT_TRUE(crc_crc8RollingInitialize(&rolling, 16));
 }
 
-TEST(crc_test, crc8DvbS2CalculatePartial)
+TEST(crc_test, crc8RollingUpdate)
 {
-    uint8_t crc8DvbS2, i;
+    crc_rolling_t rolling;
+    uint8_t crc8;
+    uint16_t i, windowLength;
     
-    /*** Set Up ***/
-    crc8DvbS2 = CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2;
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(0x5A, crc_crc8RollingUpdate(NULL, 0x00, 0x00, 0x5A));
     
-    /*** Calculate CRC-8/DVB-S2 For Check Data; Verify Result As Expected ***/
-    for(i = 0; i < sizeof(crcTest_CheckData); i++)
-        crc8DvbS2 = crc_crc8DvbS2CalculatePartial(crcTest_CheckData[i], crc8DvbS2);
-    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_DVB_S2_CHECK, crc8DvbS2);
+    /*** Slide Window Across Data; Verify Each Window Matches Full Calculation ***/
+    for(windowLength = 1; windowLength <= 64; windowLength += 21)
+    {
+        TEST_ASSERT_TRUE(crc_crc8RollingInitialize(&rolling, windowLength));
+        crc8 = crc_crc8Calculate(crcTest_Data, windowLength);
+        for(i = windowLength; i < sizeof(crcTest_Data); i++)
+        {
+            crc8 = crc_crc8RollingUpdate(&rolling, crcTest_Data[i - windowLength], crcTest_Data[i], crc8);
+            TEST_ASSERT_EQUAL_HEX8(crc_crc8Calculate(&crcTest_Data[i - windowLength + 1], windowLength), crc8);
+        }
+    }
 }
 
-TEST(crc_test, crc8EbuCalculate)
+TEST(crc_test, crc8StripPrefix)
 {
-    uint8_t crc8Ebu;
+    uint8_t crc8;
+    
+    /*** Set Up ***/
+    crc8 = crc_crc8Calculate(crcTest_Data, sizeof(crcTest_Data));
     
     /*** Error Check ***/
     /* NULL Pointer */
-    crc8Ebu = crc_crc8EbuCalculate(NULL, sizeof(crcTest_CheckData));
-    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_EBU_INITIAL_CRC8_EBU, crc8Ebu);
+    TEST_ASSERT_EQUAL_HEX8(crc8, crc_crc8StripPrefix(crc8, NULL, 37, sizeof(crcTest_Data) - 37));
     
-    /* Zero Length Data */
-    crc8Ebu = crc_crc8EbuCalculate(crcTest_CheckData, 0);
-    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_EBU_INITIAL_CRC8_EBU, crc8Ebu);
+    /* Zero Length Prefix */
+    TEST_ASSERT_EQUAL_HEX8(crc8, crc_crc8StripPrefix(crc8, crcTest_Data, 0, sizeof(crcTest_Data)));
     
-    /*** Calculate CRC-8/EBU For Check Data; Verify Result As Expected ***/
-    crc8Ebu = crc_crc8EbuCalculate(crcTest_CheckData, sizeof(crcTest_CheckData));
-    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_EBU_CHECK, crc8Ebu);
+    /* Zero Length Suffix */
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_INITIAL_CRC8, crc_crc8StripPrefix(crc8, crcTest_Data, sizeof(crcTest_Data), 0));
+    
+    /*** Strip Prefix; Verify Result Matches Full Calculation Of Suffix ***/
+    crc8 = crc_crc8StripPrefix(crc8, crcTest_Data, 37, sizeof(crcTest_Data) - 37);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8Calculate(&crcTest_Data[37], sizeof(crcTest_Data) - 37), crc8);
 }
 
-TEST(crc_test, crc8EbuCalculatePartial)
+TEST(crc_test, crc8Unwind)
 {
-    uint8_t crc8Ebu, i;
+    uint8_t crc8;
     
     /*** Set Up ***/
-    crc8Ebu = CRC_CRC8_EBU_INITIAL_CRC8_EBU;
-    
-    /*** Calculate CRC-8/EBU For Check Data; Verify Result As Expected ***/
-    for(i = 0; i < (sizeof(crcTest_CheckData) - 1); i++)
-        crc8Ebu = crc_crc8EbuCalculatePartial(crcTest_CheckData[i], crc8Ebu, false);
-    crc8Ebu = crc_crc8EbuCalculatePartial(crcTest_CheckData[i], crc8Ebu, true);
-    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_EBU_CHECK, crc8Ebu);
-}
-
-TEST(crc_test, crc8ICodeCalculate)
-{
-    uint8_t crc8ICode;
+    crc8 = crc_crc8Calculate(crcTest_Data, sizeof(crcTest_Data));
     
     /*** Error Check ***/
     /* NULL Pointer */
-    crc8ICode = crc_crc8ICodeCalculate(NULL, sizeof(crcTest_CheckData));
-    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE, crc8ICode);
+    TEST_ASSERT_EQUAL_HEX8(crc8, crc_crc8Unwind(crc8, NULL, 29));
     
     /* Zero Length Data */
-    crc8ICode = crc_crc8ICodeCalculate(crcTest_CheckData, 0);
-    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE, crc8ICode);
+    TEST_ASSERT_EQUAL_HEX8(crc8, crc_crc8Unwind(crc8, crcTest_Data, 0));
     
-    /*** Calculate CRC-8/I-CODE For Check Data; Verify Result As Expected ***/
-    crc8ICode = crc_crc8ICodeCalculate(crcTest_CheckData, sizeof(crcTest_CheckData));
-    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_I_CODE_CHECK, crc8ICode);
+    /*** Unwind Trailing Data; Verify Result Matches Full Calculation Without Trailing Data ***/
+    crc8 = crc_crc8Unwind(crc8, &crcTest_Data[sizeof(crcTest_Data) - 29], 29);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8Calculate(crcTest_Data, sizeof(crcTest_Data) - 29), crc8);
 }
 
-TEST(crc_test, crc8ICodeCalculatePartial)
+TEST(crc_test, crc8Prefix)
 {
-    uint8_t crc8ICode, i;
+    crc_prefix_t prefix;
     
-    /*** Set Up ***/
-    crc8ICode = CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE;
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8PrefixInitialize(NULL, crcTest_Data, 32));
+    TEST_ASSERT_FALSE(crc_crc8PrefixInitialize(&prefix, NULL, 32));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_INITIAL_CRC8, crc_crc8PrefixCalculate(NULL, crcTest_Data, 100));
     
-    /*** Calculate CRC-8/I-CODE For Check Data; Verify Result As Expected ***/
-    for(i = 0; i < sizeof(crcTest_CheckData); i++)
-        crc8ICode = crc_crc8ICodeCalculatePartial(crcTest_CheckData[i], crc8ICode);
-    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_I_CODE_CHECK, crc8ICode);
+    /*** Precompute Prefix; Verify Resumed Result Matches Full Calculation ***/
+    TEST_ASSERT_TRUE(crc_crc8PrefixInitialize(&prefix, crcTest_Data, 32));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8Calculate(crcTest_Data, 132), crc_crc8PrefixCalculate(&prefix, &crcTest_Data[32], 100));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8Calculate(crcTest_Data, 33), crc_crc8PrefixCalculate(&prefix, &crcTest_Data[32], 1));
+    
+    /* No Data After Prefix */
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8Calculate(crcTest_Data, 32), crc_crc8PrefixCalculate(&prefix, &crcTest_Data[32], 0));
+    
+    /* Empty Prefix */
+    TEST_ASSERT_TRUE(crc_crc8PrefixInitialize(&prefix, NULL, 0));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8Calculate(crcTest_Data, 100), crc_crc8PrefixCalculate(&prefix, crcTest_Data, 100));
 }
 
-TEST(crc_test, crc8ItuCalculate)
+TEST(crc_test, crc8CalculateMasked)
 {
-    uint8_t crc8Itu;
+    uint8_t crc8;
+    const crc_mask_t Mask[] = {{10, 4}, {100, 50}, {120, 40}, {990, 20}};
+    uint8_t m;
+    uint16_t i;
     
     /*** Error Check ***/
     /* NULL Pointer */
-    crc8Itu = crc_crc8ItuCalculate(NULL, sizeof(crcTest_CheckData));
-    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_ITU_INITIAL_CRC8_ITU, crc8Itu);
+    crc8 = crc_crc8CalculateMasked(NULL, sizeof(crcTest_Data), Mask, sizeof(Mask) / sizeof(Mask[0]));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_INITIAL_CRC8, crc8);
+    crc8 = crc_crc8CalculateMasked(crcTest_Data, sizeof(crcTest_Data), NULL, 1);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_INITIAL_CRC8, crc8);
     
     /* Zero Length Data */
-    crc8Itu = crc_crc8ItuCalculate(crcTest_CheckData, 0);
-    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_ITU_INITIAL_CRC8_ITU, crc8Itu);
-    
-    /*** Calculate CRC-8/ITU For Check Data; Verify Result As Expected ***/
-    crc8Itu = crc_crc8ItuCalculate(crcTest_CheckData, sizeof(crcTest_CheckData));
-    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_ITU_CHECK, crc8Itu);
-}
-
-TEST(crc_test, crc8ItuCalculatePartial)
-{
-    uint8_t crc8Itu, i;
+    crc8 = crc_crc8CalculateMasked(crcTest_Data, 0, Mask, sizeof(Mask) / sizeof(Mask[0]));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_INITIAL_CRC8, crc8);
     
-    /*** Set Up ***/
-    crc8Itu = CRC_CRC8_ITU_INITIAL_CRC8_ITU;
+    /*** Calculate Without Masks; Verify Result Matches Full Calculation ***/
+    crc8 = crc_crc8CalculateMasked(crcTest_Data, sizeof(crcTest_Data), NULL, 0);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8Calculate(crcTest_Data, sizeof(crcTest_Data)), crc8);
     
-    /*** Calculate CRC-8/ITU For Check Data; Verify Result As Expected ***/
-    for(i = 0; i < (sizeof(crcTest_CheckData) - 1); i++)
-        crc8Itu = crc_crc8ItuCalculatePartial(crcTest_CheckData[i], crc8Itu, false);
-    crc8Itu = crc_crc8ItuCalculatePartial(crcTest_CheckData[i], crc8Itu, true);
-    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_ITU_CHECK, crc8Itu);
+    /*** Calculate With Masks; Verify Result Matches Full Calculation Of Zeroed Data ***/
+    crc8 = crc_crc8CalculateMasked(crcTest_Data, sizeof(crcTest_Data), Mask, sizeof(Mask) / sizeof(Mask[0]));
+    for(m = 0; m < (sizeof(Mask) / sizeof(Mask[0])); m++)
+    {
+        for(i = Mask[m].offset; (i < (Mask[m].offset + Mask[m].length)) && (i < sizeof(crcTest_Data)); i++)
+            crcTest_Data[i] = 0x00;
+    }
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8Calculate(crcTest_Data, sizeof(crcTest_Data)), crc8);
 }
 
-TEST(crc_test, crc8MaximCalculate)
+TEST(crc_test, crc8CalculateBits)
 {
-    uint8_t crc8Maxim;
+    uint8_t crc8;
+    uint8_t shifted[sizeof(crcTest_CheckData) + 1];
+    uint16_t i;
     
     /*** Error Check ***/
     /* NULL Pointer */
-    crc8Maxim = crc_crc8MaximCalculate(NULL, sizeof(crcTest_CheckData));
-    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM, crc8Maxim);
+    crc8 = crc_crc8CalculateBits(NULL, 0, sizeof(crcTest_CheckData) * 8);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_INITIAL_CRC8, crc8);
     
     /* Zero Length Data */
-    crc8Maxim = crc_crc8MaximCalculate(crcTest_CheckData, 0);
-    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM, crc8Maxim);
+    crc8 = crc_crc8CalculateBits(crcTest_CheckData, 0, 0);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_INITIAL_CRC8, crc8);
+    crc8 = crc_crc8CalculatePartialBits(0xFF, 0, CRC_CRC8_INITIAL_CRC8);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_INITIAL_CRC8, crc8);
     
-    /*** Calculate CRC-8/MAXIM For Check Data; Verify Result As Expected ***/
-    crc8Maxim = crc_crc8MaximCalculate(crcTest_CheckData, sizeof(crcTest_CheckData));
-    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_MAXIM_CHECK, crc8Maxim);
+    /* Bit Range Beyond Address Space */
+    crc8 = crc_crc8CalculateBits(crcTest_CheckData, 0xFFFFFFF8UL, 16);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_INITIAL_CRC8, crc8);
+    
+    /*** Calculate Over Whole Bytes; Verify Result Matches Byte-Wise Calculation ***/
+    crc8 = crc_crc8CalculateBits(crcTest_Data, 0, sizeof(crcTest_Data) * 8);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8Calculate(crcTest_Data, sizeof(crcTest_Data)), crc8);
+    
+    /*** Calculate Over Check Data Shifted By 3 Bits (Most Significant Bit First) ***/
+    shifted[0] = (uint8_t)(crcTest_CheckData[0] >> 3);
+    for(i = 1; i < sizeof(crcTest_CheckData); i++)
+        shifted[i] = (uint8_t)((crcTest_CheckData[i - 1] << 5) | (crcTest_CheckData[i] >> 3));
+    shifted[sizeof(crcTest_CheckData)] = (uint8_t)(crcTest_CheckData[sizeof(crcTest_CheckData) - 1] << 5);
+    crc8 = crc_crc8CalculateBits(shifted, 3, sizeof(crcTest_CheckData) * 8);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_CHECK, crc8);
+    
+    /*** Calculate Check Data In 3 And 5 Bit Pieces ***/
+    crc8 = CRC_CRC8_INITIAL_CRC8;
+    for(i = 0; i < sizeof(crcTest_CheckData); i++)
+    {
+        crc8 = crc_crc8CalculatePartialBits(crcTest_CheckData[i], 3, crc8);
+        crc8 = crc_crc8CalculatePartialBits((uint8_t)(crcTest_CheckData[i] << 3), 5, crc8);
+    }
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_CHECK, crc8);
+    
+    /*** Calculate Over Non-Whole Byte Length; Verify Result Matches Partial Calculation ***/
+    crc8 = CRC_CRC8_INITIAL_CRC8;
+    for(i = 0; i < 100; i++)
+        crc8 = crc_crc8CalculatePartial(crcTest_Data[i], crc8);
+    crc8 = crc_crc8CalculatePartialBits(crcTest_Data[100], 5, crc8);
+    TEST_ASSERT_EQUAL_HEX8(crc8, crc_crc8CalculateBits(crcTest_Data, 0, (100 * 8) + 5));
 }
 
-TEST(crc_test, crc8MaximCalculatePartial)
+TEST(crc_test, crc8Verify)
 {
-    uint8_t crc8Maxim, i;
+    uint8_t frame[sizeof(crcTest_CheckData) + 1];
+    uint16_t i;
     
-    /*** Set Up ***/
-    crc8Maxim = CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM;
+    /*** Set Up Check Data Followed By CRC-8 ***/
+    for(i = 0; i < sizeof(crcTest_CheckData); i++)
+        frame[i] = crcTest_CheckData[i];
+    frame[sizeof(crcTest_CheckData)] = CRC_TEST_CRC8_CHECK;
     
-    /*** Calculate CRC-8/MAXIM For Check Data; Verify Result As Expected ***/
-    for(i = 0; i < (sizeof(crcTest_CheckData) - 1); i++)
-        crc8Maxim = crc_crc8MaximCalculatePartial(crcTest_CheckData[i], crc8Maxim, false);
-    crc8Maxim = crc_crc8MaximCalculatePartial(crcTest_CheckData[i], crc8Maxim, true);
-    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_MAXIM_CHECK, crc8Maxim);
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8Verify(NULL, sizeof(frame)));
+    
+    /* Data Shorter Than CRC-8 */
+    TEST_ASSERT_FALSE(crc_crc8Verify(frame, 0));
+    
+    /*** Verify Valid Frame ***/
+    TEST_ASSERT_TRUE(crc_crc8Verify(frame, sizeof(frame)));
+    
+    /*** Verify Single Bit Errors Are Detected ***/
+    for(i = 0; i < (sizeof(frame) * 8); i++)
+    {
+        frame[i >> 3] ^= (uint8_t)(1U << (i & 0x07));
+        TEST_ASSERT_FALSE(crc_crc8Verify(frame, sizeof(frame)));
+        frame[i >> 3] ^= (uint8_t)(1U << (i & 0x07));
+    }
 }
 
-TEST(crc_test, crc8RohcCalculate)
+TEST(crc_test, crc8Correct)
 {
-    uint8_t crc8Rohc;
+    static crc_syndrome8_t syndrome;
+    uint8_t frame[sizeof(crcTest_CheckData) + 1];
+    uint16_t i, j;
+    
+    /*** Set Up Check Data Followed By CRC-8 ***/
+    for(i = 0; i < sizeof(crcTest_CheckData); i++)
+        frame[i] = crcTest_CheckData[i];
+    frame[sizeof(crcTest_CheckData)] = CRC_TEST_CRC8_CHECK;
     
     /*** Error Check ***/
     /* NULL Pointer */
-    crc8Rohc = crc_crc8RohcCalculate(NULL, sizeof(crcTest_CheckData));
-    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_ROHC_INITIAL_CRC8_ROHC, crc8Rohc);
+    TEST_ASSERT_EQUAL(CRC_CORRECTION_FAILED, crc_crc8Correct(NULL, frame, sizeof(frame)));
+    TEST_ASSERT_EQUAL(CRC_CORRECTION_FAILED, crc_crc8Correct(&syndrome, NULL, sizeof(frame)));
     
-    /* Zero Length Data */
-    crc8Rohc = crc_crc8RohcCalculate(crcTest_CheckData, 0);
-    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_ROHC_INITIAL_CRC8_ROHC, crc8Rohc);
+    /* Data Shorter Than CRC-8 */
+    TEST_ASSERT_EQUAL(CRC_CORRECTION_FAILED, crc_crc8Correct(&syndrome, frame, 0));
     
-    /*** Calculate CRC-8/ROHC For Check Data; Verify Result As Expected ***/
-    crc8Rohc = crc_crc8RohcCalculate(crcTest_CheckData, sizeof(crcTest_CheckData));
-    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_ROHC_CHECK, crc8Rohc);
+    /*** Verify Valid Frame Is Left Untouched ***/
+    TEST_ASSERT_EQUAL(CRC_CORRECTION_NONE, crc_crc8Correct(&syndrome, frame, sizeof(frame)));
+    TEST_ASSERT_TRUE(crc_crc8Verify(frame, sizeof(frame)));
+    
+    /*** Verify Single Bit Errors Are Corrected ***/
+    for(i = 0; i < (sizeof(frame) * 8); i++)
+    {
+        frame[i >> 3] ^= (uint8_t)(1U << (i & 0x07));
+        TEST_ASSERT_EQUAL(CRC_CORRECTION_SINGLE, crc_crc8Correct(&syndrome, frame, sizeof(frame)));
+        TEST_ASSERT_TRUE(crc_crc8Verify(frame, sizeof(frame)));
+    }
+    
+    /*** Verify Double Bit Errors Are Not Corrected (Not Mapped For Frame Length) ***/
+    for(i = 0; i < (sizeof(frame) * 8); i++)
+    {
+        for(j = i + 1; j < (sizeof(frame) * 8); j++)
+        {
+            frame[i >> 3] ^= (uint8_t)(1U << (i & 0x07));
+            frame[j >> 3] ^= (uint8_t)(1U << (j & 0x07));
+            TEST_ASSERT_EQUAL(CRC_CORRECTION_FAILED, crc_crc8Correct(&syndrome, frame, sizeof(frame)));
+            frame[i >> 3] ^= (uint8_t)(1U << (i & 0x07));
+            frame[j >> 3] ^= (uint8_t)(1U << (j & 0x07));
+        }
+    }
+    
+    /*** Verify Single Bit Errors Are Corrected After Change Of Data Length (Within Period Of x) ***/
+    crcTest_Data[12] = crc_crc8Calculate(crcTest_Data, 12);
+    for(i = 0; i < ((12 + 1) * 8); i++)
+    {
+        crcTest_Data[i >> 3] ^= (uint8_t)(1U << (i & 0x07));
+        TEST_ASSERT_EQUAL(CRC_CORRECTION_SINGLE, crc_crc8Correct(&syndrome, crcTest_Data, 12 + 1));
+        TEST_ASSERT_TRUE(crc_crc8Verify(crcTest_Data, 12 + 1));
+    }
 }
 
-TEST(crc_test, crc8RohcCalculatePartial)
+TEST(crc_test, crc8Forge)
 {
-    uint8_t crc8Rohc, i;
+    uint8_t crc8;
+    uint16_t offset;
     
-    /*** Set Up ***/
-    crc8Rohc = CRC_CRC8_ROHC_INITIAL_CRC8_ROHC;
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8Forge(NULL, sizeof(crcTest_Data), 0, 0x00, 0x5A));
     
-    /*** Calculate CRC-8/ROHC For Check Data; Verify Result As Expected ***/
-    for(i = 0; i < (sizeof(crcTest_CheckData) - 1); i++)
-        crc8Rohc = crc_crc8RohcCalculatePartial(crcTest_CheckData[i], crc8Rohc, false);
-    crc8Rohc = crc_crc8RohcCalculatePartial(crcTest_CheckData[i], crc8Rohc, true);
-    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_ROHC_CHECK, crc8Rohc);
+    /* Patch Beyond End Of Data */
+    TEST_ASSERT_FALSE(crc_crc8Forge(crcTest_Data, sizeof(crcTest_Data), sizeof(crcTest_Data) - 0, 0x00, 0x5A));
+    TEST_ASSERT_FALSE(crc_crc8Forge(crcTest_Data, 0, 0, 0x00, 0x5A));
+    
+    /*** Forge Target At Various Offsets (Each Target Is Current CRC-8 Of Next Forge) ***/
+    crc8 = crc_crc8Calculate(crcTest_Data, sizeof(crcTest_Data));
+    for(offset = 0; offset <= (sizeof(crcTest_Data) - 1); offset += 111)
+    {
+        TEST_ASSERT_TRUE(crc_crc8Forge(crcTest_Data, sizeof(crcTest_Data), offset, crc8, (uint8_t)(0x5A + offset)));
+        TEST_ASSERT_EQUAL_HEX8((uint8_t)(0x5A + offset), crc_crc8Calculate(crcTest_Data, sizeof(crcTest_Data)));
+        crc8 = (uint8_t)(0x5A + offset);
+    }
+    
+    /*** Forge Target At End Of Data ***/
+    TEST_ASSERT_TRUE(crc_crc8Forge(crcTest_Data, sizeof(crcTest_Data), sizeof(crcTest_Data) - 1, crc8, 0x5A));
+    TEST_ASSERT_EQUAL_HEX8(0x5A, crc_crc8Calculate(crcTest_Data, sizeof(crcTest_Data)));
+    
+    /*** Forge Check Value Over Check Data ***/
+    TEST_ASSERT_TRUE(crc_crc8Forge(crcTest_Data, sizeof(crcTest_CheckData), 3, crc_crc8Calculate(crcTest_Data, sizeof(crcTest_CheckData)), CRC_TEST_CRC8_CHECK));
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_CHECK, crc_crc8Calculate(crcTest_Data, sizeof(crcTest_CheckData)));
 }
 
-TEST(crc_test, crc8WcdmaCalculate)
+TEST(crc_test, crc8Cdma2000Calculate)
 {
-    uint8_t crc8Wcdma;
+    uint8_t crc8Cdma2000;
     
     /*** Error Check ***/
     /* NULL Pointer */
-    crc8Wcdma = crc_crc8WcdmaCalculate(NULL, sizeof(crcTest_CheckData));
-    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA, crc8Wcdma);
+    crc8Cdma2000 = crc_crc8Cdma2000Calculate(NULL, sizeof(crcTest_CheckData));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000, crc8Cdma2000);
     
     /* Zero Length Data */
-    crc8Wcdma = crc_crc8WcdmaCalculate(crcTest_CheckData, 0);
-    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA, crc8Wcdma);
+    crc8Cdma2000 = crc_crc8Cdma2000Calculate(crcTest_CheckData, 0);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000, crc8Cdma2000);
     
-    /*** Calculate CRC-8/WCDMA For Check Data; Verify Result As Expected ***/
-    crc8Wcdma = crc_crc8WcdmaCalculate(crcTest_CheckData, sizeof(crcTest_CheckData));
-    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_WCDMA_CHECK, crc8Wcdma);
+    /*** Calculate CRC-8/CDMA2000 For Check Data; Verify Result As Expected ***/
+    crc8Cdma2000 = crc_crc8Cdma2000Calculate(crcTest_CheckData, sizeof(crcTest_CheckData));
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_CDMA2000_CHECK, crc8Cdma2000);
 }
 
-TEST(crc_test, crc8WcdmaCalculatePartial)
+TEST(crc_test, crc8Cdma2000CalculatePartial)
 {
-    uint8_t crc8Wcdma, i;
+    uint8_t crc8Cdma2000, i;
     
     /*** Set Up ***/
-    crc8Wcdma = CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA;
+    crc8Cdma2000 = CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000;
     
-    /*** Calculate CRC-8/WCDMA For Check Data; Verify Result As Expected ***/
-    for(i = 0; i < (sizeof(crcTest_CheckData) - 1); i++)
-        crc8Wcdma = crc_crc8WcdmaCalculatePartial(crcTest_CheckData[i], crc8Wcdma, false);
-    crc8Wcdma = crc_crc8WcdmaCalculatePartial(crcTest_CheckData[i], crc8Wcdma, true);
-    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_WCDMA_CHECK, crc8Wcdma);
+    /*** Calculate CRC-8/CDMA2000 For Check Data; Verify Result As Expected ***/
+    for(i = 0; i < sizeof(crcTest_CheckData); i++)
+        crc8Cdma2000 = crc_crc8Cdma2000CalculatePartial(crcTest_CheckData[i], crc8Cdma2000);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_CDMA2000_CHECK, crc8Cdma2000);
 }
 
-TEST(crc_test, crc16ArcCalculate)
+TEST(crc_test, crc8Cdma2000Step)
+{
+    uint8_t crc8Cdma2000, i;
+    
+    /*** Set Up ***/
+    crc8Cdma2000 = CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000;
+    
+    /*** Calculate CRC-8/CDMA2000 For Check Data With Inline Step; Verify Result As Expected ***/
+    for(i = 0; i < sizeof(crcTest_CheckData); i++)
+        crc8Cdma2000 = crc_crc8Cdma2000Step(crcTest_CheckData[i], crc8Cdma2000);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_CDMA2000_CHECK, crc8Cdma2000);
+}
+
+TEST(crc_test, crc8Cdma2000Modify)
+{
+    uint8_t crc8Cdma2000;
+    uint8_t i;
+    
+    /*** Set Up ***/
+    crc8Cdma2000 = crc_crc8Cdma2000Calculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8Cdma2000, crc_crc8Cdma2000Modify(crc8Cdma2000, NULL, sizeof(crcTest_Delta), 0));
+    
+    /* Zero Length Delta */
+    TEST_ASSERT_EQUAL_HEX8(crc8Cdma2000, crc_crc8Cdma2000Modify(crc8Cdma2000, crcTest_Delta, 0, 0));
+    
+    /*** Modify Data In Place; Verify Updated CRC-8/CDMA2000 Matches Full Calculation ***/
+    for(i = 0; i < sizeof(crcTest_Delta); i++)
+        crcTest_Data[100 + i] ^= crcTest_Delta[i];
+    crc8Cdma2000 = crc_crc8Cdma2000Modify(crc8Cdma2000, crcTest_Delta, sizeof(crcTest_Delta), sizeof(crcTest_Data) - 100 - sizeof(crcTest_Delta));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8Cdma2000Calculate(crcTest_Data, sizeof(crcTest_Data)), crc8Cdma2000);
+    
+    /*** Modify Final Data; Verify Updated CRC-8/CDMA2000 Matches Full Calculation ***/
+    crcTest_Data[sizeof(crcTest_Data) - 1] ^= crcTest_Delta[0];
+    crc8Cdma2000 = crc_crc8Cdma2000Modify(crc8Cdma2000, crcTest_Delta, 1, 0);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8Cdma2000Calculate(crcTest_Data, sizeof(crcTest_Data)), crc8Cdma2000);
+}
+
+TEST(crc_test, crc8Cdma2000ModifyBatch)
+{
+    uint8_t crc8Cdma2000;
+    const crc_patch_t Patch[] = {{crcTest_Delta, 0, sizeof(crcTest_Delta), 0}, {crcTest_Delta, 500, 2, 0}, {crcTest_Delta, 999, 2, 0}};
+    uint8_t i;
+    
+    /*** Set Up ***/
+    crc8Cdma2000 = crc_crc8Cdma2000Calculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8Cdma2000, crc_crc8Cdma2000ModifyBatch(crc8Cdma2000, NULL, 1, sizeof(crcTest_Data)));
+    
+    /*** Modify Data In Place (Final Patch Out Of Range); Verify Updated CRC-8/CDMA2000 Matches Full Calculation ***/
+    for(i = 0; i < sizeof(crcTest_Delta); i++)
+        crcTest_Data[i] ^= crcTest_Delta[i];
+    for(i = 0; i < 2; i++)
+        crcTest_Data[500 + i] ^= crcTest_Delta[i];
+    crc8Cdma2000 = crc_crc8Cdma2000ModifyBatch(crc8Cdma2000, Patch, sizeof(Patch) / sizeof(Patch[0]), sizeof(crcTest_Data));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8Cdma2000Calculate(crcTest_Data, sizeof(crcTest_Data)), crc8Cdma2000);
+}
+
+TEST(crc_test, crc8Cdma2000RollingInitialize)
+{
+    crc_rolling_t rolling;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8Cdma2000RollingInitialize(NULL, 16));
+    
+    /* Zero Length Window */
+    TEST_ASSERT_FALSE(crc_crc8Cdma2000RollingInitialize(&rolling, 0));
+    
+    /*** Initialize Rolling CRC-8/CDMA2000 ***/
+    TEST_ASSERT_TRUE(crc_crc8Cdma2000RollingInitialize(&rolling, 16));
+}
+
+TEST(crc_test, crc8Cdma2000RollingUpdate)
+{
+    crc_rolling_t rolling;
+    uint8_t crc8Cdma2000;
+    uint16_t i, windowLength;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(0x5A, crc_crc8Cdma2000RollingUpdate(NULL, 0x00, 0x00, 0x5A));
+    
+    /*** Slide Window Across Data; Verify Each Window Matches Full Calculation ***/
+    for(windowLength = 1; windowLength <= 64; windowLength += 21)
+    {
+        TEST_ASSERT_TRUE(crc_crc8Cdma2000RollingInitialize(&rolling, windowLength));
+        crc8Cdma2000 = crc_crc8Cdma2000Calculate(crcTest_Data, windowLength);
+        for(i = windowLength; i < sizeof(crcTest_Data); i++)
+        {
+            crc8Cdma2000 = crc_crc8Cdma2000RollingUpdate(&rolling, crcTest_Data[i - windowLength], crcTest_Data[i], crc8Cdma2000);
+            TEST_ASSERT_EQUAL_HEX8(crc_crc8Cdma2000Calculate(&crcTest_Data[i - windowLength + 1], windowLength), crc8Cdma2000);
+        }
+    }
+}
+
+TEST(crc_test, crc8Cdma2000StripPrefix)
+{
+    uint8_t crc8Cdma2000;
+    
+    /*** Set Up ***/
+    crc8Cdma2000 = crc_crc8Cdma2000Calculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8Cdma2000, crc_crc8Cdma2000StripPrefix(crc8Cdma2000, NULL, 37, sizeof(crcTest_Data) - 37));
+    
+    /* Zero Length Prefix */
+    TEST_ASSERT_EQUAL_HEX8(crc8Cdma2000, crc_crc8Cdma2000StripPrefix(crc8Cdma2000, crcTest_Data, 0, sizeof(crcTest_Data)));
+    
+    /* Zero Length Suffix */
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000, crc_crc8Cdma2000StripPrefix(crc8Cdma2000, crcTest_Data, sizeof(crcTest_Data), 0));
+    
+    /*** Strip Prefix; Verify Result Matches Full Calculation Of Suffix ***/
+    crc8Cdma2000 = crc_crc8Cdma2000StripPrefix(crc8Cdma2000, crcTest_Data, 37, sizeof(crcTest_Data) - 37);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8Cdma2000Calculate(&crcTest_Data[37], sizeof(crcTest_Data) - 37), crc8Cdma2000);
+}
+
+TEST(crc_test, crc8Cdma2000Unwind)
+{
+    uint8_t crc8Cdma2000;
+    
+    /*** Set Up ***/
+    crc8Cdma2000 = crc_crc8Cdma2000Calculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8Cdma2000, crc_crc8Cdma2000Unwind(crc8Cdma2000, NULL, 29));
+    
+    /* Zero Length Data */
+    TEST_ASSERT_EQUAL_HEX8(crc8Cdma2000, crc_crc8Cdma2000Unwind(crc8Cdma2000, crcTest_Data, 0));
+    
+    /*** Unwind Trailing Data; Verify Result Matches Full Calculation Without Trailing Data ***/
+    crc8Cdma2000 = crc_crc8Cdma2000Unwind(crc8Cdma2000, &crcTest_Data[sizeof(crcTest_Data) - 29], 29);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8Cdma2000Calculate(crcTest_Data, sizeof(crcTest_Data) - 29), crc8Cdma2000);
+}
+
+TEST(crc_test, crc8Cdma2000Prefix)
+{
+    crc_prefix_t prefix;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8Cdma2000PrefixInitialize(NULL, crcTest_Data, 32));
+    TEST_ASSERT_FALSE(crc_crc8Cdma2000PrefixInitialize(&prefix, NULL, 32));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000, crc_crc8Cdma2000PrefixCalculate(NULL, crcTest_Data, 100));
+    
+    /*** Precompute Prefix; Verify Resumed Result Matches Full Calculation ***/
+    TEST_ASSERT_TRUE(crc_crc8Cdma2000PrefixInitialize(&prefix, crcTest_Data, 32));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8Cdma2000Calculate(crcTest_Data, 132), crc_crc8Cdma2000PrefixCalculate(&prefix, &crcTest_Data[32], 100));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8Cdma2000Calculate(crcTest_Data, 33), crc_crc8Cdma2000PrefixCalculate(&prefix, &crcTest_Data[32], 1));
+    
+    /* No Data After Prefix */
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8Cdma2000Calculate(crcTest_Data, 32), crc_crc8Cdma2000PrefixCalculate(&prefix, &crcTest_Data[32], 0));
+    
+    /* Empty Prefix */
+    TEST_ASSERT_TRUE(crc_crc8Cdma2000PrefixInitialize(&prefix, NULL, 0));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8Cdma2000Calculate(crcTest_Data, 100), crc_crc8Cdma2000PrefixCalculate(&prefix, crcTest_Data, 100));
+}
+
+TEST(crc_test, crc8Cdma2000CalculateMasked)
+{
+    uint8_t crc8Cdma2000;
+    const crc_mask_t Mask[] = {{10, 4}, {100, 50}, {120, 40}, {990, 20}};
+    uint8_t m;
+    uint16_t i;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    crc8Cdma2000 = crc_crc8Cdma2000CalculateMasked(NULL, sizeof(crcTest_Data), Mask, sizeof(Mask) / sizeof(Mask[0]));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000, crc8Cdma2000);
+    crc8Cdma2000 = crc_crc8Cdma2000CalculateMasked(crcTest_Data, sizeof(crcTest_Data), NULL, 1);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000, crc8Cdma2000);
+    
+    /* Zero Length Data */
+    crc8Cdma2000 = crc_crc8Cdma2000CalculateMasked(crcTest_Data, 0, Mask, sizeof(Mask) / sizeof(Mask[0]));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000, crc8Cdma2000);
+    
+    /*** Calculate Without Masks; Verify Result Matches Full Calculation ***/
+    crc8Cdma2000 = crc_crc8Cdma2000CalculateMasked(crcTest_Data, sizeof(crcTest_Data), NULL, 0);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8Cdma2000Calculate(crcTest_Data, sizeof(crcTest_Data)), crc8Cdma2000);
+    
+    /*** Calculate With Masks; Verify Result Matches Full Calculation Of Zeroed Data ***/
+    crc8Cdma2000 = crc_crc8Cdma2000CalculateMasked(crcTest_Data, sizeof(crcTest_Data), Mask, sizeof(Mask) / sizeof(Mask[0]));
+    for(m = 0; m < (sizeof(Mask) / sizeof(Mask[0])); m++)
+    {
+        for(i = Mask[m].offset; (i < (Mask[m].offset + Mask[m].length)) && (i < sizeof(crcTest_Data)); i++)
+            crcTest_Data[i] = 0x00;
+    }
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8Cdma2000Calculate(crcTest_Data, sizeof(crcTest_Data)), crc8Cdma2000);
+}
+
+TEST(crc_test, crc8Cdma2000CalculateBits)
+{
+    uint8_t crc8Cdma2000;
+    uint8_t shifted[sizeof(crcTest_CheckData) + 1];
+    uint16_t i;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    crc8Cdma2000 = crc_crc8Cdma2000CalculateBits(NULL, 0, sizeof(crcTest_CheckData) * 8);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000, crc8Cdma2000);
+    
+    /* Zero Length Data */
+    crc8Cdma2000 = crc_crc8Cdma2000CalculateBits(crcTest_CheckData, 0, 0);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000, crc8Cdma2000);
+    crc8Cdma2000 = crc_crc8Cdma2000CalculatePartialBits(0xFF, 0, CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000, crc8Cdma2000);
+    
+    /* Bit Range Beyond Address Space */
+    crc8Cdma2000 = crc_crc8Cdma2000CalculateBits(crcTest_CheckData, 0xFFFFFFF8UL, 16);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000, crc8Cdma2000);
+    
+    /*** Calculate Over Whole Bytes; Verify Result Matches Byte-Wise Calculation ***/
+    crc8Cdma2000 = crc_crc8Cdma2000CalculateBits(crcTest_Data, 0, sizeof(crcTest_Data) * 8);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8Cdma2000Calculate(crcTest_Data, sizeof(crcTest_Data)), crc8Cdma2000);
+    
+    /*** Calculate Over Check Data Shifted By 3 Bits (Most Significant Bit First) ***/
+    shifted[0] = (uint8_t)(crcTest_CheckData[0] >> 3);
+    for(i = 1; i < sizeof(crcTest_CheckData); i++)
+        shifted[i] = (uint8_t)((crcTest_CheckData[i - 1] << 5) | (crcTest_CheckData[i] >> 3));
+    shifted[sizeof(crcTest_CheckData)] = (uint8_t)(crcTest_CheckData[sizeof(crcTest_CheckData) - 1] << 5);
+    crc8Cdma2000 = crc_crc8Cdma2000CalculateBits(shifted, 3, sizeof(crcTest_CheckData) * 8);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_CDMA2000_CHECK, crc8Cdma2000);
+    
+    /*** Calculate Check Data In 3 And 5 Bit Pieces ***/
+    crc8Cdma2000 = CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000;
+    for(i = 0; i < sizeof(crcTest_CheckData); i++)
+    {
+        crc8Cdma2000 = crc_crc8Cdma2000CalculatePartialBits(crcTest_CheckData[i], 3, crc8Cdma2000);
+        crc8Cdma2000 = crc_crc8Cdma2000CalculatePartialBits((uint8_t)(crcTest_CheckData[i] << 3), 5, crc8Cdma2000);
+    }
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_CDMA2000_CHECK, crc8Cdma2000);
+    
+    /*** Calculate Over Non-Whole Byte Length; Verify Result Matches Partial Calculation ***/
+    crc8Cdma2000 = CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000;
+    for(i = 0; i < 100; i++)
+        crc8Cdma2000 = crc_crc8Cdma2000CalculatePartial(crcTest_Data[i], crc8Cdma2000);
+    crc8Cdma2000 = crc_crc8Cdma2000CalculatePartialBits(crcTest_Data[100], 5, crc8Cdma2000);
+    TEST_ASSERT_EQUAL_HEX8(crc8Cdma2000, crc_crc8Cdma2000CalculateBits(crcTest_Data, 0, (100 * 8) + 5));
+}
+
+TEST(crc_test, crc8Cdma2000Verify)
+{
+    uint8_t frame[sizeof(crcTest_CheckData) + 1];
+    uint16_t i;
+    
+    /*** Set Up Check Data Followed By CRC-8/CDMA2000 ***/
+    for(i = 0; i < sizeof(crcTest_CheckData); i++)
+        frame[i] = crcTest_CheckData[i];
+    frame[sizeof(crcTest_CheckData)] = CRC_TEST_CRC8_CDMA2000_CHECK;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8Cdma2000Verify(NULL, sizeof(frame)));
+    
+    /* Data Shorter Than CRC-8/CDMA2000 */
+    TEST_ASSERT_FALSE(crc_crc8Cdma2000Verify(frame, 0));
+    
+    /*** Verify Valid Frame ***/
+    TEST_ASSERT_TRUE(crc_crc8Cdma2000Verify(frame, sizeof(frame)));
+    
+    /*** Verify Single Bit Errors Are Detected ***/
+    for(i = 0; i < (sizeof(frame) * 8); i++)
+    {
+        frame[i >> 3] ^= (uint8_t)(1U << (i & 0x07));
+        TEST_ASSERT_FALSE(crc_crc8Cdma2000Verify(frame, sizeof(frame)));
+        frame[i >> 3] ^= (uint8_t)(1U << (i & 0x07));
+    }
+}
+
+TEST(crc_test, crc8Cdma2000Forge)
+{
+    uint8_t crc8Cdma2000;
+    uint16_t offset;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8Cdma2000Forge(NULL, sizeof(crcTest_Data), 0, 0x00, 0x5A));
+    
+    /* Patch Beyond End Of Data */
+    TEST_ASSERT_FALSE(crc_crc8Cdma2000Forge(crcTest_Data, sizeof(crcTest_Data), sizeof(crcTest_Data) - 0, 0x00, 0x5A));
+    TEST_ASSERT_FALSE(crc_crc8Cdma2000Forge(crcTest_Data, 0, 0, 0x00, 0x5A));
+    
+    /*** Forge Target At Various Offsets (Each Target Is Current CRC-8/CDMA2000 Of Next Forge) ***/
+    crc8Cdma2000 = crc_crc8Cdma2000Calculate(crcTest_Data, sizeof(crcTest_Data));
+    for(offset = 0; offset <= (sizeof(crcTest_Data) - 1); offset += 111)
+    {
+        TEST_ASSERT_TRUE(crc_crc8Cdma2000Forge(crcTest_Data, sizeof(crcTest_Data), offset, crc8Cdma2000, (uint8_t)(0x5A + offset)));
+        TEST_ASSERT_EQUAL_HEX8((uint8_t)(0x5A + offset), crc_crc8Cdma2000Calculate(crcTest_Data, sizeof(crcTest_Data)));
+        crc8Cdma2000 = (uint8_t)(0x5A + offset);
+    }
+    
+    /*** Forge Target At End Of Data ***/
+    TEST_ASSERT_TRUE(crc_crc8Cdma2000Forge(crcTest_Data, sizeof(crcTest_Data), sizeof(crcTest_Data) - 1, crc8Cdma2000, 0x5A));
+    TEST_ASSERT_EQUAL_HEX8(0x5A, crc_crc8Cdma2000Calculate(crcTest_Data, sizeof(crcTest_Data)));
+    
+    /*** Forge Check Value Over Check Data ***/
+    TEST_ASSERT_TRUE(crc_crc8Cdma2000Forge(crcTest_Data, sizeof(crcTest_CheckData), 3, crc_crc8Cdma2000Calculate(crcTest_Data, sizeof(crcTest_CheckData)), CRC_TEST_CRC8_CDMA2000_CHECK));
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_CDMA2000_CHECK, crc_crc8Cdma2000Calculate(crcTest_Data, sizeof(crcTest_CheckData)));
+}
+
+TEST(crc_test, crc8DarcCalculate)
+{
+    uint8_t crc8Darc;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    crc8Darc = crc_crc8DarcCalculate(NULL, sizeof(crcTest_CheckData));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_DARC_INITIAL_CRC8_DARC, crc8Darc);
+    
+    /* Zero Length Data */
+    crc8Darc = crc_crc8DarcCalculate(crcTest_CheckData, 0);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_DARC_INITIAL_CRC8_DARC, crc8Darc);
+    
+    /*** Calculate CRC-8/DARC For Check Data; Verify Result As Expected ***/
+    crc8Darc = crc_crc8DarcCalculate(crcTest_CheckData, sizeof(crcTest_CheckData));
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_DARC_CHECK, crc8Darc);
+}
+
+TEST(crc_test, crc8DarcCalculatePartial)
+{
+    uint8_t crc8Darc, i;
+    
+    /*** Set Up ***/
+    crc8Darc = CRC_CRC8_DARC_INITIAL_CRC8_DARC;
+    
+    /*** Calculate CRC-8/DARC For Check Data; Verify Result As Expected ***/
+    for(i = 0; i < (sizeof(crcTest_CheckData) - 1); i++)
+        crc8Darc = crc_crc8DarcCalculatePartial(crcTest_CheckData[i], crc8Darc, false);
+    crc8Darc = crc_crc8DarcCalculatePartial(crcTest_CheckData[i], crc8Darc, true);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_DARC_CHECK, crc8Darc);
+}
+
+TEST(crc_test, crc8DarcStep)
+{
+    uint8_t crc8Darc, i;
+    
+    /*** Set Up ***/
+    crc8Darc = CRC_CRC8_DARC_INITIAL_CRC8_DARC;
+    
+    /*** Calculate CRC-8/DARC For Check Data With Inline Step; Verify Result As Expected ***/
+    for(i = 0; i < (sizeof(crcTest_CheckData) - 1); i++)
+        crc8Darc = crc_crc8DarcStep(crcTest_CheckData[i], crc8Darc);
+    crc8Darc = crc_crc8DarcCalculatePartial(crcTest_CheckData[i], crc8Darc, true);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_DARC_CHECK, crc8Darc);
+}
+
+TEST(crc_test, crc8DarcModify)
+{
+    uint8_t crc8Darc;
+    uint8_t i;
+    
+    /*** Set Up ***/
+    crc8Darc = crc_crc8DarcCalculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8Darc, crc_crc8DarcModify(crc8Darc, NULL, sizeof(crcTest_Delta), 0));
+    
+    /* Zero Length Delta */
+    TEST_ASSERT_EQUAL_HEX8(crc8Darc, crc_crc8DarcModify(crc8Darc, crcTest_Delta, 0, 0));
+    
+    /*** Modify Data In Place; Verify Updated CRC-8/DARC Matches Full Calculation ***/
+    for(i = 0; i < sizeof(crcTest_Delta); i++)
+        crcTest_Data[100 + i] ^= crcTest_Delta[i];
+    crc8Darc = crc_crc8DarcModify(crc8Darc, crcTest_Delta, sizeof(crcTest_Delta), sizeof(crcTest_Data) - 100 - sizeof(crcTest_Delta));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8DarcCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8Darc);
+    
+    /*** Modify Final Data; Verify Updated CRC-8/DARC Matches Full Calculation ***/
+    crcTest_Data[sizeof(crcTest_Data) - 1] ^= crcTest_Delta[0];
+    crc8Darc = crc_crc8DarcModify(crc8Darc, crcTest_Delta, 1, 0);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8DarcCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8Darc);
+}
+
+TEST(crc_test, crc8DarcModifyBatch)
+{
+    uint8_t crc8Darc;
+    const crc_patch_t Patch[] = {{crcTest_Delta, 0, sizeof(crcTest_Delta), 0}, {crcTest_Delta, 500, 2, 0}, {crcTest_Delta, 999, 2, 0}};
+    uint8_t i;
+    
+    /*** Set Up ***/
+    crc8Darc = crc_crc8DarcCalculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8Darc, crc_crc8DarcModifyBatch(crc8Darc, NULL, 1, sizeof(crcTest_Data)));
+    
+    /*** Modify Data In Place (Final Patch Out Of Range); Verify Updated CRC-8/DARC Matches Full Calculation ***/
+    for(i = 0; i < sizeof(crcTest_Delta); i++)
+        crcTest_Data[i] ^= crcTest_Delta[i];
+    for(i = 0; i < 2; i++)
+        crcTest_Data[500 + i] ^= crcTest_Delta[i];
+    crc8Darc = crc_crc8DarcModifyBatch(crc8Darc, Patch, sizeof(Patch) / sizeof(Patch[0]), sizeof(crcTest_Data));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8DarcCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8Darc);
+}
+
+TEST(crc_test, crc8DarcRollingInitialize)
+{
+    crc_rolling_t rolling;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8DarcRollingInitialize(NULL, 16));
+    
+    /* Zero Length Window */
+    TEST_ASSERT_FALSE(crc_crc8DarcRollingInitialize(&rolling, 0));
+    
+    /*** Initialize Rolling CRC-8/DARC ***/
+    TEST_ASSERT_TRUE(crc_crc8DarcRollingInitialize(&rolling, 16));
+}
+
+TEST(crc_test, crc8DarcRollingUpdate)
+{
+    crc_rolling_t rolling;
+    uint8_t crc8Darc;
+    uint16_t i, windowLength;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(0x5A, crc_crc8DarcRollingUpdate(NULL, 0x00, 0x00, 0x5A));
+    
+    /*** Slide Window Across Data; Verify Each Window Matches Full Calculation ***/
+    for(windowLength = 1; windowLength <= 64; windowLength += 21)
+    {
+        TEST_ASSERT_TRUE(crc_crc8DarcRollingInitialize(&rolling, windowLength));
+        crc8Darc = crc_crc8DarcCalculate(crcTest_Data, windowLength);
+        for(i = windowLength; i < sizeof(crcTest_Data); i++)
+        {
+            crc8Darc = crc_crc8DarcRollingUpdate(&rolling, crcTest_Data[i - windowLength], crcTest_Data[i], crc8Darc);
+            TEST_ASSERT_EQUAL_HEX8(crc_crc8DarcCalculate(&crcTest_Data[i - windowLength + 1], windowLength), crc8Darc);
+        }
+    }
+}
+
+TEST(crc_test, crc8DarcStripPrefix)
+{
+    uint8_t crc8Darc;
+    
+    /*** Set Up ***/
+    crc8Darc = crc_crc8DarcCalculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8Darc, crc_crc8DarcStripPrefix(crc8Darc, NULL, 37, sizeof(crcTest_Data) - 37));
+    
+    /* Zero Length Prefix */
+    TEST_ASSERT_EQUAL_HEX8(crc8Darc, crc_crc8DarcStripPrefix(crc8Darc, crcTest_Data, 0, sizeof(crcTest_Data)));
+    
+    /* Zero Length Suffix */
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_DARC_INITIAL_CRC8_DARC, crc_crc8DarcStripPrefix(crc8Darc, crcTest_Data, sizeof(crcTest_Data), 0));
+    
+    /*** Strip Prefix; Verify Result Matches Full Calculation Of Suffix ***/
+    crc8Darc = crc_crc8DarcStripPrefix(crc8Darc, crcTest_Data, 37, sizeof(crcTest_Data) - 37);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8DarcCalculate(&crcTest_Data[37], sizeof(crcTest_Data) - 37), crc8Darc);
+}
+
+TEST(crc_test, crc8DarcUnwind)
+{
+    uint8_t crc8Darc;
+    
+    /*** Set Up ***/
+    crc8Darc = crc_crc8DarcCalculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8Darc, crc_crc8DarcUnwind(crc8Darc, NULL, 29));
+    
+    /* Zero Length Data */
+    TEST_ASSERT_EQUAL_HEX8(crc8Darc, crc_crc8DarcUnwind(crc8Darc, crcTest_Data, 0));
+    
+    /*** Unwind Trailing Data; Verify Result Matches Full Calculation Without Trailing Data ***/
+    crc8Darc = crc_crc8DarcUnwind(crc8Darc, &crcTest_Data[sizeof(crcTest_Data) - 29], 29);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8DarcCalculate(crcTest_Data, sizeof(crcTest_Data) - 29), crc8Darc);
+}
+
+TEST(crc_test, crc8DarcPrefix)
+{
+    crc_prefix_t prefix;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8DarcPrefixInitialize(NULL, crcTest_Data, 32));
+    TEST_ASSERT_FALSE(crc_crc8DarcPrefixInitialize(&prefix, NULL, 32));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_DARC_INITIAL_CRC8_DARC, crc_crc8DarcPrefixCalculate(NULL, crcTest_Data, 100));
+    
+    /*** Precompute Prefix; Verify Resumed Result Matches Full Calculation ***/
+    TEST_ASSERT_TRUE(crc_crc8DarcPrefixInitialize(&prefix, crcTest_Data, 32));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8DarcCalculate(crcTest_Data, 132), crc_crc8DarcPrefixCalculate(&prefix, &crcTest_Data[32], 100));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8DarcCalculate(crcTest_Data, 33), crc_crc8DarcPrefixCalculate(&prefix, &crcTest_Data[32], 1));
+    
+    /* No Data After Prefix */
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8DarcCalculate(crcTest_Data, 32), crc_crc8DarcPrefixCalculate(&prefix, &crcTest_Data[32], 0));
+    
+    /* Empty Prefix */
+    TEST_ASSERT_TRUE(crc_crc8DarcPrefixInitialize(&prefix, NULL, 0));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8DarcCalculate(crcTest_Data, 100), crc_crc8DarcPrefixCalculate(&prefix, crcTest_Data, 100));
+}
+
+TEST(crc_test, crc8DarcCalculateMasked)
+{
+    uint8_t crc8Darc;
+    const crc_mask_t Mask[] = {{10, 4}, {100, 50}, {120, 40}, {990, 20}};
+    uint8_t m;
+    uint16_t i;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    crc8Darc = crc_crc8DarcCalculateMasked(NULL, sizeof(crcTest_Data), Mask, sizeof(Mask) / sizeof(Mask[0]));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_DARC_INITIAL_CRC8_DARC, crc8Darc);
+    crc8Darc = crc_crc8DarcCalculateMasked(crcTest_Data, sizeof(crcTest_Data), NULL, 1);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_DARC_INITIAL_CRC8_DARC, crc8Darc);
+    
+    /* Zero Length Data */
+    crc8Darc = crc_crc8DarcCalculateMasked(crcTest_Data, 0, Mask, sizeof(Mask) / sizeof(Mask[0]));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_DARC_INITIAL_CRC8_DARC, crc8Darc);
+    
+    /*** Calculate Without Masks; Verify Result Matches Full Calculation ***/
+    crc8Darc = crc_crc8DarcCalculateMasked(crcTest_Data, sizeof(crcTest_Data), NULL, 0);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8DarcCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8Darc);
+    
+    /*** Calculate With Masks; Verify Result Matches Full Calculation Of Zeroed Data ***/
+    crc8Darc = crc_crc8DarcCalculateMasked(crcTest_Data, sizeof(crcTest_Data), Mask, sizeof(Mask) / sizeof(Mask[0]));
+    for(m = 0; m < (sizeof(Mask) / sizeof(Mask[0])); m++)
+    {
+        for(i = Mask[m].offset; (i < (Mask[m].offset + Mask[m].length)) && (i < sizeof(crcTest_Data)); i++)
+            crcTest_Data[i] = 0x00;
+    }
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8DarcCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8Darc);
+}
+
+TEST(crc_test, crc8DarcCalculateBits)
+{
+    uint8_t crc8Darc;
+    uint8_t shifted[sizeof(crcTest_CheckData) + 1];
+    uint16_t i;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    crc8Darc = crc_crc8DarcCalculateBits(NULL, 0, sizeof(crcTest_CheckData) * 8);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_DARC_INITIAL_CRC8_DARC, crc8Darc);
+    
+    /* Zero Length Data */
+    crc8Darc = crc_crc8DarcCalculateBits(crcTest_CheckData, 0, 0);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_DARC_INITIAL_CRC8_DARC, crc8Darc);
+    crc8Darc = crc_crc8DarcCalculatePartialBits(0xFF, 0, CRC_CRC8_DARC_INITIAL_CRC8_DARC, false);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_DARC_INITIAL_CRC8_DARC, crc8Darc);
+    
+    /* Bit Range Beyond Address Space */
+    crc8Darc = crc_crc8DarcCalculateBits(crcTest_CheckData, 0xFFFFFFF8UL, 16);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_DARC_INITIAL_CRC8_DARC, crc8Darc);
+    
+    /*** Calculate Over Whole Bytes; Verify Result Matches Byte-Wise Calculation ***/
+    crc8Darc = crc_crc8DarcCalculateBits(crcTest_Data, 0, sizeof(crcTest_Data) * 8);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8DarcCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8Darc);
+    
+    /*** Calculate Over Check Data Shifted By 3 Bits (Least Significant Bit First) ***/
+    shifted[0] = (uint8_t)(crcTest_CheckData[0] << 3);
+    for(i = 1; i < sizeof(crcTest_CheckData); i++)
+        shifted[i] = (uint8_t)((crcTest_CheckData[i] << 3) | (crcTest_CheckData[i - 1] >> 5));
+    shifted[sizeof(crcTest_CheckData)] = (uint8_t)(crcTest_CheckData[sizeof(crcTest_CheckData) - 1] >> 5);
+    crc8Darc = crc_crc8DarcCalculateBits(shifted, 3, sizeof(crcTest_CheckData) * 8);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_DARC_CHECK, crc8Darc);
+    
+    /*** Calculate Check Data In 3 And 5 Bit Pieces ***/
+    crc8Darc = CRC_CRC8_DARC_INITIAL_CRC8_DARC;
+    for(i = 0; i < sizeof(crcTest_CheckData); i++)
+    {
+        crc8Darc = crc_crc8DarcCalculatePartialBits(crcTest_CheckData[i], 3, crc8Darc, false);
+        crc8Darc = crc_crc8DarcCalculatePartialBits((uint8_t)(crcTest_CheckData[i] >> 3), 5, crc8Darc, (i == (sizeof(crcTest_CheckData) - 1)));
+    }
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_DARC_CHECK, crc8Darc);
+    
+    /*** Calculate Over Non-Whole Byte Length; Verify Result Matches Partial Calculation ***/
+    crc8Darc = CRC_CRC8_DARC_INITIAL_CRC8_DARC;
+    for(i = 0; i < 100; i++)
+        crc8Darc = crc_crc8DarcCalculatePartial(crcTest_Data[i], crc8Darc, false);
+    crc8Darc = crc_crc8DarcCalculatePartialBits(crcTest_Data[100], 5, crc8Darc, true);
+    TEST_ASSERT_EQUAL_HEX8(crc8Darc, crc_crc8DarcCalculateBits(crcTest_Data, 0, (100 * 8) + 5));
+}
+
+TEST(crc_test, crc8DarcVerify)
+{
+    uint8_t frame[sizeof(crcTest_CheckData) + 1];
+    uint16_t i;
+    
+    /*** Set Up Check Data Followed By CRC-8/DARC ***/
+    for(i = 0; i < sizeof(crcTest_CheckData); i++)
+        frame[i] = crcTest_CheckData[i];
+    frame[sizeof(crcTest_CheckData)] = CRC_TEST_CRC8_DARC_CHECK;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8DarcVerify(NULL, sizeof(frame)));
+    
+    /* Data Shorter Than CRC-8/DARC */
+    TEST_ASSERT_FALSE(crc_crc8DarcVerify(frame, 0));
+    
+    /*** Verify Valid Frame ***/
+    TEST_ASSERT_TRUE(crc_crc8DarcVerify(frame, sizeof(frame)));
+    
+    /*** Verify Single Bit Errors Are Detected ***/
+    for(i = 0; i < (sizeof(frame) * 8); i++)
+    {
+        frame[i >> 3] ^= (uint8_t)(1U << (i & 0x07));
+        TEST_ASSERT_FALSE(crc_crc8DarcVerify(frame, sizeof(frame)));
+        frame[i >> 3] ^= (uint8_t)(1U << (i & 0x07));
+    }
+}
+
+TEST(crc_test, crc8DarcForge)
+{
+    uint8_t crc8Darc;
+    uint16_t offset;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8DarcForge(NULL, sizeof(crcTest_Data), 0, 0x00, 0x5A));
+    
+    /* Patch Beyond End Of Data */
+    TEST_ASSERT_FALSE(crc_crc8DarcForge(crcTest_Data, sizeof(crcTest_Data), sizeof(crcTest_Data) - 0, 0x00, 0x5A));
+    TEST_ASSERT_FALSE(crc_crc8DarcForge(crcTest_Data, 0, 0, 0x00, 0x5A));
+    
+    /*** Forge Target At Various Offsets (Each Target Is Current CRC-8/DARC Of Next Forge) ***/
+    crc8Darc = crc_crc8DarcCalculate(crcTest_Data, sizeof(crcTest_Data));
+    for(offset = 0; offset <= (sizeof(crcTest_Data) - 1); offset += 111)
+    {
+        TEST_ASSERT_TRUE(crc_crc8DarcForge(crcTest_Data, sizeof(crcTest_Data), offset, crc8Darc, (uint8_t)(0x5A + offset)));
+        TEST_ASSERT_EQUAL_HEX8((uint8_t)(0x5A + offset), crc_crc8DarcCalculate(crcTest_Data, sizeof(crcTest_Data)));
+        crc8Darc = (uint8_t)(0x5A + offset);
+    }
+    
+    /*** Forge Target At End Of Data ***/
+    TEST_ASSERT_TRUE(crc_crc8DarcForge(crcTest_Data, sizeof(crcTest_Data), sizeof(crcTest_Data) - 1, crc8Darc, 0x5A));
+    TEST_ASSERT_EQUAL_HEX8(0x5A, crc_crc8DarcCalculate(crcTest_Data, sizeof(crcTest_Data)));
+    
+    /*** Forge Check Value Over Check Data ***/
+    TEST_ASSERT_TRUE(crc_crc8DarcForge(crcTest_Data, sizeof(crcTest_CheckData), 3, crc_crc8DarcCalculate(crcTest_Data, sizeof(crcTest_CheckData)), CRC_TEST_CRC8_DARC_CHECK));
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_DARC_CHECK, crc_crc8DarcCalculate(crcTest_Data, sizeof(crcTest_CheckData)));
+}
+
+TEST(crc_test, crc8DvbS2Calculate)
+{
+    uint8_t crc8DvbS2;
+
+    /*** Error Check ***/
+    /* NULL Pointer */
+    crc8DvbS2 = crc_crc8DvbS2Calculate(NULL, sizeof(crcTest_CheckData));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2, crc8DvbS2);
+    
+    /* Zero Length Data */
+    crc8DvbS2 = crc_crc8DvbS2Calculate(crcTest_CheckData, 0);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2, crc8DvbS2);
+    
+    /*** Calculate CRC-8/DVB-S2 For Check Data; Verify Result As Expected ***/
+    crc8DvbS2 = crc_crc8DvbS2Calculate(crcTest_CheckData, sizeof(crcTest_CheckData));
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_DVB_S2_CHECK, crc8DvbS2);
+}
+
+TEST(crc_test, crc8DvbS2CalculatePartial)
+{
+    uint8_t crc8DvbS2, i;
+    
+    /*** Set Up ***/
+    crc8DvbS2 = CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2;
+    
+    /*** Calculate CRC-8/DVB-S2 For Check Data; Verify Result As Expected ***/
+    for(i = 0; i < sizeof(crcTest_CheckData); i++)
+        crc8DvbS2 = crc_crc8DvbS2CalculatePartial(crcTest_CheckData[i], crc8DvbS2);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_DVB_S2_CHECK, crc8DvbS2);
+}
+
+TEST(crc_test, crc8DvbS2Step)
+{
+    uint8_t crc8DvbS2, i;
+    
+    /*** Set Up ***/
+    crc8DvbS2 = CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2;
+    
+    /*** Calculate CRC-8/DVB-S2 For Check Data With Inline Step; Verify Result As Expected ***/
+    for(i = 0; i < sizeof(crcTest_CheckData); i++)
+        crc8DvbS2 = crc_crc8DvbS2Step(crcTest_CheckData[i], crc8DvbS2);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_DVB_S2_CHECK, crc8DvbS2);
+}
+
+TEST(crc_test, crc8DvbS2CalculateFixedLength)
+{
+    const uint16_t Length[] = {10, 188};
+    uint16_t crc[CRC_VARIANT_COUNT], i;
+    uint8_t crc8DvbS2, l;
+    
+    /*** Calculate CRC-8/DVB-S2 For Fixed Frame Lengths; Verify Result Matches Byte Loop ***/
+    for(l = 0; l < (sizeof(Length) / sizeof(Length[0])); l++)
+    {
+        crc8DvbS2 = CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2;
+        for(i = 0; i < (Length[l] - 1); i++)
+            crc8DvbS2 = crc_crc8DvbS2Step(crcTest_Data[i], crc8DvbS2);
+        crc8DvbS2 = crc_crc8DvbS2Step(crcTest_Data[i], crc8DvbS2);
+        TEST_ASSERT_EQUAL_HEX8(crc8DvbS2, crc_crc8DvbS2Calculate(crcTest_Data, Length[l]));
+        crc_multiCalculate(crcTest_Data, Length[l], CRC_VARIANT_MASK(CRC_VARIANT_CRC8_DVB_S2), crc);
+        TEST_ASSERT_EQUAL_HEX16(crc8DvbS2, crc[CRC_VARIANT_CRC8_DVB_S2]);
+    }
+}
+
+TEST(crc_test, crc8DvbS2Modify)
+{
+    uint8_t crc8DvbS2;
+    uint8_t i;
+    
+    /*** Set Up ***/
+    crc8DvbS2 = crc_crc8DvbS2Calculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8DvbS2, crc_crc8DvbS2Modify(crc8DvbS2, NULL, sizeof(crcTest_Delta), 0));
+    
+    /* Zero Length Delta */
+    TEST_ASSERT_EQUAL_HEX8(crc8DvbS2, crc_crc8DvbS2Modify(crc8DvbS2, crcTest_Delta, 0, 0));
+    
+    /*** Modify Data In Place; Verify Updated CRC-8/DVB-S2 Matches Full Calculation ***/
+    for(i = 0; i < sizeof(crcTest_Delta); i++)
+        crcTest_Data[100 + i] ^= crcTest_Delta[i];
+    crc8DvbS2 = crc_crc8DvbS2Modify(crc8DvbS2, crcTest_Delta, sizeof(crcTest_Delta), sizeof(crcTest_Data) - 100 - sizeof(crcTest_Delta));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8DvbS2Calculate(crcTest_Data, sizeof(crcTest_Data)), crc8DvbS2);
+    
+    /*** Modify Final Data; Verify Updated CRC-8/DVB-S2 Matches Full Calculation ***/
+    crcTest_Data[sizeof(crcTest_Data) - 1] ^= crcTest_Delta[0];
+    crc8DvbS2 = crc_crc8DvbS2Modify(crc8DvbS2, crcTest_Delta, 1, 0);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8DvbS2Calculate(crcTest_Data, sizeof(crcTest_Data)), crc8DvbS2);
+}
+
+TEST(crc_test, crc8DvbS2ModifyBatch)
+{
+    uint8_t crc8DvbS2;
+    const crc_patch_t Patch[] = {{crcTest_Delta, 0, sizeof(crcTest_Delta), 0}, {crcTest_Delta, 500, 2, 0}, {crcTest_Delta, 999, 2, 0}};
+    uint8_t i;
+    
+    /*** Set Up ***/
+    crc8DvbS2 = crc_crc8DvbS2Calculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8DvbS2, crc_crc8DvbS2ModifyBatch(crc8DvbS2, NULL, 1, sizeof(crcTest_Data)));
+    
+    /*** Modify Data In Place (Final Patch Out Of Range); Verify Updated CRC-8/DVB-S2 Matches Full Calculation ***/
+    for(i = 0; i < sizeof(crcTest_Delta); i++)
+        crcTest_Data[i] ^= crcTest_Delta[i];
+    for(i = 0; i < 2; i++)
+        crcTest_Data[500 + i] ^= crcTest_Delta[i];
+    crc8DvbS2 = crc_crc8DvbS2ModifyBatch(crc8DvbS2, Patch, sizeof(Patch) / sizeof(Patch[0]), sizeof(crcTest_Data));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8DvbS2Calculate(crcTest_Data, sizeof(crcTest_Data)), crc8DvbS2);
+}
+
+TEST(crc_test, crc8DvbS2RollingInitialize)
+{
+    crc_rolling_t rolling;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8DvbS2RollingInitialize(NULL, 16));
+    
+    /* Zero Length Window */
+    TEST_ASSERT_FALSE(crc_crc8DvbS2RollingInitialize(&rolling, 0));
+    
+    /*** Initialize Rolling CRC-8/DVB-S2 ***/
+    TEST_ASSERT_TRUE(crc_crc8DvbS2RollingInitialize(&rolling, 16));
+}
+
+TEST(crc_test, crc8DvbS2RollingUpdate)
+{
+    crc_rolling_t rolling;
+    uint8_t crc8DvbS2;
+    uint16_t i, windowLength;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(0x5A, crc_crc8DvbS2RollingUpdate(NULL, 0x00, 0x00, 0x5A));
+    
+    /*** Slide Window Across Data; Verify Each Window Matches Full Calculation ***/
+    for(windowLength = 1; windowLength <= 64; windowLength += 21)
+    {
+        TEST_ASSERT_TRUE(crc_crc8DvbS2RollingInitialize(&rolling, windowLength));
+        crc8DvbS2 = crc_crc8DvbS2Calculate(crcTest_Data, windowLength);
+        for(i = windowLength; i < sizeof(crcTest_Data); i++)
+        {
+            crc8DvbS2 = crc_crc8DvbS2RollingUpdate(&rolling, crcTest_Data[i - windowLength], crcTest_Data[i], crc8DvbS2);
+            TEST_ASSERT_EQUAL_HEX8(crc_crc8DvbS2Calculate(&crcTest_Data[i - windowLength + 1], windowLength), crc8DvbS2);
+        }
+    }
+}
+
+TEST(crc_test, crc8DvbS2StripPrefix)
+{
+    uint8_t crc8DvbS2;
+    
+    /*** Set Up ***/
+    crc8DvbS2 = crc_crc8DvbS2Calculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8DvbS2, crc_crc8DvbS2StripPrefix(crc8DvbS2, NULL, 37, sizeof(crcTest_Data) - 37));
+    
+    /* Zero Length Prefix */
+    TEST_ASSERT_EQUAL_HEX8(crc8DvbS2, crc_crc8DvbS2StripPrefix(crc8DvbS2, crcTest_Data, 0, sizeof(crcTest_Data)));
+    
+    /* Zero Length Suffix */
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2, crc_crc8DvbS2StripPrefix(crc8DvbS2, crcTest_Data, sizeof(crcTest_Data), 0));
+    
+    /*** Strip Prefix; Verify Result Matches Full Calculation Of Suffix ***/
+    crc8DvbS2 = crc_crc8DvbS2StripPrefix(crc8DvbS2, crcTest_Data, 37, sizeof(crcTest_Data) - 37);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8DvbS2Calculate(&crcTest_Data[37], sizeof(crcTest_Data) - 37), crc8DvbS2);
+}
+
+TEST(crc_test, crc8DvbS2Unwind)
+{
+    uint8_t crc8DvbS2;
+    
+    /*** Set Up ***/
+    crc8DvbS2 = crc_crc8DvbS2Calculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8DvbS2, crc_crc8DvbS2Unwind(crc8DvbS2, NULL, 29));
+    
+    /* Zero Length Data */
+    TEST_ASSERT_EQUAL_HEX8(crc8DvbS2, crc_crc8DvbS2Unwind(crc8DvbS2, crcTest_Data, 0));
+    
+    /*** Unwind Trailing Data; Verify Result Matches Full Calculation Without Trailing Data ***/
+    crc8DvbS2 = crc_crc8DvbS2Unwind(crc8DvbS2, &crcTest_Data[sizeof(crcTest_Data) - 29], 29);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8DvbS2Calculate(crcTest_Data, sizeof(crcTest_Data) - 29), crc8DvbS2);
+}
+
+TEST(crc_test, crc8DvbS2Prefix)
+{
+    crc_prefix_t prefix;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8DvbS2PrefixInitialize(NULL, crcTest_Data, 32));
+    TEST_ASSERT_FALSE(crc_crc8DvbS2PrefixInitialize(&prefix, NULL, 32));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2, crc_crc8DvbS2PrefixCalculate(NULL, crcTest_Data, 100));
+    
+    /*** Precompute Prefix; Verify Resumed Result Matches Full Calculation ***/
+    TEST_ASSERT_TRUE(crc_crc8DvbS2PrefixInitialize(&prefix, crcTest_Data, 32));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8DvbS2Calculate(crcTest_Data, 132), crc_crc8DvbS2PrefixCalculate(&prefix, &crcTest_Data[32], 100));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8DvbS2Calculate(crcTest_Data, 33), crc_crc8DvbS2PrefixCalculate(&prefix, &crcTest_Data[32], 1));
+    
+    /* No Data After Prefix */
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8DvbS2Calculate(crcTest_Data, 32), crc_crc8DvbS2PrefixCalculate(&prefix, &crcTest_Data[32], 0));
+    
+    /* Empty Prefix */
+    TEST_ASSERT_TRUE(crc_crc8DvbS2PrefixInitialize(&prefix, NULL, 0));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8DvbS2Calculate(crcTest_Data, 100), crc_crc8DvbS2PrefixCalculate(&prefix, crcTest_Data, 100));
+}
+
+TEST(crc_test, crc8DvbS2CalculateMasked)
+{
+    uint8_t crc8DvbS2;
+    const crc_mask_t Mask[] = {{10, 4}, {100, 50}, {120, 40}, {990, 20}};
+    uint8_t m;
+    uint16_t i;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    crc8DvbS2 = crc_crc8DvbS2CalculateMasked(NULL, sizeof(crcTest_Data), Mask, sizeof(Mask) / sizeof(Mask[0]));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2, crc8DvbS2);
+    crc8DvbS2 = crc_crc8DvbS2CalculateMasked(crcTest_Data, sizeof(crcTest_Data), NULL, 1);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2, crc8DvbS2);
+    
+    /* Zero Length Data */
+    crc8DvbS2 = crc_crc8DvbS2CalculateMasked(crcTest_Data, 0, Mask, sizeof(Mask) / sizeof(Mask[0]));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2, crc8DvbS2);
+    
+    /*** Calculate Without Masks; Verify Result Matches Full Calculation ***/
+    crc8DvbS2 = crc_crc8DvbS2CalculateMasked(crcTest_Data, sizeof(crcTest_Data), NULL, 0);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8DvbS2Calculate(crcTest_Data, sizeof(crcTest_Data)), crc8DvbS2);
+    
+    /*** Calculate With Masks; Verify Result Matches Full Calculation Of Zeroed Data ***/
+    crc8DvbS2 = crc_crc8DvbS2CalculateMasked(crcTest_Data, sizeof(crcTest_Data), Mask, sizeof(Mask) / sizeof(Mask[0]));
+    for(m = 0; m < (sizeof(Mask) / sizeof(Mask[0])); m++)
+    {
+        for(i = Mask[m].offset; (i < (Mask[m].offset + Mask[m].length)) && (i < sizeof(crcTest_Data)); i++)
+            crcTest_Data[i] = 0x00;
+    }
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8DvbS2Calculate(crcTest_Data, sizeof(crcTest_Data)), crc8DvbS2);
+}
+
+TEST(crc_test, crc8DvbS2CalculateBits)
+{
+    uint8_t crc8DvbS2;
+    uint8_t shifted[sizeof(crcTest_CheckData) + 1];
+    uint16_t i;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    crc8DvbS2 = crc_crc8DvbS2CalculateBits(NULL, 0, sizeof(crcTest_CheckData) * 8);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2, crc8DvbS2);
+    
+    /* Zero Length Data */
+    crc8DvbS2 = crc_crc8DvbS2CalculateBits(crcTest_CheckData, 0, 0);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2, crc8DvbS2);
+    crc8DvbS2 = crc_crc8DvbS2CalculatePartialBits(0xFF, 0, CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2, crc8DvbS2);
+    
+    /* Bit Range Beyond Address Space */
+    crc8DvbS2 = crc_crc8DvbS2CalculateBits(crcTest_CheckData, 0xFFFFFFF8UL, 16);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2, crc8DvbS2);
+    
+    /*** Calculate Over Whole Bytes; Verify Result Matches Byte-Wise Calculation ***/
+    crc8DvbS2 = crc_crc8DvbS2CalculateBits(crcTest_Data, 0, sizeof(crcTest_Data) * 8);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8DvbS2Calculate(crcTest_Data, sizeof(crcTest_Data)), crc8DvbS2);
+    
+    /*** Calculate Over Check Data Shifted By 3 Bits (Most Significant Bit First) ***/
+    shifted[0] = (uint8_t)(crcTest_CheckData[0] >> 3);
+    for(i = 1; i < sizeof(crcTest_CheckData); i++)
+        shifted[i] = (uint8_t)((crcTest_CheckData[i - 1] << 5) | (crcTest_CheckData[i] >> 3));
+    shifted[sizeof(crcTest_CheckData)] = (uint8_t)(crcTest_CheckData[sizeof(crcTest_CheckData) - 1] << 5);
+    crc8DvbS2 = crc_crc8DvbS2CalculateBits(shifted, 3, sizeof(crcTest_CheckData) * 8);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_DVB_S2_CHECK, crc8DvbS2);
+    
+    /*** Calculate Check Data In 3 And 5 Bit Pieces ***/
+    crc8DvbS2 = CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2;
+    for(i = 0; i < sizeof(crcTest_CheckData); i++)
+    {
+        crc8DvbS2 = crc_crc8DvbS2CalculatePartialBits(crcTest_CheckData[i], 3, crc8DvbS2);
+        crc8DvbS2 = crc_crc8DvbS2CalculatePartialBits((uint8_t)(crcTest_CheckData[i] << 3), 5, crc8DvbS2);
+    }
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_DVB_S2_CHECK, crc8DvbS2);
+    
+    /*** Calculate Over Non-Whole Byte Length; Verify Result Matches Partial Calculation ***/
+    crc8DvbS2 = CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2;
+    for(i = 0; i < 100; i++)
+        crc8DvbS2 = crc_crc8DvbS2CalculatePartial(crcTest_Data[i], crc8DvbS2);
+    crc8DvbS2 = crc_crc8DvbS2CalculatePartialBits(crcTest_Data[100], 5, crc8DvbS2);
+    TEST_ASSERT_EQUAL_HEX8(crc8DvbS2, crc_crc8DvbS2CalculateBits(crcTest_Data, 0, (100 * 8) + 5));
+}
+
+TEST(crc_test, crc8DvbS2Verify)
+{
+    uint8_t frame[sizeof(crcTest_CheckData) + 1];
+    uint16_t i;
+    
+    /*** Set Up Check Data Followed By CRC-8/DVB-S2 ***/
+    for(i = 0; i < sizeof(crcTest_CheckData); i++)
+        frame[i] = crcTest_CheckData[i];
+    frame[sizeof(crcTest_CheckData)] = CRC_TEST_CRC8_DVB_S2_CHECK;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8DvbS2Verify(NULL, sizeof(frame)));
+    
+    /* Data Shorter Than CRC-8/DVB-S2 */
+    TEST_ASSERT_FALSE(crc_crc8DvbS2Verify(frame, 0));
+    
+    /*** Verify Valid Frame ***/
+    TEST_ASSERT_TRUE(crc_crc8DvbS2Verify(frame, sizeof(frame)));
+    
+    /*** Verify Single Bit Errors Are Detected ***/
+    for(i = 0; i < (sizeof(frame) * 8); i++)
+    {
+        frame[i >> 3] ^= (uint8_t)(1U << (i & 0x07));
+        TEST_ASSERT_FALSE(crc_crc8DvbS2Verify(frame, sizeof(frame)));
+        frame[i >> 3] ^= (uint8_t)(1U << (i & 0x07));
+    }
+}
+
+TEST(crc_test, crc8DvbS2Forge)
+{
+    uint8_t crc8DvbS2;
+    uint16_t offset;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8DvbS2Forge(NULL, sizeof(crcTest_Data), 0, 0x00, 0x5A));
+    
+    /* Patch Beyond End Of Data */
+    TEST_ASSERT_FALSE(crc_crc8DvbS2Forge(crcTest_Data, sizeof(crcTest_Data), sizeof(crcTest_Data) - 0, 0x00, 0x5A));
+    TEST_ASSERT_FALSE(crc_crc8DvbS2Forge(crcTest_Data, 0, 0, 0x00, 0x5A));
+    
+    /*** Forge Target At Various Offsets (Each Target Is Current CRC-8/DVB-S2 Of Next Forge) ***/
+    crc8DvbS2 = crc_crc8DvbS2Calculate(crcTest_Data, sizeof(crcTest_Data));
+    for(offset = 0; offset <= (sizeof(crcTest_Data) - 1); offset += 111)
+    {
+        TEST_ASSERT_TRUE(crc_crc8DvbS2Forge(crcTest_Data, sizeof(crcTest_Data), offset, crc8DvbS2, (uint8_t)(0x5A + offset)));
+        TEST_ASSERT_EQUAL_HEX8((uint8_t)(0x5A + offset), crc_crc8DvbS2Calculate(crcTest_Data, sizeof(crcTest_Data)));
+        crc8DvbS2 = (uint8_t)(0x5A + offset);
+    }
+    
+    /*** Forge Target At End Of Data ***/
+    TEST_ASSERT_TRUE(crc_crc8DvbS2Forge(crcTest_Data, sizeof(crcTest_Data), sizeof(crcTest_Data) - 1, crc8DvbS2, 0x5A));
+    TEST_ASSERT_EQUAL_HEX8(0x5A, crc_crc8DvbS2Calculate(crcTest_Data, sizeof(crcTest_Data)));
+    
+    /*** Forge Check Value Over Check Data ***/
+    TEST_ASSERT_TRUE(crc_crc8DvbS2Forge(crcTest_Data, sizeof(crcTest_CheckData), 3, crc_crc8DvbS2Calculate(crcTest_Data, sizeof(crcTest_CheckData)), CRC_TEST_CRC8_DVB_S2_CHECK));
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_DVB_S2_CHECK, crc_crc8DvbS2Calculate(crcTest_Data, sizeof(crcTest_CheckData)));
+}
+
+TEST(crc_test, crc8EbuCalculate)
+{
+    uint8_t crc8Ebu;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    crc8Ebu = crc_crc8EbuCalculate(NULL, sizeof(crcTest_CheckData));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_EBU_INITIAL_CRC8_EBU, crc8Ebu);
+    
+    /* Zero Length Data */
+    crc8Ebu = crc_crc8EbuCalculate(crcTest_CheckData, 0);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_EBU_INITIAL_CRC8_EBU, crc8Ebu);
+    
+    /*** Calculate CRC-8/EBU For Check Data; Verify Result As Expected ***/
+    crc8Ebu = crc_crc8EbuCalculate(crcTest_CheckData, sizeof(crcTest_CheckData));
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_EBU_CHECK, crc8Ebu);
+}
+
+TEST(crc_test, crc8EbuCalculatePartial)
+{
+    uint8_t crc8Ebu, i;
+    
+    /*** Set Up ***/
+    crc8Ebu = CRC_CRC8_EBU_INITIAL_CRC8_EBU;
+    
+    /*** Calculate CRC-8/EBU For Check Data; Verify Result As Expected ***/
+    for(i = 0; i < (sizeof(crcTest_CheckData) - 1); i++)
+        crc8Ebu = crc_crc8EbuCalculatePartial(crcTest_CheckData[i], crc8Ebu, false);
+    crc8Ebu = crc_crc8EbuCalculatePartial(crcTest_CheckData[i], crc8Ebu, true);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_EBU_CHECK, crc8Ebu);
+}
+
+TEST(crc_test, crc8EbuStep)
+{
+    uint8_t crc8Ebu, i;
+    
+    /*** Set Up ***/
+    crc8Ebu = CRC_CRC8_EBU_INITIAL_CRC8_EBU;
+    
+    /*** Calculate CRC-8/EBU For Check Data With Inline Step; Verify Result As Expected ***/
+    for(i = 0; i < (sizeof(crcTest_CheckData) - 1); i++)
+        crc8Ebu = crc_crc8EbuStep(crcTest_CheckData[i], crc8Ebu);
+    crc8Ebu = crc_crc8EbuCalculatePartial(crcTest_CheckData[i], crc8Ebu, true);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_EBU_CHECK, crc8Ebu);
+}
+
+TEST(crc_test, crc8EbuModify)
+{
+    uint8_t crc8Ebu;
+    uint8_t i;
+    
+    /*** Set Up ***/
+    crc8Ebu = crc_crc8EbuCalculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8Ebu, crc_crc8EbuModify(crc8Ebu, NULL, sizeof(crcTest_Delta), 0));
+    
+    /* Zero Length Delta */
+    TEST_ASSERT_EQUAL_HEX8(crc8Ebu, crc_crc8EbuModify(crc8Ebu, crcTest_Delta, 0, 0));
+    
+    /*** Modify Data In Place; Verify Updated CRC-8/EBU Matches Full Calculation ***/
+    for(i = 0; i < sizeof(crcTest_Delta); i++)
+        crcTest_Data[100 + i] ^= crcTest_Delta[i];
+    crc8Ebu = crc_crc8EbuModify(crc8Ebu, crcTest_Delta, sizeof(crcTest_Delta), sizeof(crcTest_Data) - 100 - sizeof(crcTest_Delta));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8EbuCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8Ebu);
+    
+    /*** Modify Final Data; Verify Updated CRC-8/EBU Matches Full Calculation ***/
+    crcTest_Data[sizeof(crcTest_Data) - 1] ^= crcTest_Delta[0];
+    crc8Ebu = crc_crc8EbuModify(crc8Ebu, crcTest_Delta, 1, 0);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8EbuCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8Ebu);
+}
+
+TEST(crc_test, crc8EbuModifyBatch)
+{
+    uint8_t crc8Ebu;
+    const crc_patch_t Patch[] = {{crcTest_Delta, 0, sizeof(crcTest_Delta), 0}, {crcTest_Delta, 500, 2, 0}, {crcTest_Delta, 999, 2, 0}};
+    uint8_t i;
+    
+    /*** Set Up ***/
+    crc8Ebu = crc_crc8EbuCalculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8Ebu, crc_crc8EbuModifyBatch(crc8Ebu, NULL, 1, sizeof(crcTest_Data)));
+    
+    /*** Modify Data In Place (Final Patch Out Of Range); Verify Updated CRC-8/EBU Matches Full Calculation ***/
+    for(i = 0; i < sizeof(crcTest_Delta); i++)
+        crcTest_Data[i] ^= crcTest_Delta[i];
+    for(i = 0; i < 2; i++)
+        crcTest_Data[500 + i] ^= crcTest_Delta[i];
+    crc8Ebu = crc_crc8EbuModifyBatch(crc8Ebu, Patch, sizeof(Patch) / sizeof(Patch[0]), sizeof(crcTest_Data));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8EbuCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8Ebu);
+}
+
+TEST(crc_test, crc8EbuRollingInitialize)
+{
+    crc_rolling_t rolling;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8EbuRollingInitialize(NULL, 16));
+    
+    /* Zero Length Window */
+    TEST_ASSERT_FALSE(crc_crc8EbuRollingInitialize(&rolling, 0));
+    
+    /*** Initialize Rolling CRC-8/EBU ***/
+    TEST_ASSERT_TRUE(crc_crc8EbuRollingInitialize(&rolling, 16));
+}
+
+TEST(crc_test, crc8EbuRollingUpdate)
+{
+    crc_rolling_t rolling;
+    uint8_t crc8Ebu;
+    uint16_t i, windowLength;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(0x5A, crc_crc8EbuRollingUpdate(NULL, 0x00, 0x00, 0x5A));
+    
+    /*** Slide Window Across Data; Verify Each Window Matches Full Calculation ***/
+    for(windowLength = 1; windowLength <= 64; windowLength += 21)
+    {
+        TEST_ASSERT_TRUE(crc_crc8EbuRollingInitialize(&rolling, windowLength));
+        crc8Ebu = crc_crc8EbuCalculate(crcTest_Data, windowLength);
+        for(i = windowLength; i < sizeof(crcTest_Data); i++)
+        {
+            crc8Ebu = crc_crc8EbuRollingUpdate(&rolling, crcTest_Data[i - windowLength], crcTest_Data[i], crc8Ebu);
+            TEST_ASSERT_EQUAL_HEX8(crc_crc8EbuCalculate(&crcTest_Data[i - windowLength + 1], windowLength), crc8Ebu);
+        }
+    }
+}
+
+TEST(crc_test, crc8EbuStripPrefix)
+{
+    uint8_t crc8Ebu;
+    
+    /*** Set Up ***/
+    crc8Ebu = crc_crc8EbuCalculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8Ebu, crc_crc8EbuStripPrefix(crc8Ebu, NULL, 37, sizeof(crcTest_Data) - 37));
+    
+    /* Zero Length Prefix */
+    TEST_ASSERT_EQUAL_HEX8(crc8Ebu, crc_crc8EbuStripPrefix(crc8Ebu, crcTest_Data, 0, sizeof(crcTest_Data)));
+    
+    /* Zero Length Suffix */
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_EBU_INITIAL_CRC8_EBU, crc_crc8EbuStripPrefix(crc8Ebu, crcTest_Data, sizeof(crcTest_Data), 0));
+    
+    /*** Strip Prefix; Verify Result Matches Full Calculation Of Suffix ***/
+    crc8Ebu = crc_crc8EbuStripPrefix(crc8Ebu, crcTest_Data, 37, sizeof(crcTest_Data) - 37);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8EbuCalculate(&crcTest_Data[37], sizeof(crcTest_Data) - 37), crc8Ebu);
+}
+
+TEST(crc_test, crc8EbuUnwind)
+{
+    uint8_t crc8Ebu;
+    
+    /*** Set Up ***/
+    crc8Ebu = crc_crc8EbuCalculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8Ebu, crc_crc8EbuUnwind(crc8Ebu, NULL, 29));
+    
+    /* Zero Length Data */
+    TEST_ASSERT_EQUAL_HEX8(crc8Ebu, crc_crc8EbuUnwind(crc8Ebu, crcTest_Data, 0));
+    
+    /*** Unwind Trailing Data; Verify Result Matches Full Calculation Without Trailing Data ***/
+    crc8Ebu = crc_crc8EbuUnwind(crc8Ebu, &crcTest_Data[sizeof(crcTest_Data) - 29], 29);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8EbuCalculate(crcTest_Data, sizeof(crcTest_Data) - 29), crc8Ebu);
+}
+
+TEST(crc_test, crc8EbuPrefix)
+{
+    crc_prefix_t prefix;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8EbuPrefixInitialize(NULL, crcTest_Data, 32));
+    TEST_ASSERT_FALSE(crc_crc8EbuPrefixInitialize(&prefix, NULL, 32));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_EBU_INITIAL_CRC8_EBU, crc_crc8EbuPrefixCalculate(NULL, crcTest_Data, 100));
+    
+    /*** Precompute Prefix; Verify Resumed Result Matches Full Calculation ***/
+    TEST_ASSERT_TRUE(crc_crc8EbuPrefixInitialize(&prefix, crcTest_Data, 32));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8EbuCalculate(crcTest_Data, 132), crc_crc8EbuPrefixCalculate(&prefix, &crcTest_Data[32], 100));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8EbuCalculate(crcTest_Data, 33), crc_crc8EbuPrefixCalculate(&prefix, &crcTest_Data[32], 1));
+    
+    /* No Data After Prefix */
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8EbuCalculate(crcTest_Data, 32), crc_crc8EbuPrefixCalculate(&prefix, &crcTest_Data[32], 0));
+    
+    /* Empty Prefix */
+    TEST_ASSERT_TRUE(crc_crc8EbuPrefixInitialize(&prefix, NULL, 0));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8EbuCalculate(crcTest_Data, 100), crc_crc8EbuPrefixCalculate(&prefix, crcTest_Data, 100));
+}
+
+TEST(crc_test, crc8EbuCalculateMasked)
+{
+    uint8_t crc8Ebu;
+    const crc_mask_t Mask[] = {{10, 4}, {100, 50}, {120, 40}, {990, 20}};
+    uint8_t m;
+    uint16_t i;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    crc8Ebu = crc_crc8EbuCalculateMasked(NULL, sizeof(crcTest_Data), Mask, sizeof(Mask) / sizeof(Mask[0]));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_EBU_INITIAL_CRC8_EBU, crc8Ebu);
+    crc8Ebu = crc_crc8EbuCalculateMasked(crcTest_Data, sizeof(crcTest_Data), NULL, 1);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_EBU_INITIAL_CRC8_EBU, crc8Ebu);
+    
+    /* Zero Length Data */
+    crc8Ebu = crc_crc8EbuCalculateMasked(crcTest_Data, 0, Mask, sizeof(Mask) / sizeof(Mask[0]));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_EBU_INITIAL_CRC8_EBU, crc8Ebu);
+    
+    /*** Calculate Without Masks; Verify Result Matches Full Calculation ***/
+    crc8Ebu = crc_crc8EbuCalculateMasked(crcTest_Data, sizeof(crcTest_Data), NULL, 0);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8EbuCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8Ebu);
+    
+    /*** Calculate With Masks; Verify Result Matches Full Calculation Of Zeroed Data ***/
+    crc8Ebu = crc_crc8EbuCalculateMasked(crcTest_Data, sizeof(crcTest_Data), Mask, sizeof(Mask) / sizeof(Mask[0]));
+    for(m = 0; m < (sizeof(Mask) / sizeof(Mask[0])); m++)
+    {
+        for(i = Mask[m].offset; (i < (Mask[m].offset + Mask[m].length)) && (i < sizeof(crcTest_Data)); i++)
+            crcTest_Data[i] = 0x00;
+    }
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8EbuCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8Ebu);
+}
+
+TEST(crc_test, crc8EbuCalculateBits)
+{
+    uint8_t crc8Ebu;
+    uint8_t shifted[sizeof(crcTest_CheckData) + 1];
+    uint16_t i;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    crc8Ebu = crc_crc8EbuCalculateBits(NULL, 0, sizeof(crcTest_CheckData) * 8);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_EBU_INITIAL_CRC8_EBU, crc8Ebu);
+    
+    /* Zero Length Data */
+    crc8Ebu = crc_crc8EbuCalculateBits(crcTest_CheckData, 0, 0);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_EBU_INITIAL_CRC8_EBU, crc8Ebu);
+    crc8Ebu = crc_crc8EbuCalculatePartialBits(0xFF, 0, CRC_CRC8_EBU_INITIAL_CRC8_EBU, false);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_EBU_INITIAL_CRC8_EBU, crc8Ebu);
+    
+    /* Bit Range Beyond Address Space */
+    crc8Ebu = crc_crc8EbuCalculateBits(crcTest_CheckData, 0xFFFFFFF8UL, 16);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_EBU_INITIAL_CRC8_EBU, crc8Ebu);
+    
+    /*** Calculate Over Whole Bytes; Verify Result Matches Byte-Wise Calculation ***/
+    crc8Ebu = crc_crc8EbuCalculateBits(crcTest_Data, 0, sizeof(crcTest_Data) * 8);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8EbuCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8Ebu);
+    
+    /*** Calculate Over Check Data Shifted By 3 Bits (Least Significant Bit First) ***/
+    shifted[0] = (uint8_t)(crcTest_CheckData[0] << 3);
+    for(i = 1; i < sizeof(crcTest_CheckData); i++)
+        shifted[i] = (uint8_t)((crcTest_CheckData[i] << 3) | (crcTest_CheckData[i - 1] >> 5));
+    shifted[sizeof(crcTest_CheckData)] = (uint8_t)(crcTest_CheckData[sizeof(crcTest_CheckData) - 1] >> 5);
+    crc8Ebu = crc_crc8EbuCalculateBits(shifted, 3, sizeof(crcTest_CheckData) * 8);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_EBU_CHECK, crc8Ebu);
+    
+    /*** Calculate Check Data In 3 And 5 Bit Pieces ***/
+    crc8Ebu = CRC_CRC8_EBU_INITIAL_CRC8_EBU;
+    for(i = 0; i < sizeof(crcTest_CheckData); i++)
+    {
+        crc8Ebu = crc_crc8EbuCalculatePartialBits(crcTest_CheckData[i], 3, crc8Ebu, false);
+        crc8Ebu = crc_crc8EbuCalculatePartialBits((uint8_t)(crcTest_CheckData[i] >> 3), 5, crc8Ebu, (i == (sizeof(crcTest_CheckData) - 1)));
+    }
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_EBU_CHECK, crc8Ebu);
+    
+    /*** Calculate Over Non-Whole Byte Length; Verify Result Matches Partial Calculation ***/
+    crc8Ebu = CRC_CRC8_EBU_INITIAL_CRC8_EBU;
+    for(i = 0; i < 100; i++)
+        crc8Ebu = crc_crc8EbuCalculatePartial(crcTest_Data[i], crc8Ebu, false);
+    crc8Ebu = crc_crc8EbuCalculatePartialBits(crcTest_Data[100], 5, crc8Ebu, true);
+    TEST_ASSERT_EQUAL_HEX8(crc8Ebu, crc_crc8EbuCalculateBits(crcTest_Data, 0, (100 * 8) + 5));
+}
+
+TEST(crc_test, crc8EbuVerify)
+{
+    uint8_t frame[sizeof(crcTest_CheckData) + 1];
+    uint16_t i;
+    
+    /*** Set Up Check Data Followed By CRC-8/EBU ***/
+    for(i = 0; i < sizeof(crcTest_CheckData); i++)
+        frame[i] = crcTest_CheckData[i];
+    frame[sizeof(crcTest_CheckData)] = CRC_TEST_CRC8_EBU_CHECK;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8EbuVerify(NULL, sizeof(frame)));
+    
+    /* Data Shorter Than CRC-8/EBU */
+    TEST_ASSERT_FALSE(crc_crc8EbuVerify(frame, 0));
+    
+    /*** Verify Valid Frame ***/
+    TEST_ASSERT_TRUE(crc_crc8EbuVerify(frame, sizeof(frame)));
+    
+    /*** Verify Single Bit Errors Are Detected ***/
+    for(i = 0; i < (sizeof(frame) * 8); i++)
+    {
+        frame[i >> 3] ^= (uint8_t)(1U << (i & 0x07));
+        TEST_ASSERT_FALSE(crc_crc8EbuVerify(frame, sizeof(frame)));
+        frame[i >> 3] ^= (uint8_t)(1U << (i & 0x07));
+    }
+}
+
+TEST(crc_test, crc8EbuForge)
+{
+    uint8_t crc8Ebu;
+    uint16_t offset;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8EbuForge(NULL, sizeof(crcTest_Data), 0, 0x00, 0x5A));
+    
+    /* Patch Beyond End Of Data */
+    TEST_ASSERT_FALSE(crc_crc8EbuForge(crcTest_Data, sizeof(crcTest_Data), sizeof(crcTest_Data) - 0, 0x00, 0x5A));
+    TEST_ASSERT_FALSE(crc_crc8EbuForge(crcTest_Data, 0, 0, 0x00, 0x5A));
+    
+    /*** Forge Target At Various Offsets (Each Target Is Current CRC-8/EBU Of Next Forge) ***/
+    crc8Ebu = crc_crc8EbuCalculate(crcTest_Data, sizeof(crcTest_Data));
+    for(offset = 0; offset <= (sizeof(crcTest_Data) - 1); offset += 111)
+    {
+        TEST_ASSERT_TRUE(crc_crc8EbuForge(crcTest_Data, sizeof(crcTest_Data), offset, crc8Ebu, (uint8_t)(0x5A + offset)));
+        TEST_ASSERT_EQUAL_HEX8((uint8_t)(0x5A + offset), crc_crc8EbuCalculate(crcTest_Data, sizeof(crcTest_Data)));
+        crc8Ebu = (uint8_t)(0x5A + offset);
+    }
+    
+    /*** Forge Target At End Of Data ***/
+    TEST_ASSERT_TRUE(crc_crc8EbuForge(crcTest_Data, sizeof(crcTest_Data), sizeof(crcTest_Data) - 1, crc8Ebu, 0x5A));
+    TEST_ASSERT_EQUAL_HEX8(0x5A, crc_crc8EbuCalculate(crcTest_Data, sizeof(crcTest_Data)));
+    
+    /*** Forge Check Value Over Check Data ***/
+    TEST_ASSERT_TRUE(crc_crc8EbuForge(crcTest_Data, sizeof(crcTest_CheckData), 3, crc_crc8EbuCalculate(crcTest_Data, sizeof(crcTest_CheckData)), CRC_TEST_CRC8_EBU_CHECK));
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_EBU_CHECK, crc_crc8EbuCalculate(crcTest_Data, sizeof(crcTest_CheckData)));
+}
+
+TEST(crc_test, crc8ICodeCalculate)
+{
+    uint8_t crc8ICode;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    crc8ICode = crc_crc8ICodeCalculate(NULL, sizeof(crcTest_CheckData));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE, crc8ICode);
+    
+    /* Zero Length Data */
+    crc8ICode = crc_crc8ICodeCalculate(crcTest_CheckData, 0);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE, crc8ICode);
+    
+    /*** Calculate CRC-8/I-CODE For Check Data; Verify Result As Expected ***/
+    crc8ICode = crc_crc8ICodeCalculate(crcTest_CheckData, sizeof(crcTest_CheckData));
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_I_CODE_CHECK, crc8ICode);
+}
+
+TEST(crc_test, crc8ICodeCalculatePartial)
+{
+    uint8_t crc8ICode, i;
+    
+    /*** Set Up ***/
+    crc8ICode = CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE;
+    
+    /*** Calculate CRC-8/I-CODE For Check Data; Verify Result As Expected ***/
+    for(i = 0; i < sizeof(crcTest_CheckData); i++)
+        crc8ICode = crc_crc8ICodeCalculatePartial(crcTest_CheckData[i], crc8ICode);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_I_CODE_CHECK, crc8ICode);
+}
+
+TEST(crc_test, crc8ICodeStep)
+{
+    uint8_t crc8ICode, i;
+    
+    /*** Set Up ***/
+    crc8ICode = CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE;
+    
+    /*** Calculate CRC-8/I-CODE For Check Data With Inline Step; Verify Result As Expected ***/
+    for(i = 0; i < sizeof(crcTest_CheckData); i++)
+        crc8ICode = crc_crc8ICodeStep(crcTest_CheckData[i], crc8ICode);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_I_CODE_CHECK, crc8ICode);
+}
+
+TEST(crc_test, crc8ICodeModify)
+{
+    uint8_t crc8ICode;
+    uint8_t i;
+    
+    /*** Set Up ***/
+    crc8ICode = crc_crc8ICodeCalculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8ICode, crc_crc8ICodeModify(crc8ICode, NULL, sizeof(crcTest_Delta), 0));
+    
+    /* Zero Length Delta */
+    TEST_ASSERT_EQUAL_HEX8(crc8ICode, crc_crc8ICodeModify(crc8ICode, crcTest_Delta, 0, 0));
+    
+    /*** Modify Data In Place; Verify Updated CRC-8/I-CODE Matches Full Calculation ***/
+    for(i = 0; i < sizeof(crcTest_Delta); i++)
+        crcTest_Data[100 + i] ^= crcTest_Delta[i];
+    crc8ICode = crc_crc8ICodeModify(crc8ICode, crcTest_Delta, sizeof(crcTest_Delta), sizeof(crcTest_Data) - 100 - sizeof(crcTest_Delta));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8ICodeCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8ICode);
+    
+    /*** Modify Final Data; Verify Updated CRC-8/I-CODE Matches Full Calculation ***/
+    crcTest_Data[sizeof(crcTest_Data) - 1] ^= crcTest_Delta[0];
+    crc8ICode = crc_crc8ICodeModify(crc8ICode, crcTest_Delta, 1, 0);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8ICodeCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8ICode);
+}
+
+TEST(crc_test, crc8ICodeModifyBatch)
+{
+    uint8_t crc8ICode;
+    const crc_patch_t Patch[] = {{crcTest_Delta, 0, sizeof(crcTest_Delta), 0}, {crcTest_Delta, 500, 2, 0}, {crcTest_Delta, 999, 2, 0}};
+    uint8_t i;
+    
+    /*** Set Up ***/
+    crc8ICode = crc_crc8ICodeCalculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8ICode, crc_crc8ICodeModifyBatch(crc8ICode, NULL, 1, sizeof(crcTest_Data)));
+    
+    /*** Modify Data In Place (Final Patch Out Of Range); Verify Updated CRC-8/I-CODE Matches Full Calculation ***/
+    for(i = 0; i < sizeof(crcTest_Delta); i++)
+        crcTest_Data[i] ^= crcTest_Delta[i];
+    for(i = 0; i < 2; i++)
+        crcTest_Data[500 + i] ^= crcTest_Delta[i];
+    crc8ICode = crc_crc8ICodeModifyBatch(crc8ICode, Patch, sizeof(Patch) / sizeof(Patch[0]), sizeof(crcTest_Data));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8ICodeCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8ICode);
+}
+
+TEST(crc_test, crc8ICodeRollingInitialize)
+{
+    crc_rolling_t rolling;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8ICodeRollingInitialize(NULL, 16));
+    
+    /* Zero Length Window */
+    TEST_ASSERT_FALSE(crc_crc8ICodeRollingInitialize(&rolling, 0));
+    
+    /*** Initialize Rolling CRC-8/I-CODE ***/
+    TEST_ASSERT_TRUE(crc_crc8ICodeRollingInitialize(&rolling, 16));
+}
+
+TEST(crc_test, crc8ICodeRollingUpdate)
+{
+    crc_rolling_t rolling;
+    uint8_t crc8ICode;
+    uint16_t i, windowLength;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(0x5A, crc_crc8ICodeRollingUpdate(NULL, 0x00, 0x00, 0x5A));
+    
+    /*** Slide Window Across Data; Verify Each Window Matches Full Calculation ***/
+    for(windowLength = 1; windowLength <= 64; windowLength += 21)
+    {
+        TEST_ASSERT_TRUE(crc_crc8ICodeRollingInitialize(&rolling, windowLength));
+        crc8ICode = crc_crc8ICodeCalculate(crcTest_Data, windowLength);
+        for(i = windowLength; i < sizeof(crcTest_Data); i++)
+        {
+            crc8ICode = crc_crc8ICodeRollingUpdate(&rolling, crcTest_Data[i - windowLength], crcTest_Data[i], crc8ICode);
+            TEST_ASSERT_EQUAL_HEX8(crc_crc8ICodeCalculate(&crcTest_Data[i - windowLength + 1], windowLength), crc8ICode);
+        }
+    }
+}
+
+TEST(crc_test, crc8ICodeStripPrefix)
+{
+    uint8_t crc8ICode;
+    
+    /*** Set Up ***/
+    crc8ICode = crc_crc8ICodeCalculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8ICode, crc_crc8ICodeStripPrefix(crc8ICode, NULL, 37, sizeof(crcTest_Data) - 37));
+    
+    /* Zero Length Prefix */
+    TEST_ASSERT_EQUAL_HEX8(crc8ICode, crc_crc8ICodeStripPrefix(crc8ICode, crcTest_Data, 0, sizeof(crcTest_Data)));
+    
+    /* Zero Length Suffix */
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE, crc_crc8ICodeStripPrefix(crc8ICode, crcTest_Data, sizeof(crcTest_Data), 0));
+    
+    /*** Strip Prefix; Verify Result Matches Full Calculation Of Suffix ***/
+    crc8ICode = crc_crc8ICodeStripPrefix(crc8ICode, crcTest_Data, 37, sizeof(crcTest_Data) - 37);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8ICodeCalculate(&crcTest_Data[37], sizeof(crcTest_Data) - 37), crc8ICode);
+}
+
+TEST(crc_test, crc8ICodeUnwind)
+{
+    uint8_t crc8ICode;
+    
+    /*** Set Up ***/
+    crc8ICode = crc_crc8ICodeCalculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8ICode, crc_crc8ICodeUnwind(crc8ICode, NULL, 29));
+    
+    /* Zero Length Data */
+    TEST_ASSERT_EQUAL_HEX8(crc8ICode, crc_crc8ICodeUnwind(crc8ICode, crcTest_Data, 0));
+    
+    /*** Unwind Trailing Data; Verify Result Matches Full Calculation Without Trailing Data ***/
+    crc8ICode = crc_crc8ICodeUnwind(crc8ICode, &crcTest_Data[sizeof(crcTest_Data) - 29], 29);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8ICodeCalculate(crcTest_Data, sizeof(crcTest_Data) - 29), crc8ICode);
+}
+
+TEST(crc_test, crc8ICodePrefix)
+{
+    crc_prefix_t prefix;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8ICodePrefixInitialize(NULL, crcTest_Data, 32));
+    TEST_ASSERT_FALSE(crc_crc8ICodePrefixInitialize(&prefix, NULL, 32));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE, crc_crc8ICodePrefixCalculate(NULL, crcTest_Data, 100));
+    
+    /*** Precompute Prefix; Verify Resumed Result Matches Full Calculation ***/
+    TEST_ASSERT_TRUE(crc_crc8ICodePrefixInitialize(&prefix, crcTest_Data, 32));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8ICodeCalculate(crcTest_Data, 132), crc_crc8ICodePrefixCalculate(&prefix, &crcTest_Data[32], 100));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8ICodeCalculate(crcTest_Data, 33), crc_crc8ICodePrefixCalculate(&prefix, &crcTest_Data[32], 1));
+    
+    /* No Data After Prefix */
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8ICodeCalculate(crcTest_Data, 32), crc_crc8ICodePrefixCalculate(&prefix, &crcTest_Data[32], 0));
+    
+    /* Empty Prefix */
+    TEST_ASSERT_TRUE(crc_crc8ICodePrefixInitialize(&prefix, NULL, 0));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8ICodeCalculate(crcTest_Data, 100), crc_crc8ICodePrefixCalculate(&prefix, crcTest_Data, 100));
+}
+
+TEST(crc_test, crc8ICodeCalculateMasked)
+{
+    uint8_t crc8ICode;
+    const crc_mask_t Mask[] = {{10, 4}, {100, 50}, {120, 40}, {990, 20}};
+    uint8_t m;
+    uint16_t i;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    crc8ICode = crc_crc8ICodeCalculateMasked(NULL, sizeof(crcTest_Data), Mask, sizeof(Mask) / sizeof(Mask[0]));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE, crc8ICode);
+    crc8ICode = crc_crc8ICodeCalculateMasked(crcTest_Data, sizeof(crcTest_Data), NULL, 1);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE, crc8ICode);
+    
+    /* Zero Length Data */
+    crc8ICode = crc_crc8ICodeCalculateMasked(crcTest_Data, 0, Mask, sizeof(Mask) / sizeof(Mask[0]));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE, crc8ICode);
+    
+    /*** Calculate Without Masks; Verify Result Matches Full Calculation ***/
+    crc8ICode = crc_crc8ICodeCalculateMasked(crcTest_Data, sizeof(crcTest_Data), NULL, 0);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8ICodeCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8ICode);
+    
+    /*** Calculate With Masks; Verify Result Matches Full Calculation Of Zeroed Data ***/
+    crc8ICode = crc_crc8ICodeCalculateMasked(crcTest_Data, sizeof(crcTest_Data), Mask, sizeof(Mask) / sizeof(Mask[0]));
+    for(m = 0; m < (sizeof(Mask) / sizeof(Mask[0])); m++)
+    {
+        for(i = Mask[m].offset; (i < (Mask[m].offset + Mask[m].length)) && (i < sizeof(crcTest_Data)); i++)
+            crcTest_Data[i] = 0x00;
+    }
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8ICodeCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8ICode);
+}
+
+TEST(crc_test, crc8ICodeCalculateBits)
+{
+    uint8_t crc8ICode;
+    uint8_t shifted[sizeof(crcTest_CheckData) + 1];
+    uint16_t i;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    crc8ICode = crc_crc8ICodeCalculateBits(NULL, 0, sizeof(crcTest_CheckData) * 8);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE, crc8ICode);
+    
+    /* Zero Length Data */
+    crc8ICode = crc_crc8ICodeCalculateBits(crcTest_CheckData, 0, 0);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE, crc8ICode);
+    crc8ICode = crc_crc8ICodeCalculatePartialBits(0xFF, 0, CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE, crc8ICode);
+    
+    /* Bit Range Beyond Address Space */
+    crc8ICode = crc_crc8ICodeCalculateBits(crcTest_CheckData, 0xFFFFFFF8UL, 16);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE, crc8ICode);
+    
+    /*** Calculate Over Whole Bytes; Verify Result Matches Byte-Wise Calculation ***/
+    crc8ICode = crc_crc8ICodeCalculateBits(crcTest_Data, 0, sizeof(crcTest_Data) * 8);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8ICodeCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8ICode);
+    
+    /*** Calculate Over Check Data Shifted By 3 Bits (Most Significant Bit First) ***/
+    shifted[0] = (uint8_t)(crcTest_CheckData[0] >> 3);
+    for(i = 1; i < sizeof(crcTest_CheckData); i++)
+        shifted[i] = (uint8_t)((crcTest_CheckData[i - 1] << 5) | (crcTest_CheckData[i] >> 3));
+    shifted[sizeof(crcTest_CheckData)] = (uint8_t)(crcTest_CheckData[sizeof(crcTest_CheckData) - 1] << 5);
+    crc8ICode = crc_crc8ICodeCalculateBits(shifted, 3, sizeof(crcTest_CheckData) * 8);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_I_CODE_CHECK, crc8ICode);
+    
+    /*** Calculate Check Data In 3 And 5 Bit Pieces ***/
+    crc8ICode = CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE;
+    for(i = 0; i < sizeof(crcTest_CheckData); i++)
+    {
+        crc8ICode = crc_crc8ICodeCalculatePartialBits(crcTest_CheckData[i], 3, crc8ICode);
+        crc8ICode = crc_crc8ICodeCalculatePartialBits((uint8_t)(crcTest_CheckData[i] << 3), 5, crc8ICode);
+    }
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_I_CODE_CHECK, crc8ICode);
+    
+    /*** Calculate Over Non-Whole Byte Length; Verify Result Matches Partial Calculation ***/
+    crc8ICode = CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE;
+    for(i = 0; i < 100; i++)
+        crc8ICode = crc_crc8ICodeCalculatePartial(crcTest_Data[i], crc8ICode);
+    crc8ICode = crc_crc8ICodeCalculatePartialBits(crcTest_Data[100], 5, crc8ICode);
+    TEST_ASSERT_EQUAL_HEX8(crc8ICode, crc_crc8ICodeCalculateBits(crcTest_Data, 0, (100 * 8) + 5));
+}
+
+TEST(crc_test, crc8ICodeVerify)
+{
+    uint8_t frame[sizeof(crcTest_CheckData) + 1];
+    uint16_t i;
+    
+    /*** Set Up Check Data Followed By CRC-8/I-CODE ***/
+    for(i = 0; i < sizeof(crcTest_CheckData); i++)
+        frame[i] = crcTest_CheckData[i];
+    frame[sizeof(crcTest_CheckData)] = CRC_TEST_CRC8_I_CODE_CHECK;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8ICodeVerify(NULL, sizeof(frame)));
+    
+    /* Data Shorter Than CRC-8/I-CODE */
+    TEST_ASSERT_FALSE(crc_crc8ICodeVerify(frame, 0));
+    
+    /*** Verify Valid Frame ***/
+    TEST_ASSERT_TRUE(crc_crc8ICodeVerify(frame, sizeof(frame)));
+    
+    /*** Verify Single Bit Errors Are Detected ***/
+    for(i = 0; i < (sizeof(frame) * 8); i++)
+    {
+        frame[i >> 3] ^= (uint8_t)(1U << (i & 0x07));
+        TEST_ASSERT_FALSE(crc_crc8ICodeVerify(frame, sizeof(frame)));
+        frame[i >> 3] ^= (uint8_t)(1U << (i & 0x07));
+    }
+}
+
+TEST(crc_test, crc8ICodeForge)
+{
+    uint8_t crc8ICode;
+    uint16_t offset;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8ICodeForge(NULL, sizeof(crcTest_Data), 0, 0x00, 0x5A));
+    
+    /* Patch Beyond End Of Data */
+    TEST_ASSERT_FALSE(crc_crc8ICodeForge(crcTest_Data, sizeof(crcTest_Data), sizeof(crcTest_Data) - 0, 0x00, 0x5A));
+    TEST_ASSERT_FALSE(crc_crc8ICodeForge(crcTest_Data, 0, 0, 0x00, 0x5A));
+    
+    /*** Forge Target At Various Offsets (Each Target Is Current CRC-8/I-CODE Of Next Forge) ***/
+    crc8ICode = crc_crc8ICodeCalculate(crcTest_Data, sizeof(crcTest_Data));
+    for(offset = 0; offset <= (sizeof(crcTest_Data) - 1); offset += 111)
+    {
+        TEST_ASSERT_TRUE(crc_crc8ICodeForge(crcTest_Data, sizeof(crcTest_Data), offset, crc8ICode, (uint8_t)(0x5A + offset)));
+        TEST_ASSERT_EQUAL_HEX8((uint8_t)(0x5A + offset), crc_crc8ICodeCalculate(crcTest_Data, sizeof(crcTest_Data)));
+        crc8ICode = (uint8_t)(0x5A + offset);
+    }
+    
+    /*** Forge Target At End Of Data ***/
+    TEST_ASSERT_TRUE(crc_crc8ICodeForge(crcTest_Data, sizeof(crcTest_Data), sizeof(crcTest_Data) - 1, crc8ICode, 0x5A));
+    TEST_ASSERT_EQUAL_HEX8(0x5A, crc_crc8ICodeCalculate(crcTest_Data, sizeof(crcTest_Data)));
+    
+    /*** Forge Check Value Over Check Data ***/
+    TEST_ASSERT_TRUE(crc_crc8ICodeForge(crcTest_Data, sizeof(crcTest_CheckData), 3, crc_crc8ICodeCalculate(crcTest_Data, sizeof(crcTest_CheckData)), CRC_TEST_CRC8_I_CODE_CHECK));
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_I_CODE_CHECK, crc_crc8ICodeCalculate(crcTest_Data, sizeof(crcTest_CheckData)));
+}
+
+TEST(crc_test, crc8ItuCalculate)
+{
+    uint8_t crc8Itu;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    crc8Itu = crc_crc8ItuCalculate(NULL, sizeof(crcTest_CheckData));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_ITU_INITIAL_CRC8_ITU, crc8Itu);
+    
+    /* Zero Length Data */
+    crc8Itu = crc_crc8ItuCalculate(crcTest_CheckData, 0);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_ITU_INITIAL_CRC8_ITU, crc8Itu);
+    
+    /*** Calculate CRC-8/ITU For Check Data; Verify Result As Expected ***/
+    crc8Itu = crc_crc8ItuCalculate(crcTest_CheckData, sizeof(crcTest_CheckData));
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_ITU_CHECK, crc8Itu);
+}
+
+TEST(crc_test, crc8ItuCalculatePartial)
+{
+    uint8_t crc8Itu, i;
+    
+    /*** Set Up ***/
+    crc8Itu = CRC_CRC8_ITU_INITIAL_CRC8_ITU;
+    
+    /*** Calculate CRC-8/ITU For Check Data; Verify Result As Expected ***/
+    for(i = 0; i < (sizeof(crcTest_CheckData) - 1); i++)
+        crc8Itu = crc_crc8ItuCalculatePartial(crcTest_CheckData[i], crc8Itu, false);
+    crc8Itu = crc_crc8ItuCalculatePartial(crcTest_CheckData[i], crc8Itu, true);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_ITU_CHECK, crc8Itu);
+}
+
+TEST(crc_test, crc8ItuStep)
+{
+    uint8_t crc8Itu, i;
+    
+    /*** Set Up ***/
+    crc8Itu = CRC_CRC8_ITU_INITIAL_CRC8_ITU;
+    
+    /*** Calculate CRC-8/ITU For Check Data With Inline Step; Verify Result As Expected ***/
+    for(i = 0; i < (sizeof(crcTest_CheckData) - 1); i++)
+        crc8Itu = crc_crc8ItuStep(crcTest_CheckData[i], crc8Itu);
+    crc8Itu = crc_crc8ItuCalculatePartial(crcTest_CheckData[i], crc8Itu, true);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_ITU_CHECK, crc8Itu);
+}
+
+TEST(crc_test, crc8ItuModify)
+{
+    uint8_t crc8Itu;
+    uint8_t i;
+    
+    /*** Set Up ***/
+    crc8Itu = crc_crc8ItuCalculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8Itu, crc_crc8ItuModify(crc8Itu, NULL, sizeof(crcTest_Delta), 0));
+    
+    /* Zero Length Delta */
+    TEST_ASSERT_EQUAL_HEX8(crc8Itu, crc_crc8ItuModify(crc8Itu, crcTest_Delta, 0, 0));
+    
+    /*** Modify Data In Place; Verify Updated CRC-8/ITU Matches Full Calculation ***/
+    for(i = 0; i < sizeof(crcTest_Delta); i++)
+        crcTest_Data[100 + i] ^= crcTest_Delta[i];
+    crc8Itu = crc_crc8ItuModify(crc8Itu, crcTest_Delta, sizeof(crcTest_Delta), sizeof(crcTest_Data) - 100 - sizeof(crcTest_Delta));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8ItuCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8Itu);
+    
+    /*** Modify Final Data; Verify Updated CRC-8/ITU Matches Full Calculation ***/
+    crcTest_Data[sizeof(crcTest_Data) - 1] ^= crcTest_Delta[0];
+    crc8Itu = crc_crc8ItuModify(crc8Itu, crcTest_Delta, 1, 0);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8ItuCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8Itu);
+}
+
+TEST(crc_test, crc8ItuModifyBatch)
+{
+    uint8_t crc8Itu;
+    const crc_patch_t Patch[] = {{crcTest_Delta, 0, sizeof(crcTest_Delta), 0}, {crcTest_Delta, 500, 2, 0}, {crcTest_Delta, 999, 2, 0}};
+    uint8_t i;
+    
+    /*** Set Up ***/
+    crc8Itu = crc_crc8ItuCalculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8Itu, crc_crc8ItuModifyBatch(crc8Itu, NULL, 1, sizeof(crcTest_Data)));
+    
+    /*** Modify Data In Place (Final Patch Out Of Range); Verify Updated CRC-8/ITU Matches Full Calculation ***/
+    for(i = 0; i < sizeof(crcTest_Delta); i++)
+        crcTest_Data[i] ^= crcTest_Delta[i];
+    for(i = 0; i < 2; i++)
+        crcTest_Data[500 + i] ^= crcTest_Delta[i];
+    crc8Itu = crc_crc8ItuModifyBatch(crc8Itu, Patch, sizeof(Patch) / sizeof(Patch[0]), sizeof(crcTest_Data));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8ItuCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8Itu);
+}
+
+TEST(crc_test, crc8ItuRollingInitialize)
+{
+    crc_rolling_t rolling;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8ItuRollingInitialize(NULL, 16));
+    
+    /* Zero Length Window */
+    TEST_ASSERT_FALSE(crc_crc8ItuRollingInitialize(&rolling, 0));
+    
+    /*** Initialize Rolling CRC-8/ITU ***/
+    TEST_ASSERT_TRUE(crc_crc8ItuRollingInitialize(&rolling, 16));
+}
+
+TEST(crc_test, crc8ItuRollingUpdate)
+{
+    crc_rolling_t rolling;
+    uint8_t crc8Itu;
+    uint16_t i, windowLength;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(0x5A, crc_crc8ItuRollingUpdate(NULL, 0x00, 0x00, 0x5A));
+    
+    /*** Slide Window Across Data; Verify Each Window Matches Full Calculation ***/
+    for(windowLength = 1; windowLength <= 64; windowLength += 21)
+    {
+        TEST_ASSERT_TRUE(crc_crc8ItuRollingInitialize(&rolling, windowLength));
+        crc8Itu = crc_crc8ItuCalculate(crcTest_Data, windowLength);
+        for(i = windowLength; i < sizeof(crcTest_Data); i++)
+        {
+            crc8Itu = crc_crc8ItuRollingUpdate(&rolling, crcTest_Data[i - windowLength], crcTest_Data[i], crc8Itu);
+            TEST_ASSERT_EQUAL_HEX8(crc_crc8ItuCalculate(&crcTest_Data[i - windowLength + 1], windowLength), crc8Itu);
+        }
+    }
+}
+
+TEST(crc_test, crc8ItuStripPrefix)
+{
+    uint8_t crc8Itu;
+    
+    /*** Set Up ***/
+    crc8Itu = crc_crc8ItuCalculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8Itu, crc_crc8ItuStripPrefix(crc8Itu, NULL, 37, sizeof(crcTest_Data) - 37));
+    
+    /* Zero Length Prefix */
+    TEST_ASSERT_EQUAL_HEX8(crc8Itu, crc_crc8ItuStripPrefix(crc8Itu, crcTest_Data, 0, sizeof(crcTest_Data)));
+    
+    /* Zero Length Suffix */
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_ITU_INITIAL_CRC8_ITU, crc_crc8ItuStripPrefix(crc8Itu, crcTest_Data, sizeof(crcTest_Data), 0));
+    
+    /*** Strip Prefix; Verify Result Matches Full Calculation Of Suffix ***/
+    crc8Itu = crc_crc8ItuStripPrefix(crc8Itu, crcTest_Data, 37, sizeof(crcTest_Data) - 37);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8ItuCalculate(&crcTest_Data[37], sizeof(crcTest_Data) - 37), crc8Itu);
+}
+
+TEST(crc_test, crc8ItuUnwind)
+{
+    uint8_t crc8Itu;
+    
+    /*** Set Up ***/
+    crc8Itu = crc_crc8ItuCalculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8Itu, crc_crc8ItuUnwind(crc8Itu, NULL, 29));
+    
+    /* Zero Length Data */
+    TEST_ASSERT_EQUAL_HEX8(crc8Itu, crc_crc8ItuUnwind(crc8Itu, crcTest_Data, 0));
+    
+    /*** Unwind Trailing Data; Verify Result Matches Full Calculation Without Trailing Data ***/
+    crc8Itu = crc_crc8ItuUnwind(crc8Itu, &crcTest_Data[sizeof(crcTest_Data) - 29], 29);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8ItuCalculate(crcTest_Data, sizeof(crcTest_Data) - 29), crc8Itu);
+}
+
+TEST(crc_test, crc8ItuPrefix)
+{
+    crc_prefix_t prefix;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8ItuPrefixInitialize(NULL, crcTest_Data, 32));
+    TEST_ASSERT_FALSE(crc_crc8ItuPrefixInitialize(&prefix, NULL, 32));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_ITU_INITIAL_CRC8_ITU, crc_crc8ItuPrefixCalculate(NULL, crcTest_Data, 100));
+    
+    /*** Precompute Prefix; Verify Resumed Result Matches Full Calculation ***/
+    TEST_ASSERT_TRUE(crc_crc8ItuPrefixInitialize(&prefix, crcTest_Data, 32));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8ItuCalculate(crcTest_Data, 132), crc_crc8ItuPrefixCalculate(&prefix, &crcTest_Data[32], 100));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8ItuCalculate(crcTest_Data, 33), crc_crc8ItuPrefixCalculate(&prefix, &crcTest_Data[32], 1));
+    
+    /* No Data After Prefix */
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8ItuCalculate(crcTest_Data, 32), crc_crc8ItuPrefixCalculate(&prefix, &crcTest_Data[32], 0));
+    
+    /* Empty Prefix */
+    TEST_ASSERT_TRUE(crc_crc8ItuPrefixInitialize(&prefix, NULL, 0));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8ItuCalculate(crcTest_Data, 100), crc_crc8ItuPrefixCalculate(&prefix, crcTest_Data, 100));
+}
+
+TEST(crc_test, crc8ItuCalculateMasked)
+{
+    uint8_t crc8Itu;
+    const crc_mask_t Mask[] = {{10, 4}, {100, 50}, {120, 40}, {990, 20}};
+    uint8_t m;
+    uint16_t i;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    crc8Itu = crc_crc8ItuCalculateMasked(NULL, sizeof(crcTest_Data), Mask, sizeof(Mask) / sizeof(Mask[0]));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_ITU_INITIAL_CRC8_ITU, crc8Itu);
+    crc8Itu = crc_crc8ItuCalculateMasked(crcTest_Data, sizeof(crcTest_Data), NULL, 1);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_ITU_INITIAL_CRC8_ITU, crc8Itu);
+    
+    /* Zero Length Data */
+    crc8Itu = crc_crc8ItuCalculateMasked(crcTest_Data, 0, Mask, sizeof(Mask) / sizeof(Mask[0]));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_ITU_INITIAL_CRC8_ITU, crc8Itu);
+    
+    /*** Calculate Without Masks; Verify Result Matches Full Calculation ***/
+    crc8Itu = crc_crc8ItuCalculateMasked(crcTest_Data, sizeof(crcTest_Data), NULL, 0);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8ItuCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8Itu);
+    
+    /*** Calculate With Masks; Verify Result Matches Full Calculation Of Zeroed Data ***/
+    crc8Itu = crc_crc8ItuCalculateMasked(crcTest_Data, sizeof(crcTest_Data), Mask, sizeof(Mask) / sizeof(Mask[0]));
+    for(m = 0; m < (sizeof(Mask) / sizeof(Mask[0])); m++)
+    {
+        for(i = Mask[m].offset; (i < (Mask[m].offset + Mask[m].length)) && (i < sizeof(crcTest_Data)); i++)
+            crcTest_Data[i] = 0x00;
+    }
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8ItuCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8Itu);
+}
+
+TEST(crc_test, crc8ItuCalculateBits)
+{
+    uint8_t crc8Itu;
+    uint8_t shifted[sizeof(crcTest_CheckData) + 1];
+    uint16_t i;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    crc8Itu = crc_crc8ItuCalculateBits(NULL, 0, sizeof(crcTest_CheckData) * 8);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_ITU_INITIAL_CRC8_ITU, crc8Itu);
+    
+    /* Zero Length Data */
+    crc8Itu = crc_crc8ItuCalculateBits(crcTest_CheckData, 0, 0);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_ITU_INITIAL_CRC8_ITU, crc8Itu);
+    crc8Itu = crc_crc8ItuCalculatePartialBits(0xFF, 0, CRC_CRC8_ITU_INITIAL_CRC8_ITU, false);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_ITU_INITIAL_CRC8_ITU, crc8Itu);
+    
+    /* Bit Range Beyond Address Space */
+    crc8Itu = crc_crc8ItuCalculateBits(crcTest_CheckData, 0xFFFFFFF8UL, 16);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_ITU_INITIAL_CRC8_ITU, crc8Itu);
+    
+    /*** Calculate Over Whole Bytes; Verify Result Matches Byte-Wise Calculation ***/
+    crc8Itu = crc_crc8ItuCalculateBits(crcTest_Data, 0, sizeof(crcTest_Data) * 8);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8ItuCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8Itu);
+    
+    /*** Calculate Over Check Data Shifted By 3 Bits (Most Significant Bit First) ***/
+    shifted[0] = (uint8_t)(crcTest_CheckData[0] >> 3);
+    for(i = 1; i < sizeof(crcTest_CheckData); i++)
+        shifted[i] = (uint8_t)((crcTest_CheckData[i - 1] << 5) | (crcTest_CheckData[i] >> 3));
+    shifted[sizeof(crcTest_CheckData)] = (uint8_t)(crcTest_CheckData[sizeof(crcTest_CheckData) - 1] << 5);
+    crc8Itu = crc_crc8ItuCalculateBits(shifted, 3, sizeof(crcTest_CheckData) * 8);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_ITU_CHECK, crc8Itu);
+    
+    /*** Calculate Check Data In 3 And 5 Bit Pieces ***/
+    crc8Itu = CRC_CRC8_ITU_INITIAL_CRC8_ITU;
+    for(i = 0; i < sizeof(crcTest_CheckData); i++)
+    {
+        crc8Itu = crc_crc8ItuCalculatePartialBits(crcTest_CheckData[i], 3, crc8Itu, false);
+        crc8Itu = crc_crc8ItuCalculatePartialBits((uint8_t)(crcTest_CheckData[i] << 3), 5, crc8Itu, (i == (sizeof(crcTest_CheckData) - 1)));
+    }
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_ITU_CHECK, crc8Itu);
+    
+    /*** Calculate Over Non-Whole Byte Length; Verify Result Matches Partial Calculation ***/
+    crc8Itu = CRC_CRC8_ITU_INITIAL_CRC8_ITU;
+    for(i = 0; i < 100; i++)
+        crc8Itu = crc_crc8ItuCalculatePartial(crcTest_Data[i], crc8Itu, false);
+    crc8Itu = crc_crc8ItuCalculatePartialBits(crcTest_Data[100], 5, crc8Itu, true);
+    TEST_ASSERT_EQUAL_HEX8(crc8Itu, crc_crc8ItuCalculateBits(crcTest_Data, 0, (100 * 8) + 5));
+}
+
+TEST(crc_test, crc8ItuVerify)
+{
+    uint8_t frame[sizeof(crcTest_CheckData) + 1];
+    uint16_t i;
+    
+    /*** Set Up Check Data Followed By CRC-8/ITU ***/
+    for(i = 0; i < sizeof(crcTest_CheckData); i++)
+        frame[i] = crcTest_CheckData[i];
+    frame[sizeof(crcTest_CheckData)] = CRC_TEST_CRC8_ITU_CHECK;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8ItuVerify(NULL, sizeof(frame)));
+    
+    /* Data Shorter Than CRC-8/ITU */
+    TEST_ASSERT_FALSE(crc_crc8ItuVerify(frame, 0));
+    
+    /*** Verify Valid Frame ***/
+    TEST_ASSERT_TRUE(crc_crc8ItuVerify(frame, sizeof(frame)));
+    
+    /*** Verify Single Bit Errors Are Detected ***/
+    for(i = 0; i < (sizeof(frame) * 8); i++)
+    {
+        frame[i >> 3] ^= (uint8_t)(1U << (i & 0x07));
+        TEST_ASSERT_FALSE(crc_crc8ItuVerify(frame, sizeof(frame)));
+        frame[i >> 3] ^= (uint8_t)(1U << (i & 0x07));
+    }
+}
+
+TEST(crc_test, crc8ItuForge)
+{
+    uint8_t crc8Itu;
+    uint16_t offset;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8ItuForge(NULL, sizeof(crcTest_Data), 0, 0x00, 0x5A));
+    
+    /* Patch Beyond End Of Data */
+    TEST_ASSERT_FALSE(crc_crc8ItuForge(crcTest_Data, sizeof(crcTest_Data), sizeof(crcTest_Data) - 0, 0x00, 0x5A));
+    TEST_ASSERT_FALSE(crc_crc8ItuForge(crcTest_Data, 0, 0, 0x00, 0x5A));
+    
+    /*** Forge Target At Various Offsets (Each Target Is Current CRC-8/ITU Of Next Forge) ***/
+    crc8Itu = crc_crc8ItuCalculate(crcTest_Data, sizeof(crcTest_Data));
+    for(offset = 0; offset <= (sizeof(crcTest_Data) - 1); offset += 111)
+    {
+        TEST_ASSERT_TRUE(crc_crc8ItuForge(crcTest_Data, sizeof(crcTest_Data), offset, crc8Itu, (uint8_t)(0x5A + offset)));
+        TEST_ASSERT_EQUAL_HEX8((uint8_t)(0x5A + offset), crc_crc8ItuCalculate(crcTest_Data, sizeof(crcTest_Data)));
+        crc8Itu = (uint8_t)(0x5A + offset);
+    }
+    
+    /*** Forge Target At End Of Data ***/
+    TEST_ASSERT_TRUE(crc_crc8ItuForge(crcTest_Data, sizeof(crcTest_Data), sizeof(crcTest_Data) - 1, crc8Itu, 0x5A));
+    TEST_ASSERT_EQUAL_HEX8(0x5A, crc_crc8ItuCalculate(crcTest_Data, sizeof(crcTest_Data)));
+    
+    /*** Forge Check Value Over Check Data ***/
+    TEST_ASSERT_TRUE(crc_crc8ItuForge(crcTest_Data, sizeof(crcTest_CheckData), 3, crc_crc8ItuCalculate(crcTest_Data, sizeof(crcTest_CheckData)), CRC_TEST_CRC8_ITU_CHECK));
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_ITU_CHECK, crc_crc8ItuCalculate(crcTest_Data, sizeof(crcTest_CheckData)));
+}
+
+TEST(crc_test, crc8MaximCalculate)
+{
+    uint8_t crc8Maxim;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    crc8Maxim = crc_crc8MaximCalculate(NULL, sizeof(crcTest_CheckData));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM, crc8Maxim);
+    
+    /* Zero Length Data */
+    crc8Maxim = crc_crc8MaximCalculate(crcTest_CheckData, 0);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM, crc8Maxim);
+    
+    /*** Calculate CRC-8/MAXIM For Check Data; Verify Result As Expected ***/
+    crc8Maxim = crc_crc8MaximCalculate(crcTest_CheckData, sizeof(crcTest_CheckData));
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_MAXIM_CHECK, crc8Maxim);
+}
+
+TEST(crc_test, crc8MaximCalculatePartial)
+{
+    uint8_t crc8Maxim, i;
+    
+    /*** Set Up ***/
+    crc8Maxim = CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM;
+    
+    /*** Calculate CRC-8/MAXIM For Check Data; Verify Result As Expected ***/
+    for(i = 0; i < (sizeof(crcTest_CheckData) - 1); i++)
+        crc8Maxim = crc_crc8MaximCalculatePartial(crcTest_CheckData[i], crc8Maxim, false);
+    crc8Maxim = crc_crc8MaximCalculatePartial(crcTest_CheckData[i], crc8Maxim, true);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_MAXIM_CHECK, crc8Maxim);
+}
+
+TEST(crc_test, crc8MaximStep)
+{
+    uint8_t crc8Maxim, i;
+    
+    /*** Set Up ***/
+    crc8Maxim = CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM;
+    
+    /*** Calculate CRC-8/MAXIM For Check Data With Inline Step; Verify Result As Expected ***/
+    for(i = 0; i < (sizeof(crcTest_CheckData) - 1); i++)
+        crc8Maxim = crc_crc8MaximStep(crcTest_CheckData[i], crc8Maxim);
+    crc8Maxim = crc_crc8MaximCalculatePartial(crcTest_CheckData[i], crc8Maxim, true);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_MAXIM_CHECK, crc8Maxim);
+}
+
+TEST(crc_test, crc8MaximCalculateFixedLength)
+{
+    const uint16_t Length[] = {8};
+    uint16_t crc[CRC_VARIANT_COUNT], i;
+    uint8_t crc8Maxim, l;
+    
+    /*** Calculate CRC-8/MAXIM For Fixed Frame Lengths; Verify Result Matches Byte Loop ***/
+    for(l = 0; l < (sizeof(Length) / sizeof(Length[0])); l++)
+    {
+        crc8Maxim = CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM;
+        for(i = 0; i < (Length[l] - 1); i++)
+            crc8Maxim = crc_crc8MaximStep(crcTest_Data[i], crc8Maxim);
+        crc8Maxim = crc_crc8MaximCalculatePartial(crcTest_Data[i], crc8Maxim, true);
+        TEST_ASSERT_EQUAL_HEX8(crc8Maxim, crc_crc8MaximCalculate(crcTest_Data, Length[l]));
+        crc_multiCalculate(crcTest_Data, Length[l], CRC_VARIANT_MASK(CRC_VARIANT_CRC8_MAXIM), crc);
+        TEST_ASSERT_EQUAL_HEX16(crc8Maxim, crc[CRC_VARIANT_CRC8_MAXIM]);
+    }
+}
+
+TEST(crc_test, crc8MaximModify)
+{
+    uint8_t crc8Maxim;
+    uint8_t i;
+    
+    /*** Set Up ***/
+    crc8Maxim = crc_crc8MaximCalculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8Maxim, crc_crc8MaximModify(crc8Maxim, NULL, sizeof(crcTest_Delta), 0));
+    
+    /* Zero Length Delta */
+    TEST_ASSERT_EQUAL_HEX8(crc8Maxim, crc_crc8MaximModify(crc8Maxim, crcTest_Delta, 0, 0));
+    
+    /*** Modify Data In Place; Verify Updated CRC-8/MAXIM Matches Full Calculation ***/
+    for(i = 0; i < sizeof(crcTest_Delta); i++)
+        crcTest_Data[100 + i] ^= crcTest_Delta[i];
+    crc8Maxim = crc_crc8MaximModify(crc8Maxim, crcTest_Delta, sizeof(crcTest_Delta), sizeof(crcTest_Data) - 100 - sizeof(crcTest_Delta));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8MaximCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8Maxim);
+    
+    /*** Modify Final Data; Verify Updated CRC-8/MAXIM Matches Full Calculation ***/
+    crcTest_Data[sizeof(crcTest_Data) - 1] ^= crcTest_Delta[0];
+    crc8Maxim = crc_crc8MaximModify(crc8Maxim, crcTest_Delta, 1, 0);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8MaximCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8Maxim);
+}
+
+TEST(crc_test, crc8MaximModifyBatch)
+{
+    uint8_t crc8Maxim;
+    const crc_patch_t Patch[] = {{crcTest_Delta, 0, sizeof(crcTest_Delta), 0}, {crcTest_Delta, 500, 2, 0}, {crcTest_Delta, 999, 2, 0}};
+    uint8_t i;
+    
+    /*** Set Up ***/
+    crc8Maxim = crc_crc8MaximCalculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8Maxim, crc_crc8MaximModifyBatch(crc8Maxim, NULL, 1, sizeof(crcTest_Data)));
+    
+    /*** Modify Data In Place (Final Patch Out Of Range); Verify Updated CRC-8/MAXIM Matches Full Calculation ***/
+    for(i = 0; i < sizeof(crcTest_Delta); i++)
+        crcTest_Data[i] ^= crcTest_Delta[i];
+    for(i = 0; i < 2; i++)
+        crcTest_Data[500 + i] ^= crcTest_Delta[i];
+    crc8Maxim = crc_crc8MaximModifyBatch(crc8Maxim, Patch, sizeof(Patch) / sizeof(Patch[0]), sizeof(crcTest_Data));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8MaximCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8Maxim);
+}
+
+TEST(crc_test, crc8MaximRollingInitialize)
+{
+    crc_rolling_t rolling;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8MaximRollingInitialize(NULL, 16));
+    
+    /* Zero Length Window */
+    TEST_ASSERT_FALSE(crc_crc8MaximRollingInitialize(&rolling, 0));
+    
+    /*** Initialize Rolling CRC-8/MAXIM ***/
+    TEST_ASSERT_TRUE(crc_crc8MaximRollingInitialize(&rolling, 16));
+}
+
+TEST(crc_test, crc8MaximRollingUpdate)
+{
+    crc_rolling_t rolling;
+    uint8_t crc8Maxim;
+    uint16_t i, windowLength;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(0x5A, crc_crc8MaximRollingUpdate(NULL, 0x00, 0x00, 0x5A));
+    
+    /*** Slide Window Across Data; Verify Each Window Matches Full Calculation ***/
+    for(windowLength = 1; windowLength <= 64; windowLength += 21)
+    {
+        TEST_ASSERT_TRUE(crc_crc8MaximRollingInitialize(&rolling, windowLength));
+        crc8Maxim = crc_crc8MaximCalculate(crcTest_Data, windowLength);
+        for(i = windowLength; i < sizeof(crcTest_Data); i++)
+        {
+            crc8Maxim = crc_crc8MaximRollingUpdate(&rolling, crcTest_Data[i - windowLength], crcTest_Data[i], crc8Maxim);
+            TEST_ASSERT_EQUAL_HEX8(crc_crc8MaximCalculate(&crcTest_Data[i - windowLength + 1], windowLength), crc8Maxim);
+        }
+    }
+}
+
+TEST(crc_test, crc8MaximStripPrefix)
+{
+    uint8_t crc8Maxim;
+    
+    /*** Set Up ***/
+    crc8Maxim = crc_crc8MaximCalculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8Maxim, crc_crc8MaximStripPrefix(crc8Maxim, NULL, 37, sizeof(crcTest_Data) - 37));
+    
+    /* Zero Length Prefix */
+    TEST_ASSERT_EQUAL_HEX8(crc8Maxim, crc_crc8MaximStripPrefix(crc8Maxim, crcTest_Data, 0, sizeof(crcTest_Data)));
+    
+    /* Zero Length Suffix */
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM, crc_crc8MaximStripPrefix(crc8Maxim, crcTest_Data, sizeof(crcTest_Data), 0));
+    
+    /*** Strip Prefix; Verify Result Matches Full Calculation Of Suffix ***/
+    crc8Maxim = crc_crc8MaximStripPrefix(crc8Maxim, crcTest_Data, 37, sizeof(crcTest_Data) - 37);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8MaximCalculate(&crcTest_Data[37], sizeof(crcTest_Data) - 37), crc8Maxim);
+}
+
+TEST(crc_test, crc8MaximUnwind)
+{
+    uint8_t crc8Maxim;
+    
+    /*** Set Up ***/
+    crc8Maxim = crc_crc8MaximCalculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8Maxim, crc_crc8MaximUnwind(crc8Maxim, NULL, 29));
+    
+    /* Zero Length Data */
+    TEST_ASSERT_EQUAL_HEX8(crc8Maxim, crc_crc8MaximUnwind(crc8Maxim, crcTest_Data, 0));
+    
+    /*** Unwind Trailing Data; Verify Result Matches Full Calculation Without Trailing Data ***/
+    crc8Maxim = crc_crc8MaximUnwind(crc8Maxim, &crcTest_Data[sizeof(crcTest_Data) - 29], 29);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8MaximCalculate(crcTest_Data, sizeof(crcTest_Data) - 29), crc8Maxim);
+}
+
+TEST(crc_test, crc8MaximPrefix)
+{
+    crc_prefix_t prefix;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8MaximPrefixInitialize(NULL, crcTest_Data, 32));
+    TEST_ASSERT_FALSE(crc_crc8MaximPrefixInitialize(&prefix, NULL, 32));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM, crc_crc8MaximPrefixCalculate(NULL, crcTest_Data, 100));
+    
+    /*** Precompute Prefix; Verify Resumed Result Matches Full Calculation ***/
+    TEST_ASSERT_TRUE(crc_crc8MaximPrefixInitialize(&prefix, crcTest_Data, 32));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8MaximCalculate(crcTest_Data, 132), crc_crc8MaximPrefixCalculate(&prefix, &crcTest_Data[32], 100));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8MaximCalculate(crcTest_Data, 33), crc_crc8MaximPrefixCalculate(&prefix, &crcTest_Data[32], 1));
+    
+    /* No Data After Prefix */
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8MaximCalculate(crcTest_Data, 32), crc_crc8MaximPrefixCalculate(&prefix, &crcTest_Data[32], 0));
+    
+    /* Empty Prefix */
+    TEST_ASSERT_TRUE(crc_crc8MaximPrefixInitialize(&prefix, NULL, 0));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8MaximCalculate(crcTest_Data, 100), crc_crc8MaximPrefixCalculate(&prefix, crcTest_Data, 100));
+}
+
+TEST(crc_test, crc8MaximCalculateMasked)
+{
+    uint8_t crc8Maxim;
+    const crc_mask_t Mask[] = {{10, 4}, {100, 50}, {120, 40}, {990, 20}};
+    uint8_t m;
+    uint16_t i;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    crc8Maxim = crc_crc8MaximCalculateMasked(NULL, sizeof(crcTest_Data), Mask, sizeof(Mask) / sizeof(Mask[0]));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM, crc8Maxim);
+    crc8Maxim = crc_crc8MaximCalculateMasked(crcTest_Data, sizeof(crcTest_Data), NULL, 1);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM, crc8Maxim);
+    
+    /* Zero Length Data */
+    crc8Maxim = crc_crc8MaximCalculateMasked(crcTest_Data, 0, Mask, sizeof(Mask) / sizeof(Mask[0]));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM, crc8Maxim);
+    
+    /*** Calculate Without Masks; Verify Result Matches Full Calculation ***/
+    crc8Maxim = crc_crc8MaximCalculateMasked(crcTest_Data, sizeof(crcTest_Data), NULL, 0);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8MaximCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8Maxim);
+    
+    /*** Calculate With Masks; Verify Result Matches Full Calculation Of Zeroed Data ***/
+    crc8Maxim = crc_crc8MaximCalculateMasked(crcTest_Data, sizeof(crcTest_Data), Mask, sizeof(Mask) / sizeof(Mask[0]));
+    for(m = 0; m < (sizeof(Mask) / sizeof(Mask[0])); m++)
+    {
+        for(i = Mask[m].offset; (i < (Mask[m].offset + Mask[m].length)) && (i < sizeof(crcTest_Data)); i++)
+            crcTest_Data[i] = 0x00;
+    }
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8MaximCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8Maxim);
+}
+
+TEST(crc_test, crc8MaximCalculateBits)
+{
+    uint8_t crc8Maxim;
+    uint8_t shifted[sizeof(crcTest_CheckData) + 1];
+    uint16_t i;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    crc8Maxim = crc_crc8MaximCalculateBits(NULL, 0, sizeof(crcTest_CheckData) * 8);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM, crc8Maxim);
+    
+    /* Zero Length Data */
+    crc8Maxim = crc_crc8MaximCalculateBits(crcTest_CheckData, 0, 0);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM, crc8Maxim);
+    crc8Maxim = crc_crc8MaximCalculatePartialBits(0xFF, 0, CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM, false);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM, crc8Maxim);
+    
+    /* Bit Range Beyond Address Space */
+    crc8Maxim = crc_crc8MaximCalculateBits(crcTest_CheckData, 0xFFFFFFF8UL, 16);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM, crc8Maxim);
+    
+    /*** Calculate Over Whole Bytes; Verify Result Matches Byte-Wise Calculation ***/
+    crc8Maxim = crc_crc8MaximCalculateBits(crcTest_Data, 0, sizeof(crcTest_Data) * 8);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8MaximCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8Maxim);
+    
+    /*** Calculate Over Check Data Shifted By 3 Bits (Least Significant Bit First) ***/
+    shifted[0] = (uint8_t)(crcTest_CheckData[0] << 3);
+    for(i = 1; i < sizeof(crcTest_CheckData); i++)
+        shifted[i] = (uint8_t)((crcTest_CheckData[i] << 3) | (crcTest_CheckData[i - 1] >> 5));
+    shifted[sizeof(crcTest_CheckData)] = (uint8_t)(crcTest_CheckData[sizeof(crcTest_CheckData) - 1] >> 5);
+    crc8Maxim = crc_crc8MaximCalculateBits(shifted, 3, sizeof(crcTest_CheckData) * 8);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_MAXIM_CHECK, crc8Maxim);
+    
+    /*** Calculate Check Data In 3 And 5 Bit Pieces ***/
+    crc8Maxim = CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM;
+    for(i = 0; i < sizeof(crcTest_CheckData); i++)
+    {
+        crc8Maxim = crc_crc8MaximCalculatePartialBits(crcTest_CheckData[i], 3, crc8Maxim, false);
+        crc8Maxim = crc_crc8MaximCalculatePartialBits((uint8_t)(crcTest_CheckData[i] >> 3), 5, crc8Maxim, (i == (sizeof(crcTest_CheckData) - 1)));
+    }
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_MAXIM_CHECK, crc8Maxim);
+    
+    /*** Calculate Over Non-Whole Byte Length; Verify Result Matches Partial Calculation ***/
+    crc8Maxim = CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM;
+    for(i = 0; i < 100; i++)
+        crc8Maxim = crc_crc8MaximCalculatePartial(crcTest_Data[i], crc8Maxim, false);
+    crc8Maxim = crc_crc8MaximCalculatePartialBits(crcTest_Data[100], 5, crc8Maxim, true);
+    TEST_ASSERT_EQUAL_HEX8(crc8Maxim, crc_crc8MaximCalculateBits(crcTest_Data, 0, (100 * 8) + 5));
+}
+
+TEST(crc_test, crc8MaximVerify)
+{
+    uint8_t frame[sizeof(crcTest_CheckData) + 1];
+    uint16_t i;
+    
+    /*** Set Up Check Data Followed By CRC-8/MAXIM ***/
+    for(i = 0; i < sizeof(crcTest_CheckData); i++)
+        frame[i] = crcTest_CheckData[i];
+    frame[sizeof(crcTest_CheckData)] = CRC_TEST_CRC8_MAXIM_CHECK;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8MaximVerify(NULL, sizeof(frame)));
+    
+    /* Data Shorter Than CRC-8/MAXIM */
+    TEST_ASSERT_FALSE(crc_crc8MaximVerify(frame, 0));
+    
+    /*** Verify Valid Frame ***/
+    TEST_ASSERT_TRUE(crc_crc8MaximVerify(frame, sizeof(frame)));
+    
+    /*** Verify Single Bit Errors Are Detected ***/
+    for(i = 0; i < (sizeof(frame) * 8); i++)
+    {
+        frame[i >> 3] ^= (uint8_t)(1U << (i & 0x07));
+        TEST_ASSERT_FALSE(crc_crc8MaximVerify(frame, sizeof(frame)));
+        frame[i >> 3] ^= (uint8_t)(1U << (i & 0x07));
+    }
+}
+
+TEST(crc_test, crc8MaximForge)
+{
+    uint8_t crc8Maxim;
+    uint16_t offset;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8MaximForge(NULL, sizeof(crcTest_Data), 0, 0x00, 0x5A));
+    
+    /* Patch Beyond End Of Data */
+    TEST_ASSERT_FALSE(crc_crc8MaximForge(crcTest_Data, sizeof(crcTest_Data), sizeof(crcTest_Data) - 0, 0x00, 0x5A));
+    TEST_ASSERT_FALSE(crc_crc8MaximForge(crcTest_Data, 0, 0, 0x00, 0x5A));
+    
+    /*** Forge Target At Various Offsets (Each Target Is Current CRC-8/MAXIM Of Next Forge) ***/
+    crc8Maxim = crc_crc8MaximCalculate(crcTest_Data, sizeof(crcTest_Data));
+    for(offset = 0; offset <= (sizeof(crcTest_Data) - 1); offset += 111)
+    {
+        TEST_ASSERT_TRUE(crc_crc8MaximForge(crcTest_Data, sizeof(crcTest_Data), offset, crc8Maxim, (uint8_t)(0x5A + offset)));
+        TEST_ASSERT_EQUAL_HEX8((uint8_t)(0x5A + offset), crc_crc8MaximCalculate(crcTest_Data, sizeof(crcTest_Data)));
+        crc8Maxim = (uint8_t)(0x5A + offset);
+    }
+    
+    /*** Forge Target At End Of Data ***/
+    TEST_ASSERT_TRUE(crc_crc8MaximForge(crcTest_Data, sizeof(crcTest_Data), sizeof(crcTest_Data) - 1, crc8Maxim, 0x5A));
+    TEST_ASSERT_EQUAL_HEX8(0x5A, crc_crc8MaximCalculate(crcTest_Data, sizeof(crcTest_Data)));
+    
+    /*** Forge Check Value Over Check Data ***/
+    TEST_ASSERT_TRUE(crc_crc8MaximForge(crcTest_Data, sizeof(crcTest_CheckData), 3, crc_crc8MaximCalculate(crcTest_Data, sizeof(crcTest_CheckData)), CRC_TEST_CRC8_MAXIM_CHECK));
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_MAXIM_CHECK, crc_crc8MaximCalculate(crcTest_Data, sizeof(crcTest_CheckData)));
+}
+
+TEST(crc_test, crc8RohcCalculate)
+{
+    uint8_t crc8Rohc;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    crc8Rohc = crc_crc8RohcCalculate(NULL, sizeof(crcTest_CheckData));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_ROHC_INITIAL_CRC8_ROHC, crc8Rohc);
+    
+    /* Zero Length Data */
+    crc8Rohc = crc_crc8RohcCalculate(crcTest_CheckData, 0);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_ROHC_INITIAL_CRC8_ROHC, crc8Rohc);
+    
+    /*** Calculate CRC-8/ROHC For Check Data; Verify Result As Expected ***/
+    crc8Rohc = crc_crc8RohcCalculate(crcTest_CheckData, sizeof(crcTest_CheckData));
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_ROHC_CHECK, crc8Rohc);
+}
+
+TEST(crc_test, crc8RohcCalculatePartial)
+{
+    uint8_t crc8Rohc, i;
+    
+    /*** Set Up ***/
+    crc8Rohc = CRC_CRC8_ROHC_INITIAL_CRC8_ROHC;
+    
+    /*** Calculate CRC-8/ROHC For Check Data; Verify Result As Expected ***/
+    for(i = 0; i < (sizeof(crcTest_CheckData) - 1); i++)
+        crc8Rohc = crc_crc8RohcCalculatePartial(crcTest_CheckData[i], crc8Rohc, false);
+    crc8Rohc = crc_crc8RohcCalculatePartial(crcTest_CheckData[i], crc8Rohc, true);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_ROHC_CHECK, crc8Rohc);
+}
+
+TEST(crc_test, crc8RohcStep)
+{
+    uint8_t crc8Rohc, i;
+    
+    /*** Set Up ***/
+    crc8Rohc = CRC_CRC8_ROHC_INITIAL_CRC8_ROHC;
+    
+    /*** Calculate CRC-8/ROHC For Check Data With Inline Step; Verify Result As Expected ***/
+    for(i = 0; i < (sizeof(crcTest_CheckData) - 1); i++)
+        crc8Rohc = crc_crc8RohcStep(crcTest_CheckData[i], crc8Rohc);
+    crc8Rohc = crc_crc8RohcCalculatePartial(crcTest_CheckData[i], crc8Rohc, true);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_ROHC_CHECK, crc8Rohc);
+}
+
+TEST(crc_test, crc8RohcModify)
+{
+    uint8_t crc8Rohc;
+    uint8_t i;
+    
+    /*** Set Up ***/
+    crc8Rohc = crc_crc8RohcCalculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8Rohc, crc_crc8RohcModify(crc8Rohc, NULL, sizeof(crcTest_Delta), 0));
+    
+    /* Zero Length Delta */
+    TEST_ASSERT_EQUAL_HEX8(crc8Rohc, crc_crc8RohcModify(crc8Rohc, crcTest_Delta, 0, 0));
+    
+    /*** Modify Data In Place; Verify Updated CRC-8/ROHC Matches Full Calculation ***/
+    for(i = 0; i < sizeof(crcTest_Delta); i++)
+        crcTest_Data[100 + i] ^= crcTest_Delta[i];
+    crc8Rohc = crc_crc8RohcModify(crc8Rohc, crcTest_Delta, sizeof(crcTest_Delta), sizeof(crcTest_Data) - 100 - sizeof(crcTest_Delta));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8RohcCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8Rohc);
+    
+    /*** Modify Final Data; Verify Updated CRC-8/ROHC Matches Full Calculation ***/
+    crcTest_Data[sizeof(crcTest_Data) - 1] ^= crcTest_Delta[0];
+    crc8Rohc = crc_crc8RohcModify(crc8Rohc, crcTest_Delta, 1, 0);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8RohcCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8Rohc);
+}
+
+TEST(crc_test, crc8RohcModifyBatch)
+{
+    uint8_t crc8Rohc;
+    const crc_patch_t Patch[] = {{crcTest_Delta, 0, sizeof(crcTest_Delta), 0}, {crcTest_Delta, 500, 2, 0}, {crcTest_Delta, 999, 2, 0}};
+    uint8_t i;
+    
+    /*** Set Up ***/
+    crc8Rohc = crc_crc8RohcCalculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8Rohc, crc_crc8RohcModifyBatch(crc8Rohc, NULL, 1, sizeof(crcTest_Data)));
+    
+    /*** Modify Data In Place (Final Patch Out Of Range); Verify Updated CRC-8/ROHC Matches Full Calculation ***/
+    for(i = 0; i < sizeof(crcTest_Delta); i++)
+        crcTest_Data[i] ^= crcTest_Delta[i];
+    for(i = 0; i < 2; i++)
+        crcTest_Data[500 + i] ^= crcTest_Delta[i];
+    crc8Rohc = crc_crc8RohcModifyBatch(crc8Rohc, Patch, sizeof(Patch) / sizeof(Patch[0]), sizeof(crcTest_Data));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8RohcCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8Rohc);
+}
+
+TEST(crc_test, crc8RohcRollingInitialize)
+{
+    crc_rolling_t rolling;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8RohcRollingInitialize(NULL, 16));
+    
+    /* Zero Length Window */
+    TEST_ASSERT_FALSE(crc_crc8RohcRollingInitialize(&rolling, 0));
+    
+    /*** Initialize Rolling CRC-8/ROHC ***/
+    TEST_ASSERT_TRUE(crc_crc8RohcRollingInitialize(&rolling, 16));
+}
+
+TEST(crc_test, crc8RohcRollingUpdate)
+{
+    crc_rolling_t rolling;
+    uint8_t crc8Rohc;
+    uint16_t i, windowLength;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(0x5A, crc_crc8RohcRollingUpdate(NULL, 0x00, 0x00, 0x5A));
+    
+    /*** Slide Window Across Data; Verify Each Window Matches Full Calculation ***/
+    for(windowLength = 1; windowLength <= 64; windowLength += 21)
+    {
+        TEST_ASSERT_TRUE(crc_crc8RohcRollingInitialize(&rolling, windowLength));
+        crc8Rohc = crc_crc8RohcCalculate(crcTest_Data, windowLength);
+        for(i = windowLength; i < sizeof(crcTest_Data); i++)
+        {
+            crc8Rohc = crc_crc8RohcRollingUpdate(&rolling, crcTest_Data[i - windowLength], crcTest_Data[i], crc8Rohc);
+            TEST_ASSERT_EQUAL_HEX8(crc_crc8RohcCalculate(&crcTest_Data[i - windowLength + 1], windowLength), crc8Rohc);
+        }
+    }
+}
+
+TEST(crc_test, crc8RohcStripPrefix)
+{
+    uint8_t crc8Rohc;
+    
+    /*** Set Up ***/
+    crc8Rohc = crc_crc8RohcCalculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8Rohc, crc_crc8RohcStripPrefix(crc8Rohc, NULL, 37, sizeof(crcTest_Data) - 37));
+    
+    /* Zero Length Prefix */
+    TEST_ASSERT_EQUAL_HEX8(crc8Rohc, crc_crc8RohcStripPrefix(crc8Rohc, crcTest_Data, 0, sizeof(crcTest_Data)));
+    
+    /* Zero Length Suffix */
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_ROHC_INITIAL_CRC8_ROHC, crc_crc8RohcStripPrefix(crc8Rohc, crcTest_Data, sizeof(crcTest_Data), 0));
+    
+    /*** Strip Prefix; Verify Result Matches Full Calculation Of Suffix ***/
+    crc8Rohc = crc_crc8RohcStripPrefix(crc8Rohc, crcTest_Data, 37, sizeof(crcTest_Data) - 37);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8RohcCalculate(&crcTest_Data[37], sizeof(crcTest_Data) - 37), crc8Rohc);
+}
+
+TEST(crc_test, crc8RohcUnwind)
+{
+    uint8_t crc8Rohc;
+    
+    /*** Set Up ***/
+    crc8Rohc = crc_crc8RohcCalculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8Rohc, crc_crc8RohcUnwind(crc8Rohc, NULL, 29));
+    
+    /* Zero Length Data */
+    TEST_ASSERT_EQUAL_HEX8(crc8Rohc, crc_crc8RohcUnwind(crc8Rohc, crcTest_Data, 0));
+    
+    /*** Unwind Trailing Data; Verify Result Matches Full Calculation Without Trailing Data ***/
+    crc8Rohc = crc_crc8RohcUnwind(crc8Rohc, &crcTest_Data[sizeof(crcTest_Data) - 29], 29);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8RohcCalculate(crcTest_Data, sizeof(crcTest_Data) - 29), crc8Rohc);
+}
+
+TEST(crc_test, crc8RohcPrefix)
+{
+    crc_prefix_t prefix;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8RohcPrefixInitialize(NULL, crcTest_Data, 32));
+    TEST_ASSERT_FALSE(crc_crc8RohcPrefixInitialize(&prefix, NULL, 32));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_ROHC_INITIAL_CRC8_ROHC, crc_crc8RohcPrefixCalculate(NULL, crcTest_Data, 100));
+    
+    /*** Precompute Prefix; Verify Resumed Result Matches Full Calculation ***/
+    TEST_ASSERT_TRUE(crc_crc8RohcPrefixInitialize(&prefix, crcTest_Data, 32));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8RohcCalculate(crcTest_Data, 132), crc_crc8RohcPrefixCalculate(&prefix, &crcTest_Data[32], 100));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8RohcCalculate(crcTest_Data, 33), crc_crc8RohcPrefixCalculate(&prefix, &crcTest_Data[32], 1));
+    
+    /* No Data After Prefix */
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8RohcCalculate(crcTest_Data, 32), crc_crc8RohcPrefixCalculate(&prefix, &crcTest_Data[32], 0));
+    
+    /* Empty Prefix */
+    TEST_ASSERT_TRUE(crc_crc8RohcPrefixInitialize(&prefix, NULL, 0));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8RohcCalculate(crcTest_Data, 100), crc_crc8RohcPrefixCalculate(&prefix, crcTest_Data, 100));
+}
+
+TEST(crc_test, crc8RohcCalculateMasked)
+{
+    uint8_t crc8Rohc;
+    const crc_mask_t Mask[] = {{10, 4}, {100, 50}, {120, 40}, {990, 20}};
+    uint8_t m;
+    uint16_t i;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    crc8Rohc = crc_crc8RohcCalculateMasked(NULL, sizeof(crcTest_Data), Mask, sizeof(Mask) / sizeof(Mask[0]));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_ROHC_INITIAL_CRC8_ROHC, crc8Rohc);
+    crc8Rohc = crc_crc8RohcCalculateMasked(crcTest_Data, sizeof(crcTest_Data), NULL, 1);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_ROHC_INITIAL_CRC8_ROHC, crc8Rohc);
+    
+    /* Zero Length Data */
+    crc8Rohc = crc_crc8RohcCalculateMasked(crcTest_Data, 0, Mask, sizeof(Mask) / sizeof(Mask[0]));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_ROHC_INITIAL_CRC8_ROHC, crc8Rohc);
+    
+    /*** Calculate Without Masks; Verify Result Matches Full Calculation ***/
+    crc8Rohc = crc_crc8RohcCalculateMasked(crcTest_Data, sizeof(crcTest_Data), NULL, 0);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8RohcCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8Rohc);
+    
+    /*** Calculate With Masks; Verify Result Matches Full Calculation Of Zeroed Data ***/
+    crc8Rohc = crc_crc8RohcCalculateMasked(crcTest_Data, sizeof(crcTest_Data), Mask, sizeof(Mask) / sizeof(Mask[0]));
+    for(m = 0; m < (sizeof(Mask) / sizeof(Mask[0])); m++)
+    {
+        for(i = Mask[m].offset; (i < (Mask[m].offset + Mask[m].length)) && (i < sizeof(crcTest_Data)); i++)
+            crcTest_Data[i] = 0x00;
+    }
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8RohcCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8Rohc);
+}
+
+TEST(crc_test, crc8RohcCalculateBits)
+{
+    uint8_t crc8Rohc;
+    uint8_t shifted[sizeof(crcTest_CheckData) + 1];
+    uint16_t i;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    crc8Rohc = crc_crc8RohcCalculateBits(NULL, 0, sizeof(crcTest_CheckData) * 8);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_ROHC_INITIAL_CRC8_ROHC, crc8Rohc);
+    
+    /* Zero Length Data */
+    crc8Rohc = crc_crc8RohcCalculateBits(crcTest_CheckData, 0, 0);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_ROHC_INITIAL_CRC8_ROHC, crc8Rohc);
+    crc8Rohc = crc_crc8RohcCalculatePartialBits(0xFF, 0, CRC_CRC8_ROHC_INITIAL_CRC8_ROHC, false);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_ROHC_INITIAL_CRC8_ROHC, crc8Rohc);
+    
+    /* Bit Range Beyond Address Space */
+    crc8Rohc = crc_crc8RohcCalculateBits(crcTest_CheckData, 0xFFFFFFF8UL, 16);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_ROHC_INITIAL_CRC8_ROHC, crc8Rohc);
+    
+    /*** Calculate Over Whole Bytes; Verify Result Matches Byte-Wise Calculation ***/
+    crc8Rohc = crc_crc8RohcCalculateBits(crcTest_Data, 0, sizeof(crcTest_Data) * 8);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8RohcCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8Rohc);
+    
+    /*** Calculate Over Check Data Shifted By 3 Bits (Least Significant Bit First) ***/
+    shifted[0] = (uint8_t)(crcTest_CheckData[0] << 3);
+    for(i = 1; i < sizeof(crcTest_CheckData); i++)
+        shifted[i] = (uint8_t)((crcTest_CheckData[i] << 3) | (crcTest_CheckData[i - 1] >> 5));
+    shifted[sizeof(crcTest_CheckData)] = (uint8_t)(crcTest_CheckData[sizeof(crcTest_CheckData) - 1] >> 5);
+    crc8Rohc = crc_crc8RohcCalculateBits(shifted, 3, sizeof(crcTest_CheckData) * 8);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_ROHC_CHECK, crc8Rohc);
+    
+    /*** Calculate Check Data In 3 And 5 Bit Pieces ***/
+    crc8Rohc = CRC_CRC8_ROHC_INITIAL_CRC8_ROHC;
+    for(i = 0; i < sizeof(crcTest_CheckData); i++)
+    {
+        crc8Rohc = crc_crc8RohcCalculatePartialBits(crcTest_CheckData[i], 3, crc8Rohc, false);
+        crc8Rohc = crc_crc8RohcCalculatePartialBits((uint8_t)(crcTest_CheckData[i] >> 3), 5, crc8Rohc, (i == (sizeof(crcTest_CheckData) - 1)));
+    }
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_ROHC_CHECK, crc8Rohc);
+    
+    /*** Calculate Over Non-Whole Byte Length; Verify Result Matches Partial Calculation ***/
+    crc8Rohc = CRC_CRC8_ROHC_INITIAL_CRC8_ROHC;
+    for(i = 0; i < 100; i++)
+        crc8Rohc = crc_crc8RohcCalculatePartial(crcTest_Data[i], crc8Rohc, false);
+    crc8Rohc = crc_crc8RohcCalculatePartialBits(crcTest_Data[100], 5, crc8Rohc, true);
+    TEST_ASSERT_EQUAL_HEX8(crc8Rohc, crc_crc8RohcCalculateBits(crcTest_Data, 0, (100 * 8) + 5));
+}
+
+TEST(crc_test, crc8RohcVerify)
+{
+    uint8_t frame[sizeof(crcTest_CheckData) + 1];
+    uint16_t i;
+    
+    /*** Set Up Check Data Followed By CRC-8/ROHC ***/
+    for(i = 0; i < sizeof(crcTest_CheckData); i++)
+        frame[i] = crcTest_CheckData[i];
+    frame[sizeof(crcTest_CheckData)] = CRC_TEST_CRC8_ROHC_CHECK;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8RohcVerify(NULL, sizeof(frame)));
+    
+    /* Data Shorter Than CRC-8/ROHC */
+    TEST_ASSERT_FALSE(crc_crc8RohcVerify(frame, 0));
+    
+    /*** Verify Valid Frame ***/
+    TEST_ASSERT_TRUE(crc_crc8RohcVerify(frame, sizeof(frame)));
+    
+    /*** Verify Single Bit Errors Are Detected ***/
+    for(i = 0; i < (sizeof(frame) * 8); i++)
+    {
+        frame[i >> 3] ^= (uint8_t)(1U << (i & 0x07));
+        TEST_ASSERT_FALSE(crc_crc8RohcVerify(frame, sizeof(frame)));
+        frame[i >> 3] ^= (uint8_t)(1U << (i & 0x07));
+    }
+}
+
+TEST(crc_test, crc8RohcForge)
+{
+    uint8_t crc8Rohc;
+    uint16_t offset;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8RohcForge(NULL, sizeof(crcTest_Data), 0, 0x00, 0x5A));
+    
+    /* Patch Beyond End Of Data */
+    TEST_ASSERT_FALSE(crc_crc8RohcForge(crcTest_Data, sizeof(crcTest_Data), sizeof(crcTest_Data) - 0, 0x00, 0x5A));
+    TEST_ASSERT_FALSE(crc_crc8RohcForge(crcTest_Data, 0, 0, 0x00, 0x5A));
+    
+    /*** Forge Target At Various Offsets (Each Target Is Current CRC-8/ROHC Of Next Forge) ***/
+    crc8Rohc = crc_crc8RohcCalculate(crcTest_Data, sizeof(crcTest_Data));
+    for(offset = 0; offset <= (sizeof(crcTest_Data) - 1); offset += 111)
+    {
+        TEST_ASSERT_TRUE(crc_crc8RohcForge(crcTest_Data, sizeof(crcTest_Data), offset, crc8Rohc, (uint8_t)(0x5A + offset)));
+        TEST_ASSERT_EQUAL_HEX8((uint8_t)(0x5A + offset), crc_crc8RohcCalculate(crcTest_Data, sizeof(crcTest_Data)));
+        crc8Rohc = (uint8_t)(0x5A + offset);
+    }
+    
+    /*** Forge Target At End Of Data ***/
+    TEST_ASSERT_TRUE(crc_crc8RohcForge(crcTest_Data, sizeof(crcTest_Data), sizeof(crcTest_Data) - 1, crc8Rohc, 0x5A));
+    TEST_ASSERT_EQUAL_HEX8(0x5A, crc_crc8RohcCalculate(crcTest_Data, sizeof(crcTest_Data)));
+    
+    /*** Forge Check Value Over Check Data ***/
+    TEST_ASSERT_TRUE(crc_crc8RohcForge(crcTest_Data, sizeof(crcTest_CheckData), 3, crc_crc8RohcCalculate(crcTest_Data, sizeof(crcTest_CheckData)), CRC_TEST_CRC8_ROHC_CHECK));
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_ROHC_CHECK, crc_crc8RohcCalculate(crcTest_Data, sizeof(crcTest_CheckData)));
+}
+
+TEST(crc_test, crc8WcdmaCalculate)
+{
+    uint8_t crc8Wcdma;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    crc8Wcdma = crc_crc8WcdmaCalculate(NULL, sizeof(crcTest_CheckData));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA, crc8Wcdma);
+    
+    /* Zero Length Data */
+    crc8Wcdma = crc_crc8WcdmaCalculate(crcTest_CheckData, 0);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA, crc8Wcdma);
+    
+    /*** Calculate CRC-8/WCDMA For Check Data; Verify Result As Expected ***/
+    crc8Wcdma = crc_crc8WcdmaCalculate(crcTest_CheckData, sizeof(crcTest_CheckData));
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_WCDMA_CHECK, crc8Wcdma);
+}
+
+TEST(crc_test, crc8WcdmaCalculatePartial)
+{
+    uint8_t crc8Wcdma, i;
+    
+    /*** Set Up ***/
+    crc8Wcdma = CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA;
+    
+    /*** Calculate CRC-8/WCDMA For Check Data; Verify Result As Expected ***/
+    for(i = 0; i < (sizeof(crcTest_CheckData) - 1); i++)
+        crc8Wcdma = crc_crc8WcdmaCalculatePartial(crcTest_CheckData[i], crc8Wcdma, false);
+    crc8Wcdma = crc_crc8WcdmaCalculatePartial(crcTest_CheckData[i], crc8Wcdma, true);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_WCDMA_CHECK, crc8Wcdma);
+}
+
+TEST(crc_test, crc8WcdmaStep)
+{
+    uint8_t crc8Wcdma, i;
+    
+    /*** Set Up ***/
+    crc8Wcdma = CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA;
+    
+    /*** Calculate CRC-8/WCDMA For Check Data With Inline Step; Verify Result As Expected ***/
+    for(i = 0; i < (sizeof(crcTest_CheckData) - 1); i++)
+        crc8Wcdma = crc_crc8WcdmaStep(crcTest_CheckData[i], crc8Wcdma);
+    crc8Wcdma = crc_crc8WcdmaCalculatePartial(crcTest_CheckData[i], crc8Wcdma, true);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_WCDMA_CHECK, crc8Wcdma);
+}
+
+TEST(crc_test, crc8WcdmaModify)
+{
+    uint8_t crc8Wcdma;
+    uint8_t i;
+    
+    /*** Set Up ***/
+    crc8Wcdma = crc_crc8WcdmaCalculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8Wcdma, crc_crc8WcdmaModify(crc8Wcdma, NULL, sizeof(crcTest_Delta), 0));
+    
+    /* Zero Length Delta */
+    TEST_ASSERT_EQUAL_HEX8(crc8Wcdma, crc_crc8WcdmaModify(crc8Wcdma, crcTest_Delta, 0, 0));
+    
+    /*** Modify Data In Place; Verify Updated CRC-8/WCDMA Matches Full Calculation ***/
+    for(i = 0; i < sizeof(crcTest_Delta); i++)
+        crcTest_Data[100 + i] ^= crcTest_Delta[i];
+    crc8Wcdma = crc_crc8WcdmaModify(crc8Wcdma, crcTest_Delta, sizeof(crcTest_Delta), sizeof(crcTest_Data) - 100 - sizeof(crcTest_Delta));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8WcdmaCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8Wcdma);
+    
+    /*** Modify Final Data; Verify Updated CRC-8/WCDMA Matches Full Calculation ***/
+    crcTest_Data[sizeof(crcTest_Data) - 1] ^= crcTest_Delta[0];
+    crc8Wcdma = crc_crc8WcdmaModify(crc8Wcdma, crcTest_Delta, 1, 0);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8WcdmaCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8Wcdma);
+}
+
+TEST(crc_test, crc8WcdmaModifyBatch)
+{
+    uint8_t crc8Wcdma;
+    const crc_patch_t Patch[] = {{crcTest_Delta, 0, sizeof(crcTest_Delta), 0}, {crcTest_Delta, 500, 2, 0}, {crcTest_Delta, 999, 2, 0}};
+    uint8_t i;
+    
+    /*** Set Up ***/
+    crc8Wcdma = crc_crc8WcdmaCalculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8Wcdma, crc_crc8WcdmaModifyBatch(crc8Wcdma, NULL, 1, sizeof(crcTest_Data)));
+    
+    /*** Modify Data In Place (Final Patch Out Of Range); Verify Updated CRC-8/WCDMA Matches Full Calculation ***/
+    for(i = 0; i < sizeof(crcTest_Delta); i++)
+        crcTest_Data[i] ^= crcTest_Delta[i];
+    for(i = 0; i < 2; i++)
+        crcTest_Data[500 + i] ^= crcTest_Delta[i];
+    crc8Wcdma = crc_crc8WcdmaModifyBatch(crc8Wcdma, Patch, sizeof(Patch) / sizeof(Patch[0]), sizeof(crcTest_Data));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8WcdmaCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8Wcdma);
+}
+
+TEST(crc_test, crc8WcdmaRollingInitialize)
+{
+    crc_rolling_t rolling;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8WcdmaRollingInitialize(NULL, 16));
+    
+    /* Zero Length Window */
+    TEST_ASSERT_FALSE(crc_crc8WcdmaRollingInitialize(&rolling, 0));
+    
+    /*** Initialize Rolling CRC-8/WCDMA ***/
+    TEST_ASSERT_TRUE(crc_crc8WcdmaRollingInitialize(&rolling, 16));
+}
+
+TEST(crc_test, crc8WcdmaRollingUpdate)
+{
+    crc_rolling_t rolling;
+    uint8_t crc8Wcdma;
+    uint16_t i, windowLength;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(0x5A, crc_crc8WcdmaRollingUpdate(NULL, 0x00, 0x00, 0x5A));
+    
+    /*** Slide Window Across Data; Verify Each Window Matches Full Calculation ***/
+    for(windowLength = 1; windowLength <= 64; windowLength += 21)
+    {
+        TEST_ASSERT_TRUE(crc_crc8WcdmaRollingInitialize(&rolling, windowLength));
+        crc8Wcdma = crc_crc8WcdmaCalculate(crcTest_Data, windowLength);
+        for(i = windowLength; i < sizeof(crcTest_Data); i++)
+        {
+            crc8Wcdma = crc_crc8WcdmaRollingUpdate(&rolling, crcTest_Data[i - windowLength], crcTest_Data[i], crc8Wcdma);
+            TEST_ASSERT_EQUAL_HEX8(crc_crc8WcdmaCalculate(&crcTest_Data[i - windowLength + 1], windowLength), crc8Wcdma);
+        }
+    }
+}
+
+TEST(crc_test, crc8WcdmaStripPrefix)
+{
+    uint8_t crc8Wcdma;
+    
+    /*** Set Up ***/
+    crc8Wcdma = crc_crc8WcdmaCalculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8Wcdma, crc_crc8WcdmaStripPrefix(crc8Wcdma, NULL, 37, sizeof(crcTest_Data) - 37));
+    
+    /* Zero Length Prefix */
+    TEST_ASSERT_EQUAL_HEX8(crc8Wcdma, crc_crc8WcdmaStripPrefix(crc8Wcdma, crcTest_Data, 0, sizeof(crcTest_Data)));
+    
+    /* Zero Length Suffix */
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA, crc_crc8WcdmaStripPrefix(crc8Wcdma, crcTest_Data, sizeof(crcTest_Data), 0));
+    
+    /*** Strip Prefix; Verify Result Matches Full Calculation Of Suffix ***/
+    crc8Wcdma = crc_crc8WcdmaStripPrefix(crc8Wcdma, crcTest_Data, 37, sizeof(crcTest_Data) - 37);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8WcdmaCalculate(&crcTest_Data[37], sizeof(crcTest_Data) - 37), crc8Wcdma);
+}
+
+TEST(crc_test, crc8WcdmaUnwind)
+{
+    uint8_t crc8Wcdma;
+    
+    /*** Set Up ***/
+    crc8Wcdma = crc_crc8WcdmaCalculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX8(crc8Wcdma, crc_crc8WcdmaUnwind(crc8Wcdma, NULL, 29));
+    
+    /* Zero Length Data */
+    TEST_ASSERT_EQUAL_HEX8(crc8Wcdma, crc_crc8WcdmaUnwind(crc8Wcdma, crcTest_Data, 0));
+    
+    /*** Unwind Trailing Data; Verify Result Matches Full Calculation Without Trailing Data ***/
+    crc8Wcdma = crc_crc8WcdmaUnwind(crc8Wcdma, &crcTest_Data[sizeof(crcTest_Data) - 29], 29);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8WcdmaCalculate(crcTest_Data, sizeof(crcTest_Data) - 29), crc8Wcdma);
+}
+
+TEST(crc_test, crc8WcdmaPrefix)
+{
+    crc_prefix_t prefix;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8WcdmaPrefixInitialize(NULL, crcTest_Data, 32));
+    TEST_ASSERT_FALSE(crc_crc8WcdmaPrefixInitialize(&prefix, NULL, 32));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA, crc_crc8WcdmaPrefixCalculate(NULL, crcTest_Data, 100));
+    
+    /*** Precompute Prefix; Verify Resumed Result Matches Full Calculation ***/
+    TEST_ASSERT_TRUE(crc_crc8WcdmaPrefixInitialize(&prefix, crcTest_Data, 32));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8WcdmaCalculate(crcTest_Data, 132), crc_crc8WcdmaPrefixCalculate(&prefix, &crcTest_Data[32], 100));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8WcdmaCalculate(crcTest_Data, 33), crc_crc8WcdmaPrefixCalculate(&prefix, &crcTest_Data[32], 1));
+    
+    /* No Data After Prefix */
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8WcdmaCalculate(crcTest_Data, 32), crc_crc8WcdmaPrefixCalculate(&prefix, &crcTest_Data[32], 0));
+    
+    /* Empty Prefix */
+    TEST_ASSERT_TRUE(crc_crc8WcdmaPrefixInitialize(&prefix, NULL, 0));
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8WcdmaCalculate(crcTest_Data, 100), crc_crc8WcdmaPrefixCalculate(&prefix, crcTest_Data, 100));
+}
+
+TEST(crc_test, crc8WcdmaCalculateMasked)
+{
+    uint8_t crc8Wcdma;
+    const crc_mask_t Mask[] = {{10, 4}, {100, 50}, {120, 40}, {990, 20}};
+    uint8_t m;
+    uint16_t i;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    crc8Wcdma = crc_crc8WcdmaCalculateMasked(NULL, sizeof(crcTest_Data), Mask, sizeof(Mask) / sizeof(Mask[0]));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA, crc8Wcdma);
+    crc8Wcdma = crc_crc8WcdmaCalculateMasked(crcTest_Data, sizeof(crcTest_Data), NULL, 1);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA, crc8Wcdma);
+    
+    /* Zero Length Data */
+    crc8Wcdma = crc_crc8WcdmaCalculateMasked(crcTest_Data, 0, Mask, sizeof(Mask) / sizeof(Mask[0]));
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA, crc8Wcdma);
+    
+    /*** Calculate Without Masks; Verify Result Matches Full Calculation ***/
+    crc8Wcdma = crc_crc8WcdmaCalculateMasked(crcTest_Data, sizeof(crcTest_Data), NULL, 0);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8WcdmaCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8Wcdma);
+    
+    /*** Calculate With Masks; Verify Result Matches Full Calculation Of Zeroed Data ***/
+    crc8Wcdma = crc_crc8WcdmaCalculateMasked(crcTest_Data, sizeof(crcTest_Data), Mask, sizeof(Mask) / sizeof(Mask[0]));
+    for(m = 0; m < (sizeof(Mask) / sizeof(Mask[0])); m++)
+    {
+        for(i = Mask[m].offset; (i < (Mask[m].offset + Mask[m].length)) && (i < sizeof(crcTest_Data)); i++)
+            crcTest_Data[i] = 0x00;
+    }
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8WcdmaCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8Wcdma);
+}
+
+TEST(crc_test, crc8WcdmaCalculateBits)
+{
+    uint8_t crc8Wcdma;
+    uint8_t shifted[sizeof(crcTest_CheckData) + 1];
+    uint16_t i;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    crc8Wcdma = crc_crc8WcdmaCalculateBits(NULL, 0, sizeof(crcTest_CheckData) * 8);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA, crc8Wcdma);
+    
+    /* Zero Length Data */
+    crc8Wcdma = crc_crc8WcdmaCalculateBits(crcTest_CheckData, 0, 0);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA, crc8Wcdma);
+    crc8Wcdma = crc_crc8WcdmaCalculatePartialBits(0xFF, 0, CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA, false);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA, crc8Wcdma);
+    
+    /* Bit Range Beyond Address Space */
+    crc8Wcdma = crc_crc8WcdmaCalculateBits(crcTest_CheckData, 0xFFFFFFF8UL, 16);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA, crc8Wcdma);
+    
+    /*** Calculate Over Whole Bytes; Verify Result Matches Byte-Wise Calculation ***/
+    crc8Wcdma = crc_crc8WcdmaCalculateBits(crcTest_Data, 0, sizeof(crcTest_Data) * 8);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8WcdmaCalculate(crcTest_Data, sizeof(crcTest_Data)), crc8Wcdma);
+    
+    /*** Calculate Over Check Data Shifted By 3 Bits (Least Significant Bit First) ***/
+    shifted[0] = (uint8_t)(crcTest_CheckData[0] << 3);
+    for(i = 1; i < sizeof(crcTest_CheckData); i++)
+        shifted[i] = (uint8_t)((crcTest_CheckData[i] << 3) | (crcTest_CheckData[i - 1] >> 5));
+    shifted[sizeof(crcTest_CheckData)] = (uint8_t)(crcTest_CheckData[sizeof(crcTest_CheckData) - 1] >> 5);
+    crc8Wcdma = crc_crc8WcdmaCalculateBits(shifted, 3, sizeof(crcTest_CheckData) * 8);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_WCDMA_CHECK, crc8Wcdma);
+    
+    /*** Calculate Check Data In 3 And 5 Bit Pieces ***/
+    crc8Wcdma = CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA;
+    for(i = 0; i < sizeof(crcTest_CheckData); i++)
+    {
+        crc8Wcdma = crc_crc8WcdmaCalculatePartialBits(crcTest_CheckData[i], 3, crc8Wcdma, false);
+        crc8Wcdma = crc_crc8WcdmaCalculatePartialBits((uint8_t)(crcTest_CheckData[i] >> 3), 5, crc8Wcdma, (i == (sizeof(crcTest_CheckData) - 1)));
+    }
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_WCDMA_CHECK, crc8Wcdma);
+    
+    /*** Calculate Over Non-Whole Byte Length; Verify Result Matches Partial Calculation ***/
+    crc8Wcdma = CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA;
+    for(i = 0; i < 100; i++)
+        crc8Wcdma = crc_crc8WcdmaCalculatePartial(crcTest_Data[i], crc8Wcdma, false);
+    crc8Wcdma = crc_crc8WcdmaCalculatePartialBits(crcTest_Data[100], 5, crc8Wcdma, true);
+    TEST_ASSERT_EQUAL_HEX8(crc8Wcdma, crc_crc8WcdmaCalculateBits(crcTest_Data, 0, (100 * 8) + 5));
+}
+
+TEST(crc_test, crc8WcdmaVerify)
+{
+    uint8_t frame[sizeof(crcTest_CheckData) + 1];
+    uint16_t i;
+    
+    /*** Set Up Check Data Followed By CRC-8/WCDMA ***/
+    for(i = 0; i < sizeof(crcTest_CheckData); i++)
+        frame[i] = crcTest_CheckData[i];
+    frame[sizeof(crcTest_CheckData)] = CRC_TEST_CRC8_WCDMA_CHECK;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8WcdmaVerify(NULL, sizeof(frame)));
+    
+    /* Data Shorter Than CRC-8/WCDMA */
+    TEST_ASSERT_FALSE(crc_crc8WcdmaVerify(frame, 0));
+    
+    /*** Verify Valid Frame ***/
+    TEST_ASSERT_TRUE(crc_crc8WcdmaVerify(frame, sizeof(frame)));
+    
+    /*** Verify Single Bit Errors Are Detected ***/
+    for(i = 0; i < (sizeof(frame) * 8); i++)
+    {
+        frame[i >> 3] ^= (uint8_t)(1U << (i & 0x07));
+        TEST_ASSERT_FALSE(crc_crc8WcdmaVerify(frame, sizeof(frame)));
+        frame[i >> 3] ^= (uint8_t)(1U << (i & 0x07));
+    }
+}
+
+TEST(crc_test, crc8WcdmaForge)
+{
+    uint8_t crc8Wcdma;
+    uint16_t offset;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc8WcdmaForge(NULL, sizeof(crcTest_Data), 0, 0x00, 0x5A));
+    
+    /* Patch Beyond End Of Data */
+    TEST_ASSERT_FALSE(crc_crc8WcdmaForge(crcTest_Data, sizeof(crcTest_Data), sizeof(crcTest_Data) - 0, 0x00, 0x5A));
+    TEST_ASSERT_FALSE(crc_crc8WcdmaForge(crcTest_Data, 0, 0, 0x00, 0x5A));
+    
+    /*** Forge Target At Various Offsets (Each Target Is Current CRC-8/WCDMA Of Next Forge) ***/
+    crc8Wcdma = crc_crc8WcdmaCalculate(crcTest_Data, sizeof(crcTest_Data));
+    for(offset = 0; offset <= (sizeof(crcTest_Data) - 1); offset += 111)
+    {
+        TEST_ASSERT_TRUE(crc_crc8WcdmaForge(crcTest_Data, sizeof(crcTest_Data), offset, crc8Wcdma, (uint8_t)(0x5A + offset)));
+        TEST_ASSERT_EQUAL_HEX8((uint8_t)(0x5A + offset), crc_crc8WcdmaCalculate(crcTest_Data, sizeof(crcTest_Data)));
+        crc8Wcdma = (uint8_t)(0x5A + offset);
+    }
+    
+    /*** Forge Target At End Of Data ***/
+    TEST_ASSERT_TRUE(crc_crc8WcdmaForge(crcTest_Data, sizeof(crcTest_Data), sizeof(crcTest_Data) - 1, crc8Wcdma, 0x5A));
+    TEST_ASSERT_EQUAL_HEX8(0x5A, crc_crc8WcdmaCalculate(crcTest_Data, sizeof(crcTest_Data)));
+    
+    /*** Forge Check Value Over Check Data ***/
+    TEST_ASSERT_TRUE(crc_crc8WcdmaForge(crcTest_Data, sizeof(crcTest_CheckData), 3, crc_crc8WcdmaCalculate(crcTest_Data, sizeof(crcTest_CheckData)), CRC_TEST_CRC8_WCDMA_CHECK));
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_WCDMA_CHECK, crc_crc8WcdmaCalculate(crcTest_Data, sizeof(crcTest_CheckData)));
+}
+
+TEST(crc_test, crc16ArcCalculate)
+{
+    uint16_t crc16Arc;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    crc16Arc = crc_crc16ArcCalculate(NULL, sizeof(crcTest_CheckData));
+    TEST_ASSERT_EQUAL_HEX16(CRC_CRC16_ARC_INITIAL_CRC16_ARC, crc16Arc);
+    
+    /* Zero Length Data */
+    crc16Arc = crc_crc16ArcCalculate(crcTest_CheckData, 0);
+    TEST_ASSERT_EQUAL_HEX16(CRC_CRC16_ARC_INITIAL_CRC16_ARC, crc16Arc);
+    
+    /*** Calculate CRC-16/ARC For Check Data; Verify Result As Expected ***/
+    crc16Arc = crc_crc16ArcCalculate(crcTest_CheckData, sizeof(crcTest_CheckData));
+    TEST_ASSERT_EQUAL_HEX16(CRC_TEST_CRC16_ARC_CHECK, crc16Arc);
+}
+
+TEST(crc_test, crc16ArcCalculatePartial)
+{
+    uint8_t i;
+    uint16_t crc16Arc;
+    
+    /*** Set Up ***/
+    crc16Arc = CRC_CRC16_ARC_INITIAL_CRC16_ARC;
+    
+    /*** Calculate CRC-16/ARC For Check Data; Verify Result As Expected ***/
+    for(i = 0; i < (sizeof(crcTest_CheckData) - 1); i++)
+        crc16Arc = crc_crc16ArcCalculatePartial(crcTest_CheckData[i], crc16Arc, false);
+    crc16Arc = crc_crc16ArcCalculatePartial(crcTest_CheckData[i], crc16Arc, true);
+    TEST_ASSERT_EQUAL_HEX16(CRC_TEST_CRC16_ARC_CHECK, crc16Arc);
+}
+
+TEST(crc_test, crc16ArcStep)
+{
+    uint16_t crc16Arc;
+    uint8_t i;
+    
+    /*** Set Up ***/
+    crc16Arc = CRC_CRC16_ARC_INITIAL_CRC16_ARC;
+    
+    /*** Calculate CRC-16/ARC For Check Data With Inline Step; Verify Result As Expected ***/
+    for(i = 0; i < (sizeof(crcTest_CheckData) - 1); i++)
+        crc16Arc = crc_crc16ArcStep(crcTest_CheckData[i], crc16Arc);
+    crc16Arc = crc_crc16ArcCalculatePartial(crcTest_CheckData[i], crc16Arc, true);
+    TEST_ASSERT_EQUAL_HEX16(CRC_TEST_CRC16_ARC_CHECK, crc16Arc);
+}
+
+TEST(crc_test, crc16ArcModify)
+{
+    uint16_t crc16Arc;
+    uint8_t i;
+    
+    /*** Set Up ***/
+    crc16Arc = crc_crc16ArcCalculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX16(crc16Arc, crc_crc16ArcModify(crc16Arc, NULL, sizeof(crcTest_Delta), 0));
+    
+    /* Zero Length Delta */
+    TEST_ASSERT_EQUAL_HEX16(crc16Arc, crc_crc16ArcModify(crc16Arc, crcTest_Delta, 0, 0));
+    
+    /*** Modify Data In Place; Verify Updated CRC-16/ARC Matches Full Calculation ***/
+    for(i = 0; i < sizeof(crcTest_Delta); i++)
+        crcTest_Data[100 + i] ^= crcTest_Delta[i];
+    crc16Arc = crc_crc16ArcModify(crc16Arc, crcTest_Delta, sizeof(crcTest_Delta), sizeof(crcTest_Data) - 100 - sizeof(crcTest_Delta));
+    TEST_ASSERT_EQUAL_HEX16(crc_crc16ArcCalculate(crcTest_Data, sizeof(crcTest_Data)), crc16Arc);
+    
+    /*** Modify Final Data; Verify Updated CRC-16/ARC Matches Full Calculation ***/
+    crcTest_Data[sizeof(crcTest_Data) - 1] ^= crcTest_Delta[0];
+    crc16Arc = crc_crc16ArcModify(crc16Arc, crcTest_Delta, 1, 0);
+    TEST_ASSERT_EQUAL_HEX16(crc_crc16ArcCalculate(crcTest_Data, sizeof(crcTest_Data)), crc16Arc);
+}
+
+TEST(crc_test, crc16ArcModifyBatch)
+{
+    uint16_t crc16Arc;
+    const crc_patch_t Patch[] = {{crcTest_Delta, 0, sizeof(crcTest_Delta), 0}, {crcTest_Delta, 500, 2, 0}, {crcTest_Delta, 999, 2, 0}};
+    uint8_t i;
+    
+    /*** Set Up ***/
+    crc16Arc = crc_crc16ArcCalculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX16(crc16Arc, crc_crc16ArcModifyBatch(crc16Arc, NULL, 1, sizeof(crcTest_Data)));
+    
+    /*** Modify Data In Place (Final Patch Out Of Range); Verify Updated CRC-16/ARC Matches Full Calculation ***/
+    for(i = 0; i < sizeof(crcTest_Delta); i++)
+        crcTest_Data[i] ^= crcTest_Delta[i];
+    for(i = 0; i < 2; i++)
+        crcTest_Data[500 + i] ^= crcTest_Delta[i];
+    crc16Arc = crc_crc16ArcModifyBatch(crc16Arc, Patch, sizeof(Patch) / sizeof(Patch[0]), sizeof(crcTest_Data));
+    TEST_ASSERT_EQUAL_HEX16(crc_crc16ArcCalculate(crcTest_Data, sizeof(crcTest_Data)), crc16Arc);
+}
+
+TEST(crc_test, crc16ArcRollingInitialize)
+{
+    crc_rolling_t rolling;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc16ArcRollingInitialize(NULL, 16));
+    
+    /* Zero Length Window */
+    TEST_ASSERT_FALSE(crc_crc16ArcRollingInitialize(&rolling, 0));
+    
+    /*** Initialize Rolling CRC-16/ARC ***/
+    TEST_ASSERT_TRUE(crc_crc16ArcRollingInitialize(&rolling, 16));
+}
+
+TEST(crc_test, crc16ArcRollingUpdate)
+{
+    crc_rolling_t rolling;
+    uint16_t crc16Arc;
+    uint16_t i, windowLength;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX16(0x5A, crc_crc16ArcRollingUpdate(NULL, 0x00, 0x00, 0x5A));
+    
+    /*** Slide Window Across Data; Verify Each Window Matches Full Calculation ***/
+    for(windowLength = 1; windowLength <= 64; windowLength += 21)
+    {
+        TEST_ASSERT_TRUE(crc_crc16ArcRollingInitialize(&rolling, windowLength));
+        crc16Arc = crc_crc16ArcCalculate(crcTest_Data, windowLength);
+        for(i = windowLength; i < sizeof(crcTest_Data); i++)
+        {
+            crc16Arc = crc_crc16ArcRollingUpdate(&rolling, crcTest_Data[i - windowLength], crcTest_Data[i], crc16Arc);
+            TEST_ASSERT_EQUAL_HEX16(crc_crc16ArcCalculate(&crcTest_Data[i - windowLength + 1], windowLength), crc16Arc);
+        }
+    }
+}
+
+TEST(crc_test, crc16ArcStripPrefix)
+{
+    uint16_t crc16Arc;
+    
+    /*** Set Up ***/
+    crc16Arc = crc_crc16ArcCalculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX16(crc16Arc, crc_crc16ArcStripPrefix(crc16Arc, NULL, 37, sizeof(crcTest_Data) - 37));
+    
+    /* Zero Length Prefix */
+    TEST_ASSERT_EQUAL_HEX16(crc16Arc, crc_crc16ArcStripPrefix(crc16Arc, crcTest_Data, 0, sizeof(crcTest_Data)));
+    
+    /* Zero Length Suffix */
+    TEST_ASSERT_EQUAL_HEX16(CRC_CRC16_ARC_INITIAL_CRC16_ARC, crc_crc16ArcStripPrefix(crc16Arc, crcTest_Data, sizeof(crcTest_Data), 0));
+    
+    /*** Strip Prefix; Verify Result Matches Full Calculation Of Suffix ***/
+    crc16Arc = crc_crc16ArcStripPrefix(crc16Arc, crcTest_Data, 37, sizeof(crcTest_Data) - 37);
+    TEST_ASSERT_EQUAL_HEX16(crc_crc16ArcCalculate(&crcTest_Data[37], sizeof(crcTest_Data) - 37), crc16Arc);
+}
+
+TEST(crc_test, crc16ArcUnwind)
+{
+    uint16_t crc16Arc;
+    
+    /*** Set Up ***/
+    crc16Arc = crc_crc16ArcCalculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX16(crc16Arc, crc_crc16ArcUnwind(crc16Arc, NULL, 29));
+    
+    /* Zero Length Data */
+    TEST_ASSERT_EQUAL_HEX16(crc16Arc, crc_crc16ArcUnwind(crc16Arc, crcTest_Data, 0));
+    
+    /*** Unwind Trailing Data; Verify Result Matches Full Calculation Without Trailing Data ***/
+    crc16Arc = crc_crc16ArcUnwind(crc16Arc, &crcTest_Data[sizeof(crcTest_Data) - 29], 29);
+    TEST_ASSERT_EQUAL_HEX16(crc_crc16ArcCalculate(crcTest_Data, sizeof(crcTest_Data) - 29), crc16Arc);
+}
+
+TEST(crc_test, crc16ArcPrefix)
+{
+    crc_prefix_t prefix;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc16ArcPrefixInitialize(NULL, crcTest_Data, 32));
+    TEST_ASSERT_FALSE(crc_crc16ArcPrefixInitialize(&prefix, NULL, 32));
+    TEST_ASSERT_EQUAL_HEX16(CRC_CRC16_ARC_INITIAL_CRC16_ARC, crc_crc16ArcPrefixCalculate(NULL, crcTest_Data, 100));
+    
+    /*** Precompute Prefix; Verify Resumed Result Matches Full Calculation ***/
+    TEST_ASSERT_TRUE(crc_crc16ArcPrefixInitialize(&prefix, crcTest_Data, 32));
+    TEST_ASSERT_EQUAL_HEX16(crc_crc16ArcCalculate(crcTest_Data, 132), crc_crc16ArcPrefixCalculate(&prefix, &crcTest_Data[32], 100));
+    TEST_ASSERT_EQUAL_HEX16(crc_crc16ArcCalculate(crcTest_Data, 33), crc_crc16ArcPrefixCalculate(&prefix, &crcTest_Data[32], 1));
+    
+    /* No Data After Prefix */
+    TEST_ASSERT_EQUAL_HEX16(crc_crc16ArcCalculate(crcTest_Data, 32), crc_crc16ArcPrefixCalculate(&prefix, &crcTest_Data[32], 0));
+    
+    /* Empty Prefix */
+    TEST_ASSERT_TRUE(crc_crc16ArcPrefixInitialize(&prefix, NULL, 0));
+    TEST_ASSERT_EQUAL_HEX16(crc_crc16ArcCalculate(crcTest_Data, 100), crc_crc16ArcPrefixCalculate(&prefix, crcTest_Data, 100));
+}
+
+TEST(crc_test, crc16ArcCalculateMasked)
+{
+    uint16_t crc16Arc;
+    const crc_mask_t Mask[] = {{10, 4}, {100, 50}, {120, 40}, {990, 20}};
+    uint8_t m;
+    uint16_t i;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    crc16Arc = crc_crc16ArcCalculateMasked(NULL, sizeof(crcTest_Data), Mask, sizeof(Mask) / sizeof(Mask[0]));
+    TEST_ASSERT_EQUAL_HEX16(CRC_CRC16_ARC_INITIAL_CRC16_ARC, crc16Arc);
+    crc16Arc = crc_crc16ArcCalculateMasked(crcTest_Data, sizeof(crcTest_Data), NULL, 1);
+    TEST_ASSERT_EQUAL_HEX16(CRC_CRC16_ARC_INITIAL_CRC16_ARC, crc16Arc);
+    
+    /* Zero Length Data */
+    crc16Arc = crc_crc16ArcCalculateMasked(crcTest_Data, 0, Mask, sizeof(Mask) / sizeof(Mask[0]));
+    TEST_ASSERT_EQUAL_HEX16(CRC_CRC16_ARC_INITIAL_CRC16_ARC, crc16Arc);
+    
+    /*** Calculate Without Masks; Verify Result Matches Full Calculation ***/
+    crc16Arc = crc_crc16ArcCalculateMasked(crcTest_Data, sizeof(crcTest_Data), NULL, 0);
+    TEST_ASSERT_EQUAL_HEX16(crc_crc16ArcCalculate(crcTest_Data, sizeof(crcTest_Data)), crc16Arc);
+    
+    /*** Calculate With Masks; Verify Result Matches Full Calculation Of Zeroed Data ***/
+    crc16Arc = crc_crc16ArcCalculateMasked(crcTest_Data, sizeof(crcTest_Data), Mask, sizeof(Mask) / sizeof(Mask[0]));
+    for(m = 0; m < (sizeof(Mask) / sizeof(Mask[0])); m++)
+    {
+        for(i = Mask[m].offset; (i < (Mask[m].offset + Mask[m].length)) && (i < sizeof(crcTest_Data)); i++)
+            crcTest_Data[i] = 0x00;
+    }
+    TEST_ASSERT_EQUAL_HEX16(crc_crc16ArcCalculate(crcTest_Data, sizeof(crcTest_Data)), crc16Arc);
+}
+
+TEST(crc_test, crc16ArcCalculateBits)
+{
+    uint16_t crc16Arc;
+    uint8_t shifted[sizeof(crcTest_CheckData) + 1];
+    uint16_t i;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    crc16Arc = crc_crc16ArcCalculateBits(NULL, 0, sizeof(crcTest_CheckData) * 8);
+    TEST_ASSERT_EQUAL_HEX16(CRC_CRC16_ARC_INITIAL_CRC16_ARC, crc16Arc);
+    
+    /* Zero Length Data */
+    crc16Arc = crc_crc16ArcCalculateBits(crcTest_CheckData, 0, 0);
+    TEST_ASSERT_EQUAL_HEX16(CRC_CRC16_ARC_INITIAL_CRC16_ARC, crc16Arc);
+    crc16Arc = crc_crc16ArcCalculatePartialBits(0xFF, 0, CRC_CRC16_ARC_INITIAL_CRC16_ARC, false);
+    TEST_ASSERT_EQUAL_HEX16(CRC_CRC16_ARC_INITIAL_CRC16_ARC, crc16Arc);
+    
+    /* Bit Range Beyond Address Space */
+    crc16Arc = crc_crc16ArcCalculateBits(crcTest_CheckData, 0xFFFFFFF8UL, 16);
+    TEST_ASSERT_EQUAL_HEX16(CRC_CRC16_ARC_INITIAL_CRC16_ARC, crc16Arc);
+    
+    /*** Calculate Over Whole Bytes; Verify Result Matches Byte-Wise Calculation ***/
+    crc16Arc = crc_crc16ArcCalculateBits(crcTest_Data, 0, sizeof(crcTest_Data) * 8);
+    TEST_ASSERT_EQUAL_HEX16(crc_crc16ArcCalculate(crcTest_Data, sizeof(crcTest_Data)), crc16Arc);
+    
+    /*** Calculate Over Check Data Shifted By 3 Bits (Least Significant Bit First) ***/
+    shifted[0] = (uint8_t)(crcTest_CheckData[0] << 3);
+    for(i = 1; i < sizeof(crcTest_CheckData); i++)
+        shifted[i] = (uint8_t)((crcTest_CheckData[i] << 3) | (crcTest_CheckData[i - 1] >> 5));
+    shifted[sizeof(crcTest_CheckData)] = (uint8_t)(crcTest_CheckData[sizeof(crcTest_CheckData) - 1] >> 5);
+    crc16Arc = crc_crc16ArcCalculateBits(shifted, 3, sizeof(crcTest_CheckData) * 8);
+    TEST_ASSERT_EQUAL_HEX16(CRC_TEST_CRC16_ARC_CHECK, crc16Arc);
+    
+    /*** Calculate Check Data In 3 And 5 Bit Pieces ***/
+    crc16Arc = CRC_CRC16_ARC_INITIAL_CRC16_ARC;
+    for(i = 0; i < sizeof(crcTest_CheckData); i++)
+    {
+        crc16Arc = crc_crc16ArcCalculatePartialBits(crcTest_CheckData[i], 3, crc16Arc, false);
+        crc16Arc = crc_crc16ArcCalculatePartialBits((uint8_t)(crcTest_CheckData[i] >> 3), 5, crc16Arc, (i == (sizeof(crcTest_CheckData) - 1)));
+    }
+    TEST_ASSERT_EQUAL_HEX16(CRC_TEST_CRC16_ARC_CHECK, crc16Arc);
+    
+    /*** Calculate Over Non-Whole Byte Length; Verify Result Matches Partial Calculation ***/
+    crc16Arc = CRC_CRC16_ARC_INITIAL_CRC16_ARC;
+    for(i = 0; i < 100; i++)
+        crc16Arc = crc_crc16ArcCalculatePartial(crcTest_Data[i], crc16Arc, false);
+    crc16Arc = crc_crc16ArcCalculatePartialBits(crcTest_Data[100], 5, crc16Arc, true);
+    TEST_ASSERT_EQUAL_HEX16(crc16Arc, crc_crc16ArcCalculateBits(crcTest_Data, 0, (100 * 8) + 5));
+}
+
+TEST(crc_test, crc16ArcVerify)
+{
+    uint8_t frame[sizeof(crcTest_CheckData) + 2];
+    uint16_t i;
+    
+    /*** Set Up Check Data Followed By CRC-16/ARC ***/
+    for(i = 0; i < sizeof(crcTest_CheckData); i++)
+        frame[i] = crcTest_CheckData[i];
+    frame[sizeof(crcTest_CheckData)] = (uint8_t)(CRC_TEST_CRC16_ARC_CHECK & 0xFF);
+    frame[sizeof(crcTest_CheckData) + 1] = (uint8_t)(CRC_TEST_CRC16_ARC_CHECK >> 8);
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc16ArcVerify(NULL, sizeof(frame)));
+    
+    /* Data Shorter Than CRC-16/ARC */
+    TEST_ASSERT_FALSE(crc_crc16ArcVerify(frame, 1));
+    
+    /*** Verify Valid Frame ***/
+    TEST_ASSERT_TRUE(crc_crc16ArcVerify(frame, sizeof(frame)));
+    
+    /*** Verify Single Bit Errors Are Detected ***/
+    for(i = 0; i < (sizeof(frame) * 8); i++)
+    {
+        frame[i >> 3] ^= (uint8_t)(1U << (i & 0x07));
+        TEST_ASSERT_FALSE(crc_crc16ArcVerify(frame, sizeof(frame)));
+        frame[i >> 3] ^= (uint8_t)(1U << (i & 0x07));
+    }
+}
+
+TEST(crc_test, crc16ArcForge)
 {
     uint16_t crc16Arc;
+    uint16_t offset;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc16ArcForge(NULL, sizeof(crcTest_Data), 0, 0x0000, 0x5AA5));
+    
+    /* Patch Beyond End Of Data */
+    TEST_ASSERT_FALSE(crc_crc16ArcForge(crcTest_Data, sizeof(crcTest_Data), sizeof(crcTest_Data) - 1, 0x0000, 0x5AA5));
+    TEST_ASSERT_FALSE(crc_crc16ArcForge(crcTest_Data, 1, 0, 0x0000, 0x5AA5));
+    
+    /*** Forge Target At Various Offsets (Each Target Is Current CRC-16/ARC Of Next Forge) ***/
+    crc16Arc = crc_crc16ArcCalculate(crcTest_Data, sizeof(crcTest_Data));
+    for(offset = 0; offset <= (sizeof(crcTest_Data) - 2); offset += 111)
+    {
+        TEST_ASSERT_TRUE(crc_crc16ArcForge(crcTest_Data, sizeof(crcTest_Data), offset, crc16Arc, (uint16_t)(0x5AA5 + offset)));
+        TEST_ASSERT_EQUAL_HEX16((uint16_t)(0x5AA5 + offset), crc_crc16ArcCalculate(crcTest_Data, sizeof(crcTest_Data)));
+        crc16Arc = (uint16_t)(0x5AA5 + offset);
+    }
+    
+    /*** Forge Target At End Of Data ***/
+    TEST_ASSERT_TRUE(crc_crc16ArcForge(crcTest_Data, sizeof(crcTest_Data), sizeof(crcTest_Data) - 2, crc16Arc, 0x5AA5));
+    TEST_ASSERT_EQUAL_HEX16(0x5AA5, crc_crc16ArcCalculate(crcTest_Data, sizeof(crcTest_Data)));
+    
+    /*** Forge Check Value Over Check Data ***/
+    TEST_ASSERT_TRUE(crc_crc16ArcForge(crcTest_Data, sizeof(crcTest_CheckData), 3, crc_crc16ArcCalculate(crcTest_Data, sizeof(crcTest_CheckData)), CRC_TEST_CRC16_ARC_CHECK));
+    TEST_ASSERT_EQUAL_HEX16(CRC_TEST_CRC16_ARC_CHECK, crc_crc16ArcCalculate(crcTest_Data, sizeof(crcTest_CheckData)));
+}
+
+TEST(crc_test, crc16CcittFalseCalculate)
+{
+    uint16_t crc16CcittFalse;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    crc16CcittFalse = crc_crc16CcittFalseCalculate(NULL, sizeof(crcTest_CheckData));
+    TEST_ASSERT_EQUAL_HEX16(CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE, crc16CcittFalse);
+    
+    /* Zero Length Data */
+    crc16CcittFalse = crc_crc16CcittFalseCalculate(crcTest_CheckData, 0);
+    TEST_ASSERT_EQUAL_HEX16(CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE, crc16CcittFalse);
+    
+    /*** Calculate CRC-16/CCITT-FALSE For Check Data; Verify Result As Expected ***/
+    crc16CcittFalse = crc_crc16CcittFalseCalculate(crcTest_CheckData, sizeof(crcTest_CheckData));
+    TEST_ASSERT_EQUAL_HEX16(CRC_TEST_CRC16_CCITT_FALSE_CHECK, crc16CcittFalse);
+}
+
+TEST(crc_test, crc16CcittFalseCalculatePartial)
+{
+    uint8_t i;
+    uint16_t crc16CcittFalse;
+    
+    /*** Set Up ***/
+    crc16CcittFalse = CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE;
+    
+    /*** Calculate CRC-16/CCITT-FALSE For Check Data; Verify Result As Expected ***/
+    for(i = 0; i < sizeof(crcTest_CheckData); i++)
+        crc16CcittFalse = crc_crc16CcittFalseCalculatePartial(crcTest_CheckData[i], crc16CcittFalse);
+    TEST_ASSERT_EQUAL_HEX16(CRC_TEST_CRC16_CCITT_FALSE_CHECK, crc16CcittFalse);
+}
+
+TEST(crc_test, crc16CcittFalseStep)
+{
+    uint16_t crc16CcittFalse;
+    uint8_t i;
+    
+    /*** Set Up ***/
+    crc16CcittFalse = CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE;
+    
+    /*** Calculate CRC-16/CCITT-FALSE For Check Data With Inline Step; Verify Result As Expected ***/
+    for(i = 0; i < sizeof(crcTest_CheckData); i++)
+        crc16CcittFalse = crc_crc16CcittFalseStep(crcTest_CheckData[i], crc16CcittFalse);
+    TEST_ASSERT_EQUAL_HEX16(CRC_TEST_CRC16_CCITT_FALSE_CHECK, crc16CcittFalse);
+}
+
+TEST(crc_test, crc16CcittFalseModify)
+{
+    uint16_t crc16CcittFalse;
+    uint8_t i;
+    
+    /*** Set Up ***/
+    crc16CcittFalse = crc_crc16CcittFalseCalculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX16(crc16CcittFalse, crc_crc16CcittFalseModify(crc16CcittFalse, NULL, sizeof(crcTest_Delta), 0));
+    
+    /* Zero Length Delta */
+    TEST_ASSERT_EQUAL_HEX16(crc16CcittFalse, crc_crc16CcittFalseModify(crc16CcittFalse, crcTest_Delta, 0, 0));
+    
+    /*** Modify Data In Place; Verify Updated CRC-16/CCITT-FALSE Matches Full Calculation ***/
+    for(i = 0; i < sizeof(crcTest_Delta); i++)
+        crcTest_Data[100 + i] ^= crcTest_Delta[i];
+    crc16CcittFalse = crc_crc16CcittFalseModify(crc16CcittFalse, crcTest_Delta, sizeof(crcTest_Delta), sizeof(crcTest_Data) - 100 - sizeof(crcTest_Delta));
+    TEST_ASSERT_EQUAL_HEX16(crc_crc16CcittFalseCalculate(crcTest_Data, sizeof(crcTest_Data)), crc16CcittFalse);
+    
+    /*** Modify Final Data; Verify Updated CRC-16/CCITT-FALSE Matches Full Calculation ***/
+    crcTest_Data[sizeof(crcTest_Data) - 1] ^= crcTest_Delta[0];
+    crc16CcittFalse = crc_crc16CcittFalseModify(crc16CcittFalse, crcTest_Delta, 1, 0);
+    TEST_ASSERT_EQUAL_HEX16(crc_crc16CcittFalseCalculate(crcTest_Data, sizeof(crcTest_Data)), crc16CcittFalse);
+}
+
+TEST(crc_test, crc16CcittFalseModifyBatch)
+{
+    uint16_t crc16CcittFalse;
+    const crc_patch_t Patch[] = {{crcTest_Delta, 0, sizeof(crcTest_Delta), 0}, {crcTest_Delta, 500, 2, 0}, {crcTest_Delta, 999, 2, 0}};
+    uint8_t i;
+    
+    /*** Set Up ***/
+    crc16CcittFalse = crc_crc16CcittFalseCalculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX16(crc16CcittFalse, crc_crc16CcittFalseModifyBatch(crc16CcittFalse, NULL, 1, sizeof(crcTest_Data)));
+    
+    /*** Modify Data In Place (Final Patch Out Of Range); Verify Updated CRC-16/CCITT-FALSE Matches Full Calculation ***/
+    for(i = 0; i < sizeof(crcTest_Delta); i++)
+        crcTest_Data[i] ^= crcTest_Delta[i];
+    for(i = 0; i < 2; i++)
+        crcTest_Data[500 + i] ^= crcTest_Delta[i];
+    crc16CcittFalse = crc_crc16CcittFalseModifyBatch(crc16CcittFalse, Patch, sizeof(Patch) / sizeof(Patch[0]), sizeof(crcTest_Data));
+    TEST_ASSERT_EQUAL_HEX16(crc_crc16CcittFalseCalculate(crcTest_Data, sizeof(crcTest_Data)), crc16CcittFalse);
+}
+
+TEST(crc_test, crc16CcittFalseRollingInitialize)
+{
+    crc_rolling_t rolling;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc16CcittFalseRollingInitialize(NULL, 16));
+    
+    /* Zero Length Window */
+    TEST_ASSERT_FALSE(crc_crc16CcittFalseRollingInitialize(&rolling, 0));
+    
+    /*** Initialize Rolling CRC-16/CCITT-FALSE ***/
+    TEST_ASSERT_TRUE(crc_crc16CcittFalseRollingInitialize(&rolling, 16));
+}
+
+TEST(crc_test, crc16CcittFalseRollingUpdate)
+{
+    crc_rolling_t rolling;
+    uint16_t crc16CcittFalse;
+    uint16_t i, windowLength;
     
     /*** Error Check ***/
     /* NULL Pointer */
-    crc16Arc = crc_crc16ArcCalculate(NULL, sizeof(crcTest_CheckData));
-    TEST_ASSERT_EQUAL_HEX16(CRC_CRC16_ARC_INITIAL_CRC16_ARC, crc16Arc);
+    TEST_ASSERT_EQUAL_HEX16(0x5A, crc_crc16CcittFalseRollingUpdate(NULL, 0x00, 0x00, 0x5A));
     
-    /* Zero Length Data */
-    crc16Arc = crc_crc16ArcCalculate(crcTest_CheckData, 0);
-    TEST_ASSERT_EQUAL_HEX16(CRC_CRC16_ARC_INITIAL_CRC16_ARC, crc16Arc);
+    /*** Slide Window Across Data; Verify Each Window Matches Full Calculation ***/
+    for(windowLength = 1; windowLength <= 64; windowLength += 21)
+    {
+        TEST_ASSERT_TRUE(crc_crc16CcittFalseRollingInitialize(&rolling, windowLength));
+        crc16CcittFalse = crc_crc16CcittFalseCalculate(crcTest_Data, windowLength);
+        for(i = windowLength; i < sizeof(crcTest_Data); i++)
+        {
+            crc16CcittFalse = crc_crc16CcittFalseRollingUpdate(&rolling, crcTest_Data[i - windowLength], crcTest_Data[i], crc16CcittFalse);
+            TEST_ASSERT_EQUAL_HEX16(crc_crc16CcittFalseCalculate(&crcTest_Data[i - windowLength + 1], windowLength), crc16CcittFalse);
+        }
+    }
+}
+
+TEST(crc_test, crc16CcittFalseStripPrefix)
+{
+    uint16_t crc16CcittFalse;
     
-    /*** Calculate CRC-16/ARC For Check Data; Verify Result As Expected ***/
-    crc16Arc = crc_crc16ArcCalculate(crcTest_CheckData, sizeof(crcTest_CheckData));
-    TEST_ASSERT_EQUAL_HEX16(CRC_TEST_CRC16_ARC_CHECK, crc16Arc);
+    /*** Set Up ***/
+    crc16CcittFalse = crc_crc16CcittFalseCalculate(crcTest_Data, sizeof(crcTest_Data));
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX16(crc16CcittFalse, crc_crc16CcittFalseStripPrefix(crc16CcittFalse, NULL, 37, sizeof(crcTest_Data) - 37));
+    
+    /* Zero Length Prefix */
+    TEST_ASSERT_EQUAL_HEX16(crc16CcittFalse, crc_crc16CcittFalseStripPrefix(crc16CcittFalse, crcTest_Data, 0, sizeof(crcTest_Data)));
+    
+    /* Zero Length Suffix */
+    TEST_ASSERT_EQUAL_HEX16(CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE, crc_crc16CcittFalseStripPrefix(crc16CcittFalse, crcTest_Data, sizeof(crcTest_Data), 0));
+    
+    /*** Strip Prefix; Verify Result Matches Full Calculation Of Suffix ***/
+    crc16CcittFalse = crc_crc16CcittFalseStripPrefix(crc16CcittFalse, crcTest_Data, 37, sizeof(crcTest_Data) - 37);
+    TEST_ASSERT_EQUAL_HEX16(crc_crc16CcittFalseCalculate(&crcTest_Data[37], sizeof(crcTest_Data) - 37), crc16CcittFalse);
 }
 
-TEST(crc_test, crc16ArcCalculatePartial)
+TEST(crc_test, crc16CcittFalseUnwind)
 {
-    uint8_t i;
-    uint16_t crc16Arc;
+    uint16_t crc16CcittFalse;
     
     /*** Set Up ***/
-    crc16Arc = CRC_CRC16_ARC_INITIAL_CRC16_ARC;
+    crc16CcittFalse = crc_crc16CcittFalseCalculate(crcTest_Data, sizeof(crcTest_Data));
     
-    /*** Calculate CRC-16/ARC For Check Data; Verify Result As Expected ***/
-    for(i = 0; i < (sizeof(crcTest_CheckData) - 1); i++)
-        crc16Arc = crc_crc16ArcCalculatePartial(crcTest_CheckData[i], crc16Arc, false);
-    crc16Arc = crc_crc16ArcCalculatePartial(crcTest_CheckData[i], crc16Arc, true);
-    TEST_ASSERT_EQUAL_HEX16(CRC_TEST_CRC16_ARC_CHECK, crc16Arc);
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX16(crc16CcittFalse, crc_crc16CcittFalseUnwind(crc16CcittFalse, NULL, 29));
+    
+    /* Zero Length Data */
+    TEST_ASSERT_EQUAL_HEX16(crc16CcittFalse, crc_crc16CcittFalseUnwind(crc16CcittFalse, crcTest_Data, 0));
+    
+    /*** Unwind Trailing Data; Verify Result Matches Full Calculation Without Trailing Data ***/
+    crc16CcittFalse = crc_crc16CcittFalseUnwind(crc16CcittFalse, &crcTest_Data[sizeof(crcTest_Data) - 29], 29);
+    TEST_ASSERT_EQUAL_HEX16(crc_crc16CcittFalseCalculate(crcTest_Data, sizeof(crcTest_Data) - 29), crc16CcittFalse);
 }
 
-TEST(crc_test, crc16CcittFalseCalculate)
+TEST(crc_test, crc16CcittFalsePrefix)
+{
+    crc_prefix_t prefix;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc16CcittFalsePrefixInitialize(NULL, crcTest_Data, 32));
+    TEST_ASSERT_FALSE(crc_crc16CcittFalsePrefixInitialize(&prefix, NULL, 32));
+    TEST_ASSERT_EQUAL_HEX16(CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE, crc_crc16CcittFalsePrefixCalculate(NULL, crcTest_Data, 100));
+    
+    /*** Precompute Prefix; Verify Resumed Result Matches Full Calculation ***/
+    TEST_ASSERT_TRUE(crc_crc16CcittFalsePrefixInitialize(&prefix, crcTest_Data, 32));
+    TEST_ASSERT_EQUAL_HEX16(crc_crc16CcittFalseCalculate(crcTest_Data, 132), crc_crc16CcittFalsePrefixCalculate(&prefix, &crcTest_Data[32], 100));
+    TEST_ASSERT_EQUAL_HEX16(crc_crc16CcittFalseCalculate(crcTest_Data, 33), crc_crc16CcittFalsePrefixCalculate(&prefix, &crcTest_Data[32], 1));
+    
+    /* No Data After Prefix */
+    TEST_ASSERT_EQUAL_HEX16(crc_crc16CcittFalseCalculate(crcTest_Data, 32), crc_crc16CcittFalsePrefixCalculate(&prefix, &crcTest_Data[32], 0));
+    
+    /* Empty Prefix */
+    TEST_ASSERT_TRUE(crc_crc16CcittFalsePrefixInitialize(&prefix, NULL, 0));
+    TEST_ASSERT_EQUAL_HEX16(crc_crc16CcittFalseCalculate(crcTest_Data, 100), crc_crc16CcittFalsePrefixCalculate(&prefix, crcTest_Data, 100));
+}
+
+TEST(crc_test, crc16CcittFalseCalculateMasked)
 {
     uint16_t crc16CcittFalse;
+    const crc_mask_t Mask[] = {{10, 4}, {100, 50}, {120, 40}, {990, 20}};
+    uint8_t m;
+    uint16_t i;
     
     /*** Error Check ***/
     /* NULL Pointer */
-    crc16CcittFalse = crc_crc16CcittFalseCalculate(NULL, sizeof(crcTest_CheckData));
+    crc16CcittFalse = crc_crc16CcittFalseCalculateMasked(NULL, sizeof(crcTest_Data), Mask, sizeof(Mask) / sizeof(Mask[0]));
+    TEST_ASSERT_EQUAL_HEX16(CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE, crc16CcittFalse);
+    crc16CcittFalse = crc_crc16CcittFalseCalculateMasked(crcTest_Data, sizeof(crcTest_Data), NULL, 1);
     TEST_ASSERT_EQUAL_HEX16(CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE, crc16CcittFalse);
     
     /* Zero Length Data */
-    crc16CcittFalse = crc_crc16CcittFalseCalculate(crcTest_CheckData, 0);
+    crc16CcittFalse = crc_crc16CcittFalseCalculateMasked(crcTest_Data, 0, Mask, sizeof(Mask) / sizeof(Mask[0]));
     TEST_ASSERT_EQUAL_HEX16(CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE, crc16CcittFalse);
     
-    /*** Calculate CRC-16/CCITT-FALSE For Check Data; Verify Result As Expected ***/
-    crc16CcittFalse = crc_crc16CcittFalseCalculate(crcTest_CheckData, sizeof(crcTest_CheckData));
-    TEST_ASSERT_EQUAL_HEX16(CRC_TEST_CRC16_CCITT_FALSE_CHECK, crc16CcittFalse);
+    /*** Calculate Without Masks; Verify Result Matches Full Calculation ***/
+    crc16CcittFalse = crc_crc16CcittFalseCalculateMasked(crcTest_Data, sizeof(crcTest_Data), NULL, 0);
+    TEST_ASSERT_EQUAL_HEX16(crc_crc16CcittFalseCalculate(crcTest_Data, sizeof(crcTest_Data)), crc16CcittFalse);
+    
+    /*** Calculate With Masks; Verify Result Matches Full Calculation Of Zeroed Data ***/
+    crc16CcittFalse = crc_crc16CcittFalseCalculateMasked(crcTest_Data, sizeof(crcTest_Data), Mask, sizeof(Mask) / sizeof(Mask[0]));
+    for(m = 0; m < (sizeof(Mask) / sizeof(Mask[0])); m++)
+    {
+        for(i = Mask[m].offset; (i < (Mask[m].offset + Mask[m].length)) && (i < sizeof(crcTest_Data)); i++)
+            crcTest_Data[i] = 0x00;
+    }
+    TEST_ASSERT_EQUAL_HEX16(crc_crc16CcittFalseCalculate(crcTest_Data, sizeof(crcTest_Data)), crc16CcittFalse);
 }
 
-TEST(crc_test, crc16CcittFalseCalculatePartial)
+TEST(crc_test, crc16CcittFalseCalculateBits)
 {
-    uint8_t i;
     uint16_t crc16CcittFalse;
+    uint8_t shifted[sizeof(crcTest_CheckData) + 1];
+    uint16_t i;
     
-    /*** Set Up ***/
-    crc16CcittFalse = CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE;
+    /*** Error Check ***/
+    /* NULL Pointer */
+    crc16CcittFalse = crc_crc16CcittFalseCalculateBits(NULL, 0, sizeof(crcTest_CheckData) * 8);
+    TEST_ASSERT_EQUAL_HEX16(CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE, crc16CcittFalse);
     
-    /*** Calculate CRC-16/CCITT-FALSE For Check Data; Verify Result As Expected ***/
+    /* Zero Length Data */
+    crc16CcittFalse = crc_crc16CcittFalseCalculateBits(crcTest_CheckData, 0, 0);
+    TEST_ASSERT_EQUAL_HEX16(CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE, crc16CcittFalse);
+    crc16CcittFalse = crc_crc16CcittFalseCalculatePartialBits(0xFF, 0, CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE);
+    TEST_ASSERT_EQUAL_HEX16(CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE, crc16CcittFalse);
+    
+    /* Bit Range Beyond Address Space */
+    crc16CcittFalse = crc_crc16CcittFalseCalculateBits(crcTest_CheckData, 0xFFFFFFF8UL, 16);
+    TEST_ASSERT_EQUAL_HEX16(CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE, crc16CcittFalse);
+    
+    /*** Calculate Over Whole Bytes; Verify Result Matches Byte-Wise Calculation ***/
+    crc16CcittFalse = crc_crc16CcittFalseCalculateBits(crcTest_Data, 0, sizeof(crcTest_Data) * 8);
+    TEST_ASSERT_EQUAL_HEX16(crc_crc16CcittFalseCalculate(crcTest_Data, sizeof(crcTest_Data)), crc16CcittFalse);
+    
+    /*** Calculate Over Check Data Shifted By 3 Bits (Most Significant Bit First) ***/
+    shifted[0] = (uint8_t)(crcTest_CheckData[0] >> 3);
+    for(i = 1; i < sizeof(crcTest_CheckData); i++)
+        shifted[i] = (uint8_t)((crcTest_CheckData[i - 1] << 5) | (crcTest_CheckData[i] >> 3));
+    shifted[sizeof(crcTest_CheckData)] = (uint8_t)(crcTest_CheckData[sizeof(crcTest_CheckData) - 1] << 5);
+    crc16CcittFalse = crc_crc16CcittFalseCalculateBits(shifted, 3, sizeof(crcTest_CheckData) * 8);
+    TEST_ASSERT_EQUAL_HEX16(CRC_TEST_CRC16_CCITT_FALSE_CHECK, crc16CcittFalse);
+    
+    /*** Calculate Check Data In 3 And 5 Bit Pieces ***/
+    crc16CcittFalse = CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE;
     for(i = 0; i < sizeof(crcTest_CheckData); i++)
-        crc16CcittFalse = crc_crc16CcittFalseCalculatePartial(crcTest_CheckData[i], crc16CcittFalse);
+    {
+        crc16CcittFalse = crc_crc16CcittFalseCalculatePartialBits(crcTest_CheckData[i], 3, crc16CcittFalse);
+        crc16CcittFalse = crc_crc16CcittFalseCalculatePartialBits((uint8_t)(crcTest_CheckData[i] << 3), 5, crc16CcittFalse);
+    }
     TEST_ASSERT_EQUAL_HEX16(CRC_TEST_CRC16_CCITT_FALSE_CHECK, crc16CcittFalse);
+    
+    /*** Calculate Over Non-Whole Byte Length; Verify Result Matches Partial Calculation ***/
+    crc16CcittFalse = CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE;
+    for(i = 0; i < 100; i++)
+        crc16CcittFalse = crc_crc16CcittFalseCalculatePartial(crcTest_Data[i], crc16CcittFalse);
+    crc16CcittFalse = crc_crc16CcittFalseCalculatePartialBits(crcTest_Data[100], 5, crc16CcittFalse);
+    TEST_ASSERT_EQUAL_HEX16(crc16CcittFalse, crc_crc16CcittFalseCalculateBits(crcTest_Data, 0, (100 * 8) + 5));
+}
+
+TEST(crc_test, crc16CcittFalseVerify)
+{
+    uint8_t frame[sizeof(crcTest_CheckData) + 2];
+    uint16_t i;
+    
+    /*** Set Up Check Data Followed By CRC-16/CCITT-FALSE ***/
+    for(i = 0; i < sizeof(crcTest_CheckData); i++)
+        frame[i] = crcTest_CheckData[i];
+    frame[sizeof(crcTest_CheckData)] = (uint8_t)(CRC_TEST_CRC16_CCITT_FALSE_CHECK >> 8);
+    frame[sizeof(crcTest_CheckData) + 1] = (uint8_t)(CRC_TEST_CRC16_CCITT_FALSE_CHECK & 0xFF);
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc16CcittFalseVerify(NULL, sizeof(frame)));
+    
+    /* Data Shorter Than CRC-16/CCITT-FALSE */
+    TEST_ASSERT_FALSE(crc_crc16CcittFalseVerify(frame, 1));
+    
+    /*** Verify Valid Frame ***/
+    TEST_ASSERT_TRUE(crc_crc16CcittFalseVerify(frame, sizeof(frame)));
+    
+    /*** Verify Single Bit Errors Are Detected ***/
+    for(i = 0; i < (sizeof(frame) * 8); i++)
+    {
+        frame[i >> 3] ^= (uint8_t)(1U << (i & 0x07));
+        TEST_ASSERT_FALSE(crc_crc16CcittFalseVerify(frame, sizeof(frame)));
+        frame[i >> 3] ^= (uint8_t)(1U << (i & 0x07));
+    }
+}
+
+TEST(crc_test, crc16CcittFalseCorrect)
+{
+    static crc_syndrome16_t syndrome;
+    uint16_t crc16CcittFalse;
+    crc_correction_t correction;
+    uint32_t corrected;
+    uint8_t frame[sizeof(crcTest_CheckData) + 2];
+    uint16_t i, j;
+    
+    /*** Set Up Check Data Followed By CRC-16/CCITT-FALSE ***/
+    for(i = 0; i < sizeof(crcTest_CheckData); i++)
+        frame[i] = crcTest_CheckData[i];
+    frame[sizeof(crcTest_CheckData)] = (uint8_t)(CRC_TEST_CRC16_CCITT_FALSE_CHECK >> 8);
+    frame[sizeof(crcTest_CheckData) + 1] = (uint8_t)(CRC_TEST_CRC16_CCITT_FALSE_CHECK & 0xFF);
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL(CRC_CORRECTION_FAILED, crc_crc16CcittFalseCorrect(NULL, frame, sizeof(frame)));
+    TEST_ASSERT_EQUAL(CRC_CORRECTION_FAILED, crc_crc16CcittFalseCorrect(&syndrome, NULL, sizeof(frame)));
+    
+    /* Data Shorter Than CRC-16/CCITT-FALSE */
+    TEST_ASSERT_EQUAL(CRC_CORRECTION_FAILED, crc_crc16CcittFalseCorrect(&syndrome, frame, 1));
+    
+    /*** Verify Valid Frame Is Left Untouched ***/
+    TEST_ASSERT_EQUAL(CRC_CORRECTION_NONE, crc_crc16CcittFalseCorrect(&syndrome, frame, sizeof(frame)));
+    TEST_ASSERT_TRUE(crc_crc16CcittFalseVerify(frame, sizeof(frame)));
+    
+    /*** Verify Single Bit Errors Are Corrected ***/
+    for(i = 0; i < (sizeof(frame) * 8); i++)
+    {
+        frame[i >> 3] ^= (uint8_t)(1U << (i & 0x07));
+        TEST_ASSERT_EQUAL(CRC_CORRECTION_SINGLE, crc_crc16CcittFalseCorrect(&syndrome, frame, sizeof(frame)));
+        TEST_ASSERT_TRUE(crc_crc16CcittFalseVerify(frame, sizeof(frame)));
+    }
+    
+    /*** Verify Double Bit Errors Are Corrected Or Left Untouched If Ambiguous ***/
+    corrected = 0;
+    for(i = 0; i < (sizeof(frame) * 8); i++)
+    {
+        for(j = i + 1; j < (sizeof(frame) * 8); j++)
+        {
+            frame[i >> 3] ^= (uint8_t)(1U << (i & 0x07));
+            frame[j >> 3] ^= (uint8_t)(1U << (j & 0x07));
+            correction = crc_crc16CcittFalseCorrect(&syndrome, frame, sizeof(frame));
+            if(correction == CRC_CORRECTION_DOUBLE)
+            {
+                TEST_ASSERT_TRUE(crc_crc16CcittFalseVerify(frame, sizeof(frame)));
+                corrected++;
+            }
+            else
+            {
+                TEST_ASSERT_EQUAL(CRC_CORRECTION_FAILED, correction);
+                frame[i >> 3] ^= (uint8_t)(1U << (i & 0x07));
+                frame[j >> 3] ^= (uint8_t)(1U << (j & 0x07));
+            }
+        }
+    }
+    TEST_ASSERT_TRUE(corrected > 0);
+    
+    /*** Verify Single Bit Errors Are Corrected After Change Of Data Length ***/
+    crc16CcittFalse = crc_crc16CcittFalseCalculate(crcTest_Data, 100);
+    crcTest_Data[100] = (uint8_t)(crc16CcittFalse >> 8);
+    crcTest_Data[101] = (uint8_t)(crc16CcittFalse & 0xFF);
+    for(i = 0; i < ((100 + 2) * 8); i += 13)
+    {
+        crcTest_Data[i >> 3] ^= (uint8_t)(1U << (i & 0x07));
+        TEST_ASSERT_EQUAL(CRC_CORRECTION_SINGLE, crc_crc16CcittFalseCorrect(&syndrome, crcTest_Data, 100 + 2));
+        TEST_ASSERT_TRUE(crc_crc16CcittFalseVerify(crcTest_Data, 100 + 2));
+    }
+    
+    /*** Verify Table Built For Longer Data Is Reused For Shorter Data ***/
+    for(i = 0; i < (sizeof(frame) * 8); i++)
+    {
+        frame[i >> 3] ^= (uint8_t)(1U << (i & 0x07));
+        TEST_ASSERT_EQUAL(CRC_CORRECTION_SINGLE, crc_crc16CcittFalseCorrect(&syndrome, frame, sizeof(frame)));
+        TEST_ASSERT_TRUE(crc_crc16CcittFalseVerify(frame, sizeof(frame)));
+    }
+    TEST_ASSERT_EQUAL_UINT16(100 + 2, syndrome.length);
+}
+
+TEST(crc_test, crc16CcittFalseForge)
+{
+    uint16_t crc16CcittFalse;
+    uint16_t offset;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_crc16CcittFalseForge(NULL, sizeof(crcTest_Data), 0, 0x0000, 0x5AA5));
+    
+    /* Patch Beyond End Of Data */
+    TEST_ASSERT_FALSE(crc_crc16CcittFalseForge(crcTest_Data, sizeof(crcTest_Data), sizeof(crcTest_Data) - 1, 0x0000, 0x5AA5));
+    TEST_ASSERT_FALSE(crc_crc16CcittFalseForge(crcTest_Data, 1, 0, 0x0000, 0x5AA5));
+    
+    /*** Forge Target At Various Offsets (Each Target Is Current CRC-16/CCITT-FALSE Of Next Forge) ***/
+    crc16CcittFalse = crc_crc16CcittFalseCalculate(crcTest_Data, sizeof(crcTest_Data));
+    for(offset = 0; offset <= (sizeof(crcTest_Data) - 2); offset += 111)
+    {
+        TEST_ASSERT_TRUE(crc_crc16CcittFalseForge(crcTest_Data, sizeof(crcTest_Data), offset, crc16CcittFalse, (uint16_t)(0x5AA5 + offset)));
+        TEST_ASSERT_EQUAL_HEX16((uint16_t)(0x5AA5 + offset), crc_crc16CcittFalseCalculate(crcTest_Data, sizeof(crcTest_Data)));
+        crc16CcittFalse = (uint16_t)(0x5AA5 + offset);
+    }
+    
+    /*** Forge Target At End Of Data ***/
+    TEST_ASSERT_TRUE(crc_crc16CcittFalseForge(crcTest_Data, sizeof(crcTest_Data), sizeof(crcTest_Data) - 2, crc16CcittFalse, 0x5AA5));
+    TEST_ASSERT_EQUAL_HEX16(0x5AA5, crc_crc16CcittFalseCalculate(crcTest_Data, sizeof(crcTest_Data)));
+    
+    /*** Forge Check Value Over Check Data ***/
+    TEST_ASSERT_TRUE(crc_crc16CcittFalseForge(crcTest_Data, sizeof(crcTest_CheckData), 3, crc_crc16CcittFalseCalculate(crcTest_Data, sizeof(crcTest_CheckData)), CRC_TEST_CRC16_CCITT_FALSE_CHECK));
+    TEST_ASSERT_EQUAL_HEX16(CRC_TEST_CRC16_CCITT_FALSE_CHECK, crc_crc16CcittFalseCalculate(crcTest_Data, sizeof(crcTest_CheckData)));
+}
+
+TEST(crc_test, multiCalculate)
+{
+    static uint8_t data[5000];
+    uint16_t crc[CRC_VARIANT_COUNT];
+    uint32_t variants = 0;
+    uint16_t d;
+    uint8_t i;
+    
+    /*** Set Up ***/
+    variants |= CRC_VARIANT_MASK(CRC_VARIANT_CRC8);
+    variants |= CRC_VARIANT_MASK(CRC_VARIANT_CRC8_CDMA2000);
+    variants |= CRC_VARIANT_MASK(CRC_VARIANT_CRC8_DARC);
+    variants |= CRC_VARIANT_MASK(CRC_VARIANT_CRC8_DVB_S2);
+    variants |= CRC_VARIANT_MASK(CRC_VARIANT_CRC8_EBU);
+    variants |= CRC_VARIANT_MASK(CRC_VARIANT_CRC8_I_CODE);
+    variants |= CRC_VARIANT_MASK(CRC_VARIANT_CRC8_ITU);
+    variants |= CRC_VARIANT_MASK(CRC_VARIANT_CRC8_MAXIM);
+    variants |= CRC_VARIANT_MASK(CRC_VARIANT_CRC8_ROHC);
+    variants |= CRC_VARIANT_MASK(CRC_VARIANT_CRC8_WCDMA);
+    variants |= CRC_VARIANT_MASK(CRC_VARIANT_CRC16_ARC);
+    variants |= CRC_VARIANT_MASK(CRC_VARIANT_CRC16_CCITT_FALSE);
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    for(i = 0; i < CRC_VARIANT_COUNT; i++)
+        crc[i] = 0xA5A5;
+    crc_multiCalculate(NULL, sizeof(crcTest_CheckData), variants, crc);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_INITIAL_CRC8, crc[CRC_VARIANT_CRC8]);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000, crc[CRC_VARIANT_CRC8_CDMA2000]);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_DARC_INITIAL_CRC8_DARC, crc[CRC_VARIANT_CRC8_DARC]);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2, crc[CRC_VARIANT_CRC8_DVB_S2]);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_EBU_INITIAL_CRC8_EBU, crc[CRC_VARIANT_CRC8_EBU]);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE, crc[CRC_VARIANT_CRC8_I_CODE]);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_ITU_INITIAL_CRC8_ITU, crc[CRC_VARIANT_CRC8_ITU]);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM, crc[CRC_VARIANT_CRC8_MAXIM]);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_ROHC_INITIAL_CRC8_ROHC, crc[CRC_VARIANT_CRC8_ROHC]);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA, crc[CRC_VARIANT_CRC8_WCDMA]);
+    TEST_ASSERT_EQUAL_HEX16(CRC_CRC16_ARC_INITIAL_CRC16_ARC, crc[CRC_VARIANT_CRC16_ARC]);
+    TEST_ASSERT_EQUAL_HEX16(CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE, crc[CRC_VARIANT_CRC16_CCITT_FALSE]);
+    
+    /* Zero Length Data */
+    for(i = 0; i < CRC_VARIANT_COUNT; i++)
+        crc[i] = 0xA5A5;
+    crc_multiCalculate(crcTest_CheckData, 0, variants, crc);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_INITIAL_CRC8, crc[CRC_VARIANT_CRC8]);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_CDMA2000_INITIAL_CRC8_CDMA2000, crc[CRC_VARIANT_CRC8_CDMA2000]);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_DARC_INITIAL_CRC8_DARC, crc[CRC_VARIANT_CRC8_DARC]);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_DVB_S2_INITIAL_CRC8_DVB_S2, crc[CRC_VARIANT_CRC8_DVB_S2]);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_EBU_INITIAL_CRC8_EBU, crc[CRC_VARIANT_CRC8_EBU]);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_I_CODE_INITIAL_CRC8_I_CODE, crc[CRC_VARIANT_CRC8_I_CODE]);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_ITU_INITIAL_CRC8_ITU, crc[CRC_VARIANT_CRC8_ITU]);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_MAXIM_INITIAL_CRC8_MAXIM, crc[CRC_VARIANT_CRC8_MAXIM]);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_ROHC_INITIAL_CRC8_ROHC, crc[CRC_VARIANT_CRC8_ROHC]);
+    TEST_ASSERT_EQUAL_HEX8(CRC_CRC8_WCDMA_INITIAL_CRC8_WCDMA, crc[CRC_VARIANT_CRC8_WCDMA]);
+    TEST_ASSERT_EQUAL_HEX16(CRC_CRC16_ARC_INITIAL_CRC16_ARC, crc[CRC_VARIANT_CRC16_ARC]);
+    TEST_ASSERT_EQUAL_HEX16(CRC_CRC16_CCITT_FALSE_INITIAL_CRC16_CCITT_FALSE, crc[CRC_VARIANT_CRC16_CCITT_FALSE]);
+    
+    /*** Calculate All CRCs For Check Data; Verify Results As Expected ***/
+    crc_multiCalculate(crcTest_CheckData, sizeof(crcTest_CheckData), variants, crc);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_CHECK, crc[CRC_VARIANT_CRC8]);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_CDMA2000_CHECK, crc[CRC_VARIANT_CRC8_CDMA2000]);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_DARC_CHECK, crc[CRC_VARIANT_CRC8_DARC]);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_DVB_S2_CHECK, crc[CRC_VARIANT_CRC8_DVB_S2]);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_EBU_CHECK, crc[CRC_VARIANT_CRC8_EBU]);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_I_CODE_CHECK, crc[CRC_VARIANT_CRC8_I_CODE]);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_ITU_CHECK, crc[CRC_VARIANT_CRC8_ITU]);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_MAXIM_CHECK, crc[CRC_VARIANT_CRC8_MAXIM]);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_ROHC_CHECK, crc[CRC_VARIANT_CRC8_ROHC]);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_WCDMA_CHECK, crc[CRC_VARIANT_CRC8_WCDMA]);
+    TEST_ASSERT_EQUAL_HEX16(CRC_TEST_CRC16_ARC_CHECK, crc[CRC_VARIANT_CRC16_ARC]);
+    TEST_ASSERT_EQUAL_HEX16(CRC_TEST_CRC16_CCITT_FALSE_CHECK, crc[CRC_VARIANT_CRC16_CCITT_FALSE]);
+    
+    /*** Calculate Subset Of CRCs For Check Data; Verify Only Requested Entries Written ***/
+    for(i = 0; i < CRC_VARIANT_COUNT; i++)
+        crc[i] = 0xA5A5;
+    variants = CRC_VARIANT_MASK(CRC_VARIANT_CRC8_MAXIM) | CRC_VARIANT_MASK(CRC_VARIANT_CRC8_DVB_S2) | CRC_VARIANT_MASK(CRC_VARIANT_CRC16_CCITT_FALSE);
+    crc_multiCalculate(crcTest_CheckData, sizeof(crcTest_CheckData), variants, crc);
+    for(i = 0; i < CRC_VARIANT_COUNT; i++)
+    {
+        if((variants & CRC_VARIANT_MASK(i)) == 0)
+            TEST_ASSERT_EQUAL_HEX16(0xA5A5, crc[i]);
+    }
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_MAXIM_CHECK, crc[CRC_VARIANT_CRC8_MAXIM]);
+    TEST_ASSERT_EQUAL_HEX8(CRC_TEST_CRC8_DVB_S2_CHECK, crc[CRC_VARIANT_CRC8_DVB_S2]);
+    TEST_ASSERT_EQUAL_HEX16(CRC_TEST_CRC16_CCITT_FALSE_CHECK, crc[CRC_VARIANT_CRC16_CCITT_FALSE]);
+    
+    /*** Calculate Across Several Blocks; Verify Against Single Variant Calculate ***/
+    for(d = 0; d < sizeof(data); d++)
+        data[d] = crcTest_Data[d % sizeof(crcTest_Data)];
+    variants = CRC_VARIANT_MASK(CRC_VARIANT_CRC8) | CRC_VARIANT_MASK(CRC_VARIANT_CRC8_DARC) | CRC_VARIANT_MASK(CRC_VARIANT_CRC8_MAXIM) |
+               CRC_VARIANT_MASK(CRC_VARIANT_CRC16_ARC) | CRC_VARIANT_MASK(CRC_VARIANT_CRC16_CCITT_FALSE);
+    crc_multiCalculate(data, sizeof(data), variants, crc);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8Calculate(data, sizeof(data)), crc[CRC_VARIANT_CRC8]);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8DarcCalculate(data, sizeof(data)), crc[CRC_VARIANT_CRC8_DARC]);
+    TEST_ASSERT_EQUAL_HEX8(crc_crc8MaximCalculate(data, sizeof(data)), crc[CRC_VARIANT_CRC8_MAXIM]);
+    TEST_ASSERT_EQUAL_HEX16(crc_crc16ArcCalculate(data, sizeof(data)), crc[CRC_VARIANT_CRC16_ARC]);
+    TEST_ASSERT_EQUAL_HEX16(crc_crc16CcittFalseCalculate(data, sizeof(data)), crc[CRC_VARIANT_CRC16_CCITT_FALSE]);
+}
+
+TEST(crc_test, variantName)
+{
+    /*** Error Check ***/
+    /* Invalid Variant */
+    TEST_ASSERT_NULL(crc_variantName(CRC_VARIANT_COUNT));
+    
+    /*** Verify Names ***/
+    TEST_ASSERT_EQUAL_STRING("CRC-8", crc_variantName(CRC_VARIANT_CRC8));
+    TEST_ASSERT_EQUAL_STRING("CRC-8/WCDMA", crc_variantName(CRC_VARIANT_CRC8_WCDMA));
+    TEST_ASSERT_EQUAL_STRING("CRC-16/CCITT-FALSE", crc_variantName(CRC_VARIANT_CRC16_CCITT_FALSE));
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcTest_metricsThread
+ * BRIEF:   Calculate CRC-16/ARC Once And Exit (Metrics Thread Entry)
+ * RETURN:  void *: Returns NULL
+ * ARG:     argument: Unused
+ ****************************************************************************************************/
+static void *crcTest_metricsThread(void *argument)
+{
+    (void)argument; // Silence Compiler Warning
+    (void)crc_crc16ArcCalculate(crcTest_Data, 100);
+    
+    return NULL;
+}
+
+TEST(crc_test, metricsSnapshot)
+{
+    static crc_metrics_t before[CRC_VARIANT_COUNT], after[CRC_VARIANT_COUNT];
+    uint16_t crc[CRC_VARIANT_COUNT];
+    crc_prefix_t prefix;
+    pthread_t thread;
+    uint64_t timed = 0;
+    uint8_t b;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_metricsSnapshot(NULL));
+    
+    /*** Count Calls, Bytes And Lengths On This Thread ***/
+    TEST_ASSERT_TRUE(crc_metricsSnapshot(before));
+    (void)crc_crc8Calculate(crcTest_CheckData, sizeof(crcTest_CheckData));
+    (void)crc_crc8Calculate(crcTest_Data, 1000);
+    (void)crc_crc8Calculate(NULL, 1000);
+    (void)crc_crc8CalculatePartial(crcTest_CheckData[0], CRC_CRC8_INITIAL_CRC8);
+    (void)crc_crc8Verify(crcTest_CheckData, sizeof(crcTest_CheckData));
+    (void)crc_crc8CalculateBits(crcTest_CheckData, 4, 12);
+    (void)crc_crc8PrefixInitialize(&prefix, crcTest_Data, 100);
+    (void)crc_crc8StripPrefix(0x00, crcTest_Data, 100, 100);
+    TEST_ASSERT_TRUE(crc_metricsSnapshot(after));
+    TEST_ASSERT_EQUAL_UINT32(4, (uint32_t)(after[CRC_VARIANT_CRC8].calls - before[CRC_VARIANT_CRC8].calls));
+    TEST_ASSERT_EQUAL_UINT32(1020, (uint32_t)(after[CRC_VARIANT_CRC8].bytes - before[CRC_VARIANT_CRC8].bytes));
+    TEST_ASSERT_EQUAL_UINT32(0, (uint32_t)(after[CRC_VARIANT_CRC8].length[0] - before[CRC_VARIANT_CRC8].length[0]));
+    TEST_ASSERT_EQUAL_UINT32(1, (uint32_t)(after[CRC_VARIANT_CRC8].length[1] - before[CRC_VARIANT_CRC8].length[1]));
+    TEST_ASSERT_EQUAL_UINT32(2, (uint32_t)(after[CRC_VARIANT_CRC8].length[3] - before[CRC_VARIANT_CRC8].length[3]));
+    TEST_ASSERT_EQUAL_UINT32(1, (uint32_t)(after[CRC_VARIANT_CRC8].length[9] - before[CRC_VARIANT_CRC8].length[9]));
+    TEST_ASSERT_EQUAL_UINT32(0, (uint32_t)(after[CRC_VARIANT_CRC16_ARC].calls - before[CRC_VARIANT_CRC16_ARC].calls));
+    
+    /*** Count Each Requested Variant Of A Multi-Variant Pass ***/
+    TEST_ASSERT_TRUE(crc_metricsSnapshot(before));
+    crc_multiCalculate(crcTest_Data, 300, CRC_VARIANT_MASK(CRC_VARIANT_CRC8) | CRC_VARIANT_MASK(CRC_VARIANT_CRC16_ARC), crc);
+    crc_multiCalculate(NULL, 300, CRC_VARIANT_MASK(CRC_VARIANT_CRC8), crc);
+    TEST_ASSERT_TRUE(crc_metricsSnapshot(after));
+    TEST_ASSERT_EQUAL_UINT32(1, (uint32_t)(after[CRC_VARIANT_CRC8].calls - before[CRC_VARIANT_CRC8].calls));
+    TEST_ASSERT_EQUAL_UINT32(300, (uint32_t)(after[CRC_VARIANT_CRC8].bytes - before[CRC_VARIANT_CRC8].bytes));
+    TEST_ASSERT_EQUAL_UINT32(1, (uint32_t)(after[CRC_VARIANT_CRC16_ARC].calls - before[CRC_VARIANT_CRC16_ARC].calls));
+    TEST_ASSERT_EQUAL_UINT32(0, (uint32_t)(after[CRC_VARIANT_CRC8_CDMA2000].calls - before[CRC_VARIANT_CRC8_CDMA2000].calls));
+    
+    /*** Counts Of Exited Thread Are Retained (First Call Of A Thread Is Timed) ***/
+    TEST_ASSERT_TRUE(crc_metricsSnapshot(before));
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&thread, NULL, crcTest_metricsThread, NULL));
+    TEST_ASSERT_EQUAL_INT(0, pthread_join(thread, NULL));
+    TEST_ASSERT_TRUE(crc_metricsSnapshot(after));
+    TEST_ASSERT_EQUAL_UINT32(1, (uint32_t)(after[CRC_VARIANT_CRC16_ARC].calls - before[CRC_VARIANT_CRC16_ARC].calls));
+    TEST_ASSERT_EQUAL_UINT32(100, (uint32_t)(after[CRC_VARIANT_CRC16_ARC].bytes - before[CRC_VARIANT_CRC16_ARC].bytes));
+    TEST_ASSERT_EQUAL_UINT32(1, (uint32_t)(after[CRC_VARIANT_CRC16_ARC].length[6] - before[CRC_VARIANT_CRC16_ARC].length[6]));
+    for(b = 0; b < CRC_METRICS_BUCKET_COUNT; b++)
+        timed += after[CRC_VARIANT_CRC16_ARC].cycles[b] - before[CRC_VARIANT_CRC16_ARC].cycles[b];
+    TEST_ASSERT_EQUAL_UINT32(1, (uint32_t)timed);
+}
+
+TEST(crc_test, reverseModel)
+{
+    crc_model_t model;
+    uint8_t v;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_reverseModel(CRC_VARIANT_CRC8, NULL));
+    
+    /* Invalid Variant */
+    TEST_ASSERT_FALSE(crc_reverseModel(CRC_VARIANT_COUNT, &model));
+    
+    /*** Verify Every Preset Model Is Returned For Its Variant ***/
+    for(v = 0; v < CRC_VARIANT_COUNT; v++)
+    {
+        TEST_ASSERT_TRUE(crc_reverseModel((crc_variant_t)v, &model));
+        TEST_ASSERT_EQUAL(v, model.variant);
+    }
+    TEST_ASSERT_TRUE(crc_reverseModel(CRC_VARIANT_CRC16_ARC, &model));
+    TEST_ASSERT_EQUAL_UINT8(16, model.width);
+    TEST_ASSERT_EQUAL_HEX16(0x8005, model.polynomial);
+    TEST_ASSERT_TRUE(model.reflectIn);
+    TEST_ASSERT_TRUE(model.reflectOut);
+}
+
+TEST(crc_test, reversePreset)
+{
+    crc_model_t model[CRC_VARIANT_COUNT];
+    crc_sample_t sample[2];
+    
+    /*** Set Up ***/
+    sample[0].data = crcTest_CheckData;
+    sample[0].length = sizeof(crcTest_CheckData);
+    sample[0].crc = CRC_TEST_CRC16_ARC_CHECK;
+    sample[1].data = crcTest_Data;
+    sample[1].length = 100;
+    sample[1].crc = crc_crc16ArcCalculate(crcTest_Data, 100);
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_UINT16(0, crc_reversePreset(NULL, 2, model, CRC_VARIANT_COUNT));
+    
+    /* Zero Samples */
+    TEST_ASSERT_EQUAL_UINT16(0, crc_reversePreset(sample, 0, model, CRC_VARIANT_COUNT));
+    
+    /*** Find CRC-16/ARC ***/
+    TEST_ASSERT_EQUAL_UINT16(1, crc_reversePreset(sample, 2, model, CRC_VARIANT_COUNT));
+    TEST_ASSERT_EQUAL(CRC_VARIANT_CRC16_ARC, model[0].variant);
+    TEST_ASSERT_EQUAL_UINT8(16, model[0].width);
+    TEST_ASSERT_EQUAL_HEX16(0x8005, model[0].polynomial);
+    
+    /*** Find CRC-8/ITU And CRC-8/MAXIM (Same Check Value); Only First Model Written ***/
+    sample[0].crc = CRC_TEST_CRC8_MAXIM_CHECK;
+    model[1].variant = CRC_VARIANT_COUNT;
+    TEST_ASSERT_EQUAL_UINT16(2, crc_reversePreset(sample, 1, model, 1));
+    TEST_ASSERT_EQUAL(CRC_VARIANT_CRC8_ITU, model[0].variant);
+    TEST_ASSERT_EQUAL(CRC_VARIANT_COUNT, model[1].variant);
+    
+    /*** No Preset Matches Corrupted CRC ***/
+    sample[1].crc ^= 0x0001;
+    TEST_ASSERT_EQUAL_UINT16(0, crc_reversePreset(sample, 2, NULL, 0));
+}
+
+TEST(crc_test, reverseSearch)
+{
+    crc_model_t model[4];
+    crc_sample_t sample[5];
+    const uint16_t Length[] = {sizeof(crcTest_CheckData), 100, 37, 64, 1};
+    uint16_t offset = 0;
+    uint8_t s;
+    
+    /*** Set Up CRC-8/MAXIM Samples Of Different Lengths ***/
+    for(s = 0; s < 5; s++)
+    {
+        sample[s].data = &crcTest_Data[offset];
+        sample[s].length = Length[s];
+        sample[s].crc = crc_crc8MaximCalculate(&crcTest_Data[offset], Length[s]);
+        offset = (uint16_t)(offset + Length[s]);
+    }
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_UINT16(0, crc_reverseSearch(NULL, 5, 8, 0x00, 0xFF, model, 4));
+    
+    /* Zero Samples */
+    TEST_ASSERT_EQUAL_UINT16(0, crc_reverseSearch(sample, 0, 8, 0x00, 0xFF, model, 4));
+    
+    /* Invalid Width */
+    TEST_ASSERT_EQUAL_UINT16(0, crc_reverseSearch(sample, 5, 12, 0x00, 0xFF, model, 4));
+    
+    /* Empty Polynomial Range */
+    TEST_ASSERT_EQUAL_UINT16(0, crc_reverseSearch(sample, 5, 8, 0xFF, 0x00, model, 4));
+    
+    /*** Search All CRC-8 Polynomials; Verify CRC-8/MAXIM Found ***/
+    TEST_ASSERT_EQUAL_UINT16(1, crc_reverseSearch(sample, 5, 8, 0x00, 0xFFFF, model, 4));
+    TEST_ASSERT_EQUAL(CRC_VARIANT_CRC8_MAXIM, model[0].variant);
+    TEST_ASSERT_EQUAL_HEX8(0x31, model[0].polynomial);
+    TEST_ASSERT_EQUAL_HEX8(0x00, model[0].initial);
+    TEST_ASSERT_TRUE(model[0].reflectIn);
+    TEST_ASSERT_TRUE(model[0].reflectOut);
+    TEST_ASSERT_EQUAL_HEX8(0x00, model[0].xorOut);
+    
+    /*** Search CRC-16 Polynomial Range; Verify CRC-16/CCITT-FALSE Found (Initial Value Solved) ***/
+    for(s = 0; s < 5; s++)
+        sample[s].crc = crc_crc16CcittFalseCalculate(sample[s].data, sample[s].length);
+    TEST_ASSERT_EQUAL_UINT16(1, crc_reverseSearch(sample, 5, 16, 0x1000, 0x10FF, model, 4));
+    TEST_ASSERT_EQUAL(CRC_VARIANT_CRC16_CCITT_FALSE, model[0].variant);
+    TEST_ASSERT_EQUAL_HEX16(0x1021, model[0].polynomial);
+    TEST_ASSERT_EQUAL_HEX16(0xFFFF, model[0].initial);
+    TEST_ASSERT_FALSE(model[0].reflectIn);
+    TEST_ASSERT_FALSE(model[0].reflectOut);
+    TEST_ASSERT_EQUAL_HEX16(0x0000, model[0].xorOut);
+    
+    /*** Search CRC-16 Polynomial Range; Verify Non-Preset Model Found (CRC-16/ARC With Output XOR) ***/
+    for(s = 0; s < 5; s++)
+        sample[s].crc = crc_crc16ArcCalculate(sample[s].data, sample[s].length) ^ 0xFFFF;
+    TEST_ASSERT_EQUAL_UINT16(1, crc_reverseSearch(sample, 5, 16, 0x8000, 0x80FF, model, 4));
+    TEST_ASSERT_EQUAL(CRC_VARIANT_COUNT, model[0].variant);
+    TEST_ASSERT_EQUAL_HEX16(0x8005, model[0].polynomial);
+    TEST_ASSERT_EQUAL_HEX16(0x0000, model[0].initial);
+    TEST_ASSERT_TRUE(model[0].reflectIn);
+    TEST_ASSERT_TRUE(model[0].reflectOut);
+    TEST_ASSERT_EQUAL_HEX16(0xFFFF, model[0].xorOut);
+}
+
+TEST(crc_test, jitCalculate)
+{
+    const uint16_t Length[] = {1, 7, 8, 9, 13, 64, 1000};
+    uint16_t crc[CRC_VARIANT_COUNT];
+    crc_model_t model;
+    uint32_t variants = 0;
+    uint8_t l, v;
+    
+    /*** Set Up ***/
+    for(v = 0; v < CRC_VARIANT_COUNT; v++)
+        variants |= CRC_VARIANT_MASK(v);
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_EQUAL_HEX16(0x0000, crc_jitCalculate(NULL, crcTest_CheckData, sizeof(crcTest_CheckData)));
+    TEST_ASSERT_TRUE(crc_reverseModel(CRC_VARIANT_CRC8, &model));
+    TEST_ASSERT_EQUAL_HEX16(0x0000, crc_jitCalculate(&model, NULL, sizeof(crcTest_CheckData)));
+    
+    /* Invalid Width */
+    model.width = 12;
+    TEST_ASSERT_EQUAL_HEX16(0x0000, crc_jitCalculate(&model, crcTest_CheckData, sizeof(crcTest_CheckData)));
+    
+    /*** Verify Every Preset Matches Its Variant Across Block And Tail Lengths ***/
+    for(l = 0; l < (sizeof(Length) / sizeof(Length[0])); l++)
+    {
+        crc_multiCalculate(crcTest_Data, Length[l], variants, crc);
+        for(v = 0; v < CRC_VARIANT_COUNT; v++)
+        {
+            TEST_ASSERT_TRUE(crc_reverseModel((crc_variant_t)v, &model));
+            TEST_ASSERT_EQUAL_HEX16(crc[v], crc_jitCalculate(&model, crcTest_Data, Length[l]));
+        }
+    }
+    
+    /*** Verify Non-Preset Models Against Their Check Values ***/
+    /* CRC-8/AUTOSAR */
+    model.width = 8;
+    model.polynomial = 0x2F;
+    model.initial = 0xFF;
+    model.reflectIn = false;
+    model.reflectOut = false;
+    model.xorOut = 0xFF;
+    TEST_ASSERT_EQUAL_HEX16(0xDF, crc_jitCalculate(&model, crcTest_CheckData, sizeof(crcTest_CheckData)));
+    
+    /* CRC-16/KERMIT */
+    model.width = 16;
+    model.polynomial = 0x1021;
+    model.initial = 0x0000;
+    model.reflectIn = true;
+    model.reflectOut = true;
+    model.xorOut = 0x0000;
+    TEST_ASSERT_EQUAL_HEX16(0x2189, crc_jitCalculate(&model, crcTest_CheckData, sizeof(crcTest_CheckData)));
+    
+    /* CRC-16/SPI-FUJITSU */
+    model.initial = 0x1D0F;
+    model.reflectIn = false;
+    model.reflectOut = false;
+    TEST_ASSERT_EQUAL_HEX16(0xE5CC, crc_jitCalculate(&model, crcTest_CheckData, sizeof(crcTest_CheckData)));
+}
+
+TEST(crc_test, jitNative)
+{
+    crc_model_t model;
+    uint16_t polynomial;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_jitNative(NULL));
+    
+    /*** Verify Kernel Emitted Where Supported ***/
+    TEST_ASSERT_TRUE(crc_reverseModel(CRC_VARIANT_CRC16_CCITT_FALSE, &model));
+#if defined(__x86_64__) && defined(__unix__)
+    TEST_ASSERT_TRUE(crc_jitNative(&model));
+#else
+    TEST_ASSERT_FALSE(crc_jitNative(&model));
+#endif
+    
+    /*** Fill Cache; Verify Uncached Models Still Calculated (CRC-16/EN-13757, CRC-16/DNP) ***/
+    for(polynomial = 0x01; polynomial <= 0x20; polynomial++)
+    {
+        model.width = 8;
+        model.polynomial = polynomial;
+        (void)crc_jitNative(&model);
+    }
+    model.width = 16;
+    model.polynomial = 0x3D65;
+    model.initial = 0x0000;
+    model.reflectIn = false;
+    model.reflectOut = false;
+    model.xorOut = 0xFFFF;
+    TEST_ASSERT_FALSE(crc_jitNative(&model));
+    TEST_ASSERT_EQUAL_HEX16(0xC2B7, crc_jitCalculate(&model, crcTest_CheckData, sizeof(crcTest_CheckData)));
+    model.reflectIn = true;
+    model.reflectOut = true;
+    TEST_ASSERT_FALSE(crc_jitNative(&model));
+    TEST_ASSERT_EQUAL_HEX16(0xEA82, crc_jitCalculate(&model, crcTest_CheckData, sizeof(crcTest_CheckData)));
+}
+
+TEST(crc_test, tableAcquire)
+{
+    const crc_table_t *table[3];
+    crc_table_statistics_t before, after;
+    uint16_t crc[CRC_VARIANT_COUNT];
+    crc_model_t model;
+    uint32_t variants = 0;
+    uint8_t v;
+    
+    /*** Set Up ***/
+    for(v = 0; v < CRC_VARIANT_COUNT; v++)
+        variants |= CRC_VARIANT_MASK(v);
+    
+    /*** Error Check ***/
+    /* Invalid Width */
+    TEST_ASSERT_NULL(crc_tableAcquire(12, 0x080F, false));
+    
+    /* NULL Pointer */
+    crc_tableRelease(NULL);
+    TEST_ASSERT_FALSE(crc_tableStatistics(NULL));
+    TEST_ASSERT_TRUE(crc_reverseModel(CRC_VARIANT_CRC16_ARC, &model));
+    TEST_ASSERT_EQUAL_HEX16(0x0000, crc_tableCalculate(NULL, &model, crcTest_CheckData, sizeof(crcTest_CheckData)));
+    
+    /*** Same Parameter Set Shares One Table; Others Get Their Own ***/
+    TEST_ASSERT_TRUE(crc_tableStatistics(&before));
+    table[0] = crc_tableAcquire(16, 0x8005, true);
+    table[1] = crc_tableAcquire(16, 0x8005, true);
+    table[2] = crc_tableAcquire(16, 0x8005, false);
+    TEST_ASSERT_NOT_NULL(table[0]);
+    TEST_ASSERT_EQUAL_PTR(table[0], table[1]);
+    TEST_ASSERT_NOT_NULL(table[2]);
+    TEST_ASSERT_TRUE(table[0] != table[2]);
+    TEST_ASSERT_TRUE(crc_tableStatistics(&after));
+    TEST_ASSERT_EQUAL_UINT64(before.hits + 1, after.hits);
+    
+    /* Table Must Match Model */
+    TEST_ASSERT_EQUAL_HEX16(CRC_TEST_CRC16_ARC_CHECK, crc_tableCalculate(table[0], &model, crcTest_CheckData, sizeof(crcTest_CheckData)));
+    TEST_ASSERT_EQUAL_HEX16(0x0000, crc_tableCalculate(table[2], &model, crcTest_CheckData, sizeof(crcTest_CheckData)));
+    crc_tableRelease(table[0]);
+    crc_tableRelease(table[1]);
+    crc_tableRelease(table[2]);
+    
+    /*** Verify Every Preset Matches Its Variant ***/
+    crc_multiCalculate(crcTest_Data, sizeof(crcTest_Data), variants, crc);
+    for(v = 0; v < CRC_VARIANT_COUNT; v++)
+    {
+        TEST_ASSERT_TRUE(crc_reverseModel((crc_variant_t)v, &model));
+        table[0] = crc_tableAcquire(model.width, model.polynomial, model.reflectIn);
+        TEST_ASSERT_EQUAL_HEX16(crc[v], crc_tableCalculate(table[0], &model, crcTest_Data, sizeof(crcTest_Data)));
+        crc_tableRelease(table[0]);
+    }
+}
+
+TEST(crc_test, tableBudget)
+{
+    const crc_table_t *table[3];
+    crc_table_statistics_t before, after;
+    
+    /*** Zero Budget Evicts Every Idle Built Table, But Not Tables In Use ***/
+    crc_tableBudget(0);
+    TEST_ASSERT_TRUE(crc_tableStatistics(&before));
+    TEST_ASSERT_EQUAL_UINT32(0, before.residentBytes);
+    table[0] = crc_tableAcquire(8, 0x07, false);
+    table[1] = crc_tableAcquire(8, 0x1D, false);
+    crc_tableRelease(table[1]);
+    TEST_ASSERT_TRUE(crc_tableStatistics(&after));
+    TEST_ASSERT_EQUAL_UINT64(before.evictions + 1, after.evictions);
+    TEST_ASSERT_EQUAL_UINT32(256 * sizeof(uint16_t), after.residentBytes);
+    crc_tableRelease(table[0]);
+    TEST_ASSERT_TRUE(crc_tableStatistics(&after));
+    TEST_ASSERT_EQUAL_UINT32(0, after.residentBytes);
+    
+    /*** Two Table Budget Evicts Least Recently Released ***/
+    crc_tableBudget(2 * 256 * sizeof(uint16_t));
+    table[0] = crc_tableAcquire(8, 0x07, false);
+    crc_tableRelease(table[0]);
+    table[1] = crc_tableAcquire(8, 0x1D, false);
+    crc_tableRelease(table[1]);
+    table[2] = crc_tableAcquire(8, 0x31, true);
+    crc_tableRelease(table[2]);
+    TEST_ASSERT_TRUE(crc_tableStatistics(&before));
+    TEST_ASSERT_EQUAL_UINT32(2 * 256 * sizeof(uint16_t), before.residentBytes);
+    table[1] = crc_tableAcquire(8, 0x1D, false);
+    crc_tableRelease(table[1]);
+    table[0] = crc_tableAcquire(8, 0x07, false);
+    crc_tableRelease(table[0]);
+    TEST_ASSERT_TRUE(crc_tableStatistics(&after));
+    TEST_ASSERT_EQUAL_UINT64(before.hits + 1, after.hits);
+    TEST_ASSERT_EQUAL_UINT64(before.builds + 1, after.builds);
+    
+    /*** Restore Default Budget ***/
+    crc_tableBudget(32768);
+}
+
+TEST(crc_test, tableMap)
+{
+    char path[] = "/tmp/crc_test_tableXXXXXX";
+    const crc_table_t *table[2];
+    crc_table_statistics_t before, after;
+    crc_model_t model;
+    int file;
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_FALSE(crc_tableSave(NULL));
+    TEST_ASSERT_FALSE(crc_tableMap(NULL));
+    
+    /* Not A Blob */
+    file = mkstemp(path);
+    TEST_ASSERT_TRUE(file >= 0);
+    TEST_ASSERT_EQUAL(sizeof(crcTest_Data), write(file, crcTest_Data, sizeof(crcTest_Data)));
+    (void)close(file);
+    TEST_ASSERT_FALSE(crc_tableMap(path));
+    
+    /*** Save Resident Tables And Map Them ***/
+    table[0] = crc_tableAcquire(8, 0x31, true);
+    table[1] = crc_tableAcquire(16, 0x1021, false);
+    TEST_ASSERT_TRUE(crc_tableSave(path));
+    crc_tableRelease(table[0]);
+    crc_tableRelease(table[1]);
+    TEST_ASSERT_TRUE(crc_tableMap(path));
+    TEST_ASSERT_FALSE(crc_tableMap(path));
+    (void)unlink(path);
+    
+    /*** Evicted Tables Come Back From Blob Instead Of Being Built ***/
+    crc_tableBudget(0);
+    TEST_ASSERT_TRUE(crc_tableStatistics(&before));
+    TEST_ASSERT_TRUE(crc_reverseModel(CRC_VARIANT_CRC8_MAXIM, &model));
+    table[0] = crc_tableAcquire(model.width, model.polynomial, model.reflectIn);
+    TEST_ASSERT_EQUAL_HEX16(crc_crc8MaximCalculate(crcTest_Data, sizeof(crcTest_Data)), crc_tableCalculate(table[0], &model, crcTest_Data, sizeof(crcTest_Data)));
+    crc_tableRelease(table[0]);
+    TEST_ASSERT_TRUE(crc_tableStatistics(&after));
+    TEST_ASSERT_EQUAL_UINT64(before.mapped + 1, after.mapped);
+    TEST_ASSERT_EQUAL_UINT64(before.builds, after.builds);
+    TEST_ASSERT_EQUAL_UINT32(0, after.residentBytes);
+    
+    /*** Restore Default Budget ***/
+    crc_tableBudget(32768);
+}
+
+TEST(crc_test, registryFind)
+{
+    const uint16_t Check[CRC_VARIANT_COUNT] =
+    {
+        CRC_TEST_CRC8_CHECK,
+        CRC_TEST_CRC8_CDMA2000_CHECK,
+        CRC_TEST_CRC8_DARC_CHECK,
+        CRC_TEST_CRC8_DVB_S2_CHECK,
+        CRC_TEST_CRC8_EBU_CHECK,
+        CRC_TEST_CRC8_I_CODE_CHECK,
+        CRC_TEST_CRC8_ITU_CHECK,
+        CRC_TEST_CRC8_MAXIM_CHECK,
+        CRC_TEST_CRC8_ROHC_CHECK,
+        CRC_TEST_CRC8_WCDMA_CHECK,
+        CRC_TEST_CRC16_ARC_CHECK,
+        CRC_TEST_CRC16_CCITT_FALSE_CHECK
+    };
+    const crc_registry_t *entry;
+    uint16_t crc[CRC_VARIANT_COUNT];
+    uint32_t variants = 0;
+    uint16_t crcA, crcB;
+    uint8_t v;
+    
+    /*** Set Up ***/
+    for(v = 0; v < CRC_VARIANT_COUNT; v++)
+        variants |= CRC_VARIANT_MASK(v);
+    crc_multiCalculate(crcTest_Data, sizeof(crcTest_Data), variants, crc);
+    
+    /*** Error Check ***/
+    /* NULL Pointer */
+    TEST_ASSERT_NULL(crc_registryFind(NULL));
+    
+    /* Unknown Name */
+    TEST_ASSERT_NULL(crc_registryFind(""));
+    TEST_ASSERT_NULL(crc_registryFind("CRC-8/UNKNOWN"));
+    TEST_ASSERT_NULL(crc_registryFind("crc-16/arc"));
+    
+    /*** Verify Every Variant By Canonical Name: Check Value, Full Data And Combined Halves ***/
+    for(v = 0; v < CRC_VARIANT_COUNT; v++)
+    {
+        entry = crc_registryFind(crc_variantName((crc_variant_t)v));
+        TEST_ASSERT_NOT_NULL(entry);
+        TEST_ASSERT_EQUAL(v, entry->variant);
+        TEST_ASSERT_EQUAL_STRING(crc_variantName((crc_variant_t)v), entry->name);
+        TEST_ASSERT_EQUAL_HEX16(Check[v], entry->finalize(entry->update(entry->initialize(), crcTest_CheckData, sizeof(crcTest_CheckData))));
+        TEST_ASSERT_EQUAL_HEX16(crc[v], entry->finalize(entry->update(entry->initialize(), crcTest_Data, sizeof(crcTest_Data))));
+        crcA = entry->finalize(entry->update(entry->initialize(), crcTest_Data, 300));
+        crcB = entry->finalize(entry->update(entry->initialize(), &crcTest_Data[300], 700));
+        TEST_ASSERT_EQUAL_HEX16(crc[v], entry->combine(crcA, crcB, 700));
+        TEST_ASSERT_EQUAL_HEX16(crcA, entry->combine(crcA, crcB, 0));
+    }
+    
+    /*** Verify Aliases Resolve To Their Variant ***/
+    TEST_ASSERT_EQUAL_PTR(crc_registryFind("CRC-16/ARC"), crc_registryFind("CRC-16"));
+    TEST_ASSERT_EQUAL_PTR(crc_registryFind("CRC-16/ARC"), crc_registryFind("ARC"));
+    TEST_ASSERT_EQUAL_PTR(crc_registryFind("CRC-16/CCITT-FALSE"), crc_registryFind("CRC-16/IBM-3740"));
+    TEST_ASSERT_EQUAL_PTR(crc_registryFind("CRC-8/MAXIM"), crc_registryFind("DOW-CRC"));
+    TEST_ASSERT_EQUAL_PTR(crc_registryFind("CRC-8/EBU"), crc_registryFind("CRC-8/AES"));
+    TEST_ASSERT_EQUAL_PTR(crc_registryFind("CRC-8/ITU"), crc_registryFind("CRC-8/I-432-1"));
+    TEST_ASSERT_EQUAL_PTR(crc_registryFind("CRC-8"), crc_registryFind("CRC-8/SMBUS"));
+}
+
+/****************************************************************************************************
+ * FUNCT:   crcTest_registrySlot
+ * BRIEF:   Get Registry Slot Of Name (Top Bits Of FNV-1a From CRC_TEST_REGISTRY_SEED)
+ * RETURN:  uint8_t: Slot
+ * ARG:     Name: Canonical Name Or Alias
+ ****************************************************************************************************/
+static uint8_t crcTest_registrySlot(const char * const Name)
+{
+    uint32_t hash = CRC_TEST_REGISTRY_SEED;
+    const char *c;
+    
+    for(c = Name; *c != '\0'; c++)
+        hash = (hash ^ (uint8_t)*c) * 16777619U;
+    
+    return (uint8_t)(hash >> (32 - CRC_TEST_REGISTRY_SLOT_BITS));
+}
+
+TEST(crc_test, registryNames)
+{
+    const struct
+    {
+        const char *name;
+        crc_variant_t variant;
+        uint32_t slot;
+    } Name[CRC_TEST_REGISTRY_NAME_COUNT] =
+    {
+        {"CRC-8",              CRC_VARIANT_CRC8,                6},
+        {"CRC-8/SMBUS",        CRC_VARIANT_CRC8,               18},
+        {"CRC-8/CDMA2000",     CRC_VARIANT_CRC8_CDMA2000,      13},
+        {"CRC-8/DARC",         CRC_VARIANT_CRC8_DARC,          19},
+        {"CRC-8/DVB-S2",       CRC_VARIANT_CRC8_DVB_S2,        11},
+        {"CRC-8/EBU",          CRC_VARIANT_CRC8_EBU,            0},
+        {"CRC-8/AES",          CRC_VARIANT_CRC8_EBU,           21},
+        {"CRC-8/TECH-3250",    CRC_VARIANT_CRC8_EBU,           10},
+        {"CRC-8/I-CODE",       CRC_VARIANT_CRC8_I_CODE,        63},
+        {"CRC-8/ITU",          CRC_VARIANT_CRC8_ITU,           50},
+        {"CRC-8/I-432-1",      CRC_VARIANT_CRC8_ITU,            1},
+        {"CRC-8/MAXIM",        CRC_VARIANT_CRC8_MAXIM,         61},
+        {"CRC-8/MAXIM-DOW",    CRC_VARIANT_CRC8_MAXIM,         37},
+        {"DOW-CRC",            CRC_VARIANT_CRC8_MAXIM,         62},
+        {"CRC-8/ROHC",         CRC_VARIANT_CRC8_ROHC,          14},
+        {"CRC-8/WCDMA",        CRC_VARIANT_CRC8_WCDMA,         26},
+        {"CRC-16/ARC",         CRC_VARIANT_CRC16_ARC,          25},
+        {"ARC",                CRC_VARIANT_CRC16_ARC,          56},
+        {"CRC-16",             CRC_VARIANT_CRC16_ARC,          59},
+        {"CRC-16/LHA",         CRC_VARIANT_CRC16_ARC,          17},
+        {"CRC-IBM",            CRC_VARIANT_CRC16_ARC,          20},
+        {"CRC-16/CCITT-FALSE", CRC_VARIANT_CRC16_CCITT_FALSE,  48},
+        {"CRC-16/IBM-3740",    CRC_VARIANT_CRC16_CCITT_FALSE,   7},
+        {"CRC-16/AUTOSAR",     CRC_VARIANT_CRC16_CCITT_FALSE,  15}
+    };
+    const uint16_t Check[CRC_VARIANT_COUNT] =
+    {
+        CRC_TEST_CRC8_CHECK,
+        CRC_TEST_CRC8_CDMA2000_CHECK,
+        CRC_TEST_CRC8_DARC_CHECK,
+        CRC_TEST_CRC8_DVB_S2_CHECK,
+        CRC_TEST_CRC8_EBU_CHECK,
+        CRC_TEST_CRC8_I_CODE_CHECK,
+        CRC_TEST_CRC8_ITU_CHECK,
+        CRC_TEST_CRC8_MAXIM_CHECK,
+        CRC_TEST_CRC8_ROHC_CHECK,
+        CRC_TEST_CRC8_WCDMA_CHECK,
+        CRC_TEST_CRC16_ARC_CHECK,
+        CRC_TEST_CRC16_CCITT_FALSE_CHECK
+    };
+    const crc_registry_t *entry;
+    uint64_t used = 0;
+    uint8_t n, slot;
+    
+    /*** Verify Every Name Hashes To Its Own Slot And Resolves To Its Variant ***/
+    for(n = 0; n < CRC_TEST_REGISTRY_NAME_COUNT; n++)
+    {
+        slot = crcTest_registrySlot(Name[n].name);
+        TEST_ASSERT_EQUAL_UINT32(Name[n].slot, slot);
+        TEST_ASSERT_EQUAL_UINT64(0, used & (1ULL << slot));
+        used |= 1ULL << slot;
+        
+        entry = crc_registryFind(Name[n].name);
+        TEST_ASSERT_NOT_NULL(entry);
+        TEST_ASSERT_EQUAL(Name[n].variant, entry->variant);
+        TEST_ASSERT_EQUAL_STRING(crc_variantName(Name[n].variant), entry->name);
+        TEST_ASSERT_EQUAL_HEX16(Check[Name[n].variant], entry->finalize(entry->update(entry->initialize(), crcTest_CheckData, sizeof(crcTest_CheckData))));
+    }
 }
 
 /****************************************************************************************************
@@ -452,49 +5013,224 @@ TEST_GROUP_RUNNER(crc_test)
     /* CRC-8 */
     RUN_TEST_CASE(crc_test, crc8Calculate)
     RUN_TEST_CASE(crc_test, crc8CalculatePartial)
+    RUN_TEST_CASE(crc_test, crc8Step)
+    RUN_TEST_CASE(crc_test, crc8Modify)
+    RUN_TEST_CASE(crc_test, crc8ModifyBatch)
+    RUN_TEST_CASE(crc_test, crc8RollingInitialize)
+    RUN_TEST_CASE(crc_test, crc8RollingUpdate)
+    RUN_TEST_CASE(crc_test, crc8StripPrefix)
+    RUN_TEST_CASE(crc_test, crc8Unwind)
+    RUN_TEST_CASE(crc_test, crc8Prefix)
+    RUN_TEST_CASE(crc_test, crc8CalculateMasked)
+    RUN_TEST_CASE(crc_test, crc8CalculateBits)
+    RUN_TEST_CASE(crc_test, crc8Verify)
+    RUN_TEST_CASE(crc_test, crc8Correct)
+    RUN_TEST_CASE(crc_test, crc8Forge)
     
     /* CRC-8/CDMA2000 */
     RUN_TEST_CASE(crc_test, crc8Cdma2000Calculate)
     RUN_TEST_CASE(crc_test, crc8Cdma2000CalculatePartial)
+    RUN_TEST_CASE(crc_test, crc8Cdma2000Step)
+    RUN_TEST_CASE(crc_test, crc8Cdma2000Modify)
+    RUN_TEST_CASE(crc_test, crc8Cdma2000ModifyBatch)
+    RUN_TEST_CASE(crc_test, crc8Cdma2000RollingInitialize)
+    RUN_TEST_CASE(crc_test, crc8Cdma2000RollingUpdate)
+    RUN_TEST_CASE(crc_test, crc8Cdma2000StripPrefix)
+    RUN_TEST_CASE(crc_test, crc8Cdma2000Unwind)
+    RUN_TEST_CASE(crc_test, crc8Cdma2000Prefix)
+    RUN_TEST_CASE(crc_test, crc8Cdma2000CalculateMasked)
+    RUN_TEST_CASE(crc_test, crc8Cdma2000CalculateBits)
+    RUN_TEST_CASE(crc_test, crc8Cdma2000Verify)
+    RUN_TEST_CASE(crc_test, crc8Cdma2000Forge)
     
     /* CRC-8/DARC */
     RUN_TEST_CASE(crc_test, crc8DarcCalculate)
     RUN_TEST_CASE(crc_test, crc8DarcCalculatePartial)
+    RUN_TEST_CASE(crc_test, crc8DarcStep)
+    RUN_TEST_CASE(crc_test, crc8DarcModify)
+    RUN_TEST_CASE(crc_test, crc8DarcModifyBatch)
+    RUN_TEST_CASE(crc_test, crc8DarcRollingInitialize)
+    RUN_TEST_CASE(crc_test, crc8DarcRollingUpdate)
+    RUN_TEST_CASE(crc_test, crc8DarcStripPrefix)
+    RUN_TEST_CASE(crc_test, crc8DarcUnwind)
+    RUN_TEST_CASE(crc_test, crc8DarcPrefix)
+    RUN_TEST_CASE(crc_test, crc8DarcCalculateMasked)
+    RUN_TEST_CASE(crc_test, crc8DarcCalculateBits)
+    RUN_TEST_CASE(crc_test, crc8DarcVerify)
+    RUN_TEST_CASE(crc_test, crc8DarcForge)
     
     /* CRC-8/DVB-S2 */
     RUN_TEST_CASE(crc_test, crc8DvbS2Calculate)
     RUN_TEST_CASE(crc_test, crc8DvbS2CalculatePartial)
+    RUN_TEST_CASE(crc_test, crc8DvbS2Step)
+    RUN_TEST_CASE(crc_test, crc8DvbS2CalculateFixedLength)
+    RUN_TEST_CASE(crc_test, crc8DvbS2Modify)
+    RUN_TEST_CASE(crc_test, crc8DvbS2ModifyBatch)
+    RUN_TEST_CASE(crc_test, crc8DvbS2RollingInitialize)
+    RUN_TEST_CASE(crc_test, crc8DvbS2RollingUpdate)
+    RUN_TEST_CASE(crc_test, crc8DvbS2StripPrefix)
+    RUN_TEST_CASE(crc_test, crc8DvbS2Unwind)
+    RUN_TEST_CASE(crc_test, crc8DvbS2Prefix)
+    RUN_TEST_CASE(crc_test, crc8DvbS2CalculateMasked)
+    RUN_TEST_CASE(crc_test, crc8DvbS2CalculateBits)
+    RUN_TEST_CASE(crc_test, crc8DvbS2Verify)
+    RUN_TEST_CASE(crc_test, crc8DvbS2Forge)
     
     /* CRC-8/EBU */
     RUN_TEST_CASE(crc_test, crc8EbuCalculate)
     RUN_TEST_CASE(crc_test, crc8EbuCalculatePartial)
+    RUN_TEST_CASE(crc_test, crc8EbuStep)
+    RUN_TEST_CASE(crc_test, crc8EbuModify)
+    RUN_TEST_CASE(crc_test, crc8EbuModifyBatch)
+    RUN_TEST_CASE(crc_test, crc8EbuRollingInitialize)
+    RUN_TEST_CASE(crc_test, crc8EbuRollingUpdate)
+    RUN_TEST_CASE(crc_test, crc8EbuStripPrefix)
+    RUN_TEST_CASE(crc_test, crc8EbuUnwind)
+    RUN_TEST_CASE(crc_test, crc8EbuPrefix)
+    RUN_TEST_CASE(crc_test, crc8EbuCalculateMasked)
+    RUN_TEST_CASE(crc_test, crc8EbuCalculateBits)
+    RUN_TEST_CASE(crc_test, crc8EbuVerify)
+    RUN_TEST_CASE(crc_test, crc8EbuForge)
     
     /* CRC-8/I-CODE */
     RUN_TEST_CASE(crc_test, crc8ICodeCalculate)
     RUN_TEST_CASE(crc_test, crc8ICodeCalculatePartial)
+    RUN_TEST_CASE(crc_test, crc8ICodeStep)
+    RUN_TEST_CASE(crc_test, crc8ICodeModify)
+    RUN_TEST_CASE(crc_test, crc8ICodeModifyBatch)
+    RUN_TEST_CASE(crc_test, crc8ICodeRollingInitialize)
+    RUN_TEST_CASE(crc_test, crc8ICodeRollingUpdate)
+    RUN_TEST_CASE(crc_test, crc8ICodeStripPrefix)
+    RUN_TEST_CASE(crc_test, crc8ICodeUnwind)
+    RUN_TEST_CASE(crc_test, crc8ICodePrefix)
+    RUN_TEST_CASE(crc_test, crc8ICodeCalculateMasked)
+    RUN_TEST_CASE(crc_test, crc8ICodeCalculateBits)
+    RUN_TEST_CASE(crc_test, crc8ICodeVerify)
+    RUN_TEST_CASE(crc_test, crc8ICodeForge)
     
     /* CRC-8/ITU */
     RUN_TEST_CASE(crc_test, crc8ItuCalculate)
     RUN_TEST_CASE(crc_test, crc8ItuCalculatePartial)
+    RUN_TEST_CASE(crc_test, crc8ItuStep)
+    RUN_TEST_CASE(crc_test, crc8ItuModify)
+    RUN_TEST_CASE(crc_test, crc8ItuModifyBatch)
+    RUN_TEST_CASE(crc_test, crc8ItuRollingInitialize)
+    RUN_TEST_CASE(crc_test, crc8ItuRollingUpdate)
+    RUN_TEST_CASE(crc_test, crc8ItuStripPrefix)
+    RUN_TEST_CASE(crc_test, crc8ItuUnwind)
+    RUN_TEST_CASE(crc_test, crc8ItuPrefix)
+    RUN_TEST_CASE(crc_test, crc8ItuCalculateMasked)
+    RUN_TEST_CASE(crc_test, crc8ItuCalculateBits)
+    RUN_TEST_CASE(crc_test, crc8ItuVerify)
+    RUN_TEST_CASE(crc_test, crc8ItuForge)
     
     /* CRC-8/MAXIM */
     RUN_TEST_CASE(crc_test, crc8MaximCalculate)
     RUN_TEST_CASE(crc_test, crc8MaximCalculatePartial)
+    RUN_TEST_CASE(crc_test, crc8MaximStep)
+    RUN_TEST_CASE(crc_test, crc8MaximCalculateFixedLength)
+    RUN_TEST_CASE(crc_test, crc8MaximModify)
+    RUN_TEST_CASE(crc_test, crc8MaximModifyBatch)
+    RUN_TEST_CASE(crc_test, crc8MaximRollingInitialize)
+    RUN_TEST_CASE(crc_test, crc8MaximRollingUpdate)
+    RUN_TEST_CASE(crc_test, crc8MaximStripPrefix)
+    RUN_TEST_CASE(crc_test, crc8MaximUnwind)
+    RUN_TEST_CASE(crc_test, crc8MaximPrefix)
+    RUN_TEST_CASE(crc_test, crc8MaximCalculateMasked)
+    RUN_TEST_CASE(crc_test, crc8MaximCalculateBits)
+    RUN_TEST_CASE(crc_test, crc8MaximVerify)
+    RUN_TEST_CASE(crc_test, crc8MaximForge)
     
     /* CRC-8/ROHC */
     RUN_TEST_CASE(crc_test, crc8RohcCalculate)
     RUN_TEST_CASE(crc_test, crc8RohcCalculatePartial)
+    RUN_TEST_CASE(crc_test, crc8RohcStep)
+    RUN_TEST_CASE(crc_test, crc8RohcModify)
+    RUN_TEST_CASE(crc_test, crc8RohcModifyBatch)
+    RUN_TEST_CASE(crc_test, crc8RohcRollingInitialize)
+    RUN_TEST_CASE(crc_test, crc8RohcRollingUpdate)
+    RUN_TEST_CASE(crc_test, crc8RohcStripPrefix)
+    RUN_TEST_CASE(crc_test, crc8RohcUnwind)
+    RUN_TEST_CASE(crc_test, crc8RohcPrefix)
+    RUN_TEST_CASE(crc_test, crc8RohcCalculateMasked)
+    RUN_TEST_CASE(crc_test, crc8RohcCalculateBits)
+    RUN_TEST_CASE(crc_test, crc8RohcVerify)
+    RUN_TEST_CASE(crc_test, crc8RohcForge)
     
     /* CRC-8/WCDMA */
     RUN_TEST_CASE(crc_test, crc8WcdmaCalculate)
     RUN_TEST_CASE(crc_test, crc8WcdmaCalculatePartial)
+    RUN_TEST_CASE(crc_test, crc8WcdmaStep)
+    RUN_TEST_CASE(crc_test, crc8WcdmaModify)
+    RUN_TEST_CASE(crc_test, crc8WcdmaModifyBatch)
+    RUN_TEST_CASE(crc_test, crc8WcdmaRollingInitialize)
+    RUN_TEST_CASE(crc_test, crc8WcdmaRollingUpdate)
+    RUN_TEST_CASE(crc_test, crc8WcdmaStripPrefix)
+    RUN_TEST_CASE(crc_test, crc8WcdmaUnwind)
+    RUN_TEST_CASE(crc_test, crc8WcdmaPrefix)
+    RUN_TEST_CASE(crc_test, crc8WcdmaCalculateMasked)
+    RUN_TEST_CASE(crc_test, crc8WcdmaCalculateBits)
+    RUN_TEST_CASE(crc_test, crc8WcdmaVerify)
+    RUN_TEST_CASE(crc_test, crc8WcdmaForge)
     
     /*** CRC-16 ***/
     /* CRC-16/ARC */
     RUN_TEST_CASE(crc_test, crc16ArcCalculate)
     RUN_TEST_CASE(crc_test, crc16ArcCalculatePartial)
+    RUN_TEST_CASE(crc_test, crc16ArcStep)
+    RUN_TEST_CASE(crc_test, crc16ArcModify)
+    RUN_TEST_CASE(crc_test, crc16ArcModifyBatch)
+    RUN_TEST_CASE(crc_test, crc16ArcRollingInitialize)
+    RUN_TEST_CASE(crc_test, crc16ArcRollingUpdate)
+    RUN_TEST_CASE(crc_test, crc16ArcStripPrefix)
+    RUN_TEST_CASE(crc_test, crc16ArcUnwind)
+    RUN_TEST_CASE(crc_test, crc16ArcPrefix)
+    RUN_TEST_CASE(crc_test, crc16ArcCalculateMasked)
+    RUN_TEST_CASE(crc_test, crc16ArcCalculateBits)
+    RUN_TEST_CASE(crc_test, crc16ArcVerify)
+    RUN_TEST_CASE(crc_test, crc16ArcForge)
     
     /* CRC-16/CCITT-FALSE */
     RUN_TEST_CASE(crc_test, crc16CcittFalseCalculate)
     RUN_TEST_CASE(crc_test, crc16CcittFalseCalculatePartial)
+    RUN_TEST_CASE(crc_test, crc16CcittFalseStep)
+    RUN_TEST_CASE(crc_test, crc16CcittFalseModify)
+    RUN_TEST_CASE(crc_test, crc16CcittFalseModifyBatch)
+    RUN_TEST_CASE(crc_test, crc16CcittFalseRollingInitialize)
+    RUN_TEST_CASE(crc_test, crc16CcittFalseRollingUpdate)
+    RUN_TEST_CASE(crc_test, crc16CcittFalseStripPrefix)
+    RUN_TEST_CASE(crc_test, crc16CcittFalseUnwind)
+    RUN_TEST_CASE(crc_test, crc16CcittFalsePrefix)
+    RUN_TEST_CASE(crc_test, crc16CcittFalseCalculateMasked)
+    RUN_TEST_CASE(crc_test, crc16CcittFalseCalculateBits)
+    RUN_TEST_CASE(crc_test, crc16CcittFalseVerify)
+    RUN_TEST_CASE(crc_test, crc16CcittFalseCorrect)
+    RUN_TEST_CASE(crc_test, crc16CcittFalseForge)
+    
+    /*** Multi ***/
+    RUN_TEST_CASE(crc_test, multiCalculate)
+    
+    /*** Variant ***/
+    RUN_TEST_CASE(crc_test, variantName)
+    
+    /*** Metrics ***/
+    RUN_TEST_CASE(crc_test, metricsSnapshot)
+    
+    /*** Reverse ***/
+    RUN_TEST_CASE(crc_test, reverseModel)
+    RUN_TEST_CASE(crc_test, reversePreset)
+    RUN_TEST_CASE(crc_test, reverseSearch)
+    
+    /*** JIT ***/
+    RUN_TEST_CASE(crc_test, jitCalculate)
+    RUN_TEST_CASE(crc_test, jitNative)
+    
+    /*** Table ***/
+    RUN_TEST_CASE(crc_test, tableAcquire)
+    RUN_TEST_CASE(crc_test, tableBudget)
+    RUN_TEST_CASE(crc_test, tableMap)
+    
+    /*** Registry ***/
+    RUN_TEST_CASE(crc_test, registryFind)
+    RUN_TEST_CASE(crc_test, registryNames)
 }